@@ -2,6 +2,9 @@
 #include "../../frame_interpolation.h"
 #include "../../UIWidgets.hpp"
 
+#include <array>
+#include <cstring>
+#include <map>
 #include <vector>
 #include <string>
 #include <cmath>
@@ -332,8 +335,55 @@ void InitGfx(std::vector<Gfx>& gfx, ColRenderSetting setting) {
     gfx.push_back(gsDPSetEnvColor(0xFF, 0xFF, 0xFF, alpha));
 }
 
-// Draws a dynapoly structure (scenes or Bg Actors)
-void DrawDynapoly(std::vector<Gfx>& dl, CollisionHeader* col, int32_t bgId) {
+enum DynapolyColor {
+    DYNAPOLY_COLOR_HOOKSHOT,
+    DYNAPOLY_COLOR_INTERACTABLE,
+    DYNAPOLY_COLOR_VOID,
+    DYNAPOLY_COLOR_ENTRANCE,
+    DYNAPOLY_COLOR_SPECIAL_SURFACE,
+    DYNAPOLY_COLOR_SLOPE,
+    DYNAPOLY_COLOR_NORMAL,
+    DYNAPOLY_COLOR_MAX,
+};
+
+typedef std::array<Color_RGBA8, DYNAPOLY_COLOR_MAX> DynapolyColors;
+
+// The vertices and commands built for one dynapoly structure. These don't depend on where the structure is, Bg Actors
+// are moved with a matrix around them, so they're only rebuilt when the structure or the colors change.
+struct DynapolyCache {
+    CollisionPoly* polyList;
+    Vec3s* vtxList;
+    u16 numPolygons;
+    DynapolyColors colors;
+    std::vector<Vtx> vtx;
+    std::vector<Gfx> gfx;
+    bool used;
+};
+
+// Colors for this frame, looked up once instead of for every poly
+static DynapolyColors dynapolyColors;
+static std::map<std::pair<CollisionHeader*, int32_t>, DynapolyCache> dynapolyCaches;
+
+void UpdateDynapolyColors() {
+    dynapolyColors[DYNAPOLY_COLOR_HOOKSHOT] = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorHookshot"), { 128, 128, 255, 255 });
+    dynapolyColors[DYNAPOLY_COLOR_INTERACTABLE] = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorInteractable"), { 192, 0, 192, 255 });
+    dynapolyColors[DYNAPOLY_COLOR_VOID] = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorVoid"), { 255, 0, 0, 255 });
+    dynapolyColors[DYNAPOLY_COLOR_ENTRANCE] = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorEntrance"), { 0, 255, 0, 255 });
+    dynapolyColors[DYNAPOLY_COLOR_SPECIAL_SURFACE] = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorSpecialSurface"), { 192, 255, 192, 255 });
+    dynapolyColors[DYNAPOLY_COLOR_SLOPE] = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorSlope"), { 255, 255, 128, 255 });
+    dynapolyColors[DYNAPOLY_COLOR_NORMAL] = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorNormal"), { 255, 255, 255, 255 });
+}
+
+// Builds the vertices and commands for a dynapoly structure into its cache
+void BuildDynapoly(DynapolyCache& cache, CollisionHeader* col, int32_t bgId) {
+    std::vector<Vtx>& vtx = cache.vtx;
+    std::vector<Gfx>& dl = cache.gfx;
+
+    vtx.clear();
+    dl.clear();
+    // The commands point into vtx, so it must not reallocate while they're built
+    vtx.reserve(col->numPolygons * 3);
+
     Color_RGBA8 color = {255, 255, 255, 255};
 
     uint32_t lastColorR = color.r;
@@ -350,27 +400,27 @@ void DrawDynapoly(std::vector<Gfx>& dl, CollisionHeader* col, int32_t bgId) {
         CollisionPoly* poly = &col->polyList[i];
 
         if (SurfaceType_IsHookshotSurface(&gPlayState->colCtx, poly, bgId)) {
-            color = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorHookshot"), { 128, 128, 255, 255 });
+            color = dynapolyColors[DYNAPOLY_COLOR_HOOKSHOT];
         } else if (func_80041D94(&gPlayState->colCtx, poly, bgId) > 0x01) {
-            color = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorInteractable"), {192, 0, 192, 255});
+            color = dynapolyColors[DYNAPOLY_COLOR_INTERACTABLE];
         } else if (func_80041E80(&gPlayState->colCtx, poly, bgId) == 0x0C) {
-            color = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorVoid"), { 255, 0, 0, 255 });
+            color = dynapolyColors[DYNAPOLY_COLOR_VOID];
         } else if (SurfaceType_GetSceneExitIndex(&gPlayState->colCtx, poly, bgId) ||
                    func_80041E80(&gPlayState->colCtx, poly, bgId) == 0x05) {
-            color = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorEntrance"), { 0, 255, 0, 255 });
+            color = dynapolyColors[DYNAPOLY_COLOR_ENTRANCE];
         } else if (func_80041D4C(&gPlayState->colCtx, poly, bgId) != 0 ||
                    SurfaceType_IsWallDamage(&gPlayState->colCtx, poly, bgId)) {
-            color = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorSpecialSurface"), { 192, 255, 192, 255 });
+            color = dynapolyColors[DYNAPOLY_COLOR_SPECIAL_SURFACE];
         } else if (SurfaceType_GetSlope(&gPlayState->colCtx, poly, bgId) == 0x01) {
-            color = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorSlope"), { 255, 255, 128, 255 });
+            color = dynapolyColors[DYNAPOLY_COLOR_SLOPE];
         } else {
-            color = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorNormal"), { 255, 255, 255, 255 });
+            color = dynapolyColors[DYNAPOLY_COLOR_NORMAL];
         }
 
         if (color.r != lastColorR || color.g != lastColorG || color.b != lastColorB) {
             // Color changed, flush previous poly
             if (previousPoly) {
-                dl.push_back(gsSPVertex((uintptr_t)&vtxDl.at(vtxDl.size() - 3), 3, 0));
+                dl.push_back(gsSPVertex((uintptr_t)&vtx.at(vtx.size() - 3), 3, 0));
                 dl.push_back(gsSP1Triangle(0, 1, 2, 0));
                 previousPoly = false;
             }
@@ -383,18 +433,18 @@ void DrawDynapoly(std::vector<Gfx>& dl, CollisionHeader* col, int32_t bgId) {
         Vec3s* va = &col->vtxList[COLPOLY_VTX_INDEX(poly->flags_vIA)];
         Vec3s* vb = &col->vtxList[COLPOLY_VTX_INDEX(poly->flags_vIB)];
         Vec3s* vc = &col->vtxList[COLPOLY_VTX_INDEX(poly->vIC)];
-        vtxDl.push_back(gdSPDefVtxN(va->x, va->y, va->z, 0, 0, (signed char)(poly->normal.x / 0x100),
-                                    (signed char)(poly->normal.y / 0x100), (signed char)(poly->normal.z / 0x100),
-                                    0xFF));
-        vtxDl.push_back(gdSPDefVtxN(vb->x, vb->y, vb->z, 0, 0, (signed char)(poly->normal.x / 0x100),
-                                    (signed char)(poly->normal.y / 0x100), (signed char)(poly->normal.z / 0x100),
-                                    0xFF));
-        vtxDl.push_back(gdSPDefVtxN(vc->x, vc->y, vc->z, 0, 0, (signed char)(poly->normal.x / 0x100),
-                                    (signed char)(poly->normal.y / 0x100), (signed char)(poly->normal.z / 0x100),
-                                    0xFF));
+        vtx.push_back(gdSPDefVtxN(va->x, va->y, va->z, 0, 0, (signed char)(poly->normal.x / 0x100),
+                                  (signed char)(poly->normal.y / 0x100), (signed char)(poly->normal.z / 0x100),
+                                  0xFF));
+        vtx.push_back(gdSPDefVtxN(vb->x, vb->y, vb->z, 0, 0, (signed char)(poly->normal.x / 0x100),
+                                  (signed char)(poly->normal.y / 0x100), (signed char)(poly->normal.z / 0x100),
+                                  0xFF));
+        vtx.push_back(gdSPDefVtxN(vc->x, vc->y, vc->z, 0, 0, (signed char)(poly->normal.x / 0x100),
+                                  (signed char)(poly->normal.y / 0x100), (signed char)(poly->normal.z / 0x100),
+                                  0xFF));
 
         if (previousPoly) {
-            dl.push_back(gsSPVertex((uintptr_t)&vtxDl.at(vtxDl.size() - 6), 6, 0));
+            dl.push_back(gsSPVertex((uintptr_t)&vtx.at(vtx.size() - 6), 6, 0));
             dl.push_back(gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0));
             previousPoly = false;
         } else {
@@ -404,10 +454,44 @@ void DrawDynapoly(std::vector<Gfx>& dl, CollisionHeader* col, int32_t bgId) {
 
     // Flush previous poly if this is the end and there's no more coming
     if (previousPoly) {
-        dl.push_back(gsSPVertex((uintptr_t)&vtxDl.at(vtxDl.size() - 3), 3, 0));
+        dl.push_back(gsSPVertex((uintptr_t)&vtx.at(vtx.size() - 3), 3, 0));
         dl.push_back(gsSP1Triangle(0, 1, 2, 0));
         previousPoly = false;
     }
+
+    dl.push_back(gsSPEndDisplayList());
+
+    cache.polyList = col->polyList;
+    cache.vtxList = col->vtxList;
+    cache.numPolygons = col->numPolygons;
+    cache.colors = dynapolyColors;
+}
+
+// Draws a dynapoly structure (scenes or Bg Actors)
+void DrawDynapoly(std::vector<Gfx>& dl, CollisionHeader* col, int32_t bgId) {
+    DynapolyCache& cache = dynapolyCaches[{ col, bgId }];
+
+    // A header freed and another one allocated in its place would have the same address, so check what it points to
+    if (cache.gfx.empty() || cache.polyList != col->polyList || cache.vtxList != col->vtxList ||
+        cache.numPolygons != col->numPolygons ||
+        memcmp(cache.colors.data(), dynapolyColors.data(), sizeof(DynapolyColors)) != 0) {
+        BuildDynapoly(cache, col, bgId);
+    }
+    cache.used = true;
+
+    dl.push_back(gsSPDisplayList(cache.gfx.data()));
+}
+
+// Frees the caches of structures that weren't drawn this frame
+void PruneDynapolyCaches() {
+    for (auto it = dynapolyCaches.begin(); it != dynapolyCaches.end();) {
+        if (!it->second.used) {
+            it = dynapolyCaches.erase(it);
+        } else {
+            it->second.used = false;
+            it++;
+        }
+    }
 }
 
 // Draws the scene
@@ -648,6 +732,7 @@ extern "C" void DrawColViewer() {
     size_t vtxDlCapacity = ResetVector(vtxDl);
     size_t mtxDlCapacity = ResetVector(mtxDl);
 
+    UpdateDynapolyColors();
     DrawSceneCollision();
     DrawBgActorCollision();
     DrawColCheckCollision();
@@ -674,6 +759,8 @@ extern "C" void DrawColViewer() {
         return;
     }
 
+    PruneDynapolyCaches();
+
     OPEN_DISPS(gPlayState->state.gfxCtx);
 
     uint8_t mirroredWorld = CVarGetInteger(CVAR_ENHANCEMENT("MirroredWorld"), 0);
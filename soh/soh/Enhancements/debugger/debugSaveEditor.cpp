@@ -1,6 +1,7 @@
 #include "debugSaveEditor.h"
 #include "../../util.h"
 #include "../../OTRGlobals.h"
+#include "../../SaveManager.h"
 #include "../../UIWidgets.hpp"
 
 #include <spdlog/fmt/fmt.h>
@@ -608,6 +609,20 @@ void DrawInfoTab() {
         
         ImGui::TreePop();
     }
+
+    if (ImGui::TreeNode("Save Queue")) {
+        SaveManager::SaveQueueStats stats = SaveManager::Instance->GetSaveQueueStats();
+        ImGui::Text("Requests: %zu", stats.requests);
+        UIWidgets::InsertHelpHoverText("Section saves queued since the game started.");
+        ImGui::Text("Writes: %zu", stats.writes);
+        UIWidgets::InsertHelpHoverText("File writes those requests were merged into.");
+        ImGui::Text("Waiting: %zu", stats.queueDepth);
+        UIWidgets::InsertHelpHoverText("File writes still pending.");
+        ImGui::Text("Latency: %.2f ms last, %.2f ms average, %.2f ms max", stats.lastLatencyMs,
+                    stats.averageLatencyMs, stats.maxLatencyMs);
+        UIWidgets::InsertHelpHoverText("Time from the first queued request of a write to the write finishing.");
+        ImGui::TreePop();
+    }
     
     ImGui::PopItemWidth();
 }
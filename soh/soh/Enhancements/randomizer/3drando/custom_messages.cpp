@@ -1,6 +1,7 @@
 #include "custom_messages.hpp"
 #include "shops.hpp"
 #include "z64item.h"
+#include "world.hpp"
 
 #include <array>
 #include <set>
@@ -10,13 +11,6 @@ namespace CustomMessages {
 
 using namespace std::literals::string_literals;
 
-class MessageEntryComp {
-public:
-    bool operator()(const MessageEntry& lhs, const MessageEntry& rhs) const {
-        return lhs.id < rhs.id;
-    }
-};
-
 constexpr std::array EnglishDungeonNames = {
     "Deku Tree",
     "Dodongo's Cavern",
@@ -119,9 +113,6 @@ constexpr std::array DungeonColors = {
     QM_RED,
 };
 
-    std::set<MessageEntry, MessageEntryComp> messageEntries;
-    std::stringstream messageData;
-
     //textBoxType and textBoxPosition are defined here: https://wiki.cloudmodding.com/oot/Text_Format#Message_Id
     void CreateMessage(uint32_t textId, uint32_t unk_04, uint32_t textBoxType, uint32_t textBoxPosition,
                        std::string englishText, std::string frenchText, std::string spanishText) {
@@ -130,28 +121,28 @@ constexpr std::array DungeonColors = {
             while ((englishText.size() % 4) != 0) {
               englishText += "\0"s;
             }
-            messageData.seekg(0, messageData.end);
-            newEntry.info[ENGLISH_U].offset = (char*)((int)messageData.tellg());
+            world->messageData.seekg(0, world->messageData.end);
+            newEntry.info[ENGLISH_U].offset = (char*)((int)world->messageData.tellg());
             newEntry.info[ENGLISH_U].length = englishText.size();
-            messageData << englishText;
+            world->messageData << englishText;
 
             while ((frenchText.size() % 4) != 0) {
               frenchText += "\0"s;
             }
-            messageData.seekg(0, messageData.end);
-            newEntry.info[FRENCH_U].offset = (char*)((int)messageData.tellg());
+            world->messageData.seekg(0, world->messageData.end);
+            newEntry.info[FRENCH_U].offset = (char*)((int)world->messageData.tellg());
             newEntry.info[FRENCH_U].length = frenchText.size();
-            messageData << frenchText;
+            world->messageData << frenchText;
 
             while ((spanishText.size() % 4) != 0) {
               spanishText += "\0"s;
             }
-            messageData.seekg(0, messageData.end);
-            newEntry.info[SPANISH_U].offset = (char*)((int)messageData.tellg());
+            world->messageData.seekg(0, world->messageData.end);
+            newEntry.info[SPANISH_U].offset = (char*)((int)world->messageData.tellg());
             newEntry.info[SPANISH_U].length = spanishText.size();
-            messageData << spanishText;
+            world->messageData << spanishText;
 
-            messageEntries.insert(newEntry);
+            world->messageEntries.insert(newEntry);
     }
 
     void CreateMessageFromTextObject(uint32_t textId, uint32_t unk_04, uint32_t textBoxType, uint32_t textBoxPosition, const Text& text) {
@@ -250,8 +241,8 @@ constexpr std::array DungeonColors = {
     }
 
     void ClearMessages() {
-        messageEntries.clear();
-        messageData.str("");
+        world->messageEntries.clear();
+        world->messageData.str("");
     }
 
     std::string MESSAGE_END()          { return  "\x7F\x00"s; }
@@ -47,6 +47,13 @@ typedef struct {
     MessageLanguageInfo info[10];
 } MessageEntry; // size = 0x60
 
+class MessageEntryComp {
+public:
+    bool operator()(const MessageEntry& lhs, const MessageEntry& rhs) const {
+        return lhs.id < rhs.id;
+    }
+};
+
     void CreateMessage(uint32_t textId, uint32_t unk_04, uint32_t textBoxType, uint32_t textBoxPosition,
                        std::string englishText, std::string frenchText, std::string spanishText);
     void CreateMessageFromTextObject(uint32_t textId, uint32_t unk_04, uint32_t textBoxType, uint32_t textBoxPosition, const Text& text);
@@ -112,7 +112,8 @@ std::vector<uint32_t> DungeonInfo::GetEveryLocation() const {
   return locations;
 }
 
-  DungeonInfo DekuTree = DungeonInfo("Deku Tree", DEKU_TREE, DEKU_TREE_MAP, DEKU_TREE_COMPASS, NONE, NONE, NONE, 0, 0, {
+Dungeons::Dungeons()
+  : DekuTree("Deku Tree", DEKU_TREE, DEKU_TREE_MAP, DEKU_TREE_COMPASS, NONE, NONE, NONE, 0, 0, {
                             //Vanilla Locations
                             DEKU_TREE_MAP_CHEST,
                             DEKU_TREE_COMPASS_CHEST,
@@ -144,9 +145,9 @@ std::vector<uint32_t> DungeonInfo::GetEveryLocation() const {
                             // Boss Room Locations
                             DEKU_TREE_QUEEN_GOHMA_HEART,
                             QUEEN_GOHMA,
-                          });
+                          }),
 
-  DungeonInfo DodongosCavern = DungeonInfo("Dodongo's Cavern", DODONGOS_CAVERN, DODONGOS_CAVERN_MAP, DODONGOS_CAVERN_COMPASS, NONE, NONE, NONE, 0, 0, {
+    DodongosCavern("Dodongo's Cavern", DODONGOS_CAVERN, DODONGOS_CAVERN_MAP, DODONGOS_CAVERN_COMPASS, NONE, NONE, NONE, 0, 0, {
                             //Vanilla Locations
                             DODONGOS_CAVERN_MAP_CHEST,
                             DODONGOS_CAVERN_COMPASS_CHEST,
@@ -186,9 +187,9 @@ std::vector<uint32_t> DungeonInfo::GetEveryLocation() const {
                             DODONGOS_CAVERN_BOSS_ROOM_CHEST,
                             DODONGOS_CAVERN_KING_DODONGO_HEART,
                             KING_DODONGO,
-                          });
+                          }),
 
-  DungeonInfo JabuJabusBelly = DungeonInfo("Jabu Jabu's Belly", JABU_JABUS_BELLY, JABU_JABUS_BELLY_MAP, JABU_JABUS_BELLY_COMPASS, NONE, NONE, NONE, 0, 0, {
+    JabuJabusBelly("Jabu Jabu's Belly", JABU_JABUS_BELLY, JABU_JABUS_BELLY_MAP, JABU_JABUS_BELLY_COMPASS, NONE, NONE, NONE, 0, 0, {
                             //Vanilla Locations
                             JABU_JABUS_BELLY_MAP_CHEST,
                             JABU_JABUS_BELLY_COMPASS_CHEST,
@@ -222,9 +223,9 @@ std::vector<uint32_t> DungeonInfo::GetEveryLocation() const {
                             // Boss Room Locations
                             JABU_JABUS_BELLY_BARINADE_HEART,
                             BARINADE,
-                          });
+                          }),
 
-  DungeonInfo ForestTemple = DungeonInfo("Forest Temple", FOREST_TEMPLE, FOREST_TEMPLE_MAP, FOREST_TEMPLE_COMPASS, FOREST_TEMPLE_SMALL_KEY, FOREST_TEMPLE_KEY_RING, FOREST_TEMPLE_BOSS_KEY, 5, 6, {
+    ForestTemple("Forest Temple", FOREST_TEMPLE, FOREST_TEMPLE_MAP, FOREST_TEMPLE_COMPASS, FOREST_TEMPLE_SMALL_KEY, FOREST_TEMPLE_KEY_RING, FOREST_TEMPLE_BOSS_KEY, 5, 6, {
                             //Vanilla Locations
                             FOREST_TEMPLE_FIRST_ROOM_CHEST,
                             FOREST_TEMPLE_FIRST_STALFOS_CHEST,
@@ -269,9 +270,9 @@ std::vector<uint32_t> DungeonInfo::GetEveryLocation() const {
                             // Boss Room Locations
                             FOREST_TEMPLE_PHANTOM_GANON_HEART,
                             PHANTOM_GANON,
-                          });
+                          }),
 
-  DungeonInfo FireTemple = DungeonInfo("Fire Temple", FIRE_TEMPLE, FIRE_TEMPLE_MAP, FIRE_TEMPLE_COMPASS, FIRE_TEMPLE_SMALL_KEY, FIRE_TEMPLE_KEY_RING, FIRE_TEMPLE_BOSS_KEY, 8, 5, {
+    FireTemple("Fire Temple", FIRE_TEMPLE, FIRE_TEMPLE_MAP, FIRE_TEMPLE_COMPASS, FIRE_TEMPLE_SMALL_KEY, FIRE_TEMPLE_KEY_RING, FIRE_TEMPLE_BOSS_KEY, 8, 5, {
                             //Vanilla Locations
                             FIRE_TEMPLE_NEAR_BOSS_CHEST,
                             FIRE_TEMPLE_FLARE_DANCER_CHEST,
@@ -317,9 +318,9 @@ std::vector<uint32_t> DungeonInfo::GetEveryLocation() const {
                             // Boos Room Locations
                             FIRE_TEMPLE_VOLVAGIA_HEART,
                             VOLVAGIA,
-                          });
+                          }),
 
-  DungeonInfo WaterTemple = DungeonInfo("Water Temple", WATER_TEMPLE, WATER_TEMPLE_MAP, WATER_TEMPLE_COMPASS, WATER_TEMPLE_SMALL_KEY, WATER_TEMPLE_KEY_RING, WATER_TEMPLE_BOSS_KEY, 6, 2, {
+    WaterTemple("Water Temple", WATER_TEMPLE, WATER_TEMPLE_MAP, WATER_TEMPLE_COMPASS, WATER_TEMPLE_SMALL_KEY, WATER_TEMPLE_KEY_RING, WATER_TEMPLE_BOSS_KEY, 6, 2, {
                             //Vanilla Locations
                             WATER_TEMPLE_MAP_CHEST,
                             WATER_TEMPLE_COMPASS_CHEST,
@@ -355,9 +356,9 @@ std::vector<uint32_t> DungeonInfo::GetEveryLocation() const {
                             // Boss Room Locations
                             WATER_TEMPLE_MORPHA_HEART,
                             MORPHA,
-                          });
+                          }),
 
-  DungeonInfo SpiritTemple = DungeonInfo("Spirit Temple", SPIRIT_TEMPLE, SPIRIT_TEMPLE_MAP, SPIRIT_TEMPLE_COMPASS, SPIRIT_TEMPLE_SMALL_KEY, SPIRIT_TEMPLE_KEY_RING, SPIRIT_TEMPLE_BOSS_KEY, 5, 7, {
+    SpiritTemple("Spirit Temple", SPIRIT_TEMPLE, SPIRIT_TEMPLE_MAP, SPIRIT_TEMPLE_COMPASS, SPIRIT_TEMPLE_SMALL_KEY, SPIRIT_TEMPLE_KEY_RING, SPIRIT_TEMPLE_BOSS_KEY, 5, 7, {
                             //Vanilla Locations
                             SPIRIT_TEMPLE_CHILD_BRIDGE_CHEST,
                             SPIRIT_TEMPLE_CHILD_EARLY_TORCHES_CHEST,
@@ -416,9 +417,9 @@ std::vector<uint32_t> DungeonInfo::GetEveryLocation() const {
                             // Boss Room Locations
                             SPIRIT_TEMPLE_TWINROVA_HEART,
                             TWINROVA,
-                          });
+                          }),
 
-  DungeonInfo ShadowTemple = DungeonInfo("Shadow Temple", SHADOW_TEMPLE, SHADOW_TEMPLE_MAP, SHADOW_TEMPLE_COMPASS, SHADOW_TEMPLE_SMALL_KEY, SHADOW_TEMPLE_KEY_RING, SHADOW_TEMPLE_BOSS_KEY, 5, 6, {
+    ShadowTemple("Shadow Temple", SHADOW_TEMPLE, SHADOW_TEMPLE_MAP, SHADOW_TEMPLE_COMPASS, SHADOW_TEMPLE_SMALL_KEY, SHADOW_TEMPLE_KEY_RING, SHADOW_TEMPLE_BOSS_KEY, 5, 6, {
                             //Vanilla Locations
                             SHADOW_TEMPLE_MAP_CHEST,
                             SHADOW_TEMPLE_HOVER_BOOTS_CHEST,
@@ -475,9 +476,9 @@ std::vector<uint32_t> DungeonInfo::GetEveryLocation() const {
                             // Boss Room Locations
                             SHADOW_TEMPLE_BONGO_BONGO_HEART,
                             BONGO_BONGO,
-                          });
+                          }),
 
-  DungeonInfo BottomOfTheWell = DungeonInfo("Bottom of the Well", BOTTOM_OF_THE_WELL, BOTTOM_OF_THE_WELL_MAP, BOTTOM_OF_THE_WELL_COMPASS, BOTTOM_OF_THE_WELL_SMALL_KEY, BOTTOM_OF_THE_WELL_KEY_RING, NONE, 3, 2, {
+    BottomOfTheWell("Bottom of the Well", BOTTOM_OF_THE_WELL, BOTTOM_OF_THE_WELL_MAP, BOTTOM_OF_THE_WELL_COMPASS, BOTTOM_OF_THE_WELL_SMALL_KEY, BOTTOM_OF_THE_WELL_KEY_RING, NONE, 3, 2, {
                             //Vanilla Locations
                             BOTTOM_OF_THE_WELL_FRONT_LEFT_FAKE_WALL_CHEST,
                             BOTTOM_OF_THE_WELL_FRONT_CENTER_BOMBABLE_CHEST,
@@ -506,9 +507,9 @@ std::vector<uint32_t> DungeonInfo::GetEveryLocation() const {
                             BOTTOM_OF_THE_WELL_MQ_GS_BASEMENT,
                             BOTTOM_OF_THE_WELL_MQ_GS_COFFIN_ROOM,
                             BOTTOM_OF_THE_WELL_MQ_GS_WEST_INNER_ROOM,
-                          }, {}, {});
+                          }, {}, {}),
 
-  DungeonInfo IceCavern = DungeonInfo("Ice Cavern", ICE_CAVERN, ICE_CAVERN_MAP, ICE_CAVERN_COMPASS, NONE, NONE, NONE, 0, 0, {
+    IceCavern("Ice Cavern", ICE_CAVERN, ICE_CAVERN_MAP, ICE_CAVERN_COMPASS, NONE, NONE, NONE, 0, 0, {
                             //Vanilla Locations
                             ICE_CAVERN_MAP_CHEST,
                             ICE_CAVERN_COMPASS_CHEST,
@@ -529,9 +530,9 @@ std::vector<uint32_t> DungeonInfo::GetEveryLocation() const {
                           }, {
                             //Shared Locations
                             SHEIK_IN_ICE_CAVERN,
-                          }, {});
+                          }, {}),
 
-  DungeonInfo GerudoTrainingGrounds = DungeonInfo("Gerudo Training Grounds", GERUDO_TRAINING_GROUNDS, NONE, NONE, GERUDO_TRAINING_GROUNDS_SMALL_KEY, GERUDO_TRAINING_GROUNDS_KEY_RING, NONE, 9, 3, {
+    GerudoTrainingGrounds("Gerudo Training Grounds", GERUDO_TRAINING_GROUNDS, NONE, NONE, GERUDO_TRAINING_GROUNDS_SMALL_KEY, GERUDO_TRAINING_GROUNDS_KEY_RING, NONE, 9, 3, {
                             //Vanilla Locations
                             GERUDO_TRAINING_GROUNDS_LOBBY_LEFT_CHEST,
                             GERUDO_TRAINING_GROUNDS_LOBBY_RIGHT_CHEST,
@@ -574,9 +575,9 @@ std::vector<uint32_t> DungeonInfo::GetEveryLocation() const {
                             GERUDO_TRAINING_GROUNDS_MQ_HIDDEN_CEILING_CHEST,
                             GERUDO_TRAINING_GROUNDS_MQ_UNDERWATER_SILVER_RUPEE_CHEST,
                             GERUDO_TRAINING_GROUNDS_MQ_HEAVY_BLOCK_CHEST,
-                          }, {}, {});
+                          }, {}, {}),
 
-  DungeonInfo GanonsCastle = DungeonInfo("Ganon's Castle", GANONS_CASTLE, NONE, NONE, GANONS_CASTLE_SMALL_KEY, GANONS_CASTLE_KEY_RING, GANONS_CASTLE_BOSS_KEY, 2, 3, {
+    GanonsCastle("Ganon's Castle", GANONS_CASTLE, NONE, NONE, GANONS_CASTLE_SMALL_KEY, GANONS_CASTLE_KEY_RING, GANONS_CASTLE_BOSS_KEY, 2, 3, {
                             //Vanilla Locations
                             GANONS_CASTLE_FOREST_TRIAL_CHEST,
                             GANONS_CASTLE_WATER_TRIAL_LEFT_CHEST,
@@ -621,21 +622,21 @@ std::vector<uint32_t> DungeonInfo::GetEveryLocation() const {
                             //Shared Locations
                             GANONS_TOWER_BOSS_KEY_CHEST,
                             GANON,
-                          }, {});
-
-  const DungeonArray dungeonList = {
-    &DekuTree,
-    &DodongosCavern,
-    &JabuJabusBelly,
-    &ForestTemple,
-    &FireTemple,
-    &WaterTemple,
-    &SpiritTemple,
-    &ShadowTemple,
-    &BottomOfTheWell,
-    &IceCavern,
-    &GerudoTrainingGrounds,
-    &GanonsCastle,
-  };
+                          }, {}),
+
+    dungeonList{
+      &DekuTree,
+      &DodongosCavern,
+      &JabuJabusBelly,
+      &ForestTemple,
+      &FireTemple,
+      &WaterTemple,
+      &SpiritTemple,
+      &ShadowTemple,
+      &BottomOfTheWell,
+      &IceCavern,
+      &GerudoTrainingGrounds,
+      &GanonsCastle,
+    } {}
 
 } //namespace Dungeon
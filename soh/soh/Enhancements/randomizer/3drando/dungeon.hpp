@@ -89,20 +89,27 @@ private:
     std::vector<uint32_t> bossRoomLocations;
 };
 
-extern DungeonInfo DekuTree;
-extern DungeonInfo DodongosCavern;
-extern DungeonInfo JabuJabusBelly;
-extern DungeonInfo ForestTemple;
-extern DungeonInfo FireTemple;
-extern DungeonInfo WaterTemple;
-extern DungeonInfo SpiritTemple;
-extern DungeonInfo ShadowTemple;
-extern DungeonInfo BottomOfTheWell;
-extern DungeonInfo IceCavern;
-extern DungeonInfo GerudoTrainingGrounds;
-extern DungeonInfo GanonsCastle;
-
 using DungeonArray = std::array<DungeonInfo*, 12>;
 
-extern const DungeonArray dungeonList;
+//The dungeons of a world. dungeonList points into it, so it can't be copied.
+struct Dungeons {
+    Dungeons();
+    Dungeons(const Dungeons&) = delete;
+    Dungeons& operator=(const Dungeons&) = delete;
+
+    DungeonInfo DekuTree;
+    DungeonInfo DodongosCavern;
+    DungeonInfo JabuJabusBelly;
+    DungeonInfo ForestTemple;
+    DungeonInfo FireTemple;
+    DungeonInfo WaterTemple;
+    DungeonInfo SpiritTemple;
+    DungeonInfo ShadowTemple;
+    DungeonInfo BottomOfTheWell;
+    DungeonInfo IceCavern;
+    DungeonInfo GerudoTrainingGrounds;
+    DungeonInfo GanonsCastle;
+
+    const DungeonArray dungeonList;
+};
 } // namespace Dungeon
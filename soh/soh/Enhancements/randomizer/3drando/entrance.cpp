@@ -1,6 +1,7 @@
 #include "entrance.hpp"
 
 #include "fill.hpp"
+#include "fill_profiler.hpp"
 #include "settings.hpp"
 #include "item_list.hpp"
 #include "item_pool.hpp"
@@ -8,6 +9,8 @@
 #include "spoiler_log.hpp"
 #include "hints.hpp"
 #include "location_access.hpp"
+#include "world.hpp"
+#include "utils.hpp"
 
 #include <vector>
 #include <utility>
@@ -15,11 +18,6 @@
 #include <map>
 #include <spdlog/spdlog.h>
 
-std::list<EntranceOverride> entranceOverrides = {};
-bool noRandomEntrances = false;
-static bool entranceShuffleFailure = false;
-static int totalRandomizableEntrances = 0;
-static int curNumRandomizedEntrances = 0;
 
 typedef struct {
     EntranceType type;
@@ -53,7 +51,7 @@ std::string EntranceNameByRegions(uint32_t parentRegion, uint32_t connectedRegio
 // Updates the user on how many entrances are currently shuffled
 static void DisplayEntranceProgress() {
   std::string dots = ".";
-  float progress = (float)curNumRandomizedEntrances / (float)totalRandomizableEntrances;
+  float progress = (float)world->curNumRandomizedEntrances / (float)world->totalRandomizableEntrances;
   if (progress > 0.33) {
     dots += ".";
   } else {
@@ -64,9 +62,9 @@ static void DisplayEntranceProgress() {
   } else {
     dots += " ";
   }
-  printf("\x1b[7;29H%s", dots.c_str());
+  PrintProgress("\x1b[7;29H%s", dots.c_str());
   #ifdef ENABLE_DEBUG
-    if (curNumRandomizedEntrances == totalRandomizableEntrances) {
+    if (world->curNumRandomizedEntrances == world->totalRandomizableEntrances) {
       Areas::DumpWorldGraph("Finish Validation");
     }
   #endif
@@ -85,7 +83,7 @@ void SetAllEntrancesData(std::vector<EntranceInfoPair>& entranceShuffleTable) {
     forwardEntrance->SetAsPrimary();
 
     // When decouple entrances is on, mark the forward entrance
-    if (Settings::DecoupleEntrances) {
+    if (settings->DecoupleEntrances) {
       forwardEntrance->SetDecoupled();
     }
 
@@ -96,7 +94,7 @@ void SetAllEntrancesData(std::vector<EntranceInfoPair>& entranceShuffleTable) {
       forwardEntrance->BindTwoWay(returnEntrance);
 
       // Mark reverse entrance as decoupled
-      if (Settings::DecoupleEntrances) {
+      if (settings->DecoupleEntrances) {
         returnEntrance->SetDecoupled();
       }
     }
@@ -106,14 +104,14 @@ void SetAllEntrancesData(std::vector<EntranceInfoPair>& entranceShuffleTable) {
 static std::vector<Entrance*> AssumeEntrancePool(std::vector<Entrance*>& entrancePool) {
   std::vector<Entrance*> assumedPool = {};
   for (Entrance* entrance : entrancePool) {
-    totalRandomizableEntrances++;
+    world->totalRandomizableEntrances++;
     Entrance* assumedForward = entrance->AssumeReachable();
     if (entrance->GetReverse() != nullptr && !entrance->IsDecoupled()) {
       Entrance* assumedReturn = entrance->GetReverse()->AssumeReachable();
-      if (!(Settings::MixedEntrancePools && (Settings::ShuffleOverworldEntrances || Settings::ShuffleInteriorEntrances.Is(SHUFFLEINTERIORS_ALL)))) {
+      if (!(settings->MixedEntrancePools && (settings->ShuffleOverworldEntrances || settings->ShuffleInteriorEntrances.Is(SHUFFLEINTERIORS_ALL)))) {
         auto type = entrance->GetType();
         if (((type == EntranceType::Dungeon || type == EntranceType::GrottoGrave) && entrance->GetReverse()->GetName() != "Spirit Temple Entryway -> Desert Colossus From Spirit Entryway") ||
-             (type == EntranceType::Interior && Settings::ShuffleInteriorEntrances.Is(SHUFFLEINTERIORS_ALL))) {
+             (type == EntranceType::Interior && settings->ShuffleInteriorEntrances.Is(SHUFFLEINTERIORS_ALL))) {
                // In most cases, Dungeon, Grotto/Grave and Simple Interior exits shouldn't be assumed able to give access to their parent region
                assumedReturn->SetCondition([]{return false;});
              }
@@ -173,14 +171,14 @@ static std::array<std::vector<Entrance*>, 2> SplitEntrancesByRequirements(std::v
   std::vector<Entrance*> restrictiveEntrances = {};
   std::vector<Entrance*> softEntrances = {};
 
-  Logic::LogicReset();
+  logic->LogicReset();
   // Apply the effects of all advancement items to search for entrance accessibility
-  std::vector<ItemKey> items = FilterFromPool(ItemPool, [](const ItemKey i){ return ItemTable(i).IsAdvancement();});
+  std::vector<ItemKey> items = FilterFromPool(world->ItemPool, [](const ItemKey i){ return ItemTable(i).IsAdvancement();});
   for (ItemKey unplacedItem : items) {
     ItemTable(unplacedItem).ApplyEffect();
   }
   // run a search to see what's accessible
-  GetAccessibleLocations({});
+  GetAccessibleLocations(*world, {});
 
   for (Entrance* entrance : entrancesToSplit) {
     // if an entrance is accessible at all times of day by both ages, it's a soft entrance with no restrictions
@@ -316,18 +314,18 @@ static bool ValidateWorld(Entrance* entrancePlaced) {
     type = entrancePlaced->GetType();
   }
 
-  bool checkPoeCollectorAccess  = (Settings::ShuffleOverworldEntrances || Settings::ShuffleInteriorEntrances.Is(SHUFFLEINTERIORS_ALL)) && (entrancePlaced == nullptr || Settings::MixedEntrancePools ||
+  bool checkPoeCollectorAccess  = (settings->ShuffleOverworldEntrances || settings->ShuffleInteriorEntrances.Is(SHUFFLEINTERIORS_ALL)) && (entrancePlaced == nullptr || settings->MixedEntrancePools ||
                                  type == EntranceType::Interior || type == EntranceType::SpecialInterior || type == EntranceType::Overworld || type == EntranceType::Spawn || type == EntranceType::WarpSong || type == EntranceType::OwlDrop);
-  bool checkOtherEntranceAccess = (Settings::ShuffleOverworldEntrances || Settings::ShuffleInteriorEntrances.Is(SHUFFLEINTERIORS_ALL) || Settings::ShuffleOverworldSpawns) && (entrancePlaced == nullptr || Settings::MixedEntrancePools ||
+  bool checkOtherEntranceAccess = (settings->ShuffleOverworldEntrances || settings->ShuffleInteriorEntrances.Is(SHUFFLEINTERIORS_ALL) || settings->ShuffleOverworldSpawns) && (entrancePlaced == nullptr || settings->MixedEntrancePools ||
                                  type == EntranceType::SpecialInterior || type == EntranceType::Overworld || type == EntranceType::Spawn || type == EntranceType::WarpSong || type == EntranceType::OwlDrop);
 
   // Search the world to verify that all necessary conditions are still being held
   // Conditions will be checked during the search and any that fail will be figured out
   // afterwards
-  Logic::LogicReset();
-  GetAccessibleLocations({}, SearchMode::ValidateWorld, "", checkPoeCollectorAccess, checkOtherEntranceAccess);
+  logic->LogicReset();
+  GetAccessibleLocations(*world, {}, SearchMode::ValidateWorld, "", checkPoeCollectorAccess, checkOtherEntranceAccess);
 
-  if (!Settings::DecoupleEntrances) {
+  if (!settings->DecoupleEntrances) {
   // Unless entrances are decoupled, we don't want the player to end up through certain entrances as the wrong age
   // This means we need to hard check that none of the relevant entrances are ever reachable as that age
   // This is mostly relevant when mixing entrance pools or shuffling special interiors (such as windmill or kak potion shop)
@@ -373,10 +371,10 @@ static bool ValidateWorld(Entrance* entrancePlaced) {
     }
   }
 
-  if (Settings::ShuffleInteriorEntrances.IsNot(SHUFFLEINTERIORS_OFF) && Settings::GossipStoneHints.IsNot(HINTS_NO_HINTS) &&
+  if (settings->ShuffleInteriorEntrances.IsNot(SHUFFLEINTERIORS_OFF) && settings->GossipStoneHints.IsNot(HINTS_NO_HINTS) &&
   (entrancePlaced == nullptr || type == EntranceType::Interior || type == EntranceType::SpecialInterior)) {
     //When cows are shuffled, ensure both Impa's House entrances are in the same hint area because the cow is reachable from both sides
-    if (Settings::ShuffleCows) {
+    if (settings->ShuffleCows) {
       auto impasHouseFrontHintRegion = GetHintRegionHintKey(KAK_IMPAS_HOUSE);
       auto impasHouseBackHintRegion = GetHintRegionHintKey(KAK_IMPAS_HOUSE_BACK);
       if (impasHouseFrontHintRegion != NONE && impasHouseBackHintRegion != NONE && impasHouseBackHintRegion != LINKS_POCKET && impasHouseFrontHintRegion != LINKS_POCKET && impasHouseBackHintRegion != impasHouseFrontHintRegion) {
@@ -388,7 +386,7 @@ static bool ValidateWorld(Entrance* entrancePlaced) {
   }
 
   // If all locations aren't reachable, that means that one of the conditions failed when searching
-  if (!allLocationsReachable) {
+  if (!world->allLocationsReachable) {
     if (checkOtherEntranceAccess) {
       // At least one valid starting region with all basic refills should be reachable without using any items at the beginning of the seed
       if (!AreaTable(KOKIRI_FOREST)->HasAccess() && !AreaTable(KAKARIKO_VILLAGE)->HasAccess()) {
@@ -404,10 +402,10 @@ static bool ValidateWorld(Entrance* entrancePlaced) {
 
       // The player should be able to get back to ToT after going through time, without having collected any items
       // This is important to ensure that the player never loses access to the pedestal after going through time
-      if (Settings::ResolvedStartingAge == AGE_CHILD && !AreaTable(TEMPLE_OF_TIME)->Adult()) {
+      if (settings->ResolvedStartingAge == AGE_CHILD && !AreaTable(TEMPLE_OF_TIME)->Adult()) {
         SPDLOG_DEBUG("Path to Temple of Time as adult is not guaranteed\n");
         return false;
-      } else if (Settings::ResolvedStartingAge == AGE_ADULT && !AreaTable(TEMPLE_OF_TIME)->Child()) {
+      } else if (settings->ResolvedStartingAge == AGE_ADULT && !AreaTable(TEMPLE_OF_TIME)->Child()) {
         SPDLOG_DEBUG("Path to Temple of Time as child is not guaranteed\n");
         return false;
       }
@@ -441,7 +439,7 @@ static bool ReplaceEntrance(Entrance* entrance, Entrance* target, std::vector<En
       //Areas::DumpWorldGraph(ticks);
     #endif
     rollbacks.push_back(EntrancePair{entrance, target});
-    curNumRandomizedEntrances++;
+    world->curNumRandomizedEntrances++;
     DisplayEntranceProgress();
     return true;
   } else {
@@ -483,12 +481,12 @@ static bool PlaceOneWayPriorityEntrance(std::string priorityName, std::list<Area
     // Only allow Adult Spawn as sole Nocturne access if hints != mask.
     // Otherwise, child access is required here (adult access assumed or guaranteed later).
     if (entrance->GetParentRegionKey() == ADULT_SPAWN) {
-      if (priorityName != "Nocturne" || Settings::GossipStoneHints.Is(HINTS_MASK_OF_TRUTH)) {
+      if (priorityName != "Nocturne" || settings->GossipStoneHints.Is(HINTS_MASK_OF_TRUTH)) {
         continue;
       }
     }
     // If not shuffling dungeons, Nocturne requires adult access
-    if (!Settings::ShuffleDungeonEntrances && priorityName == "Nocturne") {
+    if (!settings->ShuffleDungeonEntrances && priorityName == "Nocturne") {
       if (entrance->GetType() != EntranceType::WarpSong && entrance->GetParentRegionKey() != ADULT_SPAWN) {
         continue;
       }
@@ -560,7 +558,7 @@ static bool ShuffleEntrances(std::vector<Entrance*>& entrances, std::vector<Entr
       if (ReplaceEntrance(entrance, target, rollbacks)) {
         // If shuffle cows is enabled and the last entrance was one to Impas House,
         // then immediately attempt to place the other entrance to Impas House
-        if (Settings::ShuffleCows && attemptedImpasHousePlacement) {
+        if (settings->ShuffleCows && attemptedImpasHousePlacement) {
           if (!PlaceOtherImpasHouseEntrance(entrances, targetEntrances, rollbacks)) {
             return false;
           }
@@ -608,14 +606,14 @@ static bool ShuffleOneWayPriorityEntrances(std::map<std::string, PriorityEntranc
 
   if (retryCount <= 0) {
     SPDLOG_DEBUG("Entrance placement attempt count for one way priorities exceeded. Restarting randomization completely\n");
-    entranceShuffleFailure = true;
+    world->entranceShuffleFailure = true;
     return false;
   }
   return true;
 }
 
 static void ShuffleEntrancePool(std::vector<Entrance*>& entrancePool, std::vector<Entrance*>& targetEntrances, int retryCount = 20) {
-  noRandomEntrances = false;
+  world->noRandomEntrances = false;
 
   auto splitEntrances = SplitEntrancesByRequirements(entrancePool, targetEntrances);
 
@@ -644,14 +642,14 @@ static void ShuffleEntrancePool(std::vector<Entrance*>& entrancePool, std::vecto
       if(!success) {
         for (auto& pair : rollbacks) {
           RestoreConnections(pair.first, pair.second);
-          curNumRandomizedEntrances--;
+          world->curNumRandomizedEntrances--;
         }
         continue;
       }
     } else {
       for (auto& pair : rollbacks) {
         RestoreConnections(pair.first, pair.second);
-        curNumRandomizedEntrances--;
+        world->curNumRandomizedEntrances--;
       }
       continue;
     }
@@ -665,7 +663,7 @@ static void ShuffleEntrancePool(std::vector<Entrance*>& entrancePool, std::vecto
 
   if (retries <= 0) {
     SPDLOG_DEBUG("Entrance placement attempt count exceeded. Restarting randomization completely");
-    entranceShuffleFailure = true;
+    world->entranceShuffleFailure = true;
   }
 }
 
@@ -682,9 +680,10 @@ static void SetShuffledEntrances(EntrancePools entrancePools) {
 
 //Process for setting up the shuffling of all entrances to be shuffled
 int ShuffleAllEntrances() {
+  FillProfiler::Phase phase("ShuffleAllEntrances");
 
-  totalRandomizableEntrances = 0;
-  curNumRandomizedEntrances = 0;
+  world->totalRandomizableEntrances = 0;
+  world->curNumRandomizedEntrances = 0;
 
   std::vector<EntranceInfoPair> entranceShuffleTable = {
                                    //Parent Region                     Connected Region                      index
@@ -979,7 +978,7 @@ int ShuffleAllEntrances() {
     {"Requiem",  {{DESERT_COLOSSUS, DESERT_COLOSSUS_FROM_SPIRIT_ENTRYWAY}, {EntranceType::OwlDrop, EntranceType::Spawn, EntranceType::WarpSong}}},
   };
 
-  entranceShuffleFailure = false;
+  world->entranceShuffleFailure = false;
   SetAllEntrancesData(entranceShuffleTable);
 
   EntrancePools oneWayEntrancePools = {};
@@ -987,40 +986,40 @@ int ShuffleAllEntrances() {
   std::map<std::string, PriorityEntrance> oneWayPriorities = {};
 
   // Owl Drops
-  if (Settings::ShuffleOwlDrops) {
+  if (settings->ShuffleOwlDrops) {
     oneWayEntrancePools[EntranceType::OwlDrop] = GetShuffleableEntrances(EntranceType::OwlDrop);
   }
 
   // Spawns
-  if (Settings::ShuffleOverworldSpawns) {
+  if (settings->ShuffleOverworldSpawns) {
     oneWayEntrancePools[EntranceType::Spawn] = GetShuffleableEntrances(EntranceType::Spawn);
   }
 
   // Warpsongs
-  if (Settings::ShuffleWarpSongs) {
+  if (settings->ShuffleWarpSongs) {
     oneWayEntrancePools[EntranceType::WarpSong] = GetShuffleableEntrances(EntranceType::WarpSong);
     // In Glitchless, there aren't any other ways to access these areas
-    if (Settings::Logic.Is(LOGIC_GLITCHLESS)) {
+    if (settings->Logic.Is(LOGIC_GLITCHLESS)) {
       oneWayPriorities["Bolero"] = priorityEntranceTable["Bolero"];
       oneWayPriorities["Nocturne"] = priorityEntranceTable["Nocturne"];
-      if (!Settings::ShuffleDungeonEntrances && !Settings::ShuffleOverworldEntrances) {
+      if (!settings->ShuffleDungeonEntrances && !settings->ShuffleOverworldEntrances) {
         oneWayPriorities["Requiem"] = priorityEntranceTable["Requiem"];
       }
     }
   }
 
   // Shuffle Bosses
-  if (Settings::ShuffleBossEntrances.IsNot(SHUFFLEBOSSES_OFF)) {
-    if (Settings::ShuffleBossEntrances.Is(SHUFFLEBOSSES_FULL)) {
+  if (settings->ShuffleBossEntrances.IsNot(SHUFFLEBOSSES_OFF)) {
+    if (settings->ShuffleBossEntrances.Is(SHUFFLEBOSSES_FULL)) {
       entrancePools[EntranceType::Boss] = GetShuffleableEntrances(EntranceType::ChildBoss);
       AddElementsToPool(entrancePools[EntranceType::Boss], GetShuffleableEntrances(EntranceType::AdultBoss));
       // If forest is closed, ensure Ghoma is inside the Deku tree
       // Deku tree being in its vanilla location is handled below
-      if (Settings::OpenForest.Is(OPENFOREST_CLOSED) && !(Settings::ShuffleOverworldEntrances || Settings::ShuffleInteriorEntrances)) {
+      if (settings->OpenForest.Is(OPENFOREST_CLOSED) && !(settings->ShuffleOverworldEntrances || settings->ShuffleInteriorEntrances)) {
         FilterAndEraseFromPool(entrancePools[EntranceType::Boss], [](const Entrance* entrance){return entrance->GetParentRegionKey()    == DEKU_TREE_BOSS_ENTRYWAY &&
                                                                                                       entrance->GetConnectedRegionKey() == DEKU_TREE_BOSS_ROOM;});
       }
-      if (Settings::DecoupleEntrances) {
+      if (settings->DecoupleEntrances) {
         for (Entrance* entrance : entrancePools[EntranceType::Boss]) {
           entrancePools[EntranceType::BossReverse].push_back(entrance->GetReverse());
         }
@@ -1029,11 +1028,11 @@ int ShuffleAllEntrances() {
       entrancePools[EntranceType::ChildBoss] = GetShuffleableEntrances(EntranceType::ChildBoss);
       entrancePools[EntranceType::AdultBoss] = GetShuffleableEntrances(EntranceType::AdultBoss);
       // If forest is closed, ensure Ghoma is inside the Deku tree
-      if (Settings::OpenForest.Is(OPENFOREST_CLOSED) && !(Settings::ShuffleOverworldEntrances || Settings::ShuffleInteriorEntrances)) {
+      if (settings->OpenForest.Is(OPENFOREST_CLOSED) && !(settings->ShuffleOverworldEntrances || settings->ShuffleInteriorEntrances)) {
         FilterAndEraseFromPool(entrancePools[EntranceType::ChildBoss], [](const Entrance* entrance){return entrance->GetParentRegionKey()    == DEKU_TREE_BOSS_ENTRYWAY &&
                                                                                                            entrance->GetConnectedRegionKey() == DEKU_TREE_BOSS_ROOM;});
       }
-      if (Settings::DecoupleEntrances) {
+      if (settings->DecoupleEntrances) {
         for (Entrance* entrance : entrancePools[EntranceType::ChildBoss]) {
           entrancePools[EntranceType::ChildBossReverse].push_back(entrance->GetReverse());
         }
@@ -1045,18 +1044,18 @@ int ShuffleAllEntrances() {
   }
 
   //Shuffle Dungeon Entrances
-  if (Settings::ShuffleDungeonEntrances.IsNot(SHUFFLEDUNGEONS_OFF)) {
+  if (settings->ShuffleDungeonEntrances.IsNot(SHUFFLEDUNGEONS_OFF)) {
     entrancePools[EntranceType::Dungeon] = GetShuffleableEntrances(EntranceType::Dungeon);
 	//Add Ganon's Castle, if set to On + Ganon
-    if (Settings::ShuffleDungeonEntrances.Is(SHUFFLEDUNGEONS_GANON)) {
+    if (settings->ShuffleDungeonEntrances.Is(SHUFFLEDUNGEONS_GANON)) {
       AddElementsToPool(entrancePools[EntranceType::Dungeon], GetShuffleableEntrances(EntranceType::GanonDungeon));
     }
     //If forest is closed don't allow a forest escape via spirit temple hands
-    if (Settings::OpenForest.Is(OPENFOREST_CLOSED) && !(Settings::ShuffleOverworldEntrances || Settings::ShuffleInteriorEntrances)) {
+    if (settings->OpenForest.Is(OPENFOREST_CLOSED) && !(settings->ShuffleOverworldEntrances || settings->ShuffleInteriorEntrances)) {
       FilterAndEraseFromPool(entrancePools[EntranceType::Dungeon], [](const Entrance* entrance){return entrance->GetParentRegionKey()    == KF_OUTSIDE_DEKU_TREE &&
                                                                                                        entrance->GetConnectedRegionKey() == DEKU_TREE_ENTRYWAY;});
     }
-    if (Settings::DecoupleEntrances) {
+    if (settings->DecoupleEntrances) {
       for (Entrance* entrance : entrancePools[EntranceType::Dungeon]) {
         entrancePools[EntranceType::DungeonReverse].push_back(entrance->GetReverse());
       }
@@ -1064,13 +1063,13 @@ int ShuffleAllEntrances() {
   }
 
   // Interior entrances
-  if (Settings::ShuffleInteriorEntrances.IsNot(SHUFFLEINTERIORS_OFF)) {
+  if (settings->ShuffleInteriorEntrances.IsNot(SHUFFLEINTERIORS_OFF)) {
     entrancePools[EntranceType::Interior] = GetShuffleableEntrances(EntranceType::Interior);
     // Special interiors
-    if (Settings::ShuffleInteriorEntrances.Is(SHUFFLEINTERIORS_ALL)) {
+    if (settings->ShuffleInteriorEntrances.Is(SHUFFLEINTERIORS_ALL)) {
       AddElementsToPool(entrancePools[EntranceType::Interior], GetShuffleableEntrances(EntranceType::SpecialInterior));
     }
-    if (Settings::DecoupleEntrances) {
+    if (settings->DecoupleEntrances) {
       for (Entrance* entrance : entrancePools[EntranceType::Interior]) {
         entrancePools[EntranceType::InteriorReverse].push_back(entrance->GetReverse());
       }
@@ -1078,10 +1077,10 @@ int ShuffleAllEntrances() {
   }
 
   //grotto entrances
-  if (Settings::ShuffleGrottoEntrances) {
+  if (settings->ShuffleGrottoEntrances) {
     entrancePools[EntranceType::GrottoGrave] = GetShuffleableEntrances(EntranceType::GrottoGrave);
 
-    if (Settings::DecoupleEntrances) {
+    if (settings->DecoupleEntrances) {
       for (Entrance* entrance : entrancePools[EntranceType::GrottoGrave]) {
         entrancePools[EntranceType::GrottoGraveReverse].push_back(entrance->GetReverse());
       }
@@ -1089,11 +1088,11 @@ int ShuffleAllEntrances() {
   }
 
   //overworld entrances
-  if (Settings::ShuffleOverworldEntrances) {
-    bool excludeOverworldReverse = Settings::MixOverworld && !Settings::DecoupleEntrances;
+  if (settings->ShuffleOverworldEntrances) {
+    bool excludeOverworldReverse = settings->MixOverworld && !settings->DecoupleEntrances;
     entrancePools[EntranceType::Overworld] = GetShuffleableEntrances(EntranceType::Overworld, excludeOverworldReverse);
     // Only shuffle GV Lower Stream -> Lake Hylia if decoupled entrances are on
-    if (!Settings::DecoupleEntrances) {
+    if (!settings->DecoupleEntrances) {
       FilterAndEraseFromPool(entrancePools[EntranceType::Overworld], [](const Entrance* entrance){return entrance->GetParentRegionKey()    == GV_LOWER_STREAM &&
                                                                                                          entrance->GetConnectedRegionKey() == LAKE_HYLIA;});
     }
@@ -1104,44 +1103,44 @@ int ShuffleAllEntrances() {
   SetShuffledEntrances(oneWayEntrancePools);
 
   //combine entrance pools if mixing pools. Only continue if more than one pool is selected.
-  int totalMixedPools = (Settings::MixDungeons ? 1 : 0) + (Settings::MixBosses ? 1 : 0) +
-                        (Settings::MixOverworld ? 1 : 0) + (Settings::MixInteriors ? 1 : 0) +
-                        (Settings::MixGrottos ? 1 : 0);
+  int totalMixedPools = (settings->MixDungeons ? 1 : 0) + (settings->MixBosses ? 1 : 0) +
+                        (settings->MixOverworld ? 1 : 0) + (settings->MixInteriors ? 1 : 0) +
+                        (settings->MixGrottos ? 1 : 0);
   if (totalMixedPools < 2) {
-    Settings::MixedEntrancePools.SetSelectedIndex(OFF);
-    Settings::MixDungeons.SetSelectedIndex(OFF);
-    Settings::MixBosses.SetSelectedIndex(OFF);
-    Settings::MixOverworld.SetSelectedIndex(OFF);
-    Settings::MixInteriors.SetSelectedIndex(OFF);
-    Settings::MixGrottos.SetSelectedIndex(OFF);
+    settings->MixedEntrancePools.SetSelectedIndex(OFF);
+    settings->MixDungeons.SetSelectedIndex(OFF);
+    settings->MixBosses.SetSelectedIndex(OFF);
+    settings->MixOverworld.SetSelectedIndex(OFF);
+    settings->MixInteriors.SetSelectedIndex(OFF);
+    settings->MixGrottos.SetSelectedIndex(OFF);
   }
-  if (Settings::MixedEntrancePools) {
+  if (settings->MixedEntrancePools) {
     std::set<EntranceType> poolsToMix = {};
-    if (Settings::MixDungeons) {
+    if (settings->MixDungeons) {
       poolsToMix.insert(EntranceType::Dungeon);
       // Insert reverse entrances when decoupled entrances is on
-      if (Settings::DecoupleEntrances) {
+      if (settings->DecoupleEntrances) {
         poolsToMix.insert(EntranceType::DungeonReverse);
       }
     }
-    if (Settings::MixBosses) {
+    if (settings->MixBosses) {
       poolsToMix.insert(EntranceType::Boss);
-      if (Settings::DecoupleEntrances) {
+      if (settings->DecoupleEntrances) {
         poolsToMix.insert(EntranceType::BossReverse);
       }
     }
-    if (Settings::MixOverworld) {
+    if (settings->MixOverworld) {
       poolsToMix.insert(EntranceType::Overworld);
     }
-    if (Settings::MixInteriors) {
+    if (settings->MixInteriors) {
       poolsToMix.insert(EntranceType::Interior);
-      if (Settings::DecoupleEntrances) {
+      if (settings->DecoupleEntrances) {
         poolsToMix.insert(EntranceType::InteriorReverse);
       }
     }
-    if (Settings::MixGrottos) {
+    if (settings->MixGrottos) {
       poolsToMix.insert(EntranceType::GrottoGrave);
-      if (Settings::DecoupleEntrances) {
+      if (settings->DecoupleEntrances) {
         poolsToMix.insert(EntranceType::GrottoGraveReverse);
       }
     }
@@ -1169,7 +1168,7 @@ int ShuffleAllEntrances() {
       oneWayTargetEntrancePools[poolType] = BuildOneWayTargets(validTargetTypes, {std::make_pair(PRELUDE_OF_LIGHT_WARP, TEMPLE_OF_TIME)});
       // Owl Drops are only accessible as child, so targets should reflect that
       for (Entrance* target : oneWayTargetEntrancePools[poolType]) {
-        target->SetCondition([]{return Logic::IsChild;});
+        target->SetCondition([]{return logic->IsChild;});
       }
 
     } else if (poolType == EntranceType::Spawn) {
@@ -1187,7 +1186,7 @@ int ShuffleAllEntrances() {
   // Disconnect all one way entrances at this point (they need to be connected during all of the above process)
   for (auto& pool : oneWayEntrancePools) {
     for (Entrance* entrance : pool.second) {
-      totalRandomizableEntrances++;
+      world->totalRandomizableEntrances++;
       entrance->Disconnect();
     }
   }
@@ -1206,7 +1205,7 @@ int ShuffleAllEntrances() {
 
   // Place priority entrances
   ShuffleOneWayPriorityEntrances(oneWayPriorities, oneWayEntrancePools, oneWayTargetEntrancePools);
-  if (entranceShuffleFailure) {
+  if (world->entranceShuffleFailure) {
     return ENTRANCE_SHUFFLE_FAILURE;
   }
 
@@ -1232,7 +1231,7 @@ int ShuffleAllEntrances() {
   // Shuffle all one way entrances among pools to shuffle
   for (auto& pool : oneWayEntrancePools) {
     ShuffleEntrancePool(pool.second, oneWayTargetEntrancePools[pool.first], 5);
-    if (entranceShuffleFailure) {
+    if (world->entranceShuffleFailure) {
       return ENTRANCE_SHUFFLE_FAILURE;
     }
     // Delete all targets that we just placed from other one way target pools so
@@ -1258,7 +1257,7 @@ int ShuffleAllEntrances() {
   //shuffle all entrances among pools to shuffle
   for (auto& pool : entrancePools) {
     ShuffleEntrancePool(pool.second, targetEntrancePools[pool.first]);
-    if (entranceShuffleFailure) {
+    if (world->entranceShuffleFailure) {
       return ENTRANCE_SHUFFLE_FAILURE;
     }
   }
@@ -1328,7 +1327,7 @@ int ShuffleAllEntrances() {
     for (EntrancePair pair : bossRoomExitPairs) {
       Entrance* target = pair.second->GetReplacement() != nullptr ? pair.second->GetReplacement() : pair.second;
 
-      if (!Settings::DecoupleEntrances) {
+      if (!settings->DecoupleEntrances) {
         while (bossExits.find(target->GetName()) != bossExits.end()) {
           Entrance* next = bossExits.at(target->GetName());
           target = next->GetReplacement() != nullptr ? next->GetReplacement() : next;
@@ -1354,8 +1353,8 @@ int ShuffleAllEntrances() {
 
 // Save the set of shuffled entrances that will be sent to the patch
 void CreateEntranceOverrides() {
-  entranceOverrides.clear();
-  if (noRandomEntrances) {
+  world->entranceOverrides.clear();
+  if (world->noRandomEntrances) {
     return;
   }
   SPDLOG_DEBUG("\nCREATING ENTRANCE OVERRIDES\n");
@@ -1380,12 +1379,12 @@ void CreateEntranceOverrides() {
 
     // Only set destination indices for two way entrances and when decouple entrances
     // is off
-    if (entrance->GetReverse() != nullptr && !Settings::DecoupleEntrances) {
+    if (entrance->GetReverse() != nullptr && !settings->DecoupleEntrances) {
       replacementDestinationIndex = entrance->GetReplacement()->GetReverse()->GetIndex();
       destinationIndex = entrance->GetReverse()->GetIndex();
     }
 
-    entranceOverrides.push_back({
+    world->entranceOverrides.push_back({
       .type = type,
       .index = originalIndex,
       .destination = destinationIndex,
@@ -1399,5 +1398,3 @@ void CreateEntranceOverrides() {
     SPDLOG_DEBUG(message);
   }
 }
-
-std::vector<std::list<Entrance*>> playthroughEntrances;
@@ -11,8 +11,6 @@
 #define ENTRANCE_SHUFFLE_SUCCESS 0
 #define ENTRANCE_SHUFFLE_FAILURE 1
 
-extern std::list<EntranceOverride> entranceOverrides;
-
 enum class EntranceType {
     None,
     OwlDrop,
@@ -57,11 +55,12 @@ public:
     }
 
     bool GetConditionsMet() const {
-        if (Settings::Logic.Is(LOGIC_NONE) || Settings::Logic.Is(LOGIC_VANILLA)) {
+        FillProfiler::CountCondition();
+        if (settings->Logic.Is(LOGIC_NONE) || settings->Logic.Is(LOGIC_VANILLA)) {
             return true;
-        } else if (Settings::Logic.Is(LOGIC_GLITCHLESS)) {
+        } else if (settings->Logic.Is(LOGIC_GLITCHLESS)) {
             return conditions_met[0]();
-        } else if (Settings::Logic.Is(LOGIC_GLITCHED)) {
+        } else if (settings->Logic.Is(LOGIC_GLITCHED)) {
             if (conditions_met[0]()) {
                 return true;
             } else if (conditions_met[1] != NULL) {
@@ -91,10 +90,10 @@ public:
     void printAgeTimeAccess() {
       //CitraPrint("Name: ");
       //CitraPrint(name);
-      auto message = "Child Day:   " + std::to_string(CheckConditionAtAgeTime(Logic::IsChild, Logic::AtDay))   + "\t"
-                     "Child Night: " + std::to_string(CheckConditionAtAgeTime(Logic::IsChild, Logic::AtNight)) + "\t"
-                     "Adult Day:   " + std::to_string(CheckConditionAtAgeTime(Logic::IsAdult, Logic::AtDay))   + "\t"
-                     "Adult Night: " + std::to_string(CheckConditionAtAgeTime(Logic::IsAdult, Logic::AtNight));
+      auto message = "Child Day:   " + std::to_string(CheckConditionAtAgeTime(logic->IsChild, logic->AtDay))   + "\t"
+                     "Child Night: " + std::to_string(CheckConditionAtAgeTime(logic->IsChild, logic->AtNight)) + "\t"
+                     "Adult Day:   " + std::to_string(CheckConditionAtAgeTime(logic->IsAdult, logic->AtDay))   + "\t"
+                     "Adult Night: " + std::to_string(CheckConditionAtAgeTime(logic->IsAdult, logic->AtNight));
       //CitraPrint(message);
     }
 
@@ -108,10 +107,10 @@ public:
         }
 
         //check all possible day/night condition combinations
-        conditionsMet = (parent->childDay   && CheckConditionAtAgeTime(Logic::IsChild, Logic::AtDay, allAgeTimes))   +
-                        (parent->childNight && CheckConditionAtAgeTime(Logic::IsChild, Logic::AtNight, allAgeTimes)) +
-                        (parent->adultDay   && CheckConditionAtAgeTime(Logic::IsAdult, Logic::AtDay, allAgeTimes))   +
-                        (parent->adultNight && CheckConditionAtAgeTime(Logic::IsAdult, Logic::AtNight, allAgeTimes));
+        conditionsMet = (parent->Access().childDay   && CheckConditionAtAgeTime(logic->IsChild, logic->AtDay, allAgeTimes))   +
+                        (parent->Access().childNight && CheckConditionAtAgeTime(logic->IsChild, logic->AtNight, allAgeTimes)) +
+                        (parent->Access().adultDay   && CheckConditionAtAgeTime(logic->IsAdult, logic->AtDay, allAgeTimes))   +
+                        (parent->Access().adultNight && CheckConditionAtAgeTime(logic->IsAdult, logic->AtNight, allAgeTimes));
 
         return conditionsMet && (!allAgeTimes || conditionsMet == 4);
     }
@@ -123,15 +122,15 @@ public:
     //set the logic to be a specific age and time of day and see if the condition still holds
     bool CheckConditionAtAgeTime(bool& age, bool& time, bool passAnyway = false) const {
 
-        Logic::IsChild = false;
-        Logic::IsAdult = false;
-        Logic::AtDay   = false;
-        Logic::AtNight = false;
+        logic->IsChild = false;
+        logic->IsAdult = false;
+        logic->AtDay   = false;
+        logic->AtNight = false;
 
         time = true;
         age = true;
 
-        Logic::UpdateHelpers();
+        logic->UpdateAgeHelpers();
         return GetConditionsMet() && (connectedRegion != NONE || passAnyway);
     }
 
@@ -287,6 +286,3 @@ private:
 int  ShuffleAllEntrances();
 void CreateEntranceOverrides();
 std::string EntranceNameByRegions(uint32_t parentRegion, uint32_t connectedRegion);
-
-extern std::vector<std::list<Entrance*>> playthroughEntrances;
-extern bool noRandomEntrances;
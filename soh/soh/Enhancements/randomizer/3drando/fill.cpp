@@ -2,6 +2,7 @@
 
 #include "custom_messages.hpp"
 #include "dungeon.hpp"
+#include "fill_profiler.hpp"
 #include "item_location.hpp"
 #include "item_pool.hpp"
 #include "location_access.hpp"
@@ -13,31 +14,39 @@
 #include "hint_list.hpp"
 #include "entrance.hpp"
 #include "shops.hpp"
-
+#include "item_list.hpp"
+#include "world.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <vector>
 #include <list>
+#include <BS_thread_pool.hpp>
 #include <spdlog/spdlog.h>
 
 using namespace CustomMessages;
 using namespace Logic;
 using namespace Settings;
 
-static bool placementFailure = false;
-
 static void RemoveStartingItemsFromPool() {
-  for (uint32_t startingItem : StartingInventory) {
-    for (size_t i = 0; i < ItemPool.size(); i++) {
+  for (uint32_t startingItem : world->StartingInventory) {
+    for (size_t i = 0; i < world->ItemPool.size(); i++) {
       if (startingItem == BIGGORON_SWORD) {
-        if (ItemPool[i] == GIANTS_KNIFE || ItemPool[i] == BIGGORON_SWORD) {
-          ItemPool[i] = GetJunkItem();
+        if (world->ItemPool[i] == GIANTS_KNIFE || world->ItemPool[i] == BIGGORON_SWORD) {
+          world->ItemPool[i] = GetJunkItem();
         }
         continue;
-      } else if (startingItem == ItemPool[i] || (ItemTable(startingItem).IsBottleItem() && ItemTable(ItemPool[i]).IsBottleItem())) {
-        if (AdditionalHeartContainers > 0 && (startingItem == PIECE_OF_HEART || startingItem == TREASURE_GAME_HEART)) {
-          ItemPool[i] = HEART_CONTAINER;
-          AdditionalHeartContainers--;
+      } else if (startingItem == world->ItemPool[i] || (ItemTable(startingItem).IsBottleItem() && ItemTable(world->ItemPool[i]).IsBottleItem())) {
+        if (world->AdditionalHeartContainers > 0 && (startingItem == PIECE_OF_HEART || startingItem == TREASURE_GAME_HEART)) {
+          world->ItemPool[i] = HEART_CONTAINER;
+          world->AdditionalHeartContainers--;
         } else {
-          ItemPool[i] = GetJunkItem();
+          world->ItemPool[i] = GetJunkItem();
         }
         break;
       }
@@ -45,41 +54,51 @@ static void RemoveStartingItemsFromPool() {
   }
 }
 
+//special check for temple of time
+static void PropogateTimeTravel(SearchMode mode) {
+  bool propogateTimeTravel = mode != SearchMode::TimePassAccess && mode != SearchMode::TempleOfTimeAccess;
+  Logic::AreaAccess& root = AreaTable(ROOT)->Access();
+  const Logic::AreaAccess& beyondDoor = AreaTable(TOT_BEYOND_DOOR_OF_TIME)->Access();
+  if (!AreaTable(ROOT)->Adult() && AreaTable(TOT_BEYOND_DOOR_OF_TIME)->Child() && propogateTimeTravel) {
+    root.adultDay   = beyondDoor.childDay;
+    root.adultNight = beyondDoor.childNight;
+  } else if (!AreaTable(ROOT)->Child() && AreaTable(TOT_BEYOND_DOOR_OF_TIME)->Adult() && propogateTimeTravel){
+    root.childDay   = beyondDoor.adultDay;
+    root.childNight = beyondDoor.adultNight;
+  }
+}
+
 //This function will propogate Time of Day access through the entrance
 static bool UpdateToDAccess(Entrance* entrance, SearchMode mode) {
 
   bool ageTimePropogated = false;
 
   //propogate childDay, childNight, adultDay, and adultNight separately
-  Area* parent = entrance->GetParentRegion();
-  Area* connection = entrance->GetConnectedRegion();
+  const Logic::AreaAccess& parent = entrance->GetParentRegion()->Access();
+  Logic::AreaAccess& connection = entrance->GetConnectedRegion()->Access();
 
-  if (!connection->childDay && parent->childDay && entrance->CheckConditionAtAgeTime(Logic::IsChild, AtDay)) {
-    connection->childDay = true;
+  if (!connection.childDay && parent.childDay &&
+      entrance->CheckConditionAtAgeTime(logic->IsChild, logic->AtDay)) {
+    connection.childDay = true;
     ageTimePropogated = true;
   }
-  if (!connection->childNight && parent->childNight && entrance->CheckConditionAtAgeTime(Logic::IsChild, AtNight)) {
-    connection->childNight = true;
+  if (!connection.childNight && parent.childNight &&
+      entrance->CheckConditionAtAgeTime(logic->IsChild, logic->AtNight)) {
+    connection.childNight = true;
     ageTimePropogated = true;
   }
-  if (!connection->adultDay && parent->adultDay && entrance->CheckConditionAtAgeTime(IsAdult, AtDay)) {
-    connection->adultDay = true;
+  if (!connection.adultDay && parent.adultDay &&
+      entrance->CheckConditionAtAgeTime(logic->IsAdult, logic->AtDay)) {
+    connection.adultDay = true;
     ageTimePropogated = true;
   }
-  if (!connection->adultNight && parent->adultNight && entrance->CheckConditionAtAgeTime(IsAdult, AtNight)) {
-    connection->adultNight = true;
+  if (!connection.adultNight && parent.adultNight &&
+      entrance->CheckConditionAtAgeTime(logic->IsAdult, logic->AtNight)) {
+    connection.adultNight = true;
     ageTimePropogated = true;
   }
 
-  //special check for temple of time
-  bool propogateTimeTravel = mode != SearchMode::TimePassAccess && mode != SearchMode::TempleOfTimeAccess;
-  if (!AreaTable(ROOT)->Adult() && AreaTable(TOT_BEYOND_DOOR_OF_TIME)->Child() && propogateTimeTravel) {
-    AreaTable(ROOT)->adultDay   = AreaTable(TOT_BEYOND_DOOR_OF_TIME)->childDay;
-    AreaTable(ROOT)->adultNight = AreaTable(TOT_BEYOND_DOOR_OF_TIME)->childNight;
-  } else if (!AreaTable(ROOT)->Child() && AreaTable(TOT_BEYOND_DOOR_OF_TIME)->Adult() && propogateTimeTravel){
-    AreaTable(ROOT)->childDay   = AreaTable(TOT_BEYOND_DOOR_OF_TIME)->adultDay;
-    AreaTable(ROOT)->childNight = AreaTable(TOT_BEYOND_DOOR_OF_TIME)->adultNight;
-  }
+  PropogateTimeTravel(mode);
 
   return ageTimePropogated;
 }
@@ -87,13 +106,13 @@ static bool UpdateToDAccess(Entrance* entrance, SearchMode mode) {
 // Various checks that need to pass for the world to be validated as completable
 static void ValidateWorldChecks(SearchMode& mode, bool checkPoeCollectorAccess, bool checkOtherEntranceAccess, std::vector<uint32_t>& areaPool) {
   // Condition for validating Temple of Time Access
-  if (mode == SearchMode::TempleOfTimeAccess && ((Settings::ResolvedStartingAge == AGE_CHILD && AreaTable(TEMPLE_OF_TIME)->Adult()) || (Settings::ResolvedStartingAge == AGE_ADULT && AreaTable(TEMPLE_OF_TIME)->Child()) || !checkOtherEntranceAccess)) {
+  if (mode == SearchMode::TempleOfTimeAccess && ((settings->ResolvedStartingAge == AGE_CHILD && AreaTable(TEMPLE_OF_TIME)->Adult()) || (settings->ResolvedStartingAge == AGE_ADULT && AreaTable(TEMPLE_OF_TIME)->Child()) || !checkOtherEntranceAccess)) {
     mode = SearchMode::ValidStartingRegion;
   }
   // Condition for validating a valid starting region
   if (mode == SearchMode::ValidStartingRegion) {
-    bool childAccess = Settings::ResolvedStartingAge == AGE_CHILD || AreaTable(TOT_BEYOND_DOOR_OF_TIME)->Child();
-    bool adultAccess = Settings::ResolvedStartingAge == AGE_ADULT || AreaTable(TOT_BEYOND_DOOR_OF_TIME)->Adult();
+    bool childAccess = settings->ResolvedStartingAge == AGE_CHILD || AreaTable(TOT_BEYOND_DOOR_OF_TIME)->Child();
+    bool adultAccess = settings->ResolvedStartingAge == AGE_ADULT || AreaTable(TOT_BEYOND_DOOR_OF_TIME)->Adult();
 
     Area* kokiri = AreaTable(KOKIRI_FOREST);
     Area* kakariko = AreaTable(KAKARIKO_VILLAGE);
@@ -103,32 +122,34 @@ static void ValidateWorldChecks(SearchMode& mode, bool checkPoeCollectorAccess,
         !checkOtherEntranceAccess) {
        mode = SearchMode::PoeCollectorAccess;
        ApplyStartingInventory();
-       Logic::NoBottles = true;
+       logic->NoBottles = true;
+       logic->UpdateHelpers();
     }
   }
   // Condition for validating Poe Collector Access
   if (mode == SearchMode::PoeCollectorAccess && (AreaTable(MARKET_GUARD_HOUSE)->Adult() || !checkPoeCollectorAccess)) {
     // Apply all items that are necessary for checking all location access
       std::vector<uint32_t> itemsToPlace =
-          FilterFromPool(ItemPool, [](const auto i) { return ItemTable(i).IsAdvancement(); });
+          FilterFromPool(world->ItemPool, [](const auto i) { return ItemTable(i).IsAdvancement(); });
     for (uint32_t unplacedItem : itemsToPlace) {
       ItemTable(unplacedItem).ApplyEffect();
     }
     // Reset access as the non-starting age
-    if (Settings::ResolvedStartingAge == AGE_CHILD) {
+    if (settings->ResolvedStartingAge == AGE_CHILD) {
       for (uint32_t areaKey : areaPool) {
-        AreaTable(areaKey)->adultDay = false;
-        AreaTable(areaKey)->adultNight = false;
+        AreaTable(areaKey)->Access().adultDay = false;
+        AreaTable(areaKey)->Access().adultNight = false;
       }
     } else {
       for (uint32_t areaKey : areaPool) {
-        AreaTable(areaKey)->childDay = false;
-        AreaTable(areaKey)->childNight = false;
+        AreaTable(areaKey)->Access().childDay = false;
+        AreaTable(areaKey)->Access().childNight = false;
       }
     }
     mode = SearchMode::AllLocationsReachable;
-  } else {
-    Logic::NoBottles = false;
+  } else if (logic->NoBottles) {
+    logic->NoBottles = false;
+    logic->UpdateHelpers();
   }
 }
 
@@ -137,11 +158,11 @@ static int GetMaxGSCount() {
   //If bridge or LACS is set to tokens, get how many are required
   int maxBridge = 0;
   int maxLACS = 0;
-  if (Settings::Bridge.Is(RAINBOWBRIDGE_TOKENS)) {
-    maxBridge = Settings::BridgeTokenCount.Value<uint8_t>();
+  if (settings->Bridge.Is(RAINBOWBRIDGE_TOKENS)) {
+    maxBridge = settings->BridgeTokenCount.Value<uint8_t>();
   }
-  if (Settings::GanonsBossKey.Is(GANONSBOSSKEY_LACS_TOKENS)) {
-    maxLACS = Settings::LACSTokenCount.Value<uint8_t>();
+  if (settings->GanonsBossKey.Is(GANONSBOSSKEY_LACS_TOKENS)) {
+    maxLACS = settings->LACSTokenCount.Value<uint8_t>();
   }
   maxBridge = std::max(maxBridge, maxLACS);
   //Get the max amount of GS which could be useful from token reward locations
@@ -166,7 +187,7 @@ static int GetMaxGSCount() {
     maxUseful = 10;
   }
   //Return max of the two possible reasons tokens could be important, minus the tokens in the starting inventory
-  return std::max(maxUseful, maxBridge) - StartingSkulltulaToken.Value<uint8_t>();
+  return std::max(maxUseful, maxBridge) - settings->StartingSkulltulaToken.Value<uint8_t>();
 }
 
 std::string GetShopItemBaseName(std::string itemName) {
@@ -186,15 +207,18 @@ std::vector<uint32_t> GetEmptyLocations(std::vector<uint32_t> allowedLocations)
   return FilterFromPool(allowedLocations, [](const auto loc){ return Location(loc)->GetPlaceduint32_t() == NONE;});
 }
 
-std::vector<uint32_t> GetAllEmptyLocations() {
-    return FilterFromPool(allLocations, [](const auto loc) { return Location(loc)->GetPlaceduint32_t() == NONE; });
+std::vector<uint32_t> GetAllEmptyLocations(World& world) {
+    return FilterFromPool(world.allLocations, [](const auto loc) { return Location(loc)->GetPlaceduint32_t() == NONE; });
 }
 
 //This function will return a vector of ItemLocations that are accessible with
-//where items have been placed so far within the world. The allowedLocations argument
+//where items have been placed so far within the given world. The allowedLocations argument
 //specifies the pool of locations that we're trying to search for an accessible location in
-std::vector<uint32_t> GetAccessibleLocations(const std::vector<uint32_t>& allowedLocations, SearchMode mode /* = SearchMode::ReachabilitySearch*/, std::string ignore /*= ""*/, bool checkPoeCollectorAccess /*= false*/, bool checkOtherEntranceAccess /*= false*/) {
+//The world is installed on this thread for the search, so the helpers it calls see the same one
+std::vector<uint32_t> GetAccessibleLocations(World& world, const std::vector<uint32_t>& allowedLocations, SearchMode mode /* = SearchMode::ReachabilitySearch*/, std::string ignore /*= ""*/, bool checkPoeCollectorAccess /*= false*/, bool checkOtherEntranceAccess /*= false*/) {
+  WorldScope scope(world);
   std::vector<uint32_t> accessibleLocations;
+  FillProfiler::counters.searches++;
   // Reset all access to begin a new search
   if (mode < SearchMode::ValidateWorld) {
     ApplyStartingInventory();
@@ -205,11 +229,11 @@ std::vector<uint32_t> GetAccessibleLocations(const std::vector<uint32_t>& allowe
 
   if (mode == SearchMode::ValidateWorld) {
     mode = SearchMode::TimePassAccess;
-    AreaTable(ROOT)->childNight = true;
-    AreaTable(ROOT)->adultNight = true;
-    AreaTable(ROOT)->childDay = true;
-    AreaTable(ROOT)->adultDay = true;
-    allLocationsReachable = false;
+    AreaTable(ROOT)->Access().childNight = true;
+    AreaTable(ROOT)->Access().adultNight = true;
+    AreaTable(ROOT)->Access().childDay = true;
+    AreaTable(ROOT)->Access().adultDay = true;
+    world.allLocationsReachable = false;
   }
 
   //Variables for playthrough
@@ -246,6 +270,7 @@ std::vector<uint32_t> GetAccessibleLocations(const std::vector<uint32_t>& allowe
 
     for (size_t i = 0; i < areaPool.size(); i++) {
       Area* area = AreaTable(areaPool[i]);
+      FillProfiler::CountAreaVisit();
 
       if (area->UpdateEvents(mode)){
         updatedEvents = true;
@@ -257,16 +282,16 @@ std::vector<uint32_t> GetAccessibleLocations(const std::vector<uint32_t>& allowe
       // in any area.
       if (mode == SearchMode::TimePassAccess) {
         if (area->timePass) {
-          if (area->childDay) {
+          if (area->Access().childDay) {
             timePassChildDay = true;
           }
-          if (area->childNight) {
+          if (area->Access().childNight) {
             timePassChildNight = true;
           }
-          if (area->adultDay) {
+          if (area->Access().adultDay) {
             timePassAdultDay = true;
           }
-          if (area->adultNight) {
+          if (area->Access().adultNight) {
             timePassAdultNight = true;
           }
         }
@@ -288,8 +313,8 @@ std::vector<uint32_t> GetAccessibleLocations(const std::vector<uint32_t>& allowe
 
         //If the exit is accessible and hasn't been added yet, add it to the pool
         Area* exitArea = exit.GetConnectedRegion();
-        if (!exitArea->addedToPool && exit.ConditionsMet()) {
-          exitArea->addedToPool = true;
+        if (!exitArea->Access().addedToPool && exit.ConditionsMet()) {
+          exitArea->Access().addedToPool = true;
           areaPool.push_back(exit.Getuint32_t());
         }
 
@@ -297,9 +322,9 @@ std::vector<uint32_t> GetAccessibleLocations(const std::vector<uint32_t>& allowe
         // Include bluewarps when unshuffled but dungeon or boss shuffle is on
         if (mode == SearchMode::GeneratePlaythrough &&
             (exit.IsShuffled() || (exit.GetType() == EntranceType::BlueWarp &&
-                                   (Settings::ShuffleDungeonEntrances.IsNot(SHUFFLEDUNGEONS_OFF) ||
-                                    Settings::ShuffleBossEntrances.IsNot(SHUFFLEBOSSES_OFF)))) &&
-            !exit.IsAddedToPool() && !noRandomEntrances) {
+                                   (settings->ShuffleDungeonEntrances.IsNot(SHUFFLEDUNGEONS_OFF) ||
+                                    settings->ShuffleBossEntrances.IsNot(SHUFFLEBOSSES_OFF)))) &&
+            !exit.IsAddedToPool() && !world.noRandomEntrances) {
           entranceSphere.push_back(&exit);
           exit.AddToPool();
           // Don't list a two-way coupled entrance from both directions
@@ -316,18 +341,19 @@ std::vector<uint32_t> GetAccessibleLocations(const std::vector<uint32_t>& allowe
           uint32_t loc = locPair.GetLocation();
           ItemLocation* location = Location(loc);
 
-          if (!location->IsAddedToPool() && locPair.ConditionsMet()) {
+          if (!logic->locationsInPool[loc] && locPair.ConditionsMet()) {
 
-            location->AddToPool();
+            logic->locationsInPool.set(loc);
+            const uint32_t placedItem = logic->emptiedLocations[loc] ? NONE : location->GetPlaceduint32_t();
 
-            if (location->GetPlaceduint32_t() == NONE) {
+            if (placedItem == NONE) {
               accessibleLocations.push_back(loc); //Empty location, consider for placement
             } else {
               //If ignore has a value, we want to check if the item location should be considered or not
               //This is necessary due to the below preprocessing for playthrough generation
               if (ignore != "") {
-                ItemType type = location->GetPlacedItem().GetItemType();
-                std::string itemName(location->GetPlacedItemName().GetEnglish());
+                ItemType type = ItemTable(placedItem).GetItemType();
+                std::string itemName(ItemTable(placedItem).GetName().GetEnglish());
                 //If we want to ignore tokens, only add if not a token
                 if (ignore == "Tokens" && type != ITEMTYPE_TOKEN) {
                   newItemLocations.push_back(location);
@@ -353,9 +379,9 @@ std::vector<uint32_t> GetAccessibleLocations(const std::vector<uint32_t>& allowe
             //Generate the playthrough, so we want to add advancement items, unless we know to ignore them
             if (mode == SearchMode::GeneratePlaythrough) {
               //Item is an advancement item, figure out if it should be added to this sphere
-              if (!playthroughBeatable && location->GetPlacedItem().IsAdvancement()) {
-                ItemType type = location->GetPlacedItem().GetItemType();
-                std::string itemName(location->GetPlacedItemName().GetEnglish());
+              if (!logic->playthroughBeatable && ItemTable(placedItem).IsAdvancement()) {
+                ItemType type = ItemTable(placedItem).GetItemType();
+                std::string itemName(ItemTable(placedItem).GetName().GetEnglish());
                 bool bombchus = itemName.find("Bombchu") != std::string::npos; //Is a bombchu location
 
                 //Decide whether to exclude this location
@@ -377,7 +403,7 @@ std::vector<uint32_t> GetAccessibleLocations(const std::vector<uint32_t>& allowe
                 }
                 //Handle buy items
                 //If ammo drops are off, don't do this step, since buyable ammo becomes logically important
-                else if (AmmoDrops.IsNot(AMMODROPS_NONE) && !(bombchus && bombchusFound) && type == ITEMTYPE_SHOP) {
+                else if (settings->AmmoDrops.IsNot(AMMODROPS_NONE) && !(bombchus && bombchusFound) && type == ITEMTYPE_SHOP) {
                   //Only check each buy item once
                   std::string buyItem = GetShopItemBaseName(itemName);
                   //Buy item not in list to ignore, add it to list and write to playthrough
@@ -387,7 +413,7 @@ std::vector<uint32_t> GetAccessibleLocations(const std::vector<uint32_t>& allowe
                   }
                 }
                 //Add all other advancement items
-                else if (!bombchus && type != ITEMTYPE_TOKEN && (AmmoDrops.Is(AMMODROPS_NONE) || type != ITEMTYPE_SHOP)) {
+                else if (!bombchus && type != ITEMTYPE_TOKEN && (settings->AmmoDrops.Is(AMMODROPS_NONE) || type != ITEMTYPE_SHOP)) {
                   exclude = false;
                 }
                 //Has not been excluded, add to playthrough
@@ -396,15 +422,15 @@ std::vector<uint32_t> GetAccessibleLocations(const std::vector<uint32_t>& allowe
                 }
               }
               //Triforce has been found, seed is beatable, nothing else in this or future spheres matters
-              else if (location->GetPlaceduint32_t() == TRIFORCE) {
+              else if (placedItem == TRIFORCE) {
                 itemSphere.clear();
                 itemSphere.push_back(loc);
-                playthroughBeatable = true;
+                logic->playthroughBeatable = true;
               }
             }
             //All we care about is if the game is beatable, used to pare down playthrough
-            else if (location->GetPlaceduint32_t() == TRIFORCE && mode == SearchMode::CheckBeatable) {
-              playthroughBeatable = true;
+            else if (placedItem == TRIFORCE && mode == SearchMode::CheckBeatable) {
+              logic->playthroughBeatable = true;
               return {}; //Return early for efficiency
             }
           }
@@ -413,19 +439,19 @@ std::vector<uint32_t> GetAccessibleLocations(const std::vector<uint32_t>& allowe
     }
 
     if (mode == SearchMode::GeneratePlaythrough && itemSphere.size() > 0) {
-      playthroughLocations.push_back(itemSphere);
+      world.playthroughLocations.push_back(itemSphere);
     }
-    if (mode == SearchMode::GeneratePlaythrough && entranceSphere.size() > 0 && !noRandomEntrances) {
-      playthroughEntrances.push_back(entranceSphere);
+    if (mode == SearchMode::GeneratePlaythrough && entranceSphere.size() > 0 && !world.noRandomEntrances) {
+      world.playthroughEntrances.push_back(entranceSphere);
     }
   }
 
   //Check to see if all locations were reached
   if (mode == SearchMode::AllLocationsReachable) {
-    allLocationsReachable = true;
-    for (const uint32_t loc : allLocations) {
-      if (!Location(loc)->IsAddedToPool()) {
-        allLocationsReachable = false;
+    world.allLocationsReachable = true;
+    for (const uint32_t loc : world.allLocations) {
+      if (!logic->locationsInPool[loc]) {
+        world.allLocationsReachable = false;
         auto message = "Location " + Location(loc)->GetName() + " not reachable\n";
         SPDLOG_DEBUG(message);
         #ifndef ENABLE_DEBUG
@@ -447,62 +473,187 @@ std::vector<uint32_t> GetAccessibleLocations(const std::vector<uint32_t>& allowe
   return accessibleLocations;
 }
 
-static void GeneratePlaythrough() {
-  playthroughBeatable = false;
-  LogicReset();
-  GetAccessibleLocations(allLocations, SearchMode::GeneratePlaythrough);
+//Beatability checks can be spread over a pool of worker threads. The workers search the generating thread's world
+//and settings, which nothing changes while they run, each with a logic of its own that holds everything a search
+//changes. The items a check takes out are marked in that logic, so the world itself is left as it is.
+//The pool is started by the first fill that needs it and kept for the ones after it, on any generating thread. Like
+//the audio synthesis pool it uses at most half the cores, as the game keeps running while a seed is generated.
+static std::mutex playthroughCheckPoolMutex;
+static uint32_t playthroughCheckThreads = std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+static std::shared_ptr<BS::thread_pool> playthroughCheckPool;
+
+//What the workers need to search the generating thread's world as it currently is
+struct CheckWorld {
+  Settings::Vars& settings;
+  World& world;
+  Logic::LogicState logic;
+};
+
+void SetPlaythroughCheckThreads(uint32_t count) {
+  std::lock_guard<std::mutex> lock(playthroughCheckPoolMutex);
+  if (count != playthroughCheckThreads) {
+    //A fill still using the old pool keeps it until it's done
+    playthroughCheckThreads = count;
+    playthroughCheckPool.reset();
+  }
+}
+
+//Returns the pool for the checks of one fill, or nullptr if they should run on the generating thread
+static std::shared_ptr<BS::thread_pool> GetPlaythroughCheckPool() {
+  std::lock_guard<std::mutex> lock(playthroughCheckPoolMutex);
+  if (playthroughCheckThreads <= 1) {
+    return nullptr;
+  }
+  if (playthroughCheckPool == nullptr) {
+    playthroughCheckPool = std::make_shared<BS::thread_pool>(playthroughCheckThreads);
+  }
+  return playthroughCheckPool;
+}
+
+static CheckWorld SnapshotCheckWorld(World& world) {
+  CheckWorld checkWorld = {*settings, world, {}};
+  logic->SaveLogicState(checkWorld.logic);
+  return checkWorld;
+}
+
+//Checks on this thread whether the game is beatable with what's currently placed
+static bool CheckBeatable(World& world, const std::string& ignore = "") {
+  logic->playthroughBeatable = false;
+  logic->LogicReset();
+  GetAccessibleLocations(world, world.allLocations, SearchMode::CheckBeatable, ignore);
+  return logic->playthroughBeatable;
+}
+
+//Checks on a worker whether the game is beatable with the given locations emptied
+static bool CheckBeatableInWorld(const CheckWorld& checkWorld, const std::vector<uint32_t>& emptiedLocations,
+                                 const std::string& ignore) {
+  auto checkLogic = std::make_unique<Logic::Vars>();
+  checkLogic->RestoreLogicState(checkWorld.logic);
+  for (uint32_t loc : emptiedLocations) {
+    checkLogic->emptiedLocations.set(loc);
+  }
+
+  WorldScope scope(*checkLogic, checkWorld.settings, checkWorld.world);
+  return CheckBeatable(checkWorld.world, ignore);
+}
+
+//Runs a set of independent beatability checks on the pool and waits for all of them. A check that throws fails the
+//whole generation, the same as it would on the generating thread.
+static void RunBeatableChecks(BS::thread_pool& pool, const CheckWorld& checkWorld,
+                              std::vector<std::vector<uint32_t>> emptiedLocations, const std::vector<std::string>& ignores,
+                              std::vector<bool>& beatable) {
+  std::vector<std::future<std::pair<bool, FillProfiler::Counters>>> results;
+  results.reserve(emptiedLocations.size());
+  for (size_t i = 0; i < emptiedLocations.size(); i++) {
+    results.push_back(pool.submit_task([&checkWorld, emptied = std::move(emptiedLocations[i]), ignore = ignores[i]] {
+      const FillProfiler::Counters startCounters = FillProfiler::counters;
+      const bool result = CheckBeatableInWorld(checkWorld, emptied, ignore);
+      return std::make_pair(result, FillProfiler::counters - startCounters);
+    }));
+  }
+
+  //Wait for every check before looking at any result, so none is still reading the world if one of them threw.
+  //Other fills may have checks in the same pool, so only this fill's are waited for.
+  for (auto& result : results) {
+    result.wait();
+  }
+  beatable.clear();
+  for (auto& result : results) {
+    const auto [value, counters] = result.get();
+    FillProfiler::AddCounters(counters);
+    beatable.push_back(value);
+  }
+}
+
+static void GeneratePlaythrough(World& world) {
+  FillProfiler::Phase phase("GeneratePlaythrough");
+  logic->playthroughBeatable = false;
+  logic->LogicReset();
+  Areas::ResetEntrancePool();
+  GetAccessibleLocations(world, world.allLocations, SearchMode::GeneratePlaythrough);
+}
+
+//Which placed items of the same kind as this one can be ignored when checking if it can be removed
+static std::string GetPlaythroughIgnore(uint32_t item) {
+  if (ItemTable(item).GetItemType() == ITEMTYPE_TOKEN) {
+    return "Tokens";
+  }
+  else if (ItemTable(item).GetName().GetEnglish().find("Bombchu") != std::string::npos) {
+    return "Bombchus";
+  }
+  else if (ItemTable(item).GetItemType() == ITEMTYPE_SHOP) {
+    return GetShopItemBaseName(ItemTable(item).GetName().GetEnglish());
+  }
+  return "";
 }
 
 //Remove unnecessary items from playthrough by removing their location, and checking if game is still beatable
 //To reduce searches, some preprocessing is done in playthrough generation to avoid adding obviously unnecessary items
-static void PareDownPlaythrough() {
+//With a check pool the next few locations are checked at once, each assuming the ones before it in the batch can be
+//removed as well, as most of them can. Results are used in order up to the first location that has to be kept, so
+//the outcome is the same as checking them one at a time.
+static void PareDownPlaythrough(World& world, BS::thread_pool* pool) {
+  FillProfiler::Phase phase("PareDownPlaythrough");
   std::vector<uint32_t> toAddBackItem;
-  //Start at sphere before Ganon's and count down
-  for (int i = playthroughLocations.size() - 2; i >= 0; i--) {
-    //Check each item location in sphere
-    std::vector<int> erasableIndices;
-    std::vector<uint32_t> sphere = playthroughLocations.at(i);
-    for (int j = sphere.size() - 1; j >= 0; j--) {
-      uint32_t loc = sphere.at(j);
-      uint32_t copy = Location(loc)->GetPlaceduint32_t(); //Copy out item
-      Location(loc)->SetPlacedItem(NONE); //Write in empty item
-      playthroughBeatable = false;
-      LogicReset();
-
-      std::string ignore = "";
-      if (ItemTable(copy).GetItemType() == ITEMTYPE_TOKEN) {
-        ignore = "Tokens";
-      }
-      else if (ItemTable(copy).GetName().GetEnglish().find("Bombchu") != std::string::npos) {
-        ignore = "Bombchus";
-      }
-      else if (ItemTable(copy).GetItemType() == ITEMTYPE_SHOP) {
-        ignore = GetShopItemBaseName(ItemTable(copy).GetName().GetEnglish());
-      }
+  //Start at sphere before Ganon's and count down, checking each item location in the sphere
+  std::vector<std::pair<size_t, size_t>> checkOrder;
+  for (int i = world.playthroughLocations.size() - 2; i >= 0; i--) {
+    for (int j = world.playthroughLocations[i].size() - 1; j >= 0; j--) {
+      checkOrder.emplace_back(i, j);
+    }
+  }
 
-      GetAccessibleLocations(allLocations, SearchMode::CheckBeatable, ignore); //Check if game is still beatable
-
-      //Playthrough is still beatable without this item, therefore it can be removed from playthrough section.
-      if (playthroughBeatable) {
-        //Uncomment to print playthrough deletion log in citra
-        // std::string itemname(ItemTable(copy).GetName().GetEnglish());
-        // std::string locationname(Location(loc)->GetName());
-        // std::string removallog = itemname + " at " + locationname + " removed from playthrough";
-        // CitraPrint(removallog);
-        playthroughLocations[i].erase(playthroughLocations[i].begin() + j);
-        Location(loc)->SetDelayedItem(copy); //Game is still beatable, don't add back until later
-        toAddBackItem.push_back(loc);
-      }
-      else {
-        Location(loc)->SetPlacedItem(copy); //Immediately put item back so game is beatable again
+  std::optional<CheckWorld> checkWorld;
+  if (pool != nullptr) {
+    checkWorld.emplace(SnapshotCheckWorld(world));
+  }
+  std::vector<bool> batchResults;
+  size_t batchStart = 0;
+
+  for (size_t c = 0; c < checkOrder.size(); c++) {
+    auto [i, j] = checkOrder[c];
+    uint32_t loc = world.playthroughLocations[i][j];
+    uint32_t copy = Location(loc)->GetPlaceduint32_t(); //Copy out item
+
+    if (pool != nullptr && c - batchStart >= batchResults.size()) {
+      std::vector<std::vector<uint32_t>> emptiedLocations;
+      std::vector<std::string> ignores;
+      std::vector<uint32_t> emptied = toAddBackItem;
+      for (size_t b = c; b < std::min(c + pool->get_thread_count(), checkOrder.size()); b++) {
+        uint32_t batchLoc = world.playthroughLocations[checkOrder[b].first][checkOrder[b].second];
+        emptied.push_back(batchLoc);
+        emptiedLocations.push_back(emptied);
+        ignores.push_back(GetPlaythroughIgnore(Location(batchLoc)->GetPlaceduint32_t()));
       }
+      batchStart = c;
+      RunBeatableChecks(*pool, *checkWorld, std::move(emptiedLocations), ignores, batchResults);
+    }
+
+    Location(loc)->SetPlacedItem(NONE); //Write in empty item
+    const bool beatable = pool != nullptr ? batchResults[c - batchStart] : CheckBeatable(world, GetPlaythroughIgnore(copy));
+
+    //Playthrough is still beatable without this item, therefore it can be removed from playthrough section.
+    if (beatable) {
+      //Uncomment to print playthrough deletion log in citra
+      // std::string itemname(ItemTable(copy).GetName().GetEnglish());
+      // std::string locationname(Location(loc)->GetName());
+      // std::string removallog = itemname + " at " + locationname + " removed from playthrough";
+      // CitraPrint(removallog);
+      world.playthroughLocations[i].erase(world.playthroughLocations[i].begin() + j);
+      Location(loc)->SetDelayedItem(copy); //Game is still beatable, don't add back until later
+      toAddBackItem.push_back(loc);
+    }
+    else {
+      Location(loc)->SetPlacedItem(copy); //Immediately put item back so game is beatable again
+      //The rest of the batch was checked with this item removed
+      batchResults.clear();
     }
   }
 
   //Some spheres may now be empty, remove these
-  for (int i = playthroughLocations.size() - 2; i >= 0; i--) {
-    if (playthroughLocations.at(i).size() == 0) {
-      playthroughLocations.erase(playthroughLocations.begin() + i);
+  for (int i = world.playthroughLocations.size() - 2; i >= 0; i--) {
+    if (world.playthroughLocations.at(i).size() == 0) {
+      world.playthroughLocations.erase(world.playthroughLocations.begin() + i);
     }
   }
 
@@ -516,36 +667,46 @@ static void PareDownPlaythrough() {
 //Way of the Hero items are more specific than playthrough items in that they are items which *must*
 // be obtained to logically be able to complete the seed, rather than playthrough items which
 // are just possible items you *can* collect to complete the seed.
-static void CalculateWotH() {
-  //First copy locations from the 2-dimensional playthroughLocations into the 1-dimensional wothLocations
+static void CalculateWotH(World& world, BS::thread_pool* pool) {
+  FillProfiler::Phase phase("CalculateWotH");
+  //First copy locations from the 2-dimensional world.playthroughLocations into the 1-dimensional world.wothLocations
   //size - 1 so Triforce is not counted
-  for (size_t i = 0; i < playthroughLocations.size() - 1; i++) {
-    for (size_t j = 0; j < playthroughLocations[i].size(); j++) {
-      if (Location(playthroughLocations[i][j])->IsHintable()) {
-        wothLocations.push_back(playthroughLocations[i][j]);
+  for (size_t i = 0; i < world.playthroughLocations.size() - 1; i++) {
+    for (size_t j = 0; j < world.playthroughLocations[i].size(); j++) {
+      if (Location(world.playthroughLocations[i][j])->IsHintable()) {
+        world.wothLocations.push_back(world.playthroughLocations[i][j]);
       }
     }
   }
 
+  //Each location is checked with only its own item removed, so they can all be checked at once
+  std::vector<bool> results;
+  if (pool != nullptr) {
+    std::vector<std::vector<uint32_t>> emptiedLocations;
+    for (uint32_t loc : world.wothLocations) {
+      emptiedLocations.push_back({loc});
+    }
+    RunBeatableChecks(*pool, SnapshotCheckWorld(world), std::move(emptiedLocations),
+                      std::vector<std::string>(world.wothLocations.size()), results);
+  }
+
   //Now go through and check each location, seeing if it is strictly necessary for game completion
-  for (int i = wothLocations.size() - 1; i >= 0; i--) {
-    uint32_t loc = wothLocations[i];
+  for (int i = world.wothLocations.size() - 1; i >= 0; i--) {
+    uint32_t loc = world.wothLocations[i];
     uint32_t copy = Location(loc)->GetPlaceduint32_t(); //Copy out item
     Location(loc)->SetPlacedItem(NONE); //Write in empty item
-    playthroughBeatable = false;
-    LogicReset();
-    GetAccessibleLocations(allLocations, SearchMode::CheckBeatable); //Check if game is still beatable
+    const bool beatable = pool != nullptr ? results[i] : CheckBeatable(world); //Check if game is still beatable
     Location(loc)->SetPlacedItem(copy); //Immediately put item back
     //If removing this item and no other item caused the game to become unbeatable, then it is strictly necessary, so keep it
-    //Else, delete from wothLocations
-    if (playthroughBeatable) {
-      wothLocations.erase(wothLocations.begin() + i);
+    //Else, delete from world.wothLocations
+    if (beatable) {
+      world.wothLocations.erase(world.wothLocations.begin() + i);
     }
   }
 
-  playthroughBeatable = true;
-  LogicReset();
-  GetAccessibleLocations(allLocations);
+  logic->playthroughBeatable = true;
+  logic->LogicReset();
+  GetAccessibleLocations(world, world.allLocations);
 }
 
 //Will place things completely randomly, no logic checks are performed
@@ -569,8 +730,9 @@ static void FastFill(std::vector<uint32_t> items, std::vector<uint32_t> location
 | This method helps distribution of items locked behind many requirements.
 | - OoT Randomizer
 */
-static void AssumedFill(const std::vector<uint32_t>& items, const std::vector<uint32_t>& allowedLocations,
+static void AssumedFill(World& world, const std::vector<uint32_t>& items, const std::vector<uint32_t>& allowedLocations,
                         bool setLocationsAsHintable = false) {
+    FillProfiler::Phase phase("AssumedFill");
 
     if (items.size() > allowedLocations.size()) {
         printf("\x1b[2;2HERROR: MORE ITEMS THAN LOCATIONS IN GIVEN LISTS");
@@ -586,11 +748,11 @@ static void AssumedFill(const std::vector<uint32_t>& items, const std::vector<ui
             SPDLOG_DEBUG(Location(loc)->GetName());
             SPDLOG_DEBUG("\n");
         }
-        placementFailure = true;
+        world.placementFailure = true;
         return;
     }
 
-    if (Settings::Logic.Is(LOGIC_NONE)) {
+    if (settings->Logic.Is(LOGIC_NONE)) {
         FastFill(items, GetEmptyLocations(allowedLocations), true);
         return;
     }
@@ -602,7 +764,7 @@ static void AssumedFill(const std::vector<uint32_t>& items, const std::vector<ui
     do {
         retries--;
         if (retries <= 0) {
-            placementFailure = true;
+            world.placementFailure = true;
             return;
         }
         unsuccessfulPlacement = false;
@@ -610,7 +772,7 @@ static void AssumedFill(const std::vector<uint32_t>& items, const std::vector<ui
 
         // copy all not yet placed advancement items so that we can apply their effects for the fill algorithm
         std::vector<uint32_t> itemsToNotPlace =
-            FilterFromPool(ItemPool, [](const auto i) { return ItemTable(i).IsAdvancement(); });
+            FilterFromPool(world.ItemPool, [](const auto i) { return ItemTable(i).IsAdvancement(); });
 
         // shuffle the order of items to place
         Shuffle(itemsToPlace);
@@ -620,7 +782,7 @@ static void AssumedFill(const std::vector<uint32_t>& items, const std::vector<ui
             itemsToPlace.pop_back();
 
             // assume we have all unplaced items
-            LogicReset();
+            logic->LogicReset();
             for (uint32_t unplacedItem : itemsToPlace) {
                 ItemTable(unplacedItem).ApplyEffect();
             }
@@ -629,7 +791,8 @@ static void AssumedFill(const std::vector<uint32_t>& items, const std::vector<ui
             }
 
             // get all accessible locations that are allowed
-            const std::vector<uint32_t> accessibleLocations = GetAccessibleLocations(allowedLocations);
+            FillProfiler::counters.fillSearches++;
+            const std::vector<uint32_t> accessibleLocations = GetAccessibleLocations(world, allowedLocations);
 
             // retry if there are no more locations to place items
             if (accessibleLocations.empty()) {
@@ -646,11 +809,12 @@ static void AssumedFill(const std::vector<uint32_t>& items, const std::vector<ui
                 // reset any locations that got an item
                 for (uint32_t loc : attemptedLocations) {
                     Location(loc)->SetPlacedItem(NONE);
-                    itemsPlaced--;
+                    world.itemsPlaced--;
                 }
                 attemptedLocations.clear();
 
                 unsuccessfulPlacement = true;
+                FillProfiler::counters.assumedFillRetries++;
                 break;
             }
 
@@ -668,11 +832,11 @@ static void AssumedFill(const std::vector<uint32_t>& items, const std::vector<ui
 
             // If ALR is off, then we check beatability after placing the item.
             // If the game is beatable, then we can stop placing items with logic.
-            if (!LocationsReachable) {
-                playthroughBeatable = false;
-                LogicReset();
-                GetAccessibleLocations(allLocations, SearchMode::CheckBeatable);
-                if (playthroughBeatable) {
+            if (!settings->LocationsReachable) {
+                logic->playthroughBeatable = false;
+                logic->LogicReset();
+                GetAccessibleLocations(world, world.allLocations, SearchMode::CheckBeatable);
+                if (logic->playthroughBeatable) {
                     SPDLOG_DEBUG("Game beatable, now placing items randomly. " + std::to_string(itemsToPlace.size()) +
                                 " major items remaining.\n\n");
                     FastFill(itemsToPlace, GetEmptyLocations(allowedLocations), true);
@@ -685,7 +849,8 @@ static void AssumedFill(const std::vector<uint32_t>& items, const std::vector<ui
 
 //This function will specifically randomize dungeon rewards for the End of Dungeons
 //setting, or randomize one dungeon reward to Link's Pocket if that setting is on
-static void RandomizeDungeonRewards() {
+static void RandomizeDungeonRewards(World& world) {
+  FillProfiler::Phase phase("RandomizeDungeonRewards");
 
   //quest item bit mask of each stone/medallion for the savefile
   static constexpr std::array<uint32_t, 9> bitMaskTable = {
@@ -702,9 +867,9 @@ static void RandomizeDungeonRewards() {
   int baseOffset = ItemTable(KOKIRI_EMERALD).GetItemID();
 
   //End of Dungeons includes Link's Pocket
-  if (ShuffleRewards.Is(REWARDSHUFFLE_END_OF_DUNGEON)) {
+  if (settings->ShuffleRewards.Is(REWARDSHUFFLE_END_OF_DUNGEON)) {
     //get stones and medallions
-    std::vector<uint32_t> rewards = FilterAndEraseFromPool(ItemPool, [](const auto i) {return ItemTable(i).GetItemType() == ITEMTYPE_DUNGEONREWARD;});
+    std::vector<uint32_t> rewards = FilterAndEraseFromPool(world.ItemPool, [](const auto i) {return ItemTable(i).GetItemType() == ITEMTYPE_DUNGEONREWARD;});
 
     // If there are less than 9 dungeon rewards, prioritize the actual dungeons
     // for placement instead of Link's Pocket
@@ -712,28 +877,28 @@ static void RandomizeDungeonRewards() {
       PlaceItemInLocation(LINKS_POCKET, GREEN_RUPEE);
     }
 
-    if (Settings::Logic.Is(LOGIC_VANILLA)) { //Place dungeon rewards in vanilla locations
+    if (settings->Logic.Is(LOGIC_VANILLA)) { //Place dungeon rewards in vanilla locations
       for (uint32_t loc : dungeonRewardLocations) {
         Location(loc)->PlaceVanillaItem();
       }
     } else { //Randomize dungeon rewards with assumed fill
-      AssumedFill(rewards, dungeonRewardLocations);
+      AssumedFill(world, rewards, dungeonRewardLocations);
     }
 
     for (size_t i = 0; i < dungeonRewardLocations.size(); i++) {
       const auto index = Location(dungeonRewardLocations[i])->GetPlacedItem().GetItemID() - baseOffset;
-      rDungeonRewardOverrides[i] = index;
+      settings->rDungeonRewardOverrides[i] = index;
 
       //set the player's dungeon reward on file creation instead of pushing it to them at the start.
       //This is done mainly because players are already familiar with seeing their dungeon reward
       //before opening up their file
       if (i == dungeonRewardLocations.size()-1) {
-        LinksPocketRewardBitMask = bitMaskTable[index];
+        settings->LinksPocketRewardBitMask = bitMaskTable[index];
       }
     }
-  } else if (LinksPocketItem.Is(LINKSPOCKETITEM_DUNGEON_REWARD)) {
+  } else if (settings->LinksPocketItem.Is(LINKSPOCKETITEM_DUNGEON_REWARD)) {
     //get 1 stone/medallion
-    std::vector<uint32_t> rewards = FilterFromPool(ItemPool, [](const auto i) {return ItemTable(i).GetItemType() == ITEMTYPE_DUNGEONREWARD;});
+    std::vector<uint32_t> rewards = FilterFromPool(world.ItemPool, [](const auto i) {return ItemTable(i).GetItemType() == ITEMTYPE_DUNGEONREWARD;});
     // If there are no remaining stones/medallions, then Link's pocket won't get one
     if (rewards.empty()) {
       PlaceItemInLocation(LINKS_POCKET, GREEN_RUPEE);
@@ -741,10 +906,10 @@ static void RandomizeDungeonRewards() {
     }
     uint32_t startingReward = RandomElement(rewards, true);
 
-    LinksPocketRewardBitMask = bitMaskTable[ItemTable(startingReward).GetItemID() - baseOffset];
+    settings->LinksPocketRewardBitMask = bitMaskTable[ItemTable(startingReward).GetItemID() - baseOffset];
     PlaceItemInLocation(LINKS_POCKET, startingReward);
     //erase the stone/medallion from the Item Pool
-    FilterAndEraseFromPool(ItemPool, [startingReward](const uint32_t i) {return i == startingReward;});
+    FilterAndEraseFromPool(world.ItemPool, [startingReward](const uint32_t i) {return i == startingReward;});
   }
 }
 
@@ -752,7 +917,7 @@ static void RandomizeDungeonRewards() {
 //can't be placed there.
 static void FillExcludedLocations() {
   //Only fill in excluded locations that don't already have something and are forbidden
-  std::vector<uint32_t> excludedLocations = FilterFromPool(allLocations, [](const auto loc){
+  std::vector<uint32_t> excludedLocations = FilterFromPool(world->allLocations, [](const auto loc){
     return Location(loc)->IsExcluded();
   });
 
@@ -762,46 +927,46 @@ static void FillExcludedLocations() {
 }
 
 //Function to handle the Own Dungeon setting
-static void RandomizeOwnDungeon(const Dungeon::DungeonInfo* dungeon) {
+static void RandomizeOwnDungeon(World& world, const Dungeon::DungeonInfo* dungeon) {
   std::vector<uint32_t> dungeonItems;
 
   // Search and filter for locations that match the hint region of the dungeon
   // This accounts for boss room shuffle so that own dungeon items can be placed
   // in the shuffled boss room
-  std::vector<LocationKey> dungeonLocations = FilterFromPool(allLocations, [dungeon](const auto loc) {
+  std::vector<LocationKey> dungeonLocations = FilterFromPool(world.allLocations, [dungeon](const auto loc) {
     return GetHintRegionHintKey(Location(loc)->GetParentRegionKey()) == dungeon->GetHintKey();
   });
 
   //filter out locations that may be required to have songs placed at them
   dungeonLocations = FilterFromPool(dungeonLocations, [](const auto loc){
-    if (ShuffleSongs.Is(SONGSHUFFLE_SONG_LOCATIONS)) {
+    if (settings->ShuffleSongs.Is(SONGSHUFFLE_SONG_LOCATIONS)) {
       return !(Location(loc)->IsCategory(Category::cSong));
     }
-    if (ShuffleSongs.Is(SONGSHUFFLE_DUNGEON_REWARDS)) {
+    if (settings->ShuffleSongs.Is(SONGSHUFFLE_DUNGEON_REWARDS)) {
       return !(Location(loc)->IsCategory(Category::cSongDungeonReward));
     }
     return true;
   });
 
   //Add specific items that need be randomized within this dungeon
-  if (Keysanity.Is(KEYSANITY_OWN_DUNGEON) && dungeon->GetSmallKey() != NONE) {
-    std::vector<uint32_t> dungeonSmallKeys = FilterAndEraseFromPool(ItemPool, [dungeon](const uint32_t i){ return (i == dungeon->GetSmallKey()) || (i == dungeon->GetKeyRing());});
+  if (settings->Keysanity.Is(KEYSANITY_OWN_DUNGEON) && dungeon->GetSmallKey() != NONE) {
+    std::vector<uint32_t> dungeonSmallKeys = FilterAndEraseFromPool(world.ItemPool, [dungeon](const uint32_t i){ return (i == dungeon->GetSmallKey()) || (i == dungeon->GetKeyRing());});
     AddElementsToPool(dungeonItems, dungeonSmallKeys);
   }
 
-  if ((BossKeysanity.Is(BOSSKEYSANITY_OWN_DUNGEON) && dungeon->GetBossKey() != GANONS_CASTLE_BOSS_KEY) ||
-      (GanonsBossKey.Is(GANONSBOSSKEY_OWN_DUNGEON) && dungeon->GetBossKey() == GANONS_CASTLE_BOSS_KEY)) {
-        auto dungeonBossKey = FilterAndEraseFromPool(ItemPool, [dungeon](const uint32_t i){ return i == dungeon->GetBossKey();});
+  if ((settings->BossKeysanity.Is(BOSSKEYSANITY_OWN_DUNGEON) && dungeon->GetBossKey() != GANONS_CASTLE_BOSS_KEY) ||
+      (settings->GanonsBossKey.Is(GANONSBOSSKEY_OWN_DUNGEON) && dungeon->GetBossKey() == GANONS_CASTLE_BOSS_KEY)) {
+        auto dungeonBossKey = FilterAndEraseFromPool(world.ItemPool, [dungeon](const uint32_t i){ return i == dungeon->GetBossKey();});
         AddElementsToPool(dungeonItems, dungeonBossKey);
   }
 
   //randomize boss key and small keys together for even distribution
-  AssumedFill(dungeonItems, dungeonLocations);
+  AssumedFill(world, dungeonItems, dungeonLocations);
 
   //randomize map and compass separately since they're not progressive
-  if (MapsAndCompasses.Is(MAPSANDCOMPASSES_OWN_DUNGEON) && dungeon->GetMap() != NONE && dungeon->GetCompass() != NONE) {
-    auto dungeonMapAndCompass = FilterAndEraseFromPool(ItemPool, [dungeon](const uint32_t i){ return i == dungeon->GetMap() || i == dungeon->GetCompass();});
-    AssumedFill(dungeonMapAndCompass, dungeonLocations);
+  if (settings->MapsAndCompasses.Is(MAPSANDCOMPASSES_OWN_DUNGEON) && dungeon->GetMap() != NONE && dungeon->GetCompass() != NONE) {
+    auto dungeonMapAndCompass = FilterAndEraseFromPool(world.ItemPool, [dungeon](const uint32_t i){ return i == dungeon->GetMap() || i == dungeon->GetCompass();});
+    AssumedFill(world, dungeonMapAndCompass, dungeonLocations);
   }
 }
 
@@ -813,113 +978,115 @@ static void RandomizeOwnDungeon(const Dungeon::DungeonInfo* dungeon) {
   Small Keys, Gerudo Keys, Boss Keys, Ganon's Boss Key, and/or dungeon rewards
   will be randomized together if they have the same setting. Maps and Compasses
   are randomized separately once the dungeon advancement items have all been placed.*/
-static void RandomizeDungeonItems() {
+static void RandomizeDungeonItems(World& world) {
+  FillProfiler::Phase phase("RandomizeDungeonItems");
   using namespace Dungeon;
 
   //Get Any Dungeon and Overworld group locations
-  std::vector<uint32_t> anyDungeonLocations = FilterFromPool(allLocations, [](const auto loc){return Location(loc)->IsDungeon();});
+  std::vector<uint32_t> anyDungeonLocations = FilterFromPool(world.allLocations, [](const auto loc){return Location(loc)->IsDungeon();});
   //overworldLocations defined in item_location.cpp
 
   //Create Any Dungeon and Overworld item pools
   std::vector<uint32_t> anyDungeonItems;
   std::vector<uint32_t> overworldItems;
 
-  for (auto dungeon : dungeonList) {
-    if (Keysanity.Is(KEYSANITY_ANY_DUNGEON)) {
-      auto dungeonKeys = FilterAndEraseFromPool(ItemPool, [dungeon](const uint32_t i){return (i == dungeon->GetSmallKey()) || (i == dungeon->GetKeyRing());});
+  for (auto dungeon : world.dungeons.dungeonList) {
+    if (settings->Keysanity.Is(KEYSANITY_ANY_DUNGEON)) {
+      auto dungeonKeys = FilterAndEraseFromPool(world.ItemPool, [dungeon](const uint32_t i){return (i == dungeon->GetSmallKey()) || (i == dungeon->GetKeyRing());});
       AddElementsToPool(anyDungeonItems, dungeonKeys);
-    } else if (Keysanity.Is(KEYSANITY_OVERWORLD)) {
-      auto dungeonKeys = FilterAndEraseFromPool(ItemPool, [dungeon](const uint32_t i){return (i == dungeon->GetSmallKey()) || (i == dungeon->GetKeyRing());});
+    } else if (settings->Keysanity.Is(KEYSANITY_OVERWORLD)) {
+      auto dungeonKeys = FilterAndEraseFromPool(world.ItemPool, [dungeon](const uint32_t i){return (i == dungeon->GetSmallKey()) || (i == dungeon->GetKeyRing());});
       AddElementsToPool(overworldItems, dungeonKeys);
     }
 
-    if (BossKeysanity.Is(BOSSKEYSANITY_ANY_DUNGEON) && dungeon->GetBossKey() != GANONS_CASTLE_BOSS_KEY) {
-      auto bossKey = FilterAndEraseFromPool(ItemPool, [dungeon](const uint32_t i){return i == dungeon->GetBossKey();});
+    if (settings->BossKeysanity.Is(BOSSKEYSANITY_ANY_DUNGEON) && dungeon->GetBossKey() != GANONS_CASTLE_BOSS_KEY) {
+      auto bossKey = FilterAndEraseFromPool(world.ItemPool, [dungeon](const uint32_t i){return i == dungeon->GetBossKey();});
       AddElementsToPool(anyDungeonItems, bossKey);
-    } else if (BossKeysanity.Is(BOSSKEYSANITY_OVERWORLD) && dungeon->GetBossKey() != GANONS_CASTLE_BOSS_KEY) {
-      auto bossKey = FilterAndEraseFromPool(ItemPool, [dungeon](const uint32_t i){return i == dungeon->GetBossKey();});
+    } else if (settings->BossKeysanity.Is(BOSSKEYSANITY_OVERWORLD) && dungeon->GetBossKey() != GANONS_CASTLE_BOSS_KEY) {
+      auto bossKey = FilterAndEraseFromPool(world.ItemPool, [dungeon](const uint32_t i){return i == dungeon->GetBossKey();});
       AddElementsToPool(overworldItems, bossKey);
     }
 
-    if (GanonsBossKey.Is(GANONSBOSSKEY_ANY_DUNGEON)) {
-      auto ganonBossKey = FilterAndEraseFromPool(ItemPool, [](const auto i){return i == GANONS_CASTLE_BOSS_KEY;});
+    if (settings->GanonsBossKey.Is(GANONSBOSSKEY_ANY_DUNGEON)) {
+      auto ganonBossKey = FilterAndEraseFromPool(world.ItemPool, [](const auto i){return i == GANONS_CASTLE_BOSS_KEY;});
       AddElementsToPool(anyDungeonItems, ganonBossKey);
-    } else if (GanonsBossKey.Is(GANONSBOSSKEY_OVERWORLD)) {
-        auto ganonBossKey = FilterAndEraseFromPool(ItemPool, [](const auto i) { return i == GANONS_CASTLE_BOSS_KEY; });
+    } else if (settings->GanonsBossKey.Is(GANONSBOSSKEY_OVERWORLD)) {
+        auto ganonBossKey = FilterAndEraseFromPool(world.ItemPool, [](const auto i) { return i == GANONS_CASTLE_BOSS_KEY; });
       AddElementsToPool(overworldItems, ganonBossKey);
     }
   }
 
-  if (GerudoKeys.Is(GERUDOKEYS_ANY_DUNGEON)) {
-      auto gerudoKeys = FilterAndEraseFromPool(ItemPool, [](const auto i) { return i == GERUDO_FORTRESS_SMALL_KEY || i == GERUDO_FORTRESS_KEY_RING; });
+  if (settings->GerudoKeys.Is(GERUDOKEYS_ANY_DUNGEON)) {
+      auto gerudoKeys = FilterAndEraseFromPool(world.ItemPool, [](const auto i) { return i == GERUDO_FORTRESS_SMALL_KEY || i == GERUDO_FORTRESS_KEY_RING; });
     AddElementsToPool(anyDungeonItems, gerudoKeys);
-  } else if (GerudoKeys.Is(GERUDOKEYS_OVERWORLD)) {
-      auto gerudoKeys = FilterAndEraseFromPool(ItemPool, [](const auto i) { return i == GERUDO_FORTRESS_SMALL_KEY || i == GERUDO_FORTRESS_KEY_RING; });
+  } else if (settings->GerudoKeys.Is(GERUDOKEYS_OVERWORLD)) {
+      auto gerudoKeys = FilterAndEraseFromPool(world.ItemPool, [](const auto i) { return i == GERUDO_FORTRESS_SMALL_KEY || i == GERUDO_FORTRESS_KEY_RING; });
     AddElementsToPool(overworldItems, gerudoKeys);
   }
 
-  if (ShuffleRewards.Is(REWARDSHUFFLE_ANY_DUNGEON)) {
+  if (settings->ShuffleRewards.Is(REWARDSHUFFLE_ANY_DUNGEON)) {
       auto rewards = FilterAndEraseFromPool(
-          ItemPool, [](const auto i) { return ItemTable(i).GetItemType() == ITEMTYPE_DUNGEONREWARD; });
+          world.ItemPool, [](const auto i) { return ItemTable(i).GetItemType() == ITEMTYPE_DUNGEONREWARD; });
     AddElementsToPool(anyDungeonItems, rewards);
-  } else if (ShuffleRewards.Is(REWARDSHUFFLE_OVERWORLD)) {
+  } else if (settings->ShuffleRewards.Is(REWARDSHUFFLE_OVERWORLD)) {
       auto rewards = FilterAndEraseFromPool(
-          ItemPool, [](const auto i) { return ItemTable(i).GetItemType() == ITEMTYPE_DUNGEONREWARD; });
+          world.ItemPool, [](const auto i) { return ItemTable(i).GetItemType() == ITEMTYPE_DUNGEONREWARD; });
     AddElementsToPool(overworldItems, rewards);
   }
 
   //Randomize Any Dungeon and Overworld pools
-  AssumedFill(anyDungeonItems, anyDungeonLocations, true);
-  AssumedFill(overworldItems, overworldLocations, true);
+  AssumedFill(world, anyDungeonItems, anyDungeonLocations, true);
+  AssumedFill(world, overworldItems, overworldLocations, true);
 
   //Randomize maps and compasses after since they're not advancement items
-  for (auto dungeon : dungeonList) {
-    if (MapsAndCompasses.Is(MAPSANDCOMPASSES_ANY_DUNGEON)) {
-      auto mapAndCompassItems = FilterAndEraseFromPool(ItemPool, [dungeon](const uint32_t i){return i == dungeon->GetMap() || i == dungeon->GetCompass();});
-      AssumedFill(mapAndCompassItems, anyDungeonLocations, true);
-    } else if (MapsAndCompasses.Is(MAPSANDCOMPASSES_OVERWORLD)) {
-      auto mapAndCompassItems = FilterAndEraseFromPool(ItemPool, [dungeon](const uint32_t i){return i == dungeon->GetMap() || i == dungeon->GetCompass();});
-      AssumedFill(mapAndCompassItems, overworldLocations, true);
+  for (auto dungeon : world.dungeons.dungeonList) {
+    if (settings->MapsAndCompasses.Is(MAPSANDCOMPASSES_ANY_DUNGEON)) {
+      auto mapAndCompassItems = FilterAndEraseFromPool(world.ItemPool, [dungeon](const uint32_t i){return i == dungeon->GetMap() || i == dungeon->GetCompass();});
+      AssumedFill(world, mapAndCompassItems, anyDungeonLocations, true);
+    } else if (settings->MapsAndCompasses.Is(MAPSANDCOMPASSES_OVERWORLD)) {
+      auto mapAndCompassItems = FilterAndEraseFromPool(world.ItemPool, [dungeon](const uint32_t i){return i == dungeon->GetMap() || i == dungeon->GetCompass();});
+      AssumedFill(world, mapAndCompassItems, overworldLocations, true);
     }
   }
 }
 
 static void RandomizeLinksPocket() {
-  if (LinksPocketItem.Is(LINKSPOCKETITEM_ADVANCEMENT)) {
+  if (settings->LinksPocketItem.Is(LINKSPOCKETITEM_ADVANCEMENT)) {
    //Get all the advancement items                                                                                                     don't include tokens
-      std::vector<uint32_t> advancementItems = FilterAndEraseFromPool(ItemPool, [](const auto i) {
+      std::vector<uint32_t> advancementItems = FilterAndEraseFromPool(world->ItemPool, [](const auto i) {
           return ItemTable(i).IsAdvancement() && ItemTable(i).GetItemType() != ITEMTYPE_TOKEN;
       });
    //select a random one
    uint32_t startingItem = RandomElement(advancementItems, true);
    //add the others back
-   AddElementsToPool(ItemPool, advancementItems);
+   AddElementsToPool(world->ItemPool, advancementItems);
 
    PlaceItemInLocation(LINKS_POCKET, startingItem);
- } else if (LinksPocketItem.Is(LINKSPOCKETITEM_NOTHING)) {
+ } else if (settings->LinksPocketItem.Is(LINKSPOCKETITEM_NOTHING)) {
    PlaceItemInLocation(LINKS_POCKET, GREEN_RUPEE);
  }
 }
 
-void VanillaFill() {
+void VanillaFill(World& world) {
+  WorldScope scope(world);
   //Perform minimum needed initialization
   AreaTable_Init();
   GenerateLocationPool();
   GenerateItemPool();
   GenerateStartingInventory();
   //Place vanilla item in each location
-  RandomizeDungeonRewards();
-  for (uint32_t loc : allLocations) {
+  RandomizeDungeonRewards(world);
+  for (uint32_t loc : world.allLocations) {
     Location(loc)->PlaceVanillaItem();
   }
   //If necessary, handle ER stuff
-  if (ShuffleEntrances) {
-    printf("\x1b[7;10HShuffling Entrances...");
+  if (settings->ShuffleEntrances) {
+    PrintProgress("\x1b[7;10HShuffling Entrances...");
     ShuffleAllEntrances();
-    printf("\x1b[7;32HDone");
+    PrintProgress("\x1b[7;32HDone");
   }
   // Populate the playthrough for entrances so they are placed in the spoiler log
-  GeneratePlaythrough();
+  GeneratePlaythrough(world);
   //Finish up
   CreateItemOverrides();
   CreateEntranceOverrides();
@@ -927,22 +1094,24 @@ void VanillaFill() {
 }
 
 void ClearProgress() {
-  printf("\x1b[7;32H    "); // Done
-  printf("\x1b[8;10H                    "); // Placing Items...Done
-  printf("\x1b[9;10H                              "); // Calculating Playthrough...Done
-  printf("\x1b[10;10H                     "); // Creating Hints...Done
-  printf("\x1b[11;10H                                  "); // Writing Spoiler Log...Done
+  PrintProgress("\x1b[7;32H    "); // Done
+  PrintProgress("\x1b[8;10H                    "); // Placing Items...Done
+  PrintProgress("\x1b[9;10H                              "); // Calculating Playthrough...Done
+  PrintProgress("\x1b[10;10H                     "); // Creating Hints...Done
+  PrintProgress("\x1b[11;10H                                  "); // Writing Spoiler Log...Done
 }
 
-int Fill() {
+int Fill(World& world) {
+  WorldScope scope(world);
+  FillProfiler::Phase phase("Fill");
 
   int retries = 0;
   while(retries < 5) {
-    placementFailure = false;
-    showItemProgress = false;
-    playthroughLocations.clear();
-    playthroughEntrances.clear();
-    wothLocations.clear();
+    world.placementFailure = false;
+    world.showItemProgress = false;
+    world.playthroughLocations.clear();
+    world.playthroughEntrances.clear();
+    world.wothLocations.clear();
     AreaTable_Init(); //Reset the world graph to intialize the proper locations
     ItemReset(); //Reset shops incase of shopsanity random
     GenerateLocationPool();
@@ -953,33 +1122,34 @@ int Fill() {
 
     //Temporarily add shop items to the ItemPool so that entrance randomization
     //can validate the world using deku/hylian shields
-    AddElementsToPool(ItemPool, GetMinVanillaShopItems(32)); //assume worst case shopsanity 4
-    if (ShuffleEntrances) {
-      printf("\x1b[7;10HShuffling Entrances");
+    AddElementsToPool(world.ItemPool, GetMinVanillaShopItems(32)); //assume worst case shopsanity 4
+    if (settings->ShuffleEntrances) {
+      PrintProgress("\x1b[7;10HShuffling Entrances");
       if (ShuffleAllEntrances() == ENTRANCE_SHUFFLE_FAILURE) {
         retries++;
+        FillProfiler::counters.fillRetries++;
         ClearProgress();
         continue;
       }
-      printf("\x1b[7;32HDone");
+      PrintProgress("\x1b[7;32HDone");
     }
     //erase temporary shop items
-    FilterAndEraseFromPool(ItemPool, [](const auto item) { return ItemTable(item).GetItemType() == ITEMTYPE_SHOP; });
+    FilterAndEraseFromPool(world.ItemPool, [](const auto item) { return ItemTable(item).GetItemType() == ITEMTYPE_SHOP; });
 
-    showItemProgress = true;
+    world.showItemProgress = true;
     //Place shop items first, since a buy shield is needed to place a dungeon reward on Gohma due to access
-    NonShopItems = {};
-    if (Shopsanity.Is(SHOPSANITY_OFF)) {
+    world.NonShopItems = {};
+    if (settings->Shopsanity.Is(SHOPSANITY_OFF)) {
       PlaceVanillaShopItems(); //Place vanilla shop items in vanilla location
     } else {
       int total_replaced = 0;
-      if (Shopsanity.IsNot(SHOPSANITY_ZERO)) { //Shopsanity 1-4, random
+      if (settings->Shopsanity.IsNot(SHOPSANITY_ZERO)) { //Shopsanity 1-4, random
         //Initialize NonShopItems
         ItemAndPrice init;
         init.Name = Text{"No Item", "Sin objeto", "Pas d'objet"};
         init.Price = -1;
         init.Repurchaseable = false;
-        NonShopItems.assign(32, init);
+        world.NonShopItems.assign(32, init);
         //Indices from OoTR. So shopsanity one will overwrite 7, three will overwrite 7, 5, 8, etc.
         const std::array<int, 4> indices = {7, 5, 8, 6};
         //Overwrite appropriate number of shop items
@@ -989,7 +1159,7 @@ int Fill() {
           for (int j = 0; j < num_to_replace; j++) {
             int itemindex = indices[j];
             int shopsanityPrice = GetRandomShopPrice();
-            NonShopItems[TransformShopIndex(i*8+itemindex-1)].Price = shopsanityPrice; //Set price to be retrieved by the patch and textboxes
+            world.NonShopItems[TransformShopIndex(i*8+itemindex-1)].Price = shopsanityPrice; //Set price to be retrieved by the patch and textboxes
             Location(ShopLocationLists[i][itemindex - 1])->SetShopsanityPrice(shopsanityPrice);
           }
         }
@@ -1009,100 +1179,105 @@ int Fill() {
         }
       }
       //Place the shop items which will still be at shop locations
-      AssumedFill(shopItems, shopLocations);
+      AssumedFill(world, shopItems, shopLocations);
     }
 
     //Place dungeon rewards
-    RandomizeDungeonRewards();
+    RandomizeDungeonRewards(world);
 
     //Place dungeon items restricted to their Own Dungeon
-    for (auto dungeon : Dungeon::dungeonList) {
-      RandomizeOwnDungeon(dungeon);
+    for (auto dungeon : world.dungeons.dungeonList) {
+      RandomizeOwnDungeon(world, dungeon);
     }
 
     //Then Place songs if song shuffle is set to specific locations
-    if (ShuffleSongs.IsNot(SONGSHUFFLE_ANYWHERE)) {
+    if (settings->ShuffleSongs.IsNot(SONGSHUFFLE_ANYWHERE)) {
 
       //Get each song
         std::vector<uint32_t> songs =
-            FilterAndEraseFromPool(ItemPool, [](const auto i) { return ItemTable(i).GetItemType() == ITEMTYPE_SONG; });
+            FilterAndEraseFromPool(world.ItemPool, [](const auto i) { return ItemTable(i).GetItemType() == ITEMTYPE_SONG; });
 
       //Get each song location
       std::vector<uint32_t> songLocations;
-      if (ShuffleSongs.Is(SONGSHUFFLE_SONG_LOCATIONS)) {
+      if (settings->ShuffleSongs.Is(SONGSHUFFLE_SONG_LOCATIONS)) {
           songLocations =
-              FilterFromPool(allLocations, [](const auto loc) { return Location(loc)->IsCategory(Category::cSong); });
+              FilterFromPool(world.allLocations, [](const auto loc) { return Location(loc)->IsCategory(Category::cSong); });
 
-      } else if (ShuffleSongs.Is(SONGSHUFFLE_DUNGEON_REWARDS)) {
+      } else if (settings->ShuffleSongs.Is(SONGSHUFFLE_DUNGEON_REWARDS)) {
           songLocations = FilterFromPool(
-              allLocations, [](const auto loc) { return Location(loc)->IsCategory(Category::cSongDungeonReward); });
+              world.allLocations, [](const auto loc) { return Location(loc)->IsCategory(Category::cSongDungeonReward); });
       }
 
-      AssumedFill(songs, songLocations, true);
+      AssumedFill(world, songs, songLocations, true);
     }
 
     //Then place dungeon items that are assigned to restrictive location pools
-    RandomizeDungeonItems();
+    RandomizeDungeonItems(world);
 
     //Then place Link's Pocket Item if it has to be an advancement item
     RandomizeLinksPocket();
     //Then place the rest of the advancement items
     std::vector<uint32_t> remainingAdvancementItems =
-        FilterAndEraseFromPool(ItemPool, [](const auto i) { return ItemTable(i).IsAdvancement(); });
-    AssumedFill(remainingAdvancementItems, allLocations, true);
+        FilterAndEraseFromPool(world.ItemPool, [](const auto i) { return ItemTable(i).IsAdvancement(); });
+    AssumedFill(world, remainingAdvancementItems, world.allLocations, true);
 
     //Fast fill for the rest of the pool
-    std::vector<uint32_t> remainingPool = FilterAndEraseFromPool(ItemPool, [](const auto i) { return true; });
-    FastFill(remainingPool, GetAllEmptyLocations(), false);
+    std::vector<uint32_t> remainingPool = FilterAndEraseFromPool(world.ItemPool, [](const auto i) { return true; });
+    FastFill(remainingPool, GetAllEmptyLocations(world), false);
 
     //Add prices for scrubsanity, this is unique to SoH because we write/read scrub prices to/from the spoilerfile.
-    if (Scrubsanity.Is(SCRUBSANITY_AFFORDABLE)) {
+    if (settings->Scrubsanity.Is(SCRUBSANITY_AFFORDABLE)) {
       for (size_t i = 0; i < ScrubLocations.size(); i++) {
         Location(ScrubLocations[i])->SetScrubsanityPrice(10);
       }
-    } else if (Scrubsanity.Is(SCRUBSANITY_RANDOM_PRICES)) {
+    } else if (settings->Scrubsanity.Is(SCRUBSANITY_RANDOM_PRICES)) {
       for (size_t i = 0; i < ScrubLocations.size(); i++) {
         int randomPrice = GetRandomScrubPrice();
         Location(ScrubLocations[i])->SetScrubsanityPrice(randomPrice);
       }
     }
 
-    GeneratePlaythrough();
+    GeneratePlaythrough(world);
     //Successful placement, produced beatable result
-    if(playthroughBeatable && !placementFailure) {
-      printf("Done");
-      printf("\x1b[9;10HCalculating Playthrough...");
-      PareDownPlaythrough();
-      CalculateWotH();
-      printf("Done");
+    if(logic->playthroughBeatable && !world.placementFailure) {
+      PrintProgress("Done");
+      PrintProgress("\x1b[9;10HCalculating Playthrough...");
+      std::shared_ptr<BS::thread_pool> checkPool = GetPlaythroughCheckPool();
+      PareDownPlaythrough(world, checkPool.get());
+      CalculateWotH(world, checkPool.get());
+      PrintProgress("Done");
       CreateItemOverrides();
       CreateEntranceOverrides();
-      if (GossipStoneHints.IsNot(HINTS_NO_HINTS)) {
-        printf("\x1b[10;10HCreating Hints...");
-        CreateAllHints();
-        printf("Done");
-      }
-      if (ShuffleMerchants.Is(SHUFFLEMERCHANTS_HINTS)) {
-        CreateMerchantsHints();
+      {
+        FillProfiler::Phase hintPhase("CreateHints");
+        if (settings->GossipStoneHints.IsNot(HINTS_NO_HINTS)) {
+          PrintProgress("\x1b[10;10HCreating Hints...");
+          CreateAllHints();
+          PrintProgress("Done");
+        }
+        if (settings->ShuffleMerchants.Is(SHUFFLEMERCHANTS_HINTS)) {
+          CreateMerchantsHints();
+        }
+        //Always execute ganon hint generation for the funny line
+        CreateGanonText();
+        CreateAltarText();
+        CreateDampesDiaryText();
+        CreateGregRupeeHint();
+        CreateSheikText();
+        CreateSariaText();
+        CreateWarpSongTexts();
       }
-      //Always execute ganon hint generation for the funny line
-      CreateGanonText();
-      CreateAltarText();
-      CreateDampesDiaryText();
-      CreateGregRupeeHint();
-      CreateSheikText();
-      CreateSariaText();
-      CreateWarpSongTexts();
       return 1;
     }
     //Unsuccessful placement
     if(retries < 4) {
       SPDLOG_DEBUG("\nGOT STUCK. RETRYING...\n");
       Areas::ResetAllLocations();
-      LogicReset();
+      logic->LogicReset();
       ClearProgress();
     }
     retries++;
+    FillProfiler::counters.fillRetries++;
   }
   //All retries failed
   return -1;
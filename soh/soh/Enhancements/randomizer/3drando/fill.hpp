@@ -5,6 +5,8 @@
 #include <vector>
 #include <string>
 
+struct World;
+
 enum class SearchMode {
   ReachabilitySearch,
   GeneratePlaythrough,
@@ -18,10 +20,14 @@ enum class SearchMode {
 };
 
 void ClearProgress();
-void VanillaFill();
-int Fill();
+void VanillaFill(World& world);
+int Fill(World& world);
+
+// Sets how many threads the playthrough and Way of the Hero beatability checks are spread over. 1 runs them on the
+// generating thread. The default is half the cores, from 1 to 4, in one pool which every fill shares.
+void SetPlaythroughCheckThreads(uint32_t count);
 
-std::vector<uint32_t> GetAccessibleLocations(const std::vector<uint32_t>& allowedLocations,
+std::vector<uint32_t> GetAccessibleLocations(World& world, const std::vector<uint32_t>& allowedLocations,
                                              SearchMode mode = SearchMode::ReachabilitySearch, std::string ignore = "",
                                              bool checkPoeCollectorAccess = false,
                                              bool checkOtherEntranceAccess = false);
@@ -0,0 +1,116 @@
+#include "fill_profiler.hpp"
+
+#include "settings.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace FillProfiler {
+
+struct PhaseRecord {
+  const char* name;
+  uint32_t calls = 0;
+  double milliseconds = 0.0;
+  Counters counters;
+};
+
+thread_local constinit Counters counters = {};
+
+static std::atomic<bool> enabled = false;
+static thread_local std::vector<PhaseRecord> phases;
+
+Counters& Counters::operator+=(const Counters& other) {
+  searches += other.searches;
+  fillSearches += other.fillSearches;
+  areasVisited += other.areasVisited;
+  conditionsEvaluated += other.conditionsEvaluated;
+  assumedFillRetries += other.assumedFillRetries;
+  fillRetries += other.fillRetries;
+  return *this;
+}
+
+Counters Counters::operator-(const Counters& other) const {
+  Counters difference = *this;
+  difference.searches -= other.searches;
+  difference.fillSearches -= other.fillSearches;
+  difference.areasVisited -= other.areasVisited;
+  difference.conditionsEvaluated -= other.conditionsEvaluated;
+  difference.assumedFillRetries -= other.assumedFillRetries;
+  difference.fillRetries -= other.fillRetries;
+  return difference;
+}
+
+void SetEnabled(bool enabled_) {
+  enabled = enabled_;
+}
+
+bool IsEnabled() {
+  return enabled;
+}
+
+void Reset() {
+  counters = {};
+  phases.clear();
+}
+
+void AddCounters(const Counters& other) {
+  counters += other;
+}
+
+Phase::Phase(const char* name_) : name(name_), active(enabled) {
+  if (active) {
+    start = std::chrono::steady_clock::now();
+    startCounters = counters;
+  }
+}
+
+Phase::~Phase() {
+  if (!active) {
+    return;
+  }
+
+  const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  auto record = std::find_if(phases.begin(), phases.end(), [this](const PhaseRecord& phase) {
+    return strcmp(phase.name, name) == 0;
+  });
+  if (record == phases.end()) {
+    record = phases.insert(phases.end(), {name});
+  }
+  record->calls++;
+  record->milliseconds += milliseconds;
+  record->counters += counters - startCounters;
+}
+
+static nlohmann::json CountersToJson(const Counters& counts) {
+  return {
+    {"searches", counts.searches},
+    {"fillSearches", counts.fillSearches},
+    {"areasVisited", counts.areasVisited},
+    {"conditionsEvaluated", counts.conditionsEvaluated},
+    {"assumedFillRetries", counts.assumedFillRetries},
+    {"fillRetries", counts.fillRetries},
+  };
+}
+
+std::string Dump() {
+  nlohmann::json profile;
+  profile["seed"] = settings->seedString;
+  profile["finalSeed"] = settings->seed;
+  profile["totals"] = CountersToJson(counters);
+
+  //Phases are listed in the order they first finished, nested phases are included in their parent's numbers
+  profile["phases"] = nlohmann::json::array();
+  for (const PhaseRecord& phase : phases) {
+    nlohmann::json phaseJson = CountersToJson(phase.counters);
+    phaseJson["name"] = phase.name;
+    phaseJson["calls"] = phase.calls;
+    phaseJson["ms"] = phase.milliseconds;
+    profile["phases"].push_back(phaseJson);
+  }
+  return profile.dump(4);
+}
+
+} // namespace FillProfiler
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Optional timing of the fill and its phases. The counters are always kept, since they are just
+// increments on the hot paths, while phase timings are only recorded once profiling is enabled.
+// Everything is kept per thread, so generations running side by side each get their own numbers.
+namespace FillProfiler {
+
+struct Counters {
+  uint64_t searches = 0;            // GetAccessibleLocations calls
+  uint64_t fillSearches = 0;        // AssumedFill searches
+  uint64_t areasVisited = 0;
+  uint64_t conditionsEvaluated = 0;
+  uint64_t assumedFillRetries = 0;
+  uint64_t fillRetries = 0;
+
+  Counters& operator+=(const Counters& other);
+  Counters operator-(const Counters& other) const;
+};
+
+extern thread_local constinit Counters counters;
+
+inline void CountCondition() {
+  counters.conditionsEvaluated++;
+}
+
+inline void CountAreaVisit() {
+  counters.areasVisited++;
+}
+
+void SetEnabled(bool enabled);
+bool IsEnabled();
+
+// Clears the phases and counters of the last generation on this thread
+void Reset();
+
+// Adds counts from searches done on another thread on behalf of this one
+void AddCounters(const Counters& other);
+
+// Times a phase from construction to destruction. Phases can be nested and are entered any number
+// of times, each name gets one entry covering every time it was entered.
+class Phase {
+public:
+  explicit Phase(const char* name_);
+  ~Phase();
+
+  Phase(const Phase&) = delete;
+  Phase& operator=(const Phase&) = delete;
+
+private:
+  const char* name;
+  bool active;
+  std::chrono::steady_clock::time_point start;
+  Counters startCounters;
+};
+
+// The phases and totals of the last generation as a JSON object
+std::string Dump();
+
+} // namespace FillProfiler
@@ -2,6 +2,7 @@
 #include "custom_messages.hpp"
 
 #include <array>
+#include <mutex>
 
 using namespace CustomMessages;
 
@@ -20,7 +21,7 @@ using namespace CustomMessages;
 
 std::array<HintText, KEY_ENUM_MAX> hintTable;
 
-void HintTable_Init() {
+static void BuildHintTable() {
     /*--------------------------
     |       GENERAL TEXT       |
     ---------------------------*/
@@ -3154,59 +3155,65 @@ void HintTable_Init() {
     });
 }
 
+//The hint table is the same for every generation, so it's only built the first time
+void HintTable_Init() {
+    static std::once_flag hintTableBuilt;
+    std::call_once(hintTableBuilt, BuildHintTable);
+}
+
 int32_t StonesRequiredBySettings() {
     int32_t stones = 0;
-    if (Settings::Bridge.Is(RAINBOWBRIDGE_STONES)) {
-        stones = std::max<int32_t>({ stones, (int32_t)Settings::BridgeStoneCount.Value<uint8_t>() });
+    if (settings->Bridge.Is(RAINBOWBRIDGE_STONES)) {
+        stones = std::max<int32_t>({ stones, (int32_t)settings->BridgeStoneCount.Value<uint8_t>() });
     }
-    if (Settings::Bridge.Is(RAINBOWBRIDGE_REWARDS)) {
-        stones = std::max<int32_t>({ stones, (int32_t)Settings::BridgeRewardCount.Value<uint8_t>() - 6 });
+    if (settings->Bridge.Is(RAINBOWBRIDGE_REWARDS)) {
+        stones = std::max<int32_t>({ stones, (int32_t)settings->BridgeRewardCount.Value<uint8_t>() - 6 });
     }
-    if ((Settings::Bridge.Is(RAINBOWBRIDGE_DUNGEONS)) && (Settings::ShuffleRewards.Is(REWARDSHUFFLE_END_OF_DUNGEON))) {
-        stones = std::max<int32_t>({ stones, (int32_t)Settings::BridgeDungeonCount.Value<uint8_t>() - 6 });
+    if ((settings->Bridge.Is(RAINBOWBRIDGE_DUNGEONS)) && (settings->ShuffleRewards.Is(REWARDSHUFFLE_END_OF_DUNGEON))) {
+        stones = std::max<int32_t>({ stones, (int32_t)settings->BridgeDungeonCount.Value<uint8_t>() - 6 });
     }
-    if (Settings::GanonsBossKey.Is(GANONSBOSSKEY_LACS_STONES)) {
-        stones = std::max<int32_t>({ stones, (int32_t)Settings::LACSStoneCount.Value<uint8_t>() });
+    if (settings->GanonsBossKey.Is(GANONSBOSSKEY_LACS_STONES)) {
+        stones = std::max<int32_t>({ stones, (int32_t)settings->LACSStoneCount.Value<uint8_t>() });
     }
-    if (Settings::GanonsBossKey.Is(GANONSBOSSKEY_LACS_REWARDS)) {
-        stones = std::max<int32_t>({ stones, (int32_t)Settings::LACSRewardCount.Value<uint8_t>() - 6 });
+    if (settings->GanonsBossKey.Is(GANONSBOSSKEY_LACS_REWARDS)) {
+        stones = std::max<int32_t>({ stones, (int32_t)settings->LACSRewardCount.Value<uint8_t>() - 6 });
     }
-    if (Settings::GanonsBossKey.Is(GANONSBOSSKEY_LACS_DUNGEONS)) {
-        stones = std::max<int32_t>({ stones, (int32_t)Settings::LACSDungeonCount.Value<uint8_t>() - 6 });
+    if (settings->GanonsBossKey.Is(GANONSBOSSKEY_LACS_DUNGEONS)) {
+        stones = std::max<int32_t>({ stones, (int32_t)settings->LACSDungeonCount.Value<uint8_t>() - 6 });
     }
     return stones;
 }
 
 int32_t MedallionsRequiredBySettings() {
     int32_t medallions = 0;
-    if (Settings::Bridge.Is(RAINBOWBRIDGE_MEDALLIONS)) {
-        medallions = std::max<int32_t>({ medallions, (int32_t)Settings::BridgeMedallionCount.Value<uint8_t>() });
+    if (settings->Bridge.Is(RAINBOWBRIDGE_MEDALLIONS)) {
+        medallions = std::max<int32_t>({ medallions, (int32_t)settings->BridgeMedallionCount.Value<uint8_t>() });
     }
-    if (Settings::Bridge.Is(RAINBOWBRIDGE_REWARDS)) {
-        medallions = std::max<int32_t>({ medallions, (int32_t)Settings::BridgeRewardCount.Value<uint8_t>() - 3 });
+    if (settings->Bridge.Is(RAINBOWBRIDGE_REWARDS)) {
+        medallions = std::max<int32_t>({ medallions, (int32_t)settings->BridgeRewardCount.Value<uint8_t>() - 3 });
     }
-    if ((Settings::Bridge.Is(RAINBOWBRIDGE_DUNGEONS)) && (Settings::ShuffleRewards.Is(REWARDSHUFFLE_END_OF_DUNGEON))) {
-        medallions = std::max<int32_t>({ medallions, (int32_t)Settings::BridgeDungeonCount.Value<uint8_t>() - 3 });
+    if ((settings->Bridge.Is(RAINBOWBRIDGE_DUNGEONS)) && (settings->ShuffleRewards.Is(REWARDSHUFFLE_END_OF_DUNGEON))) {
+        medallions = std::max<int32_t>({ medallions, (int32_t)settings->BridgeDungeonCount.Value<uint8_t>() - 3 });
     }
-    if (Settings::GanonsBossKey.Is(GANONSBOSSKEY_LACS_MEDALLIONS)) {
-        medallions = std::max<int32_t>({ medallions, (int32_t)Settings::LACSMedallionCount.Value<uint8_t>() });
+    if (settings->GanonsBossKey.Is(GANONSBOSSKEY_LACS_MEDALLIONS)) {
+        medallions = std::max<int32_t>({ medallions, (int32_t)settings->LACSMedallionCount.Value<uint8_t>() });
     }
-    if (Settings::GanonsBossKey.Is(GANONSBOSSKEY_LACS_REWARDS)) {
-        medallions = std::max<int32_t>({ medallions, (int32_t)Settings::LACSRewardCount.Value<uint8_t>() - 3 });
+    if (settings->GanonsBossKey.Is(GANONSBOSSKEY_LACS_REWARDS)) {
+        medallions = std::max<int32_t>({ medallions, (int32_t)settings->LACSRewardCount.Value<uint8_t>() - 3 });
     }
-    if (Settings::GanonsBossKey.Is(GANONSBOSSKEY_LACS_DUNGEONS)) {
-        medallions = std::max<int32_t>({ medallions, (int32_t)Settings::LACSDungeonCount.Value<uint8_t>() - 3 });
+    if (settings->GanonsBossKey.Is(GANONSBOSSKEY_LACS_DUNGEONS)) {
+        medallions = std::max<int32_t>({ medallions, (int32_t)settings->LACSDungeonCount.Value<uint8_t>() - 3 });
     }
     return medallions;
 }
 
 int32_t TokensRequiredBySettings() {
     int32_t tokens = 0;
-    if (Settings::Bridge.Is(RAINBOWBRIDGE_TOKENS)) {
-        tokens = std::max<int32_t>({ tokens, (int32_t)Settings::BridgeTokenCount.Value<uint8_t>() });
+    if (settings->Bridge.Is(RAINBOWBRIDGE_TOKENS)) {
+        tokens = std::max<int32_t>({ tokens, (int32_t)settings->BridgeTokenCount.Value<uint8_t>() });
     }
-    if (Settings::GanonsBossKey.Is(GANONSBOSSKEY_LACS_TOKENS)) {
-        tokens = std::max<int32_t>({ tokens, (int32_t)Settings::LACSTokenCount.Value<uint8_t>() });
+    if (settings->GanonsBossKey.Is(GANONSBOSSKEY_LACS_TOKENS)) {
+        tokens = std::max<int32_t>({ tokens, (int32_t)settings->LACSTokenCount.Value<uint8_t>() });
     }
     return tokens;
 }
@@ -3214,9 +3221,9 @@ int32_t TokensRequiredBySettings() {
 std::array<ConditionalAlwaysHint, 9> conditionalAlwaysHints = {
     std::make_pair(MARKET_10_BIG_POES,
                    []() {
-                       return Settings::BigPoeTargetCount.Value<uint8_t>() >= 3;
+                       return settings->BigPoeTargetCount.Value<uint8_t>() >= 3;
                    }), // Remember, the option's value being 3 means 4 are required
-    std::make_pair(DEKU_THEATER_MASK_OF_TRUTH, []() { return !Settings::CompleteMaskQuest; }),
+    std::make_pair(DEKU_THEATER_MASK_OF_TRUTH, []() { return !settings->CompleteMaskQuest; }),
     std::make_pair(SONG_FROM_OCARINA_OF_TIME, []() { return StonesRequiredBySettings() < 2; }),
     std::make_pair(HF_OCARINA_OF_TIME_ITEM, []() { return StonesRequiredBySettings() < 2; }),
     std::make_pair(SHEIK_IN_KAKARIKO, []() { return MedallionsRequiredBySettings() < 5; }),
@@ -15,6 +15,7 @@
 #include "z64item.h"
 #include <spdlog/spdlog.h>
 #include "../randomizerTypes.h"
+#include "world.hpp"
 
 using namespace CustomMessages;
 using namespace Logic;
@@ -127,99 +128,76 @@ constexpr std::array<HintSetting, 4> hintSettingTable{{
   },
 }};
 
-std::array<DungeonInfo, 10> dungeonInfoData;
-
-Text childAltarText;
-Text adultAltarText;
-Text ganonText;
-Text ganonHintText;
-Text sheikText;
-Text sariaText;
-Text dampesText;
-Text gregText;
-Text warpMinuetText;
-Text warpBoleroText;
-Text warpSerenadeText;
-Text warpRequiemText;
-Text warpNocturneText;
-Text warpPreludeText;
-
-
-std::string lightArrowHintLoc;
-std::string masterSwordHintLoc;
-std::string sariaHintLoc;
-std::string dampeHintLoc;
-
 Text& GetChildAltarText() {
-  return childAltarText;
+  return world->childAltarText;
 }
 
 Text& GetAdultAltarText() {
-  return adultAltarText;
+  return world->adultAltarText;
 }
 
 Text& GetGanonText() {
-  return ganonText;
+  return world->ganonText;
 }
 
 Text& GetGanonHintText() {
-  return ganonHintText;
+  return world->ganonHintText;
 }
 
 Text& GetDampeHintText() {
-  return dampesText;
+  return world->dampesText;
 }
 
 Text& GetGregHintText() {
-  return gregText;
+  return world->gregText;
 }
 
 Text& GetSheikHintText() {
-  return sheikText;
+  return world->sheikText;
 }
 
 Text& GetSariaHintText() {
-  return sariaText;
+  return world->sariaText;
 }
 
 Text& GetWarpMinuetText() {
-  return warpMinuetText;
+  return world->warpMinuetText;
 }
 
 Text& GetWarpBoleroText() {
-  return warpBoleroText;
+  return world->warpBoleroText;
 }
 
 Text& GetWarpSerenadeText() {
-  return warpSerenadeText;
+  return world->warpSerenadeText;
 }
 
 Text& GetWarpRequiemText() {
-  return warpRequiemText;
+  return world->warpRequiemText;
 }
 
 Text& GetWarpNocturneText() {
-  return warpNocturneText;
+  return world->warpNocturneText;
 }
 
 Text& GetWarpPreludeText() {
-  return warpPreludeText;
+  return world->warpPreludeText;
 }
 
 std::string GetMasterSwordHintLoc() {
-    return masterSwordHintLoc;
+    return world->masterSwordHintLoc;
 }
   
 std::string GetLightArrowHintLoc() {
-    return lightArrowHintLoc;
+    return world->lightArrowHintLoc;
 }
 
 std::string GetDampeHintLoc() {
-    return dampeHintLoc;
+    return world->dampeHintLoc;
 }
 
 std::string GetSariaHintLoc() {
-  return sariaHintLoc;
+  return world->sariaHintLoc;
 }
 
 Area* GetHintRegion(const uint32_t area) {
@@ -273,8 +251,8 @@ static std::vector<uint32_t> GetAccessibleGossipStones(const uint32_t hintedLoca
   uint32_t originalItem = Location(hintedLocation)->GetPlaceduint32_t();
   Location(hintedLocation)->SetPlacedItem(NONE);
 
-  LogicReset();
-  auto accessibleGossipStones = GetAccessibleLocations(gossipStoneLocations);
+  logic->LogicReset();
+  auto accessibleGossipStones = GetAccessibleLocations(*world, gossipStoneLocations);
   //Give the item back to the location
   Location(hintedLocation)->SetPlacedItem(originalItem);
 
@@ -283,7 +261,7 @@ static std::vector<uint32_t> GetAccessibleGossipStones(const uint32_t hintedLoca
 
 static void AddHint(Text hint, const uint32_t gossipStone, const std::vector<uint8_t>& colors = {}, HintType hintType = HINT_TYPE_ITEM, const uint32_t hintedLocation = NONE) {
   //save hints as dummy items for writing to the spoiler log
-  NewItem(gossipStone, Item{RG_HINT, hint, ITEMTYPE_EVENT, GI_RUPEE_BLUE_LOSE, false, &noVariable, NONE});
+  NewItem(gossipStone, Item{RG_HINT, hint, ITEMTYPE_EVENT, GI_RUPEE_BLUE_LOSE, false, &Logic::Vars::noVariable, NONE});
   Location(gossipStone)->SetPlacedItem(gossipStone);
   Location(gossipStone)->SetHintedLocation(hintedLocation);
   Location(gossipStone)->SetHintType(hintType);
@@ -334,7 +312,7 @@ static void CreateWothHint(uint8_t* remainingDungeonWothHints) {
     std::vector<uint32_t> possibleHintLocations = {};
     // iterate through playthrough locations by sphere
     std::vector<uint32_t> wothHintLocations =
-        FilterFromPool(wothLocations, [remainingDungeonWothHints](uint32_t loc) {
+        FilterFromPool(world->wothLocations, [remainingDungeonWothHints](uint32_t loc) {
             return Location(loc)->IsHintable() &&    // only filter hintable locations
                    !(Location(loc)->IsHintedAt()) && // only filter locations that haven't been hinted at
                    (Location(loc)->IsOverworld() ||
@@ -432,7 +410,7 @@ static void CreateBarrenHint(uint8_t* remainingDungeonBarrenHints, std::vector<u
 }
 
 static void CreateRandomLocationHint(const bool goodItem = false) {
-  const std::vector<uint32_t> possibleHintLocations = FilterFromPool(allLocations, [goodItem](const uint32_t loc) {
+  const std::vector<uint32_t> possibleHintLocations = FilterFromPool(world->allLocations, [goodItem](const uint32_t loc) {
     return Location(loc)->IsHintable() && !(Location(loc)->IsHintedAt()) && (!goodItem || Location(loc)->GetPlacedItem().IsMajorItem());
   });
   //If no more locations can be hinted at, then just try to get another hint
@@ -485,8 +463,8 @@ static void CreateGoodItemHint() {
 static void CreateJunkHint() {
   //duplicate junk hints are possible for now
   const HintText junkHint = RandomElement(GetHintCategory(HintCategory::Junk));
-  LogicReset();
-  const std::vector<uint32_t> gossipStones = GetAccessibleLocations(gossipStoneLocations);
+  logic->LogicReset();
+  const std::vector<uint32_t> gossipStones = GetAccessibleLocations(*world, gossipStoneLocations);
   if (gossipStones.empty()) {
       SPDLOG_DEBUG("\tNO GOSSIP STONES TO PLACE HINT\n\n");
     return;
@@ -505,9 +483,9 @@ static std::vector<uint32_t> CalculateBarrenRegions() {
   std::vector<uint32_t> barrenLocations = {};
   std::vector<uint32_t> potentiallyUsefulLocations = {};
 
-  for (uint32_t loc : allLocations) {
+  for (uint32_t loc : world->allLocations) {
     // If a location has a major item or is a way of the hero location, it is not barren
-    if (Location(loc)->GetPlacedItem().IsMajorItem() || ElementInContainer(loc, wothLocations)) {
+    if (Location(loc)->GetPlacedItem().IsMajorItem() || ElementInContainer(loc, world->wothLocations)) {
       AddElementsToPool(potentiallyUsefulLocations, std::vector{loc});
     } else {
       // Link's Pocket & Triforce Hunt "reward" shouldn't be considered for barren areas because it's clear what
@@ -535,7 +513,7 @@ static std::vector<uint32_t> CalculateBarrenRegions() {
 
 static void CreateTrialHints() {
     //six trials
-  if (RandomGanonsTrials && GanonsTrialsCount.Is(6)) {
+  if (settings->RandomGanonsTrials && settings->GanonsTrialsCount.Is(6)) {
 
     //get a random gossip stone
     auto gossipStones = GetAccessibleGossipStones();
@@ -546,7 +524,7 @@ static void CreateTrialHints() {
     AddHint(hint, gossipStone, { QM_PINK }, HINT_TYPE_TRIAL);
 
     //zero trials
-  } else if (RandomGanonsTrials && GanonsTrialsCount.Is(0)) {
+  } else if (settings->RandomGanonsTrials && settings->GanonsTrialsCount.Is(0)) {
 
     //get a random gossip stone
     auto gossipStones = GetAccessibleGossipStones();
@@ -557,11 +535,11 @@ static void CreateTrialHints() {
     AddHint(hint, gossipStone, { QM_YELLOW }, HINT_TYPE_TRIAL);
 
     //4 or 5 required trials
-  } else if (GanonsTrialsCount.Is(5) || GanonsTrialsCount.Is(4)) {
+  } else if (settings->GanonsTrialsCount.Is(5) || settings->GanonsTrialsCount.Is(4)) {
 
     //get skipped trials
     std::vector<TrialInfo*> trials = {};
-    trials.assign(trialList.begin(), trialList.end());
+    trials.assign(world->trials.trialList.begin(), world->trials.trialList.end());
     auto skippedTrials = FilterFromPool(trials, [](TrialInfo* trial){return trial->IsSkipped();});
 
     //create a hint for each skipped trial
@@ -575,10 +553,10 @@ static void CreateTrialHints() {
       AddHint(hint, gossipStone, { QM_YELLOW }, HINT_TYPE_TRIAL);
     }
     //1 to 3 trials
-  } else if (GanonsTrialsCount.Value<uint8_t>() >= 1 && GanonsTrialsCount.Value<uint8_t>() <= 3) {
+  } else if (settings->GanonsTrialsCount.Value<uint8_t>() >= 1 && settings->GanonsTrialsCount.Value<uint8_t>() <= 3) {
     //get requried trials
     std::vector<TrialInfo*> trials = {};
-    trials.assign(trialList.begin(), trialList.end());
+    trials.assign(world->trials.trialList.begin(), world->trials.trialList.end());
     auto requiredTrials = FilterFromPool(trials, [](TrialInfo* trial){return trial->IsRequired();});
 
     //create a hint for each required trial
@@ -597,45 +575,45 @@ static void CreateTrialHints() {
 void CreateGanonText() {
 
   //funny ganon line
-  ganonText = RandomElement(GetHintCategory(HintCategory::GanonLine)).GetText();
-  CreateMessageFromTextObject(0x70CB, 0, 2, 3, AddColorsAndFormat(ganonText));
+  world->ganonText = RandomElement(GetHintCategory(HintCategory::GanonLine)).GetText();
+  CreateMessageFromTextObject(0x70CB, 0, 2, 3, AddColorsAndFormat(world->ganonText));
 
   //Get the location of the light arrows
-  auto lightArrowLocation = FilterFromPool(allLocations, [](const uint32_t loc){return Location(loc)->GetPlaceduint32_t() == LIGHT_ARROWS;});
+  auto lightArrowLocation = FilterFromPool(world->allLocations, [](const uint32_t loc){return Location(loc)->GetPlaceduint32_t() == LIGHT_ARROWS;});
 
   //If there is no light arrow location, it was in the player's inventory at the start
   auto hint = Hint(LIGHT_ARROW_LOCATION_HINT);
   if (lightArrowLocation.empty()) {
-    ganonHintText = hint.GetText()+Hint(YOUR_POCKET).GetText();
-    lightArrowHintLoc = "Link's Pocket";
+    world->ganonHintText = hint.GetText()+Hint(YOUR_POCKET).GetText();
+    world->lightArrowHintLoc = "Link's Pocket";
   } else {
-    ganonHintText = hint.GetText() + "%r" + GetHintRegion(Location(lightArrowLocation[0])->GetParentRegionKey())->GetHint().GetText();
-    lightArrowHintLoc = Location(lightArrowLocation[0])->GetName();
+    world->ganonHintText = hint.GetText() + "%r" + GetHintRegion(Location(lightArrowLocation[0])->GetParentRegionKey())->GetHint().GetText();
+    world->lightArrowHintLoc = Location(lightArrowLocation[0])->GetName();
   }
-  ganonHintText = ganonHintText + "!";
+  world->ganonHintText = world->ganonHintText + "!";
 
-  if (ShuffleMasterSword) {
+  if (settings->ShuffleMasterSword) {
     //Get the location of the master sword
-    auto masterSwordLocation = FilterFromPool(allLocations, [](const LocationKey loc){return Location(loc)->GetPlacedItemKey() == MASTER_SWORD;});
+    auto masterSwordLocation = FilterFromPool(world->allLocations, [](const LocationKey loc){return Location(loc)->GetPlacedItemKey() == MASTER_SWORD;});
 
     // Add second text box
-    ganonHintText = ganonHintText + "^";
+    world->ganonHintText = world->ganonHintText + "^";
     if (masterSwordLocation.empty()) {
-      ganonHintText = ganonHintText+Hint(MASTER_SWORD_LOCATION_HINT).GetText()+Hint(YOUR_POCKET).GetText();
-      masterSwordHintLoc = "Link's Pocket";
+      world->ganonHintText = world->ganonHintText+Hint(MASTER_SWORD_LOCATION_HINT).GetText()+Hint(YOUR_POCKET).GetText();
+      world->masterSwordHintLoc = "Link's Pocket";
     } else {
-      ganonHintText = ganonHintText+Hint(MASTER_SWORD_LOCATION_HINT).GetText()+GetHintRegion(Location(masterSwordLocation[0])->GetParentRegionKey())->GetHint().GetText();
-      masterSwordHintLoc = Location(masterSwordLocation[0])->GetName();
+      world->ganonHintText = world->ganonHintText+Hint(MASTER_SWORD_LOCATION_HINT).GetText()+GetHintRegion(Location(masterSwordLocation[0])->GetParentRegionKey())->GetHint().GetText();
+      world->masterSwordHintLoc = Location(masterSwordLocation[0])->GetName();
     }
-    ganonHintText = ganonHintText + "!";
+    world->ganonHintText = world->ganonHintText + "!";
   }
 
-  CreateMessageFromTextObject(0x70CC, 0, 2, 3, AddColorsAndFormat(ganonHintText));
+  CreateMessageFromTextObject(0x70CC, 0, 2, 3, AddColorsAndFormat(world->ganonHintText));
 }
 
 //Find the location which has the given itemKey and create the generic altar text for the reward
 static Text BuildDungeonRewardText(const uint32_t itemKey) {
-  uint32_t location = FilterFromPool(allLocations, [itemKey](const uint32_t loc){return Location(loc)->GetPlaceduint32_t() == itemKey;})[0];
+  uint32_t location = FilterFromPool(world->allLocations, [itemKey](const uint32_t loc){return Location(loc)->GetPlaceduint32_t() == itemKey;})[0];
   Location(location)->SetAsHinted();
 
   std::string rewardString = "$" + std::to_string(itemKey - KOKIRI_EMERALD);
@@ -648,15 +626,15 @@ static Text BuildDoorOfTimeText() {
   std::string itemObtained;
   Text doorOfTimeText;
 
-  if (OpenDoorOfTime.Is(OPENDOOROFTIME_OPEN)) {
+  if (settings->OpenDoorOfTime.Is(OPENDOOROFTIME_OPEN)) {
     itemObtained = "$o";
     doorOfTimeText = Hint(CHILD_ALTAR_TEXT_END_DOTOPEN).GetText();
 
-  } else if (OpenDoorOfTime.Is(OPENDOOROFTIME_SONGONLY)) {
+  } else if (settings->OpenDoorOfTime.Is(OPENDOOROFTIME_SONGONLY)) {
     itemObtained = "$c";
     doorOfTimeText = Hint(CHILD_ALTAR_TEXT_END_DOTSONGONLY).GetText();
 
-  } else if (OpenDoorOfTime.Is(OPENDOOROFTIME_CLOSED)) {
+  } else if (settings->OpenDoorOfTime.Is(OPENDOOROFTIME_CLOSED)) {
     itemObtained = "$i";
     doorOfTimeText = Hint(CHILD_ALTAR_TEXT_END_DOTCLOSED).GetText();
   }
@@ -679,28 +657,28 @@ static Text BuildCountReq(const uint32_t req, const Option& count) {
 static Text BuildBridgeReqsText() {
   Text bridgeText;
 
-  if (Bridge.Is(RAINBOWBRIDGE_OPEN)) {
+  if (settings->Bridge.Is(RAINBOWBRIDGE_OPEN)) {
     bridgeText = Hint(BRIDGE_OPEN_HINT).GetText();
 
-  } else if (Bridge.Is(RAINBOWBRIDGE_VANILLA)) {
+  } else if (settings->Bridge.Is(RAINBOWBRIDGE_VANILLA)) {
     bridgeText = Hint(BRIDGE_VANILLA_HINT).GetText();
 
-  } else if (Bridge.Is(RAINBOWBRIDGE_STONES)) {
-    bridgeText = BuildCountReq(BRIDGE_STONES_HINT, BridgeStoneCount);
+  } else if (settings->Bridge.Is(RAINBOWBRIDGE_STONES)) {
+    bridgeText = BuildCountReq(BRIDGE_STONES_HINT, settings->BridgeStoneCount);
 
-  } else if (Bridge.Is(RAINBOWBRIDGE_MEDALLIONS)) {
-    bridgeText = BuildCountReq(BRIDGE_MEDALLIONS_HINT, BridgeMedallionCount);
+  } else if (settings->Bridge.Is(RAINBOWBRIDGE_MEDALLIONS)) {
+    bridgeText = BuildCountReq(BRIDGE_MEDALLIONS_HINT, settings->BridgeMedallionCount);
 
-  } else if (Bridge.Is(RAINBOWBRIDGE_REWARDS)) {
-    bridgeText = BuildCountReq(BRIDGE_REWARDS_HINT, BridgeRewardCount);
+  } else if (settings->Bridge.Is(RAINBOWBRIDGE_REWARDS)) {
+    bridgeText = BuildCountReq(BRIDGE_REWARDS_HINT, settings->BridgeRewardCount);
 
-  } else if (Bridge.Is(RAINBOWBRIDGE_DUNGEONS)) {
-    bridgeText = BuildCountReq(BRIDGE_DUNGEONS_HINT, BridgeDungeonCount);
+  } else if (settings->Bridge.Is(RAINBOWBRIDGE_DUNGEONS)) {
+    bridgeText = BuildCountReq(BRIDGE_DUNGEONS_HINT, settings->BridgeDungeonCount);
 
-  } else if (Bridge.Is(RAINBOWBRIDGE_TOKENS)) {
-    bridgeText = BuildCountReq(BRIDGE_TOKENS_HINT, BridgeTokenCount);
+  } else if (settings->Bridge.Is(RAINBOWBRIDGE_TOKENS)) {
+    bridgeText = BuildCountReq(BRIDGE_TOKENS_HINT, settings->BridgeTokenCount);
   
-  } else if (Bridge.Is(RAINBOWBRIDGE_GREG)) {
+  } else if (settings->Bridge.Is(RAINBOWBRIDGE_GREG)) {
     bridgeText = Hint(BRIDGE_GREG_HINT).GetText();
   }
 
@@ -710,46 +688,46 @@ static Text BuildBridgeReqsText() {
 static Text BuildGanonBossKeyText() {
   Text ganonBossKeyText;
 
-  if (GanonsBossKey.Is(GANONSBOSSKEY_START_WITH)) {
+  if (settings->GanonsBossKey.Is(GANONSBOSSKEY_START_WITH)) {
     ganonBossKeyText = Hint(GANON_BK_START_WITH_HINT).GetText();
 
-  } else if (GanonsBossKey.Is(GANONSBOSSKEY_VANILLA)) {
+  } else if (settings->GanonsBossKey.Is(GANONSBOSSKEY_VANILLA)) {
     ganonBossKeyText = Hint(GANON_BK_VANILLA_HINT).GetText();
 
-  } else if (GanonsBossKey.Is(GANONSBOSSKEY_OWN_DUNGEON)) {
+  } else if (settings->GanonsBossKey.Is(GANONSBOSSKEY_OWN_DUNGEON)) {
     ganonBossKeyText = Hint(GANON_BK_OWN_DUNGEON_HINT).GetText();
 
-  } else if (GanonsBossKey.Is(GANONSBOSSKEY_ANY_DUNGEON)) {
+  } else if (settings->GanonsBossKey.Is(GANONSBOSSKEY_ANY_DUNGEON)) {
     ganonBossKeyText = Hint(GANON_BK_ANY_DUNGEON_HINT).GetText();
 
-  } else if (GanonsBossKey.Is(GANONSBOSSKEY_OVERWORLD)) {
+  } else if (settings->GanonsBossKey.Is(GANONSBOSSKEY_OVERWORLD)) {
     ganonBossKeyText = Hint(GANON_BK_OVERWORLD_HINT).GetText();
 
-  } else if (GanonsBossKey.Is(GANONSBOSSKEY_ANYWHERE)) {
+  } else if (settings->GanonsBossKey.Is(GANONSBOSSKEY_ANYWHERE)) {
     ganonBossKeyText = Hint(GANON_BK_ANYWHERE_HINT).GetText();
 
-  } else if (GanonsBossKey.Is(GANONSBOSSKEY_FINAL_GS_REWARD)) {
+  } else if (settings->GanonsBossKey.Is(GANONSBOSSKEY_FINAL_GS_REWARD)) {
     ganonBossKeyText = Hint(GANON_BK_SKULLTULA_HINT).GetText();
 
-  } else if (GanonsBossKey.Is(GANONSBOSSKEY_LACS_VANILLA)) {
+  } else if (settings->GanonsBossKey.Is(GANONSBOSSKEY_LACS_VANILLA)) {
     ganonBossKeyText = Hint(LACS_VANILLA_HINT).GetText();
 
-  } else if (GanonsBossKey.Is(GANONSBOSSKEY_LACS_STONES)) {
-    ganonBossKeyText = BuildCountReq(LACS_STONES_HINT, LACSStoneCount);
+  } else if (settings->GanonsBossKey.Is(GANONSBOSSKEY_LACS_STONES)) {
+    ganonBossKeyText = BuildCountReq(LACS_STONES_HINT, settings->LACSStoneCount);
 
-  } else if (GanonsBossKey.Is(GANONSBOSSKEY_LACS_MEDALLIONS)) {
-    ganonBossKeyText = BuildCountReq(LACS_MEDALLIONS_HINT, LACSMedallionCount);
+  } else if (settings->GanonsBossKey.Is(GANONSBOSSKEY_LACS_MEDALLIONS)) {
+    ganonBossKeyText = BuildCountReq(LACS_MEDALLIONS_HINT, settings->LACSMedallionCount);
 
-  } else if (GanonsBossKey.Is(GANONSBOSSKEY_LACS_REWARDS)) {
-    ganonBossKeyText = BuildCountReq(LACS_REWARDS_HINT, LACSRewardCount);
+  } else if (settings->GanonsBossKey.Is(GANONSBOSSKEY_LACS_REWARDS)) {
+    ganonBossKeyText = BuildCountReq(LACS_REWARDS_HINT, settings->LACSRewardCount);
 
-  } else if (GanonsBossKey.Is(GANONSBOSSKEY_LACS_DUNGEONS)) {
-    ganonBossKeyText = BuildCountReq(LACS_DUNGEONS_HINT, LACSDungeonCount);
+  } else if (settings->GanonsBossKey.Is(GANONSBOSSKEY_LACS_DUNGEONS)) {
+    ganonBossKeyText = BuildCountReq(LACS_DUNGEONS_HINT, settings->LACSDungeonCount);
 
-  } else if (GanonsBossKey.Is(GANONSBOSSKEY_LACS_TOKENS)) {
-    ganonBossKeyText = BuildCountReq(LACS_TOKENS_HINT, LACSTokenCount);
+  } else if (settings->GanonsBossKey.Is(GANONSBOSSKEY_LACS_TOKENS)) {
+    ganonBossKeyText = BuildCountReq(LACS_TOKENS_HINT, settings->LACSTokenCount);
 
-  } else if (GanonsBossKey.Is(GANONSBOSSKEY_TRIFORCE_HUNT)) {
+  } else if (settings->GanonsBossKey.Is(GANONSBOSSKEY_TRIFORCE_HUNT)) {
     ganonBossKeyText = Hint(GANON_BK_TRIFORCE_HINT).GetText();
   }
 
@@ -759,42 +737,42 @@ static Text BuildGanonBossKeyText() {
 void CreateAltarText() {
 
   //Child Altar Text
-  if (AltarHintText) {
-    childAltarText = Hint(SPIRITUAL_STONE_TEXT_START).GetText()+"^"+
+  if (settings->AltarHintText) {
+    world->childAltarText = Hint(SPIRITUAL_STONE_TEXT_START).GetText()+"^"+
     //Spiritual Stones
-        (StartingKokiriEmerald.Value<uint8_t>() ? Text{ "##", "##", "##" }
+        (settings->StartingKokiriEmerald.Value<uint8_t>() ? Text{ "##", "##", "##" }
                                                 : BuildDungeonRewardText(KOKIRI_EMERALD)) +
-        (StartingGoronRuby.Value<uint8_t>() ? Text{ "##", "##", "##" }
+        (settings->StartingGoronRuby.Value<uint8_t>() ? Text{ "##", "##", "##" }
                                             : BuildDungeonRewardText(GORON_RUBY)) +
-        (StartingZoraSapphire.Value<uint8_t>() ? Text{ "##", "##", "##" }
+        (settings->StartingZoraSapphire.Value<uint8_t>() ? Text{ "##", "##", "##" }
                                               : BuildDungeonRewardText(ZORA_SAPPHIRE)) +
     //How to open Door of Time, the event trigger is necessary to read the altar multiple times
     BuildDoorOfTimeText();
   } else {
-    childAltarText = BuildDoorOfTimeText();
+    world->childAltarText = BuildDoorOfTimeText();
   }
 
-  CreateMessageFromTextObject(0x7040, 0, 2, 3, AddColorsAndFormat(childAltarText, {QM_GREEN, QM_RED, QM_BLUE}));
+  CreateMessageFromTextObject(0x7040, 0, 2, 3, AddColorsAndFormat(world->childAltarText, {QM_GREEN, QM_RED, QM_BLUE}));
 
   //Adult Altar Text
-  adultAltarText = Hint(ADULT_ALTAR_TEXT_START).GetText() + "^";
-  if (AltarHintText) {
-    adultAltarText = adultAltarText +
+  world->adultAltarText = Hint(ADULT_ALTAR_TEXT_START).GetText() + "^";
+  if (settings->AltarHintText) {
+    world->adultAltarText = world->adultAltarText +
     //Medallion Areas
-        (StartingLightMedallion.Value<uint8_t>() ? Text{ "##", "##", "##" }
+        (settings->StartingLightMedallion.Value<uint8_t>() ? Text{ "##", "##", "##" }
                                                 : BuildDungeonRewardText(LIGHT_MEDALLION)) +
-        (StartingForestMedallion.Value<uint8_t>() ? Text{ "##", "##", "##" }
+        (settings->StartingForestMedallion.Value<uint8_t>() ? Text{ "##", "##", "##" }
                                                   : BuildDungeonRewardText(FOREST_MEDALLION)) +
-        (StartingFireMedallion.Value<uint8_t>() ? Text{ "##", "##", "##" }
+        (settings->StartingFireMedallion.Value<uint8_t>() ? Text{ "##", "##", "##" }
                                                 : BuildDungeonRewardText(FIRE_MEDALLION)) +
-        (StartingWaterMedallion.Value<uint8_t>() ? Text{ "##", "##", "##" }
+        (settings->StartingWaterMedallion.Value<uint8_t>() ? Text{ "##", "##", "##" }
                                                 : BuildDungeonRewardText(WATER_MEDALLION)) +
-        (StartingSpiritMedallion.Value<uint8_t>() ? Text{ "##", "##", "##" }
+        (settings->StartingSpiritMedallion.Value<uint8_t>() ? Text{ "##", "##", "##" }
                                                   : BuildDungeonRewardText(SPIRIT_MEDALLION)) +
-        (StartingShadowMedallion.Value<uint8_t>() ? Text{ "##", "##", "##" }
+        (settings->StartingShadowMedallion.Value<uint8_t>() ? Text{ "##", "##", "##" }
                                                   : BuildDungeonRewardText(SHADOW_MEDALLION));
   }
-  adultAltarText = adultAltarText + 
+  world->adultAltarText = world->adultAltarText + 
   //Bridge requirement
   BuildBridgeReqsText()+
 
@@ -803,7 +781,7 @@ void CreateAltarText() {
 
   //End
   Hint(ADULT_ALTAR_TEXT_END).GetText();
-  CreateMessageFromTextObject(0x7088, 0, 2, 3, AddColorsAndFormat(adultAltarText, {QM_RED, QM_YELLOW, QM_GREEN, QM_RED, QM_BLUE, QM_YELLOW, QM_PINK, QM_RED, QM_RED, QM_RED, QM_RED}));
+  CreateMessageFromTextObject(0x7088, 0, 2, 3, AddColorsAndFormat(world->adultAltarText, {QM_RED, QM_YELLOW, QM_GREEN, QM_RED, QM_BLUE, QM_YELLOW, QM_PINK, QM_RED, QM_RED, QM_RED, QM_RED}));
 }
 
 void CreateMerchantsHints() {
@@ -827,14 +805,14 @@ void CreateMerchantsHints() {
 }
 
 void CreateDampesDiaryText() {
-  if (!DampeHintText) {
-    dampesText = Text();
-    dampeHintLoc = "";
+  if (!settings->DampeHintText) {
+    world->dampesText = Text();
+    world->dampeHintLoc = "";
     return;
   }
 
   uint32_t item = PROGRESSIVE_HOOKSHOT;
-  uint32_t location = FilterFromPool(allLocations, [item](const uint32_t loc){return Location(loc)->GetPlaceduint32_t() == item;})[0];
+  uint32_t location = FilterFromPool(world->allLocations, [item](const uint32_t loc){return Location(loc)->GetPlaceduint32_t() == item;})[0];
   Text area = GetHintRegion(Location(location)->GetParentRegionKey())->GetHint().GetText();
   Text temp1 = Text{
     "Whoever reads this, please enter %r", 
@@ -848,17 +826,17 @@ void CreateDampesDiaryText() {
     "%w. Ihm gebe ich meinen langen, kurzen Schatz.^Ich warte!&Boris"
   };
   
-  dampesText = temp1 + area + temp2;
-  dampeHintLoc = Location(location)->GetName();
+  world->dampesText = temp1 + area + temp2;
+  world->dampeHintLoc = Location(location)->GetName();
 }
 
 void CreateGregRupeeHint() {
-  if (!GregHintText) {
-    gregText = Text();
+  if (!settings->GregHintText) {
+    world->gregText = Text();
     return;
   }
 
-  uint32_t location = FilterFromPool(allLocations, [](const uint32_t loc){return Location(loc)->GetPlacedItemKey() == GREG_RUPEE;})[0];
+  uint32_t location = FilterFromPool(world->allLocations, [](const uint32_t loc){return Location(loc)->GetPlacedItemKey() == GREG_RUPEE;})[0];
   Text area = GetHintRegion(Location(location)->GetParentRegionKey())->GetHint().GetText();
 
   Text temp1 = Text{
@@ -873,13 +851,13 @@ void CreateGregRupeeHint() {
     ""
   };
 
-    gregText = temp1 + area + temp2;
+    world->gregText = temp1 + area + temp2;
 }
 
 void CreateSheikText() {
   //Get the location of the light arrows
-  auto lightArrowLocation = FilterFromPool(allLocations, [](const uint32_t loc){return Location(loc)->GetPlaceduint32_t() == LIGHT_ARROWS;});
-  lightArrowHintLoc = Location(lightArrowLocation[0])->GetName();
+  auto lightArrowLocation = FilterFromPool(world->allLocations, [](const uint32_t loc){return Location(loc)->GetPlaceduint32_t() == LIGHT_ARROWS;});
+  world->lightArrowHintLoc = Location(lightArrowLocation[0])->GetName();
   Text area = GetHintRegion(Location(lightArrowLocation[0])->GetParentRegionKey())->GetHint().GetText();
   Text temp1 = Text{
     "I overheard Ganondorf say that he misplaced the %yLight Arrows%w in %r",
@@ -887,25 +865,25 @@ void CreateSheikText() {
     ""
   };
   Text temp2 = Text{"%w.", "%w.", "%w."};
-  sheikText = temp1 + area + temp2;
-  if (ShuffleMasterSword) {
-    sheikText = sheikText + "^";
-    auto masterSwordLocation = FilterFromPool(allLocations, [](const uint32_t loc){return Location(loc)->GetPlaceduint32_t() == MASTER_SWORD;});
-    masterSwordHintLoc = Location(masterSwordLocation[0])->GetName();
+  world->sheikText = temp1 + area + temp2;
+  if (settings->ShuffleMasterSword) {
+    world->sheikText = world->sheikText + "^";
+    auto masterSwordLocation = FilterFromPool(world->allLocations, [](const uint32_t loc){return Location(loc)->GetPlaceduint32_t() == MASTER_SWORD;});
+    world->masterSwordHintLoc = Location(masterSwordLocation[0])->GetName();
     area = GetHintRegion(Location(masterSwordLocation[0])->GetParentRegionKey())->GetHint().GetText();
     Text temp3 = Text{
       "I also heard that he stole %rthe Master Sword%w and hid it somewhere within %g",
       "Test",
       "Test"
     };
-    sheikText = sheikText + temp3 + area + temp2;
+    world->sheikText = world->sheikText + temp3 + area + temp2;
   }
 }
 
 void CreateSariaText() {
   //Get the location of the light arrows
-  auto magicLocation = FilterFromPool(allLocations, [](const uint32_t loc){return Location(loc)->GetPlaceduint32_t() == PROGRESSIVE_MAGIC_METER;});
-  sariaHintLoc = Location(magicLocation[0])->GetName();
+  auto magicLocation = FilterFromPool(world->allLocations, [](const uint32_t loc){return Location(loc)->GetPlaceduint32_t() == PROGRESSIVE_MAGIC_METER;});
+  world->sariaHintLoc = Location(magicLocation[0])->GetName();
   Text area = GetHintRegion(Location(magicLocation[0])->GetParentRegionKey())->GetHint().GetText();
   Text temp1 = Text{
     "Did you feel the %gsurge of magic%w recently? A mysterious bird told me it came from %r",
@@ -917,18 +895,18 @@ void CreateSariaText() {
     "%w. Tu devrais aller y jeter un coup d'oeil, @!$C", 
     "%w.$C"
   };
-  sariaText = temp1 + area + temp2;
+  world->sariaText = temp1 + area + temp2;
 }
 
 
 void CreateWarpSongTexts() {
-  if (!ShuffleWarpSongs) {
-    warpMinuetText = Text();
-    warpBoleroText = Text();
-    warpSerenadeText = Text();
-    warpRequiemText = Text();
-    warpNocturneText = Text();
-    warpPreludeText = Text();
+  if (!settings->ShuffleWarpSongs) {
+    world->warpMinuetText = Text();
+    world->warpBoleroText = Text();
+    world->warpSerenadeText = Text();
+    world->warpRequiemText = Text();
+    world->warpNocturneText = Text();
+    world->warpPreludeText = Text();
     return;
   }
 
@@ -948,22 +926,22 @@ void CreateWarpSongTexts() {
 
     switch (entrance->GetIndex()) {
       case 0x0600: // minuet
-        warpMinuetText = resolvedHint;
+        world->warpMinuetText = resolvedHint;
         break;
       case 0x04F6: // bolero
-        warpBoleroText = resolvedHint;
+        world->warpBoleroText = resolvedHint;
         break;
       case 0x0604: // serenade
-        warpSerenadeText = resolvedHint;
+        world->warpSerenadeText = resolvedHint;
         break;
       case 0x01F1: // requiem
-        warpRequiemText = resolvedHint;
+        world->warpRequiemText = resolvedHint;
         break;
       case 0x0568: // nocturne
-        warpNocturneText = resolvedHint;
+        world->warpNocturneText = resolvedHint;
         break;
       case 0x05F4: // prelude
-        warpPreludeText = resolvedHint;
+        world->warpPreludeText = resolvedHint;
         break;
     }
   }
@@ -972,7 +950,7 @@ void CreateWarpSongTexts() {
 void CreateAllHints() {
 
   SPDLOG_DEBUG("\nNOW CREATING HINTS\n");
-  const HintSetting& hintSetting = hintSettingTable[Settings::HintDistribution.Value<uint8_t>()];
+  const HintSetting& hintSetting = hintSettingTable[settings->HintDistribution.Value<uint8_t>()];
 
   uint8_t remainingDungeonWothHints = hintSetting.dungeonsWothLimit;
   uint8_t remainingDungeonBarrenHints = hintSetting.dungeonsBarrenLimit;
@@ -980,10 +958,10 @@ void CreateAllHints() {
   // Add 'always' location hints
   if (hintSetting.distTable[static_cast<int>(HINT_TYPE_ALWAYS)].copies > 0) {
     // Only filter locations that had a random item placed at them (e.g. don't get cow locations if shuffle cows is off)
-    auto alwaysHintLocations = FilterFromPool(allLocations, [](const uint32_t loc){
+    auto alwaysHintLocations = FilterFromPool(world->allLocations, [](const uint32_t loc){
         return ((Location(loc)->GetHint().GetType() == HintCategory::Always) ||
                 // If we have Rainbow Bridge set to Greg, add a hint for where Greg is
-                (Bridge.Is(RAINBOWBRIDGE_GREG) && !GregHintText && Location(loc)->GetPlacedItemKey() == GREG_RUPEE)) &&
+                (settings->Bridge.Is(RAINBOWBRIDGE_GREG) && !settings->GregHintText && Location(loc)->GetPlacedItemKey() == GREG_RUPEE)) &&
                Location(loc)->IsHintable()        && !(Location(loc)->IsHintedAt());
     });
 
@@ -1037,7 +1015,7 @@ void CreateAllHints() {
 
   //Get list of all woth dungeons
   std::vector<std::string> wothDungeons;
-  for (uint32_t wothLocation : wothLocations) {
+  for (uint32_t wothLocation : world->wothLocations) {
     std::string wothRegion = GetHintRegion(Location(wothLocation)->GetParentRegionKey())->scene;
     bool isDungeon = std::find(dungeonNames.begin(), dungeonNames.end(), wothRegion) != dungeonNames.end();
     //If it hasn't already been added to the list and is a dungeon, add to list
@@ -1051,14 +1029,14 @@ void CreateAllHints() {
   }
 
   //Set DungeonInfo array for each dungeon
-  for (uint32_t i = 0; i < dungeonInfoData.size(); i++) {
+  for (uint32_t i = 0; i < world->dungeonInfoData.size(); i++) {
     std::string dungeonName = dungeonNames[i];
     if (std::find(barrenDungeons.begin(), barrenDungeons.end(), dungeonName) != barrenDungeons.end()) {
-      dungeonInfoData[i] = DungeonInfo::DUNGEON_BARREN;
+      world->dungeonInfoData[i] = DungeonInfo::DUNGEON_BARREN;
     } else if (std::find(wothDungeons.begin(), wothDungeons.end(), dungeonName) != wothDungeons.end()) {
-      dungeonInfoData[i] = DungeonInfo::DUNGEON_WOTH;
+      world->dungeonInfoData[i] = DungeonInfo::DUNGEON_WOTH;
     } else {
-      dungeonInfoData[i] = DungeonInfo::DUNGEON_NEITHER;
+      world->dungeonInfoData[i] = DungeonInfo::DUNGEON_NEITHER;
     }
   }
 
@@ -1085,7 +1063,7 @@ void CreateAllHints() {
       CreateBarrenHint(&remainingDungeonBarrenHints, barrenLocations);
 
     } else if (type == HINT_TYPE_SOMETIMES){
-      std::vector<uint32_t> sometimesHintLocations = FilterFromPool(allLocations, [](const uint32_t loc){return Location(loc)->GetHint().GetType() == HintCategory::Sometimes && Location(loc)->IsHintable() && !(Location(loc)->IsHintedAt());});
+      std::vector<uint32_t> sometimesHintLocations = FilterFromPool(world->allLocations, [](const uint32_t loc){return Location(loc)->GetHint().GetType() == HintCategory::Sometimes && Location(loc)->IsHintable() && !(Location(loc)->IsHintedAt());});
       CreateLocationHint(sometimesHintLocations);
 
     } else if (type == HINT_TYPE_RANDOM) {
@@ -1095,15 +1073,15 @@ void CreateAllHints() {
       CreateGoodItemHint();
 
     } else if (type == HINT_TYPE_SONG){
-      std::vector<uint32_t> songHintLocations = FilterFromPool(allLocations, [](const uint32_t loc){return Location(loc)->IsCategory(Category::cSong) && Location(loc)->IsHintable() && !(Location(loc)->IsHintedAt());});
+      std::vector<uint32_t> songHintLocations = FilterFromPool(world->allLocations, [](const uint32_t loc){return Location(loc)->IsCategory(Category::cSong) && Location(loc)->IsHintable() && !(Location(loc)->IsHintedAt());});
       CreateLocationHint(songHintLocations);
 
     } else if (type == HINT_TYPE_OVERWORLD){
-      std::vector<uint32_t> overworldHintLocations = FilterFromPool(allLocations, [](const uint32_t loc){return Location(loc)->IsOverworld() && Location(loc)->IsHintable() && !(Location(loc)->IsHintedAt());});
+      std::vector<uint32_t> overworldHintLocations = FilterFromPool(world->allLocations, [](const uint32_t loc){return Location(loc)->IsOverworld() && Location(loc)->IsHintable() && !(Location(loc)->IsHintedAt());});
       CreateLocationHint(overworldHintLocations);
 
     } else if (type == HINT_TYPE_DUNGEON){
-      std::vector<uint32_t> dungeonHintLocations = FilterFromPool(allLocations, [](const uint32_t loc){return Location(loc)->IsDungeon() && Location(loc)->IsHintable() && !(Location(loc)->IsHintedAt());});
+      std::vector<uint32_t> dungeonHintLocations = FilterFromPool(world->allLocations, [](const uint32_t loc){return Location(loc)->IsDungeon() && Location(loc)->IsHintable() && !(Location(loc)->IsHintedAt());});
       CreateLocationHint(dungeonHintLocations);
 
     } else if (type == HINT_TYPE_JUNK) {
@@ -1120,5 +1098,5 @@ void CreateAllHints() {
   //Getting gossip stone locations temporarily sets one location to not be reachable.
   //Call the function one last time to get rid of false positives on locations not
   //being reachable.
-  GetAccessibleLocations({});
+  GetAccessibleLocations(*world, {});
 }
@@ -159,9 +159,9 @@ public:
     }
 
     const Text& GetText() const {
-        if (Settings::ClearerHints.Is(HINTMODE_OBSCURE)) {
+        if (settings->ClearerHints.Is(HINTMODE_OBSCURE)) {
             return GetObscure();
-        } else if (Settings::ClearerHints.Is(HINTMODE_AMBIGUOUS)){
+        } else if (settings->ClearerHints.Is(HINTMODE_AMBIGUOUS)){
             return GetAmbiguous();
         } else {
             return GetClear();
@@ -169,9 +169,9 @@ public:
     }
 
     const Text GetTextCopy() const {
-        if (Settings::ClearerHints.Is(HINTMODE_OBSCURE)) {
+        if (settings->ClearerHints.Is(HINTMODE_OBSCURE)) {
             return GetObscure();
-        } else if (Settings::ClearerHints.Is(HINTMODE_AMBIGUOUS)){
+        } else if (settings->ClearerHints.Is(HINTMODE_AMBIGUOUS)){
             return GetAmbiguous();
         } else {
             return GetClear();
@@ -200,9 +200,6 @@ private:
 
 using ConditionalAlwaysHint = std::pair<uint32_t, std::function<bool()>>;
 
-//10 dungeons as GTG and GC are excluded
-extern std::array<DungeonInfo, 10> dungeonInfoData;
-
 extern std::array<ConditionalAlwaysHint, 9> conditionalAlwaysHints;
 
 extern uint32_t GetHintRegionHintKey(const uint32_t area);
@@ -1,4 +1,5 @@
 #include "item.hpp"
+#include "world.hpp"
 
 #include <array>
 
@@ -9,7 +10,7 @@
 #include "settings.hpp"
 #include "z64item.h"
 
-Item::Item(RandomizerGet randomizerGet_, Text name_, ItemType type_, int getItemId_, bool advancement_, bool* logicVar_, uint32_t hintKey_,
+Item::Item(RandomizerGet randomizerGet_, Text name_, ItemType type_, int getItemId_, bool advancement_, bool Logic::Vars::* logicVar_, uint32_t hintKey_,
            uint16_t price_)
     : randomizerGet(randomizerGet_),
       name(std::move(name_)),
@@ -20,7 +21,7 @@ Item::Item(RandomizerGet randomizerGet_, Text name_, ItemType type_, int getItem
       hintKey(hintKey_),
       price(price_) {}
 
-Item::Item(RandomizerGet randomizerGet_, Text name_, ItemType type_, int getItemId_, bool advancement_, uint8_t* logicVar_, uint32_t hintKey_,
+Item::Item(RandomizerGet randomizerGet_, Text name_, ItemType type_, int getItemId_, bool advancement_, uint8_t Logic::Vars::* logicVar_, uint32_t hintKey_,
            uint16_t price_)
     : randomizerGet(randomizerGet_),
       name(std::move(name_)),
@@ -36,30 +37,30 @@ Item::~Item() = default;
 void Item::ApplyEffect() {
     //If this is a key ring, logically add as many keys as we could need
     if (FOREST_TEMPLE_KEY_RING <= hintKey && hintKey <= GANONS_CASTLE_KEY_RING) {
-        *std::get<uint8_t*>(logicVar) += 10;
+        logic->*std::get<uint8_t Logic::Vars::*>(logicVar) += 10;
     }
     else {
-        if (std::holds_alternative<bool*>(logicVar)) {
-            *std::get<bool*>(logicVar) = true;
+        if (std::holds_alternative<bool Logic::Vars::*>(logicVar)) {
+            logic->*std::get<bool Logic::Vars::*>(logicVar) = true;
         } else {
-            *std::get<uint8_t*>(logicVar) += 1;
+            logic->*std::get<uint8_t Logic::Vars::*>(logicVar) += 1;
         }
     }
-    Logic::UpdateHelpers();
+    logic->UpdateHelpers();
 }
 
 void Item::UndoEffect() {
     if (FOREST_TEMPLE_KEY_RING <= hintKey && hintKey <= GANONS_CASTLE_KEY_RING) {
-        *std::get<uint8_t*>(logicVar) -= 10;
+        logic->*std::get<uint8_t Logic::Vars::*>(logicVar) -= 10;
     }
     else {
-        if (std::holds_alternative<bool*>(logicVar)) {
-            *std::get<bool*>(logicVar) = false;
+        if (std::holds_alternative<bool Logic::Vars::*>(logicVar)) {
+            logic->*std::get<bool Logic::Vars::*>(logicVar) = false;
         } else {
-            *std::get<uint8_t*>(logicVar) -= 1;
+            logic->*std::get<uint8_t Logic::Vars::*>(logicVar) -= 1;
         }
     }
-    Logic::UpdateHelpers();
+    logic->UpdateHelpers();
 }
 
 ItemOverride_Value Item::Value() const {
@@ -68,7 +69,7 @@ ItemOverride_Value Item::Value() const {
     val.all = 0;
     val.itemId = getItemId;
     if (getItemId == GI_ICE_TRAP) {
-        val.looksLikeItemId = RandomElement(IceTrapModels);
+        val.looksLikeItemId = RandomElement(world->IceTrapModels);
     }
     if (getItemId >= 0x95 && getItemId <= 0x9A) { //Boss keys
         val.looksLikeItemId = GI_KEY_BOSS;
@@ -5,6 +5,7 @@
 
 #include "keys.hpp"
 #include "hint_list.hpp"
+#include "logic.hpp"
 #include "settings.hpp"
 #include "../randomizerTypes.h"
 
@@ -29,9 +30,9 @@ enum ItemType {
 class Item {
 public:
     Item() = default;
-  Item(RandomizerGet randomizerGet_, Text name_, ItemType type_, int getItemId_, bool advancement_, bool* logicVar_, uint32_t hintKey_,
+  Item(RandomizerGet randomizerGet_, Text name_, ItemType type_, int getItemId_, bool advancement_, bool Logic::Vars::* logicVar_, uint32_t hintKey_,
        uint16_t price_ = 0);
-    Item(RandomizerGet randomizerGet_, Text name_, ItemType type_, int getItemId_, bool advancement_, uint8_t* logicVar_, uint32_t hintKey_,
+    Item(RandomizerGet randomizerGet_, Text name_, ItemType type_, int getItemId_, bool advancement_, uint8_t Logic::Vars::* logicVar_, uint32_t hintKey_,
          uint16_t price_ = 0);
     ~Item();
 
@@ -85,18 +86,18 @@ public:
     bool IsMajorItem() const {
         using namespace Settings;
         if (type == ITEMTYPE_TOKEN) {
-            return Bridge.Is(RAINBOWBRIDGE_TOKENS) || LACSCondition == LACSCONDITION_TOKENS;
+            return settings->Bridge.Is(RAINBOWBRIDGE_TOKENS) || settings->LACSCondition == LACSCONDITION_TOKENS;
         }
 
         if (type == ITEMTYPE_DROP || type == ITEMTYPE_EVENT || type == ITEMTYPE_SHOP || type == ITEMTYPE_MAP || type == ITEMTYPE_COMPASS) {
             return false;
         }
 
-        if (type == ITEMTYPE_DUNGEONREWARD && (ShuffleRewards.Is(REWARDSHUFFLE_END_OF_DUNGEON))) {
+        if (type == ITEMTYPE_DUNGEONREWARD && (settings->ShuffleRewards.Is(REWARDSHUFFLE_END_OF_DUNGEON))) {
             return false;
         }
 
-        if ((randomizerGet == RG_BOMBCHU_5 || randomizerGet == RG_BOMBCHU_10 || randomizerGet == RG_BOMBCHU_20) && !BombchusInLogic) {
+        if ((randomizerGet == RG_BOMBCHU_5 || randomizerGet == RG_BOMBCHU_10 || randomizerGet == RG_BOMBCHU_20) && !settings->BombchusInLogic) {
             return false;
         }
 
@@ -104,24 +105,24 @@ public:
             return false;
         }
 
-        if (type == ITEMTYPE_SMALLKEY && (Keysanity.Is(KEYSANITY_VANILLA) || Keysanity.Is(KEYSANITY_OWN_DUNGEON))) {
+        if (type == ITEMTYPE_SMALLKEY && (settings->Keysanity.Is(KEYSANITY_VANILLA) || settings->Keysanity.Is(KEYSANITY_OWN_DUNGEON))) {
             return false;
         }
 
-        if (type == ITEMTYPE_FORTRESS_SMALLKEY && GerudoKeys.Is(GERUDOKEYS_VANILLA)) {
+        if (type == ITEMTYPE_FORTRESS_SMALLKEY && settings->GerudoKeys.Is(GERUDOKEYS_VANILLA)) {
             return false;
         }
 
-        if ((type == ITEMTYPE_BOSSKEY && getItemId != 0xAD) && (BossKeysanity.Is(BOSSKEYSANITY_VANILLA) || BossKeysanity.Is(BOSSKEYSANITY_OWN_DUNGEON))) {
+        if ((type == ITEMTYPE_BOSSKEY && getItemId != 0xAD) && (settings->BossKeysanity.Is(BOSSKEYSANITY_VANILLA) || settings->BossKeysanity.Is(BOSSKEYSANITY_OWN_DUNGEON))) {
             return false;
         }
             //Ganons Castle Boss Key
-        if (getItemId == 0xAD && (GanonsBossKey.Is(GANONSBOSSKEY_VANILLA) || GanonsBossKey.Is(GANONSBOSSKEY_OWN_DUNGEON))) {
+        if (getItemId == 0xAD && (settings->GanonsBossKey.Is(GANONSBOSSKEY_VANILLA) || settings->GanonsBossKey.Is(GANONSBOSSKEY_OWN_DUNGEON))) {
             return false;
         }
 
         if (randomizerGet == RG_GREG_RUPEE) {
-            return Bridge.Is(RAINBOWBRIDGE_GREG);
+            return settings->Bridge.Is(RAINBOWBRIDGE_GREG);
         }
 
         return IsAdvancement();
@@ -149,7 +150,8 @@ private:
     ItemType type;
     int  getItemId;
     bool advancement;
-    std::variant<bool*, uint8_t*> logicVar;
+    //The logic variable the item sets, in whichever logic is installed when it is applied
+    std::variant<bool Logic::Vars::*, uint8_t Logic::Vars::*> logicVar;
     uint32_t hintKey;
     uint16_t price;
     bool playthrough = false;
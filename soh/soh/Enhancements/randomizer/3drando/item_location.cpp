@@ -5,14 +5,18 @@
 #include "spoiler_log.hpp"
 #include "shops.hpp"
 #include "keys.hpp"
+#include "world.hpp"
+#include "utils.hpp"
+#include <mutex>
 #include <spdlog/spdlog.h>
 #include "../randomizerTypes.h"
 
-//Location definitions
-static std::array<ItemLocation, KEY_ENUM_MAX> locationTable;
+//Where each check is in the location table. It's the same in every world, so it's only built once.
 static std::unordered_map<RandomizerCheck, Key> locationLookupTable;
 
+//Location definitions
 void LocationTable_Init() {
+    auto& locationTable = world->locationTable;
     locationTable[NONE]                                  = ItemLocation::Base       (RC_UNKNOWN_CHECK,                              0xFF,       "Invalid Location",                     NONE,                                  NONE,                      {},                                                   SpoilerCollectionCheck::None());
     //Kokiri Forest                                                                                                                 scene flag  name                                    hint key (hint_list.cpp)               vanilla item               categories                                            collection check (if needed)                     collection check group
     locationTable[KF_KOKIRI_SWORD_CHEST]                 = ItemLocation::Chest      (RC_KF_KOKIRI_SWORD_CHEST,                      0x55, 0x00, "KF Kokiri Sword Chest",                KF_KOKIRI_SWORD_CHEST,                 KOKIRI_SWORD,              {},                                                                                                    SpoilerCollectionCheckGroup::GROUP_KOKIRI_FOREST);
@@ -920,8 +924,11 @@ void LocationTable_Init() {
     locationTable[GANONDORF_HINT]                        = ItemLocation::OtherHint(RC_GANONDORF_HINT,                  "Ganondorf Hint");
     locationTable[TRIFORCE_COMPLETED]                    = ItemLocation::Reward (RC_TRIFORCE_COMPLETED, 0xFF, "Completed Triforce", NONE, NONE, {}, SpoilerCollectionCheck::None(), SpoilerCollectionCheckGroup::GROUP_NO_GROUP);
 
-    for (int i = NONE; i != KEY_ENUM_MAX; i++)
-        locationLookupTable.insert(std::make_pair(locationTable[i].GetRandomizerCheck(), static_cast<Key>(i)));
+    static std::once_flag lookupTableBuilt;
+    std::call_once(lookupTableBuilt, [&locationTable] {
+        for (int i = NONE; i != KEY_ENUM_MAX; i++)
+            locationLookupTable.insert(std::make_pair(locationTable[i].GetRandomizerCheck(), static_cast<Key>(i)));
+    });
 }
 
 std::vector<uint32_t> KF_ShopLocations = {
@@ -1489,48 +1496,35 @@ std::vector<uint32_t> overworldLocations = {
 };
 
 ItemLocation* Location(uint32_t locKey) {
-    return &(locationTable[locKey]);
+    return &(world->locationTable[locKey]);
 }
 
 ItemLocation* Location(RandomizerCheck rc) {
-    return &(locationTable[locationLookupTable[rc]]);
+    //Checks missing from the table get the invalid location, without adding them to the shared lookup table
+    auto lookup = locationLookupTable.find(rc);
+    return &(world->locationTable[lookup != locationLookupTable.end() ? lookup->second : NONE]);
 }
 
-std::vector<uint32_t> allLocations = {};
-std::vector<uint32_t> everyPossibleLocation = {};
-
-//set of overrides to write to the patch
-std::set<ItemOverride, ItemOverride_Compare> overrides = {};
-std::unordered_map<RandomizerCheck, uint8_t> iceTrapModels = {};
-
-std::vector<std::vector<uint32_t>> playthroughLocations;
-std::vector<uint32_t> wothLocations;
-bool playthroughBeatable = false;
-bool allLocationsReachable = false;
-bool showItemProgress = false;
-
-uint16_t itemsPlaced = 0;
-
-void AddLocation(uint32_t loc, std::vector<uint32_t>* destination = &allLocations) {
+void AddLocation(uint32_t loc, std::vector<uint32_t>* destination = &world->allLocations) {
   destination->push_back(loc);
 }
 
 template <typename Container>
-void AddLocations(const Container& locations, std::vector<uint32_t>* destination = &allLocations) {
+void AddLocations(const Container& locations, std::vector<uint32_t>* destination = &world->allLocations) {
   destination->insert(destination->end(), std::cbegin(locations), std::cend(locations));
 }
 
 //sort through Vanilla and MQ dungeon locations
 void GenerateLocationPool() {
 
-  allLocations.clear();
+  world->allLocations.clear();
   AddLocation(LINKS_POCKET);
-  if (Settings::TriforceHunt.Is(TRIFORCE_HUNT_ON)) {
+  if (settings->TriforceHunt.Is(TRIFORCE_HUNT_ON)) {
     AddLocation(TRIFORCE_COMPLETED);
   }
   AddLocations(overworldLocations);
 
-  for (auto dungeon : Dungeon::dungeonList) {
+  for (auto dungeon : world->dungeons.dungeonList) {
     AddLocations(dungeon->GetDungeonLocations());
   }
 }
@@ -1543,24 +1537,24 @@ void PlaceItemInLocation(uint32_t locKey, uint32_t item, bool applyEffectImmedia
   SPDLOG_DEBUG(loc->GetName());
   SPDLOG_DEBUG("\n\n");
 
-  if (applyEffectImmediately || Settings::Logic.Is(LOGIC_NONE) || Settings::Logic.Is(LOGIC_VANILLA)) {
+  if (applyEffectImmediately || settings->Logic.Is(LOGIC_NONE) || settings->Logic.Is(LOGIC_VANILLA)) {
     ItemTable(item).ApplyEffect();
   }
 
-  itemsPlaced++;
-  if (showItemProgress) {
-    double completion = (double) itemsPlaced / (double)(allLocations.size() + dungeonRewardLocations.size());
+  world->itemsPlaced++;
+  if (world->showItemProgress) {
+    double completion = (double) world->itemsPlaced / (double)(world->allLocations.size() + dungeonRewardLocations.size());
     std::string message = "\x1b[8;10HPlacing Items.";
     message += completion > 0.25 ? "." : " ";
     message += completion > 0.50 ? "." : " ";
-    printf("%s", message.c_str());
+    PrintProgress("%s", message.c_str());
   }
 
   //If we're placing a non-shop item in a shop location, we want to record it for custom messages
   if (ItemTable(item).GetItemType() != ITEMTYPE_SHOP && loc->IsCategory(Category::cShop)) {
     int index = TransformShopIndex(GetShopIndex(locKey));
-    NonShopItems[index].Name = ItemTable(item).GetName();
-    NonShopItems[index].Repurchaseable = ItemTable(item).GetItemType() == ITEMTYPE_REFILL || ItemTable(item).GetHintKey() == PROGRESSIVE_BOMBCHUS;
+    world->NonShopItems[index].Name = ItemTable(item).GetName();
+    world->NonShopItems[index].Repurchaseable = ItemTable(item).GetItemType() == ITEMTYPE_REFILL || ItemTable(item).GetHintKey() == PROGRESSIVE_BOMBCHUS;
   }
 
   loc->SetPlacedItem(item);
@@ -1580,23 +1574,11 @@ std::vector<uint32_t> GetLocations(const std::vector<uint32_t>& locationPool, Ca
 }
 
 void LocationReset() {
-  for (uint32_t il : allLocations) {
-    Location(il)->RemoveFromPool();
-  }
-
-  for (uint32_t il : dungeonRewardLocations) {
-    Location(il)->RemoveFromPool();
-  }
-
-  for (uint32_t il : gossipStoneLocations) {
-    Location(il)->RemoveFromPool();
-  }
-
-  Location(GANONDORF_HINT)->RemoveFromPool();
+  logic->locationsInPool.reset();
 }
 
 void ItemReset() {
-  for (uint32_t il : allLocations) {
+  for (uint32_t il : world->allLocations) {
     Location(il)->ResetVariables();
   }
 
@@ -1604,7 +1586,7 @@ void ItemReset() {
     Location(il)->ResetVariables();
   }
 
-  itemsPlaced = 0;
+  world->itemsPlaced = 0;
 }
 
 void HintReset() {
@@ -1616,31 +1598,31 @@ void HintReset() {
 //Fills everyPossibleLocation and creates an exclusion option for each location.
 //everyPossibleLocation is used in the menu to lock/hide excluding locations
 void AddExcludedOptions() {
-  AddLocations(overworldLocations, &everyPossibleLocation);
+  AddLocations(overworldLocations, &world->everyPossibleLocation);
 
-  for (auto dungeon : Dungeon::dungeonList) {
-    AddLocations(dungeon->GetEveryLocation(), &everyPossibleLocation);
+  for (auto dungeon : world->dungeons.dungeonList) {
+    AddLocations(dungeon->GetEveryLocation(), &world->everyPossibleLocation);
   }
 
-  for (uint32_t il: everyPossibleLocation) {
+  for (uint32_t il: world->everyPossibleLocation) {
     Location(il)->AddExcludeOption();
   }
 }
 
 void CreateItemOverrides() {
     SPDLOG_DEBUG("NOW CREATING OVERRIDES\n\n");
-    for (uint32_t locKey : allLocations) {
+    for (uint32_t locKey : world->allLocations) {
         auto loc = Location(locKey);
         ItemOverride_Value val = ItemTable(loc->GetPlaceduint32_t()).Value();
         // If this is an ice trap, store the disguise model in iceTrapModels
         if (loc->GetPlaceduint32_t() == ICE_TRAP) {
-            iceTrapModels[loc->GetRandomizerCheck()] = val.looksLikeItemId;
+            world->iceTrapModels[loc->GetRandomizerCheck()] = val.looksLikeItemId;
             // If this is ice trap is in a shop, change the name based on what the model will look like
             if (loc->IsCategory(Category::cShop)) {
-                NonShopItems[TransformShopIndex(GetShopIndex(locKey))].Name = GetIceTrapName(val.looksLikeItemId);
+                world->NonShopItems[TransformShopIndex(GetShopIndex(locKey))].Name = GetIceTrapName(val.looksLikeItemId);
             }
         }
-        overrides.insert({
+        world->overrides.insert({
             .key = loc->Key(),
             .value = val,
         });
@@ -1655,5 +1637,5 @@ void CreateItemOverrides() {
         SPDLOG_DEBUG("\n");
     }
     SPDLOG_DEBUG("Overrides Created: ");
-    SPDLOG_DEBUG(std::to_string(overrides.size()));
+    SPDLOG_DEBUG(std::to_string(world->overrides.size()));
 }
@@ -195,22 +195,10 @@ public:
       return scene;
     }
 
-    bool IsAddedToPool() const {
-      return addedToPool;
-    }
-
-    void AddToPool() {
-      addedToPool = true;
-    }
-
     uint32_t GetHintKey() const {
         return hintKey;
     }
 
-    void RemoveFromPool() {
-      addedToPool = false;
-    }
-
     const std::string& GetName() const {
       return name;
     }
@@ -393,13 +381,13 @@ public:
       
       // RANDOTODO: this without string compares and loops
       bool alreadyAdded = false;
-      for(const Option* location : Settings::excludeLocationsOptionsVector[collectionCheckGroup]) {
+      for(const Option* location : settings->excludeLocationsOptionsVector[collectionCheckGroup]) {
         if (location->GetName() == excludedOption.GetName()) {
           alreadyAdded = true;
         }
       }
       if (!alreadyAdded) {
-        Settings::excludeLocationsOptionsVector[collectionCheckGroup].push_back(&excludedOption);
+        settings->excludeLocationsOptionsVector[collectionCheckGroup].push_back(&excludedOption);
       }
     }
 
@@ -449,7 +437,6 @@ public:
 
     void ResetVariables() {
       checked = false;
-      addedToPool = false;
       placedItem = NONE;
       delayedItem = NONE;
       hintedAt = false;
@@ -471,7 +458,6 @@ private:
     uint32_t vanillaItem = NONE;
     bool hintedAt = false;
     std::vector<Category> categories;
-    bool addedToPool = false;
     uint32_t placedItem = NONE;
     uint32_t hintedLocation = NONE;
     HintType hintType;
@@ -508,20 +494,6 @@ extern std::vector<uint32_t> gossipStoneLocations;
 
 extern std::vector<uint32_t> dungeonRewardLocations;
 extern std::vector<uint32_t> overworldLocations;
-extern std::vector<uint32_t> allLocations;
-extern std::vector<uint32_t> everyPossibleLocation;
-
-//set of overrides to write to the patch
-extern std::set<ItemOverride, ItemOverride_Compare> overrides;
-extern std::unordered_map<RandomizerCheck, uint8_t> iceTrapModels;
-
-extern std::vector<std::vector<uint32_t>> playthroughLocations;
-extern std::vector<uint32_t> wothLocations;
-extern bool playthroughBeatable;
-extern bool allLocationsReachable;
-extern bool showItemProgress;
-
-extern uint16_t itemsPlaced;
 
 void GenerateLocationPool();
 void PlaceItemInLocation(uint32_t loc, uint32_t item, bool applyEffectImmediately = false, bool setHidden = false);
@@ -9,15 +9,13 @@
 #include "settings.hpp"
 #include "spoiler_log.hpp"
 #include "z64item.h"
+#include "world.hpp"
 #include <spdlog/spdlog.h>
 
 
 using namespace Settings;
 using namespace Dungeon;
 
-std::vector<uint32_t> ItemPool = {};
-std::vector<uint32_t> PendingJunkPool = {};
-std::vector<uint8_t> IceTrapModels = {};
 const std::array<uint32_t, 9> dungeonRewards = {
   KOKIRI_EMERALD,
   GORON_RUBY,
@@ -424,7 +422,7 @@ static void AddItemsToPool(std::vector<uint32_t>& toPool, const FromPool& fromPo
 }
 
 static void AddItemToMainPool(const uint32_t item, size_t count = 1) {
-  ItemPool.insert(ItemPool.end(), count, item);
+  world->ItemPool.insert(world->ItemPool.end(), count, item);
 }
 
 static void AddRandomBottle(std::vector<uint32_t>& bottlePool) {
@@ -432,9 +430,9 @@ static void AddRandomBottle(std::vector<uint32_t>& bottlePool) {
 }
 
 uint32_t GetJunkItem() {
-  if (IceTrapValue.Is(ICETRAPS_MAYHEM) || IceTrapValue.Is(ICETRAPS_ONSLAUGHT)) {
+  if (settings->IceTrapValue.Is(ICETRAPS_MAYHEM) || settings->IceTrapValue.Is(ICETRAPS_ONSLAUGHT)) {
     return ICE_TRAP;
-  } else if (IceTrapValue.Is(ICETRAPS_EXTRA)) {
+  } else if (settings->IceTrapValue.Is(ICETRAPS_EXTRA)) {
       return RandomElement(JunkPoolItems);
   }
   //Ice Trap is the last item in JunkPoolItems, so subtract 1 to never hit that index
@@ -443,20 +441,20 @@ uint32_t GetJunkItem() {
 }
 
 static uint32_t GetPendingJunkItem() {
-  if (PendingJunkPool.empty()) {
+  if (world->PendingJunkPool.empty()) {
     return GetJunkItem();
   }
 
-  return RandomElement(PendingJunkPool, true);
+  return RandomElement(world->PendingJunkPool, true);
 }
 
 //Replace junk items in the pool with pending junk
 static void ReplaceMaxItem(const uint32_t itemToReplace, int max) {
   int itemCount = 0;
-  for (size_t i = 0; i < ItemPool.size(); i++) {
-    if (ItemPool[i] == itemToReplace) {
+  for (size_t i = 0; i < world->ItemPool.size(); i++) {
+    if (world->ItemPool[i] == itemToReplace) {
       if (itemCount >= max) {
-        ItemPool[i] = GetJunkItem();
+        world->ItemPool[i] = GetJunkItem();
       }
       itemCount++;
     }
@@ -465,10 +463,10 @@ static void ReplaceMaxItem(const uint32_t itemToReplace, int max) {
 
 void PlaceJunkInExcludedLocation(const uint32_t il) {
   //place a non-advancement item in this location
-  for (size_t i = 0; i < ItemPool.size(); i++) {
-    if (!ItemTable(ItemPool[i]).IsAdvancement()) {
-      PlaceItemInLocation(il, ItemPool[i]);
-      ItemPool.erase(ItemPool.begin() + i);
+  for (size_t i = 0; i < world->ItemPool.size(); i++) {
+    if (!ItemTable(world->ItemPool[i]).IsAdvancement()) {
+      PlaceItemInLocation(il, world->ItemPool[i]);
+      world->ItemPool.erase(world->ItemPool.begin() + i);
       return;
     }
   }
@@ -502,10 +500,10 @@ static void PlaceVanillaDekuScrubItems() {
     PlaceItemInLocation(LLR_DEKU_SCRUB_GROTTO_CENTER,          DEKU_SEEDS_30, false, true);
 
     //Dungeon Scrubs
-    if (DekuTree.IsMQ()) {
+    if (world->dungeons.DekuTree.IsMQ()) {
       PlaceItemInLocation(DEKU_TREE_MQ_DEKU_SCRUB, DEKU_SHIELD, false, true);
     }
-    if (DodongosCavern.IsMQ()) {
+    if (world->dungeons.DodongosCavern.IsMQ()) {
       PlaceItemInLocation(DODONGOS_CAVERN_MQ_DEKU_SCRUB_LOBBY_REAR,                    DEKU_STICK_1, false, true);
       PlaceItemInLocation(DODONGOS_CAVERN_MQ_DEKU_SCRUB_LOBBY_FRONT,                   DEKU_SEEDS_30, false, true);
       PlaceItemInLocation(DODONGOS_CAVERN_MQ_DEKU_SCRUB_STAIRCASE,                     DEKU_SHIELD, false, true);
@@ -516,10 +514,10 @@ static void PlaceVanillaDekuScrubItems() {
       PlaceItemInLocation(DODONGOS_CAVERN_DEKU_SCRUB_NEAR_BOMB_BAG_RIGHT,     DEKU_SEEDS_30, false, true);
       PlaceItemInLocation(DODONGOS_CAVERN_DEKU_SCRUB_LOBBY,                   DEKU_SHIELD, false, true);
     }
-    if (JabuJabusBelly.IsVanilla()) {
+    if (world->dungeons.JabuJabusBelly.IsVanilla()) {
       PlaceItemInLocation(JABU_JABUS_BELLY_DEKU_SCRUB, DEKU_NUTS_5);
     }
-    if (GanonsCastle.IsMQ()) {
+    if (world->dungeons.GanonsCastle.IsMQ()) {
       PlaceItemInLocation(GANONS_CASTLE_MQ_DEKU_SCRUB_LEFT,         GREEN_POTION_REFILL, false, true);
       PlaceItemInLocation(GANONS_CASTLE_MQ_DEKU_SCRUB_CENTER_LEFT,  BOMBS_5, false, true);
       PlaceItemInLocation(GANONS_CASTLE_MQ_DEKU_SCRUB_CENTER,       ARROWS_30, false, true);
@@ -536,20 +534,20 @@ static void PlaceVanillaDekuScrubItems() {
 }
 
 static void PlaceVanillaMapsAndCompasses() {
-  for (auto dungeon : dungeonList) {
+  for (auto dungeon : world->dungeons.dungeonList) {
     dungeon->PlaceVanillaMap();
     dungeon->PlaceVanillaCompass();
   }
 }
 
 static void PlaceVanillaSmallKeys() {
-  for (auto dungeon : dungeonList) {
+  for (auto dungeon : world->dungeons.dungeonList) {
     dungeon->PlaceVanillaSmallKeys();
   }
 }
 
 static void PlaceVanillaBossKeys() {
-  for (auto dungeon : dungeonList) {
+  for (auto dungeon : world->dungeons.dungeonList) {
     dungeon->PlaceVanillaBossKey();
   }
 }
@@ -565,7 +563,7 @@ static void PlaceVanillaCowMilk() {
   PlaceItemInLocation(LLR_TOWER_LEFT_COW,    MILK, false, true);
   PlaceItemInLocation(LLR_TOWER_RIGHT_COW,   MILK, false, true);
 
-  if (JabuJabusBelly.IsMQ()) {
+  if (world->dungeons.JabuJabusBelly.IsMQ()) {
     PlaceItemInLocation(JABU_JABUS_BELLY_MQ_COW, MILK, false, true);
   }
 }
@@ -600,16 +598,16 @@ static void SetMinimalItemPool() {
   ReplaceMaxItem(PROGRESSIVE_BOMB_BAG, 1);
   ReplaceMaxItem(PIECE_OF_HEART, 0);
   // Need an extra heart container when starting with 1 heart to be able to reach 3 hearts
-  ReplaceMaxItem(HEART_CONTAINER, (StartingHearts.Value<uint8_t>() == 18)? 1 : 0);
+  ReplaceMaxItem(HEART_CONTAINER, (settings->StartingHearts.Value<uint8_t>() == 18)? 1 : 0);
 }
 
 void GenerateItemPool() {
 
-  ItemPool.clear();
-  PendingJunkPool.clear();
+  world->ItemPool.clear();
+  world->PendingJunkPool.clear();
 
   //Initialize ice trap models to always major items
-  IceTrapModels = {
+  world->IceTrapModels = {
     GI_SHIELD_MIRROR,
     GI_BOOMERANG,
     GI_LENS,
@@ -635,37 +633,37 @@ void GenerateItemPool() {
     0x8A, //Progressive magic
   };
   //Check song shuffle and dungeon reward shuffle just for ice traps
-  if (ShuffleSongs.Is(SONGSHUFFLE_ANYWHERE)) {
+  if (settings->ShuffleSongs.Is(SONGSHUFFLE_ANYWHERE)) {
     //Push item ids for songs
-    IceTrapModels.push_back(0xC1);
-    IceTrapModels.push_back(0xC2);
-    IceTrapModels.push_back(0xC3);
-    IceTrapModels.push_back(0xC4);
-    IceTrapModels.push_back(0xC5);
-    IceTrapModels.push_back(0xC6);
-    IceTrapModels.push_back(0xBB);
-    IceTrapModels.push_back(0xBC);
-    IceTrapModels.push_back(0xBD);
-    IceTrapModels.push_back(0xBE);
-    IceTrapModels.push_back(0xBF);
-    IceTrapModels.push_back(0xC0);
+    world->IceTrapModels.push_back(0xC1);
+    world->IceTrapModels.push_back(0xC2);
+    world->IceTrapModels.push_back(0xC3);
+    world->IceTrapModels.push_back(0xC4);
+    world->IceTrapModels.push_back(0xC5);
+    world->IceTrapModels.push_back(0xC6);
+    world->IceTrapModels.push_back(0xBB);
+    world->IceTrapModels.push_back(0xBC);
+    world->IceTrapModels.push_back(0xBD);
+    world->IceTrapModels.push_back(0xBE);
+    world->IceTrapModels.push_back(0xBF);
+    world->IceTrapModels.push_back(0xC0);
   }
-  if (ShuffleRewards.Is(REWARDSHUFFLE_ANYWHERE)) {
+  if (settings->ShuffleRewards.Is(REWARDSHUFFLE_ANYWHERE)) {
     //Push item ids for dungeon rewards
-    IceTrapModels.push_back(0xCB);
-    IceTrapModels.push_back(0xCC);
-    IceTrapModels.push_back(0xCD);
-    IceTrapModels.push_back(0xCE);
-    IceTrapModels.push_back(0xCF);
-    IceTrapModels.push_back(0xD0);
-    IceTrapModels.push_back(0xD1);
-    IceTrapModels.push_back(0xD2);
-    IceTrapModels.push_back(0xD3);
+    world->IceTrapModels.push_back(0xCB);
+    world->IceTrapModels.push_back(0xCC);
+    world->IceTrapModels.push_back(0xCD);
+    world->IceTrapModels.push_back(0xCE);
+    world->IceTrapModels.push_back(0xCF);
+    world->IceTrapModels.push_back(0xD0);
+    world->IceTrapModels.push_back(0xD1);
+    world->IceTrapModels.push_back(0xD2);
+    world->IceTrapModels.push_back(0xD3);
   }
 
-  if (TriforceHunt.Is(TRIFORCE_HUNT_ON)) {
-    IceTrapModels.push_back(0xDF);
-    AddItemToMainPool(TRIFORCE_PIECE, Settings::TriforceHuntTotal.Value<uint8_t>());
+  if (settings->TriforceHunt.Is(TRIFORCE_HUNT_ON)) {
+    world->IceTrapModels.push_back(0xDF);
+    AddItemToMainPool(TRIFORCE_PIECE, settings->TriforceHuntTotal.Value<uint8_t>());
     PlaceItemInLocation(TRIFORCE_COMPLETED, TRIFORCE); // Win condition
     PlaceItemInLocation(GANON, GetJunkItem(), false, true);
   } else {
@@ -676,66 +674,66 @@ void GenerateItemPool() {
   PlaceItemInLocation(HC_ZELDAS_LETTER, ZELDAS_LETTER);
   PlaceItemInLocation(MARKET_BOMBCHU_BOWLING_BOMBCHUS, BOMBCHU_DROP);
 
-  if (ShuffleKokiriSword) {
+  if (settings->ShuffleKokiriSword) {
     AddItemToMainPool(KOKIRI_SWORD);
-    IceTrapModels.push_back(GI_SWORD_KOKIRI);
+    world->IceTrapModels.push_back(GI_SWORD_KOKIRI);
   } else {
     PlaceItemInLocation(KF_KOKIRI_SWORD_CHEST, KOKIRI_SWORD, false, true);
   }
 
-  if (ShuffleMasterSword) {
+  if (settings->ShuffleMasterSword) {
     AddItemToMainPool(MASTER_SWORD);
-    IceTrapModels.push_back(0xE0); //Master Sword without the GI enum
+    world->IceTrapModels.push_back(0xE0); //Master Sword without the GI enum
   } else {
     PlaceItemInLocation(TOT_MASTER_SWORD, MASTER_SWORD, false, true);
   }
 
-  if (ShuffleWeirdEgg) {
+  if (settings->ShuffleWeirdEgg) {
     AddItemToMainPool(WEIRD_EGG);
-    IceTrapModels.push_back(GI_WEIRD_EGG);
+    world->IceTrapModels.push_back(GI_WEIRD_EGG);
   } else {
     PlaceItemInLocation(HC_MALON_EGG, WEIRD_EGG, false, true);
   }
 
-  if (ShuffleOcarinas) {
+  if (settings->ShuffleOcarinas) {
     AddItemToMainPool(PROGRESSIVE_OCARINA, 2);
-    if (ItemPoolValue.Is(ITEMPOOL_PLENTIFUL)) {
-      AddItemToPool(PendingJunkPool, PROGRESSIVE_OCARINA);
+    if (settings->ItemPoolValue.Is(ITEMPOOL_PLENTIFUL)) {
+      AddItemToPool(world->PendingJunkPool, PROGRESSIVE_OCARINA);
     }
-    IceTrapModels.push_back(0x8B); //Progressive ocarina
+    world->IceTrapModels.push_back(0x8B); //Progressive ocarina
   } else {
     PlaceItemInLocation(LW_GIFT_FROM_SARIA, PROGRESSIVE_OCARINA, false, true);
     PlaceItemInLocation(HF_OCARINA_OF_TIME_ITEM, PROGRESSIVE_OCARINA, false, true);
   }
 
-  if (ShuffleCows) {
+  if (settings->ShuffleCows) {
     //9 total cow locations
     for (uint8_t i = 0; i < 9; i++) {
       AddItemToMainPool(GetJunkItem());
     }
     //extra location for Jabu MQ
-    if (JabuJabusBelly.IsMQ()) {
+    if (world->dungeons.JabuJabusBelly.IsMQ()) {
       AddItemToMainPool(GetJunkItem());
     }
   } else {
     PlaceVanillaCowMilk();
   }
 
-  if (ShuffleMagicBeans) {
+  if (settings->ShuffleMagicBeans) {
     AddItemToMainPool(MAGIC_BEAN_PACK);
-    if (ItemPoolValue.Is(ITEMPOOL_PLENTIFUL)) {
-      AddItemToPool(PendingJunkPool, MAGIC_BEAN_PACK);
+    if (settings->ItemPoolValue.Is(ITEMPOOL_PLENTIFUL)) {
+      AddItemToPool(world->PendingJunkPool, MAGIC_BEAN_PACK);
     }
-    IceTrapModels.push_back(0xC9); //Magic bean pack
+    world->IceTrapModels.push_back(0xC9); //Magic bean pack
   } else {
     PlaceItemInLocation(ZR_MAGIC_BEAN_SALESMAN, MAGIC_BEAN, false, true);
   }
 
-  if (ShuffleMerchants.IsNot(SHUFFLEMERCHANTS_OFF)) {
-    if (!ProgressiveGoronSword) {
+  if (settings->ShuffleMerchants.IsNot(SHUFFLEMERCHANTS_OFF)) {
+    if (!settings->ProgressiveGoronSword) {
       AddItemToMainPool(GIANTS_KNIFE);
     }
-    if (BombchusInLogic) {
+    if (settings->BombchusInLogic) {
       AddItemToMainPool(PROGRESSIVE_BOMBCHUS);
     } else {
       AddItemToMainPool(BOMBCHU_10);
@@ -746,7 +744,7 @@ void GenerateItemPool() {
     PlaceItemInLocation(WASTELAND_BOMBCHU_SALESMAN, BOMBCHU_10, false, true);
   }
 
-  if (ShuffleFrogSongRupees) {
+  if (settings->ShuffleFrogSongRupees) {
     AddItemToMainPool(PURPLE_RUPEE, 5);
   } else {
     PlaceItemInLocation(ZR_FROGS_ZELDAS_LULLABY, PURPLE_RUPEE, false, true);
@@ -756,7 +754,7 @@ void GenerateItemPool() {
     PlaceItemInLocation(ZR_FROGS_SONG_OF_TIME, PURPLE_RUPEE, false, true);
   }
 
-  if (ShuffleAdultTradeQuest) {
+  if (settings->ShuffleAdultTradeQuest) {
     AddItemToMainPool(POCKET_EGG);
     AddItemToMainPool(COJIRO);
     AddItemToMainPool(ODD_MUSHROOM);
@@ -779,9 +777,9 @@ void GenerateItemPool() {
   }
   AddItemToMainPool(CLAIM_CHECK);
 
-  if (ShuffleChestMinigame.Is(SHUFFLECHESTMINIGAME_SINGLE_KEYS)) {
+  if (settings->ShuffleChestMinigame.Is(SHUFFLECHESTMINIGAME_SINGLE_KEYS)) {
     AddItemToMainPool(TREASURE_GAME_SMALL_KEY, 6); // 6 individual keys
-  } else if (ShuffleChestMinigame.Is(SHUFFLECHESTMINIGAME_PACK)) {
+  } else if (settings->ShuffleChestMinigame.Is(SHUFFLECHESTMINIGAME_PACK)) {
     AddItemToMainPool(TREASURE_GAME_SMALL_KEY); // 1 key which will behave as a pack of 6
   } else {
     PlaceItemInLocation(MARKET_TREASURE_CHEST_GAME_ITEM_1, TREASURE_GAME_SMALL_KEY, false, true);
@@ -791,20 +789,20 @@ void GenerateItemPool() {
     PlaceItemInLocation(MARKET_TREASURE_CHEST_GAME_ITEM_5, TREASURE_GAME_SMALL_KEY, false, true);
   };
 
-  if (Tokensanity.Is(TOKENSANITY_OFF)) {
-    for (uint32_t loc : GetLocations(allLocations, Category::cSkulltula)) {
+  if (settings->Tokensanity.Is(TOKENSANITY_OFF)) {
+    for (uint32_t loc : GetLocations(world->allLocations, Category::cSkulltula)) {
       PlaceItemInLocation(loc, GOLD_SKULLTULA_TOKEN, false, true);
     }
-  } else if (Tokensanity.Is(TOKENSANITY_DUNGEONS)) {
-    for (uint32_t loc : GetLocations(allLocations, Category::cSkulltula)) {
+  } else if (settings->Tokensanity.Is(TOKENSANITY_DUNGEONS)) {
+    for (uint32_t loc : GetLocations(world->allLocations, Category::cSkulltula)) {
       if (Location(loc)->IsOverworld()) {
         PlaceItemInLocation(loc, GOLD_SKULLTULA_TOKEN, false, true);
       } else {
         AddItemToMainPool(GOLD_SKULLTULA_TOKEN);
       }
     }
-  } else if (Tokensanity.Is(TOKENSANITY_OVERWORLD)) {
-    for (uint32_t loc : GetLocations(allLocations, Category::cSkulltula)) {
+  } else if (settings->Tokensanity.Is(TOKENSANITY_OVERWORLD)) {
+    for (uint32_t loc : GetLocations(world->allLocations, Category::cSkulltula)) {
       if (Location(loc)->IsDungeon()) {
         PlaceItemInLocation(loc, GOLD_SKULLTULA_TOKEN, false, true);
       } else {
@@ -815,16 +813,16 @@ void GenerateItemPool() {
     AddItemToMainPool(GOLD_SKULLTULA_TOKEN, 100);
   }
 
-  if (Shuffle100GSReward) {
-    if (Tokensanity.IsNot(TOKENSANITY_OFF) && ItemPoolValue.Is(ITEMPOOL_PLENTIFUL)) {
-      AddItemToPool(PendingJunkPool, GOLD_SKULLTULA_TOKEN, 10);
+  if (settings->Shuffle100GSReward) {
+    if (settings->Tokensanity.IsNot(TOKENSANITY_OFF) && settings->ItemPoolValue.Is(ITEMPOOL_PLENTIFUL)) {
+      AddItemToPool(world->PendingJunkPool, GOLD_SKULLTULA_TOKEN, 10);
     }
     AddItemToMainPool(HUGE_RUPEE);
   } else {
     PlaceItemInLocation(KAK_100_GOLD_SKULLTULA_REWARD, HUGE_RUPEE, false, true);
   }
 
-  if (BombchusInLogic) {
+  if (settings->BombchusInLogic) {
     AddItemToMainPool(PROGRESSIVE_BOMBCHUS, 5);
   } else {
     AddItemToMainPool(BOMBCHU_5);
@@ -834,28 +832,28 @@ void GenerateItemPool() {
 
   //Ice Traps
   AddItemToMainPool(ICE_TRAP);
-  if (GerudoTrainingGrounds.IsVanilla()) {
+  if (world->dungeons.GerudoTrainingGrounds.IsVanilla()) {
     AddItemToMainPool(ICE_TRAP);
   }
-  if (GanonsCastle.IsVanilla()) {
+  if (world->dungeons.GanonsCastle.IsVanilla()) {
     AddItemToMainPool(ICE_TRAP, 4);
   }
 
   //Gerudo Fortress
-  if (GerudoFortress.Is(GERUDOFORTRESS_OPEN)) {
+  if (settings->GerudoFortress.Is(GERUDOFORTRESS_OPEN)) {
     PlaceItemInLocation(GF_NORTH_F1_CARPENTER, RECOVERY_HEART, false, true);
     PlaceItemInLocation(GF_NORTH_F2_CARPENTER, RECOVERY_HEART, false, true);
     PlaceItemInLocation(GF_SOUTH_F1_CARPENTER, RECOVERY_HEART, false, true);
     PlaceItemInLocation(GF_SOUTH_F2_CARPENTER, RECOVERY_HEART, false, true);
-  } else if (GerudoKeys.IsNot(GERUDOKEYS_VANILLA)) {
-    if (GerudoFortress.Is(GERUDOFORTRESS_FAST)) {
+  } else if (settings->GerudoKeys.IsNot(GERUDOKEYS_VANILLA)) {
+    if (settings->GerudoFortress.Is(GERUDOFORTRESS_FAST)) {
       AddItemToMainPool(GERUDO_FORTRESS_SMALL_KEY);
       PlaceItemInLocation(GF_NORTH_F2_CARPENTER, RECOVERY_HEART, false, true);
       PlaceItemInLocation(GF_SOUTH_F1_CARPENTER, RECOVERY_HEART, false, true);
       PlaceItemInLocation(GF_SOUTH_F2_CARPENTER, RECOVERY_HEART, false, true);
     } else {
       //Only add key ring if 4 Fortress keys necessary
-      if (RingFortress) {
+      if (settings->RingFortress) {
         AddItemToMainPool(GERUDO_FORTRESS_KEY_RING);
         //Add junk to make up for missing keys
         for (uint8_t i = 0; i < 3; i++) {
@@ -865,15 +863,15 @@ void GenerateItemPool() {
         AddItemToMainPool(GERUDO_FORTRESS_SMALL_KEY, 4);
       }
     }
-    if (ItemPoolValue.Is(ITEMPOOL_PLENTIFUL)) {
-      if (RingFortress && GerudoFortress.Is(GERUDOFORTRESS_NORMAL)) {
-        AddItemToPool(PendingJunkPool, GERUDO_FORTRESS_KEY_RING);
+    if (settings->ItemPoolValue.Is(ITEMPOOL_PLENTIFUL)) {
+      if (settings->RingFortress && settings->GerudoFortress.Is(GERUDOFORTRESS_NORMAL)) {
+        AddItemToPool(world->PendingJunkPool, GERUDO_FORTRESS_KEY_RING);
       } else {
-        AddItemToPool(PendingJunkPool, GERUDO_FORTRESS_SMALL_KEY);
+        AddItemToPool(world->PendingJunkPool, GERUDO_FORTRESS_SMALL_KEY);
       }
     }
   } else {
-    if (GerudoFortress.Is(GERUDOFORTRESS_FAST)) {
+    if (settings->GerudoFortress.Is(GERUDOFORTRESS_FAST)) {
       PlaceItemInLocation(GF_NORTH_F1_CARPENTER, GERUDO_FORTRESS_SMALL_KEY, false, true);
       PlaceItemInLocation(GF_NORTH_F2_CARPENTER, RECOVERY_HEART, false, true);
       PlaceItemInLocation(GF_SOUTH_F1_CARPENTER, RECOVERY_HEART, false, true);
@@ -887,11 +885,11 @@ void GenerateItemPool() {
   }
 
   //Gerudo Membership Card
-  if (ShuffleGerudoToken && GerudoFortress.IsNot(GERUDOFORTRESS_OPEN)) {
+  if (settings->ShuffleGerudoToken && settings->GerudoFortress.IsNot(GERUDOFORTRESS_OPEN)) {
     AddItemToMainPool(GERUDO_MEMBERSHIP_CARD);
-    IceTrapModels.push_back(GI_GERUDO_CARD);
-  } else if (ShuffleGerudoToken) {
-    AddItemToPool(PendingJunkPool, GERUDO_MEMBERSHIP_CARD);
+    world->IceTrapModels.push_back(GI_GERUDO_CARD);
+  } else if (settings->ShuffleGerudoToken) {
+    AddItemToPool(world->PendingJunkPool, GERUDO_MEMBERSHIP_CARD);
     PlaceItemInLocation(GF_GERUDO_MEMBERSHIP_CARD, ICE_TRAP, false, true);
   } else {
     PlaceItemInLocation(GF_GERUDO_MEMBERSHIP_CARD, GERUDO_MEMBERSHIP_CARD, false, true);
@@ -900,9 +898,9 @@ void GenerateItemPool() {
   //Keys
 
   //For key rings, need to add as many junk items as "missing" keys
-  if (KeyRings.IsNot(KEYRINGS_OFF)) {
+  if (settings->KeyRings.IsNot(KEYRINGS_OFF)) {
     uint8_t ringJunkAmt = 0;
-    for (auto dungeon : dungeonList) {
+    for (auto dungeon : world->dungeons.dungeonList) {
       if (dungeon->HasKeyRing()) {
         ringJunkAmt += dungeon->GetSmallKeyCount() - 1;
       }
@@ -912,93 +910,93 @@ void GenerateItemPool() {
     }
   }
 
-  if (ItemPoolValue.Is(ITEMPOOL_PLENTIFUL)) {
-    if (ShuffleGerudoToken) {
-      AddItemToPool(PendingJunkPool, GERUDO_MEMBERSHIP_CARD);
+  if (settings->ItemPoolValue.Is(ITEMPOOL_PLENTIFUL)) {
+    if (settings->ShuffleGerudoToken) {
+      AddItemToPool(world->PendingJunkPool, GERUDO_MEMBERSHIP_CARD);
     }
 
     //Plentiful small keys
-    if (Keysanity.Is(KEYSANITY_ANYWHERE) || Keysanity.Is(KEYSANITY_ANY_DUNGEON) || Keysanity.Is(KEYSANITY_OVERWORLD)) {
-      if (BottomOfTheWell.HasKeyRing()) {
-        AddItemToPool(PendingJunkPool, BOTTOM_OF_THE_WELL_KEY_RING);
+    if (settings->Keysanity.Is(KEYSANITY_ANYWHERE) || settings->Keysanity.Is(KEYSANITY_ANY_DUNGEON) || settings->Keysanity.Is(KEYSANITY_OVERWORLD)) {
+      if (world->dungeons.BottomOfTheWell.HasKeyRing()) {
+        AddItemToPool(world->PendingJunkPool, BOTTOM_OF_THE_WELL_KEY_RING);
       } else {
-        AddItemToPool(PendingJunkPool, BOTTOM_OF_THE_WELL_SMALL_KEY);
+        AddItemToPool(world->PendingJunkPool, BOTTOM_OF_THE_WELL_SMALL_KEY);
       }
-      if (ForestTemple.HasKeyRing()) {
-        AddItemToPool(PendingJunkPool, FOREST_TEMPLE_KEY_RING);
+      if (world->dungeons.ForestTemple.HasKeyRing()) {
+        AddItemToPool(world->PendingJunkPool, FOREST_TEMPLE_KEY_RING);
       } else {
-        AddItemToPool(PendingJunkPool, FOREST_TEMPLE_SMALL_KEY);
+        AddItemToPool(world->PendingJunkPool, FOREST_TEMPLE_SMALL_KEY);
       }
-      if (FireTemple.HasKeyRing()) {
-        AddItemToPool(PendingJunkPool, FIRE_TEMPLE_KEY_RING);
+      if (world->dungeons.FireTemple.HasKeyRing()) {
+        AddItemToPool(world->PendingJunkPool, FIRE_TEMPLE_KEY_RING);
       } else {
-        AddItemToPool(PendingJunkPool, FIRE_TEMPLE_SMALL_KEY);
+        AddItemToPool(world->PendingJunkPool, FIRE_TEMPLE_SMALL_KEY);
       }
-      if (WaterTemple.HasKeyRing()) {
-        AddItemToPool(PendingJunkPool, WATER_TEMPLE_KEY_RING);
+      if (world->dungeons.WaterTemple.HasKeyRing()) {
+        AddItemToPool(world->PendingJunkPool, WATER_TEMPLE_KEY_RING);
       } else {
-        AddItemToPool(PendingJunkPool, WATER_TEMPLE_SMALL_KEY);
+        AddItemToPool(world->PendingJunkPool, WATER_TEMPLE_SMALL_KEY);
       }
-      if (SpiritTemple.HasKeyRing()) {
-        AddItemToPool(PendingJunkPool, SPIRIT_TEMPLE_KEY_RING);
+      if (world->dungeons.SpiritTemple.HasKeyRing()) {
+        AddItemToPool(world->PendingJunkPool, SPIRIT_TEMPLE_KEY_RING);
       } else {
-        AddItemToPool(PendingJunkPool, SPIRIT_TEMPLE_SMALL_KEY);
+        AddItemToPool(world->PendingJunkPool, SPIRIT_TEMPLE_SMALL_KEY);
       }
-      if (ShadowTemple.HasKeyRing()) {
-        AddItemToPool(PendingJunkPool, SHADOW_TEMPLE_KEY_RING);
+      if (world->dungeons.ShadowTemple.HasKeyRing()) {
+        AddItemToPool(world->PendingJunkPool, SHADOW_TEMPLE_KEY_RING);
       } else {
-        AddItemToPool(PendingJunkPool, SHADOW_TEMPLE_SMALL_KEY);
+        AddItemToPool(world->PendingJunkPool, SHADOW_TEMPLE_SMALL_KEY);
       }
-      if (GerudoTrainingGrounds.HasKeyRing()) {
-        AddItemToPool(PendingJunkPool, GERUDO_TRAINING_GROUNDS_KEY_RING);
+      if (world->dungeons.GerudoTrainingGrounds.HasKeyRing()) {
+        AddItemToPool(world->PendingJunkPool, GERUDO_TRAINING_GROUNDS_KEY_RING);
       } else {
-        AddItemToPool(PendingJunkPool, GERUDO_TRAINING_GROUNDS_SMALL_KEY);
+        AddItemToPool(world->PendingJunkPool, GERUDO_TRAINING_GROUNDS_SMALL_KEY);
       }
-      if (GanonsCastle.HasKeyRing()) {
-        AddItemToPool(PendingJunkPool, GANONS_CASTLE_KEY_RING);
+      if (world->dungeons.GanonsCastle.HasKeyRing()) {
+        AddItemToPool(world->PendingJunkPool, GANONS_CASTLE_KEY_RING);
       } else {
-        AddItemToPool(PendingJunkPool, GANONS_CASTLE_SMALL_KEY);
+        AddItemToPool(world->PendingJunkPool, GANONS_CASTLE_SMALL_KEY);
       } 
     }
 
-    if (BossKeysanity.Is(BOSSKEYSANITY_ANYWHERE) || BossKeysanity.Is(BOSSKEYSANITY_ANY_DUNGEON) || BossKeysanity.Is(BOSSKEYSANITY_OVERWORLD)) {
-      AddItemToPool(PendingJunkPool, FOREST_TEMPLE_BOSS_KEY);
-      AddItemToPool(PendingJunkPool, FIRE_TEMPLE_BOSS_KEY);
-      AddItemToPool(PendingJunkPool, WATER_TEMPLE_BOSS_KEY);
-      AddItemToPool(PendingJunkPool, SPIRIT_TEMPLE_BOSS_KEY);
-      AddItemToPool(PendingJunkPool, SHADOW_TEMPLE_BOSS_KEY);
+    if (settings->BossKeysanity.Is(BOSSKEYSANITY_ANYWHERE) || settings->BossKeysanity.Is(BOSSKEYSANITY_ANY_DUNGEON) || settings->BossKeysanity.Is(BOSSKEYSANITY_OVERWORLD)) {
+      AddItemToPool(world->PendingJunkPool, FOREST_TEMPLE_BOSS_KEY);
+      AddItemToPool(world->PendingJunkPool, FIRE_TEMPLE_BOSS_KEY);
+      AddItemToPool(world->PendingJunkPool, WATER_TEMPLE_BOSS_KEY);
+      AddItemToPool(world->PendingJunkPool, SPIRIT_TEMPLE_BOSS_KEY);
+      AddItemToPool(world->PendingJunkPool, SHADOW_TEMPLE_BOSS_KEY);
     }
 
-    if (GanonsBossKey.Is(GANONSBOSSKEY_ANYWHERE) || GanonsBossKey.Is(GANONSBOSSKEY_ANY_DUNGEON) || GanonsBossKey.Is(GANONSBOSSKEY_OVERWORLD)) {
-      AddItemToPool(PendingJunkPool, GANONS_CASTLE_BOSS_KEY);
+    if (settings->GanonsBossKey.Is(GANONSBOSSKEY_ANYWHERE) || settings->GanonsBossKey.Is(GANONSBOSSKEY_ANY_DUNGEON) || settings->GanonsBossKey.Is(GANONSBOSSKEY_OVERWORLD)) {
+      AddItemToPool(world->PendingJunkPool, GANONS_CASTLE_BOSS_KEY);
     }
   }
 
   //Shopsanity
-  if (Settings::Shopsanity.Is(SHOPSANITY_OFF) || Settings::Shopsanity.Is(SHOPSANITY_ZERO)) {
-    AddItemsToPool(ItemPool, normalRupees);
+  if (settings->Shopsanity.Is(SHOPSANITY_OFF) || settings->Shopsanity.Is(SHOPSANITY_ZERO)) {
+    AddItemsToPool(world->ItemPool, normalRupees);
   } else { //Shopsanity 1-4, random
-    AddItemsToPool(ItemPool, shopsanityRupees); //Shopsanity gets extra large rupees
+    AddItemsToPool(world->ItemPool, shopsanityRupees); //Shopsanity gets extra large rupees
   }
 
   //Scrubsanity
-  if (Settings::Scrubsanity.IsNot(SCRUBSANITY_OFF)) {
+  if (settings->Scrubsanity.IsNot(SCRUBSANITY_OFF)) {
     //Deku Tree
-    if (DekuTree.IsMQ()) {
+    if (world->dungeons.DekuTree.IsMQ()) {
       AddItemToMainPool(DEKU_SHIELD);
     }
 
     //Dodongos Cavern
     AddItemToMainPool(DEKU_STICK_1);
     AddItemToMainPool(DEKU_SHIELD);
-    if (DodongosCavern.IsMQ()) {
+    if (world->dungeons.DodongosCavern.IsMQ()) {
       AddItemToMainPool(RECOVERY_HEART);
     } else {
       AddItemToMainPool(DEKU_NUTS_5);
     }
 
     //Jabu Jabus Belly
-    if (JabuJabusBelly.IsVanilla()) {
+    if (world->dungeons.JabuJabusBelly.IsVanilla()) {
       AddItemToMainPool(DEKU_NUTS_5);
     }
 
@@ -1006,12 +1004,12 @@ void GenerateItemPool() {
     AddItemToMainPool(BOMBS_5);
     AddItemToMainPool(RECOVERY_HEART);
     AddItemToMainPool(BLUE_RUPEE);
-    if (GanonsCastle.IsMQ()) {
+    if (world->dungeons.GanonsCastle.IsMQ()) {
       AddItemToMainPool(DEKU_NUTS_5);
     }
 
     //Overworld Scrubs
-    AddItemsToPool(ItemPool, dekuScrubItems);
+    AddItemsToPool(world->ItemPool, dekuScrubItems);
 
     //I'm not sure what this is for, but it was in ootr so I copied it
     for (uint8_t i = 0; i < 7; i++) {
@@ -1025,59 +1023,59 @@ void GenerateItemPool() {
     PlaceVanillaDekuScrubItems();
   }
 
-  AddItemsToPool(ItemPool, alwaysItems);
-  AddItemsToPool(ItemPool, dungeonRewards);
+  AddItemsToPool(world->ItemPool, alwaysItems);
+  AddItemsToPool(world->ItemPool, dungeonRewards);
 
   //Dungeon pools
-  if (DekuTree.IsMQ()) {
-    AddItemsToPool(ItemPool, DT_MQ);
+  if (world->dungeons.DekuTree.IsMQ()) {
+    AddItemsToPool(world->ItemPool, DT_MQ);
   } else {
-    AddItemsToPool(ItemPool, DT_Vanilla);
+    AddItemsToPool(world->ItemPool, DT_Vanilla);
   }
-  if (DodongosCavern.IsMQ()) {
-    AddItemsToPool(ItemPool, DC_MQ);
+  if (world->dungeons.DodongosCavern.IsMQ()) {
+    AddItemsToPool(world->ItemPool, DC_MQ);
   } else {
-    AddItemsToPool(ItemPool, DC_Vanilla);
+    AddItemsToPool(world->ItemPool, DC_Vanilla);
   }
-  if (JabuJabusBelly.IsMQ()) {
-    AddItemsToPool(ItemPool, JB_MQ);
+  if (world->dungeons.JabuJabusBelly.IsMQ()) {
+    AddItemsToPool(world->ItemPool, JB_MQ);
   }
-  if (ForestTemple.IsMQ()) {
-    AddItemsToPool(ItemPool, FoT_MQ);
+  if (world->dungeons.ForestTemple.IsMQ()) {
+    AddItemsToPool(world->ItemPool, FoT_MQ);
   } else {
-    AddItemsToPool(ItemPool, FoT_Vanilla);
+    AddItemsToPool(world->ItemPool, FoT_Vanilla);
   }
-  if (FireTemple.IsMQ()) {
-    AddItemsToPool(ItemPool, FiT_MQ);
+  if (world->dungeons.FireTemple.IsMQ()) {
+    AddItemsToPool(world->ItemPool, FiT_MQ);
   } else {
-    AddItemsToPool(ItemPool, FiT_Vanilla);
+    AddItemsToPool(world->ItemPool, FiT_Vanilla);
   }
-  if (SpiritTemple.IsMQ()) {
-    AddItemsToPool(ItemPool, SpT_MQ);
+  if (world->dungeons.SpiritTemple.IsMQ()) {
+    AddItemsToPool(world->ItemPool, SpT_MQ);
   } else {
-    AddItemsToPool(ItemPool, SpT_Vanilla);
+    AddItemsToPool(world->ItemPool, SpT_Vanilla);
   }
-  if (ShadowTemple.IsMQ()) {
-    AddItemsToPool(ItemPool, ShT_MQ);
+  if (world->dungeons.ShadowTemple.IsMQ()) {
+    AddItemsToPool(world->ItemPool, ShT_MQ);
   } else {
-    AddItemsToPool(ItemPool, ShT_Vanilla);
+    AddItemsToPool(world->ItemPool, ShT_Vanilla);
   }
-  if (BottomOfTheWell.IsVanilla()) {
-    AddItemsToPool(ItemPool, BW_Vanilla);
+  if (world->dungeons.BottomOfTheWell.IsVanilla()) {
+    AddItemsToPool(world->ItemPool, BW_Vanilla);
   }
-  if (GerudoTrainingGrounds.IsMQ()) {
-    AddItemsToPool(ItemPool, GTG_MQ);
+  if (world->dungeons.GerudoTrainingGrounds.IsMQ()) {
+    AddItemsToPool(world->ItemPool, GTG_MQ);
   } else {
-    AddItemsToPool(ItemPool, GTG_Vanilla);
+    AddItemsToPool(world->ItemPool, GTG_Vanilla);
   }
-  if (GanonsCastle.IsMQ()) {
-    AddItemsToPool(ItemPool, GC_MQ);
+  if (world->dungeons.GanonsCastle.IsMQ()) {
+    AddItemsToPool(world->ItemPool, GC_MQ);
   } else {
-    AddItemsToPool(ItemPool, GC_Vanilla);
+    AddItemsToPool(world->ItemPool, GC_Vanilla);
   }
 
   uint8_t rutoBottles = 1;
-  if (ZorasFountain.Is(ZORASFOUNTAIN_OPEN)) {
+  if (settings->ZorasFountain.Is(ZORASFOUNTAIN_OPEN)) {
     rutoBottles = 0;
   }
 
@@ -1085,10 +1083,10 @@ void GenerateItemPool() {
   uint8_t bottleCount = 4;
   std::vector<uint32_t> bottles;
   bottles.assign(normalBottles.begin(), normalBottles.end());
-  IceTrapModels.push_back(ItemTable(RandomElement(bottles)).GetItemID()); //Get one random bottle type for ice traps
+  world->IceTrapModels.push_back(ItemTable(RandomElement(bottles)).GetItemID()); //Get one random bottle type for ice traps
   for (uint8_t i = 0; i < bottleCount; i++) {
     if (i >= rutoBottles) {
-      if ((i == bottleCount - 1) && ShuffleMerchants.IsNot(SHUFFLEMERCHANTS_OFF)) {
+      if ((i == bottleCount - 1) && settings->ShuffleMerchants.IsNot(SHUFFLEMERCHANTS_OFF)) {
         AddItemToMainPool(BOTTLE_WITH_BLUE_POTION);
       } else {
         AddRandomBottle(bottles);
@@ -1099,9 +1097,9 @@ void GenerateItemPool() {
   }
 
   //add extra songs only if song shuffle is anywhere
-  AddItemsToPool(ItemPool, songList);
-  if (ShuffleSongs.Is(SONGSHUFFLE_ANYWHERE) && ItemPoolValue.Is(ITEMPOOL_PLENTIFUL)) {
-    AddItemsToPool(PendingJunkPool, songList);
+  AddItemsToPool(world->ItemPool, songList);
+  if (settings->ShuffleSongs.Is(SONGSHUFFLE_ANYWHERE) && settings->ItemPoolValue.Is(ITEMPOOL_PLENTIFUL)) {
+    AddItemsToPool(world->PendingJunkPool, songList);
   }
 
   /*For item pool generation, dungeon items are either placed in their vanilla
@@ -1111,10 +1109,10 @@ void GenerateItemPool() {
   | advancement items that haven't been placed yet for placing higher priority
   | items like stones/medallions.*/
 
-  if (MapsAndCompasses.Is(MAPSANDCOMPASSES_VANILLA)) {
+  if (settings->MapsAndCompasses.Is(MAPSANDCOMPASSES_VANILLA)) {
     PlaceVanillaMapsAndCompasses();
   } else  {
-    for (auto dungeon : dungeonList) {
+    for (auto dungeon : world->dungeons.dungeonList) {
       if (dungeon->GetMap() != NONE) {
         AddItemToMainPool(dungeon->GetMap());
       }
@@ -1125,11 +1123,11 @@ void GenerateItemPool() {
     }
   }
 
-  if (Keysanity.Is(KEYSANITY_VANILLA)) {
+  if (settings->Keysanity.Is(KEYSANITY_VANILLA)) {
     PlaceVanillaSmallKeys();
   } else {
-    for (auto dungeon : dungeonList) {
-      if (dungeon->HasKeyRing() && Keysanity.IsNot(KEYSANITY_START_WITH)) {
+    for (auto dungeon : world->dungeons.dungeonList) {
+      if (dungeon->HasKeyRing() && settings->Keysanity.IsNot(KEYSANITY_START_WITH)) {
         AddItemToMainPool(dungeon->GetKeyRing());
       } else {
         if (dungeon->GetSmallKeyCount() > 0) {
@@ -1139,7 +1137,7 @@ void GenerateItemPool() {
     }
   }
 
-  if (BossKeysanity.Is(BOSSKEYSANITY_VANILLA)) {
+  if (settings->BossKeysanity.Is(BOSSKEYSANITY_VANILLA)) {
     PlaceVanillaBossKeys();
   } else {
     AddItemToMainPool(FOREST_TEMPLE_BOSS_KEY);
@@ -1149,63 +1147,63 @@ void GenerateItemPool() {
     AddItemToMainPool(SHADOW_TEMPLE_BOSS_KEY);
   }
 
-  if (GanonsBossKey.Is(GANONSBOSSKEY_FINAL_GS_REWARD)) {
+  if (settings->GanonsBossKey.Is(GANONSBOSSKEY_FINAL_GS_REWARD)) {
     PlaceItemInLocation(KAK_100_GOLD_SKULLTULA_REWARD, GANONS_CASTLE_BOSS_KEY);
-  } else if (GanonsBossKey.Value<uint8_t>() >= GANONSBOSSKEY_LACS_VANILLA && GanonsBossKey.IsNot(GANONSBOSSKEY_TRIFORCE_HUNT)) {
+  } else if (settings->GanonsBossKey.Value<uint8_t>() >= GANONSBOSSKEY_LACS_VANILLA && settings->GanonsBossKey.IsNot(GANONSBOSSKEY_TRIFORCE_HUNT)) {
     PlaceItemInLocation(TOT_LIGHT_ARROWS_CUTSCENE, GANONS_CASTLE_BOSS_KEY);
-  } else if (GanonsBossKey.Is(GANONSBOSSKEY_VANILLA)) {
+  } else if (settings->GanonsBossKey.Is(GANONSBOSSKEY_VANILLA)) {
     PlaceItemInLocation(GANONS_TOWER_BOSS_KEY_CHEST, GANONS_CASTLE_BOSS_KEY);
   } else {
     AddItemToMainPool(GANONS_CASTLE_BOSS_KEY);
   }
 
-  if (ItemPoolValue.Is(ITEMPOOL_PLENTIFUL)) {
-    AddItemsToPool(ItemPool, easyItems);
+  if (settings->ItemPoolValue.Is(ITEMPOOL_PLENTIFUL)) {
+    AddItemsToPool(world->ItemPool, easyItems);
   } else {
-    AddItemsToPool(ItemPool, normalItems);
+    AddItemsToPool(world->ItemPool, normalItems);
   }
 
-  if (!ShuffleKokiriSword) {
+  if (!settings->ShuffleKokiriSword) {
     ReplaceMaxItem(KOKIRI_SWORD, 0);
   }
 
-  if (!ShuffleMasterSword) {
+  if (!settings->ShuffleMasterSword) {
     ReplaceMaxItem(MASTER_SWORD, 0);
   }
 
-  if (ProgressiveGoronSword) {
+  if (settings->ProgressiveGoronSword) {
     ReplaceMaxItem(BIGGORON_SWORD, 0);
     AddItemToMainPool(PROGRESSIVE_GORONSWORD, 2);
-    IceTrapModels.push_back(0xD4); // Progressive Goron Sword
+    world->IceTrapModels.push_back(0xD4); // Progressive Goron Sword
   } else {
-    IceTrapModels.push_back(GI_SWORD_BGS);
+    world->IceTrapModels.push_back(GI_SWORD_BGS);
   }
 
   //Replace ice traps with junk from the pending junk pool if necessary
-  if (IceTrapValue.Is(ICETRAPS_OFF)) {
+  if (settings->IceTrapValue.Is(ICETRAPS_OFF)) {
     ReplaceMaxItem(ICE_TRAP, 0);
   }
   //Replace all junk items with ice traps for onslaught mode
-  else if (IceTrapValue.Is(ICETRAPS_ONSLAUGHT)) {
+  else if (settings->IceTrapValue.Is(ICETRAPS_ONSLAUGHT)) {
     for (uint8_t i = 0; i < JunkPoolItems.size() - 3; i++) { // -3 Omits Huge Rupees and Deku Nuts 10
       ReplaceMaxItem(JunkPoolItems[i], 0);
     }
   }
 
-  if (ItemPoolValue.Is(ITEMPOOL_SCARCE)) {
+  if (settings->ItemPoolValue.Is(ITEMPOOL_SCARCE)) {
     SetScarceItemPool();
-  } else if (ItemPoolValue.Is(ITEMPOOL_MINIMAL)) {
+  } else if (settings->ItemPoolValue.Is(ITEMPOOL_MINIMAL)) {
     SetMinimalItemPool();
-  } else if (RemoveDoubleDefense) {
+  } else if (settings->RemoveDoubleDefense) {
     ReplaceMaxItem(DOUBLE_DEFENSE, 0);
   }
 
   //this feels ugly and there's probably a better way, but
   //it replaces random junk with pending junk.
   bool junkSet;
-  for (uint32_t pendingJunk : PendingJunkPool) {
+  for (uint32_t pendingJunk : world->PendingJunkPool) {
     junkSet = false;
-    for (uint32_t& item : ItemPool) {
+    for (uint32_t& item : world->ItemPool) {
       for (uint32_t junk : JunkPoolItems) {
         if (item == junk && item != HUGE_RUPEE && item != DEKU_NUTS_10) {
           item = pendingJunk;
@@ -1216,7 +1214,7 @@ void GenerateItemPool() {
       if (junkSet) break;
     }
   }
-  PendingJunkPool.clear();
+  world->PendingJunkPool.clear();
 }
 
 void AddJunk() {
@@ -13,6 +13,3 @@ uint32_t GetJunkItem();
 void PlaceJunkInExcludedLocation(const uint32_t il);
 void GenerateItemPool();
 void AddJunk();
-
-extern std::vector<uint32_t> ItemPool;
-extern std::vector<uint8_t> IceTrapModels;
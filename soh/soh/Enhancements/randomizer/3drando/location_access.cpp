@@ -9,6 +9,7 @@
 #include "spoiler_log.hpp"
 #include "trial.hpp"
 #include "entrance.hpp"
+#include "world.hpp"
 
 #include <fstream>
 #include <iostream>
@@ -18,24 +19,24 @@ using namespace Settings;
 
 //generic grotto event list
 std::vector<EventAccess> grottoEvents = {
-  EventAccess(&GossipStoneFairy, {[]{return GossipStoneFairy || CanSummonGossipFairy;}}),
-  EventAccess(&ButterflyFairy,   {[]{return ButterflyFairy   || (CanUse(STICKS));}}),
-  EventAccess(&BugShrub,         {[]{return CanCutShrubs;}}),
-  EventAccess(&LoneFish,         {[]{return true;}}),
+  EventAccess(&Logic::Vars::GossipStoneFairy, {[]{return logic->GossipStoneFairy || logic->CanSummonGossipFairy;}}),
+  EventAccess(&Logic::Vars::ButterflyFairy,   {[]{return logic->ButterflyFairy   || (logic->CanUse(STICKS));}}),
+  EventAccess(&Logic::Vars::BugShrub,         {[]{return logic->CanCutShrubs;}}),
+  EventAccess(&Logic::Vars::LoneFish,         {[]{return true;}}),
 };
 
 //set the logic to be a specific age and time of day and see if the condition still holds
 bool LocationAccess::CheckConditionAtAgeTime(bool& age, bool& time) const {
 
-  IsChild = false;
-  IsAdult = false;
-  AtDay   = false;
-  AtNight = false;
+  logic->IsChild = false;
+  logic->IsAdult = false;
+  logic->AtDay   = false;
+  logic->AtNight = false;
 
   time = true;
   age = true;
 
-  UpdateHelpers();
+  logic->UpdateAgeHelpers();
   return GetConditionsMet();
 }
 
@@ -44,10 +45,10 @@ bool LocationAccess::ConditionsMet() const {
   Area* parentRegion = AreaTable(Location(location)->GetParentRegionKey());
   bool conditionsMet = false;
 
-  if ((parentRegion->childDay   && CheckConditionAtAgeTime(IsChild, AtDay))   ||
-      (parentRegion->childNight && CheckConditionAtAgeTime(IsChild, AtNight)) ||
-      (parentRegion->adultDay   && CheckConditionAtAgeTime(IsAdult, AtDay))   ||
-      (parentRegion->adultNight && CheckConditionAtAgeTime(IsAdult, AtNight))) {
+  if ((parentRegion->Access().childDay   && CheckConditionAtAgeTime(logic->IsChild, logic->AtDay))   ||
+      (parentRegion->Access().childNight && CheckConditionAtAgeTime(logic->IsChild, logic->AtNight)) ||
+      (parentRegion->Access().adultDay   && CheckConditionAtAgeTime(logic->IsAdult, logic->AtDay))   ||
+      (parentRegion->Access().adultNight && CheckConditionAtAgeTime(logic->IsAdult, logic->AtNight))) {
         conditionsMet = true;
   }
 
@@ -63,22 +64,22 @@ bool LocationAccess::CanBuy() const {
   //Check if wallet is large enough to buy item
   bool SufficientWallet = true;
   if (Location(location)->GetPrice() > 500) {
-    SufficientWallet = ProgressiveWallet >= 3;
+    SufficientWallet = logic->ProgressiveWallet >= 3;
   } else if (Location(location)->GetPrice() > 200) {
-    SufficientWallet = ProgressiveWallet >= 2;
+    SufficientWallet = logic->ProgressiveWallet >= 2;
   } else if (Location(location)->GetPrice() > 99) {
-    SufficientWallet = ProgressiveWallet >= 1;
+    SufficientWallet = logic->ProgressiveWallet >= 1;
   }
 
   bool OtherCondition = true;
   uint32_t placed = Location(location)->GetPlacedItemKey();
   //Need bottle to buy bottle items, only logically relevant bottle items included here
   if (placed == BUY_BLUE_FIRE || placed == BUY_BOTTLE_BUG || placed == BUY_FISH || placed == BUY_FAIRYS_SPIRIT) {
-    OtherCondition = HasBottle;
+    OtherCondition = logic->HasBottle;
   }
   //If bombchus in logic, need to have found chus to buy; if not just need bomb bag
   else if (placed == BUY_BOMBCHU_10 || placed == BUY_BOMBCHU_20) {
-    OtherCondition = (!BombchusInLogic && Bombs) || (BombchusInLogic && FoundBombchus);
+    OtherCondition = (!settings->BombchusInLogic && logic->Bombs) || (settings->BombchusInLogic && logic->FoundBombchus);
   }
 
   return SufficientWallet && OtherCondition;
@@ -102,18 +103,20 @@ Area::~Area() = default;
 
 bool Area::UpdateEvents(SearchMode mode) {
 
+  Logic::AreaAccess& access = Access();
   if (timePass && mode != SearchMode::TimePassAccess) {
+    Logic::AreaAccess& rootAccess = AreaTable(ROOT)->Access();
     if (Child()) {
-      childDay = true;
-      childNight = true;
-      AreaTable(ROOT)->childDay = true;
-      AreaTable(ROOT)->childNight = true;
+      access.childDay = true;
+      access.childNight = true;
+      rootAccess.childDay = true;
+      rootAccess.childNight = true;
     }
     if (Adult()) {
-      adultDay = true;
-      adultNight = true;
-      AreaTable(ROOT)->adultDay = true;
-      AreaTable(ROOT)->adultNight = true;
+      access.adultDay = true;
+      access.adultNight = true;
+      rootAccess.adultDay = true;
+      rootAccess.adultNight = true;
     }
   }
 
@@ -125,10 +128,10 @@ bool Area::UpdateEvents(SearchMode mode) {
       continue;
     }
 
-    if ((childDay   && event.CheckConditionAtAgeTime(IsChild, AtDay))    ||
-        (childNight && event.CheckConditionAtAgeTime(IsChild, AtNight))  ||
-        (adultDay   && event.CheckConditionAtAgeTime(IsAdult, AtDay))    ||
-        (adultNight && event.CheckConditionAtAgeTime(IsAdult, AtNight))) {
+    if ((access.childDay   && event.CheckConditionAtAgeTime(logic->IsChild, logic->AtDay))    ||
+        (access.childNight && event.CheckConditionAtAgeTime(logic->IsChild, logic->AtNight))  ||
+        (access.adultDay   && event.CheckConditionAtAgeTime(logic->IsAdult, logic->AtDay))    ||
+        (access.adultNight && event.CheckConditionAtAgeTime(logic->IsAdult, logic->AtNight))) {
           event.EventOccurred();
           eventsUpdated = true;
     }
@@ -168,7 +171,7 @@ Entrance* Area::GetExit(uint32_t exitToReturn) {
 }
 
 bool Area::CanPlantBeanCheck() const {
-  return (Logic::MagicBean || Logic::MagicBeanPack) && BothAgesCheck();
+  return (logic->MagicBean || logic->MagicBeanPack) && BothAgesCheck();
 }
 
 bool Area::AllAccountedFor() const {
@@ -179,7 +182,7 @@ bool Area::AllAccountedFor() const {
   }
 
   for (const LocationAccess& loc : locations) {
-    if (!(Location(loc.GetLocation())->IsAddedToPool())) {
+    if (!logic->locationsInPool[loc.GetLocation()]) {
       return false;
     }
   }
@@ -200,50 +203,41 @@ bool Area::CheckAllAccess(const uint32_t exitKey) {
 
   for (Entrance& exit : exits) {
     if (exit.Getuint32_t() == exitKey) {
-      return exit.CheckConditionAtAgeTime(Logic::IsChild, Logic::AtDay)   &&
-             exit.CheckConditionAtAgeTime(Logic::IsChild, Logic::AtNight) &&
-             exit.CheckConditionAtAgeTime(Logic::IsAdult, Logic::AtDay)   &&
-             exit.CheckConditionAtAgeTime(Logic::IsAdult, Logic::AtNight);
+      return exit.CheckConditionAtAgeTime(logic->IsChild, logic->AtDay)   &&
+             exit.CheckConditionAtAgeTime(logic->IsChild, logic->AtNight) &&
+             exit.CheckConditionAtAgeTime(logic->IsAdult, logic->AtDay)   &&
+             exit.CheckConditionAtAgeTime(logic->IsAdult, logic->AtNight);
     }
   }
   return false;
 }
 
 void Area::ResetVariables() {
-  childDay = false;
-  childNight = false;
-  adultDay = false;
-  adultNight = false;
-  addedToPool = false;
-  for (auto& exit : exits) {
-    exit.RemoveFromPool();
-  }
+  Access() = {};
 }
 
-std::array<Area, KEY_ENUM_MAX> areaTable;
-
 bool Here(const uint32_t area, ConditionFn condition) {
-  return areaTable[area].HereCheck(condition);
+  return world->areaTable[area].HereCheck(condition);
 }
 
 bool CanPlantBean(const uint32_t area) {
-  return areaTable[area].CanPlantBeanCheck();
+  return world->areaTable[area].CanPlantBeanCheck();
 }
 
 bool BothAges(const uint32_t area) {
-  return areaTable[area].BothAgesCheck();
+  return world->areaTable[area].BothAgesCheck();
 }
 
 bool ChildCanAccess(const uint32_t area) {
-  return areaTable[area].Child();
+  return world->areaTable[area].Child();
 }
 
 bool AdultCanAccess(const uint32_t area) {
-  return areaTable[area].Adult();
+  return world->areaTable[area].Adult();
 }
 
 bool HasAccessTo(const uint32_t area) {
-  return areaTable[area].HasAccess();
+  return world->areaTable[area].HasAccess();
 }
 
 
@@ -251,66 +245,66 @@ bool HasAccessTo(const uint32_t area) {
 void AreaTable_Init() {
   //Clear the array from any previous playthrough attempts. This is important so that
   //locations which appear in both MQ and Vanilla dungeons don't get set in both areas.
-  areaTable.fill(Area("Invalid Area", "Invalid Area", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {}));
+  world->areaTable.fill(Area("Invalid Area", "Invalid Area", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {}));
 
                        //name, scene, hint text,                       events, locations, exits
-  areaTable[ROOT] = Area("Root", "", LINKS_POCKET, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[ROOT] = Area("Root", "", LINKS_POCKET, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(LINKS_POCKET, {[]{return true;}}),
-                  LocationAccess(TRIFORCE_COMPLETED, { [] { return CanCompleteTriforce;}}),
+                  LocationAccess(TRIFORCE_COMPLETED, { [] { return logic->CanCompleteTriforce;}}),
                 }, {
                   //Exits
                   Entrance(ROOT_EXITS, {[]{return true;}})
   });
 
-  areaTable[ROOT_EXITS] = Area("Root Exits", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[ROOT_EXITS] = Area("Root Exits", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(CHILD_SPAWN,             {[]{return IsChild;}}),
-                  Entrance(ADULT_SPAWN,             {[]{return IsAdult;}}),
-                  Entrance(MINUET_OF_FOREST_WARP,   {[]{return CanPlay(MinuetOfForest);}}),
-                  Entrance(BOLERO_OF_FIRE_WARP,     {[]{return CanPlay(BoleroOfFire)     && CanLeaveForest;}}),
-                  Entrance(SERENADE_OF_WATER_WARP,  {[]{return CanPlay(SerenadeOfWater)  && CanLeaveForest;}}),
-                  Entrance(NOCTURNE_OF_SHADOW_WARP, {[]{return CanPlay(NocturneOfShadow) && CanLeaveForest;}}),
-                  Entrance(REQUIEM_OF_SPIRIT_WARP,  {[]{return CanPlay(RequiemOfSpirit)  && CanLeaveForest;}}),
-                  Entrance(PRELUDE_OF_LIGHT_WARP,   {[]{return CanPlay(PreludeOfLight)   && CanLeaveForest;}}),
+                  Entrance(CHILD_SPAWN,             {[]{return logic->IsChild;}}),
+                  Entrance(ADULT_SPAWN,             {[]{return logic->IsAdult;}}),
+                  Entrance(MINUET_OF_FOREST_WARP,   {[]{return logic->CanPlay(logic->MinuetOfForest);}}),
+                  Entrance(BOLERO_OF_FIRE_WARP,     {[]{return logic->CanPlay(logic->BoleroOfFire)     && logic->CanLeaveForest;}}),
+                  Entrance(SERENADE_OF_WATER_WARP,  {[]{return logic->CanPlay(logic->SerenadeOfWater)  && logic->CanLeaveForest;}}),
+                  Entrance(NOCTURNE_OF_SHADOW_WARP, {[]{return logic->CanPlay(logic->NocturneOfShadow) && logic->CanLeaveForest;}}),
+                  Entrance(REQUIEM_OF_SPIRIT_WARP,  {[]{return logic->CanPlay(logic->RequiemOfSpirit)  && logic->CanLeaveForest;}}),
+                  Entrance(PRELUDE_OF_LIGHT_WARP,   {[]{return logic->CanPlay(logic->PreludeOfLight)   && logic->CanLeaveForest;}}),
   });
 
-  areaTable[CHILD_SPAWN] = Area("Child Spawn", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[CHILD_SPAWN] = Area("Child Spawn", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(KF_LINKS_HOUSE, {[]{return true;}}),
   });
 
-  areaTable[ADULT_SPAWN] = Area("Adult Spawn", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[ADULT_SPAWN] = Area("Adult Spawn", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(TEMPLE_OF_TIME, {[]{return true;}}),
   });
 
-  areaTable[MINUET_OF_FOREST_WARP] = Area("Minuet of Forest Warp", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[MINUET_OF_FOREST_WARP] = Area("Minuet of Forest Warp", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(SACRED_FOREST_MEADOW, {[]{return true;}}),
   });
 
-  areaTable[BOLERO_OF_FIRE_WARP] = Area("Bolero of Fire Warp", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[BOLERO_OF_FIRE_WARP] = Area("Bolero of Fire Warp", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(DMC_CENTRAL_LOCAL, {[]{return true;}}),
   });
 
-  areaTable[SERENADE_OF_WATER_WARP] = Area("Serenade of Water Warp", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[SERENADE_OF_WATER_WARP] = Area("Serenade of Water Warp", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(LAKE_HYLIA, {[]{return true;}}),
   });
 
-  areaTable[REQUIEM_OF_SPIRIT_WARP] = Area("Requiem of Spirit Warp", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[REQUIEM_OF_SPIRIT_WARP] = Area("Requiem of Spirit Warp", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(DESERT_COLOSSUS, {[]{return true;}}),
   });
 
-  areaTable[NOCTURNE_OF_SHADOW_WARP] = Area("Nocturne of Shadow Warp", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[NOCTURNE_OF_SHADOW_WARP] = Area("Nocturne of Shadow Warp", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(GRAVEYARD_WARP_PAD_REGION, {[]{return true;}}),
   });
 
-  areaTable[PRELUDE_OF_LIGHT_WARP] = Area("Prelude of Light Warp", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[PRELUDE_OF_LIGHT_WARP] = Area("Prelude of Light Warp", "", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(TEMPLE_OF_TIME, {[]{return true;}}),
   });
@@ -337,13 +331,17 @@ void AreaTable_Init() {
   AreaTable_Init_GerudoTrainingGrounds();
   AreaTable_Init_GanonsCastle();
 
+  for (uint32_t i = 0; i < KEY_ENUM_MAX; i++) {
+    world->areaTable[i].key = i;
+  }
+
   //Set parent regions
   for (uint32_t i = ROOT; i <= GANONS_CASTLE; i++) {
-    for (LocationAccess& locPair : areaTable[i].locations) {
+    for (LocationAccess& locPair : world->areaTable[i].locations) {
       uint32_t location = locPair.GetLocation();
       Location(location)->SetParentRegion(i);
     }
-    for (Entrance& exit : areaTable[i].exits) {
+    for (Entrance& exit : world->areaTable[i].exits) {
       exit.SetParentRegion(i);
       exit.SetName();
       exit.GetConnectedRegion()->entrances.push_front(&exit);
@@ -363,9 +361,9 @@ namespace Areas {
   const auto GetAllAreas() {
     static const size_t areaCount = MARKER_AREAS_END - (MARKER_AREAS_START + 1);
 
-    static std::array<uint32_t, areaCount> allAreas = {};
+    static thread_local std::array<uint32_t, areaCount> allAreas = {};
 
-    static bool intialized = false;
+    static thread_local bool intialized = false;
     if (!intialized) {
       for (size_t i = 0; i < areaCount; i++) {
         allAreas[i] = (MARKER_AREAS_START + 1) + i;
@@ -381,21 +379,31 @@ namespace Areas {
       AreaTable(area)->ResetVariables();
     }
 
-    if(Settings::HasNightStart) {
-        if(Settings::ResolvedStartingAge == AGE_CHILD) {
-          AreaTable(ROOT)->childNight = true;
+    if(settings->HasNightStart) {
+        if(settings->ResolvedStartingAge == AGE_CHILD) {
+          AreaTable(ROOT)->Access().childNight = true;
         } else {
-          AreaTable(ROOT)->adultNight = true;
+          AreaTable(ROOT)->Access().adultNight = true;
         }
       } else {
-        if(Settings::ResolvedStartingAge == AGE_CHILD) {
-          AreaTable(ROOT)->childDay = true;
+        if(settings->ResolvedStartingAge == AGE_CHILD) {
+          AreaTable(ROOT)->Access().childDay = true;
         } else {
-          AreaTable(ROOT)->adultDay = true;
+          AreaTable(ROOT)->Access().adultDay = true;
         }
     }
   }
 
+  //Searches keep what they reach in the logic, except for the playthrough which also marks the entrances it goes
+  //through, so this only has to be done before generating it
+  void ResetEntrancePool() {
+    for (const uint32_t area : GetAllAreas()) {
+      for (Entrance& exit : AreaTable(area)->exits) {
+        exit.RemoveFromPool();
+      }
+    }
+  }
+
   //Reset exits and clear items from locations
   void ResetAllLocations() {
       for (const uint32_t area : GetAllAreas()) {
@@ -406,18 +414,19 @@ namespace Areas {
           Location(location)->ResetVariables();
       }
     }
+    ResetEntrancePool();
 
-    if(Settings::HasNightStart) {
-        if(Settings::ResolvedStartingAge == AGE_CHILD) {
-          AreaTable(ROOT)->childNight = true;
+    if(settings->HasNightStart) {
+        if(settings->ResolvedStartingAge == AGE_CHILD) {
+          AreaTable(ROOT)->Access().childNight = true;
         } else {
-          AreaTable(ROOT)->adultNight = true;
+          AreaTable(ROOT)->Access().adultNight = true;
         }
       } else {
-        if(Settings::ResolvedStartingAge == AGE_CHILD) {
-          AreaTable(ROOT)->childDay = true;
+        if(settings->ResolvedStartingAge == AGE_CHILD) {
+          AreaTable(ROOT)->Access().childDay = true;
         } else {
-          AreaTable(ROOT)->adultDay = true;
+          AreaTable(ROOT)->Access().adultDay = true;
         }
     }
   }
@@ -446,30 +455,30 @@ namespace Areas {
       for (auto exit : area->exits) {
         if (exit.GetConnectedRegion()->regionName != "Invalid Area") {
           std::string parent = exit.GetParentRegion()->regionName;
-          if (area->childDay) {
+          if (area->Access().childDay) {
             parent += " CD";
           }
-          if (area->childNight) {
+          if (area->Access().childNight) {
             parent += " CN";
           }
-          if (area->adultDay) {
+          if (area->Access().adultDay) {
             parent += " AD";
           }
-          if (area->adultNight) {
+          if (area->Access().adultNight) {
             parent += " AN";
           }
           Area* connected = exit.GetConnectedRegion();
           auto connectedStr = connected->regionName;
-          if (connected->childDay) {
+          if (connected->Access().childDay) {
             connectedStr += " CD";
           }
-          if (connected->childNight) {
+          if (connected->Access().childNight) {
             connectedStr += " CN";
           }
-          if (connected->adultDay) {
+          if (connected->Access().adultDay) {
             connectedStr += " AD";
           }
-          if (connected->adultNight) {
+          if (connected->Access().adultNight) {
             connectedStr += " AN";
           }
           worldGraph << "\t\"" + parent + "\"[shape=\"plain\"];\n";
@@ -488,7 +497,7 @@ Area* AreaTable(const uint32_t areaKey) {
   if (areaKey > KEY_ENUM_MAX) {
     printf("\x1b[1;1HERROR: AREAKEY TOO BIG");
   }
-  return &(areaTable[areaKey]);
+  return &(world->areaTable[areaKey]);
 }
 
 //Retrieve all the shuffable entrances of a specific type
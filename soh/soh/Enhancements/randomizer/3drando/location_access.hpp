@@ -8,6 +8,7 @@
 #include "hint_list.hpp"
 #include "keys.hpp"
 #include "fill.hpp"
+#include "fill_profiler.hpp"
 
 typedef bool (*ConditionFn)();
 
@@ -15,7 +16,7 @@ class EventAccess {
 public:
 
 
-    explicit EventAccess(bool* event_, std::vector<ConditionFn> conditions_met_)
+    explicit EventAccess(bool Logic::Vars::* event_, std::vector<ConditionFn> conditions_met_)
         : event(event_) {
         conditions_met.resize(2);
         for (size_t i = 0; i < conditions_met_.size(); i++) {
@@ -24,11 +25,12 @@ public:
     }
 
     bool ConditionsMet() const {
-        if (Settings::Logic.Is(LOGIC_NONE) || Settings::Logic.Is(LOGIC_VANILLA)) {
+        FillProfiler::CountCondition();
+        if (settings->Logic.Is(LOGIC_NONE) || settings->Logic.Is(LOGIC_VANILLA)) {
             return true;
-        } else if (Settings::Logic.Is(LOGIC_GLITCHLESS)) {
+        } else if (settings->Logic.Is(LOGIC_GLITCHLESS)) {
             return conditions_met[0]();
-        } else if (Settings::Logic.Is(LOGIC_GLITCHED)) {
+        } else if (settings->Logic.Is(LOGIC_GLITCHED)) {
             if (conditions_met[0]()) {
                 return true;
             } else if (conditions_met[1] != NULL) {
@@ -40,28 +42,30 @@ public:
 
     bool CheckConditionAtAgeTime(bool& age, bool& time) {
 
-      Logic::IsChild = false;
-      Logic::IsAdult = false;
-      Logic::AtDay   = false;
-      Logic::AtNight = false;
+      logic->IsChild = false;
+      logic->IsAdult = false;
+      logic->AtDay   = false;
+      logic->AtNight = false;
 
       time = true;
       age = true;
 
-      Logic::UpdateHelpers();
+      logic->UpdateAgeHelpers();
       return ConditionsMet();
     }
 
     void EventOccurred() {
-        *event = true;
+        logic->*event = true;
+        logic->UpdateHelpers();
     }
 
     bool GetEvent() const {
-        return *event;
+        return logic->*event;
     }
 
 private:
-    bool* event;
+    //The event in whichever logic is installed when it's checked
+    bool Logic::Vars::* event;
     std::vector<ConditionFn> conditions_met;
 };
 
@@ -78,11 +82,12 @@ public:
     }
 
     bool GetConditionsMet() const {
-        if (Settings::Logic.Is(LOGIC_NONE) || Settings::Logic.Is(LOGIC_VANILLA)) {
+        FillProfiler::CountCondition();
+        if (settings->Logic.Is(LOGIC_NONE) || settings->Logic.Is(LOGIC_VANILLA)) {
             return true;
-        } else if (Settings::Logic.Is(LOGIC_GLITCHLESS)) {
+        } else if (settings->Logic.Is(LOGIC_GLITCHLESS)) {
             return conditions_met[0]();
-        } else if (Settings::Logic.Is(LOGIC_GLITCHED)) {
+        } else if (settings->Logic.Is(LOGIC_GLITCHED)) {
             if (conditions_met[0]()) {
                 return true;
             } else if (conditions_met[1] != NULL) {
@@ -135,11 +140,8 @@ public:
     //worry about a vector potentially reallocating itself and invalidating all our
     //entrance pointers.
 
-    bool childDay = false;
-    bool childNight = false;
-    bool adultDay = false;
-    bool adultNight = false;
-    bool addedToPool = false;
+    //Set once the whole table is built, to find this area's access in the installed logic
+    uint32_t key = NONE;
 
     bool UpdateEvents(SearchMode mode);
 
@@ -151,12 +153,17 @@ public:
 
     Entrance* GetExit(uint32_t exit);
 
+    //How far the search running on this thread has reached this area
+    Logic::AreaAccess& Access() const {
+      return logic->areaAccess[key];
+    }
+
     bool Child() const {
-      return childDay || childNight;
+      return Access().childDay || Access().childNight;
     }
 
     bool Adult() const {
-      return adultDay || adultNight;
+      return Access().adultDay || Access().adultNight;
     }
 
     bool BothAgesCheck() const {
@@ -168,7 +175,8 @@ public:
     }
 
     bool AllAccess() const {
-      return childDay && childNight && adultDay && adultNight;
+      const Logic::AreaAccess& access = Access();
+      return access.childDay && access.childNight && access.adultDay && access.adultNight;
     }
 
     //Check to see if an exit can be access as both ages at both times of day
@@ -185,21 +193,21 @@ public:
     bool HereCheck(ConditionFn condition) {
 
       //store current age variables
-      bool pastAdult = Logic::IsAdult;
-      bool pastChild = Logic::IsChild;
+      bool pastAdult = logic->IsAdult;
+      bool pastChild = logic->IsChild;
 
       //set age access as this areas ages
-      Logic::IsChild = Child();
-      Logic::IsAdult = Adult();
+      logic->IsChild = Child();
+      logic->IsAdult = Adult();
 
       //update helpers and check condition as well as having at least child or adult access
-      Logic::UpdateHelpers();
-      bool hereVal = condition() && (Logic::IsAdult || Logic::IsChild);
+      logic->UpdateAgeHelpers();
+      bool hereVal = condition() && (logic->IsAdult || logic->IsChild);
 
       //set back age variables
-      Logic::IsChild = pastChild;
-      Logic::IsAdult = pastAdult;
-      Logic::UpdateHelpers();
+      logic->IsChild = pastChild;
+      logic->IsAdult = pastAdult;
+      logic->UpdateAgeHelpers();
 
       return hereVal;
     }
@@ -210,15 +218,15 @@ public:
     void ResetVariables();
 
     void printAgeTimeAccess() const {
-      auto message = "Child Day:   " + std::to_string(childDay)   + "\t"
-                     "Child Night: " + std::to_string(childNight) + "\t"
-                     "Adult Day:   " + std::to_string(adultDay)   + "\t"
-                     "Adult Night: " + std::to_string(adultNight);
+      const Logic::AreaAccess& access = Access();
+      auto message = "Child Day:   " + std::to_string(access.childDay)   + "\t"
+                     "Child Night: " + std::to_string(access.childNight) + "\t"
+                     "Adult Day:   " + std::to_string(access.adultDay)   + "\t"
+                     "Adult Night: " + std::to_string(access.adultNight);
       //CitraPrint(message);
     }
 };
 
-extern std::array<Area, KEY_ENUM_MAX> areaTable;
 extern std::vector<EventAccess> grottoEvents;
 
 bool Here(const AreaKey area, ConditionFn condition);
@@ -234,6 +242,7 @@ bool HasAccessTo(const AreaKey area);
 namespace Areas {
 
   extern void AccessReset();
+  extern void ResetEntrancePool();
   extern void ResetAllLocations();
   extern bool HasTimePassAccess(uint8_t age);
   extern void DumpWorldGraph(std::string str);
@@ -2,6 +2,7 @@
 #include "../logic.hpp"
 #include "../entrance.hpp"
 #include "../dungeon.hpp"
+#include "../world.hpp"
 
 using namespace Logic;
 using namespace Settings;
@@ -10,40 +11,40 @@ void AreaTable_Init_BottomOfTheWell() {
   /*--------------------------
   |    VANILLA/MQ DECIDER    |
   ---------------------------*/
-  areaTable[BOTTOM_OF_THE_WELL_ENTRYWAY] = Area("Bottom of the Well Entryway", "Bottom of the Well", BOTTOM_OF_THE_WELL, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[BOTTOM_OF_THE_WELL_ENTRYWAY] = Area("Bottom of the Well Entryway", "Bottom of the Well", BOTTOM_OF_THE_WELL, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(BOTTOM_OF_THE_WELL_MAIN_AREA,    {[]{return Dungeon::BottomOfTheWell.IsVanilla() && IsChild && (CanChildAttack || Nuts);}}),
-                  Entrance(BOTTOM_OF_THE_WELL_MQ_PERIMETER, {[]{return Dungeon::BottomOfTheWell.IsMQ()      && IsChild;}}),
+                  Entrance(BOTTOM_OF_THE_WELL_MAIN_AREA,    {[]{return world->dungeons.BottomOfTheWell.IsVanilla() && logic->IsChild && (logic->CanChildAttack || logic->Nuts);}}),
+                  Entrance(BOTTOM_OF_THE_WELL_MQ_PERIMETER, {[]{return world->dungeons.BottomOfTheWell.IsMQ()      && logic->IsChild;}}),
                   Entrance(KAKARIKO_VILLAGE,                {[]{return true;}}),
   });
 
   /*--------------------------
   |     VANILLA DUNGEON      |
   ---------------------------*/
-  if (Dungeon::BottomOfTheWell.IsVanilla()) {
-  areaTable[BOTTOM_OF_THE_WELL_MAIN_AREA] = Area("Bottom of the Well Main Area", "Bottom of the Well", BOTTOM_OF_THE_WELL, NO_DAY_NIGHT_CYCLE, {
+  if (world->dungeons.BottomOfTheWell.IsVanilla()) {
+  world->areaTable[BOTTOM_OF_THE_WELL_MAIN_AREA] = Area("Bottom of the Well Main Area", "Bottom of the Well", BOTTOM_OF_THE_WELL, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&StickPot, {[]{return true;}}),
-                  EventAccess(&NutPot,   {[]{return true;}}),
+                  EventAccess(&Logic::Vars::StickPot, {[]{return true;}}),
+                  EventAccess(&Logic::Vars::NutPot,   {[]{return true;}}),
                 }, {
                   //Locations
-                  LocationAccess(BOTTOM_OF_THE_WELL_FRONT_LEFT_FAKE_WALL_CHEST,   {[]{return LogicLensBotw || CanUse(LENS_OF_TRUTH);}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_FRONT_CENTER_BOMBABLE_CHEST,  {[]{return HasExplosives;}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_RIGHT_BOTTOM_FAKE_WALL_CHEST, {[]{return LogicLensBotw || CanUse(LENS_OF_TRUTH);}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_COMPASS_CHEST,                {[]{return LogicLensBotw || CanUse(LENS_OF_TRUTH);}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_CENTER_SKULLTULA_CHEST,       {[]{return LogicLensBotw || CanUse(LENS_OF_TRUTH);}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_BACK_LEFT_BOMBABLE_CHEST,     {[]{return (LogicLensBotw || CanUse(LENS_OF_TRUTH)) && HasExplosives;}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_FREESTANDING_KEY,             {[]{return Sticks || CanUse(DINS_FIRE);}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_LENS_OF_TRUTH_CHEST,          {[]{return CanPlay(ZeldasLullaby) && (KokiriSword || (Sticks && LogicChildDeadhand));}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_INVISIBLE_CHEST,              {[]{return CanPlay(ZeldasLullaby) && (LogicLensBotw || CanUse(LENS_OF_TRUTH));}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_UNDERWATER_FRONT_CHEST,       {[]{return CanPlay(ZeldasLullaby);}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_UNDERWATER_LEFT_CHEST,        {[]{return CanPlay(ZeldasLullaby);}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_MAP_CHEST,                    {[]{return HasExplosives || (((SmallKeys(BOTTOM_OF_THE_WELL, 3) && (LogicLensBotw || CanUse(LENS_OF_TRUTH))) || CanUse(DINS_FIRE) || (Sticks && LogicBotwBasement)) && GoronBracelet);}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_FIRE_KEESE_CHEST,             {[]{return SmallKeys(BOTTOM_OF_THE_WELL, 3) && (LogicLensBotw || CanUse(LENS_OF_TRUTH));}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_LIKE_LIKE_CHEST,              {[]{return SmallKeys(BOTTOM_OF_THE_WELL, 3) && (LogicLensBotw || CanUse(LENS_OF_TRUTH));}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_GS_WEST_INNER_ROOM,           {[]{return Boomerang && (LogicLensBotw || CanUse(LENS_OF_TRUTH)) && SmallKeys(BOTTOM_OF_THE_WELL, 3);}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_GS_EAST_INNER_ROOM,           {[]{return Boomerang && (LogicLensBotw || CanUse(LENS_OF_TRUTH)) && SmallKeys(BOTTOM_OF_THE_WELL, 3);}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_GS_LIKE_LIKE_CAGE,            {[]{return SmallKeys(BOTTOM_OF_THE_WELL, 3) && (LogicLensBotw || CanUse(LENS_OF_TRUTH)) && Boomerang;}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_FRONT_LEFT_FAKE_WALL_CHEST,   {[]{return settings->LogicLensBotw || logic->CanUse(LENS_OF_TRUTH);}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_FRONT_CENTER_BOMBABLE_CHEST,  {[]{return logic->HasExplosives;}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_RIGHT_BOTTOM_FAKE_WALL_CHEST, {[]{return settings->LogicLensBotw || logic->CanUse(LENS_OF_TRUTH);}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_COMPASS_CHEST,                {[]{return settings->LogicLensBotw || logic->CanUse(LENS_OF_TRUTH);}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_CENTER_SKULLTULA_CHEST,       {[]{return settings->LogicLensBotw || logic->CanUse(LENS_OF_TRUTH);}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_BACK_LEFT_BOMBABLE_CHEST,     {[]{return (settings->LogicLensBotw || logic->CanUse(LENS_OF_TRUTH)) && logic->HasExplosives;}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_FREESTANDING_KEY,             {[]{return logic->Sticks || logic->CanUse(DINS_FIRE);}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_LENS_OF_TRUTH_CHEST,          {[]{return logic->CanPlay(logic->ZeldasLullaby) && (logic->KokiriSword || (logic->Sticks && settings->LogicChildDeadhand));}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_INVISIBLE_CHEST,              {[]{return logic->CanPlay(logic->ZeldasLullaby) && (settings->LogicLensBotw || logic->CanUse(LENS_OF_TRUTH));}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_UNDERWATER_FRONT_CHEST,       {[]{return logic->CanPlay(logic->ZeldasLullaby);}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_UNDERWATER_LEFT_CHEST,        {[]{return logic->CanPlay(logic->ZeldasLullaby);}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_MAP_CHEST,                    {[]{return logic->HasExplosives || (((logic->SmallKeys(BOTTOM_OF_THE_WELL, 3) && (settings->LogicLensBotw || logic->CanUse(LENS_OF_TRUTH))) || logic->CanUse(DINS_FIRE) || (logic->Sticks && settings->LogicBotwBasement)) && logic->GoronBracelet);}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_FIRE_KEESE_CHEST,             {[]{return logic->SmallKeys(BOTTOM_OF_THE_WELL, 3) && (settings->LogicLensBotw || logic->CanUse(LENS_OF_TRUTH));}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_LIKE_LIKE_CHEST,              {[]{return logic->SmallKeys(BOTTOM_OF_THE_WELL, 3) && (settings->LogicLensBotw || logic->CanUse(LENS_OF_TRUTH));}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_GS_WEST_INNER_ROOM,           {[]{return logic->Boomerang && (settings->LogicLensBotw || logic->CanUse(LENS_OF_TRUTH)) && logic->SmallKeys(BOTTOM_OF_THE_WELL, 3);}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_GS_EAST_INNER_ROOM,           {[]{return logic->Boomerang && (settings->LogicLensBotw || logic->CanUse(LENS_OF_TRUTH)) && logic->SmallKeys(BOTTOM_OF_THE_WELL, 3);}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_GS_LIKE_LIKE_CAGE,            {[]{return logic->SmallKeys(BOTTOM_OF_THE_WELL, 3) && (settings->LogicLensBotw || logic->CanUse(LENS_OF_TRUTH)) && logic->Boomerang;}}),
                 }, {
                   //Exits
                   Entrance(BOTTOM_OF_THE_WELL_ENTRYWAY, {[]{return true;}}),
@@ -53,30 +54,30 @@ void AreaTable_Init_BottomOfTheWell() {
   /*---------------------------
   |   MASTER QUEST DUNGEON    |
   ---------------------------*/
-  if (Dungeon::BottomOfTheWell.IsMQ()) {
-  areaTable[BOTTOM_OF_THE_WELL_MQ_PERIMETER] = Area("Bottom of the Well MQ Perimeter", "Bottom of the Well", BOTTOM_OF_THE_WELL, NO_DAY_NIGHT_CYCLE, {
+  if (world->dungeons.BottomOfTheWell.IsMQ()) {
+  world->areaTable[BOTTOM_OF_THE_WELL_MQ_PERIMETER] = Area("Bottom of the Well MQ Perimeter", "Bottom of the Well", BOTTOM_OF_THE_WELL, NO_DAY_NIGHT_CYCLE, {
                   //Events
                   //EventAccess(&WallFairy, {[]{return WallFairy || Slingshot;}}),
   }, {
                   //Locations
-                  LocationAccess(BOTTOM_OF_THE_WELL_MQ_COMPASS_CHEST,              {[]{return KokiriSword || (Sticks && LogicChildDeadhand);}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_MQ_DEAD_HAND_FREESTANDING_KEY, {[]{return HasExplosives || (LogicBotwMQDeadHandKey && Boomerang);}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_MQ_COMPASS_CHEST,              {[]{return logic->KokiriSword || (logic->Sticks && settings->LogicChildDeadhand);}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_MQ_DEAD_HAND_FREESTANDING_KEY, {[]{return logic->HasExplosives || (settings->LogicBotwMQDeadHandKey && logic->Boomerang);}}),
                     //Trick: HasExplosives || (LogicBotWMQDeadHandKey && Boomerang)
-                  LocationAccess(BOTTOM_OF_THE_WELL_MQ_GS_BASEMENT,                {[]{return CanChildAttack;}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_MQ_GS_COFFIN_ROOM,             {[]{return CanChildAttack && SmallKeys(BOTTOM_OF_THE_WELL, 2);}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_MQ_GS_BASEMENT,                {[]{return logic->CanChildAttack;}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_MQ_GS_COFFIN_ROOM,             {[]{return logic->CanChildAttack && logic->SmallKeys(BOTTOM_OF_THE_WELL, 2);}}),
   }, {
                   //Exits
                   Entrance(BOTTOM_OF_THE_WELL_ENTRYWAY,  {[]{return true;}}),
-                  Entrance(BOTTOM_OF_THE_WELL_MQ_MIDDLE, {[]{return CanPlay(ZeldasLullaby) || (LogicBotwMQPits && HasExplosives);}}),
+                  Entrance(BOTTOM_OF_THE_WELL_MQ_MIDDLE, {[]{return logic->CanPlay(logic->ZeldasLullaby) || (settings->LogicBotwMQPits && logic->HasExplosives);}}),
                     //Trick: CanPlay(ZeldasLullaby) || (LogicBotWMQPits && HasExplosives)
   });
 
-  areaTable[BOTTOM_OF_THE_WELL_MQ_MIDDLE] = Area("Bottom of the Well MQ Middle", "Bottom of the Well", BOTTOM_OF_THE_WELL, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[BOTTOM_OF_THE_WELL_MQ_MIDDLE] = Area("Bottom of the Well MQ Middle", "Bottom of the Well", BOTTOM_OF_THE_WELL, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(BOTTOM_OF_THE_WELL_MQ_MAP_CHEST,                        {[]{return true;}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_MQ_LENS_OF_TRUTH_CHEST,              {[]{return HasExplosives && SmallKeys(BOTTOM_OF_THE_WELL, 2);}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_MQ_LENS_OF_TRUTH_CHEST,              {[]{return logic->HasExplosives && logic->SmallKeys(BOTTOM_OF_THE_WELL, 2);}}),
                   LocationAccess(BOTTOM_OF_THE_WELL_MQ_EAST_INNER_ROOM_FREESTANDING_KEY, {[]{return true;}}),
-                  LocationAccess(BOTTOM_OF_THE_WELL_MQ_GS_WEST_INNER_ROOM,               {[]{return CanChildAttack && (LogicBotwMQPits || HasExplosives);}}),
+                  LocationAccess(BOTTOM_OF_THE_WELL_MQ_GS_WEST_INNER_ROOM,               {[]{return logic->CanChildAttack && (settings->LogicBotwMQPits || logic->HasExplosives);}}),
                     //Trick: CanChildAttack && (LogicBotWMQPits || HasExplosives)
   }, {
                   //Exits
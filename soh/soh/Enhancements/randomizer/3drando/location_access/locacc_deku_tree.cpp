@@ -2,6 +2,7 @@
 #include "../logic.hpp"
 #include "../entrance.hpp"
 #include "../dungeon.hpp"
+#include "../world.hpp"
 
 using namespace Logic;
 using namespace Settings;
@@ -10,21 +11,21 @@ void AreaTable_Init_DekuTree() {
   /*--------------------------
   |    VANILLA/MQ DECIDER    |
   ---------------------------*/
-  areaTable[DEKU_TREE_ENTRYWAY] = Area("Deku Tree Entryway", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[DEKU_TREE_ENTRYWAY] = Area("Deku Tree Entryway", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(DEKU_TREE_LOBBY,      {[]{return Dungeon::DekuTree.IsVanilla();}}),
-                  Entrance(DEKU_TREE_MQ_LOBBY,   {[]{return Dungeon::DekuTree.IsMQ();}}),
+                  Entrance(DEKU_TREE_LOBBY,      {[]{return world->dungeons.DekuTree.IsVanilla();}}),
+                  Entrance(DEKU_TREE_MQ_LOBBY,   {[]{return world->dungeons.DekuTree.IsMQ();}}),
                   Entrance(KF_OUTSIDE_DEKU_TREE, {[]{return true;}}),
   });
 
   /*--------------------------
   |     VANILLA DUNGEON      |
   ---------------------------*/
-  if (Dungeon::DekuTree.IsVanilla()) {
-  areaTable[DEKU_TREE_LOBBY] = Area("Deku Tree Lobby", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {
+  if (world->dungeons.DekuTree.IsVanilla()) {
+  world->areaTable[DEKU_TREE_LOBBY] = Area("Deku Tree Lobby", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&DekuBabaSticks, {[]{return DekuBabaSticks || (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(BOOMERANG));}}),
-                  EventAccess(&DekuBabaNuts,   {[]{return DekuBabaNuts   || (CanJumpslash || CanUse(SLINGSHOT) || CanUse(BOW) || CanUse(MEGATON_HAMMER) || HasExplosives || CanUse(DINS_FIRE));}}),
+                  EventAccess(&Logic::Vars::DekuBabaSticks, {[]{return logic->DekuBabaSticks || (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(BOOMERANG));}}),
+                  EventAccess(&Logic::Vars::DekuBabaNuts,   {[]{return logic->DekuBabaNuts   || (logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->CanUse(BOW) || logic->CanUse(MEGATON_HAMMER) || logic->HasExplosives || logic->CanUse(DINS_FIRE));}}),
                 }, {
                   //Locations
                   LocationAccess(DEKU_TREE_MAP_CHEST, {[]{return true;}}),
@@ -33,240 +34,240 @@ void AreaTable_Init_DekuTree() {
                   Entrance(DEKU_TREE_ENTRYWAY,          {[]{return true;}}),
                   Entrance(DEKU_TREE_2F_MIDDLE_ROOM,    {[]{return true;}}),
                   Entrance(DEKU_TREE_COMPASS_ROOM,      {[]{return true;}}),
-                  Entrance(DEKU_TREE_BASEMENT_LOWER,    {[]{return Here(DEKU_TREE_LOBBY, []{return CanAdultAttack || CanChildAttack || Nuts;});}}),
+                  Entrance(DEKU_TREE_BASEMENT_LOWER,    {[]{return Here(DEKU_TREE_LOBBY, []{return logic->CanAdultAttack || logic->CanChildAttack || logic->Nuts;});}}),
                   Entrance(DEKU_TREE_OUTSIDE_BOSS_ROOM, {[]{return false;}}),
                   Entrance(DEKU_TREE_BOSS_ENTRYWAY,     {[]{return false;}}),
   });
 
-  areaTable[DEKU_TREE_2F_MIDDLE_ROOM] = Area("Deku Tree 2F Middle Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[DEKU_TREE_2F_MIDDLE_ROOM] = Area("Deku Tree 2F Middle Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(DEKU_TREE_LOBBY,         {[]{return Here(DEKU_TREE_2F_MIDDLE_ROOM, []{return HasShield || CanUse(MEGATON_HAMMER);});}}),
-                  Entrance(DEKU_TREE_SLINGSHOT_ROOM,{[]{return Here(DEKU_TREE_2F_MIDDLE_ROOM, []{return HasShield || CanUse(MEGATON_HAMMER);});}}),
+                  Entrance(DEKU_TREE_LOBBY,         {[]{return Here(DEKU_TREE_2F_MIDDLE_ROOM, []{return logic->HasShield || logic->CanUse(MEGATON_HAMMER);});}}),
+                  Entrance(DEKU_TREE_SLINGSHOT_ROOM,{[]{return Here(DEKU_TREE_2F_MIDDLE_ROOM, []{return logic->HasShield || logic->CanUse(MEGATON_HAMMER);});}}),
   });
 
-  areaTable[DEKU_TREE_SLINGSHOT_ROOM] = Area("Deku Tree Slingshot Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[DEKU_TREE_SLINGSHOT_ROOM] = Area("Deku Tree Slingshot Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(DEKU_TREE_SLINGSHOT_CHEST,           {[]{return true;}}),
                   LocationAccess(DEKU_TREE_SLINGSHOT_ROOM_SIDE_CHEST, {[]{return true;}}),
                 }, {
                   //Exits
-                  Entrance(DEKU_TREE_2F_MIDDLE_ROOM, {[]{return CanUse(SLINGSHOT) || CanUse(HOVER_BOOTS);}}),
+                  Entrance(DEKU_TREE_2F_MIDDLE_ROOM, {[]{return logic->CanUse(SLINGSHOT) || logic->CanUse(HOVER_BOOTS);}}),
   });
 
-  areaTable[DEKU_TREE_COMPASS_ROOM] = Area("Deku Tree Compass Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[DEKU_TREE_COMPASS_ROOM] = Area("Deku Tree Compass Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&DekuBabaSticks, {[]{return DekuBabaSticks || (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(BOOMERANG));}}),
-                  EventAccess(&DekuBabaNuts,   {[]{return DekuBabaNuts   || (CanJumpslash || CanUse(SLINGSHOT) || CanUse(BOW) || CanUse(MEGATON_HAMMER) || HasExplosives || CanUse(DINS_FIRE));}}),
+                  EventAccess(&Logic::Vars::DekuBabaSticks, {[]{return logic->DekuBabaSticks || (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(BOOMERANG));}}),
+                  EventAccess(&Logic::Vars::DekuBabaNuts,   {[]{return logic->DekuBabaNuts   || (logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->CanUse(BOW) || logic->CanUse(MEGATON_HAMMER) || logic->HasExplosives || logic->CanUse(DINS_FIRE));}}),
                 }, {
                   //Locations
                   LocationAccess(DEKU_TREE_COMPASS_CHEST,           {[]{return true;}}),
                   LocationAccess(DEKU_TREE_COMPASS_ROOM_SIDE_CHEST, {[]{return true;}}),
-                  LocationAccess(DEKU_TREE_GS_COMPASS_ROOM,         {[]{return CanAdultAttack || CanChildAttack;}}),
+                  LocationAccess(DEKU_TREE_GS_COMPASS_ROOM,         {[]{return logic->CanAdultAttack || logic->CanChildAttack;}}),
                 }, {
                   //Exits
-                  Entrance(DEKU_TREE_LOBBY,     {[]{return HasFireSourceWithTorch || CanUse(BOW);}}),
+                  Entrance(DEKU_TREE_LOBBY,     {[]{return logic->HasFireSourceWithTorch || logic->CanUse(BOW);}}),
                   Entrance(DEKU_TREE_BOSS_ENTRYWAY, {[]{return false;}}),
   });
 
-  areaTable[DEKU_TREE_BASEMENT_LOWER] = Area("Deku Tree Basement Lower", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[DEKU_TREE_BASEMENT_LOWER] = Area("Deku Tree Basement Lower", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&DekuBabaSticks, {[]{return DekuBabaSticks || (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || Boomerang);}}),
-                  EventAccess(&DekuBabaNuts,   {[]{return DekuBabaNuts   || (CanJumpslash || CanUse(SLINGSHOT) || CanUse(BOW) || CanUse(MEGATON_HAMMER) || HasExplosives || CanUse(DINS_FIRE));},
-                                    /*Glitched*/[]{return CanUse(MEGATON_HAMMER);}}),
+                  EventAccess(&Logic::Vars::DekuBabaSticks, {[]{return logic->DekuBabaSticks || (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->Boomerang);}}),
+                  EventAccess(&Logic::Vars::DekuBabaNuts,   {[]{return logic->DekuBabaNuts   || (logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->CanUse(BOW) || logic->CanUse(MEGATON_HAMMER) || logic->HasExplosives || logic->CanUse(DINS_FIRE));},
+                                    /*Glitched*/[]{return logic->CanUse(MEGATON_HAMMER);}}),
                 }, {
                   //Locations
                   LocationAccess(DEKU_TREE_BASEMENT_CHEST,    {[]{return true;}}),
-                  LocationAccess(DEKU_TREE_GS_BASEMENT_GATE,  {[]{return CanJumpslash || CanUse(SLINGSHOT) || CanUse(BOOMERANG) || HasExplosives || CanUse(BOW) || CanUse(HOOKSHOT) || CanUse(DINS_FIRE);}}),
-                  LocationAccess(DEKU_TREE_GS_BASEMENT_VINES, {[]{return CanUseProjectile || CanUse(DINS_FIRE) || (LogicDekuBasementGS && CanJumpslash);}}),
+                  LocationAccess(DEKU_TREE_GS_BASEMENT_GATE,  {[]{return logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->CanUse(BOOMERANG) || logic->HasExplosives || logic->CanUse(BOW) || logic->CanUse(HOOKSHOT) || logic->CanUse(DINS_FIRE);}}),
+                  LocationAccess(DEKU_TREE_GS_BASEMENT_VINES, {[]{return logic->CanUseProjectile || logic->CanUse(DINS_FIRE) || (settings->LogicDekuBasementGS && logic->CanJumpslash);}}),
                 }, {
                   //Exits
                   Entrance(DEKU_TREE_LOBBY,               {[]{return true;}}),
-                  Entrance(DEKU_TREE_BASEMENT_SCRUB_ROOM, {[]{return Here(DEKU_TREE_BASEMENT_LOWER, []{return HasFireSourceWithTorch || CanUse(BOW);});}}),
-                  Entrance(DEKU_TREE_BASEMENT_UPPER,      {[]{return IsAdult || LogicDekuB1Skip || HasAccessTo(DEKU_TREE_BASEMENT_UPPER);}}),
+                  Entrance(DEKU_TREE_BASEMENT_SCRUB_ROOM, {[]{return Here(DEKU_TREE_BASEMENT_LOWER, []{return logic->HasFireSourceWithTorch || logic->CanUse(BOW);});}}),
+                  Entrance(DEKU_TREE_BASEMENT_UPPER,      {[]{return logic->IsAdult || settings->LogicDekuB1Skip || HasAccessTo(DEKU_TREE_BASEMENT_UPPER);}}),
                   Entrance(DEKU_TREE_OUTSIDE_BOSS_ROOM,   {[]{return false;}}),
   });
 
-  areaTable[DEKU_TREE_BASEMENT_SCRUB_ROOM] = Area("Deku Tree Basement Scrub Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[DEKU_TREE_BASEMENT_SCRUB_ROOM] = Area("Deku Tree Basement Scrub Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(DEKU_TREE_BASEMENT_LOWER,      {[]{return true;}}),
-                  Entrance(DEKU_TREE_BASEMENT_WATER_ROOM, {[]{return Here(DEKU_TREE_BASEMENT_SCRUB_ROOM, []{return CanUse(SLINGSHOT) || CanUse(BOW);});}}),
+                  Entrance(DEKU_TREE_BASEMENT_WATER_ROOM, {[]{return Here(DEKU_TREE_BASEMENT_SCRUB_ROOM, []{return logic->CanUse(SLINGSHOT) || logic->CanUse(BOW);});}}),
   });
 
-  areaTable[DEKU_TREE_BASEMENT_WATER_ROOM] = Area("Deku Tree Basement Water Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[DEKU_TREE_BASEMENT_WATER_ROOM] = Area("Deku Tree Basement Water Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(DEKU_TREE_BASEMENT_SCRUB_ROOM, {[]{return true;}}),
                   Entrance(DEKU_TREE_BASEMENT_TORCH_ROOM, {[]{return true;}}),
   });
 
-  areaTable[DEKU_TREE_BASEMENT_TORCH_ROOM] = Area("Deku Tree Basement Torch Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[DEKU_TREE_BASEMENT_TORCH_ROOM] = Area("Deku Tree Basement Torch Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&DekuBabaSticks, {[]{return DekuBabaSticks || (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(BOOMERANG));}}),
-                  EventAccess(&DekuBabaNuts,   {[]{return DekuBabaNuts   || (CanJumpslash || CanUse(SLINGSHOT) || CanUse(BOW) || CanUse(MEGATON_HAMMER) || HasExplosives || CanUse(DINS_FIRE));}}),
+                  EventAccess(&Logic::Vars::DekuBabaSticks, {[]{return logic->DekuBabaSticks || (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(BOOMERANG));}}),
+                  EventAccess(&Logic::Vars::DekuBabaNuts,   {[]{return logic->DekuBabaNuts   || (logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->CanUse(BOW) || logic->CanUse(MEGATON_HAMMER) || logic->HasExplosives || logic->CanUse(DINS_FIRE));}}),
                 }, {}, {
                   //Exits
                   Entrance(DEKU_TREE_BASEMENT_WATER_ROOM, {[]{return true;}}),
-                  Entrance(DEKU_TREE_BASEMENT_BACK_LOBBY, {[]{return Here(DEKU_TREE_BASEMENT_TORCH_ROOM, []{return HasFireSourceWithTorch || CanUse(BOW);});}}),
+                  Entrance(DEKU_TREE_BASEMENT_BACK_LOBBY, {[]{return Here(DEKU_TREE_BASEMENT_TORCH_ROOM, []{return logic->HasFireSourceWithTorch || logic->CanUse(BOW);});}}),
   });
 
-  areaTable[DEKU_TREE_BASEMENT_BACK_LOBBY] = Area("Deku Tree Basement Back Lobby", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[DEKU_TREE_BASEMENT_BACK_LOBBY] = Area("Deku Tree Basement Back Lobby", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&DekuBabaSticks, {[]{return DekuBabaSticks || (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(BOOMERANG));}}),
-                  EventAccess(&DekuBabaNuts,   {[]{return DekuBabaNuts   || (Here(DEKU_TREE_BASEMENT_BACK_LOBBY, []{return HasFireSourceWithTorch || CanUse(BOW);}) &&
-                                                                            (CanJumpslash || CanUse(SLINGSHOT) || CanUse(BOW) || CanUse(MEGATON_HAMMER) || HasExplosives || CanUse(DINS_FIRE)));}}),
+                  EventAccess(&Logic::Vars::DekuBabaSticks, {[]{return logic->DekuBabaSticks || (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(BOOMERANG));}}),
+                  EventAccess(&Logic::Vars::DekuBabaNuts,   {[]{return logic->DekuBabaNuts   || (Here(DEKU_TREE_BASEMENT_BACK_LOBBY, []{return logic->HasFireSourceWithTorch || logic->CanUse(BOW);}) &&
+                                                                            (logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->CanUse(BOW) || logic->CanUse(MEGATON_HAMMER) || logic->HasExplosives || logic->CanUse(DINS_FIRE)));}}),
                 }, {}, {
                   //Exits
                   Entrance(DEKU_TREE_BASEMENT_TORCH_ROOM, {[]{return true;}}),
-                  Entrance(DEKU_TREE_BASEMENT_BACK_ROOM,  {[]{return Here(DEKU_TREE_BASEMENT_BACK_LOBBY, []{return HasFireSourceWithTorch || CanUse(Bow);}) &&
-                                                                     Here(DEKU_TREE_BASEMENT_BACK_LOBBY, []{return CanBlastOrSmash;});}}),
-                  Entrance(DEKU_TREE_BASEMENT_UPPER,      {[]{return Here(DEKU_TREE_BASEMENT_BACK_LOBBY, []{return HasFireSourceWithTorch || CanUse(Bow);}) && IsChild;}}),
+                  Entrance(DEKU_TREE_BASEMENT_BACK_ROOM,  {[]{return Here(DEKU_TREE_BASEMENT_BACK_LOBBY, []{return logic->HasFireSourceWithTorch || logic->CanUse(logic->Bow);}) &&
+                                                                     Here(DEKU_TREE_BASEMENT_BACK_LOBBY, []{return logic->CanBlastOrSmash;});}}),
+                  Entrance(DEKU_TREE_BASEMENT_UPPER,      {[]{return Here(DEKU_TREE_BASEMENT_BACK_LOBBY, []{return logic->HasFireSourceWithTorch || logic->CanUse(logic->Bow);}) && logic->IsChild;}}),
   });
 
-  areaTable[DEKU_TREE_BASEMENT_BACK_ROOM] = Area("Deku Tree Basement Back Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[DEKU_TREE_BASEMENT_BACK_ROOM] = Area("Deku Tree Basement Back Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(DEKU_TREE_GS_BASEMENT_BACK_ROOM, {[]{return HookshotOrBoomerang;}}),
+                  LocationAccess(DEKU_TREE_GS_BASEMENT_BACK_ROOM, {[]{return logic->HookshotOrBoomerang;}}),
                 }, {
                   //Exits
                   Entrance(DEKU_TREE_BASEMENT_BACK_LOBBY, {[]{return true;}}),
   });
 
-  areaTable[DEKU_TREE_BASEMENT_UPPER] = Area("Deku Tree Basement Upper", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[DEKU_TREE_BASEMENT_UPPER] = Area("Deku Tree Basement Upper", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&DekuBabaSticks, {[]{return DekuBabaSticks || (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(BOOMERANG));}}),
-                  EventAccess(&DekuBabaNuts,   {[]{return DekuBabaNuts   || (CanJumpslash || CanUse(SLINGSHOT) || CanUse(BOW) || CanUse(MEGATON_HAMMER) || HasExplosives || CanUse(DINS_FIRE));}}),
+                  EventAccess(&Logic::Vars::DekuBabaSticks, {[]{return logic->DekuBabaSticks || (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(BOOMERANG));}}),
+                  EventAccess(&Logic::Vars::DekuBabaNuts,   {[]{return logic->DekuBabaNuts   || (logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->CanUse(BOW) || logic->CanUse(MEGATON_HAMMER) || logic->HasExplosives || logic->CanUse(DINS_FIRE));}}),
                 }, {}, {
                   //Exits
                   Entrance(DEKU_TREE_BASEMENT_LOWER,      {[]{return true;}}),
-                  Entrance(DEKU_TREE_BASEMENT_BACK_LOBBY, {[]{return IsChild;}}),
-                  Entrance(DEKU_TREE_OUTSIDE_BOSS_ROOM,   {[]{return Here(DEKU_TREE_BASEMENT_UPPER, []{return HasFireSourceWithTorch || (LogicDekuB1WebsWithBow && IsAdult && CanUse(BOW));});}}),
+                  Entrance(DEKU_TREE_BASEMENT_BACK_LOBBY, {[]{return logic->IsChild;}}),
+                  Entrance(DEKU_TREE_OUTSIDE_BOSS_ROOM,   {[]{return Here(DEKU_TREE_BASEMENT_UPPER, []{return logic->HasFireSourceWithTorch || (settings->LogicDekuB1WebsWithBow && logic->IsAdult && logic->CanUse(BOW));});}}),
   });
 
-  areaTable[DEKU_TREE_OUTSIDE_BOSS_ROOM] = Area("Deku Tree Outside Boss Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[DEKU_TREE_OUTSIDE_BOSS_ROOM] = Area("Deku Tree Outside Boss Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(DEKU_TREE_BASEMENT_UPPER, {[]{return true;}}),
-                  Entrance(DEKU_TREE_BOSS_ENTRYWAY,  {[]{return Here(DEKU_TREE_OUTSIDE_BOSS_ROOM, []{return HasShield;});}}),
+                  Entrance(DEKU_TREE_BOSS_ENTRYWAY,  {[]{return Here(DEKU_TREE_OUTSIDE_BOSS_ROOM, []{return logic->HasShield;});}}),
   });
   }
 
   /*---------------------------
   |   MASTER QUEST DUNGEON    |
   ---------------------------*/
-  if (Dungeon::DekuTree.IsMQ()) {
-  areaTable[DEKU_TREE_MQ_LOBBY] = Area("Deku Tree MQ Lobby", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {
+  if (world->dungeons.DekuTree.IsMQ()) {
+  world->areaTable[DEKU_TREE_MQ_LOBBY] = Area("Deku Tree MQ Lobby", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&DekuBabaSticks, {[]{return DekuBabaSticks || (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(BOOMERANG));}}),
-                  EventAccess(&DekuBabaNuts,   {[]{return DekuBabaNuts   || (CanJumpslash || CanUse(SLINGSHOT) || CanUse(BOW) || CanUse(MEGATON_HAMMER) || HasExplosives || CanUse(DINS_FIRE));}}),
+                  EventAccess(&Logic::Vars::DekuBabaSticks, {[]{return logic->DekuBabaSticks || (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(BOOMERANG));}}),
+                  EventAccess(&Logic::Vars::DekuBabaNuts,   {[]{return logic->DekuBabaNuts   || (logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->CanUse(BOW) || logic->CanUse(MEGATON_HAMMER) || logic->HasExplosives || logic->CanUse(DINS_FIRE));}}),
   }, {
                   //Locations
                   LocationAccess(DEKU_TREE_MQ_MAP_CHEST,                 {[]{return true;}}),
-                  LocationAccess(DEKU_TREE_MQ_SLINGSHOT_CHEST,           {[]{return CanAdultAttack || CanChildAttack;}}),
-                  LocationAccess(DEKU_TREE_MQ_SLINGSHOT_ROOM_BACK_CHEST, {[]{return HasFireSourceWithTorch || (IsAdult && CanUse(BOW));}}),
-                  LocationAccess(DEKU_TREE_MQ_BASEMENT_CHEST,            {[]{return HasFireSourceWithTorch || (IsAdult && CanUse(BOW));}}),
-                  LocationAccess(DEKU_TREE_MQ_GS_LOBBY,                  {[]{return CanAdultAttack || CanChildAttack;}}),
+                  LocationAccess(DEKU_TREE_MQ_SLINGSHOT_CHEST,           {[]{return logic->CanAdultAttack || logic->CanChildAttack;}}),
+                  LocationAccess(DEKU_TREE_MQ_SLINGSHOT_ROOM_BACK_CHEST, {[]{return logic->HasFireSourceWithTorch || (logic->IsAdult && logic->CanUse(BOW));}}),
+                  LocationAccess(DEKU_TREE_MQ_BASEMENT_CHEST,            {[]{return logic->HasFireSourceWithTorch || (logic->IsAdult && logic->CanUse(BOW));}}),
+                  LocationAccess(DEKU_TREE_MQ_GS_LOBBY,                  {[]{return logic->CanAdultAttack || logic->CanChildAttack;}}),
   }, {
                   //Exits
                   Entrance(DEKU_TREE_ENTRYWAY,                     {[]{return true;}}),
-                  Entrance(DEKU_TREE_MQ_COMPASS_ROOM,              {[]{return Here(DEKU_TREE_MQ_LOBBY, []{return (IsChild && CanUse(SLINGSHOT)) || (IsAdult && CanUse(BOW));}) &&
-                                                                               Here(DEKU_TREE_MQ_LOBBY, []{return HasFireSourceWithTorch || (IsAdult && CanUse(BOW));});}}),
-                  Entrance(DEKU_TREE_MQ_BASEMENT_WATER_ROOM_FRONT, {[]{return Here(DEKU_TREE_MQ_LOBBY, []{return (IsChild && CanUse(SLINGSHOT)) || (IsAdult && CanUse(BOW));}) &&
-                                                                               Here(DEKU_TREE_MQ_LOBBY, []{return HasFireSourceWithTorch;});}}),
-                  Entrance(DEKU_TREE_MQ_BASEMENT_LEDGE,            {[]{return LogicDekuB1Skip || Here(DEKU_TREE_MQ_LOBBY, []{return IsAdult;});}}),
+                  Entrance(DEKU_TREE_MQ_COMPASS_ROOM,              {[]{return Here(DEKU_TREE_MQ_LOBBY, []{return (logic->IsChild && logic->CanUse(SLINGSHOT)) || (logic->IsAdult && logic->CanUse(BOW));}) &&
+                                                                               Here(DEKU_TREE_MQ_LOBBY, []{return logic->HasFireSourceWithTorch || (logic->IsAdult && logic->CanUse(BOW));});}}),
+                  Entrance(DEKU_TREE_MQ_BASEMENT_WATER_ROOM_FRONT, {[]{return Here(DEKU_TREE_MQ_LOBBY, []{return (logic->IsChild && logic->CanUse(SLINGSHOT)) || (logic->IsAdult && logic->CanUse(BOW));}) &&
+                                                                               Here(DEKU_TREE_MQ_LOBBY, []{return logic->HasFireSourceWithTorch;});}}),
+                  Entrance(DEKU_TREE_MQ_BASEMENT_LEDGE,            {[]{return settings->LogicDekuB1Skip || Here(DEKU_TREE_MQ_LOBBY, []{return logic->IsAdult;});}}),
   });
 
-  areaTable[DEKU_TREE_MQ_COMPASS_ROOM] = Area("Deku Tree MQ Compass Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[DEKU_TREE_MQ_COMPASS_ROOM] = Area("Deku Tree MQ Compass Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(DEKU_TREE_MQ_COMPASS_CHEST,   {[]{return true;}}),
-                  LocationAccess(DEKU_TREE_MQ_GS_COMPASS_ROOM, {[]{return HookshotOrBoomerang &&
-                                                                               Here(DEKU_TREE_MQ_COMPASS_ROOM, []{return HasBombchus ||
-                                                                               (Bombs && (CanPlay(SongOfTime) || IsAdult)) ||
-                                                                               (IsAdult && CanUse(MEGATON_HAMMER) && (CanPlay(SongOfTime) || LogicDekuMQCompassGS));});}}),
+                  LocationAccess(DEKU_TREE_MQ_GS_COMPASS_ROOM, {[]{return logic->HookshotOrBoomerang &&
+                                                                               Here(DEKU_TREE_MQ_COMPASS_ROOM, []{return logic->HasBombchus ||
+                                                                               (logic->Bombs && (logic->CanPlay(logic->SongOfTime) || logic->IsAdult)) ||
+                                                                               (logic->IsAdult && logic->CanUse(MEGATON_HAMMER) && (logic->CanPlay(logic->SongOfTime) || settings->LogicDekuMQCompassGS));});}}),
   }, {
                   //Exits
                   Entrance(DEKU_TREE_MQ_LOBBY, {[]{return true;}}),
   });
 
-  areaTable[DEKU_TREE_MQ_BASEMENT_WATER_ROOM_FRONT] = Area("Deku Tree MQ Basement Water Room Front", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[DEKU_TREE_MQ_BASEMENT_WATER_ROOM_FRONT] = Area("Deku Tree MQ Basement Water Room Front", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(DEKU_TREE_MQ_BEFORE_SPINNING_LOG_CHEST, {[]{return true;}}),
   }, {
                   //Exits
-                  Entrance(DEKU_TREE_MQ_BASEMENT_WATER_ROOM_BACK, {[]{return LogicDekuMQLog ||  (IsChild && (DekuShield || HylianShield)) ||
-                                                                             (IsAdult && (CanUse(LONGSHOT) || (CanUse(HOOKSHOT) && CanUse(IRON_BOOTS))));}}),
+                  Entrance(DEKU_TREE_MQ_BASEMENT_WATER_ROOM_BACK, {[]{return settings->LogicDekuMQLog ||  (logic->IsChild && (logic->DekuShield || logic->HylianShield)) ||
+                                                                             (logic->IsAdult && (logic->CanUse(LONGSHOT) || (logic->CanUse(HOOKSHOT) && logic->CanUse(IRON_BOOTS))));}}),
                   Entrance(DEKU_TREE_MQ_LOBBY,                    {[]{return true;}}),
   });
 
-  areaTable[DEKU_TREE_MQ_BASEMENT_WATER_ROOM_BACK] = Area("Deku Tree MQ Basement Water Room Front", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[DEKU_TREE_MQ_BASEMENT_WATER_ROOM_BACK] = Area("Deku Tree MQ Basement Water Room Front", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(DEKU_TREE_MQ_AFTER_SPINNING_LOG_CHEST, {[]{return CanPlay(SongOfTime);}}),
+                  LocationAccess(DEKU_TREE_MQ_AFTER_SPINNING_LOG_CHEST, {[]{return logic->CanPlay(logic->SongOfTime);}}),
   }, {
                   //Exits
-                  Entrance(DEKU_TREE_MQ_BASEMENT_BACK_ROOM,        {[]{return Here(DEKU_TREE_MQ_BASEMENT_WATER_ROOM_BACK, []{return (IsChild && CanUse(STICKS)) || CanUse(DINS_FIRE) ||
-                                                                               Here(DEKU_TREE_MQ_BASEMENT_WATER_ROOM_FRONT, []{return IsAdult && CanUse(FIRE_ARROWS);});}) &&
-                                                                                 Here(DEKU_TREE_MQ_BASEMENT_WATER_ROOM_BACK, []{return CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) ||
-                                                                                  CanUseProjectile || (Nuts && CanUse(STICKS));});}}),
+                  Entrance(DEKU_TREE_MQ_BASEMENT_BACK_ROOM,        {[]{return Here(DEKU_TREE_MQ_BASEMENT_WATER_ROOM_BACK, []{return (logic->IsChild && logic->CanUse(STICKS)) || logic->CanUse(DINS_FIRE) ||
+                                                                               Here(DEKU_TREE_MQ_BASEMENT_WATER_ROOM_FRONT, []{return logic->IsAdult && logic->CanUse(FIRE_ARROWS);});}) &&
+                                                                                 Here(DEKU_TREE_MQ_BASEMENT_WATER_ROOM_BACK, []{return logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) ||
+                                                                                  logic->CanUseProjectile || (logic->Nuts && logic->CanUse(STICKS));});}}),
                   Entrance(DEKU_TREE_MQ_BASEMENT_WATER_ROOM_FRONT, {[]{return true;}}),
   });
 
-  areaTable[DEKU_TREE_MQ_BASEMENT_BACK_ROOM] = Area("Deku Tree MQ Basement Back Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[DEKU_TREE_MQ_BASEMENT_BACK_ROOM] = Area("Deku Tree MQ Basement Back Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(DEKU_TREE_MQ_GS_BASEMENT_GRAVES_ROOM, {[]{return (IsAdult && CanUse(LONGSHOT)) || (CanPlay(SongOfTime) && HookshotOrBoomerang);}}),
-                  LocationAccess(DEKU_TREE_MQ_GS_BASEMENT_BACK_ROOM,   {[]{return HasFireSourceWithTorch && HookshotOrBoomerang;}}),
+                  LocationAccess(DEKU_TREE_MQ_GS_BASEMENT_GRAVES_ROOM, {[]{return (logic->IsAdult && logic->CanUse(LONGSHOT)) || (logic->CanPlay(logic->SongOfTime) && logic->HookshotOrBoomerang);}}),
+                  LocationAccess(DEKU_TREE_MQ_GS_BASEMENT_BACK_ROOM,   {[]{return logic->HasFireSourceWithTorch && logic->HookshotOrBoomerang;}}),
   }, {
                   //Exits
-                  Entrance(DEKU_TREE_MQ_BASEMENT_LEDGE,           {[]{return IsChild;}}),
-                  Entrance(DEKU_TREE_MQ_BASEMENT_WATER_ROOM_BACK, {[]{return (IsChild && CanUse(KOKIRI_SWORD)) || CanUseProjectile || (Nuts && (IsChild && CanUse(STICKS)));}}),
+                  Entrance(DEKU_TREE_MQ_BASEMENT_LEDGE,           {[]{return logic->IsChild;}}),
+                  Entrance(DEKU_TREE_MQ_BASEMENT_WATER_ROOM_BACK, {[]{return (logic->IsChild && logic->CanUse(KOKIRI_SWORD)) || logic->CanUseProjectile || (logic->Nuts && (logic->IsChild && logic->CanUse(STICKS)));}}),
   });
 
-  areaTable[DEKU_TREE_MQ_BASEMENT_LEDGE] = Area("Deku Tree MQ Basement Ledge", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[DEKU_TREE_MQ_BASEMENT_LEDGE] = Area("Deku Tree MQ Basement Ledge", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(DEKU_TREE_MQ_DEKU_SCRUB, {[]{return CanStunDeku;}}),
+                  LocationAccess(DEKU_TREE_MQ_DEKU_SCRUB, {[]{return logic->CanStunDeku;}}),
   }, {
                   //Exits
-                  Entrance(DEKU_TREE_MQ_BASEMENT_BACK_ROOM, {[]{return IsChild;}}),
+                  Entrance(DEKU_TREE_MQ_BASEMENT_BACK_ROOM, {[]{return logic->IsChild;}}),
                   Entrance(DEKU_TREE_MQ_LOBBY,              {[]{return true;}}),
                   Entrance(DEKU_TREE_MQ_OUTSIDE_BOSS_ROOM,
-                         { [] { return Here(DEKU_TREE_MQ_BASEMENT_LEDGE, [] { return HasFireSourceWithTorch; }); } }),
+                         { [] { return Here(DEKU_TREE_MQ_BASEMENT_LEDGE, [] { return logic->HasFireSourceWithTorch; }); } }),
   });
 
-    areaTable[DEKU_TREE_MQ_OUTSIDE_BOSS_ROOM] =
+    world->areaTable[DEKU_TREE_MQ_OUTSIDE_BOSS_ROOM] =
             Area("Deku Tree MQ Outside Boss Room", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {},
                  {
                      // Exits
                      Entrance(DEKU_TREE_MQ_BASEMENT_LEDGE, { [] { return true; } }),
                      Entrance(DEKU_TREE_BOSS_ENTRYWAY,
-                              { [] { return Here(DEKU_TREE_MQ_BASEMENT_LEDGE, [] { return HasShield; }); } }),
+                              { [] { return Here(DEKU_TREE_MQ_BASEMENT_LEDGE, [] { return logic->HasShield; }); } }),
                  });
   }
 
     /*---------------------------
     |         BOSS ROOM         |
     ---------------------------*/
-    areaTable[DEKU_TREE_BOSS_ENTRYWAY] =
+    world->areaTable[DEKU_TREE_BOSS_ENTRYWAY] =
         Area("Deku Tree Boss Entryway", "Deku Tree", DEKU_TREE, NO_DAY_NIGHT_CYCLE, {}, {},
              {
                  // Exits
-                 Entrance(DEKU_TREE_OUTSIDE_BOSS_ROOM, { [] { return Dungeon::DekuTree.IsVanilla(); } }),
-                 Entrance(DEKU_TREE_MQ_OUTSIDE_BOSS_ROOM, { [] { return Dungeon::DekuTree.IsMQ(); } }),
+                 Entrance(DEKU_TREE_OUTSIDE_BOSS_ROOM, { [] { return world->dungeons.DekuTree.IsVanilla(); } }),
+                 Entrance(DEKU_TREE_MQ_OUTSIDE_BOSS_ROOM, { [] { return world->dungeons.DekuTree.IsMQ(); } }),
                  Entrance(DEKU_TREE_BOSS_ROOM, { [] { return true; } }),
              });
 
-    areaTable[DEKU_TREE_BOSS_ROOM] =
+    world->areaTable[DEKU_TREE_BOSS_ROOM] =
         Area("Deku Tree Boss Room", "Deku Tree", NONE, NO_DAY_NIGHT_CYCLE,
              {
                  // Events
-                 EventAccess(&DekuTreeClear, { [] {
-                                                  return DekuTreeClear ||
-                                                         (CanJumpslash && (Nuts || CanUse(SLINGSHOT) || CanUse(BOW) ||
-                                                                           HookshotOrBoomerang));
+                 EventAccess(&Logic::Vars::DekuTreeClear, { [] {
+                                                  return logic->DekuTreeClear ||
+                                                         (logic->CanJumpslash && (logic->Nuts || logic->CanUse(SLINGSHOT) || logic->CanUse(BOW) ||
+                                                                           logic->HookshotOrBoomerang));
                                               }}),
              },
              {
                  // Locations
-                 LocationAccess(QUEEN_GOHMA, { [] { return DekuTreeClear; } }),
-                 LocationAccess(DEKU_TREE_QUEEN_GOHMA_HEART, { [] { return DekuTreeClear; } }),
+                 LocationAccess(QUEEN_GOHMA, { [] { return logic->DekuTreeClear; } }),
+                 LocationAccess(DEKU_TREE_QUEEN_GOHMA_HEART, { [] { return logic->DekuTreeClear; } }),
              },
              {
                  // Exits
                  Entrance(DEKU_TREE_BOSS_ENTRYWAY, { [] { return true; } }),
-                 Entrance(KF_OUTSIDE_DEKU_TREE, { [] { return DekuTreeClear; } }),
+                 Entrance(KF_OUTSIDE_DEKU_TREE, { [] { return logic->DekuTreeClear; } }),
              });
 }
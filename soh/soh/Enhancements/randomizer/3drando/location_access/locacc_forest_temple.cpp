@@ -2,6 +2,7 @@
 #include "../logic.hpp"
 #include "../entrance.hpp"
 #include "../dungeon.hpp"
+#include "../world.hpp"
 
 using namespace Logic;
 using namespace Settings;
@@ -10,88 +11,88 @@ void AreaTable_Init_ForestTemple() {
   /*--------------------------
   |    VANILLA/MQ DECIDER    |
   ---------------------------*/
-  areaTable[FOREST_TEMPLE_ENTRYWAY] = Area("Forest Temple Entryway", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[FOREST_TEMPLE_ENTRYWAY] = Area("Forest Temple Entryway", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_FIRST_ROOM, {[]{return Dungeon::ForestTemple.IsVanilla();}}),
-                  Entrance(FOREST_TEMPLE_MQ_LOBBY,   {[]{return Dungeon::ForestTemple.IsMQ();}}),
+                  Entrance(FOREST_TEMPLE_FIRST_ROOM, {[]{return world->dungeons.ForestTemple.IsVanilla();}}),
+                  Entrance(FOREST_TEMPLE_MQ_LOBBY,   {[]{return world->dungeons.ForestTemple.IsMQ();}}),
                   Entrance(SACRED_FOREST_MEADOW,     {[]{return true;}}),
   });
 
   /*--------------------------
   |     VANILLA DUNGEON      |
   ---------------------------*/
-  if (Dungeon::ForestTemple.IsVanilla()) {
-  areaTable[FOREST_TEMPLE_FIRST_ROOM] = Area("Forest Temple First Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  if (world->dungeons.ForestTemple.IsVanilla()) {
+  world->areaTable[FOREST_TEMPLE_FIRST_ROOM] = Area("Forest Temple First Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(FOREST_TEMPLE_FIRST_ROOM_CHEST, {[]{return true;}}),
-                  LocationAccess(FOREST_TEMPLE_GS_FIRST_ROOM,    {[]{return (IsAdult && Bombs) || CanUse(BOW) || CanUse(HOOKSHOT) || CanUse(BOOMERANG) || CanUse(SLINGSHOT) || HasBombchus || CanUse(DINS_FIRE) || (LogicForestFirstGS && (CanJumpslash || (IsChild && Bombs)));}}),
+                  LocationAccess(FOREST_TEMPLE_GS_FIRST_ROOM,    {[]{return (logic->IsAdult && logic->Bombs) || logic->CanUse(BOW) || logic->CanUse(HOOKSHOT) || logic->CanUse(BOOMERANG) || logic->CanUse(SLINGSHOT) || logic->HasBombchus || logic->CanUse(DINS_FIRE) || (settings->LogicForestFirstGS && (logic->CanJumpslash || (logic->IsChild && logic->Bombs)));}}),
                 }, {
                   //Exits
                   Entrance(FOREST_TEMPLE_ENTRYWAY,       {[]{return true;}}),
                   Entrance(FOREST_TEMPLE_SOUTH_CORRIDOR, {[]{return true;}}),
   });
 
-  areaTable[FOREST_TEMPLE_SOUTH_CORRIDOR] = Area("Forest Temple South Corridor", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[FOREST_TEMPLE_SOUTH_CORRIDOR] = Area("Forest Temple South Corridor", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(FOREST_TEMPLE_FIRST_ROOM, {[]{return true;}}),
-                  Entrance(FOREST_TEMPLE_LOBBY,      {[]{return CanAdultAttack || CanChildAttack || Nuts;}}),
+                  Entrance(FOREST_TEMPLE_LOBBY,      {[]{return logic->CanAdultAttack || logic->CanChildAttack || logic->Nuts;}}),
   });
 
-  areaTable[FOREST_TEMPLE_LOBBY] = Area("Forest Temple Lobby", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[FOREST_TEMPLE_LOBBY] = Area("Forest Temple Lobby", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&ForestTempleMeg, {[]{return ForestTempleMeg || (ForestTempleJoelle && ForestTempleBeth && ForestTempleAmy && CanUse(BOW));}}),
+                  EventAccess(&Logic::Vars::ForestTempleMeg, {[]{return logic->ForestTempleMeg || (logic->ForestTempleJoelle && logic->ForestTempleBeth && logic->ForestTempleAmy && logic->CanUse(BOW));}}),
                 }, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_GS_LOBBY, {[]{return HookshotOrBoomerang;}}),
+                  LocationAccess(FOREST_TEMPLE_GS_LOBBY, {[]{return logic->HookshotOrBoomerang;}}),
                 }, {
                   //Exits
                   Entrance(FOREST_TEMPLE_SOUTH_CORRIDOR,    {[]{return true;}}),
                   Entrance(FOREST_TEMPLE_NORTH_CORRIDOR,    {[]{return true;}}),
-                  Entrance(FOREST_TEMPLE_NW_OUTDOORS_LOWER, {[]{return CanPlay(SongOfTime) || IsChild;}}),
-                  Entrance(FOREST_TEMPLE_NE_OUTDOORS_LOWER, {[]{return CanUse(BOW) || CanUse(SLINGSHOT);}}),
-                  Entrance(FOREST_TEMPLE_WEST_CORRIDOR,     {[]{return SmallKeys(FOREST_TEMPLE, 1, 5);}}),
+                  Entrance(FOREST_TEMPLE_NW_OUTDOORS_LOWER, {[]{return logic->CanPlay(logic->SongOfTime) || logic->IsChild;}}),
+                  Entrance(FOREST_TEMPLE_NE_OUTDOORS_LOWER, {[]{return logic->CanUse(BOW) || logic->CanUse(SLINGSHOT);}}),
+                  Entrance(FOREST_TEMPLE_WEST_CORRIDOR,     {[]{return logic->SmallKeys(FOREST_TEMPLE, 1, 5);}}),
                   Entrance(FOREST_TEMPLE_EAST_CORRIDOR,     {[]{return false;}}),
-                  Entrance(FOREST_TEMPLE_BOSS_REGION,       {[]{return ForestTempleMeg;}}),
+                  Entrance(FOREST_TEMPLE_BOSS_REGION,       {[]{return logic->ForestTempleMeg;}}),
                   Entrance(FOREST_TEMPLE_BOSS_ENTRYWAY,     {[]{return false;}}),
   });
 
-  areaTable[FOREST_TEMPLE_NORTH_CORRIDOR] = Area("Forest Temple North Corridor", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[FOREST_TEMPLE_NORTH_CORRIDOR] = Area("Forest Temple North Corridor", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(FOREST_TEMPLE_LOBBY,         {[]{return true;}}),
                   Entrance(FOREST_TEMPLE_LOWER_STALFOS, {[]{return true;}}),
   });
 
-  areaTable[FOREST_TEMPLE_LOWER_STALFOS] = Area("Forest Temple Lower Stalfos", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[FOREST_TEMPLE_LOWER_STALFOS] = Area("Forest Temple Lower Stalfos", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&FairyPot, {[]{return true;}}),
+                  EventAccess(&Logic::Vars::FairyPot, {[]{return true;}}),
                 }, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_FIRST_STALFOS_CHEST, {[]{return CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(MEGATON_HAMMER);}}),
+                  LocationAccess(FOREST_TEMPLE_FIRST_STALFOS_CHEST, {[]{return logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(MEGATON_HAMMER);}}),
                 }, {
                   //Exits
                   Entrance(FOREST_TEMPLE_NORTH_CORRIDOR, {[]{return true;}}),
   });
 
-  areaTable[FOREST_TEMPLE_NW_OUTDOORS_LOWER] = Area("Forest Temple NW Outdoors Lower", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[FOREST_TEMPLE_NW_OUTDOORS_LOWER] = Area("Forest Temple NW Outdoors Lower", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&DekuBabaSticks, {[]{return DekuBabaSticks || (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(BOOMERANG));}}),
-                  EventAccess(&DekuBabaNuts,   {[]{return DekuBabaNuts   || (CanJumpslash || CanUse(SLINGSHOT) || CanUse(BOW) || CanUse(MEGATON_HAMMER) || HasExplosives || CanUse(DINS_FIRE));}}),
+                  EventAccess(&Logic::Vars::DekuBabaSticks, {[]{return logic->DekuBabaSticks || (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(BOOMERANG));}}),
+                  EventAccess(&Logic::Vars::DekuBabaNuts,   {[]{return logic->DekuBabaNuts   || (logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->CanUse(BOW) || logic->CanUse(MEGATON_HAMMER) || logic->HasExplosives || logic->CanUse(DINS_FIRE));}}),
                 }, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_GS_LEVEL_ISLAND_COURTYARD, {[]{return CanUse(LONGSHOT) || Here(FOREST_TEMPLE_NW_OUTDOORS_UPPER, []{return HookshotOrBoomerang;});}}),
+                  LocationAccess(FOREST_TEMPLE_GS_LEVEL_ISLAND_COURTYARD, {[]{return logic->CanUse(LONGSHOT) || Here(FOREST_TEMPLE_NW_OUTDOORS_UPPER, []{return logic->HookshotOrBoomerang;});}}),
                 }, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_LOBBY,             {[]{return CanPlay(SongOfTime);}}),
+                  Entrance(FOREST_TEMPLE_LOBBY,             {[]{return logic->CanPlay(logic->SongOfTime);}}),
                   Entrance(FOREST_TEMPLE_NW_OUTDOORS_UPPER, {[]{return false;}}),
                   Entrance(FOREST_TEMPLE_MAP_ROOM,          {[]{return true;}}),
-                  Entrance(FOREST_TEMPLE_SEWER,             {[]{return GoldScale || CanUse(IRON_BOOTS) || HasAccessTo(FOREST_TEMPLE_NE_OUTDOORS_UPPER);}}),
+                  Entrance(FOREST_TEMPLE_SEWER,             {[]{return logic->GoldScale || logic->CanUse(IRON_BOOTS) || HasAccessTo(FOREST_TEMPLE_NE_OUTDOORS_UPPER);}}),
                   Entrance(FOREST_TEMPLE_BOSS_ENTRYWAY,     {[]{return false;}}),
   });
 
-  areaTable[FOREST_TEMPLE_NW_OUTDOORS_UPPER] = Area("Forest Temple NW Outdoors Upper", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[FOREST_TEMPLE_NW_OUTDOORS_UPPER] = Area("Forest Temple NW Outdoors Upper", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&DekuBabaSticks, {[]{return DekuBabaSticks || (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(BOOMERANG));}}),
-                  EventAccess(&DekuBabaNuts,   {[]{return DekuBabaNuts   || (CanJumpslash || CanUse(SLINGSHOT) || CanUse(BOW) || CanUse(MEGATON_HAMMER) || HasExplosives || CanUse(DINS_FIRE));}}),
+                  EventAccess(&Logic::Vars::DekuBabaSticks, {[]{return logic->DekuBabaSticks || (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(BOOMERANG));}}),
+                  EventAccess(&Logic::Vars::DekuBabaNuts,   {[]{return logic->DekuBabaNuts   || (logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->CanUse(BOW) || logic->CanUse(MEGATON_HAMMER) || logic->HasExplosives || logic->CanUse(DINS_FIRE));}}),
                 }, {}, {
                   //Exits
                   Entrance(FOREST_TEMPLE_NW_OUTDOORS_LOWER,    {[]{return true;}}),
@@ -100,43 +101,43 @@ void AreaTable_Init_ForestTemple() {
                   Entrance(FOREST_TEMPLE_BLOCK_PUSH_ROOM,      {[]{return true;}}),
   });
 
-  areaTable[FOREST_TEMPLE_NE_OUTDOORS_LOWER] = Area("Forest Temple NE Outdoors Lower", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[FOREST_TEMPLE_NE_OUTDOORS_LOWER] = Area("Forest Temple NE Outdoors Lower", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&DekuBabaSticks, {[]{return DekuBabaSticks || (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(BOOMERANG));}}),
-                  EventAccess(&DekuBabaNuts,   {[]{return DekuBabaNuts   || (CanJumpslash || CanUse(SLINGSHOT) || CanUse(BOW) || CanUse(MEGATON_HAMMER) || HasExplosives || CanUse(DINS_FIRE));}}),
+                  EventAccess(&Logic::Vars::DekuBabaSticks, {[]{return logic->DekuBabaSticks || (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(BOOMERANG));}}),
+                  EventAccess(&Logic::Vars::DekuBabaNuts,   {[]{return logic->DekuBabaNuts   || (logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->CanUse(BOW) || logic->CanUse(MEGATON_HAMMER) || logic->HasExplosives || logic->CanUse(DINS_FIRE));}}),
                 }, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_RAISED_ISLAND_COURTYARD_CHEST, {[]{return CanUse(HOOKSHOT) || HasAccessTo(FOREST_TEMPLE_FALLING_ROOM) || (HasAccessTo(FOREST_TEMPLE_NE_OUTDOORS_UPPER) && IsAdult && LogicForestOutdoorsLedge && HoverBoots);}}),
-                  LocationAccess(FOREST_TEMPLE_GS_RAISED_ISLAND_COURTYARD,    {[]{return CanUse(HOOKSHOT) || (LogicForestOutdoorEastGS && CanUse(BOOMERANG)) || Here(FOREST_TEMPLE_FALLING_ROOM, []{return CanUse(BOW) || CanUse(SLINGSHOT) || CanUse(DINS_FIRE) || HasExplosives;});}}),
+                  LocationAccess(FOREST_TEMPLE_RAISED_ISLAND_COURTYARD_CHEST, {[]{return logic->CanUse(HOOKSHOT) || HasAccessTo(FOREST_TEMPLE_FALLING_ROOM) || (HasAccessTo(FOREST_TEMPLE_NE_OUTDOORS_UPPER) && logic->IsAdult && settings->LogicForestOutdoorsLedge && logic->HoverBoots);}}),
+                  LocationAccess(FOREST_TEMPLE_GS_RAISED_ISLAND_COURTYARD,    {[]{return logic->CanUse(HOOKSHOT) || (settings->LogicForestOutdoorEastGS && logic->CanUse(BOOMERANG)) || Here(FOREST_TEMPLE_FALLING_ROOM, []{return logic->CanUse(BOW) || logic->CanUse(SLINGSHOT) || logic->CanUse(DINS_FIRE) || logic->HasExplosives;});}}),
                 }, {
                   //Exits
                   Entrance(FOREST_TEMPLE_LOBBY,             {[]{return true;}}),
-                  Entrance(FOREST_TEMPLE_NE_OUTDOORS_UPPER, {[]{return CanUse(LONGSHOT) || (LogicForestVines && CanUse(HOOKSHOT));}}),
-                  Entrance(FOREST_TEMPLE_SEWER,             {[]{return GoldScale || CanUse(IRON_BOOTS) || HasAccessTo(FOREST_TEMPLE_NE_OUTDOORS_UPPER);}}),
+                  Entrance(FOREST_TEMPLE_NE_OUTDOORS_UPPER, {[]{return logic->CanUse(LONGSHOT) || (settings->LogicForestVines && logic->CanUse(HOOKSHOT));}}),
+                  Entrance(FOREST_TEMPLE_SEWER,             {[]{return logic->GoldScale || logic->CanUse(IRON_BOOTS) || HasAccessTo(FOREST_TEMPLE_NE_OUTDOORS_UPPER);}}),
                   Entrance(FOREST_TEMPLE_FALLING_ROOM,      {[]{return false;}}),
   });
 
-  areaTable[FOREST_TEMPLE_NE_OUTDOORS_UPPER] = Area("Forest Temple NE Outdoors Upper", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[FOREST_TEMPLE_NE_OUTDOORS_UPPER] = Area("Forest Temple NE Outdoors Upper", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&DekuBabaSticks, {[]{return DekuBabaSticks || (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(BOOMERANG));}}),
-                  EventAccess(&DekuBabaNuts,   {[]{return DekuBabaNuts   || (CanJumpslash || CanUse(SLINGSHOT) || CanUse(BOW) || CanUse(MEGATON_HAMMER) || HasExplosives || CanUse(DINS_FIRE));}}),
+                  EventAccess(&Logic::Vars::DekuBabaSticks, {[]{return logic->DekuBabaSticks || (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(BOOMERANG));}}),
+                  EventAccess(&Logic::Vars::DekuBabaNuts,   {[]{return logic->DekuBabaNuts   || (logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->CanUse(BOW) || logic->CanUse(MEGATON_HAMMER) || logic->HasExplosives || logic->CanUse(DINS_FIRE));}}),
                 }, {}, {
                   //Exits
                   Entrance(FOREST_TEMPLE_NE_OUTDOORS_LOWER, {[]{return true;}}),
                   Entrance(FOREST_TEMPLE_MAP_ROOM,          {[]{return true;}}),
-                  Entrance(FOREST_TEMPLE_FALLING_ROOM,      {[]{return LogicForestDoorFrame && CanJumpslash && CanUse(HOVER_BOOTS) && CanUse(SCARECROW);}}),
+                  Entrance(FOREST_TEMPLE_FALLING_ROOM,      {[]{return settings->LogicForestDoorFrame && logic->CanJumpslash && logic->CanUse(HOVER_BOOTS) && logic->CanUse(SCARECROW);}}),
   });
 
-  areaTable[FOREST_TEMPLE_MAP_ROOM] = Area("Forest Temple Map Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[FOREST_TEMPLE_MAP_ROOM] = Area("Forest Temple Map Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_MAP_CHEST, {[]{return Here(FOREST_TEMPLE_MAP_ROOM, []{return HasExplosives || CanUse(MEGATON_HAMMER) || CanUse(BOW) || ((CanJumpslash || CanUse(SLINGSHOT)) && (Nuts || HookshotOrBoomerang || CanShield));});}}),
+                  LocationAccess(FOREST_TEMPLE_MAP_CHEST, {[]{return Here(FOREST_TEMPLE_MAP_ROOM, []{return logic->HasExplosives || logic->CanUse(MEGATON_HAMMER) || logic->CanUse(BOW) || ((logic->CanJumpslash || logic->CanUse(SLINGSHOT)) && (logic->Nuts || logic->HookshotOrBoomerang || logic->CanShield));});}}),
                 }, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_NW_OUTDOORS_LOWER, {[]{return Here(FOREST_TEMPLE_MAP_ROOM, []{return HasExplosives || CanUse(MEGATON_HAMMER) || CanUse(BOW) || ((CanJumpslash || CanUse(SLINGSHOT)) && (Nuts || HookshotOrBoomerang || CanShield));});}}),
-                  Entrance(FOREST_TEMPLE_NE_OUTDOORS_UPPER, {[]{return Here(FOREST_TEMPLE_MAP_ROOM, []{return HasExplosives || CanUse(MEGATON_HAMMER) || CanUse(BOW) || ((CanJumpslash || CanUse(SLINGSHOT)) && (Nuts || HookshotOrBoomerang || CanShield));});}}),
+                  Entrance(FOREST_TEMPLE_NW_OUTDOORS_LOWER, {[]{return Here(FOREST_TEMPLE_MAP_ROOM, []{return logic->HasExplosives || logic->CanUse(MEGATON_HAMMER) || logic->CanUse(BOW) || ((logic->CanJumpslash || logic->CanUse(SLINGSHOT)) && (logic->Nuts || logic->HookshotOrBoomerang || logic->CanShield));});}}),
+                  Entrance(FOREST_TEMPLE_NE_OUTDOORS_UPPER, {[]{return Here(FOREST_TEMPLE_MAP_ROOM, []{return logic->HasExplosives || logic->CanUse(MEGATON_HAMMER) || logic->CanUse(BOW) || ((logic->CanJumpslash || logic->CanUse(SLINGSHOT)) && (logic->Nuts || logic->HookshotOrBoomerang || logic->CanShield));});}}),
   });
 
-  areaTable[FOREST_TEMPLE_SEWER] = Area("Forest Temple Sewer", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[FOREST_TEMPLE_SEWER] = Area("Forest Temple Sewer", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(FOREST_TEMPLE_WELL_CHEST, {[]{return HasAccessTo(FOREST_TEMPLE_NE_OUTDOORS_UPPER);}}),
                 }, {
@@ -145,103 +146,103 @@ void AreaTable_Init_ForestTemple() {
                   Entrance(FOREST_TEMPLE_NE_OUTDOORS_LOWER, {[]{return true;}}),
   });
 
-  areaTable[FOREST_TEMPLE_BELOW_BOSS_KEY_CHEST] = Area("Forest Temple Below Boss Key Chest", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[FOREST_TEMPLE_BELOW_BOSS_KEY_CHEST] = Area("Forest Temple Below Boss Key Chest", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_NW_OUTDOORS_UPPER, {[]{return Here(FOREST_TEMPLE_BELOW_BOSS_KEY_CHEST, []{return HasExplosives || CanUse(MEGATON_HAMMER) || CanUse(BOW) || ((CanJumpslash || CanUse(SLINGSHOT)) && (Nuts || HookshotOrBoomerang || CanShield));});}}),
+                  Entrance(FOREST_TEMPLE_NW_OUTDOORS_UPPER, {[]{return Here(FOREST_TEMPLE_BELOW_BOSS_KEY_CHEST, []{return logic->HasExplosives || logic->CanUse(MEGATON_HAMMER) || logic->CanUse(BOW) || ((logic->CanJumpslash || logic->CanUse(SLINGSHOT)) && (logic->Nuts || logic->HookshotOrBoomerang || logic->CanShield));});}}),
   });
 
-  areaTable[FOREST_TEMPLE_FLOORMASTER_ROOM] = Area("Forest Temple Floormaster Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[FOREST_TEMPLE_FLOORMASTER_ROOM] = Area("Forest Temple Floormaster Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_FLOORMASTER_CHEST, {[]{return CanAdultDamage || CanChildDamage;}}),
+                  LocationAccess(FOREST_TEMPLE_FLOORMASTER_CHEST, {[]{return logic->CanAdultDamage || logic->CanChildDamage;}}),
                 }, {
                   //Exits
                   Entrance(FOREST_TEMPLE_NW_OUTDOORS_UPPER, {[]{return true;}}),
   });
 
-  areaTable[FOREST_TEMPLE_WEST_CORRIDOR] = Area("Forest Temple West Corridor", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[FOREST_TEMPLE_WEST_CORRIDOR] = Area("Forest Temple West Corridor", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_LOBBY,           {[]{return SmallKeys(FOREST_TEMPLE, 1, 5);}}),
-                  Entrance(FOREST_TEMPLE_BLOCK_PUSH_ROOM, {[]{return CanAdultAttack || CanChildAttack || Nuts;}}),
+                  Entrance(FOREST_TEMPLE_LOBBY,           {[]{return logic->SmallKeys(FOREST_TEMPLE, 1, 5);}}),
+                  Entrance(FOREST_TEMPLE_BLOCK_PUSH_ROOM, {[]{return logic->CanAdultAttack || logic->CanChildAttack || logic->Nuts;}}),
   });
 
-  areaTable[FOREST_TEMPLE_BLOCK_PUSH_ROOM] = Area("Forest Temple Block Push Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[FOREST_TEMPLE_BLOCK_PUSH_ROOM] = Area("Forest Temple Block Push Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_EYE_SWITCH_CHEST, {[]{return GoronBracelet && (CanUse(BOW) || CanUse(SLINGSHOT));}}),
+                  LocationAccess(FOREST_TEMPLE_EYE_SWITCH_CHEST, {[]{return logic->GoronBracelet && (logic->CanUse(BOW) || logic->CanUse(SLINGSHOT));}}),
                 }, {
                   //Exits
                   Entrance(FOREST_TEMPLE_WEST_CORRIDOR,            {[]{return true;}}),
-                  Entrance(FOREST_TEMPLE_NW_OUTDOORS_UPPER,        {[]{return CanUse(HOVER_BOOTS) || (LogicForestOutsideBackdoor && CanJumpslash && GoronBracelet);}}),
-                  Entrance(FOREST_TEMPLE_NW_CORRIDOR_TWISTED,      {[]{return IsAdult && GoronBracelet && SmallKeys(FOREST_TEMPLE, 2);}}),
-                  Entrance(FOREST_TEMPLE_NW_CORRIDOR_STRAIGHTENED, {[]{return IsAdult && (CanUse(BOW) || CanUse(SLINGSHOT)) && GoronBracelet && SmallKeys(FOREST_TEMPLE, 2);}}),
+                  Entrance(FOREST_TEMPLE_NW_OUTDOORS_UPPER,        {[]{return logic->CanUse(HOVER_BOOTS) || (settings->LogicForestOutsideBackdoor && logic->CanJumpslash && logic->GoronBracelet);}}),
+                  Entrance(FOREST_TEMPLE_NW_CORRIDOR_TWISTED,      {[]{return logic->IsAdult && logic->GoronBracelet && logic->SmallKeys(FOREST_TEMPLE, 2);}}),
+                  Entrance(FOREST_TEMPLE_NW_CORRIDOR_STRAIGHTENED, {[]{return logic->IsAdult && (logic->CanUse(BOW) || logic->CanUse(SLINGSHOT)) && logic->GoronBracelet && logic->SmallKeys(FOREST_TEMPLE, 2);}}),
   });
 
-  areaTable[FOREST_TEMPLE_NW_CORRIDOR_TWISTED] = Area("Forest Temple NW Corridor Twisted", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[FOREST_TEMPLE_NW_CORRIDOR_TWISTED] = Area("Forest Temple NW Corridor Twisted", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_BLOCK_PUSH_ROOM, {[]{return SmallKeys(FOREST_TEMPLE, 2);}}),
-                  Entrance(FOREST_TEMPLE_RED_POE_ROOM,    {[]{return SmallKeys(FOREST_TEMPLE, 3);}}),
+                  Entrance(FOREST_TEMPLE_BLOCK_PUSH_ROOM, {[]{return logic->SmallKeys(FOREST_TEMPLE, 2);}}),
+                  Entrance(FOREST_TEMPLE_RED_POE_ROOM,    {[]{return logic->SmallKeys(FOREST_TEMPLE, 3);}}),
   });
 
-  areaTable[FOREST_TEMPLE_NW_CORRIDOR_STRAIGHTENED] = Area("Forest Temple NW Corridor Straightened", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[FOREST_TEMPLE_NW_CORRIDOR_STRAIGHTENED] = Area("Forest Temple NW Corridor Straightened", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(FOREST_TEMPLE_BOSS_KEY_CHEST, {[]{return true;}}),
                 }, {
                   //Exits
                   Entrance(FOREST_TEMPLE_BELOW_BOSS_KEY_CHEST, {[]{return true;}}),
-                  Entrance(FOREST_TEMPLE_BLOCK_PUSH_ROOM,      {[]{return SmallKeys(FOREST_TEMPLE, 2);}}),
+                  Entrance(FOREST_TEMPLE_BLOCK_PUSH_ROOM,      {[]{return logic->SmallKeys(FOREST_TEMPLE, 2);}}),
   });
 
-  areaTable[FOREST_TEMPLE_RED_POE_ROOM] = Area("Forest Temple Red Poe Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[FOREST_TEMPLE_RED_POE_ROOM] = Area("Forest Temple Red Poe Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&ForestTempleJoelle, {[]{return ForestTempleJoelle || CanUse(BOW);}}),
+                  EventAccess(&Logic::Vars::ForestTempleJoelle, {[]{return logic->ForestTempleJoelle || logic->CanUse(BOW);}}),
                 }, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_RED_POE_CHEST, {[]{return ForestTempleJoelle;}}),
+                  LocationAccess(FOREST_TEMPLE_RED_POE_CHEST, {[]{return logic->ForestTempleJoelle;}}),
                 }, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_NW_CORRIDOR_TWISTED, {[]{return SmallKeys(FOREST_TEMPLE, 3);}}),
+                  Entrance(FOREST_TEMPLE_NW_CORRIDOR_TWISTED, {[]{return logic->SmallKeys(FOREST_TEMPLE, 3);}}),
                   Entrance(FOREST_TEMPLE_UPPER_STALFOS,       {[]{return true;}}),
   });
 
-  areaTable[FOREST_TEMPLE_UPPER_STALFOS] = Area("Forest Temple Upper Stalfos", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[FOREST_TEMPLE_UPPER_STALFOS] = Area("Forest Temple Upper Stalfos", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_BOW_CHEST, {[]{return CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(MEGATON_HAMMER);}}),
+                  LocationAccess(FOREST_TEMPLE_BOW_CHEST, {[]{return logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(MEGATON_HAMMER);}}),
                 }, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_RED_POE_ROOM,  {[]{return CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(MEGATON_HAMMER);}}),
-                  Entrance(FOREST_TEMPLE_BLUE_POE_ROOM, {[]{return CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(MEGATON_HAMMER);}}),
+                  Entrance(FOREST_TEMPLE_RED_POE_ROOM,  {[]{return logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(MEGATON_HAMMER);}}),
+                  Entrance(FOREST_TEMPLE_BLUE_POE_ROOM, {[]{return logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(MEGATON_HAMMER);}}),
   });
 
-  areaTable[FOREST_TEMPLE_BLUE_POE_ROOM] = Area("Forest Temple Blue Poe Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[FOREST_TEMPLE_BLUE_POE_ROOM] = Area("Forest Temple Blue Poe Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&ForestTempleBeth, {[]{return ForestTempleBeth || CanUse(BOW);}}),
+                  EventAccess(&Logic::Vars::ForestTempleBeth, {[]{return logic->ForestTempleBeth || logic->CanUse(BOW);}}),
                 }, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_BLUE_POE_CHEST, {[]{return ForestTempleBeth;}}),
+                  LocationAccess(FOREST_TEMPLE_BLUE_POE_CHEST, {[]{return logic->ForestTempleBeth;}}),
                 }, {
                   //Exits
                   Entrance(FOREST_TEMPLE_UPPER_STALFOS,            {[]{return true;}}),
-                  Entrance(FOREST_TEMPLE_NE_CORRIDOR_STRAIGHTENED, {[]{return SmallKeys(FOREST_TEMPLE, 4);}}),
+                  Entrance(FOREST_TEMPLE_NE_CORRIDOR_STRAIGHTENED, {[]{return logic->SmallKeys(FOREST_TEMPLE, 4);}}),
   });
 
-  areaTable[FOREST_TEMPLE_NE_CORRIDOR_STRAIGHTENED] = Area("Forest Temple NE Corridor Straightened", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[FOREST_TEMPLE_NE_CORRIDOR_STRAIGHTENED] = Area("Forest Temple NE Corridor Straightened", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_BLUE_POE_ROOM,   {[]{return SmallKeys(FOREST_TEMPLE, 4);}}),
-                  Entrance(FOREST_TEMPLE_FROZEN_EYE_ROOM, {[]{return SmallKeys(FOREST_TEMPLE, 5);}}),
+                  Entrance(FOREST_TEMPLE_BLUE_POE_ROOM,   {[]{return logic->SmallKeys(FOREST_TEMPLE, 4);}}),
+                  Entrance(FOREST_TEMPLE_FROZEN_EYE_ROOM, {[]{return logic->SmallKeys(FOREST_TEMPLE, 5);}}),
   });
 
-  areaTable[FOREST_TEMPLE_NE_CORRIDOR_TWISTED] = Area("Forest Temple NE Corridor Twisted", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[FOREST_TEMPLE_NE_CORRIDOR_TWISTED] = Area("Forest Temple NE Corridor Twisted", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_FROZEN_EYE_ROOM, {[]{return SmallKeys(FOREST_TEMPLE, 5);}}),
+                  Entrance(FOREST_TEMPLE_FROZEN_EYE_ROOM, {[]{return logic->SmallKeys(FOREST_TEMPLE, 5);}}),
                   Entrance(FOREST_TEMPLE_FALLING_ROOM,    {[]{return true;}}),
   });
 
-  areaTable[FOREST_TEMPLE_FROZEN_EYE_ROOM] = Area("Forest Temple Frozen Eye Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[FOREST_TEMPLE_FROZEN_EYE_ROOM] = Area("Forest Temple Frozen Eye Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_NE_CORRIDOR_STRAIGHTENED, {[]{return SmallKeys(FOREST_TEMPLE, 5);}}),
-                  Entrance(FOREST_TEMPLE_NE_CORRIDOR_TWISTED,      {[]{return SmallKeys(FOREST_TEMPLE, 5) && (CanUse(BOW) || CanUse(DINS_FIRE));}}),
+                  Entrance(FOREST_TEMPLE_NE_CORRIDOR_STRAIGHTENED, {[]{return logic->SmallKeys(FOREST_TEMPLE, 5);}}),
+                  Entrance(FOREST_TEMPLE_NE_CORRIDOR_TWISTED,      {[]{return logic->SmallKeys(FOREST_TEMPLE, 5) && (logic->CanUse(BOW) || logic->CanUse(DINS_FIRE));}}),
   });
 
-  areaTable[FOREST_TEMPLE_FALLING_ROOM] = Area("Forest Temple Falling Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[FOREST_TEMPLE_FALLING_ROOM] = Area("Forest Temple Falling Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(FOREST_TEMPLE_FALLING_CEILING_ROOM_CHEST, {[]{return true;}}),
                 }, {
@@ -250,143 +251,143 @@ void AreaTable_Init_ForestTemple() {
                   Entrance(FOREST_TEMPLE_GREEN_POE_ROOM,    {[]{return true;}}),
   });
 
-  areaTable[FOREST_TEMPLE_GREEN_POE_ROOM] = Area("Forest Temple Green Poe Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[FOREST_TEMPLE_GREEN_POE_ROOM] = Area("Forest Temple Green Poe Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&ForestTempleAmy, {[]{return ForestTempleAmy || CanUse(BOW);}}),
+                  EventAccess(&Logic::Vars::ForestTempleAmy, {[]{return logic->ForestTempleAmy || logic->CanUse(BOW);}}),
                 }, {}, {
                   //Exits
                   Entrance(FOREST_TEMPLE_FALLING_ROOM,  {[]{return true;}}),
-                  Entrance(FOREST_TEMPLE_EAST_CORRIDOR, {[]{return ForestTempleAmy;}}),
+                  Entrance(FOREST_TEMPLE_EAST_CORRIDOR, {[]{return logic->ForestTempleAmy;}}),
   });
 
-  areaTable[FOREST_TEMPLE_EAST_CORRIDOR] = Area("Forest Temple East Corridor", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[FOREST_TEMPLE_EAST_CORRIDOR] = Area("Forest Temple East Corridor", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_LOBBY,          {[]{return CanAdultAttack || CanChildAttack || Nuts;}}),
-                  Entrance(FOREST_TEMPLE_GREEN_POE_ROOM, {[]{return CanAdultAttack || CanChildAttack || Nuts;}}),
+                  Entrance(FOREST_TEMPLE_LOBBY,          {[]{return logic->CanAdultAttack || logic->CanChildAttack || logic->Nuts;}}),
+                  Entrance(FOREST_TEMPLE_GREEN_POE_ROOM, {[]{return logic->CanAdultAttack || logic->CanChildAttack || logic->Nuts;}}),
   });
 
-  areaTable[FOREST_TEMPLE_BOSS_REGION] = Area("Forest Temple Boss Region", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[FOREST_TEMPLE_BOSS_REGION] = Area("Forest Temple Boss Region", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(FOREST_TEMPLE_BASEMENT_CHEST, {[]{return true;}}),
-                  LocationAccess(FOREST_TEMPLE_GS_BASEMENT,    {[]{return HookshotOrBoomerang;}}),
+                  LocationAccess(FOREST_TEMPLE_GS_BASEMENT,    {[]{return logic->HookshotOrBoomerang;}}),
                 }, {
                   //Exits
                   Entrance(FOREST_TEMPLE_LOBBY,     {[]{return true;}}),
-                  Entrance(FOREST_TEMPLE_BOSS_ENTRYWAY, {[]{return BossKeyForestTemple;}}),
+                  Entrance(FOREST_TEMPLE_BOSS_ENTRYWAY, {[]{return logic->BossKeyForestTemple;}}),
   });
   }
 
   /*---------------------------
   |   MASTER QUEST DUNGEON    |
   ---------------------------*/
-  if (Dungeon::ForestTemple.IsMQ()) {
-  areaTable[FOREST_TEMPLE_MQ_LOBBY] = Area("Forest Temple MQ Lobby", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  if (world->dungeons.ForestTemple.IsMQ()) {
+  world->areaTable[FOREST_TEMPLE_MQ_LOBBY] = Area("Forest Temple MQ Lobby", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_MQ_FIRST_ROOM_CHEST, {[]{return CanJumpslash || Bombs || Nuts || HookshotOrBoomerang || CanUse(DINS_FIRE) || CanUse(SLINGSHOT) || CanUse(BOW) || CanUse(HOVER_BOOTS);}}),
-                  LocationAccess(FOREST_TEMPLE_MQ_GS_FIRST_HALLWAY, {[]{return HookshotOrBoomerang;}}),
+                  LocationAccess(FOREST_TEMPLE_MQ_FIRST_ROOM_CHEST, {[]{return logic->CanJumpslash || logic->Bombs || logic->Nuts || logic->HookshotOrBoomerang || logic->CanUse(DINS_FIRE) || logic->CanUse(SLINGSHOT) || logic->CanUse(BOW) || logic->CanUse(HOVER_BOOTS);}}),
+                  LocationAccess(FOREST_TEMPLE_MQ_GS_FIRST_HALLWAY, {[]{return logic->HookshotOrBoomerang;}}),
   }, {
                   //Exits
                   Entrance(FOREST_TEMPLE_ENTRYWAY,        {[]{return true;}}),
-                  Entrance(FOREST_TEMPLE_MQ_CENTRAL_AREA, {[]{return SmallKeys(FOREST_TEMPLE, 1) && (CanAdultAttack || CanChildAttack || Nuts);}}),
+                  Entrance(FOREST_TEMPLE_MQ_CENTRAL_AREA, {[]{return logic->SmallKeys(FOREST_TEMPLE, 1) && (logic->CanAdultAttack || logic->CanChildAttack || logic->Nuts);}}),
   });
 
-  areaTable[FOREST_TEMPLE_MQ_CENTRAL_AREA] = Area("Forest Temple MQ Central Area", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[FOREST_TEMPLE_MQ_CENTRAL_AREA] = Area("Forest Temple MQ Central Area", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&FairyPot, {[]{return true;}}),
+                  EventAccess(&Logic::Vars::FairyPot, {[]{return true;}}),
   }, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_MQ_WOLFOS_CHEST,       {[]{return (CanPlay(SongOfTime) || IsChild) && (CanJumpslash || CanUse(DINS_FIRE) || CanUse(SLINGSHOT));}}),
-                  LocationAccess(FOREST_TEMPLE_MQ_GS_BLOCK_PUSH_ROOM, {[]{return CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(MEGATON_HAMMER);}}),
+                  LocationAccess(FOREST_TEMPLE_MQ_WOLFOS_CHEST,       {[]{return (logic->CanPlay(logic->SongOfTime) || logic->IsChild) && (logic->CanJumpslash || logic->CanUse(DINS_FIRE) || logic->CanUse(SLINGSHOT));}}),
+                  LocationAccess(FOREST_TEMPLE_MQ_GS_BLOCK_PUSH_ROOM, {[]{return logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(MEGATON_HAMMER);}}),
   }, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_MQ_NW_OUTDOORS,        {[]{return CanUse(BOW) || CanUse(SLINGSHOT);}}),
-                  Entrance(FOREST_TEMPLE_MQ_NE_OUTDOORS,        {[]{return CanUse(BOW) || CanUse(SLINGSHOT);}}), //This is as far as child can get
-                  Entrance(FOREST_TEMPLE_MQ_AFTER_BLOCK_PUZZLE, {[]{return IsAdult && (GoronBracelet || (LogicForestMQBlockPuzzle && HasBombchus && IsAdult && CanUse(HOOKSHOT)));}}),
+                  Entrance(FOREST_TEMPLE_MQ_NW_OUTDOORS,        {[]{return logic->CanUse(BOW) || logic->CanUse(SLINGSHOT);}}),
+                  Entrance(FOREST_TEMPLE_MQ_NE_OUTDOORS,        {[]{return logic->CanUse(BOW) || logic->CanUse(SLINGSHOT);}}), //This is as far as child can get
+                  Entrance(FOREST_TEMPLE_MQ_AFTER_BLOCK_PUZZLE, {[]{return logic->IsAdult && (logic->GoronBracelet || (settings->LogicForestMQBlockPuzzle && logic->HasBombchus && logic->IsAdult && logic->CanUse(HOOKSHOT)));}}),
                     //Trick: IsAdult && (GoronBracelet || (LogicForestMQBlockPuzzle && HasBombchus && IsAdult && CanUse(HOOKSHOT)))
-                  Entrance(FOREST_TEMPLE_MQ_OUTDOOR_LEDGE,      {[]{return (LogicForestMQHallwaySwitchJS && IsAdult && CanUse(HOVER_BOOTS)) || (LogicForestMQHallwaySwitchBoomerang && CanUse(BOOMERANG)) || (LogicForestMQHallwaySwitchHookshot && IsAdult && CanUse(HOOKSHOT));}}),
+                  Entrance(FOREST_TEMPLE_MQ_OUTDOOR_LEDGE,      {[]{return (settings->LogicForestMQHallwaySwitchJS && logic->IsAdult && logic->CanUse(HOVER_BOOTS)) || (settings->LogicForestMQHallwaySwitchBoomerang && logic->CanUse(BOOMERANG)) || (settings->LogicForestMQHallwaySwitchHookshot && logic->IsAdult && logic->CanUse(HOOKSHOT));}}),
                     //Trick (Hookshot trick not added to either n64 or oot3d rando as of yet, to enable in SoH needs uncommenting in randomizer_tricks.cpp): (LogicForestMQHallwaySwitchJS && IsAdult && CanUse(HOVER_BOOTS)) || (LogicForestMQHallwaySwitchHookshot && IsAdult && CanUse(HOOKSHOT)) 
-                  Entrance(FOREST_TEMPLE_MQ_BOSS_REGION,        {[]{return ForestTempleJoAndBeth && ForestTempleAmyAndMeg;}}),
+                  Entrance(FOREST_TEMPLE_MQ_BOSS_REGION,        {[]{return logic->ForestTempleJoAndBeth && logic->ForestTempleAmyAndMeg;}}),
   });
 
-  areaTable[FOREST_TEMPLE_MQ_AFTER_BLOCK_PUZZLE] = Area("Forest Temple MQ After Block Puzzle", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[FOREST_TEMPLE_MQ_AFTER_BLOCK_PUZZLE] = Area("Forest Temple MQ After Block Puzzle", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_MQ_BOSS_KEY_CHEST, {[]{return SmallKeys(FOREST_TEMPLE, 3);}}),
+                  LocationAccess(FOREST_TEMPLE_MQ_BOSS_KEY_CHEST, {[]{return logic->SmallKeys(FOREST_TEMPLE, 3);}}),
   }, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_MQ_BOW_REGION,    {[]{return SmallKeys(FOREST_TEMPLE, 4);}}),
-                  Entrance(FOREST_TEMPLE_MQ_OUTDOOR_LEDGE, {[]{return  SmallKeys(FOREST_TEMPLE, 3) || (LogicForestMQHallwaySwitchJS && ((IsAdult && CanUse(HOOKSHOT)) || (LogicForestOutsideBackdoor && (IsAdult || (IsChild && CanUse(STICKS))))));}}),
+                  Entrance(FOREST_TEMPLE_MQ_BOW_REGION,    {[]{return logic->SmallKeys(FOREST_TEMPLE, 4);}}),
+                  Entrance(FOREST_TEMPLE_MQ_OUTDOOR_LEDGE, {[]{return  logic->SmallKeys(FOREST_TEMPLE, 3) || (settings->LogicForestMQHallwaySwitchJS && ((logic->IsAdult && logic->CanUse(HOOKSHOT)) || (settings->LogicForestOutsideBackdoor && (logic->IsAdult || (logic->IsChild && logic->CanUse(STICKS))))));}}),
                     //Trick (Doing the hallway switch jumpslash as child requires sticks and has been added above): SmallKeys(FOREST_TEMPLE, 3) || (LogicForestMQHallwaySwitchJS && ((IsAdult && CanUse(HOOKSHOT)) || LogicForestOutsideBackdoor))
-                  Entrance(FOREST_TEMPLE_MQ_NW_OUTDOORS,   {[]{return SmallKeys(FOREST_TEMPLE, 2);}}),
+                  Entrance(FOREST_TEMPLE_MQ_NW_OUTDOORS,   {[]{return logic->SmallKeys(FOREST_TEMPLE, 2);}}),
   });
 
-  areaTable[FOREST_TEMPLE_MQ_OUTDOOR_LEDGE] = Area("Forest Temple MQ Outdoor Ledge", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[FOREST_TEMPLE_MQ_OUTDOOR_LEDGE] = Area("Forest Temple MQ Outdoor Ledge", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_MQ_REDEAD_CHEST, {[]{return CanJumpslash;}}),
+                  LocationAccess(FOREST_TEMPLE_MQ_REDEAD_CHEST, {[]{return logic->CanJumpslash;}}),
   }, {
                   //Exits
                   Entrance(FOREST_TEMPLE_MQ_NW_OUTDOORS, {[]{return true;}}),
   });
 
-  areaTable[FOREST_TEMPLE_MQ_NW_OUTDOORS] = Area("Forest Temple MQ NW Outdoors", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[FOREST_TEMPLE_MQ_NW_OUTDOORS] = Area("Forest Temple MQ NW Outdoors", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_MQ_GS_LEVEL_ISLAND_COURTYARD, {[]{return CanAdultAttack || CanChildAttack;}}),
+                  LocationAccess(FOREST_TEMPLE_MQ_GS_LEVEL_ISLAND_COURTYARD, {[]{return logic->CanAdultAttack || logic->CanChildAttack;}}),
   }, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_MQ_NE_OUTDOORS,         {[]{return (IsAdult && (CanUse(IRON_BOOTS) || CanUse(LONGSHOT) || (LogicForestMQWellSwim && CanUse(HOOKSHOT)))) || ProgressiveScale >= 2;}}),
+                  Entrance(FOREST_TEMPLE_MQ_NE_OUTDOORS,         {[]{return (logic->IsAdult && (logic->CanUse(IRON_BOOTS) || logic->CanUse(LONGSHOT) || (settings->LogicForestMQWellSwim && logic->CanUse(HOOKSHOT)))) || logic->ProgressiveScale >= 2;}}),
                     //Trick: (IsAdult && (CanUse(IRON_BOOTS) || CanUse(LONGSHOT) || (LogicForestMQWellSwim && CanUse(HOOKSHOT)))) || ProgressiveScale >= 2
-                  Entrance(FOREST_TEMPLE_MQ_OUTDOORS_TOP_LEDGES, {[]{return IsAdult && CanUse(FIRE_ARROWS);}}),
+                  Entrance(FOREST_TEMPLE_MQ_OUTDOORS_TOP_LEDGES, {[]{return logic->IsAdult && logic->CanUse(FIRE_ARROWS);}}),
   });
 
-  areaTable[FOREST_TEMPLE_MQ_NE_OUTDOORS] = Area("Forest Temple MQ NE Outdoors", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[FOREST_TEMPLE_MQ_NE_OUTDOORS] = Area("Forest Temple MQ NE Outdoors", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&DekuBabaSticks, {[]{return DekuBabaSticks || (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(BOOMERANG));}}),
-                  EventAccess(&DekuBabaNuts,   {[]{return DekuBabaNuts   || (CanJumpslash || CanUse(SLINGSHOT) || CanUse(BOW) || CanUse(MEGATON_HAMMER) || HasExplosives || CanUse(DINS_FIRE));}}),
+                  EventAccess(&Logic::Vars::DekuBabaSticks, {[]{return logic->DekuBabaSticks || (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(BOOMERANG));}}),
+                  EventAccess(&Logic::Vars::DekuBabaNuts,   {[]{return logic->DekuBabaNuts   || (logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->CanUse(BOW) || logic->CanUse(MEGATON_HAMMER) || logic->HasExplosives || logic->CanUse(DINS_FIRE));}}),
   }, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_MQ_WELL_CHEST,                 {[]{return (IsAdult && CanUse(BOW)) || (IsChild && CanUse(SLINGSHOT));}}),
-                  LocationAccess(FOREST_TEMPLE_MQ_GS_RAISED_ISLAND_COURTYARD, {[]{return HookshotOrBoomerang || (IsAdult && CanUse(FIRE_ARROWS) && (CanPlay(SongOfTime) || (CanUse(HOVER_BOOTS) && LogicForestDoorFrame)));}}),
-                  LocationAccess(FOREST_TEMPLE_MQ_GS_WELL,                    {[]{return (IsAdult && ((CanUse(IRON_BOOTS) && CanUse(HOOKSHOT)) || CanUse(BOW))) || (IsChild && CanUse(SLINGSHOT));}}),
+                  LocationAccess(FOREST_TEMPLE_MQ_WELL_CHEST,                 {[]{return (logic->IsAdult && logic->CanUse(BOW)) || (logic->IsChild && logic->CanUse(SLINGSHOT));}}),
+                  LocationAccess(FOREST_TEMPLE_MQ_GS_RAISED_ISLAND_COURTYARD, {[]{return logic->HookshotOrBoomerang || (logic->IsAdult && logic->CanUse(FIRE_ARROWS) && (logic->CanPlay(logic->SongOfTime) || (logic->CanUse(HOVER_BOOTS) && settings->LogicForestDoorFrame)));}}),
+                  LocationAccess(FOREST_TEMPLE_MQ_GS_WELL,                    {[]{return (logic->IsAdult && ((logic->CanUse(IRON_BOOTS) && logic->CanUse(HOOKSHOT)) || logic->CanUse(BOW))) || (logic->IsChild && logic->CanUse(SLINGSHOT));}}),
   }, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_MQ_OUTDOORS_TOP_LEDGES, {[]{return IsAdult && CanUse(HOOKSHOT) && (CanUse(LONGSHOT) || CanUse(HOVER_BOOTS) || CanPlay(SongOfTime));}}),
-                  Entrance(FOREST_TEMPLE_MQ_NE_OUTDOORS_LEDGE,   {[]{return IsAdult && CanUse(LONGSHOT);}}),
+                  Entrance(FOREST_TEMPLE_MQ_OUTDOORS_TOP_LEDGES, {[]{return logic->IsAdult && logic->CanUse(HOOKSHOT) && (logic->CanUse(LONGSHOT) || logic->CanUse(HOVER_BOOTS) || logic->CanPlay(logic->SongOfTime));}}),
+                  Entrance(FOREST_TEMPLE_MQ_NE_OUTDOORS_LEDGE,   {[]{return logic->IsAdult && logic->CanUse(LONGSHOT);}}),
   });
 
-  areaTable[FOREST_TEMPLE_MQ_OUTDOORS_TOP_LEDGES] = Area("Forest Temple MQ Outdoors Top Ledges", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[FOREST_TEMPLE_MQ_OUTDOORS_TOP_LEDGES] = Area("Forest Temple MQ Outdoors Top Ledges", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(FOREST_TEMPLE_MQ_RAISED_ISLAND_COURTYARD_UPPER_CHEST, {[]{return true;}}),
   }, {
                   //Exits
                   Entrance(FOREST_TEMPLE_MQ_NE_OUTDOORS,       {[]{return true;}}),
-                  Entrance(FOREST_TEMPLE_MQ_NE_OUTDOORS_LEDGE, {[]{return LogicForestOutdoorsLedge && IsAdult && CanUse(HOVER_BOOTS);}}),
+                  Entrance(FOREST_TEMPLE_MQ_NE_OUTDOORS_LEDGE, {[]{return settings->LogicForestOutdoorsLedge && logic->IsAdult && logic->CanUse(HOVER_BOOTS);}}),
                     //Trick: LogicForestOutdoorsLedge && IsAdult && CanUse(HOVER_BOOTS)
   });
 
-  areaTable[FOREST_TEMPLE_MQ_NE_OUTDOORS_LEDGE] = Area("Forest Temple MQ NE Outdoors Ledge", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[FOREST_TEMPLE_MQ_NE_OUTDOORS_LEDGE] = Area("Forest Temple MQ NE Outdoors Ledge", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(FOREST_TEMPLE_MQ_RAISED_ISLAND_COURTYARD_LOWER_CHEST, {[]{return true;}}),
   }, {
                   //Exits
                   Entrance(FOREST_TEMPLE_MQ_NE_OUTDOORS,  {[]{return true;}}),
-                  Entrance(FOREST_TEMPLE_MQ_FALLING_ROOM, {[]{return CanPlay(SongOfTime);}}),
+                  Entrance(FOREST_TEMPLE_MQ_FALLING_ROOM, {[]{return logic->CanPlay(logic->SongOfTime);}}),
   });
 
-  areaTable[FOREST_TEMPLE_MQ_BOW_REGION] = Area("Forest Temple MQ Bow Region", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[FOREST_TEMPLE_MQ_BOW_REGION] = Area("Forest Temple MQ Bow Region", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&ForestTempleJoAndBeth, {[]{return ForestTempleJoAndBeth || (IsAdult && CanUse(BOW));}}),
+                  EventAccess(&Logic::Vars::ForestTempleJoAndBeth, {[]{return logic->ForestTempleJoAndBeth || (logic->IsAdult && logic->CanUse(BOW));}}),
   }, {
                   //Locations
-                  LocationAccess(FOREST_TEMPLE_MQ_BOW_CHEST,     {[]{return CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(MEGATON_HAMMER);}}),
-                  LocationAccess(FOREST_TEMPLE_MQ_MAP_CHEST,     {[]{return IsAdult && CanUse(BOW);}}),
-                  LocationAccess(FOREST_TEMPLE_MQ_COMPASS_CHEST, {[]{return IsAdult && CanUse(BOW);}}),
+                  LocationAccess(FOREST_TEMPLE_MQ_BOW_CHEST,     {[]{return logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(MEGATON_HAMMER);}}),
+                  LocationAccess(FOREST_TEMPLE_MQ_MAP_CHEST,     {[]{return logic->IsAdult && logic->CanUse(BOW);}}),
+                  LocationAccess(FOREST_TEMPLE_MQ_COMPASS_CHEST, {[]{return logic->IsAdult && logic->CanUse(BOW);}}),
   }, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_MQ_FALLING_ROOM, {[]{return SmallKeys(FOREST_TEMPLE, 5) && ((IsAdult && CanUse(BOW)) || CanUse(DINS_FIRE));}}),
+                  Entrance(FOREST_TEMPLE_MQ_FALLING_ROOM, {[]{return logic->SmallKeys(FOREST_TEMPLE, 5) && ((logic->IsAdult && logic->CanUse(BOW)) || logic->CanUse(DINS_FIRE));}}),
   });
 
-  areaTable[FOREST_TEMPLE_MQ_FALLING_ROOM] = Area("Forest Temple MQ Falling Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[FOREST_TEMPLE_MQ_FALLING_ROOM] = Area("Forest Temple MQ Falling Room", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&ForestTempleAmyAndMeg, {[]{return ForestTempleAmyAndMeg || (IsAdult && CanUse(BOW) && SmallKeys(FOREST_TEMPLE, 6));}}),
+                  EventAccess(&Logic::Vars::ForestTempleAmyAndMeg, {[]{return logic->ForestTempleAmyAndMeg || (logic->IsAdult && logic->CanUse(BOW) && logic->SmallKeys(FOREST_TEMPLE, 6));}}),
   }, {
                   //Locations
                   LocationAccess(FOREST_TEMPLE_MQ_FALLING_CEILING_ROOM_CHEST, {[]{return true;}}),
@@ -395,44 +396,44 @@ void AreaTable_Init_ForestTemple() {
                   Entrance(FOREST_TEMPLE_MQ_NE_OUTDOORS_LEDGE, {[]{return true;}}),
   });
 
-  areaTable[FOREST_TEMPLE_MQ_BOSS_REGION] = Area("Forest Temple MQ Boss Region", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[FOREST_TEMPLE_MQ_BOSS_REGION] = Area("Forest Temple MQ Boss Region", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(FOREST_TEMPLE_MQ_BASEMENT_CHEST,   {[]{return true;}}),
   }, {
                   //Exits
-                  Entrance(FOREST_TEMPLE_BOSS_ENTRYWAY, {[]{return BossKeyForestTemple;}}),
+                  Entrance(FOREST_TEMPLE_BOSS_ENTRYWAY, {[]{return logic->BossKeyForestTemple;}}),
   });
   }
 
     /*---------------------------
     |         BOSS ROOM         |
     ---------------------------*/
-    areaTable[FOREST_TEMPLE_BOSS_ENTRYWAY] =
+    world->areaTable[FOREST_TEMPLE_BOSS_ENTRYWAY] =
         Area("Forest Temple Boss Entryway", "Forest Temple", FOREST_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {},
              {
                  // Exits
-                 Entrance(FOREST_TEMPLE_BOSS_REGION, { [] { return Dungeon::ForestTemple.IsVanilla() && false; } }),
-                 Entrance(FOREST_TEMPLE_MQ_BOSS_REGION, { [] { return Dungeon::ForestTemple.IsMQ() && false; } }),
+                 Entrance(FOREST_TEMPLE_BOSS_REGION, { [] { return world->dungeons.ForestTemple.IsVanilla() && false; } }),
+                 Entrance(FOREST_TEMPLE_MQ_BOSS_REGION, { [] { return world->dungeons.ForestTemple.IsMQ() && false; } }),
                  Entrance(FOREST_TEMPLE_BOSS_ROOM, { [] { return true; } }),
              });
 
-    areaTable[FOREST_TEMPLE_BOSS_ROOM] = Area(
+    world->areaTable[FOREST_TEMPLE_BOSS_ROOM] = Area(
         "Forest Temple Boss Room", "Forest Temple", NONE, NO_DAY_NIGHT_CYCLE,
         {
             // Events
-            EventAccess(&ForestTempleClear, { [] {
-                return ForestTempleClear || ((CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD)) &&
-                                             (CanUse(HOOKSHOT) || CanUse(BOW) || CanUse(SLINGSHOT)));
+            EventAccess(&Logic::Vars::ForestTempleClear, { [] {
+                return logic->ForestTempleClear || ((logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD)) &&
+                                             (logic->CanUse(HOOKSHOT) || logic->CanUse(BOW) || logic->CanUse(SLINGSHOT)));
             } }),
         },
         {
             // Locations
-            LocationAccess(FOREST_TEMPLE_PHANTOM_GANON_HEART, { [] { return ForestTempleClear; } }),
-            LocationAccess(PHANTOM_GANON, { [] { return ForestTempleClear; } }),
+            LocationAccess(FOREST_TEMPLE_PHANTOM_GANON_HEART, { [] { return logic->ForestTempleClear; } }),
+            LocationAccess(PHANTOM_GANON, { [] { return logic->ForestTempleClear; } }),
         },
         {
             // Exits
             Entrance(FOREST_TEMPLE_BOSS_ENTRYWAY, { [] { return false; } }),
-            Entrance(SACRED_FOREST_MEADOW, { [] { return ForestTempleClear; } }),
+            Entrance(SACRED_FOREST_MEADOW, { [] { return logic->ForestTempleClear; } }),
         });
 }
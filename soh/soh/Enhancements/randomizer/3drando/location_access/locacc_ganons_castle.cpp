@@ -3,6 +3,7 @@
 #include "../entrance.hpp"
 #include "../dungeon.hpp"
 #include "../trial.hpp"
+#include "../world.hpp"
 
 using namespace Logic;
 using namespace Settings;
@@ -11,24 +12,24 @@ void AreaTable_Init_GanonsCastle() {
   /*--------------------------
   |    VANILLA/MQ DECIDER    |
   ---------------------------*/
-  areaTable[GANONS_CASTLE_ENTRYWAY] = Area("Ganon's Castle Entryway", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[GANONS_CASTLE_ENTRYWAY] = Area("Ganon's Castle Entryway", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(GANONS_CASTLE_LOBBY,    {[]{return Dungeon::GanonsCastle.IsVanilla();}}),
-                  Entrance(GANONS_CASTLE_MQ_LOBBY, {[]{return Dungeon::GanonsCastle.IsMQ();}}),
+                  Entrance(GANONS_CASTLE_LOBBY,    {[]{return world->dungeons.GanonsCastle.IsVanilla();}}),
+                  Entrance(GANONS_CASTLE_MQ_LOBBY, {[]{return world->dungeons.GanonsCastle.IsMQ();}}),
                   Entrance(CASTLE_GROUNDS_FROM_GANONS_CASTLE,    {[]{return true;}}),
   });
 
   /*--------------------------
   |     VANILLA DUNGEON      |
   ---------------------------*/
-  if (Dungeon::GanonsCastle.IsVanilla()) {
-  areaTable[GANONS_CASTLE_LOBBY] = Area("Ganon's Castle Lobby", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  if (world->dungeons.GanonsCastle.IsVanilla()) {
+  world->areaTable[GANONS_CASTLE_LOBBY] = Area("Ganon's Castle Lobby", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(GANONS_CASTLE_ENTRYWAY, {[]{return true;}}),
                   Entrance(GANONS_CASTLE_MAIN,     {[]{return true;}}),
   });
 
-  areaTable[GANONS_CASTLE_MAIN] = Area("Ganon's Castle Main", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[GANONS_CASTLE_MAIN] = Area("Ganon's Castle Main", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(GANONS_CASTLE_LOBBY,        {[]{return true;}}),
                   Entrance(GANONS_CASTLE_FOREST_TRIAL, {[]{return true;}}),
@@ -36,73 +37,73 @@ void AreaTable_Init_GanonsCastle() {
                   Entrance(GANONS_CASTLE_WATER_TRIAL,  {[]{return true;}}),
                   Entrance(GANONS_CASTLE_SHADOW_TRIAL, {[]{return true;}}),
                   Entrance(GANONS_CASTLE_SPIRIT_TRIAL, {[]{return true;}}),
-                  Entrance(GANONS_CASTLE_LIGHT_TRIAL,  {[]{return CanUse(GOLDEN_GAUNTLETS);}}),
-                  Entrance(GANONS_CASTLE_TOWER,        {[]{return (ForestTrialClear || Trial::ForestTrial.IsSkipped()) &&
-                                                                         (FireTrialClear   || Trial::FireTrial.IsSkipped())   &&
-                                                                         (WaterTrialClear  || Trial::WaterTrial.IsSkipped())  &&
-                                                                         (ShadowTrialClear || Trial::ShadowTrial.IsSkipped()) &&
-                                                                         (SpiritTrialClear || Trial::SpiritTrial.IsSkipped()) &&
-                                                                         (LightTrialClear  || Trial::LightTrial.IsSkipped());}}),
-                  Entrance(GANONS_CASTLE_DEKU_SCRUBS,  {[]{return LogicLensCastle || CanUse(LENS_OF_TRUTH);}}),
+                  Entrance(GANONS_CASTLE_LIGHT_TRIAL,  {[]{return logic->CanUse(GOLDEN_GAUNTLETS);}}),
+                  Entrance(GANONS_CASTLE_TOWER,        {[]{return (logic->ForestTrialClear || world->trials.ForestTrial.IsSkipped()) &&
+                                                                         (logic->FireTrialClear   || world->trials.FireTrial.IsSkipped())   &&
+                                                                         (logic->WaterTrialClear  || world->trials.WaterTrial.IsSkipped())  &&
+                                                                         (logic->ShadowTrialClear || world->trials.ShadowTrial.IsSkipped()) &&
+                                                                         (logic->SpiritTrialClear || world->trials.SpiritTrial.IsSkipped()) &&
+                                                                         (logic->LightTrialClear  || world->trials.LightTrial.IsSkipped());}}),
+                  Entrance(GANONS_CASTLE_DEKU_SCRUBS,  {[]{return settings->LogicLensCastle || logic->CanUse(LENS_OF_TRUTH);}}),
   });
 
-  areaTable[GANONS_CASTLE_DEKU_SCRUBS] = Area("Ganon's Castle Deku Scrubs", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GANONS_CASTLE_DEKU_SCRUBS] = Area("Ganon's Castle Deku Scrubs", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&FreeFairies, {[]{return true;}}),
+                  EventAccess(&Logic::Vars::FreeFairies, {[]{return true;}}),
                 }, {
                   //Locations
-                  LocationAccess(GANONS_CASTLE_DEKU_SCRUB_CENTER_LEFT,  {[]{return CanStunDeku;}}),
-                  LocationAccess(GANONS_CASTLE_DEKU_SCRUB_CENTER_RIGHT, {[]{return CanStunDeku;}}),
-                  LocationAccess(GANONS_CASTLE_DEKU_SCRUB_RIGHT,        {[]{return CanStunDeku;}}),
-                  LocationAccess(GANONS_CASTLE_DEKU_SCRUB_LEFT,         {[]{return CanStunDeku;}}),
+                  LocationAccess(GANONS_CASTLE_DEKU_SCRUB_CENTER_LEFT,  {[]{return logic->CanStunDeku;}}),
+                  LocationAccess(GANONS_CASTLE_DEKU_SCRUB_CENTER_RIGHT, {[]{return logic->CanStunDeku;}}),
+                  LocationAccess(GANONS_CASTLE_DEKU_SCRUB_RIGHT,        {[]{return logic->CanStunDeku;}}),
+                  LocationAccess(GANONS_CASTLE_DEKU_SCRUB_LEFT,         {[]{return logic->CanStunDeku;}}),
   }, {});
 
-  areaTable[GANONS_CASTLE_FOREST_TRIAL] = Area("Ganon's Castle Forest Trial", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GANONS_CASTLE_FOREST_TRIAL] = Area("Ganon's Castle Forest Trial", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&ForestTrialClear, {[]{return CanUse(LIGHT_ARROWS) && (FireArrows || DinsFire);}}),
+                  EventAccess(&Logic::Vars::ForestTrialClear, {[]{return logic->CanUse(LIGHT_ARROWS) && (logic->FireArrows || logic->DinsFire);}}),
                 }, {
                   //Locations
-                  LocationAccess(GANONS_CASTLE_FOREST_TRIAL_CHEST, {[]{return CanAdultDamage || CanChildDamage;}}),
+                  LocationAccess(GANONS_CASTLE_FOREST_TRIAL_CHEST, {[]{return logic->CanAdultDamage || logic->CanChildDamage;}}),
   }, {});
 
-  areaTable[GANONS_CASTLE_FIRE_TRIAL] = Area("Ganon's Castle Fire Trial", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GANONS_CASTLE_FIRE_TRIAL] = Area("Ganon's Castle Fire Trial", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&FireTrialClear, {[]{return CanUse(GORON_TUNIC) && CanUse(GOLDEN_GAUNTLETS) && CanUse(LIGHT_ARROWS) && CanUse(LONGSHOT);}}),
+                  EventAccess(&Logic::Vars::FireTrialClear, {[]{return logic->CanUse(GORON_TUNIC) && logic->CanUse(GOLDEN_GAUNTLETS) && logic->CanUse(LIGHT_ARROWS) && logic->CanUse(LONGSHOT);}}),
   }, {}, {});
 
-  areaTable[GANONS_CASTLE_WATER_TRIAL] = Area("Ganon's Castle Water Trial", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GANONS_CASTLE_WATER_TRIAL] = Area("Ganon's Castle Water Trial", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&BlueFireAccess,  {[]{return BlueFireAccess || HasBottle;}}),
-                  EventAccess(&FairyPot,        {[]{return FairyPot || BlueFire;}}),
-                  EventAccess(&WaterTrialClear, {[]{return BlueFire && IsAdult && CanUse(MEGATON_HAMMER) && CanUse(LIGHT_ARROWS);}}),
+                  EventAccess(&Logic::Vars::BlueFireAccess,  {[]{return logic->BlueFireAccess || logic->HasBottle;}}),
+                  EventAccess(&Logic::Vars::FairyPot,        {[]{return logic->FairyPot || logic->BlueFire;}}),
+                  EventAccess(&Logic::Vars::WaterTrialClear, {[]{return logic->BlueFire && logic->IsAdult && logic->CanUse(MEGATON_HAMMER) && logic->CanUse(LIGHT_ARROWS);}}),
                 }, {
                   //Locations
                   LocationAccess(GANONS_CASTLE_WATER_TRIAL_LEFT_CHEST,  {[]{return true;}}),
                   LocationAccess(GANONS_CASTLE_WATER_TRIAL_RIGHT_CHEST, {[]{return true;}}),
   }, {});
 
-  areaTable[GANONS_CASTLE_SHADOW_TRIAL] = Area("Ganon's Castle Shadow Trial", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GANONS_CASTLE_SHADOW_TRIAL] = Area("Ganon's Castle Shadow Trial", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&ShadowTrialClear, {[]{return CanUse(LIGHT_ARROWS) && CanUse(MEGATON_HAMMER) && ((FireArrows && (LogicLensCastle || CanUse(LENS_OF_TRUTH))) || (CanUse(LONGSHOT) && (CanUse(HOVER_BOOTS) || (DinsFire && (LogicLensCastle || CanUse(LENS_OF_TRUTH))))));}}),
+                  EventAccess(&Logic::Vars::ShadowTrialClear, {[]{return logic->CanUse(LIGHT_ARROWS) && logic->CanUse(MEGATON_HAMMER) && ((logic->FireArrows && (settings->LogicLensCastle || logic->CanUse(LENS_OF_TRUTH))) || (logic->CanUse(LONGSHOT) && (logic->CanUse(HOVER_BOOTS) || (logic->DinsFire && (settings->LogicLensCastle || logic->CanUse(LENS_OF_TRUTH))))));}}),
                 }, {
                   //Locations
-                  LocationAccess(GANONS_CASTLE_SHADOW_TRIAL_FRONT_CHEST,            {[]{return CanUse(FIRE_ARROWS) || CanUse(HOOKSHOT) || CanUse(HOVER_BOOTS) || CanPlay(SongOfTime) || IsChild;}}),
-                  LocationAccess(GANONS_CASTLE_SHADOW_TRIAL_GOLDEN_GAUNTLETS_CHEST, {[]{return CanUse(FIRE_ARROWS) || (CanUse(LONGSHOT) && (CanUse(HOVER_BOOTS) || CanUse(DINS_FIRE)));}}),
+                  LocationAccess(GANONS_CASTLE_SHADOW_TRIAL_FRONT_CHEST,            {[]{return logic->CanUse(FIRE_ARROWS) || logic->CanUse(HOOKSHOT) || logic->CanUse(HOVER_BOOTS) || logic->CanPlay(logic->SongOfTime) || logic->IsChild;}}),
+                  LocationAccess(GANONS_CASTLE_SHADOW_TRIAL_GOLDEN_GAUNTLETS_CHEST, {[]{return logic->CanUse(FIRE_ARROWS) || (logic->CanUse(LONGSHOT) && (logic->CanUse(HOVER_BOOTS) || logic->CanUse(DINS_FIRE)));}}),
   }, {});
 
-  areaTable[GANONS_CASTLE_SPIRIT_TRIAL] = Area("Ganon's Castle Spirit Trial", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GANONS_CASTLE_SPIRIT_TRIAL] = Area("Ganon's Castle Spirit Trial", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&NutPot,           {[]{return NutPot || (((LogicSpiritTrialHookshot && CanJumpslash) || CanUse(HOOKSHOT)) && HasBombchus && CanUse(BOW) && (CanUse(MIRROR_SHIELD) || (SunlightArrows && CanUse(LIGHT_ARROWS))));}}),
-                  EventAccess(&SpiritTrialClear, {[]{return CanUse(LIGHT_ARROWS) && (CanUse(MIRROR_SHIELD) || SunlightArrows) && HasBombchus && ((LogicSpiritTrialHookshot && CanJumpslash) || CanUse(HOOKSHOT));}}),
+                  EventAccess(&Logic::Vars::NutPot,           {[]{return logic->NutPot || (((settings->LogicSpiritTrialHookshot && logic->CanJumpslash) || logic->CanUse(HOOKSHOT)) && logic->HasBombchus && logic->CanUse(BOW) && (logic->CanUse(MIRROR_SHIELD) || (settings->SunlightArrows && logic->CanUse(LIGHT_ARROWS))));}}),
+                  EventAccess(&Logic::Vars::SpiritTrialClear, {[]{return logic->CanUse(LIGHT_ARROWS) && (logic->CanUse(MIRROR_SHIELD) || settings->SunlightArrows) && logic->HasBombchus && ((settings->LogicSpiritTrialHookshot && logic->CanJumpslash) || logic->CanUse(HOOKSHOT));}}),
                 }, {
                   //Locations
-                  LocationAccess(GANONS_CASTLE_SPIRIT_TRIAL_CRYSTAL_SWITCH_CHEST, {[]{return (LogicSpiritTrialHookshot || CanUse(HOOKSHOT)) && CanJumpslash;}}),
-                  LocationAccess(GANONS_CASTLE_SPIRIT_TRIAL_INVISIBLE_CHEST,      {[]{return (LogicSpiritTrialHookshot || CanUse(HOOKSHOT)) && HasBombchus && (LogicLensCastle || CanUse(LENS_OF_TRUTH));}}),
+                  LocationAccess(GANONS_CASTLE_SPIRIT_TRIAL_CRYSTAL_SWITCH_CHEST, {[]{return (settings->LogicSpiritTrialHookshot || logic->CanUse(HOOKSHOT)) && logic->CanJumpslash;}}),
+                  LocationAccess(GANONS_CASTLE_SPIRIT_TRIAL_INVISIBLE_CHEST,      {[]{return (settings->LogicSpiritTrialHookshot || logic->CanUse(HOOKSHOT)) && logic->HasBombchus && (settings->LogicLensCastle || logic->CanUse(LENS_OF_TRUTH));}}),
   }, {});
 
-  areaTable[GANONS_CASTLE_LIGHT_TRIAL] = Area("Ganon's Castle Light Trial", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GANONS_CASTLE_LIGHT_TRIAL] = Area("Ganon's Castle Light Trial", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&LightTrialClear, {[]{return CanUse(LIGHT_ARROWS) && CanUse(HOOKSHOT) && SmallKeys(GANONS_CASTLE, 2) && (LogicLensCastle || CanUse(LENS_OF_TRUTH));}}),
+                  EventAccess(&Logic::Vars::LightTrialClear, {[]{return logic->CanUse(LIGHT_ARROWS) && logic->CanUse(HOOKSHOT) && logic->SmallKeys(GANONS_CASTLE, 2) && (settings->LogicLensCastle || logic->CanUse(LENS_OF_TRUTH));}}),
                 }, {
                   //Locations
                   LocationAccess(GANONS_CASTLE_LIGHT_TRIAL_FIRST_LEFT_CHEST,        {[]{return true;}}),
@@ -111,29 +112,29 @@ void AreaTable_Init_GanonsCastle() {
                   LocationAccess(GANONS_CASTLE_LIGHT_TRIAL_FIRST_RIGHT_CHEST,       {[]{return true;}}),
                   LocationAccess(GANONS_CASTLE_LIGHT_TRIAL_SECOND_RIGHT_CHEST,      {[]{return true;}}),
                   LocationAccess(GANONS_CASTLE_LIGHT_TRIAL_THIRD_RIGHT_CHEST,       {[]{return true;}}),
-                  LocationAccess(GANONS_CASTLE_LIGHT_TRIAL_INVISIBLE_ENEMIES_CHEST, {[]{return LogicLensCastle || CanUse(LENS_OF_TRUTH);}}),
-                  LocationAccess(GANONS_CASTLE_LIGHT_TRIAL_LULLABY_CHEST,           {[]{return CanPlay(ZeldasLullaby) && SmallKeys(GANONS_CASTLE, 1);}}),
+                  LocationAccess(GANONS_CASTLE_LIGHT_TRIAL_INVISIBLE_ENEMIES_CHEST, {[]{return settings->LogicLensCastle || logic->CanUse(LENS_OF_TRUTH);}}),
+                  LocationAccess(GANONS_CASTLE_LIGHT_TRIAL_LULLABY_CHEST,           {[]{return logic->CanPlay(logic->ZeldasLullaby) && logic->SmallKeys(GANONS_CASTLE, 1);}}),
   }, {});
   }
 
-  areaTable[GANONS_CASTLE_TOWER] = Area("Ganon's Castle Tower", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[GANONS_CASTLE_TOWER] = Area("Ganon's Castle Tower", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(GANONS_TOWER_BOSS_KEY_CHEST, {[]{return CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD);}}),
-                  LocationAccess(GANONDORF_HINT,              {[]{return BossKeyGanonsCastle && (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD));}}),
-                  LocationAccess(GANON,                       {[]{return BossKeyGanonsCastle && CanUse(LIGHT_ARROWS) && CanUse(MASTER_SWORD);}}),
+                  LocationAccess(GANONS_TOWER_BOSS_KEY_CHEST, {[]{return logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD);}}),
+                  LocationAccess(GANONDORF_HINT,              {[]{return logic->BossKeyGanonsCastle && (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD));}}),
+                  LocationAccess(GANON,                       {[]{return logic->BossKeyGanonsCastle && logic->CanUse(LIGHT_ARROWS) && logic->CanUse(MASTER_SWORD);}}),
   }, {});
 
   /*---------------------------
   |   MASTER QUEST DUNGEON    |
   ---------------------------*/
-  if (Dungeon::GanonsCastle.IsMQ()) {
-  areaTable[GANONS_CASTLE_MQ_LOBBY] = Area("Ganon's Castle MQ Lobby", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  if (world->dungeons.GanonsCastle.IsMQ()) {
+  world->areaTable[GANONS_CASTLE_MQ_LOBBY] = Area("Ganon's Castle MQ Lobby", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(GANONS_CASTLE_ENTRYWAY, {[]{return true;}}),
-                  Entrance(GANONS_CASTLE_MQ_MAIN,  {[]{return (CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(MEGATON_HAMMER)) || ((HasExplosives || Nuts || CanUse(BOOMERANG)) && CanJumpslash);}}),
+                  Entrance(GANONS_CASTLE_MQ_MAIN,  {[]{return (logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(MEGATON_HAMMER)) || ((logic->HasExplosives || logic->Nuts || logic->CanUse(BOOMERANG)) && logic->CanJumpslash);}}),
   });
 
-  areaTable[GANONS_CASTLE_MQ_MAIN] = Area("Ganon's Castle MQ Main", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[GANONS_CASTLE_MQ_MAIN] = Area("Ganon's Castle MQ Main", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(GANONS_CASTLE_MQ_LOBBY,        {[]{return true;}}),
                   Entrance(GANONS_CASTLE_MQ_FOREST_TRIAL, {[]{return true;}}),
@@ -141,85 +142,85 @@ void AreaTable_Init_GanonsCastle() {
                   Entrance(GANONS_CASTLE_MQ_WATER_TRIAL,  {[]{return true;}}),
                   Entrance(GANONS_CASTLE_MQ_SHADOW_TRIAL, {[]{return true;}}),
                   Entrance(GANONS_CASTLE_MQ_SPIRIT_TRIAL, {[]{return true;}}),
-                  Entrance(GANONS_CASTLE_MQ_LIGHT_TRIAL,  {[]{return CanUse(GOLDEN_GAUNTLETS);}}),
-                  Entrance(GANONS_CASTLE_TOWER,           {[]{return (ForestTrialClear || Trial::ForestTrial.IsSkipped()) &&
-                                                                            (FireTrialClear   || Trial::FireTrial.IsSkipped())   &&
-                                                                            (WaterTrialClear  || Trial::WaterTrial.IsSkipped())  &&
-                                                                            (ShadowTrialClear || Trial::ShadowTrial.IsSkipped()) &&
-                                                                            (SpiritTrialClear || Trial::SpiritTrial.IsSkipped()) &&
-                                                                            (LightTrialClear  || Trial::LightTrial.IsSkipped());}}),
-                  Entrance(GANONS_CASTLE_MQ_DEKU_SCRUBS,  {[]{return LogicLensCastleMQ || CanUse(LENS_OF_TRUTH);}}),
+                  Entrance(GANONS_CASTLE_MQ_LIGHT_TRIAL,  {[]{return logic->CanUse(GOLDEN_GAUNTLETS);}}),
+                  Entrance(GANONS_CASTLE_TOWER,           {[]{return (logic->ForestTrialClear || world->trials.ForestTrial.IsSkipped()) &&
+                                                                            (logic->FireTrialClear   || world->trials.FireTrial.IsSkipped())   &&
+                                                                            (logic->WaterTrialClear  || world->trials.WaterTrial.IsSkipped())  &&
+                                                                            (logic->ShadowTrialClear || world->trials.ShadowTrial.IsSkipped()) &&
+                                                                            (logic->SpiritTrialClear || world->trials.SpiritTrial.IsSkipped()) &&
+                                                                            (logic->LightTrialClear  || world->trials.LightTrial.IsSkipped());}}),
+                  Entrance(GANONS_CASTLE_MQ_DEKU_SCRUBS,  {[]{return settings->LogicLensCastleMQ || logic->CanUse(LENS_OF_TRUTH);}}),
   });
 
-  areaTable[GANONS_CASTLE_MQ_DEKU_SCRUBS] = Area("Ganon's Castle MQ Deku Scrubs", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GANONS_CASTLE_MQ_DEKU_SCRUBS] = Area("Ganon's Castle MQ Deku Scrubs", "Ganon's Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&FreeFairies, {[]{return true;}}),
+                  EventAccess(&Logic::Vars::FreeFairies, {[]{return true;}}),
   }, {
                   //Locations
-                  LocationAccess(GANONS_CASTLE_MQ_DEKU_SCRUB_CENTER_LEFT,  {[]{return CanStunDeku;}}),
-                  LocationAccess(GANONS_CASTLE_MQ_DEKU_SCRUB_CENTER,       {[]{return CanStunDeku;}}),
-                  LocationAccess(GANONS_CASTLE_MQ_DEKU_SCRUB_CENTER_RIGHT, {[]{return CanStunDeku;}}),
-                  LocationAccess(GANONS_CASTLE_MQ_DEKU_SCRUB_LEFT,         {[]{return CanStunDeku;}}),
-                  LocationAccess(GANONS_CASTLE_MQ_DEKU_SCRUB_RIGHT,        {[]{return CanStunDeku;}}),
+                  LocationAccess(GANONS_CASTLE_MQ_DEKU_SCRUB_CENTER_LEFT,  {[]{return logic->CanStunDeku;}}),
+                  LocationAccess(GANONS_CASTLE_MQ_DEKU_SCRUB_CENTER,       {[]{return logic->CanStunDeku;}}),
+                  LocationAccess(GANONS_CASTLE_MQ_DEKU_SCRUB_CENTER_RIGHT, {[]{return logic->CanStunDeku;}}),
+                  LocationAccess(GANONS_CASTLE_MQ_DEKU_SCRUB_LEFT,         {[]{return logic->CanStunDeku;}}),
+                  LocationAccess(GANONS_CASTLE_MQ_DEKU_SCRUB_RIGHT,        {[]{return logic->CanStunDeku;}}),
   }, {});
 
-  areaTable[GANONS_CASTLE_MQ_FOREST_TRIAL] = Area("Ganon's Castle MQ Forest Trial", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GANONS_CASTLE_MQ_FOREST_TRIAL] = Area("Ganon's Castle MQ Forest Trial", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&ForestTrialClear, {[]{return IsAdult && CanUse(LIGHT_ARROWS) && (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD)) && CanPlay(SongOfTime);}}),
+                  EventAccess(&Logic::Vars::ForestTrialClear, {[]{return logic->IsAdult && logic->CanUse(LIGHT_ARROWS) && (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD)) && logic->CanPlay(logic->SongOfTime);}}),
   }, {
                   //Locations
-                  LocationAccess(GANONS_CASTLE_MQ_FOREST_TRIAL_EYE_SWITCH_CHEST,        {[]{return (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD)) && (CanUse(BOW) || CanUse(SLINGSHOT));}}),
-                  LocationAccess(GANONS_CASTLE_MQ_FOREST_TRIAL_FROZEN_EYE_SWITCH_CHEST, {[]{return (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD)) && HasFireSource;}}),
-                  LocationAccess(GANONS_CASTLE_MQ_FOREST_TRIAL_FREESTANDING_KEY,        {[]{return (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD)) && HookshotOrBoomerang;}}),
+                  LocationAccess(GANONS_CASTLE_MQ_FOREST_TRIAL_EYE_SWITCH_CHEST,        {[]{return (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD)) && (logic->CanUse(BOW) || logic->CanUse(SLINGSHOT));}}),
+                  LocationAccess(GANONS_CASTLE_MQ_FOREST_TRIAL_FROZEN_EYE_SWITCH_CHEST, {[]{return (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD)) && logic->HasFireSource;}}),
+                  LocationAccess(GANONS_CASTLE_MQ_FOREST_TRIAL_FREESTANDING_KEY,        {[]{return (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD)) && logic->HookshotOrBoomerang;}}),
   }, {});
 
-  areaTable[GANONS_CASTLE_MQ_FIRE_TRIAL] = Area("Ganon's Castle MQ Fire Trial", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GANONS_CASTLE_MQ_FIRE_TRIAL] = Area("Ganon's Castle MQ Fire Trial", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&FireTrialClear, {[]{return CanUse(GORON_TUNIC) && CanUse(GOLDEN_GAUNTLETS) && CanUse(LIGHT_ARROWS) && (CanUse(LONGSHOT) || HoverBoots || (LogicFireTrialMQ && CanUse(HOOKSHOT)));}}),
+                  EventAccess(&Logic::Vars::FireTrialClear, {[]{return logic->CanUse(GORON_TUNIC) && logic->CanUse(GOLDEN_GAUNTLETS) && logic->CanUse(LIGHT_ARROWS) && (logic->CanUse(LONGSHOT) || logic->HoverBoots || (settings->LogicFireTrialMQ && logic->CanUse(HOOKSHOT)));}}),
                     //Trick: CanUse(GORON_TUNIC) && CanUse(GOLDEN_GAUNTLETS) && CanUse(LIGHT_ARROWS) && (CanUse(LONGSHOT) || HoverBoots || (LogicFireTrialMQ && CanUse(HOOKSHOT)))
   }, {}, {});
 
-  areaTable[GANONS_CASTLE_MQ_WATER_TRIAL] = Area("Ganon's Castle MQ Water Trial", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GANONS_CASTLE_MQ_WATER_TRIAL] = Area("Ganon's Castle MQ Water Trial", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&WaterTrialClear, {[]{return BlueFire && IsAdult && CanUse(LIGHT_ARROWS) && SmallKeys(GANONS_CASTLE, 3);}}),
-                  EventAccess(&BlueFireAccess,  {[]{return BlueFireAccess || (HasBottle && CanJumpslash);}}),
+                  EventAccess(&Logic::Vars::WaterTrialClear, {[]{return logic->BlueFire && logic->IsAdult && logic->CanUse(LIGHT_ARROWS) && logic->SmallKeys(GANONS_CASTLE, 3);}}),
+                  EventAccess(&Logic::Vars::BlueFireAccess,  {[]{return logic->BlueFireAccess || (logic->HasBottle && logic->CanJumpslash);}}),
   }, {
                   //Locations
-                  LocationAccess(GANONS_CASTLE_MQ_WATER_TRIAL_CHEST, {[]{return BlueFire;}}),
+                  LocationAccess(GANONS_CASTLE_MQ_WATER_TRIAL_CHEST, {[]{return logic->BlueFire;}}),
   }, {});
 
-  areaTable[GANONS_CASTLE_MQ_SHADOW_TRIAL] = Area("Ganon's Castle MQ Shadow Trial", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GANONS_CASTLE_MQ_SHADOW_TRIAL] = Area("Ganon's Castle MQ Shadow Trial", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&ShadowTrialClear, {[]{return IsAdult && CanUse(LIGHT_ARROWS) && (LogicLensCastleMQ || CanUse(LENS_OF_TRUTH)) && (HoverBoots || (Hookshot && (HasFireSource || LogicShadowTrialMQ)));}}),
+                  EventAccess(&Logic::Vars::ShadowTrialClear, {[]{return logic->IsAdult && logic->CanUse(LIGHT_ARROWS) && (settings->LogicLensCastleMQ || logic->CanUse(LENS_OF_TRUTH)) && (logic->HoverBoots || (logic->Hookshot && (logic->HasFireSource || settings->LogicShadowTrialMQ)));}}),
                     //Trick: IsAdult && CanUse(LIGHT_ARROWS) && (LogicLensCastleMQ || CanUse(LENS_OF_TRUTH)) && (HoverBoots || (Hookshot && (HasFireSource || LogicShadowTrialMQ)))
   }, {
                   //Locations
-                  LocationAccess(GANONS_CASTLE_MQ_SHADOW_TRIAL_BOMB_FLOWER_CHEST, {[]{return IsAdult && ((Bow && (CanUse(HOOKSHOT) || CanUse(HOVER_BOOTS))) || (CanUse(HOVER_BOOTS) && (LogicLensCastleMQ || CanUse(LENS_OF_TRUTH)) && (HasExplosives || GoronBracelet || CanUse(DINS_FIRE))));}}),
-                  LocationAccess(GANONS_CASTLE_MQ_SHADOW_TRIAL_EYE_SWITCH_CHEST,  {[]{return IsAdult && Bow && (LogicLensCastleMQ || CanUse(LENS_OF_TRUTH)) && (HoverBoots || (Hookshot && (HasFireSource || LogicShadowTrialMQ)));}}),
+                  LocationAccess(GANONS_CASTLE_MQ_SHADOW_TRIAL_BOMB_FLOWER_CHEST, {[]{return logic->IsAdult && ((logic->Bow && (logic->CanUse(HOOKSHOT) || logic->CanUse(HOVER_BOOTS))) || (logic->CanUse(HOVER_BOOTS) && (settings->LogicLensCastleMQ || logic->CanUse(LENS_OF_TRUTH)) && (logic->HasExplosives || logic->GoronBracelet || logic->CanUse(DINS_FIRE))));}}),
+                  LocationAccess(GANONS_CASTLE_MQ_SHADOW_TRIAL_EYE_SWITCH_CHEST,  {[]{return logic->IsAdult && logic->Bow && (settings->LogicLensCastleMQ || logic->CanUse(LENS_OF_TRUTH)) && (logic->HoverBoots || (logic->Hookshot && (logic->HasFireSource || settings->LogicShadowTrialMQ)));}}),
                     //Trick: IsAdult && Bow && (LogicLensCastleMQ || CanUse(LENS_OF_TRUTH)) && (HoverBoots || (Hookshot && (HasFireSource || LogicShadowTrialMQ)))
   }, {});
 
-  areaTable[GANONS_CASTLE_MQ_SPIRIT_TRIAL] = Area("Ganon's Castle MQ Spirit Castle", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GANONS_CASTLE_MQ_SPIRIT_TRIAL] = Area("Ganon's Castle MQ Spirit Castle", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&SpiritTrialClear, {[]{return IsAdult && CanUse(LIGHT_ARROWS) && Hammer && HasBombchus && ((FireArrows && MirrorShield) || SunlightArrows);}}),
-                  EventAccess(&NutPot,           {[]{return NutPot || (Hammer && HasBombchus && IsAdult && ((CanUse(FIRE_ARROWS) && MirrorShield) || (SunlightArrows && CanUse(LIGHT_ARROWS))));}}),
+                  EventAccess(&Logic::Vars::SpiritTrialClear, {[]{return logic->IsAdult && logic->CanUse(LIGHT_ARROWS) && logic->Hammer && logic->HasBombchus && ((logic->FireArrows && logic->MirrorShield) || settings->SunlightArrows);}}),
+                  EventAccess(&Logic::Vars::NutPot,           {[]{return logic->NutPot || (logic->Hammer && logic->HasBombchus && logic->IsAdult && ((logic->CanUse(FIRE_ARROWS) && logic->MirrorShield) || (settings->SunlightArrows && logic->CanUse(LIGHT_ARROWS))));}}),
   }, {
                   //Locations
-                  LocationAccess(GANONS_CASTLE_MQ_SPIRIT_TRIAL_FIRST_CHEST,             {[]{return IsAdult && (Bow || LogicRustedSwitches) && Hammer;}}),
-                  LocationAccess(GANONS_CASTLE_MQ_SPIRIT_TRIAL_INVISIBLE_CHEST,         {[]{return IsAdult && (Bow || LogicRustedSwitches) && Hammer && HasBombchus && (LogicLensCastleMQ || CanUse(LENS_OF_TRUTH));}}),
-                  LocationAccess(GANONS_CASTLE_MQ_SPIRIT_TRIAL_SUN_FRONT_LEFT_CHEST,    {[]{return IsAdult && Hammer && HasBombchus && ((CanUse(FIRE_ARROWS) && CanUse(MIRROR_SHIELD)) || (SunlightArrows && CanUse(LIGHT_ARROWS)));}}),
-                  LocationAccess(GANONS_CASTLE_MQ_SPIRIT_TRIAL_SUN_BACK_LEFT_CHEST,     {[]{return IsAdult && Hammer && HasBombchus && ((CanUse(FIRE_ARROWS) && CanUse(MIRROR_SHIELD)) || (SunlightArrows && CanUse(LIGHT_ARROWS)));}}),
-                  LocationAccess(GANONS_CASTLE_MQ_SPIRIT_TRIAL_GOLDEN_GAUNTLETS_CHEST,  {[]{return IsAdult && Hammer && HasBombchus && ((CanUse(FIRE_ARROWS) && CanUse(MIRROR_SHIELD)) || (SunlightArrows && CanUse(LIGHT_ARROWS)));}}),
-                  LocationAccess(GANONS_CASTLE_MQ_SPIRIT_TRIAL_SUN_BACK_RIGHT_CHEST,    {[]{return IsAdult && Hammer && HasBombchus && ((CanUse(FIRE_ARROWS) && CanUse(MIRROR_SHIELD)) || (SunlightArrows && CanUse(LIGHT_ARROWS)));}}),
+                  LocationAccess(GANONS_CASTLE_MQ_SPIRIT_TRIAL_FIRST_CHEST,             {[]{return logic->IsAdult && (logic->Bow || settings->LogicRustedSwitches) && logic->Hammer;}}),
+                  LocationAccess(GANONS_CASTLE_MQ_SPIRIT_TRIAL_INVISIBLE_CHEST,         {[]{return logic->IsAdult && (logic->Bow || settings->LogicRustedSwitches) && logic->Hammer && logic->HasBombchus && (settings->LogicLensCastleMQ || logic->CanUse(LENS_OF_TRUTH));}}),
+                  LocationAccess(GANONS_CASTLE_MQ_SPIRIT_TRIAL_SUN_FRONT_LEFT_CHEST,    {[]{return logic->IsAdult && logic->Hammer && logic->HasBombchus && ((logic->CanUse(FIRE_ARROWS) && logic->CanUse(MIRROR_SHIELD)) || (settings->SunlightArrows && logic->CanUse(LIGHT_ARROWS)));}}),
+                  LocationAccess(GANONS_CASTLE_MQ_SPIRIT_TRIAL_SUN_BACK_LEFT_CHEST,     {[]{return logic->IsAdult && logic->Hammer && logic->HasBombchus && ((logic->CanUse(FIRE_ARROWS) && logic->CanUse(MIRROR_SHIELD)) || (settings->SunlightArrows && logic->CanUse(LIGHT_ARROWS)));}}),
+                  LocationAccess(GANONS_CASTLE_MQ_SPIRIT_TRIAL_GOLDEN_GAUNTLETS_CHEST,  {[]{return logic->IsAdult && logic->Hammer && logic->HasBombchus && ((logic->CanUse(FIRE_ARROWS) && logic->CanUse(MIRROR_SHIELD)) || (settings->SunlightArrows && logic->CanUse(LIGHT_ARROWS)));}}),
+                  LocationAccess(GANONS_CASTLE_MQ_SPIRIT_TRIAL_SUN_BACK_RIGHT_CHEST,    {[]{return logic->IsAdult && logic->Hammer && logic->HasBombchus && ((logic->CanUse(FIRE_ARROWS) && logic->CanUse(MIRROR_SHIELD)) || (settings->SunlightArrows && logic->CanUse(LIGHT_ARROWS)));}}),
   }, {});
 
-  areaTable[GANONS_CASTLE_MQ_LIGHT_TRIAL] = Area("Ganon's Castle MQ Light Trial", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GANONS_CASTLE_MQ_LIGHT_TRIAL] = Area("Ganon's Castle MQ Light Trial", "Ganons Castle", GANONS_CASTLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&LightTrialClear, {[]{return IsAdult && (CanUse(MASTER_SWORD) || CanUse(KOKIRI_SWORD) || CanUse(BIGGORON_SWORD)) && CanUse(LIGHT_ARROWS) && SmallKeys(GANONS_CASTLE, 3) && (LogicLensCastleMQ || CanUse(LENS_OF_TRUTH)) && (Hookshot || LogicLightTrialMQ);}}),
+                  EventAccess(&Logic::Vars::LightTrialClear, {[]{return logic->IsAdult && (logic->CanUse(MASTER_SWORD) || logic->CanUse(KOKIRI_SWORD) || logic->CanUse(BIGGORON_SWORD)) && logic->CanUse(LIGHT_ARROWS) && logic->SmallKeys(GANONS_CASTLE, 3) && (settings->LogicLensCastleMQ || logic->CanUse(LENS_OF_TRUTH)) && (logic->Hookshot || settings->LogicLightTrialMQ);}}),
                     //Trick: IsAdult && CanUse(LIGHT_ARROWS) && SmallKeys(GANONS_CASTLE, 3) && (LogicLensCastleMQ || CanUse(LENS_OF_TRUTH)) && (Hookshot || LogicLightTrialMQ)
   }, {
                   //Locations
-                  LocationAccess(GANONS_CASTLE_MQ_LIGHT_TRIAL_LULLABY_CHEST, {[]{return (CanUse(MASTER_SWORD) || CanUse(KOKIRI_SWORD) || CanUse(BIGGORON_SWORD)) && CanPlay(ZeldasLullaby);}}),
+                  LocationAccess(GANONS_CASTLE_MQ_LIGHT_TRIAL_LULLABY_CHEST, {[]{return (logic->CanUse(MASTER_SWORD) || logic->CanUse(KOKIRI_SWORD) || logic->CanUse(BIGGORON_SWORD)) && logic->CanPlay(logic->ZeldasLullaby);}}),
   }, {});
   }
 }
@@ -1,54 +1,55 @@
 #include "../location_access.hpp"
 #include "../logic.hpp"
 #include "../entrance.hpp"
+#include "../world.hpp"
 
 using namespace Logic;
 using namespace Settings;
 
 void AreaTable_Init_GerudoValley() {
-  areaTable[GERUDO_VALLEY] = Area("Gerudo Valley", "Gerudo Valley", GERUDO_VALLEY, DAY_NIGHT_CYCLE, {
+  world->areaTable[GERUDO_VALLEY] = Area("Gerudo Valley", "Gerudo Valley", GERUDO_VALLEY, DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&BugRock, {[]{return BugRock || IsChild;}}),
+                  EventAccess(&Logic::Vars::BugRock, {[]{return logic->BugRock || logic->IsChild;}}),
                 }, {
                   //Locations
-                  LocationAccess(GV_GS_SMALL_BRIDGE, {[]{return IsChild && HookshotOrBoomerang && AtNight && CanGetNightTimeGS;}}),
+                  LocationAccess(GV_GS_SMALL_BRIDGE, {[]{return logic->IsChild && logic->HookshotOrBoomerang && logic->AtNight && logic->CanGetNightTimeGS;}}),
                 }, {
                   //Exits
                   Entrance(HYRULE_FIELD,      {[]{return true;}}),
                   Entrance(GV_UPPER_STREAM,   {[]{return true;}}),
-                  Entrance(GV_CRATE_LEDGE,    {[]{return IsChild || CanUse(LONGSHOT);}}),
+                  Entrance(GV_CRATE_LEDGE,    {[]{return logic->IsChild || logic->CanUse(LONGSHOT);}}),
                   Entrance(GV_GROTTO_LEDGE,   {[]{return true;}}),
-                  Entrance(GV_FORTRESS_SIDE,  {[]{return (IsAdult && (CanRideEpona || CanUse(LONGSHOT) || GerudoFortress.Is(GERUDOFORTRESS_OPEN) || CarpenterRescue)) || (IsChild && CanUse(HOOKSHOT));}}),
+                  Entrance(GV_FORTRESS_SIDE,  {[]{return (logic->IsAdult && (logic->CanRideEpona || logic->CanUse(LONGSHOT) || settings->GerudoFortress.Is(GERUDOFORTRESS_OPEN) || logic->CarpenterRescue)) || (logic->IsChild && logic->CanUse(HOOKSHOT));}}),
   });
 
-  areaTable[GV_UPPER_STREAM] = Area("GV Upper Stream", "Gerudo Valley", GERUDO_VALLEY, DAY_NIGHT_CYCLE, {
+  world->areaTable[GV_UPPER_STREAM] = Area("GV Upper Stream", "Gerudo Valley", GERUDO_VALLEY, DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&GossipStoneFairy, {[]{return GossipStoneFairy || CanSummonGossipFairy;}}),
-                  EventAccess(&BeanPlantFairy,   {[]{return BeanPlantFairy   || (CanPlantBean(GV_UPPER_STREAM) && CanPlay(SongOfStorms));}}),
+                  EventAccess(&Logic::Vars::GossipStoneFairy, {[]{return logic->GossipStoneFairy || logic->CanSummonGossipFairy;}}),
+                  EventAccess(&Logic::Vars::BeanPlantFairy,   {[]{return logic->BeanPlantFairy   || (CanPlantBean(GV_UPPER_STREAM) && logic->CanPlay(logic->SongOfStorms));}}),
                 }, {
                   //Locations
                   LocationAccess(GV_WATERFALL_FREESTANDING_POH, {[]{return true;}}),
-                  LocationAccess(GV_GS_BEAN_PATCH,              {[]{return CanPlantBugs && CanChildAttack;}}),
-                  LocationAccess(GV_COW,                        {[]{return IsChild && CanPlay(EponasSong);}}),
+                  LocationAccess(GV_GS_BEAN_PATCH,              {[]{return logic->CanPlantBugs && logic->CanChildAttack;}}),
+                  LocationAccess(GV_COW,                        {[]{return logic->IsChild && logic->CanPlay(logic->EponasSong);}}),
                   LocationAccess(GV_GOSSIP_STONE,               {[]{return true;}}),
                 }, {
                   //Exits
                   Entrance(GV_LOWER_STREAM, {[]{return true;}}),
   });
 
-  areaTable[GV_LOWER_STREAM] = Area("GV Lower Stream", "Gerudo Valley", GERUDO_VALLEY, DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[GV_LOWER_STREAM] = Area("GV Lower Stream", "Gerudo Valley", GERUDO_VALLEY, DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(LAKE_HYLIA, {[]{return true;}}),
   });
 
-  areaTable[GV_GROTTO_LEDGE] = Area("GV Grotto Ledge", "Gerudo Valley", GERUDO_VALLEY, DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[GV_GROTTO_LEDGE] = Area("GV Grotto Ledge", "Gerudo Valley", GERUDO_VALLEY, DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(GV_LOWER_STREAM,   {[]{return true;}}),
-                  Entrance(GV_OCTOROK_GROTTO, {[]{return CanUse(SILVER_GAUNTLETS);}}),
-                  Entrance(GV_CRATE_LEDGE,    {[]{return CanUse(LONGSHOT);}}),
+                  Entrance(GV_OCTOROK_GROTTO, {[]{return logic->CanUse(SILVER_GAUNTLETS);}}),
+                  Entrance(GV_CRATE_LEDGE,    {[]{return logic->CanUse(LONGSHOT);}}),
   });
 
-  areaTable[GV_CRATE_LEDGE] = Area("GV Crate Ledge", "Gerudo Valley", GERUDO_VALLEY, DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[GV_CRATE_LEDGE] = Area("GV Crate Ledge", "Gerudo Valley", GERUDO_VALLEY, DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(GV_CRATE_FREESTANDING_POH, {[]{return true;}}),
                 }, {
@@ -56,133 +57,133 @@ void AreaTable_Init_GerudoValley() {
                   Entrance(GV_LOWER_STREAM, {[]{return true;}}),
   });
 
-  areaTable[GV_FORTRESS_SIDE] = Area("GV Fortress Side", "Gerudo Valley", GERUDO_VALLEY, DAY_NIGHT_CYCLE, {
+  world->areaTable[GV_FORTRESS_SIDE] = Area("GV Fortress Side", "Gerudo Valley", GERUDO_VALLEY, DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&BrokenSwordAccess, {[]{return IsAdult && (PoachersSawAccess || PoachersSaw);}}),
+                  EventAccess(&Logic::Vars::BrokenSwordAccess, {[]{return logic->IsAdult && (logic->PoachersSawAccess || logic->PoachersSaw);}}),
                 }, {
                   //Locations                                       
-                  LocationAccess(GV_CHEST,          {[]{return IsAdult && CanUse(MEGATON_HAMMER);}}),
-                  LocationAccess(GV_TRADE_SAW,      {[]{return IsAdult && PoachersSaw;}}),
-                  LocationAccess(GV_GS_BEHIND_TENT, {[]{return IsAdult && HookshotOrBoomerang && AtNight && CanGetNightTimeGS;}}),
-                  LocationAccess(GV_GS_PILLAR,      {[]{return IsAdult && HookshotOrBoomerang && AtNight && CanGetNightTimeGS;}}),
+                  LocationAccess(GV_CHEST,          {[]{return logic->IsAdult && logic->CanUse(MEGATON_HAMMER);}}),
+                  LocationAccess(GV_TRADE_SAW,      {[]{return logic->IsAdult && logic->PoachersSaw;}}),
+                  LocationAccess(GV_GS_BEHIND_TENT, {[]{return logic->IsAdult && logic->HookshotOrBoomerang && logic->AtNight && logic->CanGetNightTimeGS;}}),
+                  LocationAccess(GV_GS_PILLAR,      {[]{return logic->IsAdult && logic->HookshotOrBoomerang && logic->AtNight && logic->CanGetNightTimeGS;}}),
                 }, {
                   //Exits
                   Entrance(GERUDO_FORTRESS,   {[]{return true;}}),
                   Entrance(GV_UPPER_STREAM,   {[]{return true;}}),
-                  Entrance(GERUDO_VALLEY,     {[]{return IsChild || CanRideEpona || CanUse(LONGSHOT) || GerudoFortress.Is(GERUDOFORTRESS_OPEN) || CarpenterRescue;}}),
-                  Entrance(GV_CARPENTER_TENT, {[]{return IsAdult;}}),
-                  Entrance(GV_STORMS_GROTTO,  {[]{return IsAdult && CanOpenStormGrotto;}}),
+                  Entrance(GERUDO_VALLEY,     {[]{return logic->IsChild || logic->CanRideEpona || logic->CanUse(LONGSHOT) || settings->GerudoFortress.Is(GERUDOFORTRESS_OPEN) || logic->CarpenterRescue;}}),
+                  Entrance(GV_CARPENTER_TENT, {[]{return logic->IsAdult;}}),
+                  Entrance(GV_STORMS_GROTTO,  {[]{return logic->IsAdult && logic->CanOpenStormGrotto;}}),
                   Entrance(GV_CRATE_LEDGE, {[]{return false;}}),
   });
 
-  areaTable[GV_CARPENTER_TENT] = Area("GV Carpenter Tent", "GV Carpenter Tent", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[GV_CARPENTER_TENT] = Area("GV Carpenter Tent", "GV Carpenter Tent", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(GV_FORTRESS_SIDE, {[]{return true;}}),
   });
 
-  areaTable[GV_OCTOROK_GROTTO] = Area("GV Octorok Grotto", "GV Octorok Grotto", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[GV_OCTOROK_GROTTO] = Area("GV Octorok Grotto", "GV Octorok Grotto", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(GV_GROTTO_LEDGE, {[]{return true;}}),
   });
 
-  areaTable[GV_STORMS_GROTTO] = Area("GV Storms Grotto", "GV Storms Grotto", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[GV_STORMS_GROTTO] = Area("GV Storms Grotto", "GV Storms Grotto", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(GV_DEKU_SCRUB_GROTTO_REAR,  {[]{return CanStunDeku;}}),
-                  LocationAccess(GV_DEKU_SCRUB_GROTTO_FRONT, {[]{return CanStunDeku;}}),
+                  LocationAccess(GV_DEKU_SCRUB_GROTTO_REAR,  {[]{return logic->CanStunDeku;}}),
+                  LocationAccess(GV_DEKU_SCRUB_GROTTO_FRONT, {[]{return logic->CanStunDeku;}}),
                 }, {
                   //Exits
                   Entrance(GV_FORTRESS_SIDE, {[]{return true;}}),
   });
 
-  areaTable[GERUDO_FORTRESS] = Area("Gerudo Fortress", "Gerudo Fortress", GERUDO_FORTRESS, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GERUDO_FORTRESS] = Area("Gerudo Fortress", "Gerudo Fortress", GERUDO_FORTRESS, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&CarpenterRescue, {[]{return CanFinishGerudoFortress;}}),
-                  EventAccess(&GF_GateOpen,     {[]{return IsAdult && GerudoToken;}}),
-                  EventAccess(&GtG_GateOpen,    {[]{return GtG_GateOpen || (IsAdult && GerudoToken);}}),
+                  EventAccess(&Logic::Vars::CarpenterRescue, {[]{return logic->CanFinishGerudoFortress;}}),
+                  EventAccess(&Logic::Vars::GF_GateOpen,     {[]{return logic->IsAdult && logic->GerudoToken;}}),
+                  EventAccess(&Logic::Vars::GtG_GateOpen,    {[]{return logic->GtG_GateOpen || (logic->IsAdult && logic->GerudoToken);}}),
                 }, {
                   //Locations
-                  LocationAccess(GF_CHEST,              {[]{return CanUse(HOVER_BOOTS) || (IsAdult && CanUse(SCARECROW)) || CanUse(LONGSHOT);}}),
-                  LocationAccess(GF_HBA_1000_POINTS,    {[]{return GerudoToken && CanRideEpona && Bow && AtDay;}}),
-                  LocationAccess(GF_HBA_1500_POINTS,    {[]{return GerudoToken && CanRideEpona && Bow && AtDay;}}),
-                  LocationAccess(GF_NORTH_F1_CARPENTER, {[]{return  CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD);}}),
-                  LocationAccess(GF_NORTH_F2_CARPENTER, {[]{return (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD)) && (GerudoToken || CanUse(BOW) || CanUse(HOOKSHOT) || CanUse(HOVER_BOOTS) || LogicGerudoKitchen);}}),
-                  LocationAccess(GF_SOUTH_F1_CARPENTER, {[]{return  CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD);}}),
-                  LocationAccess(GF_SOUTH_F2_CARPENTER, {[]{return  CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD);}}),
-                  LocationAccess(GF_GERUDO_MEMBERSHIP_CARD,       {[]{return CanFinishGerudoFortress;}}),
-                  LocationAccess(GF_GS_ARCHERY_RANGE,   {[]{return IsAdult && HookshotOrBoomerang && GerudoToken && AtNight && CanGetNightTimeGS;}}),
-                  LocationAccess(GF_GS_TOP_FLOOR,       {[]{return IsAdult && AtNight && (CanJumpslash || CanUse(SLINGSHOT) || CanUse(BOOMERANG) || HasExplosives || CanUse(BOW) || CanUse(HOOKSHOT) || CanUse(DINS_FIRE)) && (GerudoToken || CanUse(BOW) || CanUse(HOOKSHOT) || CanUse(HOVER_BOOTS) || LogicGerudoKitchen || LogicGFJump) && CanGetNightTimeGS;}}),
+                  LocationAccess(GF_CHEST,              {[]{return logic->CanUse(HOVER_BOOTS) || (logic->IsAdult && logic->CanUse(SCARECROW)) || logic->CanUse(LONGSHOT);}}),
+                  LocationAccess(GF_HBA_1000_POINTS,    {[]{return logic->GerudoToken && logic->CanRideEpona && logic->Bow && logic->AtDay;}}),
+                  LocationAccess(GF_HBA_1500_POINTS,    {[]{return logic->GerudoToken && logic->CanRideEpona && logic->Bow && logic->AtDay;}}),
+                  LocationAccess(GF_NORTH_F1_CARPENTER, {[]{return  logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD);}}),
+                  LocationAccess(GF_NORTH_F2_CARPENTER, {[]{return (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD)) && (logic->GerudoToken || logic->CanUse(BOW) || logic->CanUse(HOOKSHOT) || logic->CanUse(HOVER_BOOTS) || settings->LogicGerudoKitchen);}}),
+                  LocationAccess(GF_SOUTH_F1_CARPENTER, {[]{return  logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD);}}),
+                  LocationAccess(GF_SOUTH_F2_CARPENTER, {[]{return  logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD);}}),
+                  LocationAccess(GF_GERUDO_MEMBERSHIP_CARD,       {[]{return logic->CanFinishGerudoFortress;}}),
+                  LocationAccess(GF_GS_ARCHERY_RANGE,   {[]{return logic->IsAdult && logic->HookshotOrBoomerang && logic->GerudoToken && logic->AtNight && logic->CanGetNightTimeGS;}}),
+                  LocationAccess(GF_GS_TOP_FLOOR,       {[]{return logic->IsAdult && logic->AtNight && (logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->CanUse(BOOMERANG) || logic->HasExplosives || logic->CanUse(BOW) || logic->CanUse(HOOKSHOT) || logic->CanUse(DINS_FIRE)) && (logic->GerudoToken || logic->CanUse(BOW) || logic->CanUse(HOOKSHOT) || logic->CanUse(HOVER_BOOTS) || settings->LogicGerudoKitchen || settings->LogicGFJump) && logic->CanGetNightTimeGS;}}),
                 }, {
                   //Exits
                   Entrance(GV_FORTRESS_SIDE,                 {[]{return true;}}),
-                  Entrance(GF_OUTSIDE_GATE,                  {[]{return GF_GateOpen;}}),
-                  Entrance(GERUDO_TRAINING_GROUNDS_ENTRYWAY, {[]{return GtG_GateOpen && (IsAdult || ShuffleDungeonEntrances);}}),
-                  Entrance(GF_STORMS_GROTTO,                 {[]{return IsAdult && CanOpenStormGrotto;}}),
+                  Entrance(GF_OUTSIDE_GATE,                  {[]{return logic->GF_GateOpen;}}),
+                  Entrance(GERUDO_TRAINING_GROUNDS_ENTRYWAY, {[]{return logic->GtG_GateOpen && (logic->IsAdult || settings->ShuffleDungeonEntrances);}}),
+                  Entrance(GF_STORMS_GROTTO,                 {[]{return logic->IsAdult && logic->CanOpenStormGrotto;}}),
   });
 
-  areaTable[GF_OUTSIDE_GATE] = Area("GF Outside Gate", "Gerudo Fortress", GERUDO_FORTRESS, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GF_OUTSIDE_GATE] = Area("GF Outside Gate", "Gerudo Fortress", GERUDO_FORTRESS, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&GF_GateOpen, {[]{return IsAdult && GerudoToken && (ShuffleGerudoToken || ShuffleOverworldEntrances /*|| ShuffleSpecialIndoorEntrances*/);}}),
+                  EventAccess(&Logic::Vars::GF_GateOpen, {[]{return logic->IsAdult && logic->GerudoToken && (settings->ShuffleGerudoToken || settings->ShuffleOverworldEntrances /*|| ShuffleSpecialIndoorEntrances*/);}}),
                 }, {}, {
                   //Exits
-                  Entrance(GERUDO_FORTRESS,         {[]{return (IsAdult && (Hookshot || !ShuffleOverworldEntrances)) || GF_GateOpen;}}),
+                  Entrance(GERUDO_FORTRESS,         {[]{return (logic->IsAdult && (logic->Hookshot || !settings->ShuffleOverworldEntrances)) || logic->GF_GateOpen;}}),
                   Entrance(WASTELAND_NEAR_FORTRESS, {[]{return true;}}),
   });
 
-  areaTable[GF_STORMS_GROTTO] = Area("GF Storms Grotto", "GF Storms Grotto", NONE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GF_STORMS_GROTTO] = Area("GF Storms Grotto", "GF Storms Grotto", NONE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&FreeFairies, {[]{return true;}}),
+                  EventAccess(&Logic::Vars::FreeFairies, {[]{return true;}}),
                 }, {}, {
                   //Exits
                   Entrance(GERUDO_FORTRESS, {[]{return true;}}),
   });
 
-  areaTable[WASTELAND_NEAR_FORTRESS] = Area("Wasteland Near Fortress", "Haunted Wasteland", HAUNTED_WASTELAND, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[WASTELAND_NEAR_FORTRESS] = Area("Wasteland Near Fortress", "Haunted Wasteland", HAUNTED_WASTELAND, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(GF_OUTSIDE_GATE,   {[]{return true;}}),
-                  Entrance(HAUNTED_WASTELAND, {[]{return CanUse(HOVER_BOOTS) || CanUse(LONGSHOT) || LogicWastelandCrossing;}}),
+                  Entrance(HAUNTED_WASTELAND, {[]{return logic->CanUse(HOVER_BOOTS) || logic->CanUse(LONGSHOT) || settings->LogicWastelandCrossing;}}),
   });
 
-  areaTable[HAUNTED_WASTELAND] = Area("Haunted Wasteland", "Haunted Wasteland", HAUNTED_WASTELAND, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[HAUNTED_WASTELAND] = Area("Haunted Wasteland", "Haunted Wasteland", HAUNTED_WASTELAND, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&FairyPot, {[]{return true;}}),
-                  EventAccess(&NutPot,   {[]{return true;}}),
+                  EventAccess(&Logic::Vars::FairyPot, {[]{return true;}}),
+                  EventAccess(&Logic::Vars::NutPot,   {[]{return true;}}),
                 }, {
                   //Locations
-                  LocationAccess(WASTELAND_CHEST,            {[]{return HasFireSource;}}),
-                  LocationAccess(WASTELAND_BOMBCHU_SALESMAN, {[]{return AdultsWallet && (CanJumpslash || CanUse(HOVER_BOOTS)) ;}}),
-                  LocationAccess(WASTELAND_GS,               {[]{return HookshotOrBoomerang;}}),
+                  LocationAccess(WASTELAND_CHEST,            {[]{return logic->HasFireSource;}}),
+                  LocationAccess(WASTELAND_BOMBCHU_SALESMAN, {[]{return logic->AdultsWallet && (logic->CanJumpslash || logic->CanUse(HOVER_BOOTS)) ;}}),
+                  LocationAccess(WASTELAND_GS,               {[]{return logic->HookshotOrBoomerang;}}),
                 }, {
                   //Exits
-                  Entrance(WASTELAND_NEAR_COLOSSUS, {[]{return LogicLensWasteland || CanUse(LENS_OF_TRUTH);}}),
-                  Entrance(WASTELAND_NEAR_FORTRESS, {[]{return CanUse(HOVER_BOOTS) || CanUse(LONGSHOT) || LogicWastelandCrossing;}}),
+                  Entrance(WASTELAND_NEAR_COLOSSUS, {[]{return settings->LogicLensWasteland || logic->CanUse(LENS_OF_TRUTH);}}),
+                  Entrance(WASTELAND_NEAR_FORTRESS, {[]{return logic->CanUse(HOVER_BOOTS) || logic->CanUse(LONGSHOT) || settings->LogicWastelandCrossing;}}),
   });
 
-  areaTable[WASTELAND_NEAR_COLOSSUS] = Area("Wasteland Near Colossus", "Haunted Wasteland", HAUNTED_WASTELAND, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[WASTELAND_NEAR_COLOSSUS] = Area("Wasteland Near Colossus", "Haunted Wasteland", HAUNTED_WASTELAND, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(DESERT_COLOSSUS,   {[]{return true;}}),
-                  Entrance(HAUNTED_WASTELAND, {[]{return LogicReverseWasteland || false;}}),
+                  Entrance(HAUNTED_WASTELAND, {[]{return settings->LogicReverseWasteland || false;}}),
   });
 
-  areaTable[DESERT_COLOSSUS] = Area("Desert Colossus", "Desert Colossus", DESERT_COLOSSUS, DAY_NIGHT_CYCLE, {
+  world->areaTable[DESERT_COLOSSUS] = Area("Desert Colossus", "Desert Colossus", DESERT_COLOSSUS, DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&FairyPond, {[]{return FairyPond || CanPlay(SongOfStorms);}}),
-                  EventAccess(&BugRock,   {[]{return true;}}),
+                  EventAccess(&Logic::Vars::FairyPond, {[]{return logic->FairyPond || logic->CanPlay(logic->SongOfStorms);}}),
+                  EventAccess(&Logic::Vars::BugRock,   {[]{return true;}}),
                 }, {
                   //Locations
-                  LocationAccess(COLOSSUS_FREESTANDING_POH, {[]{return IsAdult && CanPlantBean(DESERT_COLOSSUS);}}),
-                  LocationAccess(COLOSSUS_GS_BEAN_PATCH,    {[]{return CanPlantBugs && CanChildAttack;}}),
-                  LocationAccess(COLOSSUS_GS_TREE,          {[]{return IsAdult && HookshotOrBoomerang && AtNight && CanGetNightTimeGS;}}),
-                  LocationAccess(COLOSSUS_GS_HILL,          {[]{return IsAdult && AtNight && ((CanPlantBean(DESERT_COLOSSUS) && CanAdultAttack) || CanUse(LONGSHOT) || (LogicColossusGS && CanUse(HOOKSHOT))) && CanGetNightTimeGS;}}),
+                  LocationAccess(COLOSSUS_FREESTANDING_POH, {[]{return logic->IsAdult && CanPlantBean(DESERT_COLOSSUS);}}),
+                  LocationAccess(COLOSSUS_GS_BEAN_PATCH,    {[]{return logic->CanPlantBugs && logic->CanChildAttack;}}),
+                  LocationAccess(COLOSSUS_GS_TREE,          {[]{return logic->IsAdult && logic->HookshotOrBoomerang && logic->AtNight && logic->CanGetNightTimeGS;}}),
+                  LocationAccess(COLOSSUS_GS_HILL,          {[]{return logic->IsAdult && logic->AtNight && ((CanPlantBean(DESERT_COLOSSUS) && logic->CanAdultAttack) || logic->CanUse(LONGSHOT) || (settings->LogicColossusGS && logic->CanUse(HOOKSHOT))) && logic->CanGetNightTimeGS;}}),
                   LocationAccess(COLOSSUS_GOSSIP_STONE,     {[]{return true;}}),
                 }, {
                   //Exits
-                  Entrance(COLOSSUS_GREAT_FAIRY_FOUNTAIN, {[]{return HasExplosives;}}),
+                  Entrance(COLOSSUS_GREAT_FAIRY_FOUNTAIN, {[]{return logic->HasExplosives;}}),
                   Entrance(SPIRIT_TEMPLE_ENTRYWAY,        {[]{return true;}}),
                   Entrance(WASTELAND_NEAR_COLOSSUS,       {[]{return true;}}),
-                  Entrance(COLOSSUS_GROTTO,               {[]{return CanUse(SILVER_GAUNTLETS);}}),
+                  Entrance(COLOSSUS_GROTTO,               {[]{return logic->CanUse(SILVER_GAUNTLETS);}}),
   });
 
-  areaTable[DESERT_COLOSSUS_FROM_SPIRIT_ENTRYWAY] = Area("Desert Colossus From Spirit Entryway", "Desert Colossus", DESERT_COLOSSUS, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[DESERT_COLOSSUS_FROM_SPIRIT_ENTRYWAY] = Area("Desert Colossus From Spirit Entryway", "Desert Colossus", DESERT_COLOSSUS, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(SHEIK_AT_COLOSSUS, {[]{return true;}}),
                 }, {
@@ -190,18 +191,18 @@ void AreaTable_Init_GerudoValley() {
                   Entrance(DESERT_COLOSSUS, {[]{return true;}}),
   });
 
-  areaTable[COLOSSUS_GREAT_FAIRY_FOUNTAIN] = Area("Colossus Great Fairy Fountain", "Colossus Great Fairy Fountain", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[COLOSSUS_GREAT_FAIRY_FOUNTAIN] = Area("Colossus Great Fairy Fountain", "Colossus Great Fairy Fountain", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(COLOSSUS_GREAT_FAIRY_REWARD, {[]{return CanPlay(ZeldasLullaby);}}),
+                  LocationAccess(COLOSSUS_GREAT_FAIRY_REWARD, {[]{return logic->CanPlay(logic->ZeldasLullaby);}}),
                 }, {
                   //Exits
                   Entrance(DESERT_COLOSSUS, {[]{return true;}}),
   });
 
-  areaTable[COLOSSUS_GROTTO] = Area("Colossus Grotto", "Colossus Grotto", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[COLOSSUS_GROTTO] = Area("Colossus Grotto", "Colossus Grotto", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(COLOSSUS_DEKU_SCRUB_GROTTO_REAR,  {[]{return CanStunDeku;}}),
-                  LocationAccess(COLOSSUS_DEKU_SCRUB_GROTTO_FRONT, {[]{return CanStunDeku;}}),
+                  LocationAccess(COLOSSUS_DEKU_SCRUB_GROTTO_REAR,  {[]{return logic->CanStunDeku;}}),
+                  LocationAccess(COLOSSUS_DEKU_SCRUB_GROTTO_FRONT, {[]{return logic->CanStunDeku;}}),
                 }, {
                   //Exits
                   Entrance(DESERT_COLOSSUS, {[]{return true;}}),
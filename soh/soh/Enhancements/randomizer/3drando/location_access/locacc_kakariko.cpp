@@ -1,27 +1,28 @@
 #include "../location_access.hpp"
 #include "../logic.hpp"
 #include "../entrance.hpp"
+#include "../world.hpp"
 
 using namespace Logic;
 using namespace Settings;
 
 void AreaTable_Init_Kakariko() {
-  areaTable[KAKARIKO_VILLAGE] = Area("Kakariko Village", "Kakariko Village", KAKARIKO_VILLAGE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[KAKARIKO_VILLAGE] = Area("Kakariko Village", "Kakariko Village", KAKARIKO_VILLAGE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&CojiroAccess,            {[]{return CojiroAccess || (IsAdult && WakeUpAdultTalon);}}),
-                  EventAccess(&BugRock,                 {[]{return true;}}),
-                  EventAccess(&KakarikoVillageGateOpen, {[]{return KakarikoVillageGateOpen || (IsChild && (ZeldasLetter || OpenKakariko.Is(OPENKAKARIKO_OPEN)));}}),
+                  EventAccess(&Logic::Vars::CojiroAccess,            {[]{return logic->CojiroAccess || (logic->IsAdult && logic->WakeUpAdultTalon);}}),
+                  EventAccess(&Logic::Vars::BugRock,                 {[]{return true;}}),
+                  EventAccess(&Logic::Vars::KakarikoVillageGateOpen, {[]{return logic->KakarikoVillageGateOpen || (logic->IsChild && (logic->ZeldasLetter || settings->OpenKakariko.Is(OPENKAKARIKO_OPEN)));}}),
                 }, {
                   //Locations
-                  LocationAccess(SHEIK_IN_KAKARIKO,               {[]{return IsAdult && ForestMedallion && FireMedallion && WaterMedallion;}}),
-                  LocationAccess(KAK_ANJU_AS_CHILD,               {[]{return IsChild && AtDay;}}),
-                  LocationAccess(KAK_ANJU_AS_ADULT,               {[]{return IsAdult && AtDay;}}),
-                  LocationAccess(KAK_TRADE_POCKET_CUCCO,          {[]{return IsAdult && AtDay && PocketEgg && WakeUpAdultTalon;}}),
-                  LocationAccess(KAK_GS_HOUSE_UNDER_CONSTRUCTION, {[]{return IsChild && AtNight && CanGetNightTimeGS;}}),
-                  LocationAccess(KAK_GS_SKULLTULA_HOUSE,          {[]{return IsChild && AtNight && CanGetNightTimeGS;}}),
-                  LocationAccess(KAK_GS_GUARDS_HOUSE,             {[]{return IsChild && AtNight && CanGetNightTimeGS;}}),
-                  LocationAccess(KAK_GS_TREE,                     {[]{return IsChild && AtNight && CanGetNightTimeGS;}}),
-                  LocationAccess(KAK_GS_WATCHTOWER,               {[]{return IsChild && (Slingshot || HasBombchus || CanUse(BOW) || CanUse(LONGSHOT) || (LogicKakarikoTowerGS && CanJumpslash)) && AtNight && CanGetNightTimeGS;}}),
+                  LocationAccess(SHEIK_IN_KAKARIKO,               {[]{return logic->IsAdult && logic->ForestMedallion && logic->FireMedallion && logic->WaterMedallion;}}),
+                  LocationAccess(KAK_ANJU_AS_CHILD,               {[]{return logic->IsChild && logic->AtDay;}}),
+                  LocationAccess(KAK_ANJU_AS_ADULT,               {[]{return logic->IsAdult && logic->AtDay;}}),
+                  LocationAccess(KAK_TRADE_POCKET_CUCCO,          {[]{return logic->IsAdult && logic->AtDay && logic->PocketEgg && logic->WakeUpAdultTalon;}}),
+                  LocationAccess(KAK_GS_HOUSE_UNDER_CONSTRUCTION, {[]{return logic->IsChild && logic->AtNight && logic->CanGetNightTimeGS;}}),
+                  LocationAccess(KAK_GS_SKULLTULA_HOUSE,          {[]{return logic->IsChild && logic->AtNight && logic->CanGetNightTimeGS;}}),
+                  LocationAccess(KAK_GS_GUARDS_HOUSE,             {[]{return logic->IsChild && logic->AtNight && logic->CanGetNightTimeGS;}}),
+                  LocationAccess(KAK_GS_TREE,                     {[]{return logic->IsChild && logic->AtNight && logic->CanGetNightTimeGS;}}),
+                  LocationAccess(KAK_GS_WATCHTOWER,               {[]{return logic->IsChild && (logic->Slingshot || logic->HasBombchus || logic->CanUse(BOW) || logic->CanUse(LONGSHOT) || (settings->LogicKakarikoTowerGS && logic->CanJumpslash)) && logic->AtNight && logic->CanGetNightTimeGS;}}),
                 }, {
                   //Exits
                   Entrance(HYRULE_FIELD,                {[]{return true;}}),
@@ -29,34 +30,34 @@ void AreaTable_Init_Kakariko() {
                   Entrance(KAK_HOUSE_OF_SKULLTULA,      {[]{return true;}}),
                   Entrance(KAK_IMPAS_HOUSE,             {[]{return true;}}),
                   Entrance(KAK_WINDMILL,                {[]{return true;}}),
-                  Entrance(KAK_BAZAAR,                  {[]{return IsAdult && AtDay;}}),
-                  Entrance(KAK_SHOOTING_GALLERY,        {[]{return IsAdult && AtDay;}}),
-                  Entrance(BOTTOM_OF_THE_WELL_ENTRYWAY, {[]{return DrainWell && (IsChild || ShuffleDungeonEntrances.IsNot(SHUFFLEDUNGEONS_OFF));}}),
-                  Entrance(KAK_POTION_SHOP_FRONT,       {[]{return AtDay || IsChild;}}),
-                  Entrance(KAK_REDEAD_GROTTO,           {[]{return CanOpenBombGrotto;}}),
-                  Entrance(KAK_IMPAS_LEDGE,             {[]{return (IsChild && AtDay) || CanUse(HOOKSHOT) || (IsAdult && LogicVisibleCollision);}}),
-                  Entrance(KAK_ROOFTOP,                 {[]{return CanUse(HOOKSHOT) || (LogicManOnRoof && (IsAdult || AtDay || Slingshot || HasBombchus || CanUse(BOW) || CanUse(LONGSHOT)));}}),
-                  Entrance(KAK_IMPAS_ROOFTOP,           {[]{return CanUse(HOOKSHOT) || (LogicKakarikoRooftopGS && CanUse(HOVER_BOOTS));}}),
+                  Entrance(KAK_BAZAAR,                  {[]{return logic->IsAdult && logic->AtDay;}}),
+                  Entrance(KAK_SHOOTING_GALLERY,        {[]{return logic->IsAdult && logic->AtDay;}}),
+                  Entrance(BOTTOM_OF_THE_WELL_ENTRYWAY, {[]{return logic->DrainWell && (logic->IsChild || settings->ShuffleDungeonEntrances.IsNot(SHUFFLEDUNGEONS_OFF));}}),
+                  Entrance(KAK_POTION_SHOP_FRONT,       {[]{return logic->AtDay || logic->IsChild;}}),
+                  Entrance(KAK_REDEAD_GROTTO,           {[]{return logic->CanOpenBombGrotto;}}),
+                  Entrance(KAK_IMPAS_LEDGE,             {[]{return (logic->IsChild && logic->AtDay) || logic->CanUse(HOOKSHOT) || (logic->IsAdult && settings->LogicVisibleCollision);}}),
+                  Entrance(KAK_ROOFTOP,                 {[]{return logic->CanUse(HOOKSHOT) || (settings->LogicManOnRoof && (logic->IsAdult || logic->AtDay || logic->Slingshot || logic->HasBombchus || logic->CanUse(BOW) || logic->CanUse(LONGSHOT)));}}),
+                  Entrance(KAK_IMPAS_ROOFTOP,           {[]{return logic->CanUse(HOOKSHOT) || (settings->LogicKakarikoRooftopGS && logic->CanUse(HOVER_BOOTS));}}),
                   Entrance(THE_GRAVEYARD,               {[]{return true;}}),
-                  Entrance(KAK_BEHIND_GATE,             {[]{return IsAdult || (KakarikoVillageGateOpen);}}),
+                  Entrance(KAK_BEHIND_GATE,             {[]{return logic->IsAdult || (logic->KakarikoVillageGateOpen);}}),
   });
 
-  areaTable[KAK_IMPAS_LEDGE] = Area("Kak Impas Ledge", "Kakariko Village", KAKARIKO_VILLAGE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[KAK_IMPAS_LEDGE] = Area("Kak Impas Ledge", "Kakariko Village", KAKARIKO_VILLAGE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(KAK_IMPAS_HOUSE_BACK, {[]{return true;}}),
                   Entrance(KAKARIKO_VILLAGE,     {[]{return true;}}),
   });
 
-  areaTable[KAK_IMPAS_ROOFTOP] = Area("Kak Impas Rooftop", "Kakariko Village", KAKARIKO_VILLAGE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[KAK_IMPAS_ROOFTOP] = Area("Kak Impas Rooftop", "Kakariko Village", KAKARIKO_VILLAGE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(KAK_GS_ABOVE_IMPAS_HOUSE, {[]{return IsAdult && AtNight && CanGetNightTimeGS && (CanJumpslash || CanUseProjectile);}}),
+                  LocationAccess(KAK_GS_ABOVE_IMPAS_HOUSE, {[]{return logic->IsAdult && logic->AtNight && logic->CanGetNightTimeGS && (logic->CanJumpslash || logic->CanUseProjectile);}}),
                 }, {
                   //Exits
                   Entrance(KAK_IMPAS_LEDGE,  {[]{return true;}}),
                   Entrance(KAKARIKO_VILLAGE, {[]{return true;}}),
   });
 
-  areaTable[KAK_ROOFTOP] = Area("Kak Rooftop", "Kakariko Village", KAKARIKO_VILLAGE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[KAK_ROOFTOP] = Area("Kak Rooftop", "Kakariko Village", KAKARIKO_VILLAGE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(KAK_MAN_ON_ROOF, {[]{return true;}}),
                 }, {
@@ -64,42 +65,42 @@ void AreaTable_Init_Kakariko() {
                   Entrance(KAK_BACKYARD, {[]{return true;}}),
   });
 
-  areaTable[KAK_BACKYARD] = Area("Kak Backyard", "Kakariko Village", KAKARIKO_VILLAGE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[KAK_BACKYARD] = Area("Kak Backyard", "Kakariko Village", KAKARIKO_VILLAGE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(KAKARIKO_VILLAGE,          {[]{return true;}}),
                   Entrance(KAK_OPEN_GROTTO,           {[]{return true;}}),
-                  Entrance(KAK_ODD_POTION_BUILDING, {[]{return IsAdult;}}),
-                  Entrance(KAK_POTION_SHOP_BACK,      {[]{return IsAdult && AtDay;}}),
+                  Entrance(KAK_ODD_POTION_BUILDING, {[]{return logic->IsAdult;}}),
+                  Entrance(KAK_POTION_SHOP_BACK,      {[]{return logic->IsAdult && logic->AtDay;}}),
   });
 
-  areaTable[KAK_CARPENTER_BOSS_HOUSE] = Area("Kak Carpenter Boss House", "Kak Carpenter Boss House", NONE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[KAK_CARPENTER_BOSS_HOUSE] = Area("Kak Carpenter Boss House", "Kak Carpenter Boss House", NONE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&WakeUpAdultTalon, {[]{return WakeUpAdultTalon || (IsAdult && PocketEgg);}}),
+                  EventAccess(&Logic::Vars::WakeUpAdultTalon, {[]{return logic->WakeUpAdultTalon || (logic->IsAdult && logic->PocketEgg);}}),
                 }, {}, {
                   //Exits
                   Entrance(KAKARIKO_VILLAGE, {[]{return true;}}),
   });
 
-  areaTable[KAK_HOUSE_OF_SKULLTULA] = Area("Kak House of Skulltula", "Kak House of Skulltula", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[KAK_HOUSE_OF_SKULLTULA] = Area("Kak House of Skulltula", "Kak House of Skulltula", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(KAK_10_GOLD_SKULLTULA_REWARD, {[]{return GoldSkulltulaTokens >= 10;}}),
-                  LocationAccess(KAK_20_GOLD_SKULLTULA_REWARD, {[]{return GoldSkulltulaTokens >= 20;}}),
-                  LocationAccess(KAK_30_GOLD_SKULLTULA_REWARD, {[]{return GoldSkulltulaTokens >= 30;}}),
-                  LocationAccess(KAK_40_GOLD_SKULLTULA_REWARD, {[]{return GoldSkulltulaTokens >= 40;}}),
-                  LocationAccess(KAK_50_GOLD_SKULLTULA_REWARD, {[]{return GoldSkulltulaTokens >= 50;}}),
-                  LocationAccess(KAK_100_GOLD_SKULLTULA_REWARD, {[]{return GoldSkulltulaTokens >= 100;}})
+                  LocationAccess(KAK_10_GOLD_SKULLTULA_REWARD, {[]{return logic->GoldSkulltulaTokens >= 10;}}),
+                  LocationAccess(KAK_20_GOLD_SKULLTULA_REWARD, {[]{return logic->GoldSkulltulaTokens >= 20;}}),
+                  LocationAccess(KAK_30_GOLD_SKULLTULA_REWARD, {[]{return logic->GoldSkulltulaTokens >= 30;}}),
+                  LocationAccess(KAK_40_GOLD_SKULLTULA_REWARD, {[]{return logic->GoldSkulltulaTokens >= 40;}}),
+                  LocationAccess(KAK_50_GOLD_SKULLTULA_REWARD, {[]{return logic->GoldSkulltulaTokens >= 50;}}),
+                  LocationAccess(KAK_100_GOLD_SKULLTULA_REWARD, {[]{return logic->GoldSkulltulaTokens >= 100;}})
                 }, {
                   //Exits
                   Entrance(KAKARIKO_VILLAGE, {[]{return true;}}),
   });
 
-  areaTable[KAK_IMPAS_HOUSE] = Area("Kak Impas House", "Kak Impas House", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[KAK_IMPAS_HOUSE] = Area("Kak Impas House", "Kak Impas House", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(KAK_IMPAS_HOUSE_NEAR_COW, {[]{return true;}}),
                   Entrance(KAKARIKO_VILLAGE,         {[]{return true;}}),
   });
 
-  areaTable[KAK_IMPAS_HOUSE_BACK] = Area("Kak Impas House Back", "Kak Impas House", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[KAK_IMPAS_HOUSE_BACK] = Area("Kak Impas House Back", "Kak Impas House", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(KAK_IMPAS_HOUSE_FREESTANDING_POH, {[]{return true;}}),
                 }, {
@@ -108,25 +109,25 @@ void AreaTable_Init_Kakariko() {
                   Entrance(KAK_IMPAS_HOUSE_NEAR_COW, {[]{return true;}}),
   });
 
-  areaTable[KAK_IMPAS_HOUSE_NEAR_COW] = Area("Kak Impas House Near Cow", "Kak Impas House", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[KAK_IMPAS_HOUSE_NEAR_COW] = Area("Kak Impas House Near Cow", "Kak Impas House", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(KAK_IMPAS_HOUSE_COW, {[]{return CanPlay(EponasSong);}}),
+                  LocationAccess(KAK_IMPAS_HOUSE_COW, {[]{return logic->CanPlay(logic->EponasSong);}}),
   }, {});
 
-  areaTable[KAK_WINDMILL] = Area("Kak Windmill", "Windmill and Dampes Grave", NONE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[KAK_WINDMILL] = Area("Kak Windmill", "Windmill and Dampes Grave", NONE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&DrainWell, {[]{return DrainWell || (IsChild && CanPlay(SongOfStorms));}}),
+                  EventAccess(&Logic::Vars::DrainWell, {[]{return logic->DrainWell || (logic->IsChild && logic->CanPlay(logic->SongOfStorms));}}),
                 }, {
                   //Locations
-                  LocationAccess(KAK_WINDMILL_FREESTANDING_POH, {[]{return CanUse(BOOMERANG) || DampesWindmillAccess || (IsAdult && LogicAdultWindmillPoH) || (IsChild && CanJumpslash && LogicChildWindmillPoH);}}),
+                  LocationAccess(KAK_WINDMILL_FREESTANDING_POH, {[]{return logic->CanUse(BOOMERANG) || logic->DampesWindmillAccess || (logic->IsAdult && settings->LogicAdultWindmillPoH) || (logic->IsChild && logic->CanJumpslash && settings->LogicChildWindmillPoH);}}),
                     //PoH as child not added to trick options yet (needs uncommenting in randomizer_tricks.cpp)
-                  LocationAccess(SONG_FROM_WINDMILL,            {[]{return IsAdult && Ocarina;}}),
+                  LocationAccess(SONG_FROM_WINDMILL,            {[]{return logic->IsAdult && logic->Ocarina;}}),
                 }, {
                   //Exits
                   Entrance(KAKARIKO_VILLAGE, {[]{return true;}}),
   });
 
-  areaTable[KAK_BAZAAR] = Area("Kak Bazaar", "Kak Bazaar", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[KAK_BAZAAR] = Area("Kak Bazaar", "Kak Bazaar", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(KAK_BAZAAR_ITEM_1, {[]{return true;}}),
                   LocationAccess(KAK_BAZAAR_ITEM_2, {[]{return true;}}),
@@ -141,56 +142,56 @@ void AreaTable_Init_Kakariko() {
                   Entrance(KAKARIKO_VILLAGE, {[]{return true;}}),
   });
 
-  areaTable[KAK_SHOOTING_GALLERY] = Area("Kak Shooting Gallery", "Kak Shooting Gallery", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[KAK_SHOOTING_GALLERY] = Area("Kak Shooting Gallery", "Kak Shooting Gallery", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(KAK_SHOOTING_GALLERY_REWARD, {[]{return IsAdult && Bow;}}),
+                  LocationAccess(KAK_SHOOTING_GALLERY_REWARD, {[]{return logic->IsAdult && logic->Bow;}}),
                 }, {
                   //Exits
                   Entrance(KAKARIKO_VILLAGE, {[]{return true;}}),
   });
 
-  areaTable[KAK_POTION_SHOP_FRONT] = Area("Kak Potion Shop Front", "Kak Potion Shop", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[KAK_POTION_SHOP_FRONT] = Area("Kak Potion Shop Front", "Kak Potion Shop", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(KAK_POTION_SHOP_ITEM_1, {[]{return IsAdult;}}),
-                  LocationAccess(KAK_POTION_SHOP_ITEM_2, {[]{return IsAdult;}}),
-                  LocationAccess(KAK_POTION_SHOP_ITEM_3, {[]{return IsAdult;}}),
-                  LocationAccess(KAK_POTION_SHOP_ITEM_4, {[]{return IsAdult;}}),
-                  LocationAccess(KAK_POTION_SHOP_ITEM_5, {[]{return IsAdult;}}),
-                  LocationAccess(KAK_POTION_SHOP_ITEM_6, {[]{return IsAdult;}}),
-                  LocationAccess(KAK_POTION_SHOP_ITEM_7, {[]{return IsAdult;}}),
-                  LocationAccess(KAK_POTION_SHOP_ITEM_8, {[]{return IsAdult;}}),
+                  LocationAccess(KAK_POTION_SHOP_ITEM_1, {[]{return logic->IsAdult;}}),
+                  LocationAccess(KAK_POTION_SHOP_ITEM_2, {[]{return logic->IsAdult;}}),
+                  LocationAccess(KAK_POTION_SHOP_ITEM_3, {[]{return logic->IsAdult;}}),
+                  LocationAccess(KAK_POTION_SHOP_ITEM_4, {[]{return logic->IsAdult;}}),
+                  LocationAccess(KAK_POTION_SHOP_ITEM_5, {[]{return logic->IsAdult;}}),
+                  LocationAccess(KAK_POTION_SHOP_ITEM_6, {[]{return logic->IsAdult;}}),
+                  LocationAccess(KAK_POTION_SHOP_ITEM_7, {[]{return logic->IsAdult;}}),
+                  LocationAccess(KAK_POTION_SHOP_ITEM_8, {[]{return logic->IsAdult;}}),
                 }, {
                   //Exits
                   Entrance(KAKARIKO_VILLAGE,     {[]{return true;}}),
-                  Entrance(KAK_POTION_SHOP_BACK, {[]{return IsAdult;}}),
+                  Entrance(KAK_POTION_SHOP_BACK, {[]{return logic->IsAdult;}}),
   });
 
-  areaTable[KAK_POTION_SHOP_BACK] = Area("Kak Potion Shop Back", "Kak Potion Shop", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[KAK_POTION_SHOP_BACK] = Area("Kak Potion Shop Back", "Kak Potion Shop", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(KAK_BACKYARD,          {[]{return IsAdult;}}),
+                  Entrance(KAK_BACKYARD,          {[]{return logic->IsAdult;}}),
                   Entrance(KAK_POTION_SHOP_FRONT, {[]{return true;}}),
   });
 
-  areaTable[KAK_ODD_POTION_BUILDING] = Area("Kak Granny's Potion Shop", "Kak Granny's Potion Shop", NONE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[KAK_ODD_POTION_BUILDING] = Area("Kak Granny's Potion Shop", "Kak Granny's Potion Shop", NONE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&OddPoulticeAccess, {[]{return OddPoulticeAccess || (IsAdult && (OddMushroomAccess || (OddMushroom && DisableTradeRevert)));}}),
+                  EventAccess(&Logic::Vars::OddPoulticeAccess, {[]{return logic->OddPoulticeAccess || (logic->IsAdult && (logic->OddMushroomAccess || (logic->OddMushroom && logic->DisableTradeRevert)));}}),
                 }, {
-                  LocationAccess(KAK_TRADE_ODD_MUSHROOM, {[]{return IsAdult && OddMushroom;}}),
-                  LocationAccess(KAK_GRANNYS_SHOP, {[]{return IsAdult && OddMushroom && AdultsWallet;}}),
+                  LocationAccess(KAK_TRADE_ODD_MUSHROOM, {[]{return logic->IsAdult && logic->OddMushroom;}}),
+                  LocationAccess(KAK_GRANNYS_SHOP, {[]{return logic->IsAdult && logic->OddMushroom && logic->AdultsWallet;}}),
                 }, {
                   //Exits
                   Entrance(KAK_BACKYARD, {[]{return true;}}),
   });
 
-  areaTable[KAK_REDEAD_GROTTO] = Area("Kak Redead Grotto", "Kak Redead Grotto", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[KAK_REDEAD_GROTTO] = Area("Kak Redead Grotto", "Kak Redead Grotto", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(KAK_REDEAD_GROTTO_CHEST, {[]{return CanUse(STICKS) || CanUse(KOKIRI_SWORD) || CanUse(DINS_FIRE) || CanUse(MEGATON_HAMMER) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD);}}),
+                  LocationAccess(KAK_REDEAD_GROTTO_CHEST, {[]{return logic->CanUse(STICKS) || logic->CanUse(KOKIRI_SWORD) || logic->CanUse(DINS_FIRE) || logic->CanUse(MEGATON_HAMMER) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD);}}),
                 }, {
                   //Exits
                   Entrance(KAKARIKO_VILLAGE, {[]{return true;}}),
   });
 
-  areaTable[KAK_OPEN_GROTTO] = Area("Kak Open Grotto", "Kak Open Grotto", NONE, NO_DAY_NIGHT_CYCLE, grottoEvents, {
+  world->areaTable[KAK_OPEN_GROTTO] = Area("Kak Open Grotto", "Kak Open Grotto", NONE, NO_DAY_NIGHT_CYCLE, grottoEvents, {
                   //Locations
                   LocationAccess(KAK_OPEN_GROTTO_CHEST,        {[]{return true;}}),
                   LocationAccess(KAK_OPEN_GROTTO_GOSSIP_STONE, {[]{return true;}}),
@@ -199,29 +200,29 @@ void AreaTable_Init_Kakariko() {
                   Entrance(KAK_BACKYARD, {[]{return true;}}),
   });
 
-  areaTable[THE_GRAVEYARD] = Area("The Graveyard", "The Graveyard", THE_GRAVEYARD, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[THE_GRAVEYARD] = Area("The Graveyard", "The Graveyard", THE_GRAVEYARD, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&ButterflyFairy, {[]{return ButterflyFairy || (CanUse(STICKS) && AtDay);}}),
-                  EventAccess(&BeanPlantFairy, {[]{return BeanPlantFairy || (CanPlantBean(THE_GRAVEYARD) && CanPlay(SongOfStorms));}}),
-                  EventAccess(&BugRock,        {[]{return true;}}),
+                  EventAccess(&Logic::Vars::ButterflyFairy, {[]{return logic->ButterflyFairy || (logic->CanUse(STICKS) && logic->AtDay);}}),
+                  EventAccess(&Logic::Vars::BeanPlantFairy, {[]{return logic->BeanPlantFairy || (CanPlantBean(THE_GRAVEYARD) && logic->CanPlay(logic->SongOfStorms));}}),
+                  EventAccess(&Logic::Vars::BugRock,        {[]{return true;}}),
                 }, {
                   //Locations
-                  LocationAccess(GRAVEYARD_FREESTANDING_POH,        {[]{return (IsAdult && CanPlantBean(THE_GRAVEYARD)) || CanUse(LONGSHOT) || (LogicGraveyardPoH && CanUse(BOOMERANG));}}),
-                  LocationAccess(GRAVEYARD_DAMPE_GRAVEDIGGING_TOUR, {[]{return IsChild && AtNight;}}), //TODO: This needs to change
-                  LocationAccess(GRAVEYARD_GS_WALL,                 {[]{return IsChild && HookshotOrBoomerang && AtNight && CanGetNightTimeGS;}}),
-                  LocationAccess(GRAVEYARD_GS_BEAN_PATCH,           {[]{return CanPlantBugs && CanChildAttack;}}),
+                  LocationAccess(GRAVEYARD_FREESTANDING_POH,        {[]{return (logic->IsAdult && CanPlantBean(THE_GRAVEYARD)) || logic->CanUse(LONGSHOT) || (settings->LogicGraveyardPoH && logic->CanUse(BOOMERANG));}}),
+                  LocationAccess(GRAVEYARD_DAMPE_GRAVEDIGGING_TOUR, {[]{return logic->IsChild && logic->AtNight;}}), //TODO: This needs to change
+                  LocationAccess(GRAVEYARD_GS_WALL,                 {[]{return logic->IsChild && logic->HookshotOrBoomerang && logic->AtNight && logic->CanGetNightTimeGS;}}),
+                  LocationAccess(GRAVEYARD_GS_BEAN_PATCH,           {[]{return logic->CanPlantBugs && logic->CanChildAttack;}}),
                 }, {
                   //Exits
-                  Entrance(GRAVEYARD_SHIELD_GRAVE,       {[]{return IsAdult || AtNight;}}),
-                  Entrance(GRAVEYARD_COMPOSERS_GRAVE,    {[]{return CanPlay(ZeldasLullaby);}}),
-                  Entrance(GRAVEYARD_HEART_PIECE_GRAVE,  {[]{return IsAdult || AtNight;}}),
-                  Entrance(GRAVEYARD_DAMPES_GRAVE,       {[]{return IsAdult;}}),
-                  Entrance(GRAVEYARD_DAMPES_HOUSE,       {[]{return IsAdult || AtDampeTime;}}), //TODO: This needs to be handled
+                  Entrance(GRAVEYARD_SHIELD_GRAVE,       {[]{return logic->IsAdult || logic->AtNight;}}),
+                  Entrance(GRAVEYARD_COMPOSERS_GRAVE,    {[]{return logic->CanPlay(logic->ZeldasLullaby);}}),
+                  Entrance(GRAVEYARD_HEART_PIECE_GRAVE,  {[]{return logic->IsAdult || logic->AtNight;}}),
+                  Entrance(GRAVEYARD_DAMPES_GRAVE,       {[]{return logic->IsAdult;}}),
+                  Entrance(GRAVEYARD_DAMPES_HOUSE,       {[]{return logic->IsAdult || logic->AtDampeTime;}}), //TODO: This needs to be handled
                   Entrance(KAKARIKO_VILLAGE,             {[]{return true;}}),
                   Entrance(GRAVEYARD_WARP_PAD_REGION,    {[]{return false;}}),
   });
 
-  areaTable[GRAVEYARD_SHIELD_GRAVE] = Area("Graveyard Shield Grave", "Graveyard Shield Grave", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[GRAVEYARD_SHIELD_GRAVE] = Area("Graveyard Shield Grave", "Graveyard Shield Grave", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(GRAVEYARD_SHIELD_GRAVE_CHEST, {[]{return true;}}),
                   //Free Fairies
@@ -230,57 +231,57 @@ void AreaTable_Init_Kakariko() {
                   Entrance(THE_GRAVEYARD, {[]{return true;}}),
   });
 
-  areaTable[GRAVEYARD_HEART_PIECE_GRAVE] = Area("Graveyard Heart Piece Grave", "Graveyard Heart Piece Grave", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[GRAVEYARD_HEART_PIECE_GRAVE] = Area("Graveyard Heart Piece Grave", "Graveyard Heart Piece Grave", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(GRAVEYARD_HEART_PIECE_GRAVE_CHEST, {[]{return CanPlay(SunsSong);}}),
+                  LocationAccess(GRAVEYARD_HEART_PIECE_GRAVE_CHEST, {[]{return logic->CanPlay(logic->SunsSong);}}),
                 }, {
                   //Exits
                   Entrance(THE_GRAVEYARD, {[]{return true;}}),
   });
 
-  areaTable[GRAVEYARD_COMPOSERS_GRAVE] = Area("Graveyard Composers Grave", "Graveyard Composers Grave", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[GRAVEYARD_COMPOSERS_GRAVE] = Area("Graveyard Composers Grave", "Graveyard Composers Grave", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(GRAVEYARD_COMPOSERS_GRAVE_CHEST, {[]{return HasFireSource;}}),
-                  LocationAccess(SONG_FROM_COMPOSERS_GRAVE,       {[]{return CanUseProjectile || CanJumpslash || CanUse(MEGATON_HAMMER);}}),
+                  LocationAccess(GRAVEYARD_COMPOSERS_GRAVE_CHEST, {[]{return logic->HasFireSource;}}),
+                  LocationAccess(SONG_FROM_COMPOSERS_GRAVE,       {[]{return logic->CanUseProjectile || logic->CanJumpslash || logic->CanUse(MEGATON_HAMMER);}}),
                 }, {
                   //Exits
                   Entrance(THE_GRAVEYARD, {[]{return true;}}),
   });
 
-  areaTable[GRAVEYARD_DAMPES_GRAVE] = Area("Graveyard Dampes Grave", "Windmill and Dampes Grave", NONE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GRAVEYARD_DAMPES_GRAVE] = Area("Graveyard Dampes Grave", "Windmill and Dampes Grave", NONE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&NutPot,               {[]{return true;}}),
-                  EventAccess(&DampesWindmillAccess, {[]{return DampesWindmillAccess || (IsAdult && CanPlay(SongOfTime));}}),
+                  EventAccess(&Logic::Vars::NutPot,               {[]{return true;}}),
+                  EventAccess(&Logic::Vars::DampesWindmillAccess, {[]{return logic->DampesWindmillAccess || (logic->IsAdult && logic->CanPlay(logic->SongOfTime));}}),
                 }, {
                   //Locations
                   LocationAccess(GRAVEYARD_HOOKSHOT_CHEST,              {[]{return true;}}),
-                  LocationAccess(GRAVEYARD_DAMPE_RACE_FREESTANDING_POH, {[]{return IsAdult || LogicChildDampeRacePoH;}}),
+                  LocationAccess(GRAVEYARD_DAMPE_RACE_FREESTANDING_POH, {[]{return logic->IsAdult || settings->LogicChildDampeRacePoH;}}),
                 }, {
                   //Exits
                   Entrance(THE_GRAVEYARD, {[]{return true;}}),
-                  Entrance(KAK_WINDMILL,  {[]{return IsAdult && CanPlay(SongOfTime);}}),
+                  Entrance(KAK_WINDMILL,  {[]{return logic->IsAdult && logic->CanPlay(logic->SongOfTime);}}),
   });
 
-  areaTable[GRAVEYARD_DAMPES_HOUSE] = Area("Graveyard Dampes House", "Graveyard Dampes House", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[GRAVEYARD_DAMPES_HOUSE] = Area("Graveyard Dampes House", "Graveyard Dampes House", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(THE_GRAVEYARD, {[]{return true;}}),
   });
 
-  areaTable[GRAVEYARD_WARP_PAD_REGION] = Area("Graveyard Warp Pad Region", "Graveyard", THE_GRAVEYARD, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[GRAVEYARD_WARP_PAD_REGION] = Area("Graveyard Warp Pad Region", "Graveyard", THE_GRAVEYARD, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&GossipStoneFairy, {[]{return GossipStoneFairy || CanSummonGossipFairyWithoutSuns;}}),
+                  EventAccess(&Logic::Vars::GossipStoneFairy, {[]{return logic->GossipStoneFairy || logic->CanSummonGossipFairyWithoutSuns;}}),
                 }, {
                   //Locations
                   LocationAccess(GRAVEYARD_GOSSIP_STONE, {[]{return true;}}),
                 }, {
                   //Exits
                   Entrance(THE_GRAVEYARD,             {[]{return true;}}),
-                  Entrance(SHADOW_TEMPLE_ENTRYWAY,    {[]{return CanUse(DINS_FIRE) || (LogicShadowFireArrowEntry && IsAdult && CanUse(FIRE_ARROWS));}}),
+                  Entrance(SHADOW_TEMPLE_ENTRYWAY,    {[]{return logic->CanUse(DINS_FIRE) || (settings->LogicShadowFireArrowEntry && logic->IsAdult && logic->CanUse(FIRE_ARROWS));}}),
   });
 
-  areaTable[KAK_BEHIND_GATE] = Area("Kak Behind Gate", "Kakariko Village", KAKARIKO_VILLAGE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[KAK_BEHIND_GATE] = Area("Kak Behind Gate", "Kakariko Village", KAKARIKO_VILLAGE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(KAKARIKO_VILLAGE,     {[]{return IsAdult || LogicVisibleCollision || KakarikoVillageGateOpen || OpenKakariko.Is(OPENKAKARIKO_OPEN);}}),
+                  Entrance(KAKARIKO_VILLAGE,     {[]{return logic->IsAdult || settings->LogicVisibleCollision || logic->KakarikoVillageGateOpen || settings->OpenKakariko.Is(OPENKAKARIKO_OPEN);}}),
                   Entrance(DEATH_MOUNTAIN_TRAIL, {[]{return true;}}),
   });
 }
@@ -1,22 +1,23 @@
 #include "../location_access.hpp"
 #include "../logic.hpp"
 #include "../entrance.hpp"
+#include "../world.hpp"
 
 using namespace Logic;
 using namespace Settings;
 
 void AreaTable_Init_LostWoods() {
-  areaTable[KOKIRI_FOREST] = Area("Kokiri Forest", "Kokiri Forest", KOKIRI_FOREST, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[KOKIRI_FOREST] = Area("Kokiri Forest", "Kokiri Forest", KOKIRI_FOREST, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&BeanPlantFairy,           {[]{return BeanPlantFairy   || (CanPlantBean(KOKIRI_FOREST) && CanPlay(SongOfStorms));}}),
-                  EventAccess(&GossipStoneFairy,         {[]{return GossipStoneFairy || CanSummonGossipFairyWithoutSuns;}}),
-                  EventAccess(&ShowedMidoSwordAndShield, {[]{return ShowedMidoSwordAndShield || (IsChild && KokiriSword && DekuShield);}}),
+                  EventAccess(&Logic::Vars::BeanPlantFairy,           {[]{return logic->BeanPlantFairy   || (CanPlantBean(KOKIRI_FOREST) && logic->CanPlay(logic->SongOfStorms));}}),
+                  EventAccess(&Logic::Vars::GossipStoneFairy,         {[]{return logic->GossipStoneFairy || logic->CanSummonGossipFairyWithoutSuns;}}),
+                  EventAccess(&Logic::Vars::ShowedMidoSwordAndShield, {[]{return logic->ShowedMidoSwordAndShield || (logic->IsChild && logic->KokiriSword && logic->DekuShield);}}),
                 }, {
                   //Locations
-                  LocationAccess(KF_KOKIRI_SWORD_CHEST,   {[]{return IsChild;}}),
-                  LocationAccess(KF_GS_KNOW_IT_ALL_HOUSE, {[]{return IsChild && CanChildAttack && AtNight && (HasNightStart || CanLeaveForest || CanPlay(SunsSong)) && CanGetNightTimeGS;}}),
-                  LocationAccess(KF_GS_BEAN_PATCH,        {[]{return CanPlantBugs && CanChildAttack;}}),
-                  LocationAccess(KF_GS_HOUSE_OF_TWINS,    {[]{return IsAdult && AtNight && (HookshotOrBoomerang || (LogicAdultKokiriGS && CanUse(HOVER_BOOTS))) && CanGetNightTimeGS;}}),
+                  LocationAccess(KF_KOKIRI_SWORD_CHEST,   {[]{return logic->IsChild;}}),
+                  LocationAccess(KF_GS_KNOW_IT_ALL_HOUSE, {[]{return logic->IsChild && logic->CanChildAttack && logic->AtNight && (settings->HasNightStart || logic->CanLeaveForest || logic->CanPlay(logic->SunsSong)) && logic->CanGetNightTimeGS;}}),
+                  LocationAccess(KF_GS_BEAN_PATCH,        {[]{return logic->CanPlantBugs && logic->CanChildAttack;}}),
+                  LocationAccess(KF_GS_HOUSE_OF_TWINS,    {[]{return logic->IsAdult && logic->AtNight && (logic->HookshotOrBoomerang || (settings->LogicAdultKokiriGS && logic->CanUse(HOVER_BOOTS))) && logic->CanGetNightTimeGS;}}),
                   LocationAccess(KF_GOSSIP_STONE,         {[]{return true;}}),
                 }, {
                   //Exits
@@ -26,36 +27,36 @@ void AreaTable_Init_LostWoods() {
                   Entrance(KF_HOUSE_OF_TWINS,     {[]{return true;}}),
                   Entrance(KF_KNOW_IT_ALL_HOUSE,  {[]{return true;}}),
                   Entrance(KF_KOKIRI_SHOP,        {[]{return true;}}),
-                  Entrance(KF_OUTSIDE_DEKU_TREE,  {[]{return IsAdult || OpenForest.Is(OPENFOREST_OPEN) || ShowedMidoSwordAndShield;}}),
+                  Entrance(KF_OUTSIDE_DEKU_TREE,  {[]{return logic->IsAdult || settings->OpenForest.Is(OPENFOREST_OPEN) || logic->ShowedMidoSwordAndShield;}}),
                   Entrance(THE_LOST_WOODS,        {[]{return true;}}),
-                  Entrance(LW_BRIDGE_FROM_FOREST, {[]{return IsAdult || OpenForest.IsNot(OPENFOREST_CLOSED) || DekuTreeClear;}}),
-                  Entrance(KF_STORMS_GROTTO,      {[]{return CanOpenStormGrotto;}}),
+                  Entrance(LW_BRIDGE_FROM_FOREST, {[]{return logic->IsAdult || settings->OpenForest.IsNot(OPENFOREST_CLOSED) || logic->DekuTreeClear;}}),
+                  Entrance(KF_STORMS_GROTTO,      {[]{return logic->CanOpenStormGrotto;}}),
   });
 
-  areaTable[KF_OUTSIDE_DEKU_TREE] = Area("KF Outside Deku Tree", "Kokiri Forest", KOKIRI_FOREST, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[KF_OUTSIDE_DEKU_TREE] = Area("KF Outside Deku Tree", "Kokiri Forest", KOKIRI_FOREST, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&DekuBabaSticks,           {[]{return DekuBabaSticks || ((IsAdult && (CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(KOKIRI_SWORD)) && !ShuffleEntrances) || (IsChild && (CanUse(KOKIRI_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(MASTER_SWORD) || CanUse(BOOMERANG))));}}),
-                  EventAccess(&DekuBabaNuts,             {[]{return DekuBabaNuts   || ((IsAdult && (CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD) || CanUse(KOKIRI_SWORD)) && !ShuffleEntrances) || (IsChild && (CanJumpslash || CanUse(SLINGSHOT) || HasExplosives || CanUse(DINS_FIRE))));}}),
-                  EventAccess(&ShowedMidoSwordAndShield, {[]{return ShowedMidoSwordAndShield || (IsChild && KokiriSword && DekuShield);}}),
+                  EventAccess(&Logic::Vars::DekuBabaSticks,           {[]{return logic->DekuBabaSticks || ((logic->IsAdult && (logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(KOKIRI_SWORD)) && !settings->ShuffleEntrances) || (logic->IsChild && (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BOOMERANG))));}}),
+                  EventAccess(&Logic::Vars::DekuBabaNuts,             {[]{return logic->DekuBabaNuts   || ((logic->IsAdult && (logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD) || logic->CanUse(KOKIRI_SWORD)) && !settings->ShuffleEntrances) || (logic->IsChild && (logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->HasExplosives || logic->CanUse(DINS_FIRE))));}}),
+                  EventAccess(&Logic::Vars::ShowedMidoSwordAndShield, {[]{return logic->ShowedMidoSwordAndShield || (logic->IsChild && logic->KokiriSword && logic->DekuShield);}}),
                 }, {
                   //Locations
                   LocationAccess(KF_DEKU_TREE_GOSSIP_STONE_LEFT,  {[]{return true;}}),
                   LocationAccess(KF_DEKU_TREE_GOSSIP_STONE_RIGHT, {[]{return true;}}),
                 }, {
                   //Exits
-                  Entrance(DEKU_TREE_ENTRYWAY, {[]{return IsChild || (ShuffleDungeonEntrances.IsNot(SHUFFLEDUNGEONS_OFF) && (OpenForest.Is(OPENFOREST_OPEN) || ShowedMidoSwordAndShield));}}),
-                  Entrance(KOKIRI_FOREST,      {[]{return IsAdult || OpenForest.Is(OPENFOREST_OPEN) || ShowedMidoSwordAndShield;}}),
+                  Entrance(DEKU_TREE_ENTRYWAY, {[]{return logic->IsChild || (settings->ShuffleDungeonEntrances.IsNot(SHUFFLEDUNGEONS_OFF) && (settings->OpenForest.Is(OPENFOREST_OPEN) || logic->ShowedMidoSwordAndShield));}}),
+                  Entrance(KOKIRI_FOREST,      {[]{return logic->IsAdult || settings->OpenForest.Is(OPENFOREST_OPEN) || logic->ShowedMidoSwordAndShield;}}),
   });
 
-  areaTable[KF_LINKS_HOUSE] = Area("KF Link's House", "KF Link's House", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[KF_LINKS_HOUSE] = Area("KF Link's House", "KF Link's House", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(KF_LINKS_HOUSE_COW, {[]{return IsAdult && CanPlay(EponasSong) && LinksCow;}}),
+                  LocationAccess(KF_LINKS_HOUSE_COW, {[]{return logic->IsAdult && logic->CanPlay(logic->EponasSong) && logic->LinksCow;}}),
                 }, {
                   //Exits
                   Entrance(KOKIRI_FOREST, {[]{return true;}})
   });
 
-  areaTable[KF_MIDOS_HOUSE] = Area("KF Mido's House", "KF Mido's House", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[KF_MIDOS_HOUSE] = Area("KF Mido's House", "KF Mido's House", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(KF_MIDOS_TOP_LEFT_CHEST,     {[]{return true;}}),
                   LocationAccess(KF_MIDOS_TOP_RIGHT_CHEST,    {[]{return true;}}),
@@ -66,22 +67,22 @@ void AreaTable_Init_LostWoods() {
                   Entrance(KOKIRI_FOREST, {[]{return true;}}),
   });
 
-  areaTable[KF_SARIAS_HOUSE] = Area("KF Saria's House", "KF Saria's House", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[KF_SARIAS_HOUSE] = Area("KF Saria's House", "KF Saria's House", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(KOKIRI_FOREST, {[]{return true;}}),
   });
 
-  areaTable[KF_HOUSE_OF_TWINS] = Area("KF House of Twins", "KF House of Twins", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[KF_HOUSE_OF_TWINS] = Area("KF House of Twins", "KF House of Twins", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(KOKIRI_FOREST, {[]{return true;}}),
   });
 
-  areaTable[KF_KNOW_IT_ALL_HOUSE] = Area("KF Know It All House", "KF Know It All House", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[KF_KNOW_IT_ALL_HOUSE] = Area("KF Know It All House", "KF Know It All House", NONE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(KOKIRI_FOREST, {[]{return true;}}),
   });
 
-  areaTable[KF_KOKIRI_SHOP] = Area("KF Kokiri Shop", "KF Kokiri Shop", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[KF_KOKIRI_SHOP] = Area("KF Kokiri Shop", "KF Kokiri Shop", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(KF_SHOP_ITEM_1, {[]{return true;}}),
                   LocationAccess(KF_SHOP_ITEM_2, {[]{return true;}}),
@@ -96,7 +97,7 @@ void AreaTable_Init_LostWoods() {
                   Entrance(KOKIRI_FOREST, {[]{return true;}}),
   });
 
-  areaTable[KF_STORMS_GROTTO] = Area("KF Storms Grotto", "KF Storms Grotto", NONE, NO_DAY_NIGHT_CYCLE, grottoEvents, {
+  world->areaTable[KF_STORMS_GROTTO] = Area("KF Storms Grotto", "KF Storms Grotto", NONE, NO_DAY_NIGHT_CYCLE, grottoEvents, {
                   //Locations
                   LocationAccess(KF_STORMS_GROTTO_CHEST,        {[]{return true;}}),
                   LocationAccess(KF_STORMS_GROTTO_GOSSIP_STONE, {[]{return true;}}),
@@ -105,57 +106,57 @@ void AreaTable_Init_LostWoods() {
                   Entrance(KOKIRI_FOREST, {[]{return true;}})
   });
 
-  areaTable[LW_FOREST_EXIT] = Area("LW Forest Exit", "Lost Woods", THE_LOST_WOODS, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[LW_FOREST_EXIT] = Area("LW Forest Exit", "Lost Woods", THE_LOST_WOODS, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(KOKIRI_FOREST, {[]{return true;}})
   });
 
-  areaTable[THE_LOST_WOODS] = Area("Lost Woods", "Lost Woods", THE_LOST_WOODS, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[THE_LOST_WOODS] = Area("Lost Woods", "Lost Woods", THE_LOST_WOODS, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&OddMushroomAccess, {[]{return OddMushroomAccess || (IsAdult && (CojiroAccess || Cojiro));}}),
-                  EventAccess(&PoachersSawAccess, {[]{return PoachersSawAccess || (IsAdult && OddPoulticeAccess);}}),
-                  EventAccess(&GossipStoneFairy,  {[]{return GossipStoneFairy  || CanSummonGossipFairyWithoutSuns;}}),
-                  EventAccess(&BeanPlantFairy,    {[]{return BeanPlantFairy    || CanPlay(SongOfStorms);}}),
-                  EventAccess(&BugShrub,          {[]{return IsChild && CanCutShrubs;}}),
+                  EventAccess(&Logic::Vars::OddMushroomAccess, {[]{return logic->OddMushroomAccess || (logic->IsAdult && (logic->CojiroAccess || logic->Cojiro));}}),
+                  EventAccess(&Logic::Vars::PoachersSawAccess, {[]{return logic->PoachersSawAccess || (logic->IsAdult && logic->OddPoulticeAccess);}}),
+                  EventAccess(&Logic::Vars::GossipStoneFairy,  {[]{return logic->GossipStoneFairy  || logic->CanSummonGossipFairyWithoutSuns;}}),
+                  EventAccess(&Logic::Vars::BeanPlantFairy,    {[]{return logic->BeanPlantFairy    || logic->CanPlay(logic->SongOfStorms);}}),
+                  EventAccess(&Logic::Vars::BugShrub,          {[]{return logic->IsChild && logic->CanCutShrubs;}}),
                 }, {
                   //Locations
-                  LocationAccess(LW_SKULL_KID,                 {[]{return IsChild && CanPlay(SariasSong);}}),
-                  LocationAccess(LW_TRADE_COJIRO,              {[]{return IsAdult && Cojiro;}}),
-                  LocationAccess(LW_TRADE_ODD_POTION,        {[]{return IsAdult && OddPoultice && Cojiro;}}),
-                  LocationAccess(LW_OCARINA_MEMORY_GAME,       {[]{return IsChild && Ocarina;}}),
-                  LocationAccess(LW_TARGET_IN_WOODS,           {[]{return IsChild && CanUse(SLINGSHOT);}}),
-                  LocationAccess(LW_DEKU_SCRUB_NEAR_BRIDGE,    {[]{return IsChild && CanStunDeku;}}),
-                  LocationAccess(LW_GS_BEAN_PATCH_NEAR_BRIDGE, {[]{return CanPlantBugs && CanChildAttack;}}),
+                  LocationAccess(LW_SKULL_KID,                 {[]{return logic->IsChild && logic->CanPlay(logic->SariasSong);}}),
+                  LocationAccess(LW_TRADE_COJIRO,              {[]{return logic->IsAdult && logic->Cojiro;}}),
+                  LocationAccess(LW_TRADE_ODD_POTION,        {[]{return logic->IsAdult && logic->OddPoultice && logic->Cojiro;}}),
+                  LocationAccess(LW_OCARINA_MEMORY_GAME,       {[]{return logic->IsChild && logic->Ocarina;}}),
+                  LocationAccess(LW_TARGET_IN_WOODS,           {[]{return logic->IsChild && logic->CanUse(SLINGSHOT);}}),
+                  LocationAccess(LW_DEKU_SCRUB_NEAR_BRIDGE,    {[]{return logic->IsChild && logic->CanStunDeku;}}),
+                  LocationAccess(LW_GS_BEAN_PATCH_NEAR_BRIDGE, {[]{return logic->CanPlantBugs && logic->CanChildAttack;}}),
                   LocationAccess(LW_GOSSIP_STONE,              {[]{return true;}}),
                 }, {
                   //Exits
                   Entrance(LW_FOREST_EXIT,           {[]{return true;}}),
                   Entrance(GC_WOODS_WARP,            {[]{return true;}}),
-                  Entrance(LW_BRIDGE,                {[]{return CanLeaveForest && ((IsAdult && (CanPlantBean(THE_LOST_WOODS) || LogicLostWoodsBridge)) || CanUse(HOVER_BOOTS) || CanUse(LONGSHOT));}}),
-                  Entrance(ZORAS_RIVER,              {[]{return CanLeaveForest && (CanDive || CanUse(IRON_BOOTS));}}),
-                  Entrance(LW_BEYOND_MIDO,           {[]{return IsChild || CanPlay(SariasSong) || LogicMidoBackflip;}}),
-                  Entrance(LW_NEAR_SHORTCUTS_GROTTO, {[]{return Here(THE_LOST_WOODS, []{return CanBlastOrSmash;});}}),
+                  Entrance(LW_BRIDGE,                {[]{return logic->CanLeaveForest && ((logic->IsAdult && (CanPlantBean(THE_LOST_WOODS) || settings->LogicLostWoodsBridge)) || logic->CanUse(HOVER_BOOTS) || logic->CanUse(LONGSHOT));}}),
+                  Entrance(ZORAS_RIVER,              {[]{return logic->CanLeaveForest && (logic->CanDive || logic->CanUse(IRON_BOOTS));}}),
+                  Entrance(LW_BEYOND_MIDO,           {[]{return logic->IsChild || logic->CanPlay(logic->SariasSong) || settings->LogicMidoBackflip;}}),
+                  Entrance(LW_NEAR_SHORTCUTS_GROTTO, {[]{return Here(THE_LOST_WOODS, []{return logic->CanBlastOrSmash;});}}),
   });
 
-  areaTable[LW_BEYOND_MIDO] = Area("LW Beyond Mido", "Lost Woods", THE_LOST_WOODS, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[LW_BEYOND_MIDO] = Area("LW Beyond Mido", "Lost Woods", THE_LOST_WOODS, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&ButterflyFairy, {[]{return ButterflyFairy || CanUse(STICKS);}}),
+                  EventAccess(&Logic::Vars::ButterflyFairy, {[]{return logic->ButterflyFairy || logic->CanUse(STICKS);}}),
                 }, {
                   //Locations
-                  LocationAccess(LW_DEKU_SCRUB_NEAR_DEKU_THEATER_RIGHT, {[]{return IsChild && CanStunDeku;}}),
-                  LocationAccess(LW_DEKU_SCRUB_NEAR_DEKU_THEATER_LEFT,  {[]{return IsChild && CanStunDeku;}}),
-                  LocationAccess(LW_GS_ABOVE_THEATER,                   {[]{return IsAdult && AtNight && ((CanPlantBean(LW_BEYOND_MIDO) && CanAdultAttack) || (LogicLostWoodsGSBean && CanUse(HOOKSHOT) && (CanUse(LONGSHOT) || CanUse(BOW) || CanUse(SLINGSHOT) || HasBombchus || CanUse(DINS_FIRE)))) && CanGetNightTimeGS;}}),
-                  LocationAccess(LW_GS_BEAN_PATCH_NEAR_THEATER,         {[]{return CanPlantBugs && (CanChildAttack || (Scrubsanity.Is(SCRUBSANITY_OFF) && DekuShield));}}),
+                  LocationAccess(LW_DEKU_SCRUB_NEAR_DEKU_THEATER_RIGHT, {[]{return logic->IsChild && logic->CanStunDeku;}}),
+                  LocationAccess(LW_DEKU_SCRUB_NEAR_DEKU_THEATER_LEFT,  {[]{return logic->IsChild && logic->CanStunDeku;}}),
+                  LocationAccess(LW_GS_ABOVE_THEATER,                   {[]{return logic->IsAdult && logic->AtNight && ((CanPlantBean(LW_BEYOND_MIDO) && logic->CanAdultAttack) || (settings->LogicLostWoodsGSBean && logic->CanUse(HOOKSHOT) && (logic->CanUse(LONGSHOT) || logic->CanUse(BOW) || logic->CanUse(SLINGSHOT) || logic->HasBombchus || logic->CanUse(DINS_FIRE)))) && logic->CanGetNightTimeGS;}}),
+                  LocationAccess(LW_GS_BEAN_PATCH_NEAR_THEATER,         {[]{return logic->CanPlantBugs && (logic->CanChildAttack || (settings->Scrubsanity.Is(SCRUBSANITY_OFF) && logic->DekuShield));}}),
                 }, {
                   //Exits
                   Entrance(LW_FOREST_EXIT,   {[]{return true;}}),
-                  Entrance(THE_LOST_WOODS,   {[]{return IsChild || CanPlay(SariasSong);}}),
+                  Entrance(THE_LOST_WOODS,   {[]{return logic->IsChild || logic->CanPlay(logic->SariasSong);}}),
                   Entrance(SFM_ENTRYWAY,     {[]{return true;}}),
                   Entrance(DEKU_THEATER,     {[]{return true;}}),
-                  Entrance(LW_SCRUBS_GROTTO, {[]{return Here(LW_BEYOND_MIDO, []{return CanBlastOrSmash;});}}),
+                  Entrance(LW_SCRUBS_GROTTO, {[]{return Here(LW_BEYOND_MIDO, []{return logic->CanBlastOrSmash;});}}),
   });
 
-  areaTable[LW_NEAR_SHORTCUTS_GROTTO] = Area("LW Near Shortcuts Grotto", "LW Near Shortcuts Grotto", NONE, NO_DAY_NIGHT_CYCLE, grottoEvents, {
+  world->areaTable[LW_NEAR_SHORTCUTS_GROTTO] = Area("LW Near Shortcuts Grotto", "LW Near Shortcuts Grotto", NONE, NO_DAY_NIGHT_CYCLE, grottoEvents, {
                   //Locations
                   LocationAccess(LW_NEAR_SHORTCUTS_GROTTO_CHEST,        {[]{return true;}}),
                   LocationAccess(LW_NEAR_SHORTCUTS_GROTTO_GOSSIP_STONE, {[]{return true;}}),
@@ -164,76 +165,76 @@ void AreaTable_Init_LostWoods() {
                   Entrance(THE_LOST_WOODS, {[]{return true;}}),
   });
 
-  areaTable[DEKU_THEATER] = Area("Deku Theater", "Deku Theater", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[DEKU_THEATER] = Area("Deku Theater", "Deku Theater", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(DEKU_THEATER_SKULL_MASK,    {[]{return IsChild && SkullMask;}}),
-                  LocationAccess(DEKU_THEATER_MASK_OF_TRUTH, {[]{return IsChild && MaskOfTruth;}}),
+                  LocationAccess(DEKU_THEATER_SKULL_MASK,    {[]{return logic->IsChild && logic->SkullMask;}}),
+                  LocationAccess(DEKU_THEATER_MASK_OF_TRUTH, {[]{return logic->IsChild && logic->MaskOfTruth;}}),
                 }, {
                   //Exits
                   Entrance(LW_BEYOND_MIDO, {[]{return true;}}),
   });
 
-  areaTable[LW_SCRUBS_GROTTO] = Area("LW Scrubs Grotto", "LW Scrubs Grotto", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[LW_SCRUBS_GROTTO] = Area("LW Scrubs Grotto", "LW Scrubs Grotto", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(LW_DEKU_SCRUB_GROTTO_REAR,  {[]{return CanStunDeku;}}),
-                  LocationAccess(LW_DEKU_SCRUB_GROTTO_FRONT, {[]{return CanStunDeku;}}),
+                  LocationAccess(LW_DEKU_SCRUB_GROTTO_REAR,  {[]{return logic->CanStunDeku;}}),
+                  LocationAccess(LW_DEKU_SCRUB_GROTTO_FRONT, {[]{return logic->CanStunDeku;}}),
                 }, {
                   //Exits
                   Entrance(LW_BEYOND_MIDO, {[]{return true;}}),
   });
 
-  areaTable[SFM_ENTRYWAY] = Area("SFM Entryway", "Sacred Forest Meadow", SACRED_FOREST_MEADOW, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[SFM_ENTRYWAY] = Area("SFM Entryway", "Sacred Forest Meadow", SACRED_FOREST_MEADOW, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(LW_BEYOND_MIDO,       {[]{return true;}}),
-                  Entrance(SACRED_FOREST_MEADOW, {[]{return IsAdult || CanJumpslash || CanUse(SLINGSHOT) || CanUse(BOW) || CanUse(DINS_FIRE) || CanUse(MEGATON_HAMMER);}}),
-                  Entrance(SFM_WOLFOS_GROTTO,    {[]{return CanOpenBombGrotto;}}),
+                  Entrance(SACRED_FOREST_MEADOW, {[]{return logic->IsAdult || logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->CanUse(BOW) || logic->CanUse(DINS_FIRE) || logic->CanUse(MEGATON_HAMMER);}}),
+                  Entrance(SFM_WOLFOS_GROTTO,    {[]{return logic->CanOpenBombGrotto;}}),
   });
 
-  areaTable[SACRED_FOREST_MEADOW] = Area("Sacred Forest Meadow", "Sacred Forest Meadow", SACRED_FOREST_MEADOW, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[SACRED_FOREST_MEADOW] = Area("Sacred Forest Meadow", "Sacred Forest Meadow", SACRED_FOREST_MEADOW, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&GossipStoneFairy, {[]{return GossipStoneFairy || CanSummonGossipFairyWithoutSuns;}}),
+                  EventAccess(&Logic::Vars::GossipStoneFairy, {[]{return logic->GossipStoneFairy || logic->CanSummonGossipFairyWithoutSuns;}}),
                 }, {
                   //Locations
-                  LocationAccess(SONG_FROM_SARIA,             {[]{return IsChild && ZeldasLetter;}}),
-                  LocationAccess(SHEIK_IN_FOREST,             {[]{return IsAdult;}}),
-                  LocationAccess(SFM_GS,                      {[]{return IsAdult && HookshotOrBoomerang && AtNight && CanGetNightTimeGS;}}),
+                  LocationAccess(SONG_FROM_SARIA,             {[]{return logic->IsChild && logic->ZeldasLetter;}}),
+                  LocationAccess(SHEIK_IN_FOREST,             {[]{return logic->IsAdult;}}),
+                  LocationAccess(SFM_GS,                      {[]{return logic->IsAdult && logic->HookshotOrBoomerang && logic->AtNight && logic->CanGetNightTimeGS;}}),
                   LocationAccess(SFM_MAZE_GOSSIP_STONE_LOWER, {[]{return true;}}),
                   LocationAccess(SFM_MAZE_GOSSIP_STONE_UPPER, {[]{return true;}}),
                   LocationAccess(SFM_SARIA_GOSSIP_STONE,      {[]{return true;}}),
                 }, {
                   //Exits
                   Entrance(SFM_ENTRYWAY,           {[]{return true;}}),
-                  Entrance(FOREST_TEMPLE_ENTRYWAY, {[]{return CanUse(HOOKSHOT);}}),
+                  Entrance(FOREST_TEMPLE_ENTRYWAY, {[]{return logic->CanUse(HOOKSHOT);}}),
                   Entrance(SFM_FAIRY_GROTTO,       {[]{return true;}}),
-                  Entrance(SFM_STORMS_GROTTO,      {[]{return CanOpenStormGrotto;}}),
+                  Entrance(SFM_STORMS_GROTTO,      {[]{return logic->CanOpenStormGrotto;}}),
   });
 
-  areaTable[SFM_FAIRY_GROTTO] = Area("SFM Fairy Grotto", "SFM Fairy Grotto", NONE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[SFM_FAIRY_GROTTO] = Area("SFM Fairy Grotto", "SFM Fairy Grotto", NONE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&FreeFairies, {[]{return true;}}),
+                  EventAccess(&Logic::Vars::FreeFairies, {[]{return true;}}),
                 }, {}, {
                   //Exits
                   Entrance(SACRED_FOREST_MEADOW, {[]{return true;}}),
   });
 
-  areaTable[SFM_WOLFOS_GROTTO] = Area("SFM Wolfos Grotto", "SFM Wolfos Grotto", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SFM_WOLFOS_GROTTO] = Area("SFM Wolfos Grotto", "SFM Wolfos Grotto", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SFM_WOLFOS_GROTTO_CHEST, {[]{return CanJumpslash || CanUse(SLINGSHOT) || CanUse(BOW) || CanUse(DINS_FIRE) || CanUse(MEGATON_HAMMER);}}),
+                  LocationAccess(SFM_WOLFOS_GROTTO_CHEST, {[]{return logic->CanJumpslash || logic->CanUse(SLINGSHOT) || logic->CanUse(BOW) || logic->CanUse(DINS_FIRE) || logic->CanUse(MEGATON_HAMMER);}}),
                 }, {
                   //Exits
                   Entrance(SFM_ENTRYWAY, {[]{return true;}}),
   });
 
-  areaTable[SFM_STORMS_GROTTO] = Area("SFM Storms Grotto", "SFM Storms Grotto", NONE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SFM_STORMS_GROTTO] = Area("SFM Storms Grotto", "SFM Storms Grotto", NONE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SFM_DEKU_SCRUB_GROTTO_REAR,  {[]{return CanStunDeku;}}),
-                  LocationAccess(SFM_DEKU_SCRUB_GROTTO_FRONT, {[]{return CanStunDeku;}}),
+                  LocationAccess(SFM_DEKU_SCRUB_GROTTO_REAR,  {[]{return logic->CanStunDeku;}}),
+                  LocationAccess(SFM_DEKU_SCRUB_GROTTO_FRONT, {[]{return logic->CanStunDeku;}}),
                 }, {
                   //Exits
                   Entrance(SACRED_FOREST_MEADOW, {[]{return true;}}),
   });
 
-  areaTable[LW_BRIDGE_FROM_FOREST] = Area("LW Bridge From Forest", "Lost Woods", THE_LOST_WOODS, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[LW_BRIDGE_FROM_FOREST] = Area("LW Bridge From Forest", "Lost Woods", THE_LOST_WOODS, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(LW_GIFT_FROM_SARIA, {[]{return true;}}),
                 }, {
@@ -241,10 +242,10 @@ void AreaTable_Init_LostWoods() {
                   Entrance(LW_BRIDGE, {[]{return true;}}),
   });
 
-  areaTable[LW_BRIDGE] = Area("LW Bridge", "Lost Woods", THE_LOST_WOODS, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[LW_BRIDGE] = Area("LW Bridge", "Lost Woods", THE_LOST_WOODS, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(KOKIRI_FOREST,  {[]{return true;}}),
                   Entrance(HYRULE_FIELD,   {[]{return true;}}),
-                  Entrance(THE_LOST_WOODS, {[]{return CanUse(LONGSHOT);}}),
+                  Entrance(THE_LOST_WOODS, {[]{return logic->CanUse(LONGSHOT);}}),
   });
 }
@@ -2,6 +2,7 @@
 #include "../logic.hpp"
 #include "../entrance.hpp"
 #include "../dungeon.hpp"
+#include "../world.hpp"
 
 using namespace Logic;
 using namespace Settings;
@@ -10,170 +11,170 @@ void AreaTable_Init_ShadowTemple() {
   /*--------------------------
   |    VANILLA/MQ DECIDER    |
   ---------------------------*/
-  areaTable[SHADOW_TEMPLE_ENTRYWAY] = Area("Shadow Temple Entryway", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[SHADOW_TEMPLE_ENTRYWAY] = Area("Shadow Temple Entryway", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(SHADOW_TEMPLE_BEGINNING,    {[]{return Dungeon::ShadowTemple.IsVanilla() && (LogicLensShadow || CanUse(LENS_OF_TRUTH)) && (CanUse(HOVER_BOOTS) || CanUse(HOOKSHOT));}}),
-                  Entrance(SHADOW_TEMPLE_MQ_BEGINNING, {[]{return Dungeon::ShadowTemple.IsMQ()    && (LogicLensShadowMQ || CanUse(LENS_OF_TRUTH)) && (CanUse(HOVER_BOOTS) || CanUse(HOOKSHOT));}}),
+                  Entrance(SHADOW_TEMPLE_BEGINNING,    {[]{return world->dungeons.ShadowTemple.IsVanilla() && (settings->LogicLensShadow || logic->CanUse(LENS_OF_TRUTH)) && (logic->CanUse(HOVER_BOOTS) || logic->CanUse(HOOKSHOT));}}),
+                  Entrance(SHADOW_TEMPLE_MQ_BEGINNING, {[]{return world->dungeons.ShadowTemple.IsMQ()    && (settings->LogicLensShadowMQ || logic->CanUse(LENS_OF_TRUTH)) && (logic->CanUse(HOVER_BOOTS) || logic->CanUse(HOOKSHOT));}}),
                   Entrance(GRAVEYARD_WARP_PAD_REGION,  {[]{return true;}}),
   });
 
   /*--------------------------
   |     VANILLA DUNGEON      |
   ---------------------------*/
-  if (Dungeon::ShadowTemple.IsVanilla()) {
-  areaTable[SHADOW_TEMPLE_BEGINNING] = Area("Shadow Temple Beginning", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  if (world->dungeons.ShadowTemple.IsVanilla()) {
+  world->areaTable[SHADOW_TEMPLE_BEGINNING] = Area("Shadow Temple Beginning", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&NutPot, {[]{return true;}}),
+                  EventAccess(&Logic::Vars::NutPot, {[]{return true;}}),
                 }, {
                   //Locations
-                  LocationAccess(SHADOW_TEMPLE_MAP_CHEST,         {[]{return CanJumpslash;}}),
-                  LocationAccess(SHADOW_TEMPLE_HOVER_BOOTS_CHEST, {[]{return (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD));}}),
+                  LocationAccess(SHADOW_TEMPLE_MAP_CHEST,         {[]{return logic->CanJumpslash;}}),
+                  LocationAccess(SHADOW_TEMPLE_HOVER_BOOTS_CHEST, {[]{return (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD));}}),
                 }, {
                   //Exits
                   Entrance(SHADOW_TEMPLE_ENTRYWAY,     {[]{return true;}}),
-                  Entrance(SHADOW_TEMPLE_FIRST_BEAMOS, {[]{return CanUse(HOVER_BOOTS);}}),
+                  Entrance(SHADOW_TEMPLE_FIRST_BEAMOS, {[]{return logic->CanUse(HOVER_BOOTS);}}),
   });
 
-  areaTable[SHADOW_TEMPLE_FIRST_BEAMOS] = Area("Shadow Temple First Beamos", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[SHADOW_TEMPLE_FIRST_BEAMOS] = Area("Shadow Temple First Beamos", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&FairyPot, {[]{return true;}}), //This fairy pot is only on 3DS
+                  EventAccess(&Logic::Vars::FairyPot, {[]{return true;}}), //This fairy pot is only on 3DS
                 }, {
                   //Locations
-                  LocationAccess(SHADOW_TEMPLE_COMPASS_CHEST,            {[]{return CanJumpslash;}}),
-                  LocationAccess(SHADOW_TEMPLE_EARLY_SILVER_RUPEE_CHEST, {[]{return CanUse(HOVER_BOOTS) || CanUse(HOOKSHOT);}}),
+                  LocationAccess(SHADOW_TEMPLE_COMPASS_CHEST,            {[]{return logic->CanJumpslash;}}),
+                  LocationAccess(SHADOW_TEMPLE_EARLY_SILVER_RUPEE_CHEST, {[]{return logic->CanUse(HOVER_BOOTS) || logic->CanUse(HOOKSHOT);}}),
                   LocationAccess(SHADOW_TEMPLE_GS_NEAR_SHIP,             {[]{return false;}}),
                 }, {
                   //Exits
-                  Entrance(SHADOW_TEMPLE_HUGE_PIT,    {[]{return HasExplosives && IsAdult && SmallKeys(SHADOW_TEMPLE, 1, 2);}}),
+                  Entrance(SHADOW_TEMPLE_HUGE_PIT,    {[]{return logic->HasExplosives && logic->IsAdult && logic->SmallKeys(SHADOW_TEMPLE, 1, 2);}}),
                   Entrance(SHADOW_TEMPLE_BEYOND_BOAT, {[]{return false;}}),
   });
 
-  areaTable[SHADOW_TEMPLE_HUGE_PIT] = Area("Shadow Temple Huge Pit", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SHADOW_TEMPLE_HUGE_PIT] = Area("Shadow Temple Huge Pit", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SHADOW_TEMPLE_INVISIBLE_BLADES_VISIBLE_CHEST,   {[]{return CanJumpslash;}}),
-                  LocationAccess(SHADOW_TEMPLE_INVISIBLE_BLADES_INVISIBLE_CHEST, {[]{return CanJumpslash;}}),
+                  LocationAccess(SHADOW_TEMPLE_INVISIBLE_BLADES_VISIBLE_CHEST,   {[]{return logic->CanJumpslash;}}),
+                  LocationAccess(SHADOW_TEMPLE_INVISIBLE_BLADES_INVISIBLE_CHEST, {[]{return logic->CanJumpslash;}}),
                   LocationAccess(SHADOW_TEMPLE_FALLING_SPIKES_LOWER_CHEST,       {[]{return true;}}),
-                  LocationAccess(SHADOW_TEMPLE_FALLING_SPIKES_UPPER_CHEST,       {[]{return (LogicShadowUmbrella && HoverBoots) || GoronBracelet;}}),
-                  LocationAccess(SHADOW_TEMPLE_FALLING_SPIKES_SWITCH_CHEST,      {[]{return (LogicShadowUmbrella && HoverBoots) || GoronBracelet;}}),
-                  LocationAccess(SHADOW_TEMPLE_INVISIBLE_SPIKES_CHEST,           {[]{return SmallKeys(SHADOW_TEMPLE, 2, 3) && ((LogicLensShadowPlatform && LogicLensShadow) || CanUse(LENS_OF_TRUTH));}}),
-                  LocationAccess(SHADOW_TEMPLE_FREESTANDING_KEY,                 {[]{return SmallKeys(SHADOW_TEMPLE, 2, 3) && ((LogicLensShadowPlatform && LogicLensShadow) || CanUse(LENS_OF_TRUTH)) && Hookshot && (Bombs || GoronBracelet || (LogicShadowFreestandingKey && HasBombchus));}}),
-                  LocationAccess(SHADOW_TEMPLE_GS_LIKE_LIKE_ROOM,                {[]{return CanJumpslash;}}),
-                  LocationAccess(SHADOW_TEMPLE_GS_FALLING_SPIKES_ROOM,           {[]{return Hookshot || (LogicShadowUmbrellaGS && HoverBoots);}}),
-                  LocationAccess(SHADOW_TEMPLE_GS_SINGLE_GIANT_POT,              {[]{return SmallKeys(SHADOW_TEMPLE, 2, 3) && ((LogicLensShadowPlatform && LogicLensShadow) || CanUse(LENS_OF_TRUTH)) && Hookshot;}}),
+                  LocationAccess(SHADOW_TEMPLE_FALLING_SPIKES_UPPER_CHEST,       {[]{return (settings->LogicShadowUmbrella && logic->HoverBoots) || logic->GoronBracelet;}}),
+                  LocationAccess(SHADOW_TEMPLE_FALLING_SPIKES_SWITCH_CHEST,      {[]{return (settings->LogicShadowUmbrella && logic->HoverBoots) || logic->GoronBracelet;}}),
+                  LocationAccess(SHADOW_TEMPLE_INVISIBLE_SPIKES_CHEST,           {[]{return logic->SmallKeys(SHADOW_TEMPLE, 2, 3) && ((settings->LogicLensShadowPlatform && settings->LogicLensShadow) || logic->CanUse(LENS_OF_TRUTH));}}),
+                  LocationAccess(SHADOW_TEMPLE_FREESTANDING_KEY,                 {[]{return logic->SmallKeys(SHADOW_TEMPLE, 2, 3) && ((settings->LogicLensShadowPlatform && settings->LogicLensShadow) || logic->CanUse(LENS_OF_TRUTH)) && logic->Hookshot && (logic->Bombs || logic->GoronBracelet || (settings->LogicShadowFreestandingKey && logic->HasBombchus));}}),
+                  LocationAccess(SHADOW_TEMPLE_GS_LIKE_LIKE_ROOM,                {[]{return logic->CanJumpslash;}}),
+                  LocationAccess(SHADOW_TEMPLE_GS_FALLING_SPIKES_ROOM,           {[]{return logic->Hookshot || (settings->LogicShadowUmbrellaGS && logic->HoverBoots);}}),
+                  LocationAccess(SHADOW_TEMPLE_GS_SINGLE_GIANT_POT,              {[]{return logic->SmallKeys(SHADOW_TEMPLE, 2, 3) && ((settings->LogicLensShadowPlatform && settings->LogicLensShadow) || logic->CanUse(LENS_OF_TRUTH)) && logic->Hookshot;}}),
                 }, {
                   //Exits
-                  Entrance(SHADOW_TEMPLE_WIND_TUNNEL, {[]{return ((LogicLensShadowPlatform && LogicLensShadow) || CanUse(LENS_OF_TRUTH)) && Hookshot && SmallKeys(SHADOW_TEMPLE, 3, 4);}}),
+                  Entrance(SHADOW_TEMPLE_WIND_TUNNEL, {[]{return ((settings->LogicLensShadowPlatform && settings->LogicLensShadow) || logic->CanUse(LENS_OF_TRUTH)) && logic->Hookshot && logic->SmallKeys(SHADOW_TEMPLE, 3, 4);}}),
   });
 
-  areaTable[SHADOW_TEMPLE_WIND_TUNNEL] = Area("Shadow Temple Wind Tunnel", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SHADOW_TEMPLE_WIND_TUNNEL] = Area("Shadow Temple Wind Tunnel", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(SHADOW_TEMPLE_WIND_HINT_CHEST,         {[]{return true;}}),
-                  LocationAccess(SHADOW_TEMPLE_AFTER_WIND_ENEMY_CHEST,  {[]{return CanJumpslash;}}),
+                  LocationAccess(SHADOW_TEMPLE_AFTER_WIND_ENEMY_CHEST,  {[]{return logic->CanJumpslash;}}),
                   LocationAccess(SHADOW_TEMPLE_AFTER_WIND_HIDDEN_CHEST, {[]{return true;}}),
-                  LocationAccess(SHADOW_TEMPLE_GS_NEAR_SHIP,            {[]{return CanUse(LONGSHOT) && SmallKeys(SHADOW_TEMPLE, 4, 5);}}),
+                  LocationAccess(SHADOW_TEMPLE_GS_NEAR_SHIP,            {[]{return logic->CanUse(LONGSHOT) && logic->SmallKeys(SHADOW_TEMPLE, 4, 5);}}),
                 }, {
                   //Exits
-                  Entrance(SHADOW_TEMPLE_BEYOND_BOAT, {[]{return CanJumpslash && CanPlay(ZeldasLullaby) && SmallKeys(SHADOW_TEMPLE, 4, 5);}}),
+                  Entrance(SHADOW_TEMPLE_BEYOND_BOAT, {[]{return logic->CanJumpslash && logic->CanPlay(logic->ZeldasLullaby) && logic->SmallKeys(SHADOW_TEMPLE, 4, 5);}}),
   });
 
-  areaTable[SHADOW_TEMPLE_BEYOND_BOAT] = Area("Shadow Temple Beyond Boat", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SHADOW_TEMPLE_BEYOND_BOAT] = Area("Shadow Temple Beyond Boat", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SHADOW_TEMPLE_SPIKE_WALLS_LEFT_CHEST,      {[]{return CanUse(DINS_FIRE);}}),
-                  LocationAccess(SHADOW_TEMPLE_BOSS_KEY_CHEST,              {[]{return CanUse(DINS_FIRE);}}),
-                  LocationAccess(SHADOW_TEMPLE_INVISIBLE_FLOORMASTER_CHEST, {[]{return CanJumpslash;}}),
-                  LocationAccess(SHADOW_TEMPLE_GS_TRIPLE_GIANT_POT,         {[]{return CanAdultAttack;}}),
+                  LocationAccess(SHADOW_TEMPLE_SPIKE_WALLS_LEFT_CHEST,      {[]{return logic->CanUse(DINS_FIRE);}}),
+                  LocationAccess(SHADOW_TEMPLE_BOSS_KEY_CHEST,              {[]{return logic->CanUse(DINS_FIRE);}}),
+                  LocationAccess(SHADOW_TEMPLE_INVISIBLE_FLOORMASTER_CHEST, {[]{return logic->CanJumpslash;}}),
+                  LocationAccess(SHADOW_TEMPLE_GS_TRIPLE_GIANT_POT,         {[]{return logic->CanAdultAttack;}}),
   }, {
                   //Exits
-                  Entrance(SHADOW_TEMPLE_BOSS_ENTRYWAY, {[]{return (CanUse(BOW) || CanUse(DISTANT_SCARECROW) || (LogicShadowStatue && HasBombchus)) && SmallKeys(SHADOW_TEMPLE, 5) && CanUse(HOVER_BOOTS) && BossKeyShadowTemple;}})
+                  Entrance(SHADOW_TEMPLE_BOSS_ENTRYWAY, {[]{return (logic->CanUse(BOW) || logic->CanUse(DISTANT_SCARECROW) || (settings->LogicShadowStatue && logic->HasBombchus)) && logic->SmallKeys(SHADOW_TEMPLE, 5) && logic->CanUse(HOVER_BOOTS) && logic->BossKeyShadowTemple;}})
   });
   }
 
   /*---------------------------
   |   MASTER QUEST DUNGEON    |
   ---------------------------*/
-  if (Dungeon::ShadowTemple.IsMQ()) {
-  areaTable[SHADOW_TEMPLE_MQ_BEGINNING] = Area("Shadow Temple MQ Beginning", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  if (world->dungeons.ShadowTemple.IsMQ()) {
+  world->areaTable[SHADOW_TEMPLE_MQ_BEGINNING] = Area("Shadow Temple MQ Beginning", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(SHADOW_TEMPLE_ENTRYWAY,          {[]{return true;}}),
-                  Entrance(SHADOW_TEMPLE_MQ_FIRST_BEAMOS,   {[]{return IsAdult && (CanUse(FIRE_ARROWS) || HoverBoots || (LogicShadowMQGap && CanUse(LONGSHOT)));}}),
+                  Entrance(SHADOW_TEMPLE_MQ_FIRST_BEAMOS,   {[]{return logic->IsAdult && (logic->CanUse(FIRE_ARROWS) || logic->HoverBoots || (settings->LogicShadowMQGap && logic->CanUse(LONGSHOT)));}}),
                     //Trick: IsAdult && (CanUse(FIRE_ARROWS) || HoverBoots || (LogicShadowMQGap && CanUse(LONGSHOT)))
-                  Entrance(SHADOW_TEMPLE_MQ_DEAD_HAND_AREA, {[]{return HasExplosives && SmallKeys(SHADOW_TEMPLE, 6);}}),
+                  Entrance(SHADOW_TEMPLE_MQ_DEAD_HAND_AREA, {[]{return logic->HasExplosives && logic->SmallKeys(SHADOW_TEMPLE, 6);}}),
   });
 
-  areaTable[SHADOW_TEMPLE_MQ_DEAD_HAND_AREA] = Area("Shadow Temple MQ Dead Hand Area", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SHADOW_TEMPLE_MQ_DEAD_HAND_AREA] = Area("Shadow Temple MQ Dead Hand Area", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SHADOW_TEMPLE_MQ_COMPASS_CHEST,     {[]{return CanJumpslash;}}),
-                  LocationAccess(SHADOW_TEMPLE_MQ_HOVER_BOOTS_CHEST, {[]{return CanJumpslash && CanPlay(SongOfTime) && IsAdult && CanUse(BOW);}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_COMPASS_CHEST,     {[]{return logic->CanJumpslash;}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_HOVER_BOOTS_CHEST, {[]{return logic->CanJumpslash && logic->CanPlay(logic->SongOfTime) && logic->IsAdult && logic->CanUse(BOW);}}),
   }, {});
 
-  areaTable[SHADOW_TEMPLE_MQ_FIRST_BEAMOS] = Area("Shadow Temple MQ First Beamos", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SHADOW_TEMPLE_MQ_FIRST_BEAMOS] = Area("Shadow Temple MQ First Beamos", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SHADOW_TEMPLE_MQ_MAP_CHEST,                 {[]{return CanAdultAttack || Nuts;}}),
-                  LocationAccess(SHADOW_TEMPLE_MQ_EARLY_GIBDOS_CHEST,        {[]{return CanJumpslash;}}),
-                  LocationAccess(SHADOW_TEMPLE_MQ_NEAR_SHIP_INVISIBLE_CHEST, {[]{return CanAdultAttack || Nuts;}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_MAP_CHEST,                 {[]{return logic->CanAdultAttack || logic->Nuts;}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_EARLY_GIBDOS_CHEST,        {[]{return logic->CanJumpslash;}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_NEAR_SHIP_INVISIBLE_CHEST, {[]{return logic->CanAdultAttack || logic->Nuts;}}),
   }, {
                   //Exits
-                  Entrance(SHADOW_TEMPLE_MQ_UPPER_HUGE_PIT, {[]{return HasExplosives && SmallKeys(SHADOW_TEMPLE, 2);}}),
+                  Entrance(SHADOW_TEMPLE_MQ_UPPER_HUGE_PIT, {[]{return logic->HasExplosives && logic->SmallKeys(SHADOW_TEMPLE, 2);}}),
   });
 
-  areaTable[SHADOW_TEMPLE_MQ_UPPER_HUGE_PIT] = Area("Shadow Temple MQ Upper Huge Pit", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SHADOW_TEMPLE_MQ_UPPER_HUGE_PIT] = Area("Shadow Temple MQ Upper Huge Pit", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SHADOW_TEMPLE_MQ_INVISIBLE_BLADES_VISIBLE_CHEST,   {[]{return CanPlay(SongOfTime) || (LogicShadowMQInvisibleBlades && DamageMultiplier.IsNot(DAMAGEMULTIPLIER_OHKO));}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_INVISIBLE_BLADES_VISIBLE_CHEST,   {[]{return logic->CanPlay(logic->SongOfTime) || (settings->LogicShadowMQInvisibleBlades && settings->DamageMultiplier.IsNot(DAMAGEMULTIPLIER_OHKO));}}),
                     //Trick: CanPlay(SongOfTime) || (LogicShadowMQInvisibleBlades && DamageMultiplier.IsNot(DAMAGEMULTIPLIER_OHKO))
-                  LocationAccess(SHADOW_TEMPLE_MQ_INVISIBLE_BLADES_INVISIBLE_CHEST, {[]{return CanPlay(SongOfTime) || (LogicShadowMQInvisibleBlades && DamageMultiplier.IsNot(DAMAGEMULTIPLIER_OHKO));}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_INVISIBLE_BLADES_INVISIBLE_CHEST, {[]{return logic->CanPlay(logic->SongOfTime) || (settings->LogicShadowMQInvisibleBlades && settings->DamageMultiplier.IsNot(DAMAGEMULTIPLIER_OHKO));}}),
                     //Trick: CanPlay(SongOfTime) || (LogicShadowMQInvisibleBlades && DamageMultiplier.IsNot(DAMAGEMULTIPLIER_OHKO))
   }, {
                   //Exits
-                  Entrance(SHADOW_TEMPLE_MQ_LOWER_HUGE_PIT, {[]{return HasFireSource || LogicShadowMQHugePit;}}),
+                  Entrance(SHADOW_TEMPLE_MQ_LOWER_HUGE_PIT, {[]{return logic->HasFireSource || settings->LogicShadowMQHugePit;}}),
                     //Trick: HasFireSource || LogicShadowMQHugePit
   });
 
-  areaTable[SHADOW_TEMPLE_MQ_LOWER_HUGE_PIT] = Area("Shadow Temple MQ Lower Huge Pit", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SHADOW_TEMPLE_MQ_LOWER_HUGE_PIT] = Area("Shadow Temple MQ Lower Huge Pit", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SHADOW_TEMPLE_MQ_BEAMOS_SILVER_RUPEES_CHEST,  {[]{return IsAdult && CanUse(LONGSHOT);}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_BEAMOS_SILVER_RUPEES_CHEST,  {[]{return logic->IsAdult && logic->CanUse(LONGSHOT);}}),
                   LocationAccess(SHADOW_TEMPLE_MQ_FALLING_SPIKES_LOWER_CHEST,  {[]{return true;}}),
-                  LocationAccess(SHADOW_TEMPLE_MQ_FALLING_SPIKES_UPPER_CHEST,  {[]{return (LogicShadowUmbrella && HoverBoots) || GoronBracelet;}}),
-                  LocationAccess(SHADOW_TEMPLE_MQ_FALLING_SPIKES_SWITCH_CHEST, {[]{return (LogicShadowUmbrella && HoverBoots) || GoronBracelet;}}),
-                  LocationAccess(SHADOW_TEMPLE_MQ_INVISIBLE_SPIKES_CHEST,      {[]{return CanJumpslash && HoverBoots && SmallKeys(SHADOW_TEMPLE, 3) && ((LogicLensShadowMQ && LogicLensShadowMQPlatform) || CanUse(LENS_OF_TRUTH));}}),
-                  LocationAccess(SHADOW_TEMPLE_MQ_STALFOS_ROOM_CHEST,          {[]{return (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD)) && HoverBoots && SmallKeys(SHADOW_TEMPLE, 3) && Hookshot && ((LogicLensShadowMQ &&
-                   LogicLensShadowMQInvisibleBlades && LogicLensShadowMQPlatform) || CanUse(LENS_OF_TRUTH));}}),
-                  LocationAccess(SHADOW_TEMPLE_MQ_GS_FALLING_SPIKES_ROOM,      {[]{return Hookshot || (LogicShadowUmbrellaGS && HoverBoots);}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_FALLING_SPIKES_UPPER_CHEST,  {[]{return (settings->LogicShadowUmbrella && logic->HoverBoots) || logic->GoronBracelet;}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_FALLING_SPIKES_SWITCH_CHEST, {[]{return (settings->LogicShadowUmbrella && logic->HoverBoots) || logic->GoronBracelet;}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_INVISIBLE_SPIKES_CHEST,      {[]{return logic->CanJumpslash && logic->HoverBoots && logic->SmallKeys(SHADOW_TEMPLE, 3) && ((settings->LogicLensShadowMQ && settings->LogicLensShadowMQPlatform) || logic->CanUse(LENS_OF_TRUTH));}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_STALFOS_ROOM_CHEST,          {[]{return (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD)) && logic->HoverBoots && logic->SmallKeys(SHADOW_TEMPLE, 3) && logic->Hookshot && ((settings->LogicLensShadowMQ &&
+                   settings->LogicLensShadowMQInvisibleBlades && settings->LogicLensShadowMQPlatform) || logic->CanUse(LENS_OF_TRUTH));}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_GS_FALLING_SPIKES_ROOM,      {[]{return logic->Hookshot || (settings->LogicShadowUmbrellaGS && logic->HoverBoots);}}),
   }, {
                   //Exits
-                  Entrance(SHADOW_TEMPLE_MQ_WIND_TUNNEL, {[]{return HoverBoots && ((LogicLensShadowMQ && LogicLensShadowMQPlatform) || CanUse(LENS_OF_TRUTH)) && Hookshot && SmallKeys(SHADOW_TEMPLE, 4);}}),
+                  Entrance(SHADOW_TEMPLE_MQ_WIND_TUNNEL, {[]{return logic->HoverBoots && ((settings->LogicLensShadowMQ && settings->LogicLensShadowMQPlatform) || logic->CanUse(LENS_OF_TRUTH)) && logic->Hookshot && logic->SmallKeys(SHADOW_TEMPLE, 4);}}),
   });
 
-  areaTable[SHADOW_TEMPLE_MQ_WIND_TUNNEL] = Area("Shadow Temple MQ Wind Tunnel", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[SHADOW_TEMPLE_MQ_WIND_TUNNEL] = Area("Shadow Temple MQ Wind Tunnel", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&NutPot, {[]{return true;}}),
+                  EventAccess(&Logic::Vars::NutPot, {[]{return true;}}),
   }, {
                   //Locations
                   LocationAccess(SHADOW_TEMPLE_MQ_WIND_HINT_CHEST,         {[]{return true;}}),
-                  LocationAccess(SHADOW_TEMPLE_MQ_AFTER_WIND_ENEMY_CHEST,  {[]{return CanJumpslash;}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_AFTER_WIND_ENEMY_CHEST,  {[]{return logic->CanJumpslash;}}),
                   LocationAccess(SHADOW_TEMPLE_MQ_AFTER_WIND_HIDDEN_CHEST, {[]{return true;}}),
                   LocationAccess(SHADOW_TEMPLE_MQ_GS_WIND_HINT_ROOM,       {[]{return true;}}),
                   LocationAccess(SHADOW_TEMPLE_MQ_GS_AFTER_WIND,           {[]{return true;}}),
   }, {
                   //Exits
-                  Entrance(SHADOW_TEMPLE_MQ_BEYOND_BOAT, {[]{return CanPlay(ZeldasLullaby) && SmallKeys(SHADOW_TEMPLE, 5);}}),
+                  Entrance(SHADOW_TEMPLE_MQ_BEYOND_BOAT, {[]{return logic->CanPlay(logic->ZeldasLullaby) && logic->SmallKeys(SHADOW_TEMPLE, 5);}}),
   });
 
-  areaTable[SHADOW_TEMPLE_MQ_BEYOND_BOAT] = Area("Shadow Temple MQ Beyond Boat", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SHADOW_TEMPLE_MQ_BEYOND_BOAT] = Area("Shadow Temple MQ Beyond Boat", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(SHADOW_TEMPLE_MQ_GS_AFTER_SHIP,  {[]{return true;}}),
-                  LocationAccess(SHADOW_TEMPLE_MQ_GS_NEAR_BOSS,   {[]{return Bow || (LogicShadowStatue && HasBombchus);}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_GS_NEAR_BOSS,   {[]{return logic->Bow || (settings->LogicShadowStatue && logic->HasBombchus);}}),
   }, {
                   //Exits
-                  Entrance(SHADOW_TEMPLE_MQ_INVISIBLE_MAZE, {[]{return Bow && CanPlay(SongOfTime) && IsAdult && CanUse(LONGSHOT);}}),
-                  Entrance(SHADOW_TEMPLE_BOSS_ENTRYWAY,     {[]{return (CanUse(BOW) || (LogicShadowStatue && HasBombchus)) && CanUse(HOVER_BOOTS) && BossKeyShadowTemple;}}),
+                  Entrance(SHADOW_TEMPLE_MQ_INVISIBLE_MAZE, {[]{return logic->Bow && logic->CanPlay(logic->SongOfTime) && logic->IsAdult && logic->CanUse(LONGSHOT);}}),
+                  Entrance(SHADOW_TEMPLE_BOSS_ENTRYWAY,     {[]{return (logic->CanUse(BOW) || (settings->LogicShadowStatue && logic->HasBombchus)) && logic->CanUse(HOVER_BOOTS) && logic->BossKeyShadowTemple;}}),
   });
 
-  areaTable[SHADOW_TEMPLE_MQ_INVISIBLE_MAZE] = Area("Shadow Temple MQ Invisible Maze", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SHADOW_TEMPLE_MQ_INVISIBLE_MAZE] = Area("Shadow Temple MQ Invisible Maze", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SHADOW_TEMPLE_MQ_SPIKE_WALLS_LEFT_CHEST, {[]{return CanUse(DINS_FIRE) && SmallKeys(SHADOW_TEMPLE, 6);}}),
-                  LocationAccess(SHADOW_TEMPLE_MQ_BOSS_KEY_CHEST,         {[]{return CanUse(DINS_FIRE) && SmallKeys(SHADOW_TEMPLE, 6);}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_SPIKE_WALLS_LEFT_CHEST, {[]{return logic->CanUse(DINS_FIRE) && logic->SmallKeys(SHADOW_TEMPLE, 6);}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_BOSS_KEY_CHEST,         {[]{return logic->CanUse(DINS_FIRE) && logic->SmallKeys(SHADOW_TEMPLE, 6);}}),
                   //below previously returned true
-                  LocationAccess(SHADOW_TEMPLE_MQ_BOMB_FLOWER_CHEST,      {[]{return CanUse(LENS_OF_TRUTH) || LogicLensShadowMQDeadHand;}}),
+                  LocationAccess(SHADOW_TEMPLE_MQ_BOMB_FLOWER_CHEST,      {[]{return logic->CanUse(LENS_OF_TRUTH) || settings->LogicLensShadowMQDeadHand;}}),
                   LocationAccess(SHADOW_TEMPLE_MQ_FREESTANDING_KEY,       {[]{return true;}}),
   }, {});
   }
@@ -181,34 +182,34 @@ void AreaTable_Init_ShadowTemple() {
     /*---------------------------
     |         BOSS ROOM         |
     ---------------------------*/
-    areaTable[SHADOW_TEMPLE_BOSS_ENTRYWAY] =
+    world->areaTable[SHADOW_TEMPLE_BOSS_ENTRYWAY] =
         Area("Shadow Temple Boss Entryway", "Shadow Temple", SHADOW_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {},
              {
                  // Exits
-                 Entrance(SHADOW_TEMPLE_BEYOND_BOAT, { [] { return Dungeon::ShadowTemple.IsVanilla() && false; } }),
-                 Entrance(SHADOW_TEMPLE_MQ_BEYOND_BOAT, { [] { return Dungeon::ShadowTemple.IsMQ() && false; } }),
+                 Entrance(SHADOW_TEMPLE_BEYOND_BOAT, { [] { return world->dungeons.ShadowTemple.IsVanilla() && false; } }),
+                 Entrance(SHADOW_TEMPLE_MQ_BEYOND_BOAT, { [] { return world->dungeons.ShadowTemple.IsMQ() && false; } }),
                  Entrance(SHADOW_TEMPLE_BOSS_ROOM, { [] { return true; } }),
              });
 
-    areaTable[SHADOW_TEMPLE_BOSS_ROOM] =
+    world->areaTable[SHADOW_TEMPLE_BOSS_ROOM] =
         Area("Shadow Temple Boss Room", "Shadow Temple", NONE, NO_DAY_NIGHT_CYCLE,
              {
                  // Events
-                 EventAccess(&ShadowTempleClear, { [] {
-                     return ShadowTempleClear ||
-                            ((CanUse(LENS_OF_TRUTH) || LogicLensBongo) &&
-                             (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD)) &&
-                             (CanUse(HOOKSHOT) || CanUse(BOW) || CanUse(SLINGSHOT) || LogicShadowBongo));
+                 EventAccess(&Logic::Vars::ShadowTempleClear, { [] {
+                     return logic->ShadowTempleClear ||
+                            ((logic->CanUse(LENS_OF_TRUTH) || settings->LogicLensBongo) &&
+                             (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD)) &&
+                             (logic->CanUse(HOOKSHOT) || logic->CanUse(BOW) || logic->CanUse(SLINGSHOT) || settings->LogicShadowBongo));
                  } }),
              },
              {
                  // Locations
-                 LocationAccess(SHADOW_TEMPLE_BONGO_BONGO_HEART, { [] { return ShadowTempleClear; } }),
-                 LocationAccess(BONGO_BONGO, { [] { return ShadowTempleClear; } }),
+                 LocationAccess(SHADOW_TEMPLE_BONGO_BONGO_HEART, { [] { return logic->ShadowTempleClear; } }),
+                 LocationAccess(BONGO_BONGO, { [] { return logic->ShadowTempleClear; } }),
              },
              {
                  // Exits
                  Entrance(SHADOW_TEMPLE_BOSS_ENTRYWAY, { [] { return false; } }),
-                 Entrance(GRAVEYARD_WARP_PAD_REGION, { [] { return ShadowTempleClear; } }),
+                 Entrance(GRAVEYARD_WARP_PAD_REGION, { [] { return logic->ShadowTempleClear; } }),
              });
 }
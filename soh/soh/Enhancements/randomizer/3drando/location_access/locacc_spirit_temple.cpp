@@ -2,6 +2,7 @@
 #include "../logic.hpp"
 #include "../entrance.hpp"
 #include "../dungeon.hpp"
+#include "../world.hpp"
 
 using namespace Logic;
 using namespace Settings;
@@ -10,233 +11,233 @@ void AreaTable_Init_SpiritTemple() {
   /*--------------------------
   |    VANILLA/MQ DECIDER    |
   ---------------------------*/
-  areaTable[SPIRIT_TEMPLE_ENTRYWAY] = Area("Spirit Temple Entryway", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  world->areaTable[SPIRIT_TEMPLE_ENTRYWAY] = Area("Spirit Temple Entryway", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
-                  Entrance(SPIRIT_TEMPLE_LOBBY,                  {[]{return Dungeon::SpiritTemple.IsVanilla();}}),
-                  Entrance(SPIRIT_TEMPLE_MQ_LOBBY,               {[]{return Dungeon::SpiritTemple.IsMQ();}}),
+                  Entrance(SPIRIT_TEMPLE_LOBBY,                  {[]{return world->dungeons.SpiritTemple.IsVanilla();}}),
+                  Entrance(SPIRIT_TEMPLE_MQ_LOBBY,               {[]{return world->dungeons.SpiritTemple.IsMQ();}}),
                   Entrance(DESERT_COLOSSUS_FROM_SPIRIT_ENTRYWAY, {[]{return true;}}),
   });
 
   /*--------------------------
   |     VANILLA DUNGEON      |
   ---------------------------*/
-  if (Dungeon::SpiritTemple.IsVanilla()) {
-  areaTable[SPIRIT_TEMPLE_LOBBY] = Area("Spirit Temple Lobby", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
+  if (world->dungeons.SpiritTemple.IsVanilla()) {
+  world->areaTable[SPIRIT_TEMPLE_LOBBY] = Area("Spirit Temple Lobby", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {}, {
                   //Exits
                   Entrance(SPIRIT_TEMPLE_ENTRYWAY,    {[]{return true;}}),
-                  Entrance(SPIRIT_TEMPLE_CHILD,       {[]{return IsChild;}}),
-                  Entrance(SPIRIT_TEMPLE_EARLY_ADULT, {[]{return CanUse(SILVER_GAUNTLETS);}}),
+                  Entrance(SPIRIT_TEMPLE_CHILD,       {[]{return logic->IsChild;}}),
+                  Entrance(SPIRIT_TEMPLE_EARLY_ADULT, {[]{return logic->CanUse(SILVER_GAUNTLETS);}}),
   });
 
-  areaTable[SPIRIT_TEMPLE_CHILD] = Area("Child Spirit Temple", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[SPIRIT_TEMPLE_CHILD] = Area("Child Spirit Temple", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&NutCrate, {[]{return true;}}),
+                  EventAccess(&Logic::Vars::NutCrate, {[]{return true;}}),
                 }, {
                   //Locations
-                  LocationAccess(SPIRIT_TEMPLE_CHILD_BRIDGE_CHEST,        {[]{return (Boomerang || Slingshot || (HasBombchus && LogicSpiritChildBombchu)) && (HasExplosives || ((Nuts || Boomerang) && (Sticks || KokiriSword || Slingshot)));}}),
-                  LocationAccess(SPIRIT_TEMPLE_CHILD_EARLY_TORCHES_CHEST, {[]{return (Boomerang || Slingshot || (HasBombchus && LogicSpiritChildBombchu)) && (HasExplosives || ((Nuts || Boomerang) && (Sticks || KokiriSword || Slingshot))) && (Sticks || CanUse(DINS_FIRE));}}),
-                  LocationAccess(SPIRIT_TEMPLE_GS_METAL_FENCE,            {[]{return (Boomerang || Slingshot || (HasBombchus && LogicSpiritChildBombchu)) && (HasExplosives || ((Nuts || Boomerang) && (Sticks || KokiriSword || Slingshot)));}}),
+                  LocationAccess(SPIRIT_TEMPLE_CHILD_BRIDGE_CHEST,        {[]{return (logic->Boomerang || logic->Slingshot || (logic->HasBombchus && settings->LogicSpiritChildBombchu)) && (logic->HasExplosives || ((logic->Nuts || logic->Boomerang) && (logic->Sticks || logic->KokiriSword || logic->Slingshot)));}}),
+                  LocationAccess(SPIRIT_TEMPLE_CHILD_EARLY_TORCHES_CHEST, {[]{return (logic->Boomerang || logic->Slingshot || (logic->HasBombchus && settings->LogicSpiritChildBombchu)) && (logic->HasExplosives || ((logic->Nuts || logic->Boomerang) && (logic->Sticks || logic->KokiriSword || logic->Slingshot))) && (logic->Sticks || logic->CanUse(DINS_FIRE));}}),
+                  LocationAccess(SPIRIT_TEMPLE_GS_METAL_FENCE,            {[]{return (logic->Boomerang || logic->Slingshot || (logic->HasBombchus && settings->LogicSpiritChildBombchu)) && (logic->HasExplosives || ((logic->Nuts || logic->Boomerang) && (logic->Sticks || logic->KokiriSword || logic->Slingshot)));}}),
                 }, {
                   //Exits
-                  Entrance(SPIRIT_TEMPLE_CHILD_CLIMB, {[]{return SmallKeys(SPIRIT_TEMPLE, 1);}}),
+                  Entrance(SPIRIT_TEMPLE_CHILD_CLIMB, {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 1);}}),
   });
 
-  areaTable[SPIRIT_TEMPLE_CHILD_CLIMB] = Area("Child Spirit Temple Climb", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SPIRIT_TEMPLE_CHILD_CLIMB] = Area("Child Spirit Temple Climb", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SPIRIT_TEMPLE_CHILD_CLIMB_NORTH_CHEST, {[]{return HasProjectile(HasProjectileAge::Both) || ((SmallKeys(SPIRIT_TEMPLE, 3) || (SmallKeys(SPIRIT_TEMPLE, 2) && BombchusInLogic && ShuffleDungeonEntrances.Is(SHUFFLEDUNGEONS_OFF))) && CanUse(SILVER_GAUNTLETS) && HasProjectile(HasProjectileAge::Adult)) || (SmallKeys(SPIRIT_TEMPLE, 5) && IsChild && HasProjectile(HasProjectileAge::Child));}}),
-                  LocationAccess(SPIRIT_TEMPLE_CHILD_CLIMB_EAST_CHEST,  {[]{return HasProjectile(HasProjectileAge::Both) || ((SmallKeys(SPIRIT_TEMPLE, 3) || (SmallKeys(SPIRIT_TEMPLE, 2) && BombchusInLogic && ShuffleDungeonEntrances.Is(SHUFFLEDUNGEONS_OFF))) && CanUse(SILVER_GAUNTLETS) && HasProjectile(HasProjectileAge::Adult)) || (SmallKeys(SPIRIT_TEMPLE, 5) && IsChild && HasProjectile(HasProjectileAge::Child));}}),
-                  LocationAccess(SPIRIT_TEMPLE_GS_SUN_ON_FLOOR_ROOM,    {[]{return HasProjectile(HasProjectileAge::Both) || CanUse(DINS_FIRE) ||
-                                                                                      (CanTakeDamage && (CanJumpslash || HasProjectile(HasProjectileAge::Child))) ||
-                                                                                        (IsChild && SmallKeys(SPIRIT_TEMPLE, 5) && HasProjectile(HasProjectileAge::Child)) ||
-                                                                                          ((SmallKeys(SPIRIT_TEMPLE, 3) || (SmallKeys(SPIRIT_TEMPLE, 2) && BombchusInLogic && ShuffleDungeonEntrances.Is(SHUFFLEDUNGEONS_OFF))) && CanUse(SILVER_GAUNTLETS) && (HasProjectile(HasProjectileAge::Adult) || (CanTakeDamage && CanJumpslash)));}}),
+                  LocationAccess(SPIRIT_TEMPLE_CHILD_CLIMB_NORTH_CHEST, {[]{return logic->HasProjectile(HasProjectileAge::Both) || ((logic->SmallKeys(SPIRIT_TEMPLE, 3) || (logic->SmallKeys(SPIRIT_TEMPLE, 2) && settings->BombchusInLogic && settings->ShuffleDungeonEntrances.Is(SHUFFLEDUNGEONS_OFF))) && logic->CanUse(SILVER_GAUNTLETS) && logic->HasProjectile(HasProjectileAge::Adult)) || (logic->SmallKeys(SPIRIT_TEMPLE, 5) && logic->IsChild && logic->HasProjectile(HasProjectileAge::Child));}}),
+                  LocationAccess(SPIRIT_TEMPLE_CHILD_CLIMB_EAST_CHEST,  {[]{return logic->HasProjectile(HasProjectileAge::Both) || ((logic->SmallKeys(SPIRIT_TEMPLE, 3) || (logic->SmallKeys(SPIRIT_TEMPLE, 2) && settings->BombchusInLogic && settings->ShuffleDungeonEntrances.Is(SHUFFLEDUNGEONS_OFF))) && logic->CanUse(SILVER_GAUNTLETS) && logic->HasProjectile(HasProjectileAge::Adult)) || (logic->SmallKeys(SPIRIT_TEMPLE, 5) && logic->IsChild && logic->HasProjectile(HasProjectileAge::Child));}}),
+                  LocationAccess(SPIRIT_TEMPLE_GS_SUN_ON_FLOOR_ROOM,    {[]{return logic->HasProjectile(HasProjectileAge::Both) || logic->CanUse(DINS_FIRE) ||
+                                                                                      (logic->CanTakeDamage && (logic->CanJumpslash || logic->HasProjectile(HasProjectileAge::Child))) ||
+                                                                                        (logic->IsChild && logic->SmallKeys(SPIRIT_TEMPLE, 5) && logic->HasProjectile(HasProjectileAge::Child)) ||
+                                                                                          ((logic->SmallKeys(SPIRIT_TEMPLE, 3) || (logic->SmallKeys(SPIRIT_TEMPLE, 2) && settings->BombchusInLogic && settings->ShuffleDungeonEntrances.Is(SHUFFLEDUNGEONS_OFF))) && logic->CanUse(SILVER_GAUNTLETS) && (logic->HasProjectile(HasProjectileAge::Adult) || (logic->CanTakeDamage && logic->CanJumpslash)));}}),
                 }, {
                   //Exits
-                  Entrance(SPIRIT_TEMPLE_CENTRAL_CHAMBER, {[]{return HasExplosives || (SunlightArrows && CanUse(LIGHT_ARROWS));}}),
+                  Entrance(SPIRIT_TEMPLE_CENTRAL_CHAMBER, {[]{return logic->HasExplosives || (settings->SunlightArrows && logic->CanUse(LIGHT_ARROWS));}}),
   });
 
-  areaTable[SPIRIT_TEMPLE_EARLY_ADULT] = Area("Early Adult Spirit Temple", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SPIRIT_TEMPLE_EARLY_ADULT] = Area("Early Adult Spirit Temple", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SPIRIT_TEMPLE_COMPASS_CHEST,            {[]{return CanUse(HOOKSHOT) && CanPlay(ZeldasLullaby);}}),
-                  LocationAccess(SPIRIT_TEMPLE_EARLY_ADULT_RIGHT_CHEST,  {[]{return (CanUse(BOW) || CanUse(HOOKSHOT) || CanUse(SLINGSHOT) || CanUse(BOOMERANG) || HasBombchus || (Bombs && IsAdult && LogicSpiritLowerAdultSwitch)) && (CanUse(HOVER_BOOTS) || CanJumpslash);}}),
-                  LocationAccess(SPIRIT_TEMPLE_FIRST_MIRROR_LEFT_CHEST,  {[]{return SmallKeys(SPIRIT_TEMPLE, 3);}}),
-                  LocationAccess(SPIRIT_TEMPLE_FIRST_MIRROR_RIGHT_CHEST, {[]{return SmallKeys(SPIRIT_TEMPLE, 3);}}),
-                  LocationAccess(SPIRIT_TEMPLE_GS_BOULDER_ROOM,          {[]{return CanPlay(SongOfTime) && (Bow || Hookshot || HasBombchus || (Bombs && LogicSpiritLowerAdultSwitch));}}),
+                  LocationAccess(SPIRIT_TEMPLE_COMPASS_CHEST,            {[]{return logic->CanUse(HOOKSHOT) && logic->CanPlay(logic->ZeldasLullaby);}}),
+                  LocationAccess(SPIRIT_TEMPLE_EARLY_ADULT_RIGHT_CHEST,  {[]{return (logic->CanUse(BOW) || logic->CanUse(HOOKSHOT) || logic->CanUse(SLINGSHOT) || logic->CanUse(BOOMERANG) || logic->HasBombchus || (logic->Bombs && logic->IsAdult && settings->LogicSpiritLowerAdultSwitch)) && (logic->CanUse(HOVER_BOOTS) || logic->CanJumpslash);}}),
+                  LocationAccess(SPIRIT_TEMPLE_FIRST_MIRROR_LEFT_CHEST,  {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 3);}}),
+                  LocationAccess(SPIRIT_TEMPLE_FIRST_MIRROR_RIGHT_CHEST, {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 3);}}),
+                  LocationAccess(SPIRIT_TEMPLE_GS_BOULDER_ROOM,          {[]{return logic->CanPlay(logic->SongOfTime) && (logic->Bow || logic->Hookshot || logic->HasBombchus || (logic->Bombs && settings->LogicSpiritLowerAdultSwitch));}}),
                 }, {
                   //Exits
-                  Entrance(SPIRIT_TEMPLE_CENTRAL_CHAMBER, {[]{return SmallKeys(SPIRIT_TEMPLE, 1);}}),
+                  Entrance(SPIRIT_TEMPLE_CENTRAL_CHAMBER, {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 1);}}),
   });
 
-  areaTable[SPIRIT_TEMPLE_CENTRAL_CHAMBER] = Area("Spirit Temple Central Chamber", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SPIRIT_TEMPLE_CENTRAL_CHAMBER] = Area("Spirit Temple Central Chamber", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SPIRIT_TEMPLE_MAP_CHEST,                    {[]{return ((HasExplosives || SmallKeys(SPIRIT_TEMPLE, 3) || (SmallKeys(SPIRIT_TEMPLE, 2) && BombchusInLogic && ShuffleDungeonEntrances.Is(SHUFFLEDUNGEONS_OFF))) &&
+                  LocationAccess(SPIRIT_TEMPLE_MAP_CHEST,                    {[]{return ((logic->HasExplosives || logic->SmallKeys(SPIRIT_TEMPLE, 3) || (logic->SmallKeys(SPIRIT_TEMPLE, 2) && settings->BombchusInLogic && settings->ShuffleDungeonEntrances.Is(SHUFFLEDUNGEONS_OFF))) &&
 
-                                                                                                (CanUse(DINS_FIRE) ||
-                                                                                                    (((MagicMeter && FireArrows) || LogicSpiritMapChest) && Bow && Sticks))) ||
-                                                                                            (SmallKeys(SPIRIT_TEMPLE, 5) && HasExplosives &&
-                                                                                                CanUse(STICKS)) ||
-                                                                                            (SmallKeys(SPIRIT_TEMPLE, 3) &&
-                                                                                                (CanUse(FIRE_ARROWS) || (LogicSpiritMapChest && Bow)) &&
-                                                                                                CanUse(SILVER_GAUNTLETS));}}),
-                  LocationAccess(SPIRIT_TEMPLE_SUN_BLOCK_ROOM_CHEST,         {[]{return ((HasExplosives || SmallKeys(SPIRIT_TEMPLE, 3) || (SmallKeys(SPIRIT_TEMPLE, 2) && BombchusInLogic && ShuffleDungeonEntrances.Is(SHUFFLEDUNGEONS_OFF))) &&
-                                                                                                (CanUse(DINS_FIRE) ||
-                                                                                                    (((MagicMeter && FireArrows) || LogicSpiritSunChest) && Bow && Sticks))) ||
-                                                                                            (SmallKeys(SPIRIT_TEMPLE, 5) && HasExplosives &&
-                                                                                                CanUse(STICKS)) ||
-                                                                                            (SmallKeys(SPIRIT_TEMPLE, 3) &&
-                                                                                                (CanUse(FIRE_ARROWS) || (LogicSpiritSunChest && Bow)) &&
-                                                                                                CanUse(SILVER_GAUNTLETS));}}),
-                  LocationAccess(SPIRIT_TEMPLE_STATUE_ROOM_HAND_CHEST,       {[]{return SmallKeys(SPIRIT_TEMPLE, 3) && CanUse(SILVER_GAUNTLETS) && CanPlay(ZeldasLullaby);}}),
-                  LocationAccess(SPIRIT_TEMPLE_STATUE_ROOM_NORTHEAST_CHEST,  {[]{return SmallKeys(SPIRIT_TEMPLE, 3) && CanUse(SILVER_GAUNTLETS) && CanPlay(ZeldasLullaby) && (Hookshot || HoverBoots || LogicSpiritLobbyJump);}}),
-                  LocationAccess(SPIRIT_TEMPLE_GS_HALL_AFTER_SUN_BLOCK_ROOM, {[]{return (HasExplosives && Boomerang && Hookshot) ||
-                                                                                            (CanUse(BOOMERANG) && SmallKeys(SPIRIT_TEMPLE, 5) && HasExplosives) ||
-                                                                                            (Hookshot && CanUse(SILVER_GAUNTLETS) &&
-                                                                                                (SmallKeys(SPIRIT_TEMPLE, 3) ||
-                                                                                                    (SmallKeys(SPIRIT_TEMPLE, 2) && Boomerang && BombchusInLogic && ShuffleDungeonEntrances.Is(SHUFFLEDUNGEONS_OFF))));}}),
-                  LocationAccess(SPIRIT_TEMPLE_GS_LOBBY,                     {[]{return ((HasExplosives || SmallKeys(SPIRIT_TEMPLE, 3) || (SmallKeys(SPIRIT_TEMPLE, 2) && BombchusInLogic && ShuffleDungeonEntrances.Is(SHUFFLEDUNGEONS_OFF))) &&
-                                                                                                LogicSpiritLobbyGS && Boomerang && (Hookshot || HoverBoots || LogicSpiritLobbyJump)) ||
-                                                                                            (LogicSpiritLobbyGS && SmallKeys(SPIRIT_TEMPLE, 5) && HasExplosives && CanUse(BOOMERANG)) ||
-                                                                                            (SmallKeys(SPIRIT_TEMPLE, 3) && CanUse(SILVER_GAUNTLETS) && (Hookshot || HoverBoots || LogicSpiritLobbyJump));}}),
+                                                                                                (logic->CanUse(DINS_FIRE) ||
+                                                                                                    (((logic->MagicMeter && logic->FireArrows) || settings->LogicSpiritMapChest) && logic->Bow && logic->Sticks))) ||
+                                                                                            (logic->SmallKeys(SPIRIT_TEMPLE, 5) && logic->HasExplosives &&
+                                                                                                logic->CanUse(STICKS)) ||
+                                                                                            (logic->SmallKeys(SPIRIT_TEMPLE, 3) &&
+                                                                                                (logic->CanUse(FIRE_ARROWS) || (settings->LogicSpiritMapChest && logic->Bow)) &&
+                                                                                                logic->CanUse(SILVER_GAUNTLETS));}}),
+                  LocationAccess(SPIRIT_TEMPLE_SUN_BLOCK_ROOM_CHEST,         {[]{return ((logic->HasExplosives || logic->SmallKeys(SPIRIT_TEMPLE, 3) || (logic->SmallKeys(SPIRIT_TEMPLE, 2) && settings->BombchusInLogic && settings->ShuffleDungeonEntrances.Is(SHUFFLEDUNGEONS_OFF))) &&
+                                                                                                (logic->CanUse(DINS_FIRE) ||
+                                                                                                    (((logic->MagicMeter && logic->FireArrows) || settings->LogicSpiritSunChest) && logic->Bow && logic->Sticks))) ||
+                                                                                            (logic->SmallKeys(SPIRIT_TEMPLE, 5) && logic->HasExplosives &&
+                                                                                                logic->CanUse(STICKS)) ||
+                                                                                            (logic->SmallKeys(SPIRIT_TEMPLE, 3) &&
+                                                                                                (logic->CanUse(FIRE_ARROWS) || (settings->LogicSpiritSunChest && logic->Bow)) &&
+                                                                                                logic->CanUse(SILVER_GAUNTLETS));}}),
+                  LocationAccess(SPIRIT_TEMPLE_STATUE_ROOM_HAND_CHEST,       {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 3) && logic->CanUse(SILVER_GAUNTLETS) && logic->CanPlay(logic->ZeldasLullaby);}}),
+                  LocationAccess(SPIRIT_TEMPLE_STATUE_ROOM_NORTHEAST_CHEST,  {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 3) && logic->CanUse(SILVER_GAUNTLETS) && logic->CanPlay(logic->ZeldasLullaby) && (logic->Hookshot || logic->HoverBoots || settings->LogicSpiritLobbyJump);}}),
+                  LocationAccess(SPIRIT_TEMPLE_GS_HALL_AFTER_SUN_BLOCK_ROOM, {[]{return (logic->HasExplosives && logic->Boomerang && logic->Hookshot) ||
+                                                                                            (logic->CanUse(BOOMERANG) && logic->SmallKeys(SPIRIT_TEMPLE, 5) && logic->HasExplosives) ||
+                                                                                            (logic->Hookshot && logic->CanUse(SILVER_GAUNTLETS) &&
+                                                                                                (logic->SmallKeys(SPIRIT_TEMPLE, 3) ||
+                                                                                                    (logic->SmallKeys(SPIRIT_TEMPLE, 2) && logic->Boomerang && settings->BombchusInLogic && settings->ShuffleDungeonEntrances.Is(SHUFFLEDUNGEONS_OFF))));}}),
+                  LocationAccess(SPIRIT_TEMPLE_GS_LOBBY,                     {[]{return ((logic->HasExplosives || logic->SmallKeys(SPIRIT_TEMPLE, 3) || (logic->SmallKeys(SPIRIT_TEMPLE, 2) && settings->BombchusInLogic && settings->ShuffleDungeonEntrances.Is(SHUFFLEDUNGEONS_OFF))) &&
+                                                                                                settings->LogicSpiritLobbyGS && logic->Boomerang && (logic->Hookshot || logic->HoverBoots || settings->LogicSpiritLobbyJump)) ||
+                                                                                            (settings->LogicSpiritLobbyGS && logic->SmallKeys(SPIRIT_TEMPLE, 5) && logic->HasExplosives && logic->CanUse(BOOMERANG)) ||
+                                                                                            (logic->SmallKeys(SPIRIT_TEMPLE, 3) && logic->CanUse(SILVER_GAUNTLETS) && (logic->Hookshot || logic->HoverBoots || settings->LogicSpiritLobbyJump));}}),
                 }, {
                   //Exits
-                  Entrance(SPIRIT_TEMPLE_OUTDOOR_HANDS,              {[]{return CanJumpslash || HasExplosives;}}),
-                  Entrance(SPIRIT_TEMPLE_BEYOND_CENTRAL_LOCKED_DOOR, {[]{return SmallKeys(SPIRIT_TEMPLE, 4) && CanUse(SILVER_GAUNTLETS);}}),
+                  Entrance(SPIRIT_TEMPLE_OUTDOOR_HANDS,              {[]{return logic->CanJumpslash || logic->HasExplosives;}}),
+                  Entrance(SPIRIT_TEMPLE_BEYOND_CENTRAL_LOCKED_DOOR, {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 4) && logic->CanUse(SILVER_GAUNTLETS);}}),
                   Entrance(SPIRIT_TEMPLE_CHILD_CLIMB,                {[]{return true;}}),
   });
 
-  areaTable[SPIRIT_TEMPLE_OUTDOOR_HANDS] = Area("Spirit Temple Outdoor Hands", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SPIRIT_TEMPLE_OUTDOOR_HANDS] = Area("Spirit Temple Outdoor Hands", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SPIRIT_TEMPLE_SILVER_GAUNTLETS_CHEST, {[]{return (SmallKeys(SPIRIT_TEMPLE, 3) && Longshot && HasExplosives) || SmallKeys(SPIRIT_TEMPLE, 5);}}),
-                  LocationAccess(SPIRIT_TEMPLE_MIRROR_SHIELD_CHEST,    {[]{return SmallKeys(SPIRIT_TEMPLE, 4) && CanUse(SILVER_GAUNTLETS) && HasExplosives;}}),
+                  LocationAccess(SPIRIT_TEMPLE_SILVER_GAUNTLETS_CHEST, {[]{return (logic->SmallKeys(SPIRIT_TEMPLE, 3) && logic->Longshot && logic->HasExplosives) || logic->SmallKeys(SPIRIT_TEMPLE, 5);}}),
+                  LocationAccess(SPIRIT_TEMPLE_MIRROR_SHIELD_CHEST,    {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 4) && logic->CanUse(SILVER_GAUNTLETS) && logic->HasExplosives;}}),
                 }, {
                   //Exits
-                  Entrance(DESERT_COLOSSUS, {[]{return (IsChild && SmallKeys(SPIRIT_TEMPLE, 5)) || (CanUse(SILVER_GAUNTLETS) && ((SmallKeys(SPIRIT_TEMPLE, 3) && HasExplosives) || SmallKeys(SPIRIT_TEMPLE, 5)));}}),
+                  Entrance(DESERT_COLOSSUS, {[]{return (logic->IsChild && logic->SmallKeys(SPIRIT_TEMPLE, 5)) || (logic->CanUse(SILVER_GAUNTLETS) && ((logic->SmallKeys(SPIRIT_TEMPLE, 3) && logic->HasExplosives) || logic->SmallKeys(SPIRIT_TEMPLE, 5)));}}),
   });
 
-  areaTable[SPIRIT_TEMPLE_BEYOND_CENTRAL_LOCKED_DOOR] = Area("Spirit Temple Beyond Central Locked Door", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SPIRIT_TEMPLE_BEYOND_CENTRAL_LOCKED_DOOR] = Area("Spirit Temple Beyond Central Locked Door", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SPIRIT_TEMPLE_NEAR_FOUR_ARMOS_CHEST,         {[]{return (MirrorShield || (SunlightArrows && CanUse(LIGHT_ARROWS))) && HasExplosives;}}),
-                  LocationAccess(SPIRIT_TEMPLE_HALLWAY_LEFT_INVISIBLE_CHEST,  {[]{return (LogicLensSpirit || CanUse(LENS_OF_TRUTH)) && HasExplosives;}}),
-                  LocationAccess(SPIRIT_TEMPLE_HALLWAY_RIGHT_INVISIBLE_CHEST, {[]{return (LogicLensSpirit || CanUse(LENS_OF_TRUTH)) && HasExplosives;}}),
+                  LocationAccess(SPIRIT_TEMPLE_NEAR_FOUR_ARMOS_CHEST,         {[]{return (logic->MirrorShield || (settings->SunlightArrows && logic->CanUse(LIGHT_ARROWS))) && logic->HasExplosives;}}),
+                  LocationAccess(SPIRIT_TEMPLE_HALLWAY_LEFT_INVISIBLE_CHEST,  {[]{return (settings->LogicLensSpirit || logic->CanUse(LENS_OF_TRUTH)) && logic->HasExplosives;}}),
+                  LocationAccess(SPIRIT_TEMPLE_HALLWAY_RIGHT_INVISIBLE_CHEST, {[]{return (settings->LogicLensSpirit || logic->CanUse(LENS_OF_TRUTH)) && logic->HasExplosives;}}),
                 }, {
                   //Exits
-                  Entrance(SPIRIT_TEMPLE_BEYOND_FINAL_LOCKED_DOOR, {[]{return SmallKeys(SPIRIT_TEMPLE, 5) && (LogicSpiritWall || CanUse(LONGSHOT) || HasBombchus || ((Bombs || Nuts || CanUse(DINS_FIRE)) && (Bow || CanUse(HOOKSHOT) || Hammer)));}}),
+                  Entrance(SPIRIT_TEMPLE_BEYOND_FINAL_LOCKED_DOOR, {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 5) && (settings->LogicSpiritWall || logic->CanUse(LONGSHOT) || logic->HasBombchus || ((logic->Bombs || logic->Nuts || logic->CanUse(DINS_FIRE)) && (logic->Bow || logic->CanUse(HOOKSHOT) || logic->Hammer)));}}),
   });
 
-  areaTable[SPIRIT_TEMPLE_BEYOND_FINAL_LOCKED_DOOR] = Area("Spirit Temple Beyond Final Locked Door", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SPIRIT_TEMPLE_BEYOND_FINAL_LOCKED_DOOR] = Area("Spirit Temple Beyond Final Locked Door", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SPIRIT_TEMPLE_BOSS_KEY_CHEST, {[]{return CanPlay(ZeldasLullaby) && ((CanTakeDamage && LogicFlamingChests) || (Bow && Hookshot));}}),
-                  LocationAccess(SPIRIT_TEMPLE_TOPMOST_CHEST,  {[]{return (MirrorShield && CanAdultAttack) || (SunlightArrows && CanUse(LIGHT_ARROWS));}}),
+                  LocationAccess(SPIRIT_TEMPLE_BOSS_KEY_CHEST, {[]{return logic->CanPlay(logic->ZeldasLullaby) && ((logic->CanTakeDamage && settings->LogicFlamingChests) || (logic->Bow && logic->Hookshot));}}),
+                  LocationAccess(SPIRIT_TEMPLE_TOPMOST_CHEST,  {[]{return (logic->MirrorShield && logic->CanAdultAttack) || (settings->SunlightArrows && logic->CanUse(LIGHT_ARROWS));}}),
   }, {
                   //Exits
-                  Entrance(SPIRIT_TEMPLE_INSIDE_STATUE_HEAD, {[]{return MirrorShield && HasExplosives && Hookshot;}}),
+                  Entrance(SPIRIT_TEMPLE_INSIDE_STATUE_HEAD, {[]{return logic->MirrorShield && logic->HasExplosives && logic->Hookshot;}}),
   });
 
-  areaTable[SPIRIT_TEMPLE_INSIDE_STATUE_HEAD] =
+  world->areaTable[SPIRIT_TEMPLE_INSIDE_STATUE_HEAD] =
             Area("Spirit Temple Inside Statue Head", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {},
                  {
                      // Exits
                      Entrance(SPIRIT_TEMPLE_CENTRAL_CHAMBER, { [] { return true; } }),
-                     Entrance(SPIRIT_TEMPLE_BOSS_ENTRYWAY, { [] { return BossKeySpiritTemple; } }),
+                     Entrance(SPIRIT_TEMPLE_BOSS_ENTRYWAY, { [] { return logic->BossKeySpiritTemple; } }),
                  });
   }
 
   /*---------------------------
   |   MASTER QUEST DUNGEON    |
   ---------------------------*/
-  if (Dungeon::SpiritTemple.IsMQ()) {
-  areaTable[SPIRIT_TEMPLE_MQ_LOBBY] = Area("Spirit Temple MQ Lobby", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  if (world->dungeons.SpiritTemple.IsMQ()) {
+  world->areaTable[SPIRIT_TEMPLE_MQ_LOBBY] = Area("Spirit Temple MQ Lobby", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(SPIRIT_TEMPLE_MQ_ENTRANCE_FRONT_LEFT_CHEST, {[]{return true;}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_ENTRANCE_BACK_LEFT_CHEST,  {[]{return Here(SPIRIT_TEMPLE_MQ_LOBBY, []{return CanBlastOrSmash;}) && ((IsChild && CanUse(SLINGSHOT)) || (IsAdult && CanUse(BOW)));}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_ENTRANCE_BACK_RIGHT_CHEST, {[]{return HasBombchus || (IsAdult && (CanUse(BOW) || CanUse(HOOKSHOT))) || (IsChild && (CanUse(SLINGSHOT) || CanUse(BOOMERANG)));}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_ENTRANCE_BACK_LEFT_CHEST,  {[]{return Here(SPIRIT_TEMPLE_MQ_LOBBY, []{return logic->CanBlastOrSmash;}) && ((logic->IsChild && logic->CanUse(SLINGSHOT)) || (logic->IsAdult && logic->CanUse(BOW)));}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_ENTRANCE_BACK_RIGHT_CHEST, {[]{return logic->HasBombchus || (logic->IsAdult && (logic->CanUse(BOW) || logic->CanUse(HOOKSHOT))) || (logic->IsChild && (logic->CanUse(SLINGSHOT) || logic->CanUse(BOOMERANG)));}}),
   }, {
                   //Exits
                   Entrance(SPIRIT_TEMPLE_ENTRYWAY, {[]{return true;}}),
-                  Entrance(SPIRIT_TEMPLE_MQ_CHILD, {[]{return IsChild;}}),
-                  Entrance(SPIRIT_TEMPLE_MQ_ADULT, {[]{return HasBombchus && IsAdult && CanUse(LONGSHOT) && CanUse(SILVER_GAUNTLETS);}}),
+                  Entrance(SPIRIT_TEMPLE_MQ_CHILD, {[]{return logic->IsChild;}}),
+                  Entrance(SPIRIT_TEMPLE_MQ_ADULT, {[]{return logic->HasBombchus && logic->IsAdult && logic->CanUse(LONGSHOT) && logic->CanUse(SILVER_GAUNTLETS);}}),
   });
 
-  areaTable[SPIRIT_TEMPLE_MQ_CHILD] = Area("Spirit Temple MQ Child", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {
+  world->areaTable[SPIRIT_TEMPLE_MQ_CHILD] = Area("Spirit Temple MQ Child", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {
                   //Events
-                  EventAccess(&FairyPot, {[]{return FairyPot || (KokiriSword && HasBombchus && Slingshot);}}),
+                  EventAccess(&Logic::Vars::FairyPot, {[]{return logic->FairyPot || (logic->KokiriSword && logic->HasBombchus && logic->Slingshot);}}),
   }, {
                   //Locations
-                  LocationAccess(SPIRIT_TEMPLE_MQ_CHILD_HAMMER_SWITCH_CHEST,  {[]{return Here(SPIRIT_TEMPLE_MQ_ADULT, []{return SmallKeys(SPIRIT_TEMPLE, 7) && Hammer;});}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_MAP_ROOM_ENEMY_CHEST,       {[]{return KokiriSword && HasBombchus && Slingshot && CanUse(DINS_FIRE);}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_MAP_CHEST,                  {[]{return KokiriSword || Bombs;}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_SILVER_BLOCK_HALLWAY_CHEST, {[]{return HasBombchus && SmallKeys(SPIRIT_TEMPLE, 7) && Slingshot && (CanUse(DINS_FIRE) || (Here(SPIRIT_TEMPLE_MQ_ADULT, []{return IsAdult && (CanUse(FIRE_ARROWS) || (LogicSpiritMQFrozenEye && CanUse(BOW) && CanPlay(SongOfTime)));})));}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_CHILD_HAMMER_SWITCH_CHEST,  {[]{return Here(SPIRIT_TEMPLE_MQ_ADULT, []{return logic->SmallKeys(SPIRIT_TEMPLE, 7) && logic->Hammer;});}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_MAP_ROOM_ENEMY_CHEST,       {[]{return logic->KokiriSword && logic->HasBombchus && logic->Slingshot && logic->CanUse(DINS_FIRE);}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_MAP_CHEST,                  {[]{return logic->KokiriSword || logic->Bombs;}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_SILVER_BLOCK_HALLWAY_CHEST, {[]{return logic->HasBombchus && logic->SmallKeys(SPIRIT_TEMPLE, 7) && logic->Slingshot && (logic->CanUse(DINS_FIRE) || (Here(SPIRIT_TEMPLE_MQ_ADULT, []{return logic->IsAdult && (logic->CanUse(FIRE_ARROWS) || (settings->LogicSpiritMQFrozenEye && logic->CanUse(BOW) && logic->CanPlay(logic->SongOfTime)));})));}}),
                     //Trick: HasBombchus && SmallKeys(SPIRIT_TEMPLE, 7) && Slingshot && (CanUse(DINS_FIRE) || (SPIRIT_TEMPLE_MQ_ADULT.Adult() && IsAdult && (CanUse(FIRE_ARROWS) || (LogicSpiritMQFrozenEye && CanUse(BOW) && CanPlay(SongOfTime)))))
   }, {
                   //Exits
-                  Entrance(SPIRIT_TEMPLE_MQ_SHARED, {[]{return HasBombchus && SmallKeys(SPIRIT_TEMPLE, 2);}}),
+                  Entrance(SPIRIT_TEMPLE_MQ_SHARED, {[]{return logic->HasBombchus && logic->SmallKeys(SPIRIT_TEMPLE, 2);}}),
   });
 
-  areaTable[SPIRIT_TEMPLE_MQ_ADULT] = Area("Spirit Temple MQ Adult", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SPIRIT_TEMPLE_MQ_ADULT] = Area("Spirit Temple MQ Adult", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SPIRIT_TEMPLE_MQ_CHILD_CLIMB_SOUTH_CHEST,     {[]{return SmallKeys(SPIRIT_TEMPLE, 7);}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_STATUE_ROOM_LULLABY_CHEST,   {[]{return CanPlay(ZeldasLullaby) && (CanJumpslash || CanUse(HOVER_BOOTS));}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_STATUE_ROOM_INVISIBLE_CHEST, {[]{return (LogicLensSpiritMQ || CanUse(LENS_OF_TRUTH));}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_BEAMOS_ROOM_CHEST,           {[]{return SmallKeys(SPIRIT_TEMPLE, 5);}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_CHEST_SWITCH_CHEST,          {[]{return SmallKeys(SPIRIT_TEMPLE, 5) && CanPlay(SongOfTime);}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_BOSS_KEY_CHEST,              {[]{return SmallKeys(SPIRIT_TEMPLE, 5) && CanPlay(SongOfTime) && (MirrorShield || (SunlightArrows && CanUse(LIGHT_ARROWS)));}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_GS_NINE_THRONES_ROOM_WEST,   {[]{return SmallKeys(SPIRIT_TEMPLE, 7);}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_GS_NINE_THRONES_ROOM_NORTH,  {[]{return SmallKeys(SPIRIT_TEMPLE, 7);}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_CHILD_CLIMB_SOUTH_CHEST,     {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 7);}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_STATUE_ROOM_LULLABY_CHEST,   {[]{return logic->CanPlay(logic->ZeldasLullaby) && (logic->CanJumpslash || logic->CanUse(HOVER_BOOTS));}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_STATUE_ROOM_INVISIBLE_CHEST, {[]{return (settings->LogicLensSpiritMQ || logic->CanUse(LENS_OF_TRUTH));}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_BEAMOS_ROOM_CHEST,           {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 5);}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_CHEST_SWITCH_CHEST,          {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 5) && logic->CanPlay(logic->SongOfTime);}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_BOSS_KEY_CHEST,              {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 5) && logic->CanPlay(logic->SongOfTime) && (logic->MirrorShield || (settings->SunlightArrows && logic->CanUse(LIGHT_ARROWS)));}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_GS_NINE_THRONES_ROOM_WEST,   {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 7);}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_GS_NINE_THRONES_ROOM_NORTH,  {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 7);}}),
   }, {
                   //Exits
-                  Entrance(SPIRIT_TEMPLE_MQ_LOWER_ADULT,        {[]{return MirrorShield && IsAdult && (CanUse(FIRE_ARROWS) || (LogicSpiritMQLowerAdult && CanUse(DINS_FIRE) && Bow));}}),
+                  Entrance(SPIRIT_TEMPLE_MQ_LOWER_ADULT,        {[]{return logic->MirrorShield && logic->IsAdult && (logic->CanUse(FIRE_ARROWS) || (settings->LogicSpiritMQLowerAdult && logic->CanUse(DINS_FIRE) && logic->Bow));}}),
                     //Trick: MirrorShield && IsAdult && (CanUse(FIRE_ARROWS) || (LogicSpiritMQLowerAdult && CanUse(DINS_FIRE) && Bow))
                   Entrance(SPIRIT_TEMPLE_MQ_SHARED,             {[]{return true;}}),
-                  Entrance(SPIRIT_TEMPLE_MQ_BOSS_AREA,          {[]{return SmallKeys(SPIRIT_TEMPLE, 6) && CanPlay(ZeldasLullaby) && Hammer;}}),
-                  Entrance(SPIRIT_TEMPLE_MQ_MIRROR_SHIELD_HAND, {[]{return SmallKeys(SPIRIT_TEMPLE, 5) && CanPlay(SongOfTime) && CanJumpslash && (LogicLensSpiritMQ || CanUse(LENS_OF_TRUTH));}}),
+                  Entrance(SPIRIT_TEMPLE_MQ_BOSS_AREA,          {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 6) && logic->CanPlay(logic->ZeldasLullaby) && logic->Hammer;}}),
+                  Entrance(SPIRIT_TEMPLE_MQ_MIRROR_SHIELD_HAND, {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 5) && logic->CanPlay(logic->SongOfTime) && logic->CanJumpslash && (settings->LogicLensSpiritMQ || logic->CanUse(LENS_OF_TRUTH));}}),
   });
 
-  areaTable[SPIRIT_TEMPLE_MQ_SHARED] = Area("Spirit Temple MQ Shared", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SPIRIT_TEMPLE_MQ_SHARED] = Area("Spirit Temple MQ Shared", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SPIRIT_TEMPLE_MQ_CHILD_CLIMB_NORTH_CHEST, {[]{return SmallKeys(SPIRIT_TEMPLE, 6);}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_COMPASS_CHEST,           {[]{return (IsChild && CanUse(SLINGSHOT) && SmallKeys(SPIRIT_TEMPLE, 7)) || (IsAdult && CanUse(BOW)) || (Bow && Slingshot);}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_SUN_BLOCK_ROOM_CHEST,    {[]{return CanPlay(SongOfTime) || LogicSpiritMQSunBlockSoT || IsAdult;}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_CHILD_CLIMB_NORTH_CHEST, {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 6);}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_COMPASS_CHEST,           {[]{return (logic->IsChild && logic->CanUse(SLINGSHOT) && logic->SmallKeys(SPIRIT_TEMPLE, 7)) || (logic->IsAdult && logic->CanUse(BOW)) || (logic->Bow && logic->Slingshot);}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_SUN_BLOCK_ROOM_CHEST,    {[]{return logic->CanPlay(logic->SongOfTime) || settings->LogicSpiritMQSunBlockSoT || logic->IsAdult;}}),
                     //Trick: CanPlay(SongOfTime) || LogicSpiritMQSunBlockSoT || IsAdult
-                  LocationAccess(SPIRIT_TEMPLE_MQ_GS_SUN_BLOCK_ROOM,       {[]{return (LogicSpiritMQSunBlockGS && Boomerang && (CanPlay(SongOfTime) || LogicSpiritMQSunBlockSoT)) || IsAdult;}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_GS_SUN_BLOCK_ROOM,       {[]{return (settings->LogicSpiritMQSunBlockGS && logic->Boomerang && (logic->CanPlay(logic->SongOfTime) || settings->LogicSpiritMQSunBlockSoT)) || logic->IsAdult;}}),
                     //Trick: (LogicSpiritMQSunBlockGS && Boomerang && (CanPlay(SongOfTime) || LogicSpiritMQSunBlockSoT)) || IsAdult
    }, {
                   //Exits
-                  Entrance(SPIRIT_TEMPLE_MQ_SILVER_GAUNTLETS_HAND, {[]{return (SmallKeys(SPIRIT_TEMPLE, 7) && (CanPlay(SongOfTime) || LogicSpiritMQSunBlockSoT || IsAdult)) || (SmallKeys(SPIRIT_TEMPLE, 4) && CanPlay(SongOfTime) && CanJumpslash && (LogicLensSpiritMQ || CanUse(LENS_OF_TRUTH)));}}),
+                  Entrance(SPIRIT_TEMPLE_MQ_SILVER_GAUNTLETS_HAND, {[]{return (logic->SmallKeys(SPIRIT_TEMPLE, 7) && (logic->CanPlay(logic->SongOfTime) || settings->LogicSpiritMQSunBlockSoT || logic->IsAdult)) || (logic->SmallKeys(SPIRIT_TEMPLE, 4) && logic->CanPlay(logic->SongOfTime) && logic->CanJumpslash && (settings->LogicLensSpiritMQ || logic->CanUse(LENS_OF_TRUTH)));}}),
                     //Trick: (SmallKeys(SPIRIT_TEMPLE, 7) && (CanPlay(SongOfTime) || LogicSpiritMQSunBlockSoT || IsAdult)) || (SmallKeys(SPIRIT_TEMPLE, 4) && CanPlay(SongOfTime) && (LogicLensSpiritMQ || CanUse(LENS_OF_TRUTH)))
-                  Entrance(DESERT_COLOSSUS,                        {[]{return (SmallKeys(SPIRIT_TEMPLE, 7) && (CanPlay(SongOfTime) || LogicSpiritMQSunBlockSoT || IsAdult)) || (SmallKeys(SPIRIT_TEMPLE, 4) && CanPlay(SongOfTime) && CanJumpslash && (LogicLensSpiritMQ || CanUse(LENS_OF_TRUTH)) && IsAdult);}}),
+                  Entrance(DESERT_COLOSSUS,                        {[]{return (logic->SmallKeys(SPIRIT_TEMPLE, 7) && (logic->CanPlay(logic->SongOfTime) || settings->LogicSpiritMQSunBlockSoT || logic->IsAdult)) || (logic->SmallKeys(SPIRIT_TEMPLE, 4) && logic->CanPlay(logic->SongOfTime) && logic->CanJumpslash && (settings->LogicLensSpiritMQ || logic->CanUse(LENS_OF_TRUTH)) && logic->IsAdult);}}),
                     //Trick: (SmallKeys(SPIRIT_TEMPLE, 7) && (CanPlay(SongOfTime) || LogicSpiritMQSunBlockSoT || IsAdult)) || (SmallKeys(SPIRIT_TEMPLE, 4) && CanPlay(SongOfTime) && (LogicLensSpiritMQ || CanUse(LENS_OF_TRUTH)) && IsAdult)
   });
 
-  areaTable[SPIRIT_TEMPLE_MQ_LOWER_ADULT] = Area("Spirit Temple MQ Lower Adult", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SPIRIT_TEMPLE_MQ_LOWER_ADULT] = Area("Spirit Temple MQ Lower Adult", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(SPIRIT_TEMPLE_MQ_LEEVER_ROOM_CHEST,          {[]{return true;}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_SYMPHONY_ROOM_CHEST,        {[]{return SmallKeys(SPIRIT_TEMPLE, 7) && Hammer && Ocarina && SongOfTime && EponasSong && SunsSong && SongOfStorms && ZeldasLullaby;}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_ENTRANCE_FRONT_RIGHT_CHEST, {[]{return Hammer;}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_SYMPHONY_ROOM_CHEST,        {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 7) && logic->Hammer && logic->Ocarina && logic->SongOfTime && logic->EponasSong && logic->SunsSong && logic->SongOfStorms && logic->ZeldasLullaby;}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_ENTRANCE_FRONT_RIGHT_CHEST, {[]{return logic->Hammer;}}),
                   LocationAccess(SPIRIT_TEMPLE_MQ_GS_LEEVER_ROOM,             {[]{return true;}}),
-                  LocationAccess(SPIRIT_TEMPLE_MQ_GS_SYMPHONY_ROOM,           {[]{return SmallKeys(SPIRIT_TEMPLE, 7) && Hammer && Ocarina && SongOfTime && EponasSong && SunsSong && SongOfStorms && ZeldasLullaby;}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_GS_SYMPHONY_ROOM,           {[]{return logic->SmallKeys(SPIRIT_TEMPLE, 7) && logic->Hammer && logic->Ocarina && logic->SongOfTime && logic->EponasSong && logic->SunsSong && logic->SongOfStorms && logic->ZeldasLullaby;}}),
   }, {});
 
-  areaTable[SPIRIT_TEMPLE_MQ_BOSS_AREA] = Area("Spirit Temple MQ Boss Area", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SPIRIT_TEMPLE_MQ_BOSS_AREA] = Area("Spirit Temple MQ Boss Area", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
-                  LocationAccess(SPIRIT_TEMPLE_MQ_MIRROR_PUZZLE_INVISIBLE_CHEST, {[]{return LogicLensSpiritMQ || CanUse(LENS_OF_TRUTH);}}),
+                  LocationAccess(SPIRIT_TEMPLE_MQ_MIRROR_PUZZLE_INVISIBLE_CHEST, {[]{return settings->LogicLensSpiritMQ || logic->CanUse(LENS_OF_TRUTH);}}),
   }, {
                   //Exits
-                  Entrance(SPIRIT_TEMPLE_MQ_INSIDE_STATUE_HEAD, {[]{return MirrorShield && Hookshot;}}),
+                  Entrance(SPIRIT_TEMPLE_MQ_INSIDE_STATUE_HEAD, {[]{return logic->MirrorShield && logic->Hookshot;}}),
   });
 
-  areaTable[SPIRIT_TEMPLE_MQ_INSIDE_STATUE_HEAD] =
+  world->areaTable[SPIRIT_TEMPLE_MQ_INSIDE_STATUE_HEAD] =
             Area("Spirit Temple MQ Inside Statue Head", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {},
                  {
                      // Exits
                      Entrance(SPIRIT_TEMPLE_MQ_SHARED, { [] { return true; } }),
-                     Entrance(SPIRIT_TEMPLE_BOSS_ENTRYWAY, { [] { return BossKeySpiritTemple; } }),
+                     Entrance(SPIRIT_TEMPLE_BOSS_ENTRYWAY, { [] { return logic->BossKeySpiritTemple; } }),
                  });
 
-  areaTable[SPIRIT_TEMPLE_MQ_MIRROR_SHIELD_HAND] = Area("Spirit Temple MQ Mirror Shield Hand", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SPIRIT_TEMPLE_MQ_MIRROR_SHIELD_HAND] = Area("Spirit Temple MQ Mirror Shield Hand", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(SPIRIT_TEMPLE_MIRROR_SHIELD_CHEST, {[]{return true;}}),
   }, {});
 
-  areaTable[SPIRIT_TEMPLE_MQ_SILVER_GAUNTLETS_HAND] = Area("Spirit Temple MQ Silver Gauntlets Hand", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
+  world->areaTable[SPIRIT_TEMPLE_MQ_SILVER_GAUNTLETS_HAND] = Area("Spirit Temple MQ Silver Gauntlets Hand", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {
                   //Locations
                   LocationAccess(SPIRIT_TEMPLE_SILVER_GAUNTLETS_CHEST, {[]{return true;}}),
   }, {});
@@ -245,32 +246,32 @@ void AreaTable_Init_SpiritTemple() {
     /*---------------------------
     |         BOSS ROOM         |
     ---------------------------*/
-    areaTable[SPIRIT_TEMPLE_BOSS_ENTRYWAY] = Area(
+    world->areaTable[SPIRIT_TEMPLE_BOSS_ENTRYWAY] = Area(
         "Spirit Temple Boss Entryway", "Spirit Temple", SPIRIT_TEMPLE, NO_DAY_NIGHT_CYCLE, {}, {},
         {
             // Exits
-            Entrance(SPIRIT_TEMPLE_INSIDE_STATUE_HEAD, { [] { return Dungeon::SpiritTemple.IsVanilla() && false; } }),
-            Entrance(SPIRIT_TEMPLE_MQ_INSIDE_STATUE_HEAD, { [] { return Dungeon::SpiritTemple.IsMQ() && false; } }),
+            Entrance(SPIRIT_TEMPLE_INSIDE_STATUE_HEAD, { [] { return world->dungeons.SpiritTemple.IsVanilla() && false; } }),
+            Entrance(SPIRIT_TEMPLE_MQ_INSIDE_STATUE_HEAD, { [] { return world->dungeons.SpiritTemple.IsMQ() && false; } }),
             Entrance(SPIRIT_TEMPLE_BOSS_ROOM, { [] { return true; } }),
         });
 
-    areaTable[SPIRIT_TEMPLE_BOSS_ROOM] = Area(
+    world->areaTable[SPIRIT_TEMPLE_BOSS_ROOM] = Area(
         "Spirit Temple Boss Room", "Spirit Temple", NONE, NO_DAY_NIGHT_CYCLE,
         {
             // Events
-            EventAccess(&SpiritTempleClear, { [] {
-                return SpiritTempleClear || (CanUse(MIRROR_SHIELD) &&
-                                             (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD)));
+            EventAccess(&Logic::Vars::SpiritTempleClear, { [] {
+                return logic->SpiritTempleClear || (logic->CanUse(MIRROR_SHIELD) &&
+                                             (logic->CanUse(KOKIRI_SWORD) || logic->CanUse(MASTER_SWORD) || logic->CanUse(BIGGORON_SWORD)));
             } }),
         },
         {
             // Locations
-            LocationAccess(SPIRIT_TEMPLE_TWINROVA_HEART, { [] { return SpiritTempleClear; } }),
-            LocationAccess(TWINROVA, { [] { return SpiritTempleClear; } }),
+            LocationAccess(SPIRIT_TEMPLE_TWINROVA_HEART, { [] { return logic->SpiritTempleClear; } }),
+            LocationAccess(TWINROVA, { [] { return logic->SpiritTempleClear; } }),
         },
         {
             // Exits
             Entrance(SPIRIT_TEMPLE_BOSS_ENTRYWAY, { [] { return false; } }),
-            Entrance(DESERT_COLOSSUS, { [] { return SpiritTempleClear; } }),
+            Entrance(DESERT_COLOSSUS, { [] { return logic->SpiritTempleClear; } }),
         });
 }
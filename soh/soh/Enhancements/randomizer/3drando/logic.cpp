@@ -1,6 +1,9 @@
 #include "logic.hpp"
+#include "world.hpp"
 
 #include <algorithm>
+#include <array>
+#include <bitset>
 #include <cstdio>
 #include <string>
 #include <string_view>
@@ -13,368 +16,7 @@ using namespace Settings;
 
 namespace Logic {
 
-  bool noVariable    = false;
-
-  //Child item logic
-  bool KokiriSword   = false;
-  bool ZeldasLetter  = false;
-  bool WeirdEgg      = false;
-  bool HasBottle     = false;
-  bool Bombchus      = false;
-  bool Bombchus5     = false;
-  bool Bombchus10    = false;
-  bool Bombchus20    = false;
-  bool MagicBean     = false;
-  bool MagicBeanPack = false;
-  bool RutosLetter   = false;
-  bool Boomerang     = false;
-  bool DinsFire      = false;
-  bool FaroresWind   = false;
-  bool NayrusLove    = false;
-  bool LensOfTruth   = false;
-  bool ShardOfAgony  = false;
-  bool SkullMask     = false;
-  bool MaskOfTruth   = false;
-
-  //Adult logic
-  bool Hammer        = false;
-  bool IronBoots     = false;
-  bool HoverBoots    = false;
-  bool MirrorShield  = false;
-  bool GoronTunic    = false;
-  bool ZoraTunic     = false;
-  bool Epona         = false;
-  bool BigPoe        = false;
-  bool GerudoToken   = false;
-  bool FireArrows    = false;
-  bool IceArrows     = false;
-  bool LightArrows   = false;
-  bool MasterSword   = false;
-  bool BiggoronSword = false;
-
-  //Trade Quest
-  bool PocketEgg     = false;
-  bool Cojiro        = false;
-  bool OddMushroom   = false;
-  bool OddPoultice   = false;
-  bool PoachersSaw   = false;
-  bool BrokenSword   = false;
-  bool Prescription  = false;
-  bool EyeballFrog   = false;
-  bool Eyedrops      = false;
-  bool ClaimCheck    = false;
-
-  //Trade Quest Events
-  bool WakeUpAdultTalon   = false;
-  bool CojiroAccess       = false;
-  bool OddMushroomAccess  = false;
-  bool OddPoulticeAccess  = false;
-  bool PoachersSawAccess  = false;
-  bool BrokenSwordAccess  = false;
-  bool PrescriptionAccess = false;
-  bool EyeballFrogAccess  = false;
-  bool EyedropsAccess     = false;
-  bool DisableTradeRevert = false;
-
-  //Songs
-  bool ZeldasLullaby    = false;
-  bool SariasSong       = false;
-  bool SunsSong         = false;
-  bool SongOfStorms     = false;
-  bool EponasSong       = false;
-  bool SongOfTime       = false;
-  bool MinuetOfForest   = false;
-  bool BoleroOfFire     = false;
-  bool SerenadeOfWater  = false;
-  bool RequiemOfSpirit  = false;
-  bool NocturneOfShadow = false;
-  bool PreludeOfLight   = false;
-
-  //Stones and Meddallions
-  bool ForestMedallion = false;
-  bool FireMedallion   = false;
-  bool WaterMedallion  = false;
-  bool SpiritMedallion = false;
-  bool ShadowMedallion = false;
-  bool LightMedallion  = false;
-  bool KokiriEmerald   = false;
-  bool GoronRuby       = false;
-  bool ZoraSapphire    = false;
-
-  //Dungeon Clears
-  bool DekuTreeClear       = false;
-  bool DodongosCavernClear = false;
-  bool JabuJabusBellyClear = false;
-  bool ForestTempleClear   = false;
-  bool FireTempleClear     = false;
-  bool WaterTempleClear    = false;
-  bool SpiritTempleClear   = false;
-  bool ShadowTempleClear   = false;
-
-  //Trial Clears
-  bool ForestTrialClear = false;
-  bool FireTrialClear   = false;
-  bool WaterTrialClear  = false;
-  bool SpiritTrialClear = false;
-  bool ShadowTrialClear = false;
-  bool LightTrialClear  = false;
-
-  //Greg
-  bool Greg = false;
-  bool GregInBridgeLogic = false;
-  bool GregInLacsLogic = false;
-
-  //Progressive Items
-  uint8_t ProgressiveBulletBag  = 0;
-  uint8_t ProgressiveBombBag    = 0;
-  uint8_t ProgressiveMagic      = 0;
-  uint8_t ProgressiveScale      = 0;
-  uint8_t ProgressiveHookshot   = 0;
-  uint8_t ProgressiveBow        = 0;
-  uint8_t ProgressiveWallet     = 0;
-  uint8_t ProgressiveStrength   = 0;
-  uint8_t ProgressiveOcarina    = 0;
-  uint8_t ProgressiveGiantKnife = 0;
-
-  //Logical keysanity
-  bool IsKeysanity = false;
-
-  //Keys
-  uint8_t ForestTempleKeys          = 0;
-  uint8_t FireTempleKeys            = 0;
-  uint8_t WaterTempleKeys           = 0;
-  uint8_t SpiritTempleKeys          = 0;
-  uint8_t ShadowTempleKeys          = 0;
-  uint8_t GanonsCastleKeys          = 0;
-  uint8_t GerudoFortressKeys        = 0;
-  uint8_t GerudoTrainingGroundsKeys = 0;
-  uint8_t BottomOfTheWellKeys       = 0;
-  uint8_t TreasureGameKeys          = 0;
-
-  //Triforce Pieces
-  uint8_t TriforcePieces = 0;
-
-  //Boss Keys
-  bool BossKeyForestTemple = false;
-  bool BossKeyFireTemple   = false;
-  bool BossKeyWaterTemple  = false;
-  bool BossKeySpiritTemple = false;
-  bool BossKeyShadowTemple = false;
-  bool BossKeyGanonsCastle = false;
-
-  //Gold Skulltula Count
-  uint8_t GoldSkulltulaTokens = 0;
-
-  //Bottle Count
-  uint8_t   Bottles    = 0;
-  uint8_t   NumBottles = 0;
-  bool NoBottles  = false;
-
-  //Drops and Bottle Contents Access
-  bool DekuNutDrop      = false;
-  bool NutPot           = false;
-  bool NutCrate         = false;
-  bool DekuBabaNuts     = false;
-  bool DekuStickDrop    = false;
-  bool StickPot         = false;
-  bool DekuBabaSticks   = false;
-  bool BugsAccess       = false;
-  bool BugShrub         = false;
-  bool WanderingBugs    = false;
-  bool BugRock          = false;
-  bool BlueFireAccess   = false;
-  bool FishAccess       = false;
-  bool FishGroup        = false;
-  bool LoneFish         = false;
-  bool FairyAccess      = false;
-  bool GossipStoneFairy = false;
-  bool BeanPlantFairy   = false;
-  bool ButterflyFairy   = false;
-  bool FairyPot         = false;
-  bool FreeFairies      = false;
-  bool FairyPond        = false;
-  bool BombchuDrop      = false;
-  bool AmmoCanDrop      = false;
-
-  bool BuyBombchus10    = false;
-  bool BuyBombchus20    = false;
-  bool BuySeed          = false;
-  bool BuyArrow         = false;
-  bool BuyBomb          = false;
-  bool BuyGPotion       = false;
-  bool BuyBPotion       = false;
-  bool MagicRefill      = false;
-
-  uint8_t   PieceOfHeart     = 0;
-  uint8_t   HeartContainer   = 0;
-  bool DoubleDefense    = false;
-
-  /* --- HELPERS, EVENTS, AND LOCATION ACCESS --- */
-  /* These are used to simplify reading the logic, but need to be updated
-  /  every time a base value is updated.                       */
-
-  bool Slingshot        = false;
-  bool Ocarina          = false;
-  bool OcarinaOfTime    = false;
-  bool BombBag          = false;
-  bool MagicMeter       = false;
-  bool Hookshot         = false;
-  bool Longshot         = false;
-  bool Bow              = false;
-  bool GoronBracelet    = false;
-  bool SilverGauntlets  = false;
-  bool GoldenGauntlets  = false;
-  bool SilverScale      = false;
-  bool GoldScale        = false;
-  bool AdultsWallet     = false;
-
-  bool ChildScarecrow   = false;
-  bool AdultScarecrow   = false;
-  bool ScarecrowSong    = false;
-  bool Scarecrow        = false;
-  bool DistantScarecrow = false;
-
-  bool Bombs            = false;
-  bool DekuShield       = false;
-  bool HylianShield     = false;
-  bool Nuts             = false;
-  bool Sticks           = false;
-  bool Bugs             = false;
-  bool BlueFire         = false;
-  bool Fish             = false;
-  bool Fairy            = false;
-  bool BottleWithBigPoe = false;
-
-  bool FoundBombchus    = false;
-  bool CanPlayBowling   = false;
-  bool HasBombchus      = false;
-  bool HasExplosives    = false;
-  bool HasBoots         = false;
-  bool IsChild          = false;
-  bool IsAdult          = false;
-  bool IsGlitched       = false;
-  bool CanBlastOrSmash  = false;
-  bool CanChildAttack   = false;
-  bool CanChildDamage   = false;
-  bool CanAdultAttack   = false;
-  bool CanAdultDamage   = false;
-  bool CanCutShrubs     = false;
-  bool CanDive          = false;
-  bool CanLeaveForest   = false;
-  bool CanPlantBugs     = false;
-  bool CanRideEpona     = false;
-  bool CanStunDeku      = false;
-  bool CanSummonGossipFairy = false;
-  bool CanSummonGossipFairyWithoutSuns = false;
-  bool NeedNayrusLove      = false;
-  bool CanSurviveDamage    = false;
-  bool CanTakeDamage       = false;
-  bool CanTakeDamageTwice  = false;
-  //bool CanPlantBean        = false;
-  bool CanOpenBombGrotto   = false;
-  bool CanOpenStormGrotto  = false;
-  bool BigPoeKill          = false;
-  bool HookshotOrBoomerang = false;
-  bool CanGetNightTimeGS   = false;
-
-  uint8_t   BaseHearts      = 0;
-  uint8_t   Hearts          = 0;
-  uint8_t   Multiplier      = 0;
-  uint8_t   EffectiveHealth = 0;
-  uint8_t   FireTimer       = 0;
-  uint8_t   WaterTimer      = 0;
-
-  bool GuaranteeTradePath     = false;
-  bool GuaranteeHint          = false;
-  bool HasFireSource          = false;
-  bool HasFireSourceWithTorch = false;
-
-  bool CanFinishGerudoFortress = false;
-
-  bool HasShield          = false;
-  bool CanShield          = false;
-  bool ChildShield        = false;
-  bool AdultReflectShield = false;
-  bool AdultShield        = false;
-  bool CanShieldFlick     = false;
-  bool CanJumpslash       = false;
-  bool CanUseProjectile   = false;
-  bool CanUseMagicArrow   = false;
-
-  //Bridge and LACS Requirements
-  uint8_t StoneCount              = 0;
-  uint8_t MedallionCount          = 0;
-  uint8_t DungeonCount            = 0;
-  bool HasAllStones          = false;
-  bool HasAllMedallions      = false;
-  bool CanBuildRainbowBridge = false;
-  bool BuiltRainbowBridge    = false;
-  bool CanTriggerLACS        = false;
-
-  //Other
-  bool AtDay         = false;
-  bool AtNight       = false;
-  uint8_t Age             = 0;
-  bool CanCompleteTriforce = false;
-
-  //Events
-  bool ShowedMidoSwordAndShield  = false;
-  bool CarpenterRescue           = false;
-  bool GF_GateOpen               = false;
-  bool GtG_GateOpen              = false;
-  bool DampesWindmillAccess      = false;
-  bool DrainWell                 = false;
-  bool GoronCityChildFire        = false;
-  bool GCWoodsWarpOpen           = false;
-  bool GCDaruniasDoorOpenChild   = false;
-  bool StopGCRollingGoronAsAdult = false;
-  bool WaterTempleLow            = false;
-  bool WaterTempleMiddle         = false;
-  bool WaterTempleHigh           = false;
-  bool KakarikoVillageGateOpen   = false;
-  bool KingZoraThawed            = false;
-  bool ForestTempleJoelle        = false;
-  bool ForestTempleBeth          = false;
-  bool ForestTempleJoAndBeth     = false;
-  bool ForestTempleAmy           = false;
-  bool ForestTempleMeg           = false;
-  bool ForestTempleAmyAndMeg     = false;
-  bool FireLoopSwitch            = false;
-  bool LinksCow                  = false;
-  bool AtDampeTime               = false;
-  bool DeliverLetter             = false;
-  bool TimeTravel                = false;
-
-  /* --- END OF HELPERS AND LOCATION ACCESS --- */
-
-  //Placement Tracking
-  uint8_t AddedProgressiveBulletBags = 0;
-  uint8_t AddedProgressiveBombBags   = 0;
-  uint8_t AddedProgressiveMagics     = 0;
-  uint8_t AddedProgressiveScales     = 0;
-  uint8_t AddedProgressiveHookshots  = 0;
-  uint8_t AddedProgressiveBows       = 0;
-  uint8_t AddedProgressiveWallets    = 0;
-  uint8_t AddedProgressiveStrengths  = 0;
-  uint8_t AddedProgressiveOcarinas   = 0;
-  uint8_t TokensInPool               = 0;
-
-  //Event checking past
-  bool DrainWellPast            = false;
-  bool DampesWindmillAccessPast = false;
-  bool DekuTreeClearPast        = false;
-  bool GoronRubyPast            = false;
-  bool ZoraSapphirePast         = false;
-  bool ForestTrialClearPast     = false;
-  bool FireTrialClearPast       = false;
-  bool WaterTrialClearPast      = false;
-  bool SpiritTrialClearPast     = false;
-  bool ShadowTrialClearPast     = false;
-  bool LightTrialClearPast      = false;
-  bool BuyDekuShieldPast        = false;
-  bool TimeTravelPast           = false;
-
-  bool CanPlay(bool song) {
+  bool Vars::CanPlay(bool song) const {
     return Ocarina && song;
   }
 
@@ -391,7 +33,7 @@ namespace Logic {
            item == LIGHT_ARROWS;
   }
 
-  bool HasItem(uint32_t itemName) {
+  bool Vars::HasItem(uint32_t itemName) const {
     return (itemName == DINS_FIRE         && DinsFire)        ||
            (itemName == FARORES_WIND      && FaroresWind)     ||
            (itemName == NAYRUS_LOVE       && NayrusLove)      ||
@@ -424,42 +66,42 @@ namespace Logic {
   }
 
   //Can the passed in item be used?
-  bool CanUse(uint32_t itemName) {
+  bool Vars::CanUse(uint32_t itemName) const {
     if (!HasItem(itemName))
       return false;
 
     switch (itemName) {
       // Adult items
-      case BOW:               return IsAdult || BowAsChild;
-      case MEGATON_HAMMER:    return IsAdult || HammerAsChild;
-      case IRON_BOOTS:        return IsAdult || IronBootsAsChild;
-      case HOVER_BOOTS:       return IsAdult || HoverBootsAsChild;
-      case HOOKSHOT:          return IsAdult || HookshotAsChild;
-      case LONGSHOT:          return IsAdult || HookshotAsChild;
+      case BOW:               return IsAdult || settings->BowAsChild;
+      case MEGATON_HAMMER:    return IsAdult || settings->HammerAsChild;
+      case IRON_BOOTS:        return IsAdult || settings->IronBootsAsChild;
+      case HOVER_BOOTS:       return IsAdult || settings->HoverBootsAsChild;
+      case HOOKSHOT:          return IsAdult || settings->HookshotAsChild;
+      case LONGSHOT:          return IsAdult || settings->HookshotAsChild;
       case SILVER_GAUNTLETS:  return IsAdult;
       case GOLDEN_GAUNTLETS:  return IsAdult;
-      case GORON_TUNIC:       return IsAdult || GoronTunicAsChild;
-      case ZORA_TUNIC:        return IsAdult || ZoraTunicAsChild;
-      case SCARECROW:         return IsAdult || HookshotAsChild;
-      case DISTANT_SCARECROW: return IsAdult || HookshotAsChild;
+      case GORON_TUNIC:       return IsAdult || settings->GoronTunicAsChild;
+      case ZORA_TUNIC:        return IsAdult || settings->ZoraTunicAsChild;
+      case SCARECROW:         return IsAdult || settings->HookshotAsChild;
+      case DISTANT_SCARECROW: return IsAdult || settings->HookshotAsChild;
       case HYLIAN_SHIELD:     return IsAdult;
-      case MIRROR_SHIELD:     return IsAdult || MirrorShieldAsChild;
-      case MASTER_SWORD:      return IsAdult || MasterSwordAsChild;
-      case BIGGORON_SWORD:    return IsAdult || BiggoronSwordAsChild;
+      case MIRROR_SHIELD:     return IsAdult || settings->MirrorShieldAsChild;
+      case MASTER_SWORD:      return IsAdult || settings->MasterSwordAsChild;
+      case BIGGORON_SWORD:    return IsAdult || settings->BiggoronSwordAsChild;
 
       // Child items
-      case SLINGSHOT:         return IsChild || SlingshotAsAdult;
-      case BOOMERANG:         return IsChild || BoomerangAsAdult;
-      case KOKIRI_SWORD:      return IsChild || KokiriSwordAsAdult;
-      case STICKS:            return IsChild || StickAsAdult;
-      case DEKU_SHIELD:       return IsChild || DekuShieldAsAdult;
+      case SLINGSHOT:         return IsChild || settings->SlingshotAsAdult;
+      case BOOMERANG:         return IsChild || settings->BoomerangAsAdult;
+      case KOKIRI_SWORD:      return IsChild || settings->KokiriSwordAsAdult;
+      case STICKS:            return IsChild || settings->StickAsAdult;
+      case DEKU_SHIELD:       return IsChild || settings->DekuShieldAsAdult;
 
       // Magic items
       default: return MagicMeter && (IsMagicItem(itemName) || (IsMagicArrow(itemName) && CanUse(BOW)));
     }
   }
 
-  bool HasProjectile(HasProjectileAge age) {
+  bool Vars::HasProjectile(HasProjectileAge age) const {
     return HasExplosives ||
            (age == HasProjectileAge::Child  && (Slingshot || Boomerang)) ||
            (age == HasProjectileAge::Adult  && (Hookshot  || Bow      )) ||
@@ -473,7 +115,7 @@ namespace Logic {
 
 //todo rewrite glitch section
 
-  bool CanEquipSwap(uint32_t itemName) {
+  bool Vars::CanEquipSwap(uint32_t itemName) const {
     if (!HasItem(itemName))
       return false;
     
@@ -483,20 +125,19 @@ namespace Logic {
     return false;
   }
 
-  bool CanDoGlitch(GlitchType glitch) {
+  bool Vars::CanDoGlitch(GlitchType glitch) const {
     switch(glitch) {
       case GlitchType::EquipSwapDins:
-        return ((IsAdult && HasItem(DINS_FIRE)) || (IsChild && (HasItem(STICKS) || HasItem(DINS_FIRE)))) && GlitchEquipSwapDins;
+        return ((IsAdult && HasItem(DINS_FIRE)) || (IsChild && (HasItem(STICKS) || HasItem(DINS_FIRE)))) && settings->GlitchEquipSwapDins;
       case GlitchType::EquipSwap: // todo: add bunny hood to adult item equippable list and child trade item to child item equippable list
-        return ((IsAdult && (HasItem(DINS_FIRE) || HasItem(FARORES_WIND) || HasItem(NAYRUS_LOVE))) || (IsChild && (HasItem(STICKS) || HasItem(SLINGSHOT) || HasItem(BOOMERANG) || HasBottle || Nuts || Ocarina || HasItem(LENS_OF_TRUTH) || HasExplosives || (MagicBean || MagicBeanPack) || HasItem(DINS_FIRE) || HasItem(FARORES_WIND) || HasItem(NAYRUS_LOVE)))) && GlitchEquipSwap;
+        return ((IsAdult && (HasItem(DINS_FIRE) || HasItem(FARORES_WIND) || HasItem(NAYRUS_LOVE))) || (IsChild && (HasItem(STICKS) || HasItem(SLINGSHOT) || HasItem(BOOMERANG) || HasBottle || Nuts || Ocarina || HasItem(LENS_OF_TRUTH) || HasExplosives || (MagicBean || MagicBeanPack) || HasItem(DINS_FIRE) || HasItem(FARORES_WIND) || HasItem(NAYRUS_LOVE)))) && settings->GlitchEquipSwap;
     }
 
     //Shouldn't be reached
     return false;
   }
 
-  //Updates all logic helpers. Should be called whenever a non-helper is changed
-  void UpdateHelpers() {
+  void Vars::CalculateHelpers() {
     NumBottles      = ((NoBottles) ? 0 : (Bottles + ((DeliverLetter) ? 1 : 0)));
     HasBottle       = NumBottles >= 1;
     Slingshot       = (ProgressiveBulletBag >= 1) && (BuySeed || AmmoCanDrop);
@@ -515,7 +156,7 @@ namespace Logic {
     AdultsWallet    = ProgressiveWallet     >= 1;
     BiggoronSword   = BiggoronSword || ProgressiveGiantKnife >= 2;
 
-    ScarecrowSong    = ScarecrowSong || FreeScarecrow || (ChildScarecrow && AdultScarecrow);
+    ScarecrowSong    = ScarecrowSong || settings->FreeScarecrow || (ChildScarecrow && AdultScarecrow);
     Scarecrow        = Hookshot && CanPlay(ScarecrowSong);
     DistantScarecrow = Longshot && CanPlay(ScarecrowSong);
 
@@ -532,28 +173,28 @@ namespace Logic {
     Nuts         = DekuNutDrop || Nuts;
     Sticks       = DekuStickDrop || Sticks;
     Bugs         = HasBottle && BugsAccess;
-    BlueFire     = (HasBottle && BlueFireAccess) || (BlueFireArrows && CanUse(ICE_ARROWS));
+    BlueFire     = (HasBottle && BlueFireAccess) || (settings->BlueFireArrows && CanUse(ICE_ARROWS));
     Fish         = HasBottle && FishAccess;
     Fairy        = HasBottle && FairyAccess;
 
-    FoundBombchus   = (BombchuDrop || Bombchus || Bombchus5 || Bombchus10 || Bombchus20) && (BombBag || BombchusInLogic);
-    CanPlayBowling  = (BombchusInLogic && FoundBombchus) || (!BombchusInLogic && BombBag);
-    HasBombchus     = (BuyBombchus10 || BuyBombchus20 || (AmmoDrops.Is(AMMODROPS_BOMBCHU) && FoundBombchus));
+    FoundBombchus   = (BombchuDrop || Bombchus || Bombchus5 || Bombchus10 || Bombchus20) && (BombBag || settings->BombchusInLogic);
+    CanPlayBowling  = (settings->BombchusInLogic && FoundBombchus) || (!settings->BombchusInLogic && BombBag);
+    HasBombchus     = (BuyBombchus10 || BuyBombchus20 || (settings->AmmoDrops.Is(AMMODROPS_BOMBCHU) && FoundBombchus));
 
-    HasExplosives =  Bombs || (BombchusInLogic && HasBombchus);
+    HasExplosives =  Bombs || (settings->BombchusInLogic && HasBombchus);
 
     HasBoots = IronBoots || HoverBoots;
 
     //Unshuffled adult trade quest
-    Eyedrops     = Eyedrops     || (!ShuffleAdultTradeQuest && ClaimCheck);
-    EyeballFrog  = EyeballFrog  || (!ShuffleAdultTradeQuest && Eyedrops);
-    Prescription = Prescription || (!ShuffleAdultTradeQuest && EyeballFrog);
-    BrokenSword  = BrokenSword  || (!ShuffleAdultTradeQuest && Prescription);
-    PoachersSaw  = PoachersSaw  || (!ShuffleAdultTradeQuest && BrokenSword);
-    OddPoultice  = OddPoultice  || (!ShuffleAdultTradeQuest && PoachersSaw);
-    OddMushroom  = OddMushroom  || (!ShuffleAdultTradeQuest && OddPoultice);
-    Cojiro       = Cojiro       || (!ShuffleAdultTradeQuest && OddMushroom);
-    PocketEgg    = PocketEgg    || (!ShuffleAdultTradeQuest && Cojiro);
+    Eyedrops     = Eyedrops     || (!settings->ShuffleAdultTradeQuest && ClaimCheck);
+    EyeballFrog  = EyeballFrog  || (!settings->ShuffleAdultTradeQuest && Eyedrops);
+    Prescription = Prescription || (!settings->ShuffleAdultTradeQuest && EyeballFrog);
+    BrokenSword  = BrokenSword  || (!settings->ShuffleAdultTradeQuest && Prescription);
+    PoachersSaw  = PoachersSaw  || (!settings->ShuffleAdultTradeQuest && BrokenSword);
+    OddPoultice  = OddPoultice  || (!settings->ShuffleAdultTradeQuest && PoachersSaw);
+    OddMushroom  = OddMushroom  || (!settings->ShuffleAdultTradeQuest && OddPoultice);
+    Cojiro       = Cojiro       || (!settings->ShuffleAdultTradeQuest && OddMushroom);
+    PocketEgg    = PocketEgg    || (!settings->ShuffleAdultTradeQuest && Cojiro);
 
     // IsChild = Age == AGE_CHILD;
     // IsAdult = Age == AGE_ADULT;
@@ -563,40 +204,40 @@ namespace Logic {
     CanChildDamage  = IsChild && (Slingshot ||              Sticks || KokiriSword || HasExplosives || CanUse(DINS_FIRE) || CanUse(MASTER_SWORD) || CanUse(MEGATON_HAMMER) || CanUse(BIGGORON_SWORD));
     CanAdultAttack  = IsAdult && (CanUse(BOW) || CanUse(BOOMERANG)       || CanUse(STICKS) || CanUse(KOKIRI_SWORD) || HasExplosives || CanUse(DINS_FIRE) || MasterSword || Hammer || BiggoronSword || Hookshot);
     CanAdultDamage  = IsAdult && (CanUse(BOW) || CanUse(STICKS)          || CanUse(KOKIRI_SWORD) || HasExplosives || CanUse(DINS_FIRE) || MasterSword || Hammer || BiggoronSword);
-    CanStunDeku     = CanAdultAttack || CanChildAttack || Nuts || HasShield;
     CanCutShrubs    = CanUse(KOKIRI_SWORD) || CanUse(BOOMERANG) || HasExplosives || CanUse(MASTER_SWORD) || CanUse(MEGATON_HAMMER) || CanUse(BIGGORON_SWORD);
     CanDive         = ProgressiveScale >= 1;
-    CanLeaveForest  = OpenForest.IsNot(OPENFOREST_CLOSED) || IsAdult || DekuTreeClear || ShuffleInteriorEntrances || ShuffleOverworldEntrances;
+    CanLeaveForest  = settings->OpenForest.IsNot(OPENFOREST_CLOSED) || IsAdult || DekuTreeClear || settings->ShuffleInteriorEntrances || settings->ShuffleOverworldEntrances;
     CanPlantBugs    = IsChild && Bugs;
     CanRideEpona    = IsAdult && Epona && CanPlay(EponasSong);
     CanSummonGossipFairy            = Ocarina && (ZeldasLullaby || EponasSong || SongOfTime || SunsSong);
     CanSummonGossipFairyWithoutSuns = Ocarina && (ZeldasLullaby || EponasSong || SongOfTime);
     Hearts          = BaseHearts + HeartContainer + (PieceOfHeart >> 2);
     EffectiveHealth = ((Hearts << (2 + DoubleDefense)) >> Multiplier) + ((Hearts << (2 + DoubleDefense)) % (1 << Multiplier) > 0); //Number of half heart hits to die, ranges from 1 to 160
-    FireTimer       = CanUse(GORON_TUNIC) ? 255 : (LogicFewerTunicRequirements) ? (Hearts * 8) : 0;
-    WaterTimer      = CanUse( ZORA_TUNIC) ? 255 : (LogicFewerTunicRequirements) ? (Hearts * 8) : 0;
+    FireTimer       = CanUse(GORON_TUNIC) ? 255 : (settings->LogicFewerTunicRequirements) ? (Hearts * 8) : 0;
+    WaterTimer      = CanUse( ZORA_TUNIC) ? 255 : (settings->LogicFewerTunicRequirements) ? (Hearts * 8) : 0;
     NeedNayrusLove      = (EffectiveHealth == 1);
     CanSurviveDamage    = !NeedNayrusLove || CanUse(NAYRUS_LOVE);
     CanTakeDamage       = Fairy || CanSurviveDamage;
     CanTakeDamageTwice  = (Fairy && NumBottles >= 2) || ((EffectiveHealth == 2) && (CanUse(NAYRUS_LOVE) || Fairy)) || (EffectiveHealth > 2);
     //CanPlantBean        = IsChild && (MagicBean || MagicBeanPack);
-    CanOpenBombGrotto   = CanBlastOrSmash       && (ShardOfAgony || LogicGrottosWithoutAgony);
-    CanOpenStormGrotto  = CanPlay(SongOfStorms) && (ShardOfAgony || LogicGrottosWithoutAgony);
+    CanOpenBombGrotto   = CanBlastOrSmash       && (ShardOfAgony || settings->LogicGrottosWithoutAgony);
+    CanOpenStormGrotto  = CanPlay(SongOfStorms) && (ShardOfAgony || settings->LogicGrottosWithoutAgony);
     HookshotOrBoomerang = CanUse(HOOKSHOT) || CanUse(BOOMERANG);
-    CanGetNightTimeGS   = (CanPlay(SunsSong) || !NightGSExpectSuns);
+    CanGetNightTimeGS   = (CanPlay(SunsSong) || !settings->NightGSExpectSuns);
 
-    GuaranteeTradePath     = ShuffleInteriorEntrances || ShuffleOverworldEntrances || LogicBiggoronBolero || CanBlastOrSmash || StopGCRollingGoronAsAdult;
+    GuaranteeTradePath     = settings->ShuffleInteriorEntrances || settings->ShuffleOverworldEntrances || settings->LogicBiggoronBolero || CanBlastOrSmash || StopGCRollingGoronAsAdult;
   //GuaranteeHint          = (hints == "Mask" && MaskofTruth) || (hints == "Agony") || (hints != "Mask" && hints != "Agony");
     HasFireSource          = CanUse(DINS_FIRE) || CanUse(FIRE_ARROWS);
     HasFireSourceWithTorch = HasFireSource || CanUse(STICKS);
 
     //Gerudo Fortress
-    CanFinishGerudoFortress = (GerudoFortress.Is(GERUDOFORTRESS_NORMAL)    && GerudoFortressKeys >= 4 && (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD)) && (GerudoToken || CanUse(BOW) || CanUse(HOOKSHOT) || CanUse(HOVER_BOOTS) || LogicGerudoKitchen)) ||
-                              (GerudoFortress.Is(GERUDOFORTRESS_FAST)      && GerudoFortressKeys >= 1 && (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD))) ||
-                              (GerudoFortress.IsNot(GERUDOFORTRESS_NORMAL) && GerudoFortress.IsNot(GERUDOFORTRESS_FAST));
+    CanFinishGerudoFortress = (settings->GerudoFortress.Is(GERUDOFORTRESS_NORMAL)    && GerudoFortressKeys >= 4 && (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD)) && (GerudoToken || CanUse(BOW) || CanUse(HOOKSHOT) || CanUse(HOVER_BOOTS) || settings->LogicGerudoKitchen)) ||
+                              (settings->GerudoFortress.Is(GERUDOFORTRESS_FAST)      && GerudoFortressKeys >= 1 && (CanUse(KOKIRI_SWORD) || CanUse(MASTER_SWORD) || CanUse(BIGGORON_SWORD))) ||
+                              (settings->GerudoFortress.IsNot(GERUDOFORTRESS_NORMAL) && settings->GerudoFortress.IsNot(GERUDOFORTRESS_FAST));
 
     HasShield          = CanUse(HYLIAN_SHIELD) || CanUse(DEKU_SHIELD); //Mirror shield can't reflect attacks
     CanShield          = CanUse(MIRROR_SHIELD) || HasShield;
+    CanStunDeku        = CanAdultAttack || CanChildAttack || Nuts || HasShield;
     ChildShield        = IsChild && CanUse(DEKU_SHIELD); //hylian shield is not helpful for child
     AdultReflectShield = IsAdult && CanUse(HYLIAN_SHIELD); //Mirror shield can't reflect attacks
     AdultShield        = IsAdult && (CanUse(HYLIAN_SHIELD) || CanUse(MIRROR_SHIELD));
@@ -611,32 +252,59 @@ namespace Logic {
     DungeonCount          = (DekuTreeClear ? 1:0) + (DodongosCavernClear ? 1:0) + (JabuJabusBellyClear ? 1:0) + (ForestTempleClear ? 1:0) + (FireTempleClear ? 1:0) + (WaterTempleClear ? 1:0) + (SpiritTempleClear ? 1:0) + (ShadowTempleClear ? 1:0);
     HasAllStones          = StoneCount == 3;
     HasAllMedallions      = MedallionCount == 6;
-    GregInBridgeLogic     = BridgeRewardOptions.Is(BRIDGE_OPTION_GREG);
-    GregInLacsLogic       = LACSRewardOptions.Is(LACS_OPTION_GREG);
-
-    CanBuildRainbowBridge = Bridge.Is(RAINBOWBRIDGE_OPEN)                                                                         ||
-                           (Bridge.Is(RAINBOWBRIDGE_VANILLA)    && ShadowMedallion && SpiritMedallion && LightArrows)             ||
-                           (Bridge.Is(RAINBOWBRIDGE_STONES)     && StoneCount + (Greg && GregInBridgeLogic ? 1 : 0) >= BridgeStoneCount.Value<uint8_t>())                    ||
-                           (Bridge.Is(RAINBOWBRIDGE_MEDALLIONS) && MedallionCount + (Greg && GregInBridgeLogic ? 1 : 0) >= BridgeMedallionCount.Value<uint8_t>())            ||
-                           (Bridge.Is(RAINBOWBRIDGE_REWARDS)    && StoneCount + MedallionCount + (Greg && GregInBridgeLogic ? 1 : 0) >= BridgeRewardCount.Value<uint8_t>())  ||
-                           (Bridge.Is(RAINBOWBRIDGE_DUNGEONS)   && DungeonCount + (Greg && GregInBridgeLogic ? 1 : 0) >= BridgeDungeonCount.Value<uint8_t>())                ||
-                           (Bridge.Is(RAINBOWBRIDGE_TOKENS)     && GoldSkulltulaTokens >= BridgeTokenCount.Value<uint8_t>()) ||
-                           (Bridge.Is(RAINBOWBRIDGE_GREG)       && Greg);
-
-    CanTriggerLACS = (LACSCondition == LACSCONDITION_VANILLA    && ShadowMedallion && SpiritMedallion)                          ||
-                     (LACSCondition == LACSCONDITION_STONES     && StoneCount + (Greg && GregInLacsLogic ? 1 : 0) >= LACSStoneCount.Value<uint8_t>())                    ||
-                     (LACSCondition == LACSCONDITION_MEDALLIONS && MedallionCount + (Greg && GregInLacsLogic ? 1 : 0) >= LACSMedallionCount.Value<uint8_t>())            ||
-                     (LACSCondition == LACSCONDITION_REWARDS    && StoneCount + MedallionCount + (Greg && GregInLacsLogic ? 1 : 0) >= LACSRewardCount.Value<uint8_t>())  ||
-                     (LACSCondition == LACSCONDITION_DUNGEONS   && DungeonCount + (Greg && GregInLacsLogic ? 1 : 0) >= LACSDungeonCount.Value<uint8_t>())                ||
-                     (LACSCondition == LACSCONDITION_TOKENS     && GoldSkulltulaTokens >= LACSTokenCount.Value<uint8_t>());
-    CanCompleteTriforce = TriforcePieces >= TriforceHuntRequired.Value<uint8_t>();
+    GregInBridgeLogic     = settings->BridgeRewardOptions.Is(BRIDGE_OPTION_GREG);
+    GregInLacsLogic       = settings->LACSRewardOptions.Is(LACS_OPTION_GREG);
+
+    CanBuildRainbowBridge = settings->Bridge.Is(RAINBOWBRIDGE_OPEN)                                                                         ||
+                           (settings->Bridge.Is(RAINBOWBRIDGE_VANILLA)    && ShadowMedallion && SpiritMedallion && LightArrows)             ||
+                           (settings->Bridge.Is(RAINBOWBRIDGE_STONES)     && StoneCount + (Greg && GregInBridgeLogic ? 1 : 0) >= settings->BridgeStoneCount.Value<uint8_t>())                    ||
+                           (settings->Bridge.Is(RAINBOWBRIDGE_MEDALLIONS) && MedallionCount + (Greg && GregInBridgeLogic ? 1 : 0) >= settings->BridgeMedallionCount.Value<uint8_t>())            ||
+                           (settings->Bridge.Is(RAINBOWBRIDGE_REWARDS)    && StoneCount + MedallionCount + (Greg && GregInBridgeLogic ? 1 : 0) >= settings->BridgeRewardCount.Value<uint8_t>())  ||
+                           (settings->Bridge.Is(RAINBOWBRIDGE_DUNGEONS)   && DungeonCount + (Greg && GregInBridgeLogic ? 1 : 0) >= settings->BridgeDungeonCount.Value<uint8_t>())                ||
+                           (settings->Bridge.Is(RAINBOWBRIDGE_TOKENS)     && GoldSkulltulaTokens >= settings->BridgeTokenCount.Value<uint8_t>()) ||
+                           (settings->Bridge.Is(RAINBOWBRIDGE_GREG)       && Greg);
+
+    CanTriggerLACS = (settings->LACSCondition == LACSCONDITION_VANILLA    && ShadowMedallion && SpiritMedallion)                          ||
+                     (settings->LACSCondition == LACSCONDITION_STONES     && StoneCount + (Greg && GregInLacsLogic ? 1 : 0) >= settings->LACSStoneCount.Value<uint8_t>())                    ||
+                     (settings->LACSCondition == LACSCONDITION_MEDALLIONS && MedallionCount + (Greg && GregInLacsLogic ? 1 : 0) >= settings->LACSMedallionCount.Value<uint8_t>())            ||
+                     (settings->LACSCondition == LACSCONDITION_REWARDS    && StoneCount + MedallionCount + (Greg && GregInLacsLogic ? 1 : 0) >= settings->LACSRewardCount.Value<uint8_t>())  ||
+                     (settings->LACSCondition == LACSCONDITION_DUNGEONS   && DungeonCount + (Greg && GregInLacsLogic ? 1 : 0) >= settings->LACSDungeonCount.Value<uint8_t>())                ||
+                     (settings->LACSCondition == LACSCONDITION_TOKENS     && GoldSkulltulaTokens >= settings->LACSTokenCount.Value<uint8_t>());
+    CanCompleteTriforce = TriforcePieces >= settings->TriforceHuntRequired.Value<uint8_t>();
+  }
+
+  //Updates all logic helpers. Should be called whenever a non-helper is changed
+  void Vars::UpdateHelpers() {
+    helperGeneration++;
+    UpdateAgeHelpers();
+  }
+
+  //Updates all logic helpers after only the age or time of day being checked has changed
+  void Vars::UpdateAgeHelpers() {
+    HelperCache& cache = helperCaches[IsChild + IsAdult * 2];
+    if (cache.generation == helperGeneration) {
+      static_cast<LogicHelpers&>(*this) = cache.helpers;
+    } else {
+      CalculateHelpers();
+      cache.helpers = *this;
+      cache.generation = helperGeneration;
+    }
   }
 
-  bool SmallKeys(Key dungeon, uint8_t requiredAmount) {
+  void Vars::SaveLogicState(LogicState& state) const {
+    state = *this;
+  }
+
+  void Vars::RestoreLogicState(const LogicState& state) {
+    static_cast<LogicState&>(*this) = state;
+    helperGeneration++;
+  }
+
+  bool Vars::SmallKeys(Key dungeon, uint8_t requiredAmount) const {
     return SmallKeys(dungeon, requiredAmount, requiredAmount);
   }
 
-  bool SmallKeys(Key dungeon, uint8_t requiredAmountGlitchless, uint8_t requiredAmountGlitched) {
+  bool Vars::SmallKeys(Key dungeon, uint8_t requiredAmountGlitchless, uint8_t requiredAmountGlitched) const {
     switch (dungeon) {
       case FOREST_TEMPLE:
         /*if (IsGlitched && (GetDifficultyValueFromString(GlitchHookshotJump_Boots) >= static_cast<uint8_t>(GlitchDifficulty::INTERMEDIATE) || GetDifficultyValueFromString(GlitchHoverBoost) >= static_cast<uint8_t>(GlitchDifficulty::NOVICE) ||
@@ -698,7 +366,7 @@ namespace Logic {
     }
   }
 
-  bool EventsUpdated() {
+  bool Vars::EventsUpdated() {
 
       if (DekuTreeClearPast        != DekuTreeClear        ||
           GoronRubyPast            != GoronRuby            ||
@@ -729,10 +397,10 @@ namespace Logic {
    }
 
    //Reset All Logic to false
-   void LogicReset() {
+   void Vars::LogicReset() {
      //Settings-dependent variables
-     IsKeysanity = Keysanity.Is(KEYSANITY_ANYWHERE) || Keysanity.Is(KEYSANITY_OVERWORLD) || Keysanity.Is(KEYSANITY_ANY_DUNGEON);
-     AmmoCanDrop = AmmoDrops.IsNot(AMMODROPS_NONE);
+     IsKeysanity = settings->Keysanity.Is(KEYSANITY_ANYWHERE) || settings->Keysanity.Is(KEYSANITY_OVERWORLD) || settings->Keysanity.Is(KEYSANITY_ANY_DUNGEON);
+     AmmoCanDrop = settings->AmmoDrops.IsNot(AMMODROPS_NONE);
 
      //Child item logic
      KokiriSword   = false;
@@ -858,7 +526,7 @@ namespace Logic {
      //Keys
      ForestTempleKeys          = 0;
      //If not keysanity, start with 1 logical key to account for automatically unlocking the basement door in vanilla FiT
-     FireTempleKeys            = IsKeysanity || Dungeon::FireTemple.IsMQ() ? 0 : 1;
+     FireTempleKeys            = IsKeysanity || world->dungeons.FireTemple.IsMQ() ? 0 : 1;
      WaterTempleKeys           = 0;
      SpiritTempleKeys          = 0;
      ShadowTempleKeys          = 0;
@@ -968,7 +636,7 @@ namespace Logic {
      HasBoots         = false;
      IsChild          = false;
      IsAdult          = false;
-     IsGlitched       = Settings::Logic.Is(LOGIC_GLITCHED);
+     IsGlitched       = settings->Logic.Is(LOGIC_GLITCHED);
      CanBlastOrSmash  = false;
      CanChildAttack   = false;
      CanChildDamage   = false;
@@ -986,9 +654,9 @@ namespace Logic {
      BigPoeKill          = false;
      HookshotOrBoomerang = false;
 
-     BaseHearts      = StartingHearts.Value<uint8_t>() + 1;
+     BaseHearts      = settings->StartingHearts.Value<uint8_t>() + 1;
      Hearts          = 0;
-     Multiplier      = (DamageMultiplier.Value<uint8_t>() < 6) ? DamageMultiplier.Value<uint8_t>() : 10;
+     Multiplier      = (settings->DamageMultiplier.Value<uint8_t>() < 6) ? settings->DamageMultiplier.Value<uint8_t>() : 10;
      EffectiveHealth = 0;
      FireTimer       = 0;
      WaterTimer      = 0;
@@ -1020,7 +688,7 @@ namespace Logic {
      //Other
      AtDay         = false;
      AtNight       = false;
-     Age           = Settings::ResolvedStartingAge;
+     Age           = settings->ResolvedStartingAge;
 
      //Events
      ShowedMidoSwordAndShield  = false;
@@ -1063,5 +731,11 @@ namespace Logic {
      LightTrialClearPast      = false;
      BuyDekuShieldPast        = false;
      TimeTravelPast           = false;
+
+     helperGeneration++;
    }
 }
+
+static Logic::Vars mainLogic;
+
+thread_local constinit Logic::Vars* logic = &mainLogic;
@@ -1,352 +1,11 @@
 #pragma once
 
 #include "keys.hpp"
+#include <array>
+#include <bitset>
 #include <cstdint>
 
 namespace Logic {
-extern bool noVariable;
-
-// Child item logic
-extern bool KokiriSword;
-extern bool Slingshot;
-extern bool ZeldasLetter;
-extern bool WeirdEgg;
-extern bool HasBottle;
-extern bool BombBag;
-extern bool Bombchus;
-extern bool Bombchus5;
-extern bool Bombchus10;
-extern bool Bombchus20;
-extern bool MagicBean;
-extern bool MagicBeanPack;
-extern bool RutosLetter;
-extern bool Boomerang;
-extern bool DinsFire;
-extern bool FaroresWind;
-extern bool NayrusLove;
-extern bool LensOfTruth;
-extern bool ShardOfAgony;
-extern bool SkullMask;
-extern bool MaskOfTruth;
-
-// Adult logic
-extern bool Bow;
-extern bool Hammer;
-extern bool IronBoots;
-extern bool HoverBoots;
-extern bool MirrorShield;
-extern bool GoronTunic;
-extern bool ZoraTunic;
-extern bool Epona;
-extern bool BigPoe;
-extern bool GerudoToken;
-extern bool FireArrows;
-extern bool IceArrows;
-extern bool LightArrows;
-extern bool MasterSword;
-extern bool BiggoronSword;
-
-// Trade Quest
-extern bool PocketEgg;
-extern bool Cojiro;
-extern bool OddMushroom;
-extern bool OddPoultice;
-extern bool PoachersSaw;
-extern bool BrokenSword;
-extern bool Prescription;
-extern bool EyeballFrog;
-extern bool Eyedrops;
-extern bool ClaimCheck;
-
-// Trade Quest Events
-extern bool WakeUpAdultTalon;
-extern bool CojiroAccess;
-extern bool OddMushroomAccess;
-extern bool OddPoulticeAccess;
-extern bool PoachersSawAccess;
-extern bool BrokenSwordAccess;
-extern bool PrescriptionAccess;
-extern bool EyeballFrogAccess;
-extern bool EyedropsAccess;
-extern bool DisableTradeRevert;
-
-// Songs
-extern bool ZeldasLullaby;
-extern bool SariasSong;
-extern bool SunsSong;
-extern bool SongOfStorms;
-extern bool EponasSong;
-extern bool SongOfTime;
-extern bool MinuetOfForest;
-extern bool BoleroOfFire;
-extern bool SerenadeOfWater;
-extern bool RequiemOfSpirit;
-extern bool NocturneOfShadow;
-extern bool PreludeOfLight;
-
-// Stones and Meddallions
-extern bool ForestMedallion;
-extern bool FireMedallion;
-extern bool WaterMedallion;
-extern bool SpiritMedallion;
-extern bool ShadowMedallion;
-extern bool LightMedallion;
-extern bool KokiriEmerald;
-extern bool GoronRuby;
-extern bool ZoraSapphire;
-
-// Dungeon Clears
-extern bool DekuTreeClear;
-extern bool DodongosCavernClear;
-extern bool JabuJabusBellyClear;
-extern bool ForestTempleClear;
-extern bool FireTempleClear;
-extern bool WaterTempleClear;
-extern bool SpiritTempleClear;
-extern bool ShadowTempleClear;
-
-// Trial Clears
-extern bool ForestTrialClear;
-extern bool FireTrialClear;
-extern bool WaterTrialClear;
-extern bool SpiritTrialClear;
-extern bool ShadowTrialClear;
-extern bool LightTrialClear;
-
-//Greg
-extern bool Greg;
-extern bool GregInBridgeLogic;
-extern bool GregInLacsLogic;
-
-// Progression Items
-extern uint8_t ProgressiveBulletBag;
-extern uint8_t ProgressiveBombBag;
-extern uint8_t ProgressiveScale;
-extern uint8_t ProgressiveHookshot;
-extern uint8_t ProgressiveBow;
-extern uint8_t ProgressiveStrength;
-extern uint8_t ProgressiveWallet;
-extern uint8_t ProgressiveMagic;
-extern uint8_t ProgressiveOcarina;
-extern uint8_t ProgressiveGiantKnife;
-
-// Keysanity
-extern bool IsKeysanity;
-
-// Keys
-extern uint8_t ForestTempleKeys;
-extern uint8_t FireTempleKeys;
-extern uint8_t WaterTempleKeys;
-extern uint8_t SpiritTempleKeys;
-extern uint8_t ShadowTempleKeys;
-extern uint8_t BottomOfTheWellKeys;
-extern uint8_t GerudoTrainingGroundsKeys;
-extern uint8_t GerudoFortressKeys;
-extern uint8_t GanonsCastleKeys;
-extern uint8_t TreasureGameKeys;
-
-// Triforce Pieces
-extern uint8_t TriforcePieces;
-
-// Boss Keys
-extern bool BossKeyForestTemple;
-extern bool BossKeyFireTemple;
-extern bool BossKeyWaterTemple;
-extern bool BossKeySpiritTemple;
-extern bool BossKeyShadowTemple;
-extern bool BossKeyGanonsCastle;
-
-// Gold Skulltula Count
-extern uint8_t GoldSkulltulaTokens;
-
-// Bottle Count, with and without Ruto's Letter
-extern uint8_t Bottles;
-extern uint8_t NumBottles;
-extern bool NoBottles;
-
-// item and bottle drops
-extern bool DekuNutDrop;
-extern bool NutPot;
-extern bool NutCrate;
-extern bool DekuBabaNuts;
-extern bool DekuStickDrop;
-extern bool StickPot;
-extern bool DekuBabaSticks;
-extern bool BugsAccess;
-extern bool BugShrub;
-extern bool WanderingBugs;
-extern bool BugRock;
-extern bool BlueFireAccess;
-extern bool FishAccess;
-extern bool FishGroup;
-extern bool LoneFish;
-extern bool FairyAccess;
-extern bool GossipStoneFairy;
-extern bool BeanPlantFairy;
-extern bool ButterflyFairy;
-extern bool FairyPot;
-extern bool FreeFairies;
-extern bool FairyPond;
-extern bool BombchuDrop;
-
-extern bool BuyBombchus10;
-extern bool BuyBombchus20;
-extern bool BuyArrow;
-extern bool BuyBomb;
-extern bool BuyGPotion;
-extern bool BuyBPotion;
-extern bool BuySeed;
-extern bool MagicRefill;
-
-extern uint8_t PieceOfHeart;
-extern uint8_t HeartContainer;
-extern bool DoubleDefense;
-
-/* --- HELPERS --- */
-/* These are used to simplify reading the logic, but need to be updated
-/  every time a base value is updated.                       */
-
-extern bool Ocarina;
-extern bool OcarinaOfTime;
-extern bool MagicMeter;
-extern bool Hookshot;
-extern bool Longshot;
-extern bool GoronBracelet;
-extern bool SilverGauntlets;
-extern bool GoldenGauntlets;
-extern bool SilverScale;
-extern bool GoldScale;
-extern bool AdultsWallet;
-
-extern bool ChildScarecrow;
-extern bool AdultScarecrow;
-extern bool ScarecrowSong;
-extern bool Scarecrow;
-extern bool DistantScarecrow;
-
-extern bool Bombs;
-extern bool DekuShield;
-extern bool HylianShield;
-extern bool Nuts;
-extern bool Sticks;
-extern bool Bugs;
-extern bool BlueFire;
-extern bool Fish;
-extern bool Fairy;
-extern bool BottleWithBigPoe;
-
-extern bool Bombs;
-extern bool FoundBombchus;
-extern bool CanPlayBowling;
-extern bool HasBombchus;
-extern bool HasExplosives;
-extern bool HasBoots;
-extern bool IsChild;
-extern bool IsAdult;
-extern bool IsGlitched;
-extern bool CanBlastOrSmash;
-extern bool CanChildAttack;
-extern bool CanChildDamage;
-extern bool CanAdultAttack;
-extern bool CanAdultDamage;
-extern bool CanCutShrubs;
-extern bool CanDive;
-extern bool CanLeaveForest;
-extern bool CanPlantBugs;
-extern bool CanRideEpona;
-extern bool CanStunDeku;
-extern bool CanSummonGossipFairy;
-extern bool CanSummonGossipFairyWithoutSuns;
-extern bool NeedNayrusLove;
-extern bool CanSurviveDamage;
-extern bool CanTakeDamage;
-extern bool CanTakeDamageTwice;
-// extern bool CanPlantBean;
-extern bool CanOpenBombGrotto;
-extern bool CanOpenStormGrotto;
-extern bool HookshotOrBoomerang;
-extern bool CanGetNightTimeGS;
-extern bool BigPoeKill;
-
-extern uint8_t BaseHearts;
-extern uint8_t Hearts;
-extern uint8_t Multiplier;
-extern uint8_t EffectiveHealth;
-extern uint8_t FireTimer;
-extern uint8_t WaterTimer;
-
-extern bool GuaranteeTradePath;
-extern bool GuaranteeHint;
-extern bool HasFireSource;
-extern bool HasFireSourceWithTorch;
-
-// Gerudo Fortress
-extern bool CanFinishGerudoFortress;
-
-extern bool HasShield;
-extern bool CanShield;
-extern bool ChildShield;
-extern bool AdultReflectShield;
-extern bool AdultShield;
-extern bool CanShieldFlick;
-extern bool CanJumpslash;
-extern bool CanUseProjectile;
-extern bool CanUseMagicArrow;
-
-// Bridge Requirements
-extern bool HasAllStones;
-extern bool HasAllMedallions;
-extern bool CanBuildRainbowBridge;
-extern bool BuiltRainbowBridge;
-extern bool CanTriggerLACS;
-
-// Other
-extern bool AtDay;
-extern bool AtNight;
-extern bool LinksCow;
-extern uint8_t Age;
-extern bool CanCompleteTriforce;
-
-// Events
-extern bool ShowedMidoSwordAndShield;
-extern bool CarpenterRescue;
-extern bool DampesWindmillAccess;
-extern bool GF_GateOpen;
-extern bool GtG_GateOpen;
-extern bool DrainWell;
-extern bool GoronCityChildFire;
-extern bool GCWoodsWarpOpen;
-extern bool GCDaruniasDoorOpenChild;
-extern bool StopGCRollingGoronAsAdult;
-extern bool WaterTempleLow;
-extern bool WaterTempleMiddle;
-extern bool WaterTempleHigh;
-extern bool KingZoraThawed;
-extern bool AtDampeTime;
-extern bool DeliverLetter;
-extern bool KakarikoVillageGateOpen;
-extern bool ForestTempleJoelle;
-extern bool ForestTempleBeth;
-extern bool ForestTempleJoAndBeth;
-extern bool ForestTempleAmy;
-extern bool ForestTempleMeg;
-extern bool ForestTempleAmyAndMeg;
-extern bool FireLoopSwitch;
-extern bool TimeTravel;
-
-/* --- END OF HELPERS --- */
-
-extern uint8_t AddedProgressiveBulletBags;
-extern uint8_t AddedProgressiveBombBags;
-extern uint8_t AddedProgressiveMagics;
-extern uint8_t AddedProgressiveScales;
-extern uint8_t AddedProgressiveHookshots;
-extern uint8_t AddedProgressiveBows;
-extern uint8_t AddedProgressiveWallets;
-extern uint8_t AddedProgressiveStrengths;
-extern uint8_t AddedProgressiveOcarinas;
-extern uint8_t TokensInPool;
-
 enum class HasProjectileAge {
     Adult,
     Child,
@@ -367,13 +26,437 @@ enum class GlitchDifficulty {
     HERO,
 };
 
-void UpdateHelpers();
-bool CanPlay(bool song);
-bool CanUse(uint32_t itemName);
-bool HasProjectile(HasProjectileAge age);
-bool SmallKeys(Key dungeon, uint8_t requiredAmount);
-bool SmallKeys(Key dungeon, uint8_t requiredAmountGlitchless, uint8_t requiredAmountGlitched);
-bool CanDoGlitch(GlitchType glitch);
-bool EventsUpdated();
-void LogicReset();
-} // namespace Logic
\ No newline at end of file
+//Helpers simplify reading the logic, but need to be updated every time a base value is updated. Everything
+//UpdateHelpers calculates is declared here, and this is what gets cached and copied back.
+struct LogicHelpers {
+    //Items and trade items
+    bool HasBottle     = false;
+    bool BiggoronSword = false;
+    bool PocketEgg     = false;
+    bool Cojiro        = false;
+    bool OddMushroom   = false;
+    bool OddPoultice   = false;
+    bool PoachersSaw   = false;
+    bool BrokenSword   = false;
+    bool Prescription  = false;
+    bool EyeballFrog   = false;
+    bool Eyedrops      = false;
+    bool GregInBridgeLogic = false;
+    bool GregInLacsLogic = false;
+
+    //Bottle Count
+    uint8_t   NumBottles = 0;
+
+    //Drops and Bottle Contents Access
+    bool DekuNutDrop      = false;
+    bool DekuStickDrop    = false;
+    bool BugsAccess       = false;
+    bool FishAccess       = false;
+    bool FairyAccess      = false;
+
+    bool Slingshot        = false;
+    bool Ocarina          = false;
+    bool OcarinaOfTime    = false;
+    bool BombBag          = false;
+    bool MagicMeter       = false;
+    bool Hookshot         = false;
+    bool Longshot         = false;
+    bool Bow              = false;
+    bool GoronBracelet    = false;
+    bool SilverGauntlets  = false;
+    bool GoldenGauntlets  = false;
+    bool SilverScale      = false;
+    bool GoldScale        = false;
+    bool AdultsWallet     = false;
+
+    bool ScarecrowSong    = false;
+    bool Scarecrow        = false;
+    bool DistantScarecrow = false;
+
+    bool Bombs            = false;
+    bool Nuts             = false;
+    bool Sticks           = false;
+    bool Bugs             = false;
+    bool BlueFire         = false;
+    bool Fish             = false;
+    bool Fairy            = false;
+
+    bool FoundBombchus    = false;
+    bool CanPlayBowling   = false;
+    bool HasBombchus      = false;
+    bool HasExplosives    = false;
+    bool HasBoots         = false;
+    bool CanBlastOrSmash  = false;
+    bool CanChildAttack   = false;
+    bool CanChildDamage   = false;
+    bool CanAdultAttack   = false;
+    bool CanAdultDamage   = false;
+    bool CanCutShrubs     = false;
+    bool CanDive          = false;
+    bool CanLeaveForest   = false;
+    bool CanPlantBugs     = false;
+    bool CanRideEpona     = false;
+    bool CanStunDeku      = false;
+    bool CanSummonGossipFairy = false;
+    bool CanSummonGossipFairyWithoutSuns = false;
+    bool NeedNayrusLove      = false;
+    bool CanSurviveDamage    = false;
+    bool CanTakeDamage       = false;
+    bool CanTakeDamageTwice  = false;
+    bool CanOpenBombGrotto   = false;
+    bool CanOpenStormGrotto  = false;
+    bool HookshotOrBoomerang = false;
+    bool CanGetNightTimeGS   = false;
+
+    uint8_t   Hearts          = 0;
+    uint8_t   EffectiveHealth = 0;
+    uint8_t   FireTimer       = 0;
+    uint8_t   WaterTimer      = 0;
+
+    bool GuaranteeTradePath     = false;
+    bool HasFireSource          = false;
+    bool HasFireSourceWithTorch = false;
+
+    bool CanFinishGerudoFortress = false;
+
+    bool HasShield          = false;
+    bool CanShield          = false;
+    bool ChildShield        = false;
+    bool AdultReflectShield = false;
+    bool AdultShield        = false;
+    bool CanShieldFlick     = false;
+    bool CanJumpslash       = false;
+    bool CanUseProjectile   = false;
+    bool CanUseMagicArrow   = false;
+
+    //Bridge and LACS Requirements
+    uint8_t StoneCount              = 0;
+    uint8_t MedallionCount          = 0;
+    uint8_t DungeonCount            = 0;
+    bool HasAllStones          = false;
+    bool HasAllMedallions      = false;
+    bool CanBuildRainbowBridge = false;
+    bool CanTriggerLACS        = false;
+
+    //Other
+    bool CanCompleteTriforce = false;
+};
+
+//The helpers calculated for each combination of IsChild and IsAdult since the logic last changed.
+//Conditions are checked at every age and time of day an area has, and only IsChild and IsAdult
+//matter to the helpers, so most checks can copy them back instead of calculating them again.
+struct HelperCache {
+    uint64_t generation = 0;
+    LogicHelpers helpers;
+};
+
+//Every item, event and helper the access conditions check. Saving the logic and later restoring it is much
+//cheaper than resetting it and applying every item and event again, and whatever is declared here is saved with it.
+struct LogicState : LogicHelpers {
+    bool noVariable    = false;
+
+    //Child item logic
+    bool KokiriSword   = false;
+    bool ZeldasLetter  = false;
+    bool WeirdEgg      = false;
+    bool Bombchus      = false;
+    bool Bombchus5     = false;
+    bool Bombchus10    = false;
+    bool Bombchus20    = false;
+    bool MagicBean     = false;
+    bool MagicBeanPack = false;
+    bool RutosLetter   = false;
+    bool Boomerang     = false;
+    bool DinsFire      = false;
+    bool FaroresWind   = false;
+    bool NayrusLove    = false;
+    bool LensOfTruth   = false;
+    bool ShardOfAgony  = false;
+    bool SkullMask     = false;
+    bool MaskOfTruth   = false;
+
+    //Adult logic
+    bool Hammer        = false;
+    bool IronBoots     = false;
+    bool HoverBoots    = false;
+    bool MirrorShield  = false;
+    bool GoronTunic    = false;
+    bool ZoraTunic     = false;
+    bool Epona         = false;
+    bool BigPoe        = false;
+    bool GerudoToken   = false;
+    bool FireArrows    = false;
+    bool IceArrows     = false;
+    bool LightArrows   = false;
+    bool MasterSword   = false;
+
+    //Trade Quest
+    bool ClaimCheck    = false;
+
+    //Trade Quest Events
+    bool WakeUpAdultTalon   = false;
+    bool CojiroAccess       = false;
+    bool OddMushroomAccess  = false;
+    bool OddPoulticeAccess  = false;
+    bool PoachersSawAccess  = false;
+    bool BrokenSwordAccess  = false;
+    bool PrescriptionAccess = false;
+    bool EyeballFrogAccess  = false;
+    bool EyedropsAccess     = false;
+    bool DisableTradeRevert = false;
+
+    //Songs
+    bool ZeldasLullaby    = false;
+    bool SariasSong       = false;
+    bool SunsSong         = false;
+    bool SongOfStorms     = false;
+    bool EponasSong       = false;
+    bool SongOfTime       = false;
+    bool MinuetOfForest   = false;
+    bool BoleroOfFire     = false;
+    bool SerenadeOfWater  = false;
+    bool RequiemOfSpirit  = false;
+    bool NocturneOfShadow = false;
+    bool PreludeOfLight   = false;
+
+    //Stones and Meddallions
+    bool ForestMedallion = false;
+    bool FireMedallion   = false;
+    bool WaterMedallion  = false;
+    bool SpiritMedallion = false;
+    bool ShadowMedallion = false;
+    bool LightMedallion  = false;
+    bool KokiriEmerald   = false;
+    bool GoronRuby       = false;
+    bool ZoraSapphire    = false;
+
+    //Dungeon Clears
+    bool DekuTreeClear       = false;
+    bool DodongosCavernClear = false;
+    bool JabuJabusBellyClear = false;
+    bool ForestTempleClear   = false;
+    bool FireTempleClear     = false;
+    bool WaterTempleClear    = false;
+    bool SpiritTempleClear   = false;
+    bool ShadowTempleClear   = false;
+
+    //Trial Clears
+    bool ForestTrialClear = false;
+    bool FireTrialClear   = false;
+    bool WaterTrialClear  = false;
+    bool SpiritTrialClear = false;
+    bool ShadowTrialClear = false;
+    bool LightTrialClear  = false;
+
+    //Greg
+    bool Greg = false;
+
+    //Progressive Items
+    uint8_t ProgressiveBulletBag  = 0;
+    uint8_t ProgressiveBombBag    = 0;
+    uint8_t ProgressiveMagic      = 0;
+    uint8_t ProgressiveScale      = 0;
+    uint8_t ProgressiveHookshot   = 0;
+    uint8_t ProgressiveBow        = 0;
+    uint8_t ProgressiveWallet     = 0;
+    uint8_t ProgressiveStrength   = 0;
+    uint8_t ProgressiveOcarina    = 0;
+    uint8_t ProgressiveGiantKnife = 0;
+
+    //Logical keysanity
+    bool IsKeysanity = false;
+
+    //Keys
+    uint8_t ForestTempleKeys          = 0;
+    uint8_t FireTempleKeys            = 0;
+    uint8_t WaterTempleKeys           = 0;
+    uint8_t SpiritTempleKeys          = 0;
+    uint8_t ShadowTempleKeys          = 0;
+    uint8_t GanonsCastleKeys          = 0;
+    uint8_t GerudoFortressKeys        = 0;
+    uint8_t GerudoTrainingGroundsKeys = 0;
+    uint8_t BottomOfTheWellKeys       = 0;
+    uint8_t TreasureGameKeys          = 0;
+
+    //Triforce Pieces
+    uint8_t TriforcePieces = 0;
+
+    //Boss Keys
+    bool BossKeyForestTemple = false;
+    bool BossKeyFireTemple   = false;
+    bool BossKeyWaterTemple  = false;
+    bool BossKeySpiritTemple = false;
+    bool BossKeyShadowTemple = false;
+    bool BossKeyGanonsCastle = false;
+
+    //Gold Skulltula Count
+    uint8_t GoldSkulltulaTokens = 0;
+
+    //Bottle Count
+    uint8_t   Bottles    = 0;
+    bool NoBottles  = false;
+
+    //Drops and Bottle Contents Access
+    bool NutPot           = false;
+    bool NutCrate         = false;
+    bool DekuBabaNuts     = false;
+    bool StickPot         = false;
+    bool DekuBabaSticks   = false;
+    bool BugShrub         = false;
+    bool WanderingBugs    = false;
+    bool BugRock          = false;
+    bool BlueFireAccess   = false;
+    bool FishGroup        = false;
+    bool LoneFish         = false;
+    bool GossipStoneFairy = false;
+    bool BeanPlantFairy   = false;
+    bool ButterflyFairy   = false;
+    bool FairyPot         = false;
+    bool FreeFairies      = false;
+    bool FairyPond        = false;
+    bool BombchuDrop      = false;
+    bool AmmoCanDrop      = false;
+
+    bool BuyBombchus10    = false;
+    bool BuyBombchus20    = false;
+    bool BuySeed          = false;
+    bool BuyArrow         = false;
+    bool BuyBomb          = false;
+    bool BuyGPotion       = false;
+    bool BuyBPotion       = false;
+    bool MagicRefill      = false;
+
+    uint8_t   PieceOfHeart     = 0;
+    uint8_t   HeartContainer   = 0;
+    bool DoubleDefense    = false;
+
+    /* --- EVENTS AND LOCATION ACCESS --- */
+
+    bool ChildScarecrow   = false;
+    bool AdultScarecrow   = false;
+
+    bool DekuShield       = false;
+    bool HylianShield     = false;
+    bool BottleWithBigPoe = false;
+
+    bool IsChild          = false;
+    bool IsAdult          = false;
+    bool IsGlitched       = false;
+    //bool CanPlantBean        = false;
+    bool BigPoeKill          = false;
+
+    uint8_t   BaseHearts      = 0;
+    uint8_t   Multiplier      = 0;
+
+    bool GuaranteeHint          = false;
+
+    //Bridge and LACS Requirements
+    bool BuiltRainbowBridge    = false;
+
+    //Other
+    bool AtDay         = false;
+    bool AtNight       = false;
+    uint8_t Age             = 0;
+
+    //Events
+    bool ShowedMidoSwordAndShield  = false;
+    bool CarpenterRescue           = false;
+    bool GF_GateOpen               = false;
+    bool GtG_GateOpen              = false;
+    bool DampesWindmillAccess      = false;
+    bool DrainWell                 = false;
+    bool GoronCityChildFire        = false;
+    bool GCWoodsWarpOpen           = false;
+    bool GCDaruniasDoorOpenChild   = false;
+    bool StopGCRollingGoronAsAdult = false;
+    bool WaterTempleLow            = false;
+    bool WaterTempleMiddle         = false;
+    bool WaterTempleHigh           = false;
+    bool KakarikoVillageGateOpen   = false;
+    bool KingZoraThawed            = false;
+    bool ForestTempleJoelle        = false;
+    bool ForestTempleBeth          = false;
+    bool ForestTempleJoAndBeth     = false;
+    bool ForestTempleAmy           = false;
+    bool ForestTempleMeg           = false;
+    bool ForestTempleAmyAndMeg     = false;
+    bool FireLoopSwitch            = false;
+    bool LinksCow                  = false;
+    bool AtDampeTime               = false;
+    bool DeliverLetter             = false;
+    bool TimeTravel                = false;
+
+    /* --- END OF HELPERS AND LOCATION ACCESS --- */
+
+    //Placement Tracking
+    uint8_t AddedProgressiveBulletBags = 0;
+    uint8_t AddedProgressiveBombBags   = 0;
+    uint8_t AddedProgressiveMagics     = 0;
+    uint8_t AddedProgressiveScales     = 0;
+    uint8_t AddedProgressiveHookshots  = 0;
+    uint8_t AddedProgressiveBows       = 0;
+    uint8_t AddedProgressiveWallets    = 0;
+    uint8_t AddedProgressiveStrengths  = 0;
+    uint8_t AddedProgressiveOcarinas   = 0;
+    uint8_t TokensInPool               = 0;
+
+    //Event checking past
+    bool DrainWellPast            = false;
+    bool DampesWindmillAccessPast = false;
+    bool DekuTreeClearPast        = false;
+    bool GoronRubyPast            = false;
+    bool ZoraSapphirePast         = false;
+    bool ForestTrialClearPast     = false;
+    bool FireTrialClearPast       = false;
+    bool WaterTrialClearPast      = false;
+    bool SpiritTrialClearPast     = false;
+    bool ShadowTrialClearPast     = false;
+    bool LightTrialClearPast      = false;
+    bool BuyDekuShieldPast        = false;
+    bool TimeTravelPast           = false;
+};
+
+//Which ages and times of day a search has reached an area at, and whether it has added the area to its pool
+struct AreaAccess {
+    bool childDay    = false;
+    bool childNight  = false;
+    bool adultDay    = false;
+    bool adultNight  = false;
+    bool addedToPool = false;
+};
+
+//The logic of a generation and the helpers cached for it. Each generation has its own, and the conditions read
+//the one installed in the logic pointer below.
+struct Vars : LogicState {
+    std::array<HelperCache, 4> helperCaches;
+    uint64_t helperGeneration = 1;
+
+    //How far the current search has got. It's kept here instead of in the world so that several searches can share
+    //one world, each with its own logic.
+    std::array<AreaAccess, KEY_ENUM_MAX> areaAccess = {};
+    std::bitset<KEY_ENUM_MAX> locationsInPool;
+    //Locations the search treats as empty, to check if the game can be beaten without their items
+    std::bitset<KEY_ENUM_MAX> emptiedLocations;
+    bool playthroughBeatable = false;
+
+    void UpdateHelpers();
+    void UpdateAgeHelpers();
+    void SaveLogicState(LogicState& state) const;
+    void RestoreLogicState(const LogicState& state);
+    bool CanPlay(bool song) const;
+    bool CanUse(uint32_t itemName) const;
+    bool HasProjectile(HasProjectileAge age) const;
+    bool SmallKeys(Key dungeon, uint8_t requiredAmount) const;
+    bool SmallKeys(Key dungeon, uint8_t requiredAmountGlitchless, uint8_t requiredAmountGlitched) const;
+    bool CanDoGlitch(GlitchType glitch) const;
+    bool EventsUpdated();
+    void LogicReset();
+
+  private:
+    bool HasItem(uint32_t itemName) const;
+    bool CanEquipSwap(uint32_t itemName) const;
+    void CalculateHelpers();
+};
+} // namespace Logic
+
+extern thread_local constinit Logic::Vars* logic;
@@ -23,8 +23,8 @@ Option* currentSetting;
 } // namespace
 
 static void RestoreOverrides() {
-    if (Settings::Logic.Is(LOGIC_VANILLA)) {
-        for (auto overridePair : Settings::vanillaLogicOverrides) {
+    if (settings->Logic.Is(LOGIC_VANILLA)) {
+        for (auto overridePair : settings->vanillaLogicOverrides) {
             overridePair.first->RestoreDelayedOption();
         }
     }
@@ -50,11 +50,11 @@ std::string GenerateRandomizer(std::unordered_map<RandomizerSettingKey, uint8_t>
         return "";
     }
 
-    Settings::seedString = seedString;
-    uint32_t seedHash = boost::hash_32<std::string>{}(Settings::seedString);
-    Settings::seed = seedHash & 0xFFFFFFFF;
+    settings->seedString = seedString;
+    uint32_t seedHash = boost::hash_32<std::string>{}(settings->seedString);
+    settings->seed = seedHash & 0xFFFFFFFF;
 
-    int ret = Playthrough::Playthrough_Init(Settings::seed, cvarSettings, excludedLocations, enabledTricks);
+    int ret = Playthrough::Playthrough_Init(settings->seed, cvarSettings, excludedLocations, enabledTricks);
     if (ret < 0) {
         if (ret == -1) { // Failed to generate after 5 tries
             printf("\n\nFailed to generate after 5 tries.\nPress B to go back to the menu.\nA different seed might be "
@@ -72,14 +72,14 @@ std::string GenerateRandomizer(std::unordered_map<RandomizerSettingKey, uint8_t>
     RestoreOverrides();
 
     std::ostringstream fileNameStream;
-    for (int i = 0; i < Settings::hashIconIndexes.size(); i++) {
+    for (int i = 0; i < settings->hashIconIndexes.size(); i++) {
         if (i) {
             fileNameStream << '-';
         }
-        if (Settings::hashIconIndexes[i] < 10) {
+        if (settings->hashIconIndexes[i] < 10) {
             fileNameStream << '0';
         }
-        fileNameStream << std::to_string(Settings::hashIconIndexes[i]);
+        fileNameStream << std::to_string(settings->hashIconIndexes[i]);
     }
     std::string fileName = fileNameStream.str();
     return "./Randomizer/" + fileName + ".json";
@@ -1,34 +1,42 @@
 #include "playthrough.hpp"
+#include "world.hpp"
 
-#include <libultraship/libultraship.h>
 #include <boost_custom/container_hash/hash_32.hpp>
 #include "custom_messages.hpp"
 #include "fill.hpp"
+#include "fill_profiler.hpp"
 #include "location_access.hpp"
 #include "logic.hpp"
 #include "random.hpp"
 #include "spoiler_log.hpp"
+#include "utils.hpp"
 #include "soh/Enhancements/randomizer/randomizerTypes.h"
+
+#ifndef RANDOMIZER_HEADLESS
+#include <libultraship/libultraship.h>
 #include "variables.h"
 #include "soh/OTRGlobals.h"
+#endif
 
 namespace Playthrough {
 
 int Playthrough_Init(uint32_t seed, std::unordered_map<RandomizerSettingKey, uint8_t> cvarSettings, std::set<RandomizerCheck> excludedLocations, std::set<RandomizerTrick> enabledTricks) {
+    FillProfiler::Reset();
+
     // initialize the RNG with just the seed incase any settings need to be
     // resolved to something random
     Random_Init(seed);
 
-    overrides.clear();
+    world->overrides.clear();
     CustomMessages::ClearMessages();
     ItemReset();
     HintReset();
     Areas::AccessReset();
 
-    Settings::UpdateSettings(cvarSettings, excludedLocations, enabledTricks);
+    settings->UpdateSettings(cvarSettings, excludedLocations, enabledTricks);
     // once the settings have been finalized turn them into a string for hashing
     std::string settingsStr;
-    for (Menu* menu : Settings::GetAllOptionMenus()) {
+    for (Menu* menu : settings->GetAllOptionMenus()) {
         // don't go through non-menus
         if (menu->mode != OPTION_SUB_MENU) {
             continue;
@@ -42,20 +50,23 @@ int Playthrough_Init(uint32_t seed, std::unordered_map<RandomizerSettingKey, uin
         }
     }
 
+#ifndef RANDOMIZER_HEADLESS
+    // the headless generator has no console variables to read
     if (CVarGetInteger(CVAR_RANDOMIZER_SETTING("DontGenerateSpoiler"), 0)) {
         settingsStr += (char*)gBuildVersion;
     }
+#endif
 
-    uint32_t finalHash = boost::hash_32<std::string>{}(std::to_string(Settings::seed) + settingsStr);
+    uint32_t finalHash = boost::hash_32<std::string>{}(std::to_string(settings->seed) + settingsStr);
     Random_Init(finalHash);
-    Settings::hash = std::to_string(finalHash);
+    settings->hash = std::to_string(finalHash);
 
-    Logic::UpdateHelpers();
+    logic->UpdateHelpers();
 
-    if (Settings::Logic.Is(LOGIC_VANILLA)) {
-        VanillaFill(); // Just place items in their vanilla locations
+    if (settings->Logic.Is(LOGIC_VANILLA)) {
+        VanillaFill(*world); // Just place items in their vanilla locations
     } else {           // Fill locations with logic
-        int ret = Fill();
+        int ret = Fill(*world);
         if (ret < 0) {
             return ret;
         }
@@ -64,43 +75,43 @@ int Playthrough_Init(uint32_t seed, std::unordered_map<RandomizerSettingKey, uin
     GenerateHash();
     WriteIngameSpoilerLog();
 
-    if (Settings::GenerateSpoilerLog) {
+    if (settings->GenerateSpoilerLog) {
         // write logs
-        printf("\x1b[11;10HWriting Spoiler Log...");
+        PrintProgress("\x1b[11;10HWriting Spoiler Log...");
         if (SpoilerLog_Write(cvarSettings[RSK_LANGUAGE])) {
-            printf("Done");
+            PrintProgress("Done");
         } else {
-            printf("Failed");
+            PrintProgress("Failed");
         }
 #ifdef ENABLE_DEBUG
-        printf("\x1b[11;10HWriting Placement Log...");
+        PrintProgress("\x1b[11;10HWriting Placement Log...");
         if (PlacementLog_Write()) {
-            printf("Done\n");
+            PrintProgress("Done\n");
         } else {
-            printf("Failed\n");
+            PrintProgress("Failed\n");
         }
 #endif
     }
 
-    playthroughLocations.clear();
-    wothLocations.clear();
-    playthroughBeatable = false;
+    world->playthroughLocations.clear();
+    world->wothLocations.clear();
+    logic->playthroughBeatable = false;
 
     return 1;
 }
 
 // used for generating a lot of seeds at once
 int Playthrough_Repeat(std::unordered_map<RandomizerSettingKey, uint8_t> cvarSettings, std::set<RandomizerCheck> excludedLocations, std::set<RandomizerTrick> enabledTricks, int count /*= 1*/) {
-    printf("\x1b[0;0HGENERATING %d SEEDS", count);
+    PrintProgress("\x1b[0;0HGENERATING %d SEEDS", count);
     uint32_t repeatedSeed = 0;
     for (int i = 0; i < count; i++) {
-        Settings::seedString = std::to_string(rand() % 0xFFFFFFFF);
-        repeatedSeed = boost::hash_32<std::string>{}(Settings::seedString);
-        Settings::seed = repeatedSeed % 0xFFFFFFFF;
+        settings->seedString = std::to_string(rand() % 0xFFFFFFFF);
+        repeatedSeed = boost::hash_32<std::string>{}(settings->seedString);
+        settings->seed = repeatedSeed % 0xFFFFFFFF;
         //CitraPrint("testing seed: " + std::to_string(Settings::seed));
         ClearProgress();
-        Playthrough_Init(Settings::seed, cvarSettings, excludedLocations, enabledTricks);
-        printf("\x1b[15;15HSeeds Generated: %d\n", i + 1);
+        Playthrough_Init(settings->seed, cvarSettings, excludedLocations, enabledTricks);
+        PrintProgress("\x1b[15;15HSeeds Generated: %d\n", i + 1);
     }
 
     return 1;
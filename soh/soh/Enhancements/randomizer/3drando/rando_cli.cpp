@@ -0,0 +1,282 @@
+// Headless batch seed generator.
+//
+// Generates a range of seeds with one set of settings on several threads and
+// reports throughput and per-seed latency, so changes to the fill can be
+// measured without starting the game. Built as the soh-rando-cli target,
+// from the 3drando sources alone, without libultraship or the game.
+// The beatability checks at the end of each fill run on the generating thread
+// unless --check-threads asks for a pool, which all workers share. The workers
+// already keep every core busy, so the CLI doesn't use the game's default pool.
+//
+// The optional settings file is JSON of the form
+//   { "settings": { "Open Settings:Forest": 1, ... },
+//     "excludedLocations": [ "KF Mido Top Left Chest", ... ],
+//     "enabledTricks": [ "Pass Through Visible One-Way Collision", ... ] }
+// naming settings, locations and tricks like the spoiler log does. Setting
+// values are the numeric RO_ option values from randomizerTypes.h. Anything
+// left out uses the same defaults as an empty settings map in game.
+
+#include "fill.hpp"
+#include "fill_profiler.hpp"
+#include "hint_list.hpp"
+#include "item_list.hpp"
+#include "item_location.hpp"
+#include "menu.hpp"
+#include "settings.hpp"
+#include "spoiler_log.hpp"
+#include "utils.hpp"
+#include "world.hpp"
+#include "../randomizer_tricks.h"
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// build.c needs the game headers, so the generator defines the build strings
+// the spoiler log reports itself. CMake fills them in like it does build.c.
+extern "C" const char gBuildVersion[] = RANDO_CLI_BUILD_VERSION;
+extern "C" const char gGitBranch[] = RANDO_CLI_GIT_BRANCH;
+extern "C" const char gGitCommitHash[] = RANDO_CLI_GIT_COMMIT_HASH;
+
+namespace {
+struct CliOptions {
+    std::string settingsPath;
+    uint32_t count = 100;
+    uint32_t firstSeed = 0;
+    uint32_t threads = std::max(1u, std::thread::hardware_concurrency());
+    uint32_t checkThreads = 1;
+    bool writeSpoilers = true;
+    bool profile = false;
+};
+
+struct SeedResult {
+    double milliseconds = 0.0;
+    bool success = false;
+};
+
+void PrintUsage(const char* program) {
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --settings <file>   JSON settings file (see rando_cli.cpp)\n"
+            "  --count <n>         number of seeds to generate (default 100)\n"
+            "  --first-seed <n>    seed string of the first seed, the rest count up from it (default 0)\n"
+            "  --threads <n>       worker threads (default: hardware concurrency)\n"
+            "  --check-threads <n> beatability check threads shared by the workers (default 1)\n"
+            "  --no-spoilers       don't write a spoiler log for every seed\n"
+            "  --profile           write a fill profile for every seed, named like its spoiler log\n",
+            program);
+}
+
+bool ParseUInt(const char* text, uint32_t& out) {
+    char* end = nullptr;
+    unsigned long value = strtoul(text, &end, 10);
+    if (end == text || *end != '\0' || value > UINT32_MAX) {
+        return false;
+    }
+    out = (uint32_t)value;
+    return true;
+}
+
+bool ParseArgs(int argc, char** argv, CliOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--settings") == 0 && hasValue) {
+            options.settingsPath = argv[++i];
+        } else if (strcmp(arg, "--count") == 0 && hasValue) {
+            if (!ParseUInt(argv[++i], options.count)) {
+                return false;
+            }
+        } else if (strcmp(arg, "--first-seed") == 0 && hasValue) {
+            if (!ParseUInt(argv[++i], options.firstSeed)) {
+                return false;
+            }
+        } else if (strcmp(arg, "--threads") == 0 && hasValue) {
+            if (!ParseUInt(argv[++i], options.threads) || options.threads == 0) {
+                return false;
+            }
+        } else if (strcmp(arg, "--check-threads") == 0 && hasValue) {
+            if (!ParseUInt(argv[++i], options.checkThreads)) {
+                return false;
+            }
+        } else if (strcmp(arg, "--no-spoilers") == 0) {
+            options.writeSpoilers = false;
+        } else if (strcmp(arg, "--profile") == 0) {
+            options.profile = true;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The locations by the names the spoiler log gives them. The main thread's world
+// never generates, its location table is only built for the names.
+std::unordered_map<std::string, RandomizerCheck> GetLocationNames() {
+    std::unordered_map<std::string, RandomizerCheck> names;
+    LocationTable_Init();
+    for (uint32_t locKey = 0; locKey < KEY_ENUM_MAX; locKey++) {
+        const ItemLocation* location = Location(locKey);
+        if (location->GetRandomizerCheck() != RC_UNKNOWN_CHECK) {
+            names[RemoveLineBreaks(location->GetName())] = location->GetRandomizerCheck();
+        }
+    }
+    return names;
+}
+
+// The tricks by the names the spoiler log gives them, leaving out the glitches
+// the logic has no options for
+std::unordered_map<std::string, RandomizerTrick> GetTrickNames() {
+    std::unordered_map<std::string, RandomizerTrick> names;
+    for (const auto& [rt, trick] : RandomizerTricks::GetAllRTObjects()) {
+        if (settings->trickOptionMap.contains(rt)) {
+            names[RemoveLineBreaks(trick.rtShortName)] = rt;
+        }
+    }
+    return names;
+}
+
+bool LoadSettings(const std::string& path, std::unordered_map<RandomizerSettingKey, uint8_t>& cvarSettings,
+                  std::set<RandomizerCheck>& excludedLocations, std::set<RandomizerTrick>& enabledTricks) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        fprintf(stderr, "Could not open settings file %s\n", path.c_str());
+        return false;
+    }
+
+    try {
+        nlohmann::json json = nlohmann::json::parse(file);
+        if (json.contains("settings")) {
+            for (auto& [name, value] : json["settings"].items()) {
+                auto setting = SpoilerfileSettingNameToEnum.find(name);
+                if (setting == SpoilerfileSettingNameToEnum.end()) {
+                    fprintf(stderr, "Unknown setting \"%s\"\n", name.c_str());
+                    return false;
+                }
+                cvarSettings[setting->second] = value.get<uint8_t>();
+            }
+        }
+        if (json.contains("excludedLocations")) {
+            const std::unordered_map<std::string, RandomizerCheck> locationNames = GetLocationNames();
+            for (auto& name : json["excludedLocations"]) {
+                auto location = locationNames.find(name.get<std::string>());
+                if (location == locationNames.end()) {
+                    fprintf(stderr, "Unknown location \"%s\"\n", name.get<std::string>().c_str());
+                    return false;
+                }
+                excludedLocations.insert(location->second);
+            }
+        }
+        if (json.contains("enabledTricks")) {
+            const std::unordered_map<std::string, RandomizerTrick> trickNames = GetTrickNames();
+            for (auto& name : json["enabledTricks"]) {
+                auto trick = trickNames.find(name.get<std::string>());
+                if (trick == trickNames.end()) {
+                    fprintf(stderr, "Unknown trick \"%s\"\n", name.get<std::string>().c_str());
+                    return false;
+                }
+                enabledTricks.insert(trick->second);
+            }
+        }
+    } catch (const std::exception& e) {
+        fprintf(stderr, "Could not parse settings file %s: %s\n", path.c_str(), e.what());
+        return false;
+    }
+
+    return true;
+}
+
+// Nearest-rank percentile of an already sorted list
+double Percentile(const std::vector<double>& sorted, double percent) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t rank = (size_t)std::ceil(percent / 100.0 * sorted.size());
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    CliOptions options;
+    if (!ParseArgs(argc, argv, options)) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::unordered_map<RandomizerSettingKey, uint8_t> cvarSettings;
+    std::set<RandomizerCheck> excludedLocations;
+    std::set<RandomizerTrick> enabledTricks;
+    if (!options.settingsPath.empty() &&
+        !LoadSettings(options.settingsPath, cvarSettings, excludedLocations, enabledTricks)) {
+        return 1;
+    }
+
+    SetPlaythroughCheckThreads(options.checkThreads);
+    FillProfiler::SetEnabled(options.profile);
+    // Without the files the spoiler log is still built like in game, so seeds match theirs, it's only not saved
+    SpoilerLog_SetWriteFiles(options.writeSpoilers);
+
+    const uint32_t threadCount = std::min(options.threads, std::max(1u, options.count));
+    std::vector<SeedResult> results(options.count);
+    std::atomic<uint32_t> nextSeed = 0;
+
+    // Every seed is generated in a world of its own, so the workers can run
+    // full generations side by side. Seeds are handed out one at a time to
+    // keep the workers busy when some seeds need several fill attempts.
+    auto worker = [&]() {
+        for (uint32_t i = nextSeed++; i < options.count; i = nextSeed++) {
+            auto start = std::chrono::steady_clock::now();
+            WorldScope scope;
+
+            // Same setup as RandoMain::GenerateRando, minus the console variables
+            HintTable_Init();
+            ItemTable_Init();
+            LocationTable_Init();
+            std::string spoilerFile = GenerateRandomizer(cvarSettings, excludedLocations, enabledTricks,
+                                                         std::to_string(options.firstSeed + i));
+
+            auto end = std::chrono::steady_clock::now();
+            results[i].milliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+            results[i].success = !spoilerFile.empty();
+        }
+    };
+
+    auto batchStart = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+    for (uint32_t t = 0; t < threadCount; t++) {
+        workers.emplace_back(worker);
+    }
+    for (std::thread& thread : workers) {
+        thread.join();
+    }
+    double totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - batchStart).count();
+
+    std::vector<double> times;
+    times.reserve(results.size());
+    uint32_t failures = 0;
+    for (const SeedResult& result : results) {
+        times.push_back(result.milliseconds);
+        if (!result.success) {
+            failures++;
+        }
+    }
+    std::sort(times.begin(), times.end());
+
+    printf("\nGenerated %u seeds (%u failed) on %u threads in %.2fs\n", options.count, failures, threadCount,
+           totalSeconds);
+    printf("  seeds/sec: %.2f\n", totalSeconds > 0.0 ? options.count / totalSeconds : 0.0);
+    printf("  p50: %.1fms\n", Percentile(times, 50.0));
+    printf("  p99: %.1fms\n", Percentile(times, 99.0));
+
+    return failures == 0 ? 0 : 2;
+}
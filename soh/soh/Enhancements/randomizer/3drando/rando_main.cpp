@@ -1,4 +1,5 @@
 #include "menu.hpp"
+#include "fill_profiler.hpp"
 #include "hint_list.hpp"
 #include "item_list.hpp"
 #include "item_location.hpp"
@@ -15,6 +16,7 @@ void RandoMain::GenerateRando(std::unordered_map<RandomizerSettingKey, u8> cvarS
     HintTable_Init();
     ItemTable_Init();
     LocationTable_Init();
+    FillProfiler::SetEnabled(CVarGetInteger(CVAR_RANDOMIZER_SETTING("ProfileGeneration"), 0));
 
     // std::string settingsFileName = "./randomizer/latest_settings.json";
     // CVarSetString(CVAR_RANDOMIZER_SETTING("LoadedPreset"), settingsFileName.c_str());
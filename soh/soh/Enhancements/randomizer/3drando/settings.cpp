@@ -7,18 +7,13 @@
 #include "randomizer.hpp"
 #include "trial.hpp"
 #include "keys.hpp"
+#include "world.hpp"
 
 using namespace Dungeon;
 using namespace Trial;
 
 namespace Settings {
-  uint32_t seed;
-  std::string hash;
   std::string version = RANDOMIZER_VERSION "-" COMMIT_NUMBER;
-  std::array<uint8_t, 5> hashIconIndexes;
-  std::string seedString;
-
-  bool skipChildZelda = false;
 
   std::vector<std::string> NumOpts(int min, int max, int step = 1, std::string textBefore = {}, std::string textAfter = {}) {
     std::vector<std::string> options;
@@ -44,1227 +39,1281 @@ namespace Settings {
     return options;
   }
 
-  //                                        Setting name,            Options,                           Category (default: Setting),Default index (default: 0), Default hidden (default: false)
-  //Open Settings
-  Option RandomizeOpen       = Option::Bool("Randomize Settings",    {"No","Yes"},                      OptionCategory::Toggle);
-  Option OpenForest          = Option::U8  ("Forest",                {"Closed", "Closed Deku", "Open"}, OptionCategory::Setting, OPENFOREST_CLOSED);
-  Option OpenKakariko        = Option::U8  ("Kakariko Gate",         {"Closed", "Open"});
-  Option OpenDoorOfTime      = Option::U8  ("Door of Time",          {"Closed", "Song only", "Open"});
-  Option ZorasFountain       = Option::U8  ("Zora's Fountain",       {"Closed", "Closed as child", "Open"});
-  Option GerudoFortress      = Option::U8  ("Gerudo Fortress",       {"Normal", "Fast", "Open"});
-  Option Bridge              = Option::U8  ("Rainbow Bridge",        {"Vanilla", "Always open", "Stones", "Medallions", "Dungeon rewards", "Dungeons", "Tokens", "Greg"}, OptionCategory::Setting, RAINBOWBRIDGE_VANILLA);
-  Option BridgeStoneCount    = Option::U8  ("Stone Count",           {NumOpts(0, 4)},   OptionCategory::Setting, 1, true);
-  Option BridgeMedallionCount= Option::U8  ("Medallion Count",       {NumOpts(0, 7)},   OptionCategory::Setting, 1, true);
-  Option BridgeRewardCount   = Option::U8  ("Reward Count",          {NumOpts(0, 10)},  OptionCategory::Setting, 1, true);
-  Option BridgeDungeonCount  = Option::U8  ("Dungeon Count",         {NumOpts(0, 9)},   OptionCategory::Setting, 1, true);
-  Option BridgeTokenCount    = Option::U8  ("Token Count",           {NumOpts(0, 100)}, OptionCategory::Setting, 1, true);
-  Option BridgeRewardOptions = Option::U8  ("Bridge Reward Options", {"Standard Rewards", "Greg as Reward", "Greg as Wildcard"});
-  Option RandomGanonsTrials  = Option::Bool("Random Ganon's Trials", {"Off", "On"},     OptionCategory::Setting, ON);
-  Option GanonsTrialsCount   = Option::U8  ("Trial Count",           {NumOpts(0, 6)},   OptionCategory::Setting, 1, true);
-  std::vector<Option *> openOptions = {
-    &RandomizeOpen,
-    &OpenForest,
-    &OpenKakariko,
-    &OpenDoorOfTime,
-    &ZorasFountain,
-    &GerudoFortress,
-    &Bridge,
-    &BridgeStoneCount,
-    &BridgeMedallionCount,
-    &BridgeRewardCount,
-    &BridgeDungeonCount,
-    &BridgeTokenCount,
-    &BridgeRewardOptions,
-    &RandomGanonsTrials,
-    &GanonsTrialsCount,
-  };
-
-  //World Settings
-  Option RandomizeWorld            = Option::Bool("Randomize Settings",     {"No","Yes"},                 OptionCategory::Toggle);
-  Option StartingAge               = Option::U8  ("Starting Age",           {"Child", "Adult", "Random"}, OptionCategory::Setting, AGE_CHILD);
-  uint8_t ResolvedStartingAge;
-  Option ShuffleEntrances          = Option::Bool("Shuffle Entrances",      {"Off", "On"});
-  Option ShuffleDungeonEntrances   = Option::U8  ("Dungeon Entrances",      {"Off", "On", "On + Ganon"});
-  Option ShuffleBossEntrances      = Option::U8  ("Boss Entrances",         {"Off", "Age Restricted", "Full"});
-  Option ShuffleOverworldEntrances = Option::Bool("Overworld Entrances",    {"Off", "On"});
-  Option ShuffleInteriorEntrances  = Option::U8  ("Interior Entrances",     {"Off", "Simple", "All"});
-  Option ShuffleGrottoEntrances    = Option::Bool("Grottos Entrances",      {"Off", "On"});
-  Option ShuffleOwlDrops           = Option::Bool("Owl Drops",              {"Off", "On"});
-  Option ShuffleWarpSongs          = Option::Bool("Warp Songs",             {"Off", "On"});
-  Option ShuffleOverworldSpawns    = Option::Bool("Overworld Spawns",       {"Off", "On"});
-  Option MixedEntrancePools        = Option::Bool("Mixed Entrance Pools",   {"Off", "On"});
-  Option MixDungeons               = Option::Bool("Mix Dungeons",           {"Off", "On"});
-  Option MixBosses                 = Option::Bool("Mix Bosses",             {"Off", "On"});
-  Option MixOverworld              = Option::Bool("Mix Overworld",          {"Off", "On"});
-  Option MixInteriors              = Option::Bool("Mix Interiors",          {"Off", "On"});
-  Option MixGrottos                = Option::Bool("Mix Grottos",            {"Off", "On"});
-  Option DecoupleEntrances         = Option::Bool("Decouple Entrances",     {"Off", "On"});
-  Option BombchusInLogic           = Option::Bool("Bombchus in Logic",      {"Off", "On"});
-  Option AmmoDrops                 = Option::U8  ("Ammo Drops",             {"On", "On + Bombchu", "Off"},         OptionCategory::Setting, AMMODROPS_BOMBCHU);
-  Option HeartDropRefill           = Option::U8  ("Heart Drops and Refills",{"On", "No Drop", "No Refill", "Off"}, OptionCategory::Setting, HEARTDROPREFILL_VANILLA);
-  Option TriforceHunt              = Option::U8  ("Triforce Hunt",          {"Off", "On"});
-  Option TriforceHuntTotal         = Option::U8  ("Triforce Hunt Total Pieces", {NumOpts(0, 100)});
-  Option TriforceHuntRequired      = Option::U8  ("Triforce Hunt Required Pieces", {NumOpts(0, 100)});
-  Option MQDungeonCount = Option::U8(
-      "MQ Dungeon Count", { MultiVecOpts({ NumOpts(0, 12), { "Random" }, { "Selection" } }) });
-  uint8_t MQSet;
-  bool DungeonModesKnown[12];
-  Option SetDungeonTypes           = Option::Bool("Set Dungeon Types",    {"Off", "On"});
-  Option MQDeku                    = Option::U8  ("Deku Tree",            {"Vanilla", "Master Quest", "Random"});
-  Option MQDodongo                 = Option::U8  ("Dodongo's Cavern",     {"Vanilla", "Master Quest", "Random"});
-  Option MQJabu                    = Option::U8  ("Jabu-Jabu's Belly",    {"Vanilla", "Master Quest", "Random"});
-  Option MQForest                  = Option::U8  ("Forest Temple",        {"Vanilla", "Master Quest", "Random"});
-  Option MQFire                    = Option::U8  ("Fire Temple",          {"Vanilla", "Master Quest", "Random"});
-  Option MQWater                   = Option::U8  ("Water Temple",         {"Vanilla", "Master Quest", "Random"});
-  Option MQSpirit                  = Option::U8  ("Spirit Temple",        {"Vanilla", "Master Quest", "Random"});
-  Option MQShadow                  = Option::U8  ("Shadow Temple",        {"Vanilla", "Master Quest", "Random"});
-  Option MQBotW                    = Option::U8  ("Bottom of the Well",   {"Vanilla", "Master Quest", "Random"});
-  Option MQIceCavern               = Option::U8  ("Ice Cavern",           {"Vanilla", "Master Quest", "Random"});
-  Option MQGTG                     = Option::U8  ("Training Grounds",     {"Vanilla", "Master Quest", "Random"});
-  Option MQCastle                  = Option::U8  ("Ganon's Castle",       {"Vanilla", "Master Quest", "Random"});
-  std::vector<Option *> worldOptions = {
-    &RandomizeWorld,
-    &StartingAge,
-    &ShuffleEntrances,
-    &ShuffleDungeonEntrances,
-    &ShuffleBossEntrances,
-    &ShuffleOverworldEntrances,
-    &ShuffleInteriorEntrances,
-    &ShuffleGrottoEntrances,
-    &ShuffleOwlDrops,
-    &ShuffleWarpSongs,
-    &ShuffleOverworldSpawns,
-    &MixedEntrancePools,
-    &MixDungeons,
-    &MixBosses,
-    &MixOverworld,
-    &MixInteriors,
-    &MixGrottos,
-    &DecoupleEntrances,
-    &BombchusInLogic,
-    &AmmoDrops,
-    &HeartDropRefill,
-    &TriforceHunt,
-    &TriforceHuntTotal,
-    &TriforceHuntRequired,
-    &MQDungeonCount,
-    &SetDungeonTypes,
-    &MQDeku,
-    &MQDodongo,
-    &MQJabu,
-    &MQForest,
-    &MQFire,
-    &MQWater,
-    &MQSpirit,
-    &MQShadow,
-    &MQBotW,
-    &MQIceCavern,
-    &MQGTG,
-    &MQCastle,
-  };
-  std::vector<Option *> dungeonOptions = {
-    &MQDeku,
-    &MQDodongo,
-    &MQJabu,
-    &MQForest,
-    &MQFire,
-    &MQWater,
-    &MQSpirit,
-    &MQShadow,
-    &MQBotW,
-    &MQIceCavern,
-    &MQGTG,
-    &MQCastle,
-  };
-
-  //Shuffle Settings
-  Option RandomizeShuffle           = Option::Bool("Randomize Settings",     {"No","Yes"}, OptionCategory::Toggle);
-  Option ShuffleRewards             = Option::U8  ("Shuffle Dungeon Rewards",{"End of dungeons", "Any dungeon", "Overworld", "Anywhere"});
-  Option LinksPocketItem            = Option::U8  ("Link's Pocket",          {"Dungeon Reward", "Advancement", "Anything", "Nothing"});
-  Option ShuffleSongs               = Option::U8  ("Shuffle Songs",          {"Song locations", "Dungeon rewards", "Anywhere"});
-  Option Shopsanity                 = Option::U8  ("Shopsanity",             {"Off","0 Items","1 Item","2 Items","3 Items","4 Items","Random"});
-  Option ShopsanityPrices           = Option::U8  ("Shopsanity Prices",      {"Balanced", "Starting Wallet", "Adult Wallet", "Giant's Wallet", "Tycoon's Wallet" });
-  Option ShopsanityPricesAffordable = Option::Bool("Affordable Prices",      {"Off", "On"});
-  Option Tokensanity                = Option::U8  ("Tokensanity",            {"Off", "Dungeons", "Overworld", "All Tokens"});
-  Option Scrubsanity                = Option::U8  ("Scrub Shuffle",          {"Off", "Affordable", "Expensive", "Random Prices"});
-  Option ShuffleCows                = Option::Bool("Shuffle Cows",           {"Off", "On"});
-  Option ShuffleKokiriSword         = Option::Bool("Shuffle Kokiri Sword",   {"Off", "On"});
-  Option ShuffleMasterSword         = Option::Bool("Shuffle Master Sword",   {"Off", "On"});
-  Option ShuffleOcarinas            = Option::Bool("Shuffle Ocarinas",       {"Off", "On"});
-  Option ShuffleWeirdEgg            = Option::Bool("Shuffle Weird Egg",      {"Off", "On"});
-  Option ShuffleGerudoToken         = Option::Bool("Shuffle Gerudo Card",    {"Off", "On"});
-  Option ShuffleMagicBeans          = Option::Bool("Shuffle Magic Beans",    {"Off", "On"});
-  Option ShuffleMerchants           = Option::U8  ("Shuffle Merchants",      {"Off", "On (No Hints)", "On (With Hints)"});
-  Option ShuffleFrogSongRupees      = Option::Bool("Shuffle Frog Song Rupees",{"Off", "On"});
-  Option ShuffleAdultTradeQuest     = Option::Bool("Shuffle Adult Trade",    {"Off", "On"});
-  Option ShuffleChestMinigame       = Option::U8  ("Shuffle Chest Minigame", {"Off", "On (Separate)", "On (Pack)"});
-  Option Shuffle100GSReward         = Option::Bool("Shuffle 100 GS Reward",  {"Off", "On"});
-
-  std::vector<Option *> shuffleOptions = {
-    &RandomizeShuffle,
-    &ShuffleRewards,
-    &LinksPocketItem,
-    &ShuffleSongs,
-    &Shopsanity,
-    &ShopsanityPrices,
-    &ShopsanityPricesAffordable,
-    &Tokensanity,
-    &Scrubsanity,
-    &ShuffleCows,
-    &ShuffleKokiriSword,
-    &ShuffleMasterSword,
-    &ShuffleOcarinas,
-    &ShuffleWeirdEgg,
-    &ShuffleGerudoToken,
-    &ShuffleMagicBeans,
-    &ShuffleMerchants,
-    &ShuffleFrogSongRupees,
-    &ShuffleAdultTradeQuest,
-    &ShuffleChestMinigame,
-    &Shuffle100GSReward,
-  };
-
-  //Shuffle Dungeon Items
-  Option RandomizeDungeon    = Option::Bool("Randomize Settings",        {"No","Yes"}, OptionCategory::Toggle);
-  Option MapsAndCompasses    = Option::U8  ("Maps/Compasses",            {"Start With", "Vanilla", "Own Dungeon", "Any Dungeon", "Overworld", "Anywhere"}, OptionCategory::Setting, MAPSANDCOMPASSES_OWN_DUNGEON);
-  Option Keysanity           = Option::U8  ("Small Keys",                {"Start With", "Vanilla", "Own Dungeon", "Any Dungeon", "Overworld", "Anywhere"}, OptionCategory::Setting, KEYSANITY_OWN_DUNGEON);
-  Option GerudoKeys          = Option::U8  ("Gerudo Fortress Keys",      {"Vanilla", "Any Dungeon", "Overworld", "Anywhere"});
-  Option BossKeysanity       = Option::U8  ("Boss Keys",                 {"Start With", "Vanilla", "Own Dungeon", "Any Dungeon", "Overworld", "Anywhere"}, OptionCategory::Setting, BOSSKEYSANITY_OWN_DUNGEON);
-  Option GanonsBossKey       = Option::U8  ("Ganon's Boss Key",          {"Vanilla", "Own dungeon", "Start with", "Any Dungeon", "Overworld", "Anywhere", "LACS-Vanilla", "LACS-Stones", "LACS-Medallions", "LACS-Rewards", "LACS-Dungeons", "LACS-Tokens", "100 GS Reward", "Triforce Hunt"}, OptionCategory::Setting, GANONSBOSSKEY_VANILLA);
-  uint8_t LACSCondition           = 0;
-  Option LACSStoneCount      = Option::U8  ("Stone Count",             {NumOpts(0, 4)},   OptionCategory::Setting, 1, true);
-  Option LACSMedallionCount  = Option::U8  ("Medallion Count",         {NumOpts(0, 7)},   OptionCategory::Setting, 1, true);
-  Option LACSRewardCount     = Option::U8  ("Reward Count",            {NumOpts(0, 10)},  OptionCategory::Setting, 1, true);
-  Option LACSDungeonCount    = Option::U8  ("Dungeon Count",           {NumOpts(0, 9)},   OptionCategory::Setting, 1, true);
-  Option LACSTokenCount      = Option::U8  ("Token Count",             {NumOpts(0, 100)}, OptionCategory::Setting, 1, true);
-  Option LACSRewardOptions   = Option::U8  ("LACS Reward Options",     {"Standard Reward", "Greg as Reward", "Greg as Wildcard"});
-  Option KeyRings            = Option::U8  ("Key Rings",               {"Off", "Random", "Count", "Selection"});
-  Option KeyRingsRandomCount = Option::U8  ("Keyring Dungeon Count",   {NumOpts(0, 9)}, OptionCategory::Setting, 1);
-  Option RingFortress        = Option::Bool("Gerudo Fortress",         {"Off", "On"},   OptionCategory::Setting);
-  Option RingForest          = Option::Bool("Forest Temple",           {"Off", "On"},   OptionCategory::Setting);
-  Option RingFire            = Option::Bool("Fire Temple",             {"Off", "On"},   OptionCategory::Setting);
-  Option RingWater           = Option::Bool("Water Temple",            {"Off", "On"},   OptionCategory::Setting);
-  Option RingSpirit          = Option::Bool("Spirit Temple",           {"Off", "On"},   OptionCategory::Setting);
-  Option RingShadow          = Option::Bool("Shadow Temple",           {"Off", "On"},   OptionCategory::Setting);
-  Option RingWell            = Option::Bool("Bottom of the Well",      {"Off", "On"},   OptionCategory::Setting);
-  Option RingGtg             = Option::Bool("GTG",                     {"Off", "On"},   OptionCategory::Setting);
-  Option RingCastle          = Option::Bool("Ganon's Castle",          {"Off", "On"},   OptionCategory::Setting);
-
-  std::vector<Option *> shuffleDungeonItemOptions = {
-    &RandomizeDungeon,
-    &MapsAndCompasses,
-    &Keysanity,
-    &GerudoKeys,
-    &BossKeysanity,
-    &GanonsBossKey,
-    &LACSStoneCount,
-    &LACSMedallionCount,
-    &LACSRewardCount,
-    &LACSDungeonCount,
-    &LACSTokenCount,
-    &LACSRewardOptions,
-    &KeyRings,
-    &KeyRingsRandomCount,
-    &RingFortress,
-    &RingForest,
-    &RingFire,
-    &RingWater,
-    &RingSpirit,
-    &RingShadow,
-    &RingWell,
-    &RingGtg,
-    &RingCastle,
-  };
-  std::vector<Option *> keyRingOptions = {
-    &RingForest,
-    &RingFire,
-    &RingWater,
-    &RingSpirit,
-    &RingShadow,
-    &RingWell,
-    &RingGtg,
-    &RingCastle,
-  };
-
-  //Timesaver Settings
-  Option SkipChildStealth    = Option::Bool("Skip Child Stealth",     {"Don't Skip", "Skip"}, OptionCategory::Setting, SKIP);
-  Option SkipTowerEscape     = Option::Bool("Skip Tower Escape",      {"Don't Skip", "Skip"}, OptionCategory::Setting, SKIP);
-  Option SkipEponaRace       = Option::Bool("Skip Epona Race",        {"Don't Skip", "Skip"});
-  Option SkipMinigamePhases  = Option::Bool("Minigames repetitions",  {"Don't Skip", "Skip"});
-  Option FreeScarecrow       = Option::Bool("Skip Scarecrow's Song",  {"Off", "On"});
-  Option FourPoesCutscene    = Option::Bool("Four Poes Cutscene",     {"Don't Skip", "Skip"}, OptionCategory::Setting, SKIP);
-  Option LakeHyliaOwl        = Option::Bool("Lake Hylia Owl",         {"Don't Skip", "Skip"}, OptionCategory::Setting, SKIP);
-  Option BigPoeTargetCount   = Option::U8  ("Big Poe Target Count",   {NumOpts(1, 10)});
-  Option NumRequiredCuccos   = Option::U8  ("Cuccos to return",       {NumOpts(0, 7)});
-  Option KingZoraSpeed       = Option::U8  ("King Zora Speed",        {"Fast", "Vanilla", "Random"});
-  Option CompleteMaskQuest   = Option::Bool("Complete Mask Quest",    {"Off", "On"});
-  Option EnableGlitchCutscenes = Option::Bool("Enable Glitch-Useful Cutscenes", {"Off", "On"});
-  Option QuickText           = Option::U8  ("Quick Text",             {"0: Vanilla", "1: Skippable", "2: Instant", "3: Turbo"}, OptionCategory::Setting, QUICKTEXT_INSTANT);
-  Option SkipSongReplays     = Option::U8  ("Skip Song Replays",    {"Don't Skip", "Skip (No SFX)", "Skip (Keep SFX)"});
-  Option KeepFWWarpPoint     = Option::Bool("Keep FW Warp Point",     {"Off", "On"});
-  Option FastBunnyHood       = Option::Bool("Fast Bunny Hood",        {"Off", "On"});
-  std::vector<Option *> timesaverOptions = {
-    &SkipChildStealth,
-    &SkipTowerEscape,
-    &SkipEponaRace,
-    &SkipMinigamePhases,
-    &FreeScarecrow,
-    &FourPoesCutscene,
-    &LakeHyliaOwl,
-    &BigPoeTargetCount,
-    &NumRequiredCuccos,
-    &KingZoraSpeed,
-    &CompleteMaskQuest,
-    &EnableGlitchCutscenes,
-    &QuickText,
-    &SkipSongReplays,
-    &KeepFWWarpPoint,
-    &FastBunnyHood,
-  };
-
-  //Misc Settings
-  Option GossipStoneHints    = Option::U8  ("Gossip Stone Hints",     {"No Hints", "Need Nothing", "Mask of Truth", "Stone of Agony"}, OptionCategory::Setting, HINTS_NEED_NOTHING);
-  Option ClearerHints        = Option::U8  ("Hint Clarity",           {"Obscure", "Ambiguous", "Clear"});
-  Option HintDistribution    = Option::U8  ("Hint Distribution",      {"Useless", "Balanced", "Strong", "Very Strong"}, OptionCategory::Setting, 1); // Balanced
-  Option AltarHintText       = Option::Bool("ToT Altar Hint",         {"Off", "On"}, OptionCategory::Setting, 1);
-  Option LightArrowHintText  = Option::Bool("Light Arrow Hint",       {"Off", "On"}, OptionCategory::Setting, 1);
-  Option DampeHintText       = Option::Bool("Dampe's Diary Hint",     {"Off", "On"}, OptionCategory::Setting, 0);
-  Option GregHintText        = Option::Bool("Greg the Rupee Hint",    {"Off", "On"}, OptionCategory::Setting, 0);
-  Option SariaHintText       = Option::Bool("Saria's Hint",           {"Off", "On"}, OptionCategory::Setting, 0);
-  Option FrogsHintText       = Option::Bool("Frog Ocarina Game Hint", {"Off", "On"}, OptionCategory::Setting, 0);
-  Option WarpSongHints       = Option::Bool("Warp Song Hints",        {"Off", "On"}, OptionCategory::Setting, 0);
-  Option Kak10GSHintText     = Option::Bool("10 GS Hint",             {"Off", "On"}, OptionCategory::Setting, 0);
-  Option Kak20GSHintText     = Option::Bool("20 GS Hint",             {"Off", "On"}, OptionCategory::Setting, 0);
-  Option Kak30GSHintText     = Option::Bool("30 GS Hint",             {"Off", "On"}, OptionCategory::Setting, 0);
-  Option Kak40GSHintText     = Option::Bool("40 GS Hint",             {"Off", "On"}, OptionCategory::Setting, 0);
-  Option Kak50GSHintText     = Option::Bool("50 GS Hint",             {"Off", "On"}, OptionCategory::Setting, 0);
-  Option ScrubHintText       = Option::Bool("Scrub Hint Text",        {"Off", "On"}, OptionCategory::Setting, 0);
-  Option CompassesShowReward = Option::U8  ("Compasses Show Rewards", {"No", "Yes"}, OptionCategory::Setting, 1);
-  Option CompassesShowWotH   = Option::U8  ("Compasses Show WotH",    {"No", "Yes"}, OptionCategory::Setting, 1);
-  Option MapsShowDungeonMode = Option::U8  ("Maps Show Dungeon Modes",{"No", "Yes"}, OptionCategory::Setting, 1);
-  Option DamageMultiplier    = Option::U8  ("Damage Multiplier",      {"x1/2", "x1", "x2", "x4", "x8", "x16", "OHKO"}, OptionCategory::Setting, DAMAGEMULTIPLIER_DEFAULT);
-  Option StartingTime        = Option::U8  ("Starting Time",          {"Day", "Night"});
-  Option ChestAnimations     = Option::Bool("Chest Animations",       {"Always Fast", "Match Contents"});
-  Option ChestSize           = Option::Bool("Chest Size and Color",   {"Vanilla", "Match Contents"});
-  Option GenerateSpoilerLog  = Option::Bool("Generate Spoiler Log",   {"No", "Yes"}, OptionCategory::Setting, 1); // On
-  Option IngameSpoilers      = Option::Bool("Ingame Spoilers",        {"Hide", "Show"});
-  Option RandomTrapDmg       = Option::U8  ("Random Trap Damage",     {"Off", "Basic", "Advanced"}, OptionCategory::Setting, 1); // Basic
-  Option BlueFireArrows      = Option::Bool("Blue Fire Arrows",       {"Off", "On"});
-  Option SunlightArrows      = Option::Bool("Sunlight Arrows",        {"Off", "On"});
-
-  bool HasNightStart         = false;
-  std::vector<Option *> miscOptions = {
-    &GossipStoneHints,
-    &ClearerHints,
-    &HintDistribution,
-    &AltarHintText,
-    &LightArrowHintText,
-    &DampeHintText,
-    &GregHintText,
-    &SariaHintText,
-    &FrogsHintText,
-    &WarpSongHints,
-    &Kak10GSHintText,
-    &Kak20GSHintText,
-    &Kak30GSHintText,
-    &Kak40GSHintText,
-    &Kak50GSHintText,
-    &ScrubHintText,
-    &CompassesShowReward,
-    &CompassesShowWotH,
-    &MapsShowDungeonMode,
-    &DamageMultiplier,
-    &StartingTime,
-    &ChestAnimations,
-    &ChestSize,
-    &GenerateSpoilerLog,
-    &IngameSpoilers,
-    &RandomTrapDmg,
-    &BlueFireArrows,
-    &SunlightArrows
-  };
-
-  //Item Usability Settings
-  Option FaroresWindAnywhere = Option::Bool("Farore's Wind Anywhere", {"Disabled", "Enabled"});
-  Option AgeItemsToggle      = Option::U8  ("Lift Age Restrictions",  {"All Disabled",  "All Enabled", "Choose"});
-  Option StickAsAdult        = Option::Bool("Adult Deku Stick",     {"Disabled", "Enabled"});
-  Option BoomerangAsAdult    = Option::Bool("Adult Boomerang",      {"Disabled", "Enabled"});
-  Option HammerAsChild       = Option::Bool("Child Hammer",         {"Disabled", "Enabled"});
-  Option SlingshotAsAdult    = Option::Bool("Adult Slingshot",      {"Disabled", "Enabled"});
-  Option BowAsChild          = Option::Bool("Child Bow",            {"Disabled", "Enabled"});
-  Option HookshotAsChild     = Option::Bool("Child Hookshot",       {"Disabled", "Enabled"});
-  Option IronBootsAsChild    = Option::Bool("Child Iron Boots",     {"Disabled", "Enabled"});
-  Option HoverBootsAsChild   = Option::Bool("Child Hover Boots",    {"Disabled", "Enabled"});
-  Option MasksAsAdult        = Option::Bool("Adult Masks",          {"Disabled", "Enabled"});
-  Option KokiriSwordAsAdult  = Option::Bool("Adult Kokiri Sword",   {"Disabled", "Enabled"});
-  Option MasterSwordAsChild  = Option::Bool("Child Master Sword",   {"Disabled", "Enabled"});
-  Option BiggoronSwordAsChild= Option::Bool("Child Biggoron Sword", {"Disabled", "Enabled"});
-  Option DekuShieldAsAdult   = Option::Bool("Adult Deku Shield",    {"Disabled", "Enabled"});
-  Option MirrorShieldAsChild = Option::Bool("Child Mirror Shield",  {"Disabled", "Enabled"});
-  Option GoronTunicAsChild   = Option::Bool("Child Goron Tunic",    {"Disabled", "Enabled"});
-  Option ZoraTunicAsChild    = Option::Bool("Child Zora Tunic",     {"Disabled", "Enabled"});
-  Option GkDurability        = Option::U8  ("GK Durability",          {"Vanilla", "Random Risk", "Random Safe"});
-  std::vector<Option *> itemUsabilityOptions = {
-    &FaroresWindAnywhere,
-    &AgeItemsToggle,
-    &StickAsAdult,
-    &BoomerangAsAdult,
-    &HammerAsChild,
-    &SlingshotAsAdult,
-    &BowAsChild,
-    &HookshotAsChild,
-    &IronBootsAsChild,
-    &HoverBootsAsChild,
-    &MasksAsAdult,
-    &KokiriSwordAsAdult,
-    &MasterSwordAsChild,
-    &BiggoronSwordAsChild,
-    &DekuShieldAsAdult,
-    &MirrorShieldAsChild,
-    &GoronTunicAsChild,
-    &ZoraTunicAsChild,
-    &GkDurability,
-  };
-
-  //Item Pool Settings
-  Option ItemPoolValue         = Option::U8  ("Item Pool",             {"Plentiful", "Balanced", "Scarce", "Minimal"},    OptionCategory::Setting, ITEMPOOL_BALANCED);
-  Option IceTrapValue          = Option::U8  ("Ice Traps",             {"Off", "Normal", "Extra", "Mayhem", "Onslaught"}, OptionCategory::Setting, ICETRAPS_NORMAL);
-  Option RemoveDoubleDefense   = Option::Bool("Remove Double Defense", {"No", "Yes"});
-  Option ProgressiveGoronSword = Option::Bool("Prog Goron Sword",      {"Disabled", "Enabled"});
-  std::vector<Option *> itemPoolOptions = {
-    &ItemPoolValue,
-    &IceTrapValue,
-    &RemoveDoubleDefense,
-    &ProgressiveGoronSword,
-  };
-
-  //Excluded Locations (Individual definitions made in ItemLocation class)
-  std::vector<std::vector<Option *>> excludeLocationsOptionsVector(SPOILER_COLLECTION_GROUP_COUNT);
-  Menu excludeKokiriForest          = Menu::SubMenu("Kokiri Forest",           &excludeLocationsOptionsVector[GROUP_KOKIRI_FOREST], false);
-  Menu excludeLostWoods             = Menu::SubMenu("Lost Woods",              &excludeLocationsOptionsVector[GROUP_LOST_WOODS], false);
-  Menu excludeDekuTree              = Menu::SubMenu("Deku Tree",               &excludeLocationsOptionsVector[GROUP_DUNGEON_DEKU_TREE], false);
-  Menu excludeForestTemple          = Menu::SubMenu("Forest Temple",           &excludeLocationsOptionsVector[GROUP_DUNGEON_FOREST_TEMPLE], false);
-  Menu excludeKakariko              = Menu::SubMenu("Kakariko Village",        &excludeLocationsOptionsVector[GROUP_KAKARIKO], false);
-  Menu excludeBottomWell            = Menu::SubMenu("Bottom of the Well",      &excludeLocationsOptionsVector[GROUP_DUNGEON_BOTTOM_OF_THE_WELL], false);
-  Menu excludeShadowTemple          = Menu::SubMenu("Shadow Temple",           &excludeLocationsOptionsVector[GROUP_DUNGEON_SHADOW_TEMPLE], false);
-  Menu excludeDeathMountain         = Menu::SubMenu("Death Mountain",          &excludeLocationsOptionsVector[GROUP_DEATH_MOUNTAIN], false);
-  Menu excludeGoronCity             = Menu::SubMenu("Goron City",              &excludeLocationsOptionsVector[GROUP_GORON_CITY], false);
-  Menu excludeDodongosCavern        = Menu::SubMenu("Dodongo's Cavern",        &excludeLocationsOptionsVector[GROUP_DUNGEON_DODONGOS_CAVERN], false);
-  Menu excludeFireTemple            = Menu::SubMenu("Fire Temple",             &excludeLocationsOptionsVector[GROUP_DUNGEON_FIRE_TEMPLE], false);
-  Menu excludeZorasRiver            = Menu::SubMenu("Zora's River",            &excludeLocationsOptionsVector[GROUP_ZORAS_RIVER], false);
-  Menu excludeZorasDomain           = Menu::SubMenu("Zora's Domain",           &excludeLocationsOptionsVector[GROUP_ZORAS_DOMAIN], false);
-  Menu excludeJabuJabu              = Menu::SubMenu("Jabu Jabu's Belly",       &excludeLocationsOptionsVector[GROUP_DUNGEON_JABUJABUS_BELLY], false);
-  Menu excludeIceCavern             = Menu::SubMenu("Ice Cavern",              &excludeLocationsOptionsVector[GROUP_DUNGEON_ICE_CAVERN], false);
-  Menu excludeHyruleField           = Menu::SubMenu("Hyrule Field",            &excludeLocationsOptionsVector[GROUP_HYRULE_FIELD], false);
-  Menu excludeLonLonRanch           = Menu::SubMenu("Lon Lon Ranch",           &excludeLocationsOptionsVector[GROUP_LON_LON_RANCH], false);
-  Menu excludeLakeHylia             = Menu::SubMenu("Lake Hylia",              &excludeLocationsOptionsVector[GROUP_LAKE_HYLIA], false);
-  Menu excludeWaterTemple           = Menu::SubMenu("Water Temple",            &excludeLocationsOptionsVector[GROUP_DUNGEON_WATER_TEMPLE], false);
-  Menu excludeGerudoValley          = Menu::SubMenu("Gerudo Valley",           &excludeLocationsOptionsVector[GROUP_GERUDO_VALLEY], false);
-  Menu excludeGerudoTrainingGrounds = Menu::SubMenu("Gerudo Training Grounds", &excludeLocationsOptionsVector[GROUP_GERUDO_TRAINING_GROUND], false);
-  Menu excludeSpiritTemple          = Menu::SubMenu("Spirit Temple",           &excludeLocationsOptionsVector[GROUP_DUNGEON_SPIRIT_TEMPLE], false);
-  Menu excludeHyruleCastle          = Menu::SubMenu("Hyrule Castle",           &excludeLocationsOptionsVector[GROUP_HYRULE_CASTLE], false);
-  Menu excludeGanonsCastle          = Menu::SubMenu("Ganon's Castle",          &excludeLocationsOptionsVector[GROUP_DUNGEON_GANONS_CASTLE], false);
-  std::vector<Menu *> excludeLocationsMenus = {
-    &excludeKokiriForest,
-    &excludeLostWoods,
-    &excludeDekuTree,
-    &excludeForestTemple,
-    &excludeKakariko,
-    &excludeBottomWell,
-    &excludeShadowTemple,
-    &excludeDeathMountain,
-    &excludeGoronCity,
-    &excludeDodongosCavern,
-    &excludeFireTemple,
-    &excludeZorasRiver,
-    &excludeZorasDomain,
-    &excludeJabuJabu,
-    &excludeIceCavern,
-    &excludeHyruleField,
-    &excludeLonLonRanch,
-    &excludeLakeHylia,
-    &excludeWaterTemple,
-    &excludeGerudoValley,
-    &excludeGerudoTrainingGrounds,
-    &excludeSpiritTemple,
-    &excludeHyruleCastle,
-    &excludeGanonsCastle,
-  };
-
-  //Starting Inventory submenus and menus
-  std::vector<std::string> bottleOptions = {"Off", "Empty Bottle", "Red Potion", "Green Potion", "Blue Potion", "Fairy", "Fish", "Milk", "Blue Fire", "Bugs", "Big Poe", "Half Milk", "Poe"};
-  Option StartingStickCapacity    = Option::U8  ("Deku Stick Capacity",  {NumOpts(10, 30, 10, {}, " Deku Sticks")});
-  Option StartingNutCapacity      = Option::U8  ("Deku Nut Capacity",    {NumOpts(20, 40, 10, {}, " Deku Nuts")});
-  Option StartingSlingshot        = Option::U8  ("Slingshot",            {"Off",             "Slingshot (30)",   "Slingshot (40)",    "Slingshot (50)"});
-  Option StartingOcarina          = Option::U8  ("Start with Fairy Ocarina",              {"Off",             "Fairy Ocarina",    "Ocarina of Time"});
-  Option StartingBombBag          = Option::U8  ("Bombs",                {"Off",             "Bomb Bag (20)",    "Bomb Bag (30)",     "Bomb Bag (40)"});
-  Option StartingBombchus         = Option::U8  ("Bombchus",             {"Off",             "20 Bombchus",      "50 Bombchus"});
-  Option StartingBoomerang        = Option::U8  ("Boomerang",            {"Off",             "On"});
-  Option StartingHookshot         = Option::U8  ("Hookshot",             {"Off",             "Hookshot",         "Longshot"});
-  Option StartingBow              = Option::U8  ("Bow",                  {"Off",             "Bow (30)",         "Bow (40)",          "Bow (50)"});
-  Option StartingFireArrows       = Option::U8  ("Fire Arrow",           {"Off",             "On"});
-  Option StartingIceArrows        = Option::U8  ("Ice Arrow",            {"Off",             "On"});
-  Option StartingLightArrows      = Option::U8  ("Light Arrow",          {"Off",             "On"});
-  Option StartingMegatonHammer    = Option::U8  ("Megaton Hammer",       {"Off",             "On"});
-  Option StartingIronBoots        = Option::U8  ("Iron Boots",           {"Off",             "On"});
-  Option StartingHoverBoots       = Option::U8  ("Hover Boots",          {"Off",             "On"});
-  Option StartingLensOfTruth      = Option::U8  ("Lens of Truth",        {"Off",             "On"});
-  Option StartingDinsFire         = Option::U8  ("Din's Fire",           {"Off",             "On"});
-  Option StartingFaroresWind      = Option::U8  ("Farore's Wind",        {"Off",             "On"});
-  Option StartingNayrusLove       = Option::U8  ("Nayru's Love",         {"Off",             "On"});
-  Option StartingMagicBean        = Option::U8  ("Magic Beans",          {"Off",             "On"});
-  Option StartingBottle1          = Option::U8  ("Bottle 1",             bottleOptions);
-  Option StartingBottle2          = Option::U8  ("Bottle 2",             bottleOptions);
-  Option StartingBottle3          = Option::U8  ("Bottle 3",             bottleOptions);
-  Option StartingBottle4          = Option::U8  ("Bottle 4",             bottleOptions);
-  Option StartingRutoBottle       = Option::U8  ("Ruto's Letter",        {"Off",             "On"});
-  std::vector<Option *> startingItemsOptions = {
-    &StartingStickCapacity,
-    &StartingNutCapacity,
-    &StartingSlingshot,
-    &StartingOcarina,
-    &StartingBombBag,
-    &StartingBombchus,
-    &StartingBoomerang,
-    &StartingHookshot,
-    &StartingBow,
-    &StartingFireArrows,
-    &StartingIceArrows,
-    &StartingLightArrows,
-    &StartingMegatonHammer,
-    &StartingIronBoots,
-    &StartingHoverBoots,
-    &StartingLensOfTruth,
-    &StartingDinsFire,
-    &StartingFaroresWind,
-    &StartingNayrusLove,
-    &StartingMagicBean,
-    &StartingBottle1,
-    &StartingBottle2,
-    &StartingBottle3,
-    &StartingBottle4,
-    &StartingRutoBottle,
-  };
-
-  Option StartingZeldasLullaby    = Option::U8  ("Start with Zelda's Lullaby",      {"Off", "On"});
-  Option StartingEponasSong       = Option::U8  ("Start with Epona's Song",         {"Off", "On"});
-  Option StartingSariasSong       = Option::U8  ("Start with Saria's Song",         {"Off", "On"});
-  Option StartingSunsSong         = Option::U8  ("Start with Sun's Song",           {"Off", "On"});
-  Option StartingSongOfTime       = Option::U8  ("Start with Song of Time",         {"Off", "On"});
-  Option StartingSongOfStorms     = Option::U8  ("Start with Song of Storms",       {"Off", "On"});
-  Option StartingMinuetOfForest   = Option::U8  ("Start with Minuet of Forest",     {"Off", "On"});
-  Option StartingBoleroOfFire     = Option::U8  ("Start with Bolero of Fire",       {"Off", "On"});
-  Option StartingSerenadeOfWater  = Option::U8  ("Start with Serenade of Water",    {"Off", "On"});
-  Option StartingRequiemOfSpirit  = Option::U8  ("Start with Requiem of Spirit",    {"Off", "On"});
-  Option StartingNocturneOfShadow = Option::U8  ("Start with Nocturne of Shadow",   {"Off", "On"});
-  Option StartingPreludeOfLight   = Option::U8  ("Start with Prelude of Light",     {"Off", "On"});
-  std::vector<Option *> startingSongsOptions = {
-    &StartingZeldasLullaby,
-    &StartingEponasSong,
-    &StartingSariasSong,
-    &StartingSunsSong,
-    &StartingSongOfTime,
-    &StartingSongOfStorms,
-    &StartingMinuetOfForest,
-    &StartingBoleroOfFire,
-    &StartingSerenadeOfWater,
-    &StartingRequiemOfSpirit,
-    &StartingNocturneOfShadow,
-    &StartingPreludeOfLight,
-  };
-
-  Option StartingKokiriSword      = Option::U8  ("Start with Kokiri Sword",         {"Off",             "On"});
-  Option StartingMasterSword      = Option::U8  ("Start with Master Sword",         {"Off",             "On"});
-  Option StartingBiggoronSword    = Option::U8  ("Biggoron Sword",       {"Off",             "Giant's Knife",    "Biggoron Sword"});
-  Option StartingDekuShield       = Option::U8  ("Start with Deku Shield",          {"Off",             "On"});
-  Option StartingHylianShield     = Option::U8  ("Hylian Shield",        {"Off",             "On"});
-  Option StartingMirrorShield     = Option::U8  ("Mirror Shield",        {"Off",             "On"});
-  Option StartingGoronTunic       = Option::U8  ("Goron Tunic",          {"Off",             "On"});
-  Option StartingZoraTunic        = Option::U8  ("Zora Tunic",           {"Off",             "On"});
-  Option StartingStrength         = Option::U8  ("Strength Upgrade",     {"Off",             "Goron Bracelet",   "Silver Gauntlet",  "Golden Gauntlet"});
-  Option StartingScale            = Option::U8  ("Scale Upgrade",        {"Off",             "Silver Scale"  ,   "Golden Scale"});
-  Option StartingWallet           = Option::U8  ("Wallet Upgrade",       {"Off",             "Adult's Wallet",   "Giant's Wallet" ,  "Tycoon's Wallet"});
-  Option StartingShardOfAgony     = Option::U8  ("Stone of Agony",       {"Off",             "On"});
-  Option StartingHearts           = Option::U8  ("Hearts",               {NumOpts(1, 20)}, OptionCategory::Setting, 2); // Default 3 hearts
-  Option StartingMagicMeter       = Option::U8  ("Magic Meter",          {"Off",             "Single Magic",     "Double Magic"});
-  Option StartingDoubleDefense    = Option::U8  ("Double Defense",       {"Off",             "On"});
-
-  std::vector<Option *> startingEquipmentOptions = {
-    &StartingKokiriSword,
-    &StartingBiggoronSword,
-    &StartingDekuShield,
-    &StartingHylianShield,
-    &StartingMirrorShield,
-    &StartingGoronTunic,
-    &StartingZoraTunic,
-    &StartingStrength,
-    &StartingScale,
-    &StartingWallet,
-    &StartingShardOfAgony,
-    &StartingHearts,
-    &StartingMagicMeter,
-    &StartingDoubleDefense,
-  };
-
-  Option StartingKokiriEmerald    = Option::U8  ("Kokiri's Emerald",     {"Off", "On"});
-  Option StartingGoronRuby        = Option::U8  ("Goron's Ruby",         {"Off", "On"});
-  Option StartingZoraSapphire     = Option::U8  ("Zora's Sapphire",      {"Off", "On"});
-  Option StartingLightMedallion   = Option::U8  ("Light Medallion",      {"Off", "On"});
-  Option StartingForestMedallion  = Option::U8  ("Forest Medallion",     {"Off", "On"});
-  Option StartingFireMedallion    = Option::U8  ("Fire Medallion",       {"Off", "On"});
-  Option StartingWaterMedallion   = Option::U8  ("Water Medallion",      {"Off", "On"});
-  Option StartingSpiritMedallion  = Option::U8  ("Spirit Medallion",     {"Off", "On"});
-  Option StartingShadowMedallion  = Option::U8  ("Shadow Medallion",     {"Off", "On"});
-  std::vector<Option *> startingStonesMedallionsOptions = {
-    &StartingKokiriEmerald,
-    &StartingGoronRuby,
-    &StartingZoraSapphire,
-    &StartingLightMedallion,
-    &StartingForestMedallion,
-    &StartingFireMedallion,
-    &StartingWaterMedallion,
-    &StartingSpiritMedallion,
-    &StartingShadowMedallion,
-  };
-
-  Option StartingConsumables      = Option::Bool("Start with Consumables", {"No",               "Yes"});
-  Option StartingMaxRupees        = Option::Bool("Start with Max Rupees",  {"No",               "Yes"});
-  Option StartingSkulltulaToken   = Option::U8  ("Gold Skulltula Tokens",  {NumOpts(0, 100)});
-  std::vector<Option *> startingOthersOptions = {
-    &StartingConsumables,
-    &StartingMaxRupees,
-    &StartingSkulltulaToken,
-  };
-
-  Menu startingItems            = Menu::SubMenu("Items",                &startingItemsOptions, false);
-  Menu startingSongs            = Menu::SubMenu("Ocarina Songs",        &startingSongsOptions, false);
-  Menu startingEquipment        = Menu::SubMenu("Equipment & Upgrades", &startingEquipmentOptions, false);
-  Menu startingStonesMedallions = Menu::SubMenu("Stones & Medallions",  &startingStonesMedallionsOptions, false);
-  Menu startingOthers           = Menu::SubMenu("Other",                &startingOthersOptions, false);
-  std::vector<Menu *> startingInventoryOptions = {
-    &startingItems,
-    &startingSongs,
-    &startingEquipment,
-    &startingStonesMedallions,
-    &startingOthers,
-  };
-  Option Logic              = Option::U8  ("Logic",                   {"Glitchless", "Glitched", "No Logic", "Vanilla"});
-  Option LocationsReachable = Option::Bool("All Locations Reachable", {"Off", "On"}, OptionCategory::Setting, 1); //All Locations Reachable On
-  Option NightGSExpectSuns  = Option::Bool("Night GSs Expect Sun's",  {"Off", "On"});
-  std::vector<Option *> logicOptions = {
-    &Logic,
-    &LocationsReachable,
-    &NightGSExpectSuns,
-  };
-
   //Function to make defining logic tricks easier to read
   Option LogicTrick(std::string setting) {
     return Option::Bool(setting, {"Disabled", "Enabled"});
   }
 
-  //Detailed Logic Tricks                               ---------------------
-  Option LogicVisibleCollision                    = LogicTrick(std::to_string(RT_VISIBLE_COLLISION));
-  Option LogicGrottosWithoutAgony                 = LogicTrick(std::to_string(RT_GROTTOS_WITHOUT_AGONY));
-  Option LogicFewerTunicRequirements              = LogicTrick(std::to_string(RT_FEWER_TUNIC_REQUIREMENTS));
-  Option LogicRustedSwitches                      = LogicTrick(std::to_string(RT_RUSTED_SWITCHES));
-  Option LogicFlamingChests                       = LogicTrick(std::to_string(RT_FLAMING_CHESTS));
-  Option LogicBunnyHoodJump                       = LogicTrick(std::to_string(RT_BUNNY_HOOD_JUMPS));
-  Option LogicDamageBoost                         = LogicTrick(std::to_string(RT_DAMAGE_BOOST_SIMPLE));
-  Option LogicHoverBoost                          = LogicTrick(std::to_string(RT_HOVER_BOOST_SIMPLE));
-  Option LogicAdultKokiriGS                       = LogicTrick(std::to_string(RT_KF_ADULT_GS));
-  Option LogicLostWoodsBridge                     = LogicTrick(std::to_string(RT_LW_BRIDGE));
-  Option LogicMidoBackflip                        = LogicTrick(std::to_string(RT_LW_MIDO_BACKFLIP));
-  Option LogicLostWoodsGSBean                     = LogicTrick(std::to_string(RT_LW_GS_BEAN));
-  Option LogicCastleStormsGS                      = LogicTrick(std::to_string(RT_HC_STORMS_GS));
-  Option LogicManOnRoof                           = LogicTrick(std::to_string(RT_KAK_MAN_ON_ROOF));
-  Option LogicKakarikoTowerGS                     = LogicTrick(std::to_string(RT_KAK_TOWER_GS));
-  Option LogicAdultWindmillPoH                    = LogicTrick(std::to_string(RT_KAK_ADULT_WINDMILL_POH));
-  Option LogicChildWindmillPoH                    = LogicTrick(std::to_string(RT_KAK_CHILD_WINDMILL_POH));
-  Option LogicKakarikoRooftopGS                   = LogicTrick(std::to_string(RT_KAK_ROOFTOP_GS));
-  Option LogicGraveyardPoH                        = LogicTrick(std::to_string(RT_GY_POH));
-  Option LogicChildDampeRacePoH                   = LogicTrick(std::to_string(RT_GY_CHILD_DAMPE_RACE_POH));
-  Option LogicShadowFireArrowEntry                = LogicTrick(std::to_string(RT_GY_SHADOW_FIRE_ARROWS));
-  Option LogicDMTSoilGS                           = LogicTrick(std::to_string(RT_DMT_SOIL_GS));
-  Option LogicDMTBombable                         = LogicTrick(std::to_string(RT_DMT_BOMBABLE));
-  Option LogicDMTGSLowerHookshot                  = LogicTrick(std::to_string(RT_DMT_HOOKSHOT_LOWER_GS));
-  Option LogicDMTGSLowerHovers                    = LogicTrick(std::to_string(RT_DMT_HOVERS_LOWER_GS));
-  Option LogicDMTGSLowerBean                      = LogicTrick(std::to_string(RT_DMT_BEAN_LOWER_GS));
-  Option LogicDMTGSLowerJS                        = LogicTrick(std::to_string(RT_DMT_JS_LOWER_GS));
-  Option LogicDMTClimbHovers                      = LogicTrick(std::to_string(RT_DMT_CLIMB_HOVERS));
-  Option LogicDMTGSUpper                          = LogicTrick(std::to_string(RT_DMT_UPPER_GS));
-  Option LogicBiggoronBolero                      = LogicTrick(std::to_string(RT_DMT_BOLERO_BIGGORON));
-  Option LogicGoronCityPot                        = LogicTrick(std::to_string(RT_GC_POT));
-  Option LogicGoronCityPotWithStrength            = LogicTrick(std::to_string(RT_GC_POT_STRENGTH));
-  Option LogicChildRollingWithStrength            = LogicTrick(std::to_string(RT_GC_ROLLING_STRENGTH));
-  Option LogicGoronCityLeftMost                   = LogicTrick(std::to_string(RT_GC_LEFTMOST));
-  Option LogicGoronCityGrotto                     = LogicTrick(std::to_string(RT_GC_GROTTO));
-  Option LogicGoronCityLinkGoronDins              = LogicTrick(std::to_string(RT_GC_LINK_GORON_DINS));
-  Option LogicCraterBeanPoHWithHovers             = LogicTrick(std::to_string(RT_DMC_HOVER_BEAN_POH));
-  Option LogicCraterBoleroJump                    = LogicTrick(std::to_string(RT_DMC_BOLERO_JUMP));
-  Option LogicCraterBoulderJS                     = LogicTrick(std::to_string(RT_DMC_BOULDER_JS));
-  Option LogicCraterBoulderSkip                   = LogicTrick(std::to_string(RT_DMC_BOULDER_SKIP));
-  Option LogicZoraRiverLower                      = LogicTrick(std::to_string(RT_ZR_LOWER));
-  Option LogicZoraRiverUpper                      = LogicTrick(std::to_string(RT_ZR_UPPER));
-  Option LogicZoraWithHovers                      = LogicTrick(std::to_string(RT_ZR_HOVERS));
-  Option LogicZoraWithCucco                       = LogicTrick(std::to_string(RT_ZR_CUCCO));
-  Option LogicKingZoraSkip                        = LogicTrick(std::to_string(RT_ZD_KING_ZORA_SKIP));
-  Option LogicDomainGS                            = LogicTrick(std::to_string(RT_ZD_GS));
-  Option LogicLabWallGS                           = LogicTrick(std::to_string(RT_LH_LAB_WALL_GS));
-  Option LogicLabDiving                           = LogicTrick(std::to_string(RT_LH_LAB_DIVING));
-  Option LogicWaterHookshotEntry                  = LogicTrick(std::to_string(RT_LH_WATER_HOOKSHOT));
-  Option LogicValleyCrateHovers                   = LogicTrick(std::to_string(RT_GV_CRATE_HOVERS));
-  Option LogicGerudoKitchen                       = LogicTrick(std::to_string(RT_GF_KITCHEN));
-  Option LogicGFJump                              = LogicTrick(std::to_string(RT_GF_JUMP));
-  Option LogicWastelandBunnyCrossing              = LogicTrick(std::to_string(RT_HW_BUNNY_CROSSING));
-  Option LogicWastelandCrossing                   = LogicTrick(std::to_string(RT_HW_CROSSING));
-  Option LogicLensWasteland                       = LogicTrick(std::to_string(RT_LENS_HW));
-  Option LogicReverseWasteland                    = LogicTrick(std::to_string(RT_HW_REVERSE));
-  Option LogicColossusGS                          = LogicTrick(std::to_string(RT_COLOSSUS_GS));
-  Option LogicDekuBasementGS                      = LogicTrick(std::to_string(RT_DEKU_BASEMENT_GS));
-  Option LogicDekuB1Skip                          = LogicTrick(std::to_string(RT_DEKU_B1_SKIP));
-  Option LogicDekuB1WebsWithBow                   = LogicTrick(std::to_string(RT_DEKU_B1_BOW_WEBS));
-  Option LogicDekuMQCompassGS                     = LogicTrick(std::to_string(RT_DEKU_MQ_COMPASS_GS));
-  Option LogicDekuMQLog                           = LogicTrick(std::to_string(RT_DEKU_MQ_LOG));
-  Option LogicDCScarecrowGS                       = LogicTrick(std::to_string(RT_DC_SCARECROW_GS));
-  Option LogicDCVinesGS                           = LogicTrick(std::to_string(RT_DC_VINES_GS));
-  Option LogicDCStaircase                         = LogicTrick(std::to_string(RT_DC_STAIRCASE));
-  Option LogicDCSlingshotSkip                     = LogicTrick(std::to_string(RT_DC_SLINGSHOT_SKIP));
-  Option LogicDCScrubRoom                         = LogicTrick(std::to_string(RT_DC_SCRUB_ROOM));
-  Option LogicDCJump                              = LogicTrick(std::to_string(RT_DC_JUMP));
-  Option LogicDCHammerFloor                       = LogicTrick(std::to_string(RT_DC_HAMMER_FLOOR));
-  Option LogicDCMQChildBombs                      = LogicTrick(std::to_string(RT_DC_MQ_CHILD_BOMBS));
-  Option LogicDCMQEyesChild                       = LogicTrick(std::to_string(RT_DC_MQ_CHILD_EYES));
-  Option LogicDCMQEyesAdult                       = LogicTrick(std::to_string(RT_DC_MQ_ADULT_EYES));
-  Option LogicJabuAlcoveJumpDive                  = LogicTrick(std::to_string(RT_JABU_ALCOVE_JUMP_DIVE));
-  Option LogicJabuBossHover                       = LogicTrick(std::to_string(RT_JABU_BOSS_HOVER));
-  Option LogicJabuNearBossRanged                  = LogicTrick(std::to_string(RT_JABU_NEAR_BOSS_RANGED));
-  Option LogicJabuNearBossExplosives              = LogicTrick(std::to_string(RT_JABU_NEAR_BOSS_EXPLOSIVES));
-  Option LogicLensJabuMQ                          = LogicTrick(std::to_string(RT_LENS_JABU_MQ));
-  Option LogicJabuMQRangJump                      = LogicTrick(std::to_string(RT_JABU_MQ_RANG_JUMP));
-  Option LogicJabuMQSoTGS                         = LogicTrick(std::to_string(RT_JABU_MQ_SOT_GS));
-  Option LogicLensBotw                            = LogicTrick(std::to_string(RT_LENS_BOTW));
-  Option LogicChildDeadhand                       = LogicTrick(std::to_string(RT_BOTW_CHILD_DEADHAND));
-  Option LogicBotwBasement                        = LogicTrick(std::to_string(RT_BOTW_BASEMENT));
-  Option LogicBotwMQPits                          = LogicTrick(std::to_string(RT_BOTW_MQ_PITS));
-  Option LogicBotwMQDeadHandKey                   = LogicTrick(std::to_string(RT_BOTW_MQ_DEADHAND_KEY));
-  Option LogicForestFirstGS                       = LogicTrick(std::to_string(RT_FOREST_FIRST_GS));
-  Option LogicForestOutdoorEastGS                 = LogicTrick(std::to_string(RT_FOREST_OUTDOORS_EAST_GS));
-  Option LogicForestVines                         = LogicTrick(std::to_string(RT_FOREST_VINES));
-  Option LogicForestOutdoorsLedge                 = LogicTrick(std::to_string(RT_FOREST_OUTDOORS_LEDGE));
-  Option LogicForestDoorFrame                     = LogicTrick(std::to_string(RT_FOREST_DOORFRAME));
-  Option LogicForestOutsideBackdoor               = LogicTrick(std::to_string(RT_FOREST_OUTSIDE_BACKDOOR));
-  Option LogicForestMQWellSwim                    = LogicTrick(std::to_string(RT_FOREST_MQ_WELL_SWIM));
-  Option LogicForestMQBlockPuzzle                 = LogicTrick(std::to_string(RT_FOREST_MQ_BLOCK_PUZZLE));
-  Option LogicForestMQHallwaySwitchJS             = LogicTrick(std::to_string(RT_FOREST_MQ_JS_HALLWAY_SWITCH));
-  Option LogicForestMQHallwaySwitchHookshot       = LogicTrick(std::to_string(RT_FOREST_MQ_HOOKSHOT_HALLWAY_SWITCH));
-  Option LogicForestMQHallwaySwitchBoomerang      = LogicTrick(std::to_string(RT_FOREST_MQ_RANG_HALLWAY_SWITCH));
-  Option LogicFireBossDoorJump                    = LogicTrick(std::to_string(RT_FIRE_BOSS_DOOR_JUMP));
-  Option LogicFireSongOfTime                      = LogicTrick(std::to_string(RT_FIRE_SOT));
-  Option LogicFireStrength                        = LogicTrick(std::to_string(RT_FIRE_STRENGTH));
-  Option LogicFireScarecrow                       = LogicTrick(std::to_string(RT_FIRE_SCARECROW));
-  Option LogicFireFlameMaze                       = LogicTrick(std::to_string(RT_FIRE_FLAME_MAZE));
-  Option LogicFireMQNearBoss                      = LogicTrick(std::to_string(RT_FIRE_MQ_NEAR_BOSS));
-  Option LogicFireMQBlockedChest                  = LogicTrick(std::to_string(RT_FIRE_MQ_BLOCKED_CHEST));
-  Option LogicFireMQBKChest                       = LogicTrick(std::to_string(RT_FIRE_MQ_BK_CHEST));
-  Option LogicFireMQClimb                         = LogicTrick(std::to_string(RT_FIRE_MQ_CLIMB));
-  Option LogicFireMQMazeSideRoom                  = LogicTrick(std::to_string(RT_FIRE_MQ_MAZE_SIDE_ROOM));
-  Option LogicFireMQMazeHovers                    = LogicTrick(std::to_string(RT_FIRE_MQ_MAZE_HOVERS));
-  Option LogicFireMQMazeJump                      = LogicTrick(std::to_string(RT_FIRE_MQ_MAZE_JUMP));
-  Option LogicFireMQAboveMazeGS                   = LogicTrick(std::to_string(RT_FIRE_MQ_ABOVE_MAZE_GS));
-  Option LogicFireMQFlameMaze                     = LogicTrick(std::to_string(RT_FIRE_MQ_FLAME_MAZE));
-  Option LogicWaterTempleTorchLongshot            = LogicTrick(std::to_string(RT_WATER_LONGSHOT_TORCH));
-  Option LogicWaterCrackedWallHovers              = LogicTrick(std::to_string(RT_WATER_CRACKED_WALL_HOVERS));
-  Option LogicWaterCrackedWallNothing             = LogicTrick(std::to_string(RT_WATER_CRACKED_WALL));
-  Option LogicWaterBossKeyRegion                  = LogicTrick(std::to_string(RT_WATER_BK_REGION));
-  Option LogicWaterNorthBasementLedgeJump         = LogicTrick(std::to_string(RT_WATER_NORTH_BASEMENT_LEDGE_JUMP));
-  Option LogicWaterBKJumpDive                     = LogicTrick(std::to_string(RT_WATER_BK_JUMP_DIVE));
-  Option LogicWaterCentralGSFW                    = LogicTrick(std::to_string(RT_WATER_FW_CENTRAL_GS));
-  Option LogicWaterCentralGSIrons                 = LogicTrick(std::to_string(RT_WATER_IRONS_CENTRAL_GS));
-  Option LogicWaterCentralBow                     = LogicTrick(std::to_string(RT_WATER_CENTRAL_BOW));
-  Option LogicWaterFallingPlatformGSHookshot      = LogicTrick(std::to_string(RT_WATER_HOOKSHOT_FALLING_PLATFORM_GS));
-  Option LogicWaterFallingPlatformGSBoomerang     = LogicTrick(std::to_string(RT_WATER_RANG_FALLING_PLATFORM_GS));
-  Option LogicWaterRiverGS                        = LogicTrick(std::to_string(RT_WATER_RIVER_GS));
-  Option LogicWaterDragonJumpDive                 = LogicTrick(std::to_string(RT_WATER_DRAGON_JUMP_DIVE));
-  Option LogicWaterDragonAdult                    = LogicTrick(std::to_string(RT_WATER_ADULT_DRAGON));
-  Option LogicWaterDragonChild                    = LogicTrick(std::to_string(RT_WATER_CHILD_DRAGON));
-  Option LogicWaterMQCentralPillar                = LogicTrick(std::to_string(RT_WATER_MQ_CENTRAL_PILLAR));
-  Option LogicWaterMQLockedGS                     = LogicTrick(std::to_string(RT_WATER_MQ_LOCKED_GS));
-  Option LogicLensShadow                          = LogicTrick(std::to_string(RT_LENS_SHADOW));
-  Option LogicLensShadowPlatform                  = LogicTrick(std::to_string(RT_LENS_SHADOW_PLATFORM));
-  Option LogicLensBongo                           = LogicTrick(std::to_string(RT_LENS_BONGO));
-  Option LogicShadowUmbrella                      = LogicTrick(std::to_string(RT_SHADOW_UMBRELLA));
-  Option LogicShadowUmbrellaGS                    = LogicTrick(std::to_string(RT_SHADOW_UMBRELLA_GS));
-  Option LogicShadowFreestandingKey               = LogicTrick(std::to_string(RT_SHADOW_FREESTANDING_KEY));
-  Option LogicShadowStatue                        = LogicTrick(std::to_string(RT_SHADOW_STATUE));
-  Option LogicShadowBongo                         = LogicTrick(std::to_string(RT_SHADOW_BONGO));
-  Option LogicLensShadowMQ                        = LogicTrick(std::to_string(RT_LENS_SHADOW_MQ));
-  Option LogicLensShadowMQInvisibleBlades         = LogicTrick(std::to_string(RT_LENS_SHADOW_MQ_INVISIBLE_BLADES));
-  Option LogicLensShadowMQPlatform                = LogicTrick(std::to_string(RT_LENS_SHADOW_MQ_PLATFORM));
-  Option LogicLensShadowMQDeadHand                = LogicTrick(std::to_string(RT_LENS_SHADOW_MQ_DEADHAND));
-  Option LogicShadowMQGap                         = LogicTrick(std::to_string(RT_SHADOW_MQ_GAP));
-  Option LogicShadowMQInvisibleBlades             = LogicTrick(std::to_string(RT_SHADOW_MQ_INVISIBLE_BLADES));
-  Option LogicShadowMQHugePit                     = LogicTrick(std::to_string(RT_SHADOW_MQ_HUGE_PIT));
-  Option LogicShadowMQWindyWalkway                = LogicTrick(std::to_string(RT_SHADOW_MQ_WINDY_WALKWAY));
-  Option LogicLensSpirit                          = LogicTrick(std::to_string(RT_LENS_SPIRIT));
-  Option LogicSpiritChildBombchu                  = LogicTrick(std::to_string(RT_SPIRIT_CHILD_CHU));
-  Option LogicSpiritLobbyGS                       = LogicTrick(std::to_string(RT_SPIRIT_LOBBY_GS));
-  Option LogicSpiritLowerAdultSwitch              = LogicTrick(std::to_string(RT_SPIRIT_LOWER_ADULT_SWITCH));
-  Option LogicSpiritLobbyJump                     = LogicTrick(std::to_string(RT_SPIRIT_LOBBY_JUMP));
-  Option LogicSpiritPlatformHookshot              = LogicTrick(std::to_string(RT_SPIRIT_PLATFORM_HOOKSHOT));
-  Option LogicSpiritMapChest                      = LogicTrick(std::to_string(RT_SPIRIT_MAP_CHEST));
-  Option LogicSpiritSunChest                      = LogicTrick(std::to_string(RT_SPIRIT_SUN_CHEST));
-  Option LogicSpiritWall                          = LogicTrick(std::to_string(RT_SPIRIT_WALL));
-  Option LogicLensSpiritMQ                        = LogicTrick(std::to_string(RT_LENS_SPIRIT_MQ));
-  Option LogicSpiritMQSunBlockSoT                 = LogicTrick(std::to_string(RT_SPIRIT_MQ_SUN_BLOCK_SOT));
-  Option LogicSpiritMQSunBlockGS                  = LogicTrick(std::to_string(RT_SPIRIT_MQ_SUN_BLOCK_GS));
-  Option LogicSpiritMQLowerAdult                  = LogicTrick(std::to_string(RT_SPIRIT_MQ_LOWER_ADULT));
-  Option LogicSpiritMQFrozenEye                   = LogicTrick(std::to_string(RT_SPIRIT_MQ_FROZEN_EYE));
-  Option LogicIceBlockGS                          = LogicTrick(std::to_string(RT_ICE_BLOCK_GS));
-  Option LogicIceMQRedIceGS                       = LogicTrick(std::to_string(RT_ICE_MQ_RED_ICE_GS));
-  Option LogicIceMQScarecrow                      = LogicTrick(std::to_string(RT_ICE_MQ_SCARECROW));
-  Option LogicLensGtg                             = LogicTrick(std::to_string(RT_LENS_GTG));
-  Option LogicGtgWithoutHookshot                  = LogicTrick(std::to_string(RT_GTG_WITHOUT_HOOKSHOT));
-  Option LogicGtgFakeWall                         = LogicTrick(std::to_string(RT_GTG_FAKE_WALL));
-  Option LogicLensGtgMQ                           = LogicTrick(std::to_string(RT_LENS_GTG_MQ));
-  Option LogicGtgMQWithHookshot                   = LogicTrick(std::to_string(RT_GTG_MQ_WITH_HOOKSHOT));
-  Option LogicGtgMQWithoutHookshot                = LogicTrick(std::to_string(RT_GTG_MQ_WIHTOUT_HOOKSHOT));
-  Option LogicLensCastle                          = LogicTrick(std::to_string(RT_LENS_GANON));
-  Option LogicSpiritTrialHookshot                 = LogicTrick(std::to_string(RT_GANON_SPIRIT_TRIAL_HOOKSHOT));
-  Option LogicLensCastleMQ                        = LogicTrick(std::to_string(RT_LENS_GANON_MQ));
-  Option LogicFireTrialMQ                         = LogicTrick(std::to_string(RT_GANON_MQ_FIRE_TRIAL));
-  Option LogicShadowTrialMQ                       = LogicTrick(std::to_string(RT_GANON_MQ_SHADOW_TRIAL));
-  Option LogicLightTrialMQ                        = LogicTrick(std::to_string(RT_GANON_MQ_LIGHT_TRIAL));
-
-  std::vector<Option *> trickOptions = {
-    &LogicVisibleCollision,
-    &LogicGrottosWithoutAgony,
-    &LogicFewerTunicRequirements,
-    &LogicRustedSwitches,
-    &LogicFlamingChests,
-    &LogicBunnyHoodJump,
-    &LogicDamageBoost,
-    &LogicHoverBoost,
-    &LogicAdultKokiriGS,
-    &LogicLostWoodsBridge,
-    &LogicMidoBackflip,
-    &LogicLostWoodsGSBean,
-    &LogicCastleStormsGS,
-    &LogicManOnRoof,
-    &LogicKakarikoTowerGS,
-    &LogicAdultWindmillPoH,
-    &LogicChildWindmillPoH,
-    &LogicKakarikoRooftopGS,
-    &LogicGraveyardPoH,
-    &LogicChildDampeRacePoH,
-    &LogicShadowFireArrowEntry,
-    &LogicDMTSoilGS,
-    &LogicDMTBombable,
-    &LogicDMTGSLowerHookshot,
-    &LogicDMTGSLowerHovers,
-    &LogicDMTGSLowerBean,
-    &LogicDMTGSLowerJS,
-    &LogicDMTClimbHovers,
-    &LogicDMTGSUpper,
-    &LogicBiggoronBolero,
-    &LogicGoronCityPot,
-    &LogicGoronCityPotWithStrength,
-    &LogicChildRollingWithStrength,
-    &LogicGoronCityLeftMost,
-    &LogicGoronCityGrotto,
-    &LogicGoronCityLinkGoronDins,
-    &LogicCraterBeanPoHWithHovers,
-    &LogicCraterBoleroJump,
-    &LogicCraterBoulderJS,
-    &LogicCraterBoulderSkip,
-    &LogicZoraRiverLower,
-    &LogicZoraRiverUpper,
-    &LogicZoraWithHovers,
-    &LogicZoraWithCucco,
-    &LogicKingZoraSkip,
-    &LogicDomainGS,
-    &LogicLabWallGS,
-    &LogicLabDiving,
-    &LogicWaterHookshotEntry,
-    &LogicValleyCrateHovers,
-    &LogicGerudoKitchen,
-    &LogicGFJump,
-    &LogicWastelandBunnyCrossing,
-    &LogicWastelandCrossing,
-    &LogicLensWasteland,
-    &LogicReverseWasteland,
-    &LogicColossusGS,
-    &LogicDekuBasementGS,
-    &LogicDekuB1Skip,
-    &LogicDekuB1WebsWithBow,
-    &LogicDekuMQCompassGS,
-    &LogicDekuMQLog,
-    &LogicDCScarecrowGS,
-    &LogicDCVinesGS,
-    &LogicDCStaircase,
-    &LogicDCSlingshotSkip,
-    &LogicDCScrubRoom,
-    &LogicDCJump,
-    &LogicDCHammerFloor,
-    &LogicDCMQChildBombs,
-    &LogicDCMQEyesChild,
-    &LogicDCMQEyesAdult,
-    &LogicJabuAlcoveJumpDive,
-    &LogicJabuBossHover,
-    &LogicJabuNearBossRanged,
-    &LogicJabuNearBossExplosives,
-    &LogicLensJabuMQ,
-    &LogicJabuMQRangJump,
-    &LogicJabuMQSoTGS,
-    &LogicLensBotw,
-    &LogicChildDeadhand,
-    &LogicBotwBasement,
-    &LogicBotwMQPits,
-    &LogicBotwMQDeadHandKey,
-    &LogicForestFirstGS,
-    &LogicForestOutdoorEastGS,
-    &LogicForestVines,
-    &LogicForestOutdoorsLedge,
-    &LogicForestDoorFrame,
-    &LogicForestOutsideBackdoor,
-    &LogicForestMQWellSwim,
-    &LogicForestMQBlockPuzzle,
-    &LogicForestMQHallwaySwitchJS,
-    //&LogicForestMQHallwaySwitchHookshot,
-    &LogicForestMQHallwaySwitchBoomerang,
-    &LogicFireBossDoorJump,
-    &LogicFireSongOfTime,
-    &LogicFireStrength,
-    &LogicFireScarecrow,
-    &LogicFireFlameMaze,
-    &LogicFireMQNearBoss,
-    &LogicFireMQBlockedChest,
-    &LogicFireMQBKChest,
-    &LogicFireMQClimb,
-    &LogicFireMQMazeSideRoom,
-    &LogicFireMQMazeHovers,
-    &LogicFireMQMazeJump,
-    &LogicFireMQAboveMazeGS,
-    &LogicFireMQFlameMaze,
-    &LogicWaterTempleTorchLongshot,
-    &LogicWaterCrackedWallHovers,
-    &LogicWaterCrackedWallNothing,
-    &LogicWaterBossKeyRegion,
-    &LogicWaterNorthBasementLedgeJump,
-    &LogicWaterBKJumpDive,
-    &LogicWaterCentralGSFW,
-    &LogicWaterCentralGSIrons,
-    &LogicWaterCentralBow,
-    &LogicWaterFallingPlatformGSHookshot,
-    &LogicWaterFallingPlatformGSBoomerang,
-    &LogicWaterRiverGS,
-    &LogicWaterDragonJumpDive,
-    &LogicWaterDragonAdult,
-    &LogicWaterDragonChild,
-    &LogicWaterMQCentralPillar,
-    &LogicWaterMQLockedGS,
-    &LogicLensShadow,
-    &LogicLensShadowPlatform,
-    &LogicLensBongo,
-    &LogicShadowUmbrella,
-    &LogicShadowUmbrellaGS,
-    &LogicShadowFreestandingKey,
-    &LogicShadowStatue,
-    &LogicShadowBongo,
-    &LogicLensShadowMQ,
-    &LogicLensShadowMQInvisibleBlades,
-    &LogicLensShadowMQPlatform,
-    &LogicLensShadowMQDeadHand,
-    &LogicShadowMQGap,
-    &LogicShadowMQInvisibleBlades,
-    &LogicShadowMQHugePit,
-    &LogicShadowMQWindyWalkway,
-    &LogicLensSpirit,
-    &LogicSpiritChildBombchu,
-    &LogicSpiritLobbyGS,
-    &LogicSpiritLowerAdultSwitch,
-    &LogicSpiritLobbyJump,
-    &LogicSpiritPlatformHookshot,
-    &LogicSpiritMapChest,
-    &LogicSpiritSunChest,
-    &LogicSpiritWall,
-    &LogicLensSpiritMQ,
-    &LogicSpiritMQSunBlockSoT,
-    &LogicSpiritMQSunBlockGS,
-    &LogicSpiritMQLowerAdult,
-    &LogicSpiritMQFrozenEye,
-    &LogicIceBlockGS,
-    &LogicIceMQRedIceGS,
-    &LogicIceMQScarecrow,
-    &LogicLensGtg,
-    &LogicGtgWithoutHookshot,
-    &LogicGtgFakeWall,
-    &LogicLensGtgMQ,
-    &LogicGtgMQWithHookshot,
-    &LogicGtgMQWithoutHookshot,
-    &LogicLensCastle,
-    &LogicSpiritTrialHookshot,
-    &LogicLensCastleMQ,
-    &LogicFireTrialMQ,
-    &LogicShadowTrialMQ,
-    &LogicLightTrialMQ,
-  };
-  std::unordered_map<RandomizerTrick,Option *> trickOptionMap = {
-    {RT_VISIBLE_COLLISION,&LogicVisibleCollision},
-    {RT_GROTTOS_WITHOUT_AGONY,&LogicGrottosWithoutAgony},
-    {RT_FEWER_TUNIC_REQUIREMENTS,&LogicFewerTunicRequirements},
-    {RT_RUSTED_SWITCHES,&LogicRustedSwitches},
-    {RT_FLAMING_CHESTS,&LogicFlamingChests},
-    {RT_BUNNY_HOOD_JUMPS,&LogicBunnyHoodJump},
-    {RT_DAMAGE_BOOST_SIMPLE,&LogicDamageBoost},
-    {RT_HOVER_BOOST_SIMPLE,&LogicHoverBoost},
-    {RT_KF_ADULT_GS,&LogicAdultKokiriGS},
-    {RT_LW_BRIDGE,&LogicLostWoodsBridge},
-    {RT_LW_MIDO_BACKFLIP,&LogicMidoBackflip},
-    {RT_LW_GS_BEAN,&LogicLostWoodsGSBean},
-    {RT_HC_STORMS_GS,&LogicCastleStormsGS},
-    {RT_KAK_MAN_ON_ROOF,&LogicManOnRoof},
-    {RT_KAK_TOWER_GS,&LogicKakarikoTowerGS},
-    {RT_KAK_ADULT_WINDMILL_POH,&LogicAdultWindmillPoH},
-    {RT_KAK_CHILD_WINDMILL_POH,&LogicChildWindmillPoH},
-    {RT_KAK_ROOFTOP_GS,&LogicKakarikoRooftopGS},
-    {RT_GY_POH,&LogicGraveyardPoH},
-    {RT_GY_CHILD_DAMPE_RACE_POH,&LogicChildDampeRacePoH},
-    {RT_GY_SHADOW_FIRE_ARROWS,&LogicShadowFireArrowEntry},
-    {RT_DMT_SOIL_GS,&LogicDMTSoilGS},
-    {RT_DMT_BOMBABLE,&LogicDMTBombable},
-    {RT_DMT_HOOKSHOT_LOWER_GS,&LogicDMTGSLowerHookshot},
-    {RT_DMT_HOVERS_LOWER_GS,&LogicDMTGSLowerHovers},
-    {RT_DMT_BEAN_LOWER_GS,&LogicDMTGSLowerBean},
-    {RT_DMT_JS_LOWER_GS,&LogicDMTGSLowerJS},
-    {RT_DMT_CLIMB_HOVERS,&LogicDMTClimbHovers},
-    {RT_DMT_UPPER_GS,&LogicDMTGSUpper},
-    {RT_DMT_BOLERO_BIGGORON,&LogicBiggoronBolero},
-    {RT_GC_POT,&LogicGoronCityPot},
-    {RT_GC_POT_STRENGTH,&LogicGoronCityPotWithStrength},
-    {RT_GC_ROLLING_STRENGTH,&LogicChildRollingWithStrength},
-    {RT_GC_LEFTMOST,&LogicGoronCityLeftMost},
-    {RT_GC_GROTTO,&LogicGoronCityGrotto},
-    {RT_GC_LINK_GORON_DINS,&LogicGoronCityLinkGoronDins},
-    {RT_DMC_HOVER_BEAN_POH,&LogicCraterBeanPoHWithHovers},
-    {RT_DMC_BOLERO_JUMP,&LogicCraterBoleroJump},
-    {RT_DMC_BOULDER_JS,&LogicCraterBoulderJS},
-    {RT_DMC_BOULDER_SKIP,&LogicCraterBoulderSkip},
-    {RT_ZR_LOWER,&LogicZoraRiverLower},
-    {RT_ZR_UPPER,&LogicZoraRiverUpper},
-    {RT_ZR_HOVERS,&LogicZoraWithHovers},
-    {RT_ZR_CUCCO,&LogicZoraWithCucco},
-    {RT_ZD_KING_ZORA_SKIP,&LogicKingZoraSkip},
-    {RT_ZD_GS,&LogicDomainGS},
-    {RT_LH_LAB_WALL_GS,&LogicLabWallGS},
-    {RT_LH_LAB_DIVING,&LogicLabDiving},
-    {RT_LH_WATER_HOOKSHOT,&LogicWaterHookshotEntry},
-    {RT_GV_CRATE_HOVERS,&LogicValleyCrateHovers},
-    {RT_GF_KITCHEN,&LogicGerudoKitchen},
-    {RT_GF_JUMP,&LogicGFJump},
-    {RT_HW_BUNNY_CROSSING,&LogicWastelandBunnyCrossing},
-    {RT_HW_CROSSING,&LogicWastelandCrossing},
-    {RT_LENS_HW,&LogicLensWasteland},
-    {RT_HW_REVERSE,&LogicReverseWasteland},
-    {RT_COLOSSUS_GS,&LogicColossusGS},
-    {RT_DEKU_BASEMENT_GS,&LogicDekuBasementGS},
-    {RT_DEKU_B1_SKIP,&LogicDekuB1Skip},
-    {RT_DEKU_B1_BOW_WEBS,&LogicDekuB1WebsWithBow},
-    {RT_DEKU_MQ_COMPASS_GS,&LogicDekuMQCompassGS},
-    {RT_DEKU_MQ_LOG,&LogicDekuMQLog},
-    {RT_DC_SCARECROW_GS,&LogicDCScarecrowGS},
-    {RT_DC_VINES_GS,&LogicDCVinesGS},
-    {RT_DC_STAIRCASE,&LogicDCStaircase},
-    {RT_DC_SLINGSHOT_SKIP,&LogicDCSlingshotSkip},
-    {RT_DC_SCRUB_ROOM,&LogicDCScrubRoom},
-    {RT_DC_JUMP,&LogicDCJump},
-    {RT_DC_HAMMER_FLOOR,&LogicDCHammerFloor},
-    {RT_DC_MQ_CHILD_BOMBS,&LogicDCMQChildBombs},
-    {RT_DC_MQ_CHILD_EYES,&LogicDCMQEyesChild},
-    {RT_DC_MQ_ADULT_EYES,&LogicDCMQEyesAdult},
-    {RT_JABU_ALCOVE_JUMP_DIVE,&LogicJabuAlcoveJumpDive},
-    {RT_JABU_BOSS_HOVER,&LogicJabuBossHover},
-    {RT_JABU_NEAR_BOSS_RANGED,&LogicJabuNearBossRanged},
-    {RT_JABU_NEAR_BOSS_EXPLOSIVES,&LogicJabuNearBossExplosives},
-    {RT_LENS_JABU_MQ,&LogicLensJabuMQ},
-    {RT_JABU_MQ_RANG_JUMP,&LogicJabuMQRangJump},
-    {RT_JABU_MQ_SOT_GS,&LogicJabuMQSoTGS},
-    {RT_LENS_BOTW,&LogicLensBotw},
-    {RT_BOTW_CHILD_DEADHAND,&LogicChildDeadhand},
-    {RT_BOTW_BASEMENT,&LogicBotwBasement},
-    {RT_BOTW_MQ_PITS,&LogicBotwMQPits},
-    {RT_BOTW_MQ_DEADHAND_KEY,&LogicBotwMQDeadHandKey},
-    {RT_FOREST_FIRST_GS,&LogicForestFirstGS},
-    {RT_FOREST_OUTDOORS_EAST_GS,&LogicForestOutdoorEastGS},
-    {RT_FOREST_VINES,&LogicForestVines},
-    {RT_FOREST_OUTDOORS_LEDGE,&LogicForestOutdoorsLedge},
-    {RT_FOREST_DOORFRAME,&LogicForestDoorFrame},
-    {RT_FOREST_OUTSIDE_BACKDOOR,&LogicForestOutsideBackdoor},
-    {RT_FOREST_MQ_WELL_SWIM,&LogicForestMQWellSwim},
-    {RT_FOREST_MQ_BLOCK_PUZZLE,&LogicForestMQBlockPuzzle},
-    {RT_FOREST_MQ_JS_HALLWAY_SWITCH,&LogicForestMQHallwaySwitchJS},
-    {RT_FOREST_MQ_HOOKSHOT_HALLWAY_SWITCH,&LogicForestMQHallwaySwitchHookshot},
-    {RT_FOREST_MQ_RANG_HALLWAY_SWITCH,&LogicForestMQHallwaySwitchBoomerang},
-    {RT_FIRE_BOSS_DOOR_JUMP,&LogicFireBossDoorJump},
-    {RT_FIRE_SOT,&LogicFireSongOfTime},
-    {RT_FIRE_STRENGTH,&LogicFireStrength},
-    {RT_FIRE_SCARECROW,&LogicFireScarecrow},
-    {RT_FIRE_FLAME_MAZE,&LogicFireFlameMaze},
-    {RT_FIRE_MQ_NEAR_BOSS,&LogicFireMQNearBoss},
-    {RT_FIRE_MQ_BLOCKED_CHEST,&LogicFireMQBlockedChest},
-    {RT_FIRE_MQ_BK_CHEST,&LogicFireMQBKChest},
-    {RT_FIRE_MQ_CLIMB,&LogicFireMQClimb},
-    {RT_FIRE_MQ_MAZE_SIDE_ROOM,&LogicFireMQMazeSideRoom},
-    {RT_FIRE_MQ_MAZE_HOVERS,&LogicFireMQMazeHovers},
-    {RT_FIRE_MQ_MAZE_JUMP,&LogicFireMQMazeJump},
-    {RT_FIRE_MQ_ABOVE_MAZE_GS,&LogicFireMQAboveMazeGS},
-    {RT_FIRE_MQ_FLAME_MAZE,&LogicFireMQFlameMaze},
-    {RT_WATER_LONGSHOT_TORCH,&LogicWaterTempleTorchLongshot},
-    {RT_WATER_CRACKED_WALL_HOVERS,&LogicWaterCrackedWallHovers},
-    {RT_WATER_CRACKED_WALL,&LogicWaterCrackedWallNothing},
-    {RT_WATER_BK_REGION,&LogicWaterBossKeyRegion},
-    {RT_WATER_NORTH_BASEMENT_LEDGE_JUMP,&LogicWaterNorthBasementLedgeJump},
-    {RT_WATER_BK_JUMP_DIVE,&LogicWaterBKJumpDive},
-    {RT_WATER_FW_CENTRAL_GS,&LogicWaterCentralGSFW},
-    {RT_WATER_IRONS_CENTRAL_GS,&LogicWaterCentralGSIrons},
-    {RT_WATER_CENTRAL_BOW,&LogicWaterCentralBow},
-    {RT_WATER_HOOKSHOT_FALLING_PLATFORM_GS,&LogicWaterFallingPlatformGSHookshot},
-    {RT_WATER_RANG_FALLING_PLATFORM_GS,&LogicWaterFallingPlatformGSBoomerang},
-    {RT_WATER_RIVER_GS,&LogicWaterRiverGS},
-    {RT_WATER_DRAGON_JUMP_DIVE,&LogicWaterDragonJumpDive},
-    {RT_WATER_ADULT_DRAGON,&LogicWaterDragonAdult},
-    {RT_WATER_CHILD_DRAGON,&LogicWaterDragonChild},
-    {RT_WATER_MQ_CENTRAL_PILLAR,&LogicWaterMQCentralPillar},
-    {RT_WATER_MQ_LOCKED_GS,&LogicWaterMQLockedGS},
-    {RT_LENS_SHADOW,&LogicLensShadow},
-    {RT_LENS_SHADOW_PLATFORM,&LogicLensShadowPlatform},
-    {RT_LENS_BONGO,&LogicLensBongo},
-    {RT_SHADOW_UMBRELLA,&LogicShadowUmbrella},
-    {RT_SHADOW_UMBRELLA_GS,&LogicShadowUmbrellaGS},
-    {RT_SHADOW_FREESTANDING_KEY,&LogicShadowFreestandingKey},
-    {RT_SHADOW_STATUE,&LogicShadowStatue},
-    {RT_SHADOW_BONGO,&LogicShadowBongo},
-    {RT_LENS_SHADOW_MQ,&LogicLensShadowMQ},
-    {RT_LENS_SHADOW_MQ_INVISIBLE_BLADES,&LogicLensShadowMQInvisibleBlades},
-    {RT_LENS_SHADOW_MQ_PLATFORM,&LogicLensShadowMQPlatform},
-    {RT_LENS_SHADOW_MQ_DEADHAND,&LogicLensShadowMQDeadHand},
-    {RT_SHADOW_MQ_GAP,&LogicShadowMQGap},
-    {RT_SHADOW_MQ_INVISIBLE_BLADES,&LogicShadowMQInvisibleBlades},
-    {RT_SHADOW_MQ_HUGE_PIT,&LogicShadowMQHugePit},
-    {RT_SHADOW_MQ_WINDY_WALKWAY,&LogicShadowMQWindyWalkway},
-    {RT_LENS_SPIRIT,&LogicLensSpirit},
-    {RT_SPIRIT_CHILD_CHU,&LogicSpiritChildBombchu},
-    {RT_SPIRIT_LOBBY_GS,&LogicSpiritLobbyGS},
-    {RT_SPIRIT_LOWER_ADULT_SWITCH,&LogicSpiritLowerAdultSwitch},
-    {RT_SPIRIT_LOBBY_JUMP,&LogicSpiritLobbyJump},
-    {RT_SPIRIT_PLATFORM_HOOKSHOT,&LogicSpiritPlatformHookshot},
-    {RT_SPIRIT_MAP_CHEST,&LogicSpiritMapChest},
-    {RT_SPIRIT_SUN_CHEST,&LogicSpiritSunChest},
-    {RT_SPIRIT_WALL,&LogicSpiritWall},
-    {RT_LENS_SPIRIT_MQ,&LogicLensSpiritMQ},
-    {RT_SPIRIT_MQ_SUN_BLOCK_SOT,&LogicSpiritMQSunBlockSoT},
-    {RT_SPIRIT_MQ_SUN_BLOCK_GS,&LogicSpiritMQSunBlockGS},
-    {RT_SPIRIT_MQ_LOWER_ADULT,&LogicSpiritMQLowerAdult},
-    {RT_SPIRIT_MQ_FROZEN_EYE,&LogicSpiritMQFrozenEye},
-    {RT_ICE_BLOCK_GS,&LogicIceBlockGS},
-    {RT_ICE_MQ_RED_ICE_GS,&LogicIceMQRedIceGS},
-    {RT_ICE_MQ_SCARECROW,&LogicIceMQScarecrow},
-    {RT_LENS_GTG,&LogicLensGtg},
-    {RT_GTG_WITHOUT_HOOKSHOT,&LogicGtgWithoutHookshot},
-    {RT_GTG_FAKE_WALL,&LogicGtgFakeWall},
-    {RT_LENS_GTG_MQ,&LogicLensGtgMQ},
-    {RT_GTG_MQ_WITH_HOOKSHOT,&LogicGtgMQWithHookshot},
-    {RT_GTG_MQ_WIHTOUT_HOOKSHOT,&LogicGtgMQWithoutHookshot},
-    {RT_LENS_GANON,&LogicLensCastle},
-    {RT_GANON_SPIRIT_TRIAL_HOOKSHOT,&LogicSpiritTrialHookshot},
-    {RT_LENS_GANON_MQ,&LogicLensCastleMQ},
-    {RT_GANON_MQ_FIRE_TRIAL,&LogicFireTrialMQ},
-    {RT_GANON_MQ_SHADOW_TRIAL,&LogicShadowTrialMQ},
-    {RT_GANON_MQ_LIGHT_TRIAL,&LogicLightTrialMQ},
-  };
-
-  //TODO completely rewrite glitch section since oot3d glitches differ from oot
-  
-  Option GlitchEquipSwapDins = LogicTrick("");
-  Option GlitchEquipSwap     = LogicTrick("");
-
-  std::vector<Option*> glitchCategories = {
-    &GlitchEquipSwapDins,
-    &GlitchEquipSwap,
-  };
-  
-  std::vector<Option*> miscGlitches = {
-    
-  };
-  
-
-  Menu glitchCategorySettings = Menu::SubMenu("General Categories",     &glitchCategories, false);
-  Menu miscGlitchSettings     = Menu::SubMenu("Miscellaneous Glitches", &miscGlitches,     false);
-  std::vector<Menu*> glitchOptions = {
-    &glitchCategorySettings,
-    &miscGlitchSettings,
-  };
-
-  Menu loadSettingsPreset       = Menu::Action("Load Settings Preset",       LOAD_PRESET);
-  Menu saveSettingsPreset       = Menu::Action("Save Settings Preset",       SAVE_PRESET);
-  Menu deleteSettingsPreset     = Menu::Action("Delete Settings Preset",     DELETE_PRESET);
-  Menu resetToDefaultSettings   = Menu::Action("Reset to Default Settings",  RESET_TO_DEFAULTS);
-
-  std::vector<Menu *> settingsPresetItems = {
-    &loadSettingsPreset,
-    &saveSettingsPreset,
-    &deleteSettingsPreset,
-    &resetToDefaultSettings,
-  };
-
-  //Detailed Logic Options Submenu
-  Menu logicSettings    = Menu::SubMenu("Logic Options",     &logicOptions);
-  Menu excludeLocations = Menu::SubMenu("Exclude Locations", &excludeLocationsMenus, false);
-  Menu tricks           = Menu::SubMenu("Logical Tricks",    &trickOptions, false);
-  Menu glitchSettings   = Menu::SubMenu("Glitch Options",    &glitchOptions, false);
-  std::vector<Menu *> detailedLogicOptions = {
-    &logicSettings,
-    &excludeLocations,
-    &tricks,
-    &glitchSettings,
-  };
-
-  Menu open                     = Menu::SubMenu("Open Settings",              &openOptions);
-  Menu world                    = Menu::SubMenu("World Settings",             &worldOptions);
-  Menu shuffle                  = Menu::SubMenu("Shuffle Settings",           &shuffleOptions);
-  Menu shuffleDungeonItems      = Menu::SubMenu("Shuffle Dungeon Items",      &shuffleDungeonItemOptions);
-  Menu detailedLogic            = Menu::SubMenu("Detailed Logic Settings",    &detailedLogicOptions);
-  Menu startingInventory        = Menu::SubMenu("Starting Inventory",         &startingInventoryOptions, false);
-  Menu timesaverSettings        = Menu::SubMenu("Timesaver Settings",         &timesaverOptions);
-  Menu miscSettings             = Menu::SubMenu("Misc Settings",              &miscOptions);
-  Menu itemPoolSettings         = Menu::SubMenu("Item Pool Settings",         &itemPoolOptions);
-  Menu itemUsabilitySettings    = Menu::SubMenu("Item Usability Settings",    &itemUsabilityOptions);
-  Menu settingsPresets          = Menu::SubMenu("Settings Presets",           &settingsPresetItems);
-  Menu generateRandomizer       = Menu::Action ("Generate Randomizer",        GENERATE_MODE);
-
-  //adding a menu with no options crashes, might fix later
-  std::vector<Menu *> mainMenu = {
-    &open,
-    &world,
-    &shuffle,
-    &shuffleDungeonItems,
-    &timesaverSettings,
-    &detailedLogic,
-    &startingInventory,
-    &miscSettings,
-    &itemPoolSettings,
-    &itemUsabilitySettings,
-    &settingsPresets,
-    &generateRandomizer,
-  };
-
-  //declared here, set in fill.cpp
-  uint32_t LinksPocketRewardBitMask = 0;
-  std::array<uint32_t, 9> rDungeonRewardOverrides{};
+  Vars::Vars() :
+    //Open Settings
+    RandomizeOpen(Option::Bool("Randomize Settings",    {"No","Yes"},                      OptionCategory::Toggle)),
+    OpenForest(Option::U8("Forest",                {"Closed", "Closed Deku", "Open"}, OptionCategory::Setting, OPENFOREST_CLOSED)),
+    OpenKakariko(Option::U8("Kakariko Gate",         {"Closed", "Open"})),
+    OpenDoorOfTime(Option::U8("Door of Time",          {"Closed", "Song only", "Open"})),
+    ZorasFountain(Option::U8("Zora's Fountain",       {"Closed", "Closed as child", "Open"})),
+    GerudoFortress(Option::U8("Gerudo Fortress",       {"Normal", "Fast", "Open"})),
+    Bridge(Option::U8("Rainbow Bridge",        {"Vanilla", "Always open", "Stones", "Medallions", "Dungeon rewards", "Dungeons", "Tokens", "Greg"}, OptionCategory::Setting, RAINBOWBRIDGE_VANILLA)),
+    BridgeStoneCount(Option::U8("Stone Count",           {NumOpts(0, 4)},   OptionCategory::Setting, 1, true)),
+    BridgeMedallionCount(Option::U8("Medallion Count",       {NumOpts(0, 7)},   OptionCategory::Setting, 1, true)),
+    BridgeRewardCount(Option::U8("Reward Count",          {NumOpts(0, 10)},  OptionCategory::Setting, 1, true)),
+    BridgeDungeonCount(Option::U8("Dungeon Count",         {NumOpts(0, 9)},   OptionCategory::Setting, 1, true)),
+    BridgeTokenCount(Option::U8("Token Count",           {NumOpts(0, 100)}, OptionCategory::Setting, 1, true)),
+    BridgeRewardOptions(Option::U8("Bridge Reward Options", {"Standard Rewards", "Greg as Reward", "Greg as Wildcard"})),
+    RandomGanonsTrials(Option::Bool("Random Ganon's Trials", {"Off", "On"},     OptionCategory::Setting, ON)),
+    GanonsTrialsCount(Option::U8("Trial Count",           {NumOpts(0, 6)},   OptionCategory::Setting, 1, true)),
+    openOptions{
+      &RandomizeOpen,
+      &OpenForest,
+      &OpenKakariko,
+      &OpenDoorOfTime,
+      &ZorasFountain,
+      &GerudoFortress,
+      &Bridge,
+      &BridgeStoneCount,
+      &BridgeMedallionCount,
+      &BridgeRewardCount,
+      &BridgeDungeonCount,
+      &BridgeTokenCount,
+      &BridgeRewardOptions,
+      &RandomGanonsTrials,
+      &GanonsTrialsCount,
+    },
+
+    //World Settings
+    RandomizeWorld(Option::Bool("Randomize Settings",     {"No","Yes"},                 OptionCategory::Toggle)),
+    StartingAge(Option::U8("Starting Age",           {"Child", "Adult", "Random"}, OptionCategory::Setting, AGE_CHILD)),
+    ShuffleEntrances(Option::Bool("Shuffle Entrances",      {"Off", "On"})),
+    ShuffleDungeonEntrances(Option::U8("Dungeon Entrances",      {"Off", "On", "On + Ganon"})),
+    ShuffleBossEntrances(Option::U8("Boss Entrances",         {"Off", "Age Restricted", "Full"})),
+    ShuffleOverworldEntrances(Option::Bool("Overworld Entrances",    {"Off", "On"})),
+    ShuffleInteriorEntrances(Option::U8("Interior Entrances",     {"Off", "Simple", "All"})),
+    ShuffleGrottoEntrances(Option::Bool("Grottos Entrances",      {"Off", "On"})),
+    ShuffleOwlDrops(Option::Bool("Owl Drops",              {"Off", "On"})),
+    ShuffleWarpSongs(Option::Bool("Warp Songs",             {"Off", "On"})),
+    ShuffleOverworldSpawns(Option::Bool("Overworld Spawns",       {"Off", "On"})),
+    MixedEntrancePools(Option::Bool("Mixed Entrance Pools",   {"Off", "On"})),
+    MixDungeons(Option::Bool("Mix Dungeons",           {"Off", "On"})),
+    MixBosses(Option::Bool("Mix Bosses",             {"Off", "On"})),
+    MixOverworld(Option::Bool("Mix Overworld",          {"Off", "On"})),
+    MixInteriors(Option::Bool("Mix Interiors",          {"Off", "On"})),
+    MixGrottos(Option::Bool("Mix Grottos",            {"Off", "On"})),
+    DecoupleEntrances(Option::Bool("Decouple Entrances",     {"Off", "On"})),
+    BombchusInLogic(Option::Bool("Bombchus in Logic",      {"Off", "On"})),
+    AmmoDrops(Option::U8("Ammo Drops",             {"On", "On + Bombchu", "Off"},         OptionCategory::Setting, AMMODROPS_BOMBCHU)),
+    HeartDropRefill(Option::U8("Heart Drops and Refills",{"On", "No Drop", "No Refill", "Off"}, OptionCategory::Setting, HEARTDROPREFILL_VANILLA)),
+    TriforceHunt(Option::U8("Triforce Hunt",          {"Off", "On"})),
+    TriforceHuntTotal(Option::U8("Triforce Hunt Total Pieces", {NumOpts(0, 100)})),
+    TriforceHuntRequired(Option::U8("Triforce Hunt Required Pieces", {NumOpts(0, 100)})),
+    MQDungeonCount(Option::U8(
+        "MQ Dungeon Count", { MultiVecOpts({ NumOpts(0, 12), { "Random" }, { "Selection" } }) })),
+    SetDungeonTypes(Option::Bool("Set Dungeon Types",    {"Off", "On"})),
+    MQDeku(Option::U8("Deku Tree",            {"Vanilla", "Master Quest", "Random"})),
+    MQDodongo(Option::U8("Dodongo's Cavern",     {"Vanilla", "Master Quest", "Random"})),
+    MQJabu(Option::U8("Jabu-Jabu's Belly",    {"Vanilla", "Master Quest", "Random"})),
+    MQForest(Option::U8("Forest Temple",        {"Vanilla", "Master Quest", "Random"})),
+    MQFire(Option::U8("Fire Temple",          {"Vanilla", "Master Quest", "Random"})),
+    MQWater(Option::U8("Water Temple",         {"Vanilla", "Master Quest", "Random"})),
+    MQSpirit(Option::U8("Spirit Temple",        {"Vanilla", "Master Quest", "Random"})),
+    MQShadow(Option::U8("Shadow Temple",        {"Vanilla", "Master Quest", "Random"})),
+    MQBotW(Option::U8("Bottom of the Well",   {"Vanilla", "Master Quest", "Random"})),
+    MQIceCavern(Option::U8("Ice Cavern",           {"Vanilla", "Master Quest", "Random"})),
+    MQGTG(Option::U8("Training Grounds",     {"Vanilla", "Master Quest", "Random"})),
+    MQCastle(Option::U8("Ganon's Castle",       {"Vanilla", "Master Quest", "Random"})),
+    worldOptions{
+      &RandomizeWorld,
+      &StartingAge,
+      &ShuffleEntrances,
+      &ShuffleDungeonEntrances,
+      &ShuffleBossEntrances,
+      &ShuffleOverworldEntrances,
+      &ShuffleInteriorEntrances,
+      &ShuffleGrottoEntrances,
+      &ShuffleOwlDrops,
+      &ShuffleWarpSongs,
+      &ShuffleOverworldSpawns,
+      &MixedEntrancePools,
+      &MixDungeons,
+      &MixBosses,
+      &MixOverworld,
+      &MixInteriors,
+      &MixGrottos,
+      &DecoupleEntrances,
+      &BombchusInLogic,
+      &AmmoDrops,
+      &HeartDropRefill,
+      &TriforceHunt,
+      &TriforceHuntTotal,
+      &TriforceHuntRequired,
+      &MQDungeonCount,
+      &SetDungeonTypes,
+      &MQDeku,
+      &MQDodongo,
+      &MQJabu,
+      &MQForest,
+      &MQFire,
+      &MQWater,
+      &MQSpirit,
+      &MQShadow,
+      &MQBotW,
+      &MQIceCavern,
+      &MQGTG,
+      &MQCastle,
+    },
+    dungeonOptions{
+      &MQDeku,
+      &MQDodongo,
+      &MQJabu,
+      &MQForest,
+      &MQFire,
+      &MQWater,
+      &MQSpirit,
+      &MQShadow,
+      &MQBotW,
+      &MQIceCavern,
+      &MQGTG,
+      &MQCastle,
+    },
+
+    //Shuffle Settings
+    RandomizeShuffle(Option::Bool("Randomize Settings",     {"No","Yes"}, OptionCategory::Toggle)),
+    ShuffleRewards(Option::U8("Shuffle Dungeon Rewards",{"End of dungeons", "Any dungeon", "Overworld", "Anywhere"})),
+    LinksPocketItem(Option::U8("Link's Pocket",          {"Dungeon Reward", "Advancement", "Anything", "Nothing"})),
+    ShuffleSongs(Option::U8("Shuffle Songs",          {"Song locations", "Dungeon rewards", "Anywhere"})),
+    Shopsanity(Option::U8("Shopsanity",             {"Off","0 Items","1 Item","2 Items","3 Items","4 Items","Random"})),
+    ShopsanityPrices(Option::U8("Shopsanity Prices",      {"Balanced", "Starting Wallet", "Adult Wallet", "Giant's Wallet", "Tycoon's Wallet" })),
+    ShopsanityPricesAffordable(Option::Bool("Affordable Prices",      {"Off", "On"})),
+    Tokensanity(Option::U8("Tokensanity",            {"Off", "Dungeons", "Overworld", "All Tokens"})),
+    Scrubsanity(Option::U8("Scrub Shuffle",          {"Off", "Affordable", "Expensive", "Random Prices"})),
+    ShuffleCows(Option::Bool("Shuffle Cows",           {"Off", "On"})),
+    ShuffleKokiriSword(Option::Bool("Shuffle Kokiri Sword",   {"Off", "On"})),
+    ShuffleMasterSword(Option::Bool("Shuffle Master Sword",   {"Off", "On"})),
+    ShuffleOcarinas(Option::Bool("Shuffle Ocarinas",       {"Off", "On"})),
+    ShuffleWeirdEgg(Option::Bool("Shuffle Weird Egg",      {"Off", "On"})),
+    ShuffleGerudoToken(Option::Bool("Shuffle Gerudo Card",    {"Off", "On"})),
+    ShuffleMagicBeans(Option::Bool("Shuffle Magic Beans",    {"Off", "On"})),
+    ShuffleMerchants(Option::U8("Shuffle Merchants",      {"Off", "On (No Hints)", "On (With Hints)"})),
+    ShuffleFrogSongRupees(Option::Bool("Shuffle Frog Song Rupees",{"Off", "On"})),
+    ShuffleAdultTradeQuest(Option::Bool("Shuffle Adult Trade",    {"Off", "On"})),
+    ShuffleChestMinigame(Option::U8("Shuffle Chest Minigame", {"Off", "On (Separate)", "On (Pack)"})),
+    Shuffle100GSReward(Option::Bool("Shuffle 100 GS Reward",  {"Off", "On"})),
+
+    shuffleOptions{
+      &RandomizeShuffle,
+      &ShuffleRewards,
+      &LinksPocketItem,
+      &ShuffleSongs,
+      &Shopsanity,
+      &ShopsanityPrices,
+      &ShopsanityPricesAffordable,
+      &Tokensanity,
+      &Scrubsanity,
+      &ShuffleCows,
+      &ShuffleKokiriSword,
+      &ShuffleMasterSword,
+      &ShuffleOcarinas,
+      &ShuffleWeirdEgg,
+      &ShuffleGerudoToken,
+      &ShuffleMagicBeans,
+      &ShuffleMerchants,
+      &ShuffleFrogSongRupees,
+      &ShuffleAdultTradeQuest,
+      &ShuffleChestMinigame,
+      &Shuffle100GSReward,
+    },
+
+    //Shuffle Dungeon Items
+    RandomizeDungeon(Option::Bool("Randomize Settings",        {"No","Yes"}, OptionCategory::Toggle)),
+    MapsAndCompasses(Option::U8("Maps/Compasses",            {"Start With", "Vanilla", "Own Dungeon", "Any Dungeon", "Overworld", "Anywhere"}, OptionCategory::Setting, MAPSANDCOMPASSES_OWN_DUNGEON)),
+    Keysanity(Option::U8("Small Keys",                {"Start With", "Vanilla", "Own Dungeon", "Any Dungeon", "Overworld", "Anywhere"}, OptionCategory::Setting, KEYSANITY_OWN_DUNGEON)),
+    GerudoKeys(Option::U8("Gerudo Fortress Keys",      {"Vanilla", "Any Dungeon", "Overworld", "Anywhere"})),
+    BossKeysanity(Option::U8("Boss Keys",                 {"Start With", "Vanilla", "Own Dungeon", "Any Dungeon", "Overworld", "Anywhere"}, OptionCategory::Setting, BOSSKEYSANITY_OWN_DUNGEON)),
+    GanonsBossKey(Option::U8("Ganon's Boss Key",          {"Vanilla", "Own dungeon", "Start with", "Any Dungeon", "Overworld", "Anywhere", "LACS-Vanilla", "LACS-Stones", "LACS-Medallions", "LACS-Rewards", "LACS-Dungeons", "LACS-Tokens", "100 GS Reward", "Triforce Hunt"}, OptionCategory::Setting, GANONSBOSSKEY_VANILLA)),
+    LACSStoneCount(Option::U8("Stone Count",             {NumOpts(0, 4)},   OptionCategory::Setting, 1, true)),
+    LACSMedallionCount(Option::U8("Medallion Count",         {NumOpts(0, 7)},   OptionCategory::Setting, 1, true)),
+    LACSRewardCount(Option::U8("Reward Count",            {NumOpts(0, 10)},  OptionCategory::Setting, 1, true)),
+    LACSDungeonCount(Option::U8("Dungeon Count",           {NumOpts(0, 9)},   OptionCategory::Setting, 1, true)),
+    LACSTokenCount(Option::U8("Token Count",             {NumOpts(0, 100)}, OptionCategory::Setting, 1, true)),
+    LACSRewardOptions(Option::U8("LACS Reward Options",     {"Standard Reward", "Greg as Reward", "Greg as Wildcard"})),
+    KeyRings(Option::U8("Key Rings",               {"Off", "Random", "Count", "Selection"})),
+    KeyRingsRandomCount(Option::U8("Keyring Dungeon Count",   {NumOpts(0, 9)}, OptionCategory::Setting, 1)),
+    RingFortress(Option::Bool("Gerudo Fortress",         {"Off", "On"},   OptionCategory::Setting)),
+    RingForest(Option::Bool("Forest Temple",           {"Off", "On"},   OptionCategory::Setting)),
+    RingFire(Option::Bool("Fire Temple",             {"Off", "On"},   OptionCategory::Setting)),
+    RingWater(Option::Bool("Water Temple",            {"Off", "On"},   OptionCategory::Setting)),
+    RingSpirit(Option::Bool("Spirit Temple",           {"Off", "On"},   OptionCategory::Setting)),
+    RingShadow(Option::Bool("Shadow Temple",           {"Off", "On"},   OptionCategory::Setting)),
+    RingWell(Option::Bool("Bottom of the Well",      {"Off", "On"},   OptionCategory::Setting)),
+    RingGtg(Option::Bool("GTG",                     {"Off", "On"},   OptionCategory::Setting)),
+    RingCastle(Option::Bool("Ganon's Castle",          {"Off", "On"},   OptionCategory::Setting)),
+
+    shuffleDungeonItemOptions{
+      &RandomizeDungeon,
+      &MapsAndCompasses,
+      &Keysanity,
+      &GerudoKeys,
+      &BossKeysanity,
+      &GanonsBossKey,
+      &LACSStoneCount,
+      &LACSMedallionCount,
+      &LACSRewardCount,
+      &LACSDungeonCount,
+      &LACSTokenCount,
+      &LACSRewardOptions,
+      &KeyRings,
+      &KeyRingsRandomCount,
+      &RingFortress,
+      &RingForest,
+      &RingFire,
+      &RingWater,
+      &RingSpirit,
+      &RingShadow,
+      &RingWell,
+      &RingGtg,
+      &RingCastle,
+    },
+    keyRingOptions{
+      &RingForest,
+      &RingFire,
+      &RingWater,
+      &RingSpirit,
+      &RingShadow,
+      &RingWell,
+      &RingGtg,
+      &RingCastle,
+    },
+
+    //Timesaver Settings
+    SkipChildStealth(Option::Bool("Skip Child Stealth",     {"Don't Skip", "Skip"}, OptionCategory::Setting, SKIP)),
+    SkipTowerEscape(Option::Bool("Skip Tower Escape",      {"Don't Skip", "Skip"}, OptionCategory::Setting, SKIP)),
+    SkipEponaRace(Option::Bool("Skip Epona Race",        {"Don't Skip", "Skip"})),
+    SkipMinigamePhases(Option::Bool("Minigames repetitions",  {"Don't Skip", "Skip"})),
+    FreeScarecrow(Option::Bool("Skip Scarecrow's Song",  {"Off", "On"})),
+    FourPoesCutscene(Option::Bool("Four Poes Cutscene",     {"Don't Skip", "Skip"}, OptionCategory::Setting, SKIP)),
+    LakeHyliaOwl(Option::Bool("Lake Hylia Owl",         {"Don't Skip", "Skip"}, OptionCategory::Setting, SKIP)),
+    BigPoeTargetCount(Option::U8("Big Poe Target Count",   {NumOpts(1, 10)})),
+    NumRequiredCuccos(Option::U8("Cuccos to return",       {NumOpts(0, 7)})),
+    KingZoraSpeed(Option::U8("King Zora Speed",        {"Fast", "Vanilla", "Random"})),
+    CompleteMaskQuest(Option::Bool("Complete Mask Quest",    {"Off", "On"})),
+    EnableGlitchCutscenes(Option::Bool("Enable Glitch-Useful Cutscenes", {"Off", "On"})),
+    QuickText(Option::U8("Quick Text",             {"0: Vanilla", "1: Skippable", "2: Instant", "3: Turbo"}, OptionCategory::Setting, QUICKTEXT_INSTANT)),
+    SkipSongReplays(Option::U8("Skip Song Replays",    {"Don't Skip", "Skip (No SFX)", "Skip (Keep SFX)"})),
+    KeepFWWarpPoint(Option::Bool("Keep FW Warp Point",     {"Off", "On"})),
+    FastBunnyHood(Option::Bool("Fast Bunny Hood",        {"Off", "On"})),
+    timesaverOptions{
+      &SkipChildStealth,
+      &SkipTowerEscape,
+      &SkipEponaRace,
+      &SkipMinigamePhases,
+      &FreeScarecrow,
+      &FourPoesCutscene,
+      &LakeHyliaOwl,
+      &BigPoeTargetCount,
+      &NumRequiredCuccos,
+      &KingZoraSpeed,
+      &CompleteMaskQuest,
+      &EnableGlitchCutscenes,
+      &QuickText,
+      &SkipSongReplays,
+      &KeepFWWarpPoint,
+      &FastBunnyHood,
+    },
+
+    //Misc Settings
+    GossipStoneHints(Option::U8("Gossip Stone Hints",     {"No Hints", "Need Nothing", "Mask of Truth", "Stone of Agony"}, OptionCategory::Setting, HINTS_NEED_NOTHING)),
+    ClearerHints(Option::U8("Hint Clarity",           {"Obscure", "Ambiguous", "Clear"})),
+    HintDistribution(Option::U8("Hint Distribution",      {"Useless", "Balanced", "Strong", "Very Strong"}, OptionCategory::Setting, 1)), // Balanced
+    AltarHintText(Option::Bool("ToT Altar Hint",         {"Off", "On"}, OptionCategory::Setting, 1)),
+    LightArrowHintText(Option::Bool("Light Arrow Hint",       {"Off", "On"}, OptionCategory::Setting, 1)),
+    DampeHintText(Option::Bool("Dampe's Diary Hint",     {"Off", "On"}, OptionCategory::Setting, 0)),
+    GregHintText(Option::Bool("Greg the Rupee Hint",    {"Off", "On"}, OptionCategory::Setting, 0)),
+    SariaHintText(Option::Bool("Saria's Hint",           {"Off", "On"}, OptionCategory::Setting, 0)),
+    FrogsHintText(Option::Bool("Frog Ocarina Game Hint", {"Off", "On"}, OptionCategory::Setting, 0)),
+    WarpSongHints(Option::Bool("Warp Song Hints",        {"Off", "On"}, OptionCategory::Setting, 0)),
+    Kak10GSHintText(Option::Bool("10 GS Hint",             {"Off", "On"}, OptionCategory::Setting, 0)),
+    Kak20GSHintText(Option::Bool("20 GS Hint",             {"Off", "On"}, OptionCategory::Setting, 0)),
+    Kak30GSHintText(Option::Bool("30 GS Hint",             {"Off", "On"}, OptionCategory::Setting, 0)),
+    Kak40GSHintText(Option::Bool("40 GS Hint",             {"Off", "On"}, OptionCategory::Setting, 0)),
+    Kak50GSHintText(Option::Bool("50 GS Hint",             {"Off", "On"}, OptionCategory::Setting, 0)),
+    ScrubHintText(Option::Bool("Scrub Hint Text",        {"Off", "On"}, OptionCategory::Setting, 0)),
+    CompassesShowReward(Option::U8("Compasses Show Rewards", {"No", "Yes"}, OptionCategory::Setting, 1)),
+    CompassesShowWotH(Option::U8("Compasses Show WotH",    {"No", "Yes"}, OptionCategory::Setting, 1)),
+    MapsShowDungeonMode(Option::U8("Maps Show Dungeon Modes",{"No", "Yes"}, OptionCategory::Setting, 1)),
+    DamageMultiplier(Option::U8("Damage Multiplier",      {"x1/2", "x1", "x2", "x4", "x8", "x16", "OHKO"}, OptionCategory::Setting, DAMAGEMULTIPLIER_DEFAULT)),
+    StartingTime(Option::U8("Starting Time",          {"Day", "Night"})),
+    ChestAnimations(Option::Bool("Chest Animations",       {"Always Fast", "Match Contents"})),
+    ChestSize(Option::Bool("Chest Size and Color",   {"Vanilla", "Match Contents"})),
+    GenerateSpoilerLog(Option::Bool("Generate Spoiler Log",   {"No", "Yes"}, OptionCategory::Setting, 1)), // On
+    IngameSpoilers(Option::Bool("Ingame Spoilers",        {"Hide", "Show"})),
+    RandomTrapDmg(Option::U8("Random Trap Damage",     {"Off", "Basic", "Advanced"}, OptionCategory::Setting, 1)), // Basic
+    BlueFireArrows(Option::Bool("Blue Fire Arrows",       {"Off", "On"})),
+    SunlightArrows(Option::Bool("Sunlight Arrows",        {"Off", "On"})),
+
+    miscOptions{
+      &GossipStoneHints,
+      &ClearerHints,
+      &HintDistribution,
+      &AltarHintText,
+      &LightArrowHintText,
+      &DampeHintText,
+      &GregHintText,
+      &SariaHintText,
+      &FrogsHintText,
+      &WarpSongHints,
+      &Kak10GSHintText,
+      &Kak20GSHintText,
+      &Kak30GSHintText,
+      &Kak40GSHintText,
+      &Kak50GSHintText,
+      &ScrubHintText,
+      &CompassesShowReward,
+      &CompassesShowWotH,
+      &MapsShowDungeonMode,
+      &DamageMultiplier,
+      &StartingTime,
+      &ChestAnimations,
+      &ChestSize,
+      &GenerateSpoilerLog,
+      &IngameSpoilers,
+      &RandomTrapDmg,
+      &BlueFireArrows,
+      &SunlightArrows
+    },
+
+    //Item Usability Settings
+    FaroresWindAnywhere(Option::Bool("Farore's Wind Anywhere", {"Disabled", "Enabled"})),
+    AgeItemsToggle(Option::U8("Lift Age Restrictions",  {"All Disabled",  "All Enabled", "Choose"})),
+    StickAsAdult(Option::Bool("Adult Deku Stick",     {"Disabled", "Enabled"})),
+    BoomerangAsAdult(Option::Bool("Adult Boomerang",      {"Disabled", "Enabled"})),
+    HammerAsChild(Option::Bool("Child Hammer",         {"Disabled", "Enabled"})),
+    SlingshotAsAdult(Option::Bool("Adult Slingshot",      {"Disabled", "Enabled"})),
+    BowAsChild(Option::Bool("Child Bow",            {"Disabled", "Enabled"})),
+    HookshotAsChild(Option::Bool("Child Hookshot",       {"Disabled", "Enabled"})),
+    IronBootsAsChild(Option::Bool("Child Iron Boots",     {"Disabled", "Enabled"})),
+    HoverBootsAsChild(Option::Bool("Child Hover Boots",    {"Disabled", "Enabled"})),
+    MasksAsAdult(Option::Bool("Adult Masks",          {"Disabled", "Enabled"})),
+    KokiriSwordAsAdult(Option::Bool("Adult Kokiri Sword",   {"Disabled", "Enabled"})),
+    MasterSwordAsChild(Option::Bool("Child Master Sword",   {"Disabled", "Enabled"})),
+    BiggoronSwordAsChild(Option::Bool("Child Biggoron Sword", {"Disabled", "Enabled"})),
+    DekuShieldAsAdult(Option::Bool("Adult Deku Shield",    {"Disabled", "Enabled"})),
+    MirrorShieldAsChild(Option::Bool("Child Mirror Shield",  {"Disabled", "Enabled"})),
+    GoronTunicAsChild(Option::Bool("Child Goron Tunic",    {"Disabled", "Enabled"})),
+    ZoraTunicAsChild(Option::Bool("Child Zora Tunic",     {"Disabled", "Enabled"})),
+    GkDurability(Option::U8("GK Durability",          {"Vanilla", "Random Risk", "Random Safe"})),
+    itemUsabilityOptions{
+      &FaroresWindAnywhere,
+      &AgeItemsToggle,
+      &StickAsAdult,
+      &BoomerangAsAdult,
+      &HammerAsChild,
+      &SlingshotAsAdult,
+      &BowAsChild,
+      &HookshotAsChild,
+      &IronBootsAsChild,
+      &HoverBootsAsChild,
+      &MasksAsAdult,
+      &KokiriSwordAsAdult,
+      &MasterSwordAsChild,
+      &BiggoronSwordAsChild,
+      &DekuShieldAsAdult,
+      &MirrorShieldAsChild,
+      &GoronTunicAsChild,
+      &ZoraTunicAsChild,
+      &GkDurability,
+    },
+
+    //Item Pool Settings
+    ItemPoolValue(Option::U8("Item Pool",             {"Plentiful", "Balanced", "Scarce", "Minimal"},    OptionCategory::Setting, ITEMPOOL_BALANCED)),
+    IceTrapValue(Option::U8("Ice Traps",             {"Off", "Normal", "Extra", "Mayhem", "Onslaught"}, OptionCategory::Setting, ICETRAPS_NORMAL)),
+    RemoveDoubleDefense(Option::Bool("Remove Double Defense", {"No", "Yes"})),
+    ProgressiveGoronSword(Option::Bool("Prog Goron Sword",      {"Disabled", "Enabled"})),
+    itemPoolOptions{
+      &ItemPoolValue,
+      &IceTrapValue,
+      &RemoveDoubleDefense,
+      &ProgressiveGoronSword,
+    },
+
+    //Excluded Locations (Individual definitions made in ItemLocation class)
+    excludeLocationsOptionsVector(SPOILER_COLLECTION_GROUP_COUNT),
+    excludeKokiriForest(Menu::SubMenu("Kokiri Forest",           &excludeLocationsOptionsVector[GROUP_KOKIRI_FOREST], false)),
+    excludeLostWoods(Menu::SubMenu("Lost Woods",              &excludeLocationsOptionsVector[GROUP_LOST_WOODS], false)),
+    excludeDekuTree(Menu::SubMenu("Deku Tree",               &excludeLocationsOptionsVector[GROUP_DUNGEON_DEKU_TREE], false)),
+    excludeForestTemple(Menu::SubMenu("Forest Temple",           &excludeLocationsOptionsVector[GROUP_DUNGEON_FOREST_TEMPLE], false)),
+    excludeKakariko(Menu::SubMenu("Kakariko Village",        &excludeLocationsOptionsVector[GROUP_KAKARIKO], false)),
+    excludeBottomWell(Menu::SubMenu("Bottom of the Well",      &excludeLocationsOptionsVector[GROUP_DUNGEON_BOTTOM_OF_THE_WELL], false)),
+    excludeShadowTemple(Menu::SubMenu("Shadow Temple",           &excludeLocationsOptionsVector[GROUP_DUNGEON_SHADOW_TEMPLE], false)),
+    excludeDeathMountain(Menu::SubMenu("Death Mountain",          &excludeLocationsOptionsVector[GROUP_DEATH_MOUNTAIN], false)),
+    excludeGoronCity(Menu::SubMenu("Goron City",              &excludeLocationsOptionsVector[GROUP_GORON_CITY], false)),
+    excludeDodongosCavern(Menu::SubMenu("Dodongo's Cavern",        &excludeLocationsOptionsVector[GROUP_DUNGEON_DODONGOS_CAVERN], false)),
+    excludeFireTemple(Menu::SubMenu("Fire Temple",             &excludeLocationsOptionsVector[GROUP_DUNGEON_FIRE_TEMPLE], false)),
+    excludeZorasRiver(Menu::SubMenu("Zora's River",            &excludeLocationsOptionsVector[GROUP_ZORAS_RIVER], false)),
+    excludeZorasDomain(Menu::SubMenu("Zora's Domain",           &excludeLocationsOptionsVector[GROUP_ZORAS_DOMAIN], false)),
+    excludeJabuJabu(Menu::SubMenu("Jabu Jabu's Belly",       &excludeLocationsOptionsVector[GROUP_DUNGEON_JABUJABUS_BELLY], false)),
+    excludeIceCavern(Menu::SubMenu("Ice Cavern",              &excludeLocationsOptionsVector[GROUP_DUNGEON_ICE_CAVERN], false)),
+    excludeHyruleField(Menu::SubMenu("Hyrule Field",            &excludeLocationsOptionsVector[GROUP_HYRULE_FIELD], false)),
+    excludeLonLonRanch(Menu::SubMenu("Lon Lon Ranch",           &excludeLocationsOptionsVector[GROUP_LON_LON_RANCH], false)),
+    excludeLakeHylia(Menu::SubMenu("Lake Hylia",              &excludeLocationsOptionsVector[GROUP_LAKE_HYLIA], false)),
+    excludeWaterTemple(Menu::SubMenu("Water Temple",            &excludeLocationsOptionsVector[GROUP_DUNGEON_WATER_TEMPLE], false)),
+    excludeGerudoValley(Menu::SubMenu("Gerudo Valley",           &excludeLocationsOptionsVector[GROUP_GERUDO_VALLEY], false)),
+    excludeGerudoTrainingGrounds(Menu::SubMenu("Gerudo Training Grounds", &excludeLocationsOptionsVector[GROUP_GERUDO_TRAINING_GROUND], false)),
+    excludeSpiritTemple(Menu::SubMenu("Spirit Temple",           &excludeLocationsOptionsVector[GROUP_DUNGEON_SPIRIT_TEMPLE], false)),
+    excludeHyruleCastle(Menu::SubMenu("Hyrule Castle",           &excludeLocationsOptionsVector[GROUP_HYRULE_CASTLE], false)),
+    excludeGanonsCastle(Menu::SubMenu("Ganon's Castle",          &excludeLocationsOptionsVector[GROUP_DUNGEON_GANONS_CASTLE], false)),
+    excludeLocationsMenus{
+      &excludeKokiriForest,
+      &excludeLostWoods,
+      &excludeDekuTree,
+      &excludeForestTemple,
+      &excludeKakariko,
+      &excludeBottomWell,
+      &excludeShadowTemple,
+      &excludeDeathMountain,
+      &excludeGoronCity,
+      &excludeDodongosCavern,
+      &excludeFireTemple,
+      &excludeZorasRiver,
+      &excludeZorasDomain,
+      &excludeJabuJabu,
+      &excludeIceCavern,
+      &excludeHyruleField,
+      &excludeLonLonRanch,
+      &excludeLakeHylia,
+      &excludeWaterTemple,
+      &excludeGerudoValley,
+      &excludeGerudoTrainingGrounds,
+      &excludeSpiritTemple,
+      &excludeHyruleCastle,
+      &excludeGanonsCastle,
+    },
+
+    //Starting Inventory submenus and menus
+    bottleOptions{"Off", "Empty Bottle", "Red Potion", "Green Potion", "Blue Potion", "Fairy", "Fish", "Milk", "Blue Fire", "Bugs", "Big Poe", "Half Milk", "Poe"},
+    StartingStickCapacity(Option::U8("Deku Stick Capacity",  {NumOpts(10, 30, 10, {}, " Deku Sticks")})),
+    StartingNutCapacity(Option::U8("Deku Nut Capacity",    {NumOpts(20, 40, 10, {}, " Deku Nuts")})),
+    StartingSlingshot(Option::U8("Slingshot",            {"Off",             "Slingshot (30)",   "Slingshot (40)",    "Slingshot (50)"})),
+    StartingOcarina(Option::U8("Start with Fairy Ocarina",              {"Off",             "Fairy Ocarina",    "Ocarina of Time"})),
+    StartingBombBag(Option::U8("Bombs",                {"Off",             "Bomb Bag (20)",    "Bomb Bag (30)",     "Bomb Bag (40)"})),
+    StartingBombchus(Option::U8("Bombchus",             {"Off",             "20 Bombchus",      "50 Bombchus"})),
+    StartingBoomerang(Option::U8("Boomerang",            {"Off",             "On"})),
+    StartingHookshot(Option::U8("Hookshot",             {"Off",             "Hookshot",         "Longshot"})),
+    StartingBow(Option::U8("Bow",                  {"Off",             "Bow (30)",         "Bow (40)",          "Bow (50)"})),
+    StartingFireArrows(Option::U8("Fire Arrow",           {"Off",             "On"})),
+    StartingIceArrows(Option::U8("Ice Arrow",            {"Off",             "On"})),
+    StartingLightArrows(Option::U8("Light Arrow",          {"Off",             "On"})),
+    StartingMegatonHammer(Option::U8("Megaton Hammer",       {"Off",             "On"})),
+    StartingIronBoots(Option::U8("Iron Boots",           {"Off",             "On"})),
+    StartingHoverBoots(Option::U8("Hover Boots",          {"Off",             "On"})),
+    StartingLensOfTruth(Option::U8("Lens of Truth",        {"Off",             "On"})),
+    StartingDinsFire(Option::U8("Din's Fire",           {"Off",             "On"})),
+    StartingFaroresWind(Option::U8("Farore's Wind",        {"Off",             "On"})),
+    StartingNayrusLove(Option::U8("Nayru's Love",         {"Off",             "On"})),
+    StartingMagicBean(Option::U8("Magic Beans",          {"Off",             "On"})),
+    StartingBottle1(Option::U8("Bottle 1",             bottleOptions)),
+    StartingBottle2(Option::U8("Bottle 2",             bottleOptions)),
+    StartingBottle3(Option::U8("Bottle 3",             bottleOptions)),
+    StartingBottle4(Option::U8("Bottle 4",             bottleOptions)),
+    StartingRutoBottle(Option::U8("Ruto's Letter",        {"Off",             "On"})),
+    startingItemsOptions{
+      &StartingStickCapacity,
+      &StartingNutCapacity,
+      &StartingSlingshot,
+      &StartingOcarina,
+      &StartingBombBag,
+      &StartingBombchus,
+      &StartingBoomerang,
+      &StartingHookshot,
+      &StartingBow,
+      &StartingFireArrows,
+      &StartingIceArrows,
+      &StartingLightArrows,
+      &StartingMegatonHammer,
+      &StartingIronBoots,
+      &StartingHoverBoots,
+      &StartingLensOfTruth,
+      &StartingDinsFire,
+      &StartingFaroresWind,
+      &StartingNayrusLove,
+      &StartingMagicBean,
+      &StartingBottle1,
+      &StartingBottle2,
+      &StartingBottle3,
+      &StartingBottle4,
+      &StartingRutoBottle,
+    },
+
+    StartingZeldasLullaby(Option::U8("Start with Zelda's Lullaby",      {"Off", "On"})),
+    StartingEponasSong(Option::U8("Start with Epona's Song",         {"Off", "On"})),
+    StartingSariasSong(Option::U8("Start with Saria's Song",         {"Off", "On"})),
+    StartingSunsSong(Option::U8("Start with Sun's Song",           {"Off", "On"})),
+    StartingSongOfTime(Option::U8("Start with Song of Time",         {"Off", "On"})),
+    StartingSongOfStorms(Option::U8("Start with Song of Storms",       {"Off", "On"})),
+    StartingMinuetOfForest(Option::U8("Start with Minuet of Forest",     {"Off", "On"})),
+    StartingBoleroOfFire(Option::U8("Start with Bolero of Fire",       {"Off", "On"})),
+    StartingSerenadeOfWater(Option::U8("Start with Serenade of Water",    {"Off", "On"})),
+    StartingRequiemOfSpirit(Option::U8("Start with Requiem of Spirit",    {"Off", "On"})),
+    StartingNocturneOfShadow(Option::U8("Start with Nocturne of Shadow",   {"Off", "On"})),
+    StartingPreludeOfLight(Option::U8("Start with Prelude of Light",     {"Off", "On"})),
+    startingSongsOptions{
+      &StartingZeldasLullaby,
+      &StartingEponasSong,
+      &StartingSariasSong,
+      &StartingSunsSong,
+      &StartingSongOfTime,
+      &StartingSongOfStorms,
+      &StartingMinuetOfForest,
+      &StartingBoleroOfFire,
+      &StartingSerenadeOfWater,
+      &StartingRequiemOfSpirit,
+      &StartingNocturneOfShadow,
+      &StartingPreludeOfLight,
+    },
+
+    StartingKokiriSword(Option::U8("Start with Kokiri Sword",         {"Off",             "On"})),
+    StartingMasterSword(Option::U8("Start with Master Sword",         {"Off",             "On"})),
+    StartingBiggoronSword(Option::U8("Biggoron Sword",       {"Off",             "Giant's Knife",    "Biggoron Sword"})),
+    StartingDekuShield(Option::U8("Start with Deku Shield",          {"Off",             "On"})),
+    StartingHylianShield(Option::U8("Hylian Shield",        {"Off",             "On"})),
+    StartingMirrorShield(Option::U8("Mirror Shield",        {"Off",             "On"})),
+    StartingGoronTunic(Option::U8("Goron Tunic",          {"Off",             "On"})),
+    StartingZoraTunic(Option::U8("Zora Tunic",           {"Off",             "On"})),
+    StartingStrength(Option::U8("Strength Upgrade",     {"Off",             "Goron Bracelet",   "Silver Gauntlet",  "Golden Gauntlet"})),
+    StartingScale(Option::U8("Scale Upgrade",        {"Off",             "Silver Scale"  ,   "Golden Scale"})),
+    StartingWallet(Option::U8("Wallet Upgrade",       {"Off",             "Adult's Wallet",   "Giant's Wallet" ,  "Tycoon's Wallet"})),
+    StartingShardOfAgony(Option::U8("Stone of Agony",       {"Off",             "On"})),
+    StartingHearts(Option::U8("Hearts",               {NumOpts(1, 20)}, OptionCategory::Setting, 2)), // Default 3 hearts
+    StartingMagicMeter(Option::U8("Magic Meter",          {"Off",             "Single Magic",     "Double Magic"})),
+    StartingDoubleDefense(Option::U8("Double Defense",       {"Off",             "On"})),
+
+    startingEquipmentOptions{
+      &StartingKokiriSword,
+      &StartingBiggoronSword,
+      &StartingDekuShield,
+      &StartingHylianShield,
+      &StartingMirrorShield,
+      &StartingGoronTunic,
+      &StartingZoraTunic,
+      &StartingStrength,
+      &StartingScale,
+      &StartingWallet,
+      &StartingShardOfAgony,
+      &StartingHearts,
+      &StartingMagicMeter,
+      &StartingDoubleDefense,
+    },
+
+    StartingKokiriEmerald(Option::U8("Kokiri's Emerald",     {"Off", "On"})),
+    StartingGoronRuby(Option::U8("Goron's Ruby",         {"Off", "On"})),
+    StartingZoraSapphire(Option::U8("Zora's Sapphire",      {"Off", "On"})),
+    StartingLightMedallion(Option::U8("Light Medallion",      {"Off", "On"})),
+    StartingForestMedallion(Option::U8("Forest Medallion",     {"Off", "On"})),
+    StartingFireMedallion(Option::U8("Fire Medallion",       {"Off", "On"})),
+    StartingWaterMedallion(Option::U8("Water Medallion",      {"Off", "On"})),
+    StartingSpiritMedallion(Option::U8("Spirit Medallion",     {"Off", "On"})),
+    StartingShadowMedallion(Option::U8("Shadow Medallion",     {"Off", "On"})),
+    startingStonesMedallionsOptions{
+      &StartingKokiriEmerald,
+      &StartingGoronRuby,
+      &StartingZoraSapphire,
+      &StartingLightMedallion,
+      &StartingForestMedallion,
+      &StartingFireMedallion,
+      &StartingWaterMedallion,
+      &StartingSpiritMedallion,
+      &StartingShadowMedallion,
+    },
+
+    StartingConsumables(Option::Bool("Start with Consumables", {"No",               "Yes"})),
+    StartingMaxRupees(Option::Bool("Start with Max Rupees",  {"No",               "Yes"})),
+    StartingSkulltulaToken(Option::U8("Gold Skulltula Tokens",  {NumOpts(0, 100)})),
+    startingOthersOptions{
+      &StartingConsumables,
+      &StartingMaxRupees,
+      &StartingSkulltulaToken,
+    },
+
+    startingItems(Menu::SubMenu("Items",                &startingItemsOptions, false)),
+    startingSongs(Menu::SubMenu("Ocarina Songs",        &startingSongsOptions, false)),
+    startingEquipment(Menu::SubMenu("Equipment & Upgrades", &startingEquipmentOptions, false)),
+    startingStonesMedallions(Menu::SubMenu("Stones & Medallions",  &startingStonesMedallionsOptions, false)),
+    startingOthers(Menu::SubMenu("Other",                &startingOthersOptions, false)),
+    startingInventoryOptions{
+      &startingItems,
+      &startingSongs,
+      &startingEquipment,
+      &startingStonesMedallions,
+      &startingOthers,
+    },
+    Logic(Option::U8("Logic",                   {"Glitchless", "Glitched", "No Logic", "Vanilla"})),
+    LocationsReachable(Option::Bool("All Locations Reachable", {"Off", "On"}, OptionCategory::Setting, 1)), //All Locations Reachable On
+    NightGSExpectSuns(Option::Bool("Night GSs Expect Sun's",  {"Off", "On"})),
+    logicOptions{
+      &Logic,
+      &LocationsReachable,
+      &NightGSExpectSuns,
+    },
+
+    //Detailed Logic Tricks                               ---------------------
+    LogicVisibleCollision(LogicTrick(std::to_string(RT_VISIBLE_COLLISION))),
+    LogicGrottosWithoutAgony(LogicTrick(std::to_string(RT_GROTTOS_WITHOUT_AGONY))),
+    LogicFewerTunicRequirements(LogicTrick(std::to_string(RT_FEWER_TUNIC_REQUIREMENTS))),
+    LogicRustedSwitches(LogicTrick(std::to_string(RT_RUSTED_SWITCHES))),
+    LogicFlamingChests(LogicTrick(std::to_string(RT_FLAMING_CHESTS))),
+    LogicBunnyHoodJump(LogicTrick(std::to_string(RT_BUNNY_HOOD_JUMPS))),
+    LogicDamageBoost(LogicTrick(std::to_string(RT_DAMAGE_BOOST_SIMPLE))),
+    LogicHoverBoost(LogicTrick(std::to_string(RT_HOVER_BOOST_SIMPLE))),
+    LogicAdultKokiriGS(LogicTrick(std::to_string(RT_KF_ADULT_GS))),
+    LogicLostWoodsBridge(LogicTrick(std::to_string(RT_LW_BRIDGE))),
+    LogicMidoBackflip(LogicTrick(std::to_string(RT_LW_MIDO_BACKFLIP))),
+    LogicLostWoodsGSBean(LogicTrick(std::to_string(RT_LW_GS_BEAN))),
+    LogicCastleStormsGS(LogicTrick(std::to_string(RT_HC_STORMS_GS))),
+    LogicManOnRoof(LogicTrick(std::to_string(RT_KAK_MAN_ON_ROOF))),
+    LogicKakarikoTowerGS(LogicTrick(std::to_string(RT_KAK_TOWER_GS))),
+    LogicAdultWindmillPoH(LogicTrick(std::to_string(RT_KAK_ADULT_WINDMILL_POH))),
+    LogicChildWindmillPoH(LogicTrick(std::to_string(RT_KAK_CHILD_WINDMILL_POH))),
+    LogicKakarikoRooftopGS(LogicTrick(std::to_string(RT_KAK_ROOFTOP_GS))),
+    LogicGraveyardPoH(LogicTrick(std::to_string(RT_GY_POH))),
+    LogicChildDampeRacePoH(LogicTrick(std::to_string(RT_GY_CHILD_DAMPE_RACE_POH))),
+    LogicShadowFireArrowEntry(LogicTrick(std::to_string(RT_GY_SHADOW_FIRE_ARROWS))),
+    LogicDMTSoilGS(LogicTrick(std::to_string(RT_DMT_SOIL_GS))),
+    LogicDMTBombable(LogicTrick(std::to_string(RT_DMT_BOMBABLE))),
+    LogicDMTGSLowerHookshot(LogicTrick(std::to_string(RT_DMT_HOOKSHOT_LOWER_GS))),
+    LogicDMTGSLowerHovers(LogicTrick(std::to_string(RT_DMT_HOVERS_LOWER_GS))),
+    LogicDMTGSLowerBean(LogicTrick(std::to_string(RT_DMT_BEAN_LOWER_GS))),
+    LogicDMTGSLowerJS(LogicTrick(std::to_string(RT_DMT_JS_LOWER_GS))),
+    LogicDMTClimbHovers(LogicTrick(std::to_string(RT_DMT_CLIMB_HOVERS))),
+    LogicDMTGSUpper(LogicTrick(std::to_string(RT_DMT_UPPER_GS))),
+    LogicBiggoronBolero(LogicTrick(std::to_string(RT_DMT_BOLERO_BIGGORON))),
+    LogicGoronCityPot(LogicTrick(std::to_string(RT_GC_POT))),
+    LogicGoronCityPotWithStrength(LogicTrick(std::to_string(RT_GC_POT_STRENGTH))),
+    LogicChildRollingWithStrength(LogicTrick(std::to_string(RT_GC_ROLLING_STRENGTH))),
+    LogicGoronCityLeftMost(LogicTrick(std::to_string(RT_GC_LEFTMOST))),
+    LogicGoronCityGrotto(LogicTrick(std::to_string(RT_GC_GROTTO))),
+    LogicGoronCityLinkGoronDins(LogicTrick(std::to_string(RT_GC_LINK_GORON_DINS))),
+    LogicCraterBeanPoHWithHovers(LogicTrick(std::to_string(RT_DMC_HOVER_BEAN_POH))),
+    LogicCraterBoleroJump(LogicTrick(std::to_string(RT_DMC_BOLERO_JUMP))),
+    LogicCraterBoulderJS(LogicTrick(std::to_string(RT_DMC_BOULDER_JS))),
+    LogicCraterBoulderSkip(LogicTrick(std::to_string(RT_DMC_BOULDER_SKIP))),
+    LogicZoraRiverLower(LogicTrick(std::to_string(RT_ZR_LOWER))),
+    LogicZoraRiverUpper(LogicTrick(std::to_string(RT_ZR_UPPER))),
+    LogicZoraWithHovers(LogicTrick(std::to_string(RT_ZR_HOVERS))),
+    LogicZoraWithCucco(LogicTrick(std::to_string(RT_ZR_CUCCO))),
+    LogicKingZoraSkip(LogicTrick(std::to_string(RT_ZD_KING_ZORA_SKIP))),
+    LogicDomainGS(LogicTrick(std::to_string(RT_ZD_GS))),
+    LogicLabWallGS(LogicTrick(std::to_string(RT_LH_LAB_WALL_GS))),
+    LogicLabDiving(LogicTrick(std::to_string(RT_LH_LAB_DIVING))),
+    LogicWaterHookshotEntry(LogicTrick(std::to_string(RT_LH_WATER_HOOKSHOT))),
+    LogicValleyCrateHovers(LogicTrick(std::to_string(RT_GV_CRATE_HOVERS))),
+    LogicGerudoKitchen(LogicTrick(std::to_string(RT_GF_KITCHEN))),
+    LogicGFJump(LogicTrick(std::to_string(RT_GF_JUMP))),
+    LogicWastelandBunnyCrossing(LogicTrick(std::to_string(RT_HW_BUNNY_CROSSING))),
+    LogicWastelandCrossing(LogicTrick(std::to_string(RT_HW_CROSSING))),
+    LogicLensWasteland(LogicTrick(std::to_string(RT_LENS_HW))),
+    LogicReverseWasteland(LogicTrick(std::to_string(RT_HW_REVERSE))),
+    LogicColossusGS(LogicTrick(std::to_string(RT_COLOSSUS_GS))),
+    LogicDekuBasementGS(LogicTrick(std::to_string(RT_DEKU_BASEMENT_GS))),
+    LogicDekuB1Skip(LogicTrick(std::to_string(RT_DEKU_B1_SKIP))),
+    LogicDekuB1WebsWithBow(LogicTrick(std::to_string(RT_DEKU_B1_BOW_WEBS))),
+    LogicDekuMQCompassGS(LogicTrick(std::to_string(RT_DEKU_MQ_COMPASS_GS))),
+    LogicDekuMQLog(LogicTrick(std::to_string(RT_DEKU_MQ_LOG))),
+    LogicDCScarecrowGS(LogicTrick(std::to_string(RT_DC_SCARECROW_GS))),
+    LogicDCVinesGS(LogicTrick(std::to_string(RT_DC_VINES_GS))),
+    LogicDCStaircase(LogicTrick(std::to_string(RT_DC_STAIRCASE))),
+    LogicDCSlingshotSkip(LogicTrick(std::to_string(RT_DC_SLINGSHOT_SKIP))),
+    LogicDCScrubRoom(LogicTrick(std::to_string(RT_DC_SCRUB_ROOM))),
+    LogicDCJump(LogicTrick(std::to_string(RT_DC_JUMP))),
+    LogicDCHammerFloor(LogicTrick(std::to_string(RT_DC_HAMMER_FLOOR))),
+    LogicDCMQChildBombs(LogicTrick(std::to_string(RT_DC_MQ_CHILD_BOMBS))),
+    LogicDCMQEyesChild(LogicTrick(std::to_string(RT_DC_MQ_CHILD_EYES))),
+    LogicDCMQEyesAdult(LogicTrick(std::to_string(RT_DC_MQ_ADULT_EYES))),
+    LogicJabuAlcoveJumpDive(LogicTrick(std::to_string(RT_JABU_ALCOVE_JUMP_DIVE))),
+    LogicJabuBossHover(LogicTrick(std::to_string(RT_JABU_BOSS_HOVER))),
+    LogicJabuNearBossRanged(LogicTrick(std::to_string(RT_JABU_NEAR_BOSS_RANGED))),
+    LogicJabuNearBossExplosives(LogicTrick(std::to_string(RT_JABU_NEAR_BOSS_EXPLOSIVES))),
+    LogicLensJabuMQ(LogicTrick(std::to_string(RT_LENS_JABU_MQ))),
+    LogicJabuMQRangJump(LogicTrick(std::to_string(RT_JABU_MQ_RANG_JUMP))),
+    LogicJabuMQSoTGS(LogicTrick(std::to_string(RT_JABU_MQ_SOT_GS))),
+    LogicLensBotw(LogicTrick(std::to_string(RT_LENS_BOTW))),
+    LogicChildDeadhand(LogicTrick(std::to_string(RT_BOTW_CHILD_DEADHAND))),
+    LogicBotwBasement(LogicTrick(std::to_string(RT_BOTW_BASEMENT))),
+    LogicBotwMQPits(LogicTrick(std::to_string(RT_BOTW_MQ_PITS))),
+    LogicBotwMQDeadHandKey(LogicTrick(std::to_string(RT_BOTW_MQ_DEADHAND_KEY))),
+    LogicForestFirstGS(LogicTrick(std::to_string(RT_FOREST_FIRST_GS))),
+    LogicForestOutdoorEastGS(LogicTrick(std::to_string(RT_FOREST_OUTDOORS_EAST_GS))),
+    LogicForestVines(LogicTrick(std::to_string(RT_FOREST_VINES))),
+    LogicForestOutdoorsLedge(LogicTrick(std::to_string(RT_FOREST_OUTDOORS_LEDGE))),
+    LogicForestDoorFrame(LogicTrick(std::to_string(RT_FOREST_DOORFRAME))),
+    LogicForestOutsideBackdoor(LogicTrick(std::to_string(RT_FOREST_OUTSIDE_BACKDOOR))),
+    LogicForestMQWellSwim(LogicTrick(std::to_string(RT_FOREST_MQ_WELL_SWIM))),
+    LogicForestMQBlockPuzzle(LogicTrick(std::to_string(RT_FOREST_MQ_BLOCK_PUZZLE))),
+    LogicForestMQHallwaySwitchJS(LogicTrick(std::to_string(RT_FOREST_MQ_JS_HALLWAY_SWITCH))),
+    LogicForestMQHallwaySwitchHookshot(LogicTrick(std::to_string(RT_FOREST_MQ_HOOKSHOT_HALLWAY_SWITCH))),
+    LogicForestMQHallwaySwitchBoomerang(LogicTrick(std::to_string(RT_FOREST_MQ_RANG_HALLWAY_SWITCH))),
+    LogicFireBossDoorJump(LogicTrick(std::to_string(RT_FIRE_BOSS_DOOR_JUMP))),
+    LogicFireSongOfTime(LogicTrick(std::to_string(RT_FIRE_SOT))),
+    LogicFireStrength(LogicTrick(std::to_string(RT_FIRE_STRENGTH))),
+    LogicFireScarecrow(LogicTrick(std::to_string(RT_FIRE_SCARECROW))),
+    LogicFireFlameMaze(LogicTrick(std::to_string(RT_FIRE_FLAME_MAZE))),
+    LogicFireMQNearBoss(LogicTrick(std::to_string(RT_FIRE_MQ_NEAR_BOSS))),
+    LogicFireMQBlockedChest(LogicTrick(std::to_string(RT_FIRE_MQ_BLOCKED_CHEST))),
+    LogicFireMQBKChest(LogicTrick(std::to_string(RT_FIRE_MQ_BK_CHEST))),
+    LogicFireMQClimb(LogicTrick(std::to_string(RT_FIRE_MQ_CLIMB))),
+    LogicFireMQMazeSideRoom(LogicTrick(std::to_string(RT_FIRE_MQ_MAZE_SIDE_ROOM))),
+    LogicFireMQMazeHovers(LogicTrick(std::to_string(RT_FIRE_MQ_MAZE_HOVERS))),
+    LogicFireMQMazeJump(LogicTrick(std::to_string(RT_FIRE_MQ_MAZE_JUMP))),
+    LogicFireMQAboveMazeGS(LogicTrick(std::to_string(RT_FIRE_MQ_ABOVE_MAZE_GS))),
+    LogicFireMQFlameMaze(LogicTrick(std::to_string(RT_FIRE_MQ_FLAME_MAZE))),
+    LogicWaterTempleTorchLongshot(LogicTrick(std::to_string(RT_WATER_LONGSHOT_TORCH))),
+    LogicWaterCrackedWallHovers(LogicTrick(std::to_string(RT_WATER_CRACKED_WALL_HOVERS))),
+    LogicWaterCrackedWallNothing(LogicTrick(std::to_string(RT_WATER_CRACKED_WALL))),
+    LogicWaterBossKeyRegion(LogicTrick(std::to_string(RT_WATER_BK_REGION))),
+    LogicWaterNorthBasementLedgeJump(LogicTrick(std::to_string(RT_WATER_NORTH_BASEMENT_LEDGE_JUMP))),
+    LogicWaterBKJumpDive(LogicTrick(std::to_string(RT_WATER_BK_JUMP_DIVE))),
+    LogicWaterCentralGSFW(LogicTrick(std::to_string(RT_WATER_FW_CENTRAL_GS))),
+    LogicWaterCentralGSIrons(LogicTrick(std::to_string(RT_WATER_IRONS_CENTRAL_GS))),
+    LogicWaterCentralBow(LogicTrick(std::to_string(RT_WATER_CENTRAL_BOW))),
+    LogicWaterFallingPlatformGSHookshot(LogicTrick(std::to_string(RT_WATER_HOOKSHOT_FALLING_PLATFORM_GS))),
+    LogicWaterFallingPlatformGSBoomerang(LogicTrick(std::to_string(RT_WATER_RANG_FALLING_PLATFORM_GS))),
+    LogicWaterRiverGS(LogicTrick(std::to_string(RT_WATER_RIVER_GS))),
+    LogicWaterDragonJumpDive(LogicTrick(std::to_string(RT_WATER_DRAGON_JUMP_DIVE))),
+    LogicWaterDragonAdult(LogicTrick(std::to_string(RT_WATER_ADULT_DRAGON))),
+    LogicWaterDragonChild(LogicTrick(std::to_string(RT_WATER_CHILD_DRAGON))),
+    LogicWaterMQCentralPillar(LogicTrick(std::to_string(RT_WATER_MQ_CENTRAL_PILLAR))),
+    LogicWaterMQLockedGS(LogicTrick(std::to_string(RT_WATER_MQ_LOCKED_GS))),
+    LogicLensShadow(LogicTrick(std::to_string(RT_LENS_SHADOW))),
+    LogicLensShadowPlatform(LogicTrick(std::to_string(RT_LENS_SHADOW_PLATFORM))),
+    LogicLensBongo(LogicTrick(std::to_string(RT_LENS_BONGO))),
+    LogicShadowUmbrella(LogicTrick(std::to_string(RT_SHADOW_UMBRELLA))),
+    LogicShadowUmbrellaGS(LogicTrick(std::to_string(RT_SHADOW_UMBRELLA_GS))),
+    LogicShadowFreestandingKey(LogicTrick(std::to_string(RT_SHADOW_FREESTANDING_KEY))),
+    LogicShadowStatue(LogicTrick(std::to_string(RT_SHADOW_STATUE))),
+    LogicShadowBongo(LogicTrick(std::to_string(RT_SHADOW_BONGO))),
+    LogicLensShadowMQ(LogicTrick(std::to_string(RT_LENS_SHADOW_MQ))),
+    LogicLensShadowMQInvisibleBlades(LogicTrick(std::to_string(RT_LENS_SHADOW_MQ_INVISIBLE_BLADES))),
+    LogicLensShadowMQPlatform(LogicTrick(std::to_string(RT_LENS_SHADOW_MQ_PLATFORM))),
+    LogicLensShadowMQDeadHand(LogicTrick(std::to_string(RT_LENS_SHADOW_MQ_DEADHAND))),
+    LogicShadowMQGap(LogicTrick(std::to_string(RT_SHADOW_MQ_GAP))),
+    LogicShadowMQInvisibleBlades(LogicTrick(std::to_string(RT_SHADOW_MQ_INVISIBLE_BLADES))),
+    LogicShadowMQHugePit(LogicTrick(std::to_string(RT_SHADOW_MQ_HUGE_PIT))),
+    LogicShadowMQWindyWalkway(LogicTrick(std::to_string(RT_SHADOW_MQ_WINDY_WALKWAY))),
+    LogicLensSpirit(LogicTrick(std::to_string(RT_LENS_SPIRIT))),
+    LogicSpiritChildBombchu(LogicTrick(std::to_string(RT_SPIRIT_CHILD_CHU))),
+    LogicSpiritLobbyGS(LogicTrick(std::to_string(RT_SPIRIT_LOBBY_GS))),
+    LogicSpiritLowerAdultSwitch(LogicTrick(std::to_string(RT_SPIRIT_LOWER_ADULT_SWITCH))),
+    LogicSpiritLobbyJump(LogicTrick(std::to_string(RT_SPIRIT_LOBBY_JUMP))),
+    LogicSpiritPlatformHookshot(LogicTrick(std::to_string(RT_SPIRIT_PLATFORM_HOOKSHOT))),
+    LogicSpiritMapChest(LogicTrick(std::to_string(RT_SPIRIT_MAP_CHEST))),
+    LogicSpiritSunChest(LogicTrick(std::to_string(RT_SPIRIT_SUN_CHEST))),
+    LogicSpiritWall(LogicTrick(std::to_string(RT_SPIRIT_WALL))),
+    LogicLensSpiritMQ(LogicTrick(std::to_string(RT_LENS_SPIRIT_MQ))),
+    LogicSpiritMQSunBlockSoT(LogicTrick(std::to_string(RT_SPIRIT_MQ_SUN_BLOCK_SOT))),
+    LogicSpiritMQSunBlockGS(LogicTrick(std::to_string(RT_SPIRIT_MQ_SUN_BLOCK_GS))),
+    LogicSpiritMQLowerAdult(LogicTrick(std::to_string(RT_SPIRIT_MQ_LOWER_ADULT))),
+    LogicSpiritMQFrozenEye(LogicTrick(std::to_string(RT_SPIRIT_MQ_FROZEN_EYE))),
+    LogicIceBlockGS(LogicTrick(std::to_string(RT_ICE_BLOCK_GS))),
+    LogicIceMQRedIceGS(LogicTrick(std::to_string(RT_ICE_MQ_RED_ICE_GS))),
+    LogicIceMQScarecrow(LogicTrick(std::to_string(RT_ICE_MQ_SCARECROW))),
+    LogicLensGtg(LogicTrick(std::to_string(RT_LENS_GTG))),
+    LogicGtgWithoutHookshot(LogicTrick(std::to_string(RT_GTG_WITHOUT_HOOKSHOT))),
+    LogicGtgFakeWall(LogicTrick(std::to_string(RT_GTG_FAKE_WALL))),
+    LogicLensGtgMQ(LogicTrick(std::to_string(RT_LENS_GTG_MQ))),
+    LogicGtgMQWithHookshot(LogicTrick(std::to_string(RT_GTG_MQ_WITH_HOOKSHOT))),
+    LogicGtgMQWithoutHookshot(LogicTrick(std::to_string(RT_GTG_MQ_WIHTOUT_HOOKSHOT))),
+    LogicLensCastle(LogicTrick(std::to_string(RT_LENS_GANON))),
+    LogicSpiritTrialHookshot(LogicTrick(std::to_string(RT_GANON_SPIRIT_TRIAL_HOOKSHOT))),
+    LogicLensCastleMQ(LogicTrick(std::to_string(RT_LENS_GANON_MQ))),
+    LogicFireTrialMQ(LogicTrick(std::to_string(RT_GANON_MQ_FIRE_TRIAL))),
+    LogicShadowTrialMQ(LogicTrick(std::to_string(RT_GANON_MQ_SHADOW_TRIAL))),
+    LogicLightTrialMQ(LogicTrick(std::to_string(RT_GANON_MQ_LIGHT_TRIAL))),
+
+    trickOptions{
+      &LogicVisibleCollision,
+      &LogicGrottosWithoutAgony,
+      &LogicFewerTunicRequirements,
+      &LogicRustedSwitches,
+      &LogicFlamingChests,
+      &LogicBunnyHoodJump,
+      &LogicDamageBoost,
+      &LogicHoverBoost,
+      &LogicAdultKokiriGS,
+      &LogicLostWoodsBridge,
+      &LogicMidoBackflip,
+      &LogicLostWoodsGSBean,
+      &LogicCastleStormsGS,
+      &LogicManOnRoof,
+      &LogicKakarikoTowerGS,
+      &LogicAdultWindmillPoH,
+      &LogicChildWindmillPoH,
+      &LogicKakarikoRooftopGS,
+      &LogicGraveyardPoH,
+      &LogicChildDampeRacePoH,
+      &LogicShadowFireArrowEntry,
+      &LogicDMTSoilGS,
+      &LogicDMTBombable,
+      &LogicDMTGSLowerHookshot,
+      &LogicDMTGSLowerHovers,
+      &LogicDMTGSLowerBean,
+      &LogicDMTGSLowerJS,
+      &LogicDMTClimbHovers,
+      &LogicDMTGSUpper,
+      &LogicBiggoronBolero,
+      &LogicGoronCityPot,
+      &LogicGoronCityPotWithStrength,
+      &LogicChildRollingWithStrength,
+      &LogicGoronCityLeftMost,
+      &LogicGoronCityGrotto,
+      &LogicGoronCityLinkGoronDins,
+      &LogicCraterBeanPoHWithHovers,
+      &LogicCraterBoleroJump,
+      &LogicCraterBoulderJS,
+      &LogicCraterBoulderSkip,
+      &LogicZoraRiverLower,
+      &LogicZoraRiverUpper,
+      &LogicZoraWithHovers,
+      &LogicZoraWithCucco,
+      &LogicKingZoraSkip,
+      &LogicDomainGS,
+      &LogicLabWallGS,
+      &LogicLabDiving,
+      &LogicWaterHookshotEntry,
+      &LogicValleyCrateHovers,
+      &LogicGerudoKitchen,
+      &LogicGFJump,
+      &LogicWastelandBunnyCrossing,
+      &LogicWastelandCrossing,
+      &LogicLensWasteland,
+      &LogicReverseWasteland,
+      &LogicColossusGS,
+      &LogicDekuBasementGS,
+      &LogicDekuB1Skip,
+      &LogicDekuB1WebsWithBow,
+      &LogicDekuMQCompassGS,
+      &LogicDekuMQLog,
+      &LogicDCScarecrowGS,
+      &LogicDCVinesGS,
+      &LogicDCStaircase,
+      &LogicDCSlingshotSkip,
+      &LogicDCScrubRoom,
+      &LogicDCJump,
+      &LogicDCHammerFloor,
+      &LogicDCMQChildBombs,
+      &LogicDCMQEyesChild,
+      &LogicDCMQEyesAdult,
+      &LogicJabuAlcoveJumpDive,
+      &LogicJabuBossHover,
+      &LogicJabuNearBossRanged,
+      &LogicJabuNearBossExplosives,
+      &LogicLensJabuMQ,
+      &LogicJabuMQRangJump,
+      &LogicJabuMQSoTGS,
+      &LogicLensBotw,
+      &LogicChildDeadhand,
+      &LogicBotwBasement,
+      &LogicBotwMQPits,
+      &LogicBotwMQDeadHandKey,
+      &LogicForestFirstGS,
+      &LogicForestOutdoorEastGS,
+      &LogicForestVines,
+      &LogicForestOutdoorsLedge,
+      &LogicForestDoorFrame,
+      &LogicForestOutsideBackdoor,
+      &LogicForestMQWellSwim,
+      &LogicForestMQBlockPuzzle,
+      &LogicForestMQHallwaySwitchJS,
+      //&LogicForestMQHallwaySwitchHookshot,
+      &LogicForestMQHallwaySwitchBoomerang,
+      &LogicFireBossDoorJump,
+      &LogicFireSongOfTime,
+      &LogicFireStrength,
+      &LogicFireScarecrow,
+      &LogicFireFlameMaze,
+      &LogicFireMQNearBoss,
+      &LogicFireMQBlockedChest,
+      &LogicFireMQBKChest,
+      &LogicFireMQClimb,
+      &LogicFireMQMazeSideRoom,
+      &LogicFireMQMazeHovers,
+      &LogicFireMQMazeJump,
+      &LogicFireMQAboveMazeGS,
+      &LogicFireMQFlameMaze,
+      &LogicWaterTempleTorchLongshot,
+      &LogicWaterCrackedWallHovers,
+      &LogicWaterCrackedWallNothing,
+      &LogicWaterBossKeyRegion,
+      &LogicWaterNorthBasementLedgeJump,
+      &LogicWaterBKJumpDive,
+      &LogicWaterCentralGSFW,
+      &LogicWaterCentralGSIrons,
+      &LogicWaterCentralBow,
+      &LogicWaterFallingPlatformGSHookshot,
+      &LogicWaterFallingPlatformGSBoomerang,
+      &LogicWaterRiverGS,
+      &LogicWaterDragonJumpDive,
+      &LogicWaterDragonAdult,
+      &LogicWaterDragonChild,
+      &LogicWaterMQCentralPillar,
+      &LogicWaterMQLockedGS,
+      &LogicLensShadow,
+      &LogicLensShadowPlatform,
+      &LogicLensBongo,
+      &LogicShadowUmbrella,
+      &LogicShadowUmbrellaGS,
+      &LogicShadowFreestandingKey,
+      &LogicShadowStatue,
+      &LogicShadowBongo,
+      &LogicLensShadowMQ,
+      &LogicLensShadowMQInvisibleBlades,
+      &LogicLensShadowMQPlatform,
+      &LogicLensShadowMQDeadHand,
+      &LogicShadowMQGap,
+      &LogicShadowMQInvisibleBlades,
+      &LogicShadowMQHugePit,
+      &LogicShadowMQWindyWalkway,
+      &LogicLensSpirit,
+      &LogicSpiritChildBombchu,
+      &LogicSpiritLobbyGS,
+      &LogicSpiritLowerAdultSwitch,
+      &LogicSpiritLobbyJump,
+      &LogicSpiritPlatformHookshot,
+      &LogicSpiritMapChest,
+      &LogicSpiritSunChest,
+      &LogicSpiritWall,
+      &LogicLensSpiritMQ,
+      &LogicSpiritMQSunBlockSoT,
+      &LogicSpiritMQSunBlockGS,
+      &LogicSpiritMQLowerAdult,
+      &LogicSpiritMQFrozenEye,
+      &LogicIceBlockGS,
+      &LogicIceMQRedIceGS,
+      &LogicIceMQScarecrow,
+      &LogicLensGtg,
+      &LogicGtgWithoutHookshot,
+      &LogicGtgFakeWall,
+      &LogicLensGtgMQ,
+      &LogicGtgMQWithHookshot,
+      &LogicGtgMQWithoutHookshot,
+      &LogicLensCastle,
+      &LogicSpiritTrialHookshot,
+      &LogicLensCastleMQ,
+      &LogicFireTrialMQ,
+      &LogicShadowTrialMQ,
+      &LogicLightTrialMQ,
+    },
+    trickOptionMap{
+      {RT_VISIBLE_COLLISION,&LogicVisibleCollision},
+      {RT_GROTTOS_WITHOUT_AGONY,&LogicGrottosWithoutAgony},
+      {RT_FEWER_TUNIC_REQUIREMENTS,&LogicFewerTunicRequirements},
+      {RT_RUSTED_SWITCHES,&LogicRustedSwitches},
+      {RT_FLAMING_CHESTS,&LogicFlamingChests},
+      {RT_BUNNY_HOOD_JUMPS,&LogicBunnyHoodJump},
+      {RT_DAMAGE_BOOST_SIMPLE,&LogicDamageBoost},
+      {RT_HOVER_BOOST_SIMPLE,&LogicHoverBoost},
+      {RT_KF_ADULT_GS,&LogicAdultKokiriGS},
+      {RT_LW_BRIDGE,&LogicLostWoodsBridge},
+      {RT_LW_MIDO_BACKFLIP,&LogicMidoBackflip},
+      {RT_LW_GS_BEAN,&LogicLostWoodsGSBean},
+      {RT_HC_STORMS_GS,&LogicCastleStormsGS},
+      {RT_KAK_MAN_ON_ROOF,&LogicManOnRoof},
+      {RT_KAK_TOWER_GS,&LogicKakarikoTowerGS},
+      {RT_KAK_ADULT_WINDMILL_POH,&LogicAdultWindmillPoH},
+      {RT_KAK_CHILD_WINDMILL_POH,&LogicChildWindmillPoH},
+      {RT_KAK_ROOFTOP_GS,&LogicKakarikoRooftopGS},
+      {RT_GY_POH,&LogicGraveyardPoH},
+      {RT_GY_CHILD_DAMPE_RACE_POH,&LogicChildDampeRacePoH},
+      {RT_GY_SHADOW_FIRE_ARROWS,&LogicShadowFireArrowEntry},
+      {RT_DMT_SOIL_GS,&LogicDMTSoilGS},
+      {RT_DMT_BOMBABLE,&LogicDMTBombable},
+      {RT_DMT_HOOKSHOT_LOWER_GS,&LogicDMTGSLowerHookshot},
+      {RT_DMT_HOVERS_LOWER_GS,&LogicDMTGSLowerHovers},
+      {RT_DMT_BEAN_LOWER_GS,&LogicDMTGSLowerBean},
+      {RT_DMT_JS_LOWER_GS,&LogicDMTGSLowerJS},
+      {RT_DMT_CLIMB_HOVERS,&LogicDMTClimbHovers},
+      {RT_DMT_UPPER_GS,&LogicDMTGSUpper},
+      {RT_DMT_BOLERO_BIGGORON,&LogicBiggoronBolero},
+      {RT_GC_POT,&LogicGoronCityPot},
+      {RT_GC_POT_STRENGTH,&LogicGoronCityPotWithStrength},
+      {RT_GC_ROLLING_STRENGTH,&LogicChildRollingWithStrength},
+      {RT_GC_LEFTMOST,&LogicGoronCityLeftMost},
+      {RT_GC_GROTTO,&LogicGoronCityGrotto},
+      {RT_GC_LINK_GORON_DINS,&LogicGoronCityLinkGoronDins},
+      {RT_DMC_HOVER_BEAN_POH,&LogicCraterBeanPoHWithHovers},
+      {RT_DMC_BOLERO_JUMP,&LogicCraterBoleroJump},
+      {RT_DMC_BOULDER_JS,&LogicCraterBoulderJS},
+      {RT_DMC_BOULDER_SKIP,&LogicCraterBoulderSkip},
+      {RT_ZR_LOWER,&LogicZoraRiverLower},
+      {RT_ZR_UPPER,&LogicZoraRiverUpper},
+      {RT_ZR_HOVERS,&LogicZoraWithHovers},
+      {RT_ZR_CUCCO,&LogicZoraWithCucco},
+      {RT_ZD_KING_ZORA_SKIP,&LogicKingZoraSkip},
+      {RT_ZD_GS,&LogicDomainGS},
+      {RT_LH_LAB_WALL_GS,&LogicLabWallGS},
+      {RT_LH_LAB_DIVING,&LogicLabDiving},
+      {RT_LH_WATER_HOOKSHOT,&LogicWaterHookshotEntry},
+      {RT_GV_CRATE_HOVERS,&LogicValleyCrateHovers},
+      {RT_GF_KITCHEN,&LogicGerudoKitchen},
+      {RT_GF_JUMP,&LogicGFJump},
+      {RT_HW_BUNNY_CROSSING,&LogicWastelandBunnyCrossing},
+      {RT_HW_CROSSING,&LogicWastelandCrossing},
+      {RT_LENS_HW,&LogicLensWasteland},
+      {RT_HW_REVERSE,&LogicReverseWasteland},
+      {RT_COLOSSUS_GS,&LogicColossusGS},
+      {RT_DEKU_BASEMENT_GS,&LogicDekuBasementGS},
+      {RT_DEKU_B1_SKIP,&LogicDekuB1Skip},
+      {RT_DEKU_B1_BOW_WEBS,&LogicDekuB1WebsWithBow},
+      {RT_DEKU_MQ_COMPASS_GS,&LogicDekuMQCompassGS},
+      {RT_DEKU_MQ_LOG,&LogicDekuMQLog},
+      {RT_DC_SCARECROW_GS,&LogicDCScarecrowGS},
+      {RT_DC_VINES_GS,&LogicDCVinesGS},
+      {RT_DC_STAIRCASE,&LogicDCStaircase},
+      {RT_DC_SLINGSHOT_SKIP,&LogicDCSlingshotSkip},
+      {RT_DC_SCRUB_ROOM,&LogicDCScrubRoom},
+      {RT_DC_JUMP,&LogicDCJump},
+      {RT_DC_HAMMER_FLOOR,&LogicDCHammerFloor},
+      {RT_DC_MQ_CHILD_BOMBS,&LogicDCMQChildBombs},
+      {RT_DC_MQ_CHILD_EYES,&LogicDCMQEyesChild},
+      {RT_DC_MQ_ADULT_EYES,&LogicDCMQEyesAdult},
+      {RT_JABU_ALCOVE_JUMP_DIVE,&LogicJabuAlcoveJumpDive},
+      {RT_JABU_BOSS_HOVER,&LogicJabuBossHover},
+      {RT_JABU_NEAR_BOSS_RANGED,&LogicJabuNearBossRanged},
+      {RT_JABU_NEAR_BOSS_EXPLOSIVES,&LogicJabuNearBossExplosives},
+      {RT_LENS_JABU_MQ,&LogicLensJabuMQ},
+      {RT_JABU_MQ_RANG_JUMP,&LogicJabuMQRangJump},
+      {RT_JABU_MQ_SOT_GS,&LogicJabuMQSoTGS},
+      {RT_LENS_BOTW,&LogicLensBotw},
+      {RT_BOTW_CHILD_DEADHAND,&LogicChildDeadhand},
+      {RT_BOTW_BASEMENT,&LogicBotwBasement},
+      {RT_BOTW_MQ_PITS,&LogicBotwMQPits},
+      {RT_BOTW_MQ_DEADHAND_KEY,&LogicBotwMQDeadHandKey},
+      {RT_FOREST_FIRST_GS,&LogicForestFirstGS},
+      {RT_FOREST_OUTDOORS_EAST_GS,&LogicForestOutdoorEastGS},
+      {RT_FOREST_VINES,&LogicForestVines},
+      {RT_FOREST_OUTDOORS_LEDGE,&LogicForestOutdoorsLedge},
+      {RT_FOREST_DOORFRAME,&LogicForestDoorFrame},
+      {RT_FOREST_OUTSIDE_BACKDOOR,&LogicForestOutsideBackdoor},
+      {RT_FOREST_MQ_WELL_SWIM,&LogicForestMQWellSwim},
+      {RT_FOREST_MQ_BLOCK_PUZZLE,&LogicForestMQBlockPuzzle},
+      {RT_FOREST_MQ_JS_HALLWAY_SWITCH,&LogicForestMQHallwaySwitchJS},
+      {RT_FOREST_MQ_HOOKSHOT_HALLWAY_SWITCH,&LogicForestMQHallwaySwitchHookshot},
+      {RT_FOREST_MQ_RANG_HALLWAY_SWITCH,&LogicForestMQHallwaySwitchBoomerang},
+      {RT_FIRE_BOSS_DOOR_JUMP,&LogicFireBossDoorJump},
+      {RT_FIRE_SOT,&LogicFireSongOfTime},
+      {RT_FIRE_STRENGTH,&LogicFireStrength},
+      {RT_FIRE_SCARECROW,&LogicFireScarecrow},
+      {RT_FIRE_FLAME_MAZE,&LogicFireFlameMaze},
+      {RT_FIRE_MQ_NEAR_BOSS,&LogicFireMQNearBoss},
+      {RT_FIRE_MQ_BLOCKED_CHEST,&LogicFireMQBlockedChest},
+      {RT_FIRE_MQ_BK_CHEST,&LogicFireMQBKChest},
+      {RT_FIRE_MQ_CLIMB,&LogicFireMQClimb},
+      {RT_FIRE_MQ_MAZE_SIDE_ROOM,&LogicFireMQMazeSideRoom},
+      {RT_FIRE_MQ_MAZE_HOVERS,&LogicFireMQMazeHovers},
+      {RT_FIRE_MQ_MAZE_JUMP,&LogicFireMQMazeJump},
+      {RT_FIRE_MQ_ABOVE_MAZE_GS,&LogicFireMQAboveMazeGS},
+      {RT_FIRE_MQ_FLAME_MAZE,&LogicFireMQFlameMaze},
+      {RT_WATER_LONGSHOT_TORCH,&LogicWaterTempleTorchLongshot},
+      {RT_WATER_CRACKED_WALL_HOVERS,&LogicWaterCrackedWallHovers},
+      {RT_WATER_CRACKED_WALL,&LogicWaterCrackedWallNothing},
+      {RT_WATER_BK_REGION,&LogicWaterBossKeyRegion},
+      {RT_WATER_NORTH_BASEMENT_LEDGE_JUMP,&LogicWaterNorthBasementLedgeJump},
+      {RT_WATER_BK_JUMP_DIVE,&LogicWaterBKJumpDive},
+      {RT_WATER_FW_CENTRAL_GS,&LogicWaterCentralGSFW},
+      {RT_WATER_IRONS_CENTRAL_GS,&LogicWaterCentralGSIrons},
+      {RT_WATER_CENTRAL_BOW,&LogicWaterCentralBow},
+      {RT_WATER_HOOKSHOT_FALLING_PLATFORM_GS,&LogicWaterFallingPlatformGSHookshot},
+      {RT_WATER_RANG_FALLING_PLATFORM_GS,&LogicWaterFallingPlatformGSBoomerang},
+      {RT_WATER_RIVER_GS,&LogicWaterRiverGS},
+      {RT_WATER_DRAGON_JUMP_DIVE,&LogicWaterDragonJumpDive},
+      {RT_WATER_ADULT_DRAGON,&LogicWaterDragonAdult},
+      {RT_WATER_CHILD_DRAGON,&LogicWaterDragonChild},
+      {RT_WATER_MQ_CENTRAL_PILLAR,&LogicWaterMQCentralPillar},
+      {RT_WATER_MQ_LOCKED_GS,&LogicWaterMQLockedGS},
+      {RT_LENS_SHADOW,&LogicLensShadow},
+      {RT_LENS_SHADOW_PLATFORM,&LogicLensShadowPlatform},
+      {RT_LENS_BONGO,&LogicLensBongo},
+      {RT_SHADOW_UMBRELLA,&LogicShadowUmbrella},
+      {RT_SHADOW_UMBRELLA_GS,&LogicShadowUmbrellaGS},
+      {RT_SHADOW_FREESTANDING_KEY,&LogicShadowFreestandingKey},
+      {RT_SHADOW_STATUE,&LogicShadowStatue},
+      {RT_SHADOW_BONGO,&LogicShadowBongo},
+      {RT_LENS_SHADOW_MQ,&LogicLensShadowMQ},
+      {RT_LENS_SHADOW_MQ_INVISIBLE_BLADES,&LogicLensShadowMQInvisibleBlades},
+      {RT_LENS_SHADOW_MQ_PLATFORM,&LogicLensShadowMQPlatform},
+      {RT_LENS_SHADOW_MQ_DEADHAND,&LogicLensShadowMQDeadHand},
+      {RT_SHADOW_MQ_GAP,&LogicShadowMQGap},
+      {RT_SHADOW_MQ_INVISIBLE_BLADES,&LogicShadowMQInvisibleBlades},
+      {RT_SHADOW_MQ_HUGE_PIT,&LogicShadowMQHugePit},
+      {RT_SHADOW_MQ_WINDY_WALKWAY,&LogicShadowMQWindyWalkway},
+      {RT_LENS_SPIRIT,&LogicLensSpirit},
+      {RT_SPIRIT_CHILD_CHU,&LogicSpiritChildBombchu},
+      {RT_SPIRIT_LOBBY_GS,&LogicSpiritLobbyGS},
+      {RT_SPIRIT_LOWER_ADULT_SWITCH,&LogicSpiritLowerAdultSwitch},
+      {RT_SPIRIT_LOBBY_JUMP,&LogicSpiritLobbyJump},
+      {RT_SPIRIT_PLATFORM_HOOKSHOT,&LogicSpiritPlatformHookshot},
+      {RT_SPIRIT_MAP_CHEST,&LogicSpiritMapChest},
+      {RT_SPIRIT_SUN_CHEST,&LogicSpiritSunChest},
+      {RT_SPIRIT_WALL,&LogicSpiritWall},
+      {RT_LENS_SPIRIT_MQ,&LogicLensSpiritMQ},
+      {RT_SPIRIT_MQ_SUN_BLOCK_SOT,&LogicSpiritMQSunBlockSoT},
+      {RT_SPIRIT_MQ_SUN_BLOCK_GS,&LogicSpiritMQSunBlockGS},
+      {RT_SPIRIT_MQ_LOWER_ADULT,&LogicSpiritMQLowerAdult},
+      {RT_SPIRIT_MQ_FROZEN_EYE,&LogicSpiritMQFrozenEye},
+      {RT_ICE_BLOCK_GS,&LogicIceBlockGS},
+      {RT_ICE_MQ_RED_ICE_GS,&LogicIceMQRedIceGS},
+      {RT_ICE_MQ_SCARECROW,&LogicIceMQScarecrow},
+      {RT_LENS_GTG,&LogicLensGtg},
+      {RT_GTG_WITHOUT_HOOKSHOT,&LogicGtgWithoutHookshot},
+      {RT_GTG_FAKE_WALL,&LogicGtgFakeWall},
+      {RT_LENS_GTG_MQ,&LogicLensGtgMQ},
+      {RT_GTG_MQ_WITH_HOOKSHOT,&LogicGtgMQWithHookshot},
+      {RT_GTG_MQ_WIHTOUT_HOOKSHOT,&LogicGtgMQWithoutHookshot},
+      {RT_LENS_GANON,&LogicLensCastle},
+      {RT_GANON_SPIRIT_TRIAL_HOOKSHOT,&LogicSpiritTrialHookshot},
+      {RT_LENS_GANON_MQ,&LogicLensCastleMQ},
+      {RT_GANON_MQ_FIRE_TRIAL,&LogicFireTrialMQ},
+      {RT_GANON_MQ_SHADOW_TRIAL,&LogicShadowTrialMQ},
+      {RT_GANON_MQ_LIGHT_TRIAL,&LogicLightTrialMQ},
+    },
+
+    //TODO completely rewrite glitch section since oot3d glitches differ from oot
+
+    GlitchEquipSwapDins(LogicTrick("")),
+    GlitchEquipSwap(LogicTrick("")),
+
+    glitchCategories{
+      &GlitchEquipSwapDins,
+      &GlitchEquipSwap,
+    },
+
+    miscGlitches{
+
+    },
+
+    glitchCategorySettings(Menu::SubMenu("General Categories",     &glitchCategories, false)),
+    miscGlitchSettings(Menu::SubMenu("Miscellaneous Glitches", &miscGlitches,     false)),
+    glitchOptions{
+      &glitchCategorySettings,
+      &miscGlitchSettings,
+    },
+
+    loadSettingsPreset(Menu::Action("Load Settings Preset",       LOAD_PRESET)),
+    saveSettingsPreset(Menu::Action("Save Settings Preset",       SAVE_PRESET)),
+    deleteSettingsPreset(Menu::Action("Delete Settings Preset",     DELETE_PRESET)),
+    resetToDefaultSettings(Menu::Action("Reset to Default Settings",  RESET_TO_DEFAULTS)),
+
+    settingsPresetItems{
+      &loadSettingsPreset,
+      &saveSettingsPreset,
+      &deleteSettingsPreset,
+      &resetToDefaultSettings,
+    },
+
+    //Detailed Logic Options Submenu
+    logicSettings(Menu::SubMenu("Logic Options",     &logicOptions)),
+    excludeLocations(Menu::SubMenu("Exclude Locations", &excludeLocationsMenus, false)),
+    tricks(Menu::SubMenu("Logical Tricks",    &trickOptions, false)),
+    glitchSettings(Menu::SubMenu("Glitch Options",    &glitchOptions, false)),
+    detailedLogicOptions{
+      &logicSettings,
+      &excludeLocations,
+      &tricks,
+      &glitchSettings,
+    },
+
+    open(Menu::SubMenu("Open Settings",              &openOptions)),
+    worldSettings(Menu::SubMenu("World Settings",             &worldOptions)),
+    shuffle(Menu::SubMenu("Shuffle Settings",           &shuffleOptions)),
+    shuffleDungeonItems(Menu::SubMenu("Shuffle Dungeon Items",      &shuffleDungeonItemOptions)),
+    detailedLogic(Menu::SubMenu("Detailed Logic Settings",    &detailedLogicOptions)),
+    startingInventory(Menu::SubMenu("Starting Inventory",         &startingInventoryOptions, false)),
+    timesaverSettings(Menu::SubMenu("Timesaver Settings",         &timesaverOptions)),
+    miscSettings(Menu::SubMenu("Misc Settings",              &miscOptions)),
+    itemPoolSettings(Menu::SubMenu("Item Pool Settings",         &itemPoolOptions)),
+    itemUsabilitySettings(Menu::SubMenu("Item Usability Settings",    &itemUsabilityOptions)),
+    settingsPresets(Menu::SubMenu("Settings Presets",           &settingsPresetItems)),
+    generateRandomizer(Menu::Action ("Generate Randomizer",        GENERATE_MODE)),
+
+    //adding a menu with no options crashes, might fix later
+    mainMenu{
+      &open,
+      &worldSettings,
+      &shuffle,
+      &shuffleDungeonItems,
+      &timesaverSettings,
+      &detailedLogic,
+      &startingInventory,
+      &miscSettings,
+      &itemPoolSettings,
+      &itemUsabilitySettings,
+      &settingsPresets,
+      &generateRandomizer,
+    },
+
+    //declared here, set in fill.cpp
+
+    //Options that should be saved, set to default, then restored after finishing when vanilla logic is enabled
+    vanillaLogicOverrides{
+      { &OpenForest, OPENFOREST_CLOSED },
+      { &OpenKakariko, OPENKAKARIKO_CLOSED },
+      { &OpenDoorOfTime, OPENDOOROFTIME_CLOSED },
+      { &ZorasFountain, ZORASFOUNTAIN_NORMAL },
+      { &GerudoFortress, GERUDOFORTRESS_NORMAL },
+      { &Bridge, RAINBOWBRIDGE_VANILLA },
+      { &RandomGanonsTrials, OFF },
+      { &GanonsTrialsCount, 6 },
+
+      { &StartingAge, AGE_CHILD },
+      { &TriforceHunt, TRIFORCE_HUNT_OFF },
+
+      { &ShuffleRewards, REWARDSHUFFLE_END_OF_DUNGEON },
+      { &LinksPocketItem, LINKSPOCKETITEM_DUNGEON_REWARD },
+      { &ShuffleSongs, SONGSHUFFLE_SONG_LOCATIONS },
+      { &Shopsanity, SHOPSANITY_OFF },
+      { &Tokensanity, TOKENSANITY_OFF },
+      { &Scrubsanity, SCRUBSANITY_OFF },
+      { &ShuffleCows, OFF },
+      { &ShuffleKokiriSword, OFF },
+      { &ShuffleMasterSword, OFF },
+      { &ShuffleOcarinas, OFF },
+      { &ShuffleWeirdEgg, OFF },
+      { &ShuffleGerudoToken, OFF },
+      { &ShuffleMagicBeans, OFF },
+      { &ShuffleMerchants, SHUFFLEMERCHANTS_OFF },
+      { &ShuffleFrogSongRupees, SHUFFLEFROGSONGRUPEES_OFF },
+      { &ShuffleAdultTradeQuest, SHUFFLEADULTTRADEQUEST_OFF },
+      { &ShuffleChestMinigame, SHUFFLECHESTMINIGAME_OFF },
+      { &Shuffle100GSReward, OFF },
+
+      { &MapsAndCompasses, MAPSANDCOMPASSES_VANILLA },
+      { &Keysanity, KEYSANITY_ANY_DUNGEON }, // Set small keys to any dungeon so FiT basement door will be locked
+      { &GerudoKeys, GERUDOKEYS_VANILLA },
+      { &BossKeysanity, BOSSKEYSANITY_VANILLA },
+      { &GanonsBossKey, GANONSBOSSKEY_VANILLA },
+      { &KeyRings, KEYRINGS_OFF },
+
+      { &StartingOcarina, OFF },
+
+      { &SkipChildStealth, DONT_SKIP },
+      { &SkipTowerEscape, DONT_SKIP },
+      { &SkipEponaRace, DONT_SKIP },
+
+      { &GossipStoneHints, HINTS_NO_HINTS },
+      { &AltarHintText, HINTS_NO_HINTS },
+      { &LightArrowHintText, HINTS_NO_HINTS },
+      { &DampeHintText, HINTS_NO_HINTS },
+      { &GregHintText, HINTS_NO_HINTS },
+      { &SariaHintText, HINTS_NO_HINTS },
+      { &FrogsHintText, HINTS_NO_HINTS },
+      { &WarpSongHints, HINTS_NO_HINTS },
+      { &Kak10GSHintText, HINTS_NO_HINTS },
+      { &Kak20GSHintText, HINTS_NO_HINTS },
+      { &Kak30GSHintText, HINTS_NO_HINTS },
+      { &Kak40GSHintText, HINTS_NO_HINTS },
+      { &Kak50GSHintText, HINTS_NO_HINTS },
+      { &ScrubHintText, HINTS_NO_HINTS },
+    } {}
 
   //Fills and returns a SettingsContext struct.
   //This struct is written to the code.ips patch and allows the game
   //to read what settings the player selected to make in game decisions.
-  SettingsContext FillContext() {
+  SettingsContext Vars::FillContext() {
     SettingsContext ctx = {};
     ctx.hashIndexes[0] = hashIconIndexes[0];
     ctx.hashIndexes[1] = hashIconIndexes[1];
@@ -1407,29 +1456,29 @@ namespace Settings {
 
     ctx.linksPocketRewardBitMask = LinksPocketRewardBitMask;
 
-    ctx.dekuTreeDungeonMode              = DekuTree.IsMQ()              ? 1 : 0;
-    ctx.dodongosCavernDungeonMode        = DodongosCavern.IsMQ()        ? 1 : 0;
-    ctx.jabuJabusBellyDungeonMode        = JabuJabusBelly.IsMQ()        ? 1 : 0;
-    ctx.forestTempleDungeonMode          = ForestTemple.IsMQ()          ? 1 : 0;
-    ctx.fireTempleDungeonMode            = FireTemple.IsMQ()            ? 1 : 0;
-    ctx.waterTempleDungeonMode           = WaterTemple.IsMQ()           ? 1 : 0;
-    ctx.spiritTempleDungeonMode          = SpiritTemple.IsMQ()          ? 1 : 0;
-    ctx.shadowTempleDungeonMode          = ShadowTemple.IsMQ()          ? 1 : 0;
-    ctx.bottomOfTheWellDungeonMode       = BottomOfTheWell.IsMQ()       ? 1 : 0;
-    ctx.iceCavernDungeonMode             = IceCavern.IsMQ()             ? 1 : 0;
-    ctx.ganonsCastleDungeonMode          = GanonsCastle.IsMQ()          ? 1 : 0;
-    ctx.gerudoTrainingGroundsDungeonMode = GerudoTrainingGrounds.IsMQ() ? 1 : 0;
+    ctx.dekuTreeDungeonMode              = world->dungeons.DekuTree.IsMQ()              ? 1 : 0;
+    ctx.dodongosCavernDungeonMode        = world->dungeons.DodongosCavern.IsMQ()        ? 1 : 0;
+    ctx.jabuJabusBellyDungeonMode        = world->dungeons.JabuJabusBelly.IsMQ()        ? 1 : 0;
+    ctx.forestTempleDungeonMode          = world->dungeons.ForestTemple.IsMQ()          ? 1 : 0;
+    ctx.fireTempleDungeonMode            = world->dungeons.FireTemple.IsMQ()            ? 1 : 0;
+    ctx.waterTempleDungeonMode           = world->dungeons.WaterTemple.IsMQ()           ? 1 : 0;
+    ctx.spiritTempleDungeonMode          = world->dungeons.SpiritTemple.IsMQ()          ? 1 : 0;
+    ctx.shadowTempleDungeonMode          = world->dungeons.ShadowTemple.IsMQ()          ? 1 : 0;
+    ctx.bottomOfTheWellDungeonMode       = world->dungeons.BottomOfTheWell.IsMQ()       ? 1 : 0;
+    ctx.iceCavernDungeonMode             = world->dungeons.IceCavern.IsMQ()             ? 1 : 0;
+    ctx.ganonsCastleDungeonMode          = world->dungeons.GanonsCastle.IsMQ()          ? 1 : 0;
+    ctx.gerudoTrainingGroundsDungeonMode = world->dungeons.GerudoTrainingGrounds.IsMQ() ? 1 : 0;
 
     for (uint8_t i = 0; i < sizeof(ctx.dungeonModesKnown); ++i) {
       ctx.dungeonModesKnown[i] = DungeonModesKnown[i];
     }
 
-    ctx.forestTrialSkip = (ForestTrial.IsSkipped()) ? 1 : 0;
-    ctx.fireTrialSkip   = (FireTrial.IsSkipped())   ? 1 : 0;
-    ctx.waterTrialSkip  = (WaterTrial.IsSkipped())  ? 1 : 0;
-    ctx.spiritTrialSkip = (SpiritTrial.IsSkipped()) ? 1 : 0;
-    ctx.shadowTrialSkip = (ShadowTrial.IsSkipped()) ? 1 : 0;
-    ctx.lightTrialSkip  = (LightTrial.IsSkipped())  ? 1 : 0;
+    ctx.forestTrialSkip = (world->trials.ForestTrial.IsSkipped()) ? 1 : 0;
+    ctx.fireTrialSkip   = (world->trials.FireTrial.IsSkipped())   ? 1 : 0;
+    ctx.waterTrialSkip  = (world->trials.WaterTrial.IsSkipped())  ? 1 : 0;
+    ctx.spiritTrialSkip = (world->trials.SpiritTrial.IsSkipped()) ? 1 : 0;
+    ctx.shadowTrialSkip = (world->trials.ShadowTrial.IsSkipped()) ? 1 : 0;
+    ctx.lightTrialSkip  = (world->trials.LightTrial.IsSkipped())  ? 1 : 0;
 
     //Starting Inventory
     ctx.startingConsumables   = (StartingConsumables) ? 1 : 0;
@@ -1559,17 +1608,17 @@ namespace Settings {
   //This function will hide certain locations from the Excluded Locations
   //menu if the player's current settings would require non-junk to be placed
   //at those locations. Excluded locations will have junk placed at them.
-  void ResolveExcludedLocationConflicts() {
+  void Vars::ResolveExcludedLocationConflicts() {
 
-    std::vector<uint32_t> shopLocations = GetLocations(everyPossibleLocation, Category::cShop);
+    std::vector<uint32_t> shopLocations = GetLocations(world->everyPossibleLocation, Category::cShop);
     //For now, just always hide shop locations, as not sure how to handle hiding them-
     //1-4 should always be hidden, while the others should be settings dependent, but random shopsanity makes that more complicated...
     //Excluded shop locations are also wonky
     IncludeAndHide(shopLocations);
 
     //Force include song locations
-    std::vector<uint32_t> songLocations = GetLocations(everyPossibleLocation, Category::cSong);
-    std::vector<uint32_t> songDungeonRewards = GetLocations(everyPossibleLocation, Category::cSongDungeonReward);
+    std::vector<uint32_t> songLocations = GetLocations(world->everyPossibleLocation, Category::cSong);
+    std::vector<uint32_t> songDungeonRewards = GetLocations(world->everyPossibleLocation, Category::cSongDungeonReward);
 
     //Unhide all song locations, then lock necessary ones
     Unhide(songLocations);
@@ -1582,7 +1631,7 @@ namespace Settings {
     }
 
     //Force Include Vanilla Skulltula locations
-    std::vector<uint32_t> skulltulaLocations = GetLocations(everyPossibleLocation, Category::cSkulltula);
+    std::vector<uint32_t> skulltulaLocations = GetLocations(world->everyPossibleLocation, Category::cSkulltula);
     Unhide(skulltulaLocations);
     if (Tokensanity.IsNot(TOKENSANITY_ALL_TOKENS)) {
       if (Tokensanity.Is(TOKENSANITY_OVERWORLD)) {
@@ -1596,7 +1645,7 @@ namespace Settings {
     }
 
     //Force Include scrubs if Scrubsanity is Off
-    std::vector<uint32_t> scrubLocations = GetLocations(everyPossibleLocation, Category::cDekuScrub, Category::cDekuScrubUpgrades);
+    std::vector<uint32_t> scrubLocations = GetLocations(world->everyPossibleLocation, Category::cDekuScrub, Category::cDekuScrubUpgrades);
     if (Scrubsanity.Is(OFF)) {
       IncludeAndHide(scrubLocations);
     } else {
@@ -1604,7 +1653,7 @@ namespace Settings {
     }
 
     //Force include Cows if Shuffle Cows is Off
-    std::vector<uint32_t> cowLocations = GetLocations(everyPossibleLocation, Category::cCow);
+    std::vector<uint32_t> cowLocations = GetLocations(world->everyPossibleLocation, Category::cCow);
     if (ShuffleCows) {
       Unhide(cowLocations);
     } else {
@@ -1707,8 +1756,8 @@ namespace Settings {
     }
 
     //Force include Map and Compass Chests when Vanilla
-    std::vector<uint32_t> mapChests = GetLocations(everyPossibleLocation, Category::cVanillaMap);
-    std::vector<uint32_t> compassChests = GetLocations(everyPossibleLocation, Category::cVanillaCompass);
+    std::vector<uint32_t> mapChests = GetLocations(world->everyPossibleLocation, Category::cVanillaMap);
+    std::vector<uint32_t> compassChests = GetLocations(world->everyPossibleLocation, Category::cVanillaCompass);
     if (MapsAndCompasses.Is(MAPSANDCOMPASSES_VANILLA)) {
       IncludeAndHide(mapChests);
       IncludeAndHide(compassChests);
@@ -1718,7 +1767,7 @@ namespace Settings {
     }
 
     //Force include Vanilla Small Key Locations (except gerudo Fortress) on Vanilla Keys
-    std::vector<uint32_t> smallKeyChests = GetLocations(everyPossibleLocation, Category::cVanillaSmallKey);
+    std::vector<uint32_t> smallKeyChests = GetLocations(world->everyPossibleLocation, Category::cVanillaSmallKey);
     if (Keysanity.Is(KEYSANITY_VANILLA)) {
       IncludeAndHide(smallKeyChests);
     } else {
@@ -1726,7 +1775,7 @@ namespace Settings {
     }
 
     //Force include Gerudo Fortress carpenter fights if GF Small Keys are Vanilla
-    std::vector<uint32_t> vanillaGFKeyLocations = GetLocations(everyPossibleLocation, Category::cVanillaGFSmallKey);
+    std::vector<uint32_t> vanillaGFKeyLocations = GetLocations(world->everyPossibleLocation, Category::cVanillaGFSmallKey);
     if (GerudoKeys.Is(GERUDOKEYS_VANILLA)) {
       IncludeAndHide(vanillaGFKeyLocations);
     } else {
@@ -1734,7 +1783,7 @@ namespace Settings {
     }
 
     //Force include Boss Key Chests if Boss Keys are Vanilla
-    std::vector<uint32_t> bossKeyChests = GetLocations(everyPossibleLocation, Category::cVanillaBossKey);
+    std::vector<uint32_t> bossKeyChests = GetLocations(world->everyPossibleLocation, Category::cVanillaBossKey);
     if (BossKeysanity.Is(BOSSKEYSANITY_VANILLA)) {
       IncludeAndHide(bossKeyChests);
     } else {
@@ -1756,7 +1805,7 @@ namespace Settings {
     }
   }
 
-  uint8_t DungeonsOfType(uint8_t type) {
+  uint8_t Vars::DungeonsOfType(uint8_t type) {
     uint8_t count = 0;
 
     for (Option *option : dungeonOptions) {
@@ -1769,7 +1818,7 @@ namespace Settings {
   //Hide certain settings if they aren't relevant or Lock settings if they
   //can't be changed due to another setting that was chosen. (i.e. Closed Forest
   //will force Starting Age to Child).
-  void ForceChange(uint32_t kDown, Option* currentSetting) {
+  void Vars::ForceChange(uint32_t kDown, Option* currentSetting) {
 
     // If Zora's Fountain is open, hide and un-select Ruto's Letter. If not open, hide and un-select bottle 4 instead
     if (ZorasFountain.Is(ZORASFOUNTAIN_OPEN)) {
@@ -2054,7 +2103,7 @@ namespace Settings {
     ResolveExcludedLocationConflicts();
   }
 
-  bool IsMQOption(Option *option) {
+  bool Vars::IsMQOption(Option *option) {
     return option == &MQDungeonCount  ||
            option == &SetDungeonTypes ||
            option == &MQDeku          ||
@@ -2071,71 +2120,9 @@ namespace Settings {
            option == &MQCastle;
   }
 
-  //Options that should be saved, set to default, then restored after finishing when vanilla logic is enabled
-  std::vector<std::pair<Option*, uint8_t>> vanillaLogicOverrides = {
-    { &OpenForest, OPENFOREST_CLOSED },
-    { &OpenKakariko, OPENKAKARIKO_CLOSED },
-    { &OpenDoorOfTime, OPENDOOROFTIME_CLOSED },
-    { &ZorasFountain, ZORASFOUNTAIN_NORMAL },
-    { &GerudoFortress, GERUDOFORTRESS_NORMAL },
-    { &Bridge, RAINBOWBRIDGE_VANILLA },
-    { &RandomGanonsTrials, OFF },
-    { &GanonsTrialsCount, 6 },
-
-    { &StartingAge, AGE_CHILD },
-    { &TriforceHunt, TRIFORCE_HUNT_OFF },
-
-    { &ShuffleRewards, REWARDSHUFFLE_END_OF_DUNGEON },
-    { &LinksPocketItem, LINKSPOCKETITEM_DUNGEON_REWARD },
-    { &ShuffleSongs, SONGSHUFFLE_SONG_LOCATIONS },
-    { &Shopsanity, SHOPSANITY_OFF },
-    { &Tokensanity, TOKENSANITY_OFF },
-    { &Scrubsanity, SCRUBSANITY_OFF },
-    { &ShuffleCows, OFF },
-    { &ShuffleKokiriSword, OFF },
-    { &ShuffleMasterSword, OFF },
-    { &ShuffleOcarinas, OFF },
-    { &ShuffleWeirdEgg, OFF },
-    { &ShuffleGerudoToken, OFF },
-    { &ShuffleMagicBeans, OFF },
-    { &ShuffleMerchants, SHUFFLEMERCHANTS_OFF },
-    { &ShuffleFrogSongRupees, SHUFFLEFROGSONGRUPEES_OFF },
-    { &ShuffleAdultTradeQuest, SHUFFLEADULTTRADEQUEST_OFF },
-    { &ShuffleChestMinigame, SHUFFLECHESTMINIGAME_OFF },
-    { &Shuffle100GSReward, OFF },
-    
-    { &MapsAndCompasses, MAPSANDCOMPASSES_VANILLA },
-    { &Keysanity, KEYSANITY_ANY_DUNGEON }, // Set small keys to any dungeon so FiT basement door will be locked
-    { &GerudoKeys, GERUDOKEYS_VANILLA },
-    { &BossKeysanity, BOSSKEYSANITY_VANILLA },
-    { &GanonsBossKey, GANONSBOSSKEY_VANILLA },
-    { &KeyRings, KEYRINGS_OFF },
-
-    { &StartingOcarina, OFF },
-
-    { &SkipChildStealth, DONT_SKIP },
-    { &SkipTowerEscape, DONT_SKIP },
-    { &SkipEponaRace, DONT_SKIP },
-
-    { &GossipStoneHints, HINTS_NO_HINTS },
-    { &AltarHintText, HINTS_NO_HINTS },
-    { &LightArrowHintText, HINTS_NO_HINTS },
-    { &DampeHintText, HINTS_NO_HINTS },
-    { &GregHintText, HINTS_NO_HINTS },
-    { &SariaHintText, HINTS_NO_HINTS },
-    { &FrogsHintText, HINTS_NO_HINTS },
-    { &WarpSongHints, HINTS_NO_HINTS },
-    { &Kak10GSHintText, HINTS_NO_HINTS },
-    { &Kak20GSHintText, HINTS_NO_HINTS },
-    { &Kak30GSHintText, HINTS_NO_HINTS },
-    { &Kak40GSHintText, HINTS_NO_HINTS },
-    { &Kak50GSHintText, HINTS_NO_HINTS },
-    { &ScrubHintText, HINTS_NO_HINTS },
-  };
-
   // Randomizes all settings in a category if chosen
   // Hides all relevant options
-  void RandomizeAllSettings(const bool selectOptions /*= false*/) {
+  void Vars::RandomizeAllSettings(const bool selectOptions /*= false*/) {
 
     // Open Settings
     if (RandomizeOpen) {
@@ -2253,7 +2240,7 @@ namespace Settings {
   }
 
   //Function to set flags depending on settings
-  void UpdateSettings(std::unordered_map<RandomizerSettingKey, uint8_t> cvarSettings, std::set<RandomizerCheck> excludedLocations, std::set<RandomizerTrick> enabledTricks) {
+  void Vars::UpdateSettings(std::unordered_map<RandomizerSettingKey, uint8_t> cvarSettings, std::set<RandomizerCheck> excludedLocations, std::set<RandomizerTrick> enabledTricks) {
 
     //Logic.SetSelectedIndex(cvarSettings[RSK_LOGIC_RULES]);
     //TODO switch back for glitch logic
@@ -2272,7 +2259,7 @@ namespace Settings {
     LocationsReachable.SetSelectedIndex(cvarSettings[RSK_ALL_LOCATIONS_REACHABLE]);
 
     AddExcludedOptions();
-    for (auto locationKey : everyPossibleLocation) {
+    for (auto locationKey : world->everyPossibleLocation) {
       auto location = Location(locationKey);
       if (excludedLocations.count(location->GetRandomizerCheck())) {
         location->GetExcludedOption()->SetSelectedIndex(1);
@@ -2501,7 +2488,7 @@ namespace Settings {
     RandomizeAllSettings(true); //now select any random options instead of just hiding them
 
     //shuffle the dungeons and then set MQ for as many as necessary
-    auto dungeons = dungeonList;
+    auto dungeons = world->dungeons.dungeonList;
     if (SetDungeonTypes) {
       MQSet = MQDungeonCount.Value<uint8_t>();
       uint8_t dungeonCount = 0;
@@ -2585,33 +2572,33 @@ namespace Settings {
         }
       }
       if (RingWell) {
-        BottomOfTheWell.SetKeyRing();
+        world->dungeons.BottomOfTheWell.SetKeyRing();
       }
       if (RingForest) {
-        ForestTemple.SetKeyRing();
+        world->dungeons.ForestTemple.SetKeyRing();
       }
       if (RingFire) {
-        FireTemple.SetKeyRing();
+        world->dungeons.FireTemple.SetKeyRing();
       }
       if (RingWater) {
-        WaterTemple.SetKeyRing();
+        world->dungeons.WaterTemple.SetKeyRing();
       }
       if (RingSpirit) {
-        SpiritTemple.SetKeyRing();
+        world->dungeons.SpiritTemple.SetKeyRing();
       }
       if (RingShadow) {
-        ShadowTemple.SetKeyRing();
+        world->dungeons.ShadowTemple.SetKeyRing();
       }
       if (RingGtg) {
-        GerudoTrainingGrounds.SetKeyRing();
+        world->dungeons.GerudoTrainingGrounds.SetKeyRing();
       }
       if (RingCastle) {
-        GanonsCastle.SetKeyRing();
+        world->dungeons.GanonsCastle.SetKeyRing();
       }
     }
 
     //shuffle the trials then require the amount set in GanonsTrialsCount
-    auto trials = trialList;
+    auto trials = world->trials.trialList;
     Shuffle(trials);
 
     //clear required trials
@@ -2682,9 +2669,9 @@ namespace Settings {
   }
 
   //Recursively look through each menu from the main menu to get all settings
-  const std::vector<Menu*> GetAllOptionMenus() {
+  const std::vector<Menu*> Vars::GetAllOptionMenus() {
     std::vector<Menu*> allMenus;
-    for (Menu* menu : Settings::mainMenu) {
+    for (Menu* menu : mainMenu) {
       std::vector<Menu*> foundMenus = GetMenusRecursive(menu);
       allMenus.insert(allMenus.end(), foundMenus.begin(), foundMenus.end());
     }
@@ -2692,3 +2679,7 @@ namespace Settings {
   }
 
 } // namespace Settings
+
+static Settings::Vars mainSettings;
+
+thread_local constinit Settings::Vars* settings = &mainSettings;
@@ -741,444 +741,573 @@ class Menu {
 };
 
 namespace Settings {
-void UpdateSettings(std::unordered_map<RandomizerSettingKey, uint8_t> cvarSettings, std::set<RandomizerCheck> excludedLocations, std::set<RandomizerTrick> enabledTricks);
-  SettingsContext FillContext();
-  void ResolveExcludedLocationConflicts();
-  void RandomizeAllSettings(const bool selectOptions = false);
-  void ForceChange(uint32_t kDown, Option* currentSetting);
-  const std::vector<Menu*> GetAllOptionMenus();
-
-
-  extern uint32_t seed;
   extern std::string version;
-  extern std::array<uint8_t, 5> hashIconIndexes;
-  extern std::string hash;
-  extern std::string seedString;
-
-  extern bool skipChildZelda;
-
-  extern Option OpenForest;
-  extern Option OpenKakariko;
-  extern Option OpenDoorOfTime;
-  extern Option ZorasFountain;
-  extern Option GerudoFortress;
-  extern Option Bridge;
-  extern Option BridgeStoneCount;
-  extern Option BridgeMedallionCount;
-  extern Option BridgeRewardCount;
-  extern Option BridgeDungeonCount;
-  extern Option BridgeTokenCount;
-  extern Option BridgeRewardOptions;
-  extern Option RandomGanonsTrials;
-  extern Option GanonsTrialsCount;
-
-  extern Option StartingAge;
-  extern uint8_t ResolvedStartingAge;
-  extern Option ShuffleEntrances;
-  extern Option ShuffleDungeonEntrances;
-  extern Option ShuffleBossEntrances;
-  extern Option ShuffleOverworldEntrances;
-  extern Option ShuffleInteriorEntrances;
-  extern Option ShuffleGrottoEntrances;
-  extern Option ShuffleOwlDrops;
-  extern Option ShuffleWarpSongs;
-  extern Option ShuffleOverworldSpawns;
-  extern Option MixedEntrancePools;
-  extern Option MixDungeons;
-  extern Option MixBosses;
-  extern Option MixOverworld;
-  extern Option MixInteriors;
-  extern Option MixGrottos;
-  extern Option DecoupleEntrances;
-  extern Option BombchusInLogic;
-  extern Option AmmoDrops;
-  extern Option HeartDropRefill;
-  extern Option TriforceHunt;
-  extern Option TriforceHuntTotal;
-  extern Option TriforceHuntRequired;
-  extern Option MQDungeonCount;
-  extern Option SetDungeonTypes;
-
-  extern Option ShuffleRewards;
-  extern Option LinksPocketItem;
-  extern Option ShuffleSongs;
-  extern Option Shopsanity;
-  extern Option ShopsanityPrices;
-  extern Option ShopsanityPricesAffordable;
-  extern Option Tokensanity;
-  extern Option Scrubsanity;
-  extern Option ShuffleCows;
-  extern Option ShuffleKokiriSword;
-  extern Option ShuffleMasterSword;
-  extern Option ShuffleOcarinas;
-  extern Option ShuffleWeirdEgg;
-  extern Option ShuffleGerudoToken;
-  extern Option ShuffleMagicBeans;
-  extern Option ShuffleMerchants;
-  extern Option ShuffleFrogSongRupees;
-  extern Option ShuffleAdultTradeQuest;
-  extern Option ShuffleChestMinigame;
-  extern Option Shuffle100GSReward;
-
-  extern Option MapsAndCompasses;
-  extern Option Keysanity;
-  extern Option GerudoKeys;
-  extern Option BossKeysanity;
-  extern Option GanonsBossKey;
-  extern uint8_t LACSCondition;
-  extern Option LACSStoneCount;
-  extern Option LACSMedallionCount;
-  extern Option LACSRewardCount;
-  extern Option LACSDungeonCount;
-  extern Option LACSTokenCount;
-  extern Option LACSRewardOptions;
-  extern Option KeyRings;
-  extern Option KeyRingsRandomCount;
-  extern Option RingFortress;
-  extern Option RingForest;
-  extern Option RingFire;
-  extern Option RingWater;
-  extern Option RingSpirit;
-  extern Option RingShadow;
-  extern Option RingWell;
-  extern Option RingGtg;
-  extern Option RingCastle;
-
-  extern Option SkipChildStealth;
-  extern Option SkipTowerEscape;
-  extern Option SkipEponaRace;
-  extern Option SkipMinigamePhases;
-  extern Option FreeScarecrow;
-  extern Option FourPoesCutscene;
-  extern Option LakeHyliaOwl;
-  extern Option BigPoeTargetCount;
-  extern Option NumRequiredCuccos;
-  extern Option KingZoraSpeed;
-  extern Option CompleteMaskQuest;
-  extern Option EnableGlitchCutscenes;
-  extern Option QuickText;
-  extern Option SkipSongReplays;
-  extern Option KeepFWWarpPoint;
-  extern Option FastBunnyHood;
-
-  extern Option GossipStoneHints;
-  extern Option ClearerHints;
-  extern Option HintDistribution;
-  extern Option AltarHintText;
-  extern Option LightArrowHintText;
-  extern Option DampeHintText;
-  extern Option GregHintText;
-  extern Option Kak10GSHintText;
-  extern Option Kak20GSHintText;
-  extern Option Kak30GSHintText;
-  extern Option Kak40GSHintText;
-  extern Option Kak50GSHintText;
-  extern Option ScrubHintText;
-  extern Option WarpSongHints;
-  extern Option DamageMultiplier;
-  extern Option StartingTime;
-  extern Option ChestAnimations;
-  extern Option ChestSize;
-  extern Option GenerateSpoilerLog;
-  extern Option IngameSpoilers;
-  extern Option RandomTrapDmg;
-  extern Option BlueFireArrows;
-  extern Option SunlightArrows;
-  extern bool HasNightStart;
-
-  extern Option FaroresWindAnywhere;
-  extern Option StickAsAdult;
-  extern Option BoomerangAsAdult;
-  extern Option HammerAsChild;
-  extern Option SlingshotAsAdult;
-  extern Option BowAsChild;
-  extern Option HookshotAsChild;
-  extern Option IronBootsAsChild;
-  extern Option HoverBootsAsChild;
-  extern Option MasksAsAdult;
-  extern Option KokiriSwordAsAdult;
-  extern Option MasterSwordAsChild;
-  extern Option BiggoronSwordAsChild;
-  extern Option DekuShieldAsAdult;
-  extern Option MirrorShieldAsChild;
-  extern Option GoronTunicAsChild;
-  extern Option ZoraTunicAsChild;
-  extern Option GkDurability;
-
-  extern Option ItemPoolValue;
-  extern Option IceTrapValue;
-  extern Option RemoveDoubleDefense;
-  extern Option ProgressiveGoronSword;
-
-  //Starting Inventory
-  extern Option StartingConsumables;
-  extern Option StartingMaxRupees;
-  extern Option StartingStickCapacity;
-  extern Option StartingNutCapacity;
-  extern Option StartingBombBag;
-  extern Option StartingBombchus;
-  extern Option StartingBow;
-  extern Option StartingFireArrows;
-  extern Option StartingIceArrows;
-  extern Option StartingLightArrows;
-  extern Option StartingDinsFire;
-  extern Option StartingFaroresWind;
-  extern Option StartingNayrusLove;
-  extern Option StartingSlingshot;
-  extern Option StartingBoomerang;
-  extern Option StartingLensOfTruth;
-  extern Option StartingMagicBean;
-  extern Option StartingMegatonHammer;
-  extern Option StartingHookshot;
-  extern Option StartingIronBoots;
-  extern Option StartingHoverBoots;
-  extern Option StartingBottle1;
-  extern Option StartingBottle2;
-  extern Option StartingBottle3;
-  extern Option StartingBottle4;
-  extern Option StartingRutoBottle;
-  extern Option StartingOcarina;
-  extern Option StartingZeldasLullaby;
-  extern Option StartingEponasSong;
-  extern Option StartingSariasSong;
-  extern Option StartingSunsSong;
-  extern Option StartingSongOfTime;
-  extern Option StartingSongOfStorms;
-  extern Option StartingMinuetOfForest;
-  extern Option StartingBoleroOfFire;
-  extern Option StartingSerenadeOfWater;
-  extern Option StartingRequiemOfSpirit;
-  extern Option StartingNocturneOfShadow;
-  extern Option StartingPreludeOfLight;
-  extern Option StartingKokiriSword;
-  extern Option StartingBiggoronSword;
-  extern Option StartingDekuShield;
-  extern Option StartingHylianShield;
-  extern Option StartingMirrorShield;
-  extern Option StartingGoronTunic;
-  extern Option StartingZoraTunic;
-  extern Option StartingMagicMeter;
-  extern Option StartingStrength;
-  extern Option StartingScale;
-  extern Option StartingWallet;
-  extern Option StartingShardOfAgony;
-  extern Option StartingDoubleDefense;
-  extern Option StartingHearts;
-  extern Option StartingKokiriEmerald;
-  extern Option StartingGoronRuby;
-  extern Option StartingZoraSapphire;
-  extern Option StartingForestMedallion;
-  extern Option StartingFireMedallion;
-  extern Option StartingWaterMedallion;
-  extern Option StartingSpiritMedallion;
-  extern Option StartingShadowMedallion;
-  extern Option StartingLightMedallion;
-  extern Option StartingSkulltulaToken;
-
-  //Logic Settings
-  extern Option Logic;
-  extern Option LocationsReachable;
-  extern Option NightGSExpectSuns;
-
-  //Trick Settings
-  //New Trick Settings (from ootr https://github.com/ootrandomizer/OoT-Randomizer/blob/Dev/SettingsList.py, additions to this list marked)
-  extern Option ToggleAllTricks;
-  extern Option LogicVisibleCollision;
-  extern Option LogicGrottosWithoutAgony;
-  extern Option LogicFewerTunicRequirements;
-  extern Option LogicRustedSwitches;
-  extern Option LogicFlamingChests;
-  extern Option LogicBunnyHoodJump; //NEW not implemented
-  extern Option LogicDamageBoost; //NEW not implemented
-  extern Option LogicHoverBoost; //NEW not implemented
-  extern Option LogicAdultKokiriGS;
-  extern Option LogicLostWoodsBridge;
-  extern Option LogicMidoBackflip;
-  extern Option LogicLostWoodsGSBean;
-  extern Option LogicCastleStormsGS;
-  extern Option LogicManOnRoof;
-  extern Option LogicKakarikoTowerGS;
-  extern Option LogicAdultWindmillPoH;
-  extern Option LogicChildWindmillPoH; //NEW not implemented
-  extern Option LogicKakarikoRooftopGS;
-  extern Option LogicGraveyardPoH;
-  extern Option LogicChildDampeRacePoH;
-  extern Option LogicShadowFireArrowEntry;
-  extern Option LogicDMTSoilGS;
-  extern Option LogicDMTBombable;
-  extern Option LogicDMTGSLowerHookshot;
-  extern Option LogicDMTGSLowerHovers;
-  extern Option LogicDMTGSLowerBean;
-  extern Option LogicDMTGSLowerJS; //NEW
-  extern Option LogicDMTClimbHovers;
-  extern Option LogicDMTGSUpper;
-  extern Option LogicBiggoronBolero; //not implemented - unnecessary with SoH rando
-  extern Option LogicGoronCityPot;
-  extern Option LogicGoronCityPotWithStrength;
-  extern Option LogicChildRollingWithStrength;
-  extern Option LogicGoronCityLeftMost;
-  extern Option LogicGoronCityGrotto;
-  extern Option LogicGoronCityLinkGoronDins;
-  extern Option LogicCraterBeanPoHWithHovers;
-  extern Option LogicCraterBoleroJump;
-  extern Option LogicCraterBoulderJS;
-  extern Option LogicCraterBoulderSkip;
-  extern Option LogicZoraRiverLower;
-  extern Option LogicZoraRiverUpper;
-  extern Option LogicZoraWithHovers;
-  extern Option LogicZoraWithCucco;
-  extern Option LogicKingZoraSkip;
-  extern Option LogicDomainGS;
-  extern Option LogicLabWallGS;
-  extern Option LogicLabDiving;
-  extern Option LogicWaterHookshotEntry;
-  extern Option LogicValleyCrateHovers;
-  extern Option LogicGerudoKitchen;
-  extern Option LogicGFJump;
-  extern Option LogicWastelandBunnyCrossing; //NEW not implemented
-  extern Option LogicWastelandCrossing;
-  extern Option LogicLensWasteland;
-  extern Option LogicReverseWasteland;
-  extern Option LogicColossusGS;
-  extern Option LogicDekuBasementGS;
-  extern Option LogicDekuB1Skip;
-  extern Option LogicDekuB1WebsWithBow;
-  extern Option LogicDekuMQCompassGS;
-  extern Option LogicDekuMQLog;
-  extern Option LogicDCScarecrowGS;
-  extern Option LogicDCVinesGS;
-  extern Option LogicDCStaircase;
-  extern Option LogicDCSlingshotSkip;
-  extern Option LogicDCScrubRoom;
-  extern Option LogicDCJump;
-  extern Option LogicDCHammerFloor;
-  extern Option LogicDCMQChildBombs;
-  extern Option LogicDCMQEyesChild;
-  extern Option LogicDCMQEyesAdult;
-  extern Option LogicJabuAlcoveJumpDive;
-  extern Option LogicJabuBossHover;
-  extern Option LogicJabuNearBossRanged;
-  extern Option LogicJabuNearBossExplosives;
-  extern Option LogicLensJabuMQ;
-  extern Option LogicJabuMQRangJump; //not implemented - requires dungeon shortcuts which is not built into rando yet
-  extern Option LogicJabuMQSoTGS;
-  extern Option LogicLensBotw;
-  extern Option LogicChildDeadhand;
-  extern Option LogicBotwBasement;
-  extern Option LogicBotwMQPits;
-  extern Option LogicBotwMQDeadHandKey;
-  extern Option LogicForestFirstGS;
-  extern Option LogicForestOutdoorEastGS;
-  extern Option LogicForestVines;
-  extern Option LogicForestOutdoorsLedge;
-  extern Option LogicForestDoorFrame;
-  extern Option LogicForestOutsideBackdoor;
-  extern Option LogicForestMQWellSwim;
-  extern Option LogicForestMQBlockPuzzle;
-  extern Option LogicForestMQHallwaySwitchJS;
-  extern Option LogicForestMQHallwaySwitchHookshot; //not implemented yet
-  extern Option LogicForestMQHallwaySwitchBoomerang;
-  extern Option LogicFireBossDoorJump;
-  extern Option LogicFireSongOfTime;
-  extern Option LogicFireStrength;
-  extern Option LogicFireScarecrow;
-  extern Option LogicFireFlameMaze;
-  extern Option LogicFireMQNearBoss;
-  extern Option LogicFireMQBlockedChest;
-  extern Option LogicFireMQBKChest;
-  extern Option LogicFireMQClimb;
-  extern Option LogicFireMQMazeSideRoom;
-  extern Option LogicFireMQMazeHovers;
-  extern Option LogicFireMQMazeJump;
-  extern Option LogicFireMQAboveMazeGS;
-  extern Option LogicFireMQFlameMaze;
-  extern Option LogicWaterTempleTorchLongshot;
-  extern Option LogicWaterCrackedWallHovers;
-  extern Option LogicWaterCrackedWallNothing;
-  extern Option LogicWaterBossKeyRegion;
-  extern Option LogicWaterNorthBasementLedgeJump;
-  extern Option LogicWaterBKJumpDive;
-  extern Option LogicWaterCentralGSFW;
-  extern Option LogicWaterCentralGSIrons;
-  extern Option LogicWaterCentralBow;
-  extern Option LogicWaterFallingPlatformGSHookshot;
-  extern Option LogicWaterFallingPlatformGSBoomerang;
-  extern Option LogicWaterRiverGS;
-  extern Option LogicWaterDragonJumpDive;
-  extern Option LogicWaterDragonAdult;
-  extern Option LogicWaterDragonChild;
-  extern Option LogicWaterMQCentralPillar;
-  extern Option LogicWaterMQLockedGS;
-  extern Option LogicLensShadow;
-  extern Option LogicLensShadowPlatform;
-  extern Option LogicLensBongo;
-  extern Option LogicShadowUmbrella;
-  extern Option LogicShadowUmbrellaGS;
-  extern Option LogicShadowFreestandingKey;
-  extern Option LogicShadowStatue;
-  extern Option LogicShadowBongo; //not implemented - projectiles are not expected for bongo anyways
-  extern Option LogicLensShadowMQ;
-  extern Option LogicLensShadowMQInvisibleBlades;
-  extern Option LogicLensShadowMQPlatform;
-  extern Option LogicLensShadowMQDeadHand;
-  extern Option LogicShadowMQGap;
-  extern Option LogicShadowMQInvisibleBlades;
-  extern Option LogicShadowMQHugePit;
-  extern Option LogicShadowMQWindyWalkway; //not implemented - requires dungeon shortcuts which is not built into rando yet
-  extern Option LogicLensSpirit;
-  extern Option LogicSpiritChildBombchu;
-  extern Option LogicSpiritLobbyGS;
-  extern Option LogicSpiritLowerAdultSwitch;
-  extern Option LogicSpiritLobbyJump;
-  extern Option LogicSpiritPlatformHookshot; //not implemented - requires boss shortcuts which is not built into rando yet
-  extern Option LogicSpiritMapChest;
-  extern Option LogicSpiritSunChest;
-  extern Option LogicSpiritWall;
-  extern Option LogicLensSpiritMQ;
-  extern Option LogicSpiritMQSunBlockSoT;
-  extern Option LogicSpiritMQSunBlockGS;
-  extern Option LogicSpiritMQLowerAdult;
-  extern Option LogicSpiritMQFrozenEye;
-  extern Option LogicIceBlockGS;
-  extern Option LogicIceMQRedIceGS;
-  extern Option LogicIceMQScarecrow;
-  extern Option LogicLensGtg;
-  extern Option LogicGtgWithoutHookshot;
-  extern Option LogicGtgFakeWall;
-  extern Option LogicLensGtgMQ;
-  extern Option LogicGtgMQWithHookshot;
-  extern Option LogicGtgMQWithoutHookshot;
-  extern Option LogicLensCastle;
-  extern Option LogicSpiritTrialHookshot;
-  extern Option LogicLensCastleMQ;
-  extern Option LogicFireTrialMQ;
-  extern Option LogicShadowTrialMQ;
-  extern Option LogicLightTrialMQ;
-
-  
-
-  //Glitch Settings
-  extern Option GlitchEquipSwapDins;
-  extern Option GlitchEquipSwap;
-  
-  extern uint32_t LinksPocketRewardBitMask;
-  extern std::array<uint32_t, 9> rDungeonRewardOverrides;
-
-  extern std::vector<std::vector<Option *>> excludeLocationsOptionsVector;
-  extern std::vector<Menu *> excludeLocationsMenus;
-  extern std::vector<Option *> startingItemsOptions;
-  extern std::vector<Option *> startingSongsOptions;
-  extern std::vector<Option *> startingEquipmentOptions;
-  extern std::vector<Option *> startingStonesMedallionsOptions;
-  extern std::vector<Option *> startingOthersOptions;
-  extern std::vector<Option *> trickOptions;
-  extern std::vector<Option *> glitchCategories;
-  extern std::vector<Option *> miscGlitches;
-
-  extern std::vector<Menu *> startingInventoryOptions;
-  extern std::vector<Menu *> detailedLogicOptions;
-
-  extern std::vector<Menu *> mainMenu;
-
-  extern std::vector<std::pair<Option*, uint8_t>> vanillaLogicOverrides;
-}
+
+  //Every setting of a generation, and the option menus built on them. Each generation has its own, installed in
+  //the settings pointer below. The menus point into it, so it can't be copied.
+  struct Vars {
+    Vars();
+    Vars(const Vars&) = delete;
+    Vars& operator=(const Vars&) = delete;
+
+    uint32_t seed = 0;
+    std::string hash;
+    std::array<uint8_t, 5> hashIconIndexes = {};
+    std::string seedString;
+
+    bool skipChildZelda = false;
+
+    //Open Settings
+    Option RandomizeOpen;
+    Option OpenForest;
+    Option OpenKakariko;
+    Option OpenDoorOfTime;
+    Option ZorasFountain;
+    Option GerudoFortress;
+    Option Bridge;
+    Option BridgeStoneCount;
+    Option BridgeMedallionCount;
+    Option BridgeRewardCount;
+    Option BridgeDungeonCount;
+    Option BridgeTokenCount;
+    Option BridgeRewardOptions;
+    Option RandomGanonsTrials;
+    Option GanonsTrialsCount;
+    std::vector<Option *> openOptions;
+
+    //World Settings
+    Option RandomizeWorld;
+    Option StartingAge;
+    uint8_t ResolvedStartingAge = 0;
+    Option ShuffleEntrances;
+    Option ShuffleDungeonEntrances;
+    Option ShuffleBossEntrances;
+    Option ShuffleOverworldEntrances;
+    Option ShuffleInteriorEntrances;
+    Option ShuffleGrottoEntrances;
+    Option ShuffleOwlDrops;
+    Option ShuffleWarpSongs;
+    Option ShuffleOverworldSpawns;
+    Option MixedEntrancePools;
+    Option MixDungeons;
+    Option MixBosses;
+    Option MixOverworld;
+    Option MixInteriors;
+    Option MixGrottos;
+    Option DecoupleEntrances;
+    Option BombchusInLogic;
+    Option AmmoDrops;
+    Option HeartDropRefill;
+    Option TriforceHunt;
+    Option TriforceHuntTotal;
+    Option TriforceHuntRequired;
+    Option MQDungeonCount;
+    uint8_t MQSet = 0;
+    bool DungeonModesKnown[12] = {};
+    Option SetDungeonTypes;
+    Option MQDeku;
+    Option MQDodongo;
+    Option MQJabu;
+    Option MQForest;
+    Option MQFire;
+    Option MQWater;
+    Option MQSpirit;
+    Option MQShadow;
+    Option MQBotW;
+    Option MQIceCavern;
+    Option MQGTG;
+    Option MQCastle;
+    std::vector<Option *> worldOptions;
+    std::vector<Option *> dungeonOptions;
+
+    //Shuffle Settings
+    Option RandomizeShuffle;
+    Option ShuffleRewards;
+    Option LinksPocketItem;
+    Option ShuffleSongs;
+    Option Shopsanity;
+    Option ShopsanityPrices;
+    Option ShopsanityPricesAffordable;
+    Option Tokensanity;
+    Option Scrubsanity;
+    Option ShuffleCows;
+    Option ShuffleKokiriSword;
+    Option ShuffleMasterSword;
+    Option ShuffleOcarinas;
+    Option ShuffleWeirdEgg;
+    Option ShuffleGerudoToken;
+    Option ShuffleMagicBeans;
+    Option ShuffleMerchants;
+    Option ShuffleFrogSongRupees;
+    Option ShuffleAdultTradeQuest;
+    Option ShuffleChestMinigame;
+    Option Shuffle100GSReward;
+
+    std::vector<Option *> shuffleOptions;
+
+    //Shuffle Dungeon Items
+    Option RandomizeDungeon;
+    Option MapsAndCompasses;
+    Option Keysanity;
+    Option GerudoKeys;
+    Option BossKeysanity;
+    Option GanonsBossKey;
+    uint8_t LACSCondition = 0;
+    Option LACSStoneCount;
+    Option LACSMedallionCount;
+    Option LACSRewardCount;
+    Option LACSDungeonCount;
+    Option LACSTokenCount;
+    Option LACSRewardOptions;
+    Option KeyRings;
+    Option KeyRingsRandomCount;
+    Option RingFortress;
+    Option RingForest;
+    Option RingFire;
+    Option RingWater;
+    Option RingSpirit;
+    Option RingShadow;
+    Option RingWell;
+    Option RingGtg;
+    Option RingCastle;
+
+    std::vector<Option *> shuffleDungeonItemOptions;
+    std::vector<Option *> keyRingOptions;
+
+    //Timesaver Settings
+    Option SkipChildStealth;
+    Option SkipTowerEscape;
+    Option SkipEponaRace;
+    Option SkipMinigamePhases;
+    Option FreeScarecrow;
+    Option FourPoesCutscene;
+    Option LakeHyliaOwl;
+    Option BigPoeTargetCount;
+    Option NumRequiredCuccos;
+    Option KingZoraSpeed;
+    Option CompleteMaskQuest;
+    Option EnableGlitchCutscenes;
+    Option QuickText;
+    Option SkipSongReplays;
+    Option KeepFWWarpPoint;
+    Option FastBunnyHood;
+    std::vector<Option *> timesaverOptions;
+
+    //Misc Settings
+    Option GossipStoneHints;
+    Option ClearerHints;
+    Option HintDistribution; // Balanced
+    Option AltarHintText;
+    Option LightArrowHintText;
+    Option DampeHintText;
+    Option GregHintText;
+    Option SariaHintText;
+    Option FrogsHintText;
+    Option WarpSongHints;
+    Option Kak10GSHintText;
+    Option Kak20GSHintText;
+    Option Kak30GSHintText;
+    Option Kak40GSHintText;
+    Option Kak50GSHintText;
+    Option ScrubHintText;
+    Option CompassesShowReward;
+    Option CompassesShowWotH;
+    Option MapsShowDungeonMode;
+    Option DamageMultiplier;
+    Option StartingTime;
+    Option ChestAnimations;
+    Option ChestSize;
+    Option GenerateSpoilerLog; // On
+    Option IngameSpoilers;
+    Option RandomTrapDmg; // Basic
+    Option BlueFireArrows;
+    Option SunlightArrows;
+
+    bool HasNightStart = false;
+    std::vector<Option *> miscOptions;
+
+    //Item Usability Settings
+    Option FaroresWindAnywhere;
+    Option AgeItemsToggle;
+    Option StickAsAdult;
+    Option BoomerangAsAdult;
+    Option HammerAsChild;
+    Option SlingshotAsAdult;
+    Option BowAsChild;
+    Option HookshotAsChild;
+    Option IronBootsAsChild;
+    Option HoverBootsAsChild;
+    Option MasksAsAdult;
+    Option KokiriSwordAsAdult;
+    Option MasterSwordAsChild;
+    Option BiggoronSwordAsChild;
+    Option DekuShieldAsAdult;
+    Option MirrorShieldAsChild;
+    Option GoronTunicAsChild;
+    Option ZoraTunicAsChild;
+    Option GkDurability;
+    std::vector<Option *> itemUsabilityOptions;
+
+    //Item Pool Settings
+    Option ItemPoolValue;
+    Option IceTrapValue;
+    Option RemoveDoubleDefense;
+    Option ProgressiveGoronSword;
+    std::vector<Option *> itemPoolOptions;
+
+    //Excluded Locations (Individual definitions made in ItemLocation class)
+    std::vector<std::vector<Option *>> excludeLocationsOptionsVector;
+    Menu excludeKokiriForest;
+    Menu excludeLostWoods;
+    Menu excludeDekuTree;
+    Menu excludeForestTemple;
+    Menu excludeKakariko;
+    Menu excludeBottomWell;
+    Menu excludeShadowTemple;
+    Menu excludeDeathMountain;
+    Menu excludeGoronCity;
+    Menu excludeDodongosCavern;
+    Menu excludeFireTemple;
+    Menu excludeZorasRiver;
+    Menu excludeZorasDomain;
+    Menu excludeJabuJabu;
+    Menu excludeIceCavern;
+    Menu excludeHyruleField;
+    Menu excludeLonLonRanch;
+    Menu excludeLakeHylia;
+    Menu excludeWaterTemple;
+    Menu excludeGerudoValley;
+    Menu excludeGerudoTrainingGrounds;
+    Menu excludeSpiritTemple;
+    Menu excludeHyruleCastle;
+    Menu excludeGanonsCastle;
+    std::vector<Menu *> excludeLocationsMenus;
+
+    //Starting Inventory submenus and menus
+    std::vector<std::string> bottleOptions;
+    Option StartingStickCapacity;
+    Option StartingNutCapacity;
+    Option StartingSlingshot;
+    Option StartingOcarina;
+    Option StartingBombBag;
+    Option StartingBombchus;
+    Option StartingBoomerang;
+    Option StartingHookshot;
+    Option StartingBow;
+    Option StartingFireArrows;
+    Option StartingIceArrows;
+    Option StartingLightArrows;
+    Option StartingMegatonHammer;
+    Option StartingIronBoots;
+    Option StartingHoverBoots;
+    Option StartingLensOfTruth;
+    Option StartingDinsFire;
+    Option StartingFaroresWind;
+    Option StartingNayrusLove;
+    Option StartingMagicBean;
+    Option StartingBottle1;
+    Option StartingBottle2;
+    Option StartingBottle3;
+    Option StartingBottle4;
+    Option StartingRutoBottle;
+    std::vector<Option *> startingItemsOptions;
+
+    Option StartingZeldasLullaby;
+    Option StartingEponasSong;
+    Option StartingSariasSong;
+    Option StartingSunsSong;
+    Option StartingSongOfTime;
+    Option StartingSongOfStorms;
+    Option StartingMinuetOfForest;
+    Option StartingBoleroOfFire;
+    Option StartingSerenadeOfWater;
+    Option StartingRequiemOfSpirit;
+    Option StartingNocturneOfShadow;
+    Option StartingPreludeOfLight;
+    std::vector<Option *> startingSongsOptions;
+
+    Option StartingKokiriSword;
+    Option StartingMasterSword;
+    Option StartingBiggoronSword;
+    Option StartingDekuShield;
+    Option StartingHylianShield;
+    Option StartingMirrorShield;
+    Option StartingGoronTunic;
+    Option StartingZoraTunic;
+    Option StartingStrength;
+    Option StartingScale;
+    Option StartingWallet;
+    Option StartingShardOfAgony;
+    Option StartingHearts; // Default 3 hearts
+    Option StartingMagicMeter;
+    Option StartingDoubleDefense;
+
+    std::vector<Option *> startingEquipmentOptions;
+
+    Option StartingKokiriEmerald;
+    Option StartingGoronRuby;
+    Option StartingZoraSapphire;
+    Option StartingLightMedallion;
+    Option StartingForestMedallion;
+    Option StartingFireMedallion;
+    Option StartingWaterMedallion;
+    Option StartingSpiritMedallion;
+    Option StartingShadowMedallion;
+    std::vector<Option *> startingStonesMedallionsOptions;
+
+    Option StartingConsumables;
+    Option StartingMaxRupees;
+    Option StartingSkulltulaToken;
+    std::vector<Option *> startingOthersOptions;
+
+    Menu startingItems;
+    Menu startingSongs;
+    Menu startingEquipment;
+    Menu startingStonesMedallions;
+    Menu startingOthers;
+    std::vector<Menu *> startingInventoryOptions;
+    Option Logic;
+    Option LocationsReachable; //All Locations Reachable On
+    Option NightGSExpectSuns;
+    std::vector<Option *> logicOptions;
+
+    //Detailed Logic Tricks                               ---------------------
+    Option LogicVisibleCollision;
+    Option LogicGrottosWithoutAgony;
+    Option LogicFewerTunicRequirements;
+    Option LogicRustedSwitches;
+    Option LogicFlamingChests;
+    Option LogicBunnyHoodJump;
+    Option LogicDamageBoost;
+    Option LogicHoverBoost;
+    Option LogicAdultKokiriGS;
+    Option LogicLostWoodsBridge;
+    Option LogicMidoBackflip;
+    Option LogicLostWoodsGSBean;
+    Option LogicCastleStormsGS;
+    Option LogicManOnRoof;
+    Option LogicKakarikoTowerGS;
+    Option LogicAdultWindmillPoH;
+    Option LogicChildWindmillPoH;
+    Option LogicKakarikoRooftopGS;
+    Option LogicGraveyardPoH;
+    Option LogicChildDampeRacePoH;
+    Option LogicShadowFireArrowEntry;
+    Option LogicDMTSoilGS;
+    Option LogicDMTBombable;
+    Option LogicDMTGSLowerHookshot;
+    Option LogicDMTGSLowerHovers;
+    Option LogicDMTGSLowerBean;
+    Option LogicDMTGSLowerJS;
+    Option LogicDMTClimbHovers;
+    Option LogicDMTGSUpper;
+    Option LogicBiggoronBolero;
+    Option LogicGoronCityPot;
+    Option LogicGoronCityPotWithStrength;
+    Option LogicChildRollingWithStrength;
+    Option LogicGoronCityLeftMost;
+    Option LogicGoronCityGrotto;
+    Option LogicGoronCityLinkGoronDins;
+    Option LogicCraterBeanPoHWithHovers;
+    Option LogicCraterBoleroJump;
+    Option LogicCraterBoulderJS;
+    Option LogicCraterBoulderSkip;
+    Option LogicZoraRiverLower;
+    Option LogicZoraRiverUpper;
+    Option LogicZoraWithHovers;
+    Option LogicZoraWithCucco;
+    Option LogicKingZoraSkip;
+    Option LogicDomainGS;
+    Option LogicLabWallGS;
+    Option LogicLabDiving;
+    Option LogicWaterHookshotEntry;
+    Option LogicValleyCrateHovers;
+    Option LogicGerudoKitchen;
+    Option LogicGFJump;
+    Option LogicWastelandBunnyCrossing;
+    Option LogicWastelandCrossing;
+    Option LogicLensWasteland;
+    Option LogicReverseWasteland;
+    Option LogicColossusGS;
+    Option LogicDekuBasementGS;
+    Option LogicDekuB1Skip;
+    Option LogicDekuB1WebsWithBow;
+    Option LogicDekuMQCompassGS;
+    Option LogicDekuMQLog;
+    Option LogicDCScarecrowGS;
+    Option LogicDCVinesGS;
+    Option LogicDCStaircase;
+    Option LogicDCSlingshotSkip;
+    Option LogicDCScrubRoom;
+    Option LogicDCJump;
+    Option LogicDCHammerFloor;
+    Option LogicDCMQChildBombs;
+    Option LogicDCMQEyesChild;
+    Option LogicDCMQEyesAdult;
+    Option LogicJabuAlcoveJumpDive;
+    Option LogicJabuBossHover;
+    Option LogicJabuNearBossRanged;
+    Option LogicJabuNearBossExplosives;
+    Option LogicLensJabuMQ;
+    Option LogicJabuMQRangJump;
+    Option LogicJabuMQSoTGS;
+    Option LogicLensBotw;
+    Option LogicChildDeadhand;
+    Option LogicBotwBasement;
+    Option LogicBotwMQPits;
+    Option LogicBotwMQDeadHandKey;
+    Option LogicForestFirstGS;
+    Option LogicForestOutdoorEastGS;
+    Option LogicForestVines;
+    Option LogicForestOutdoorsLedge;
+    Option LogicForestDoorFrame;
+    Option LogicForestOutsideBackdoor;
+    Option LogicForestMQWellSwim;
+    Option LogicForestMQBlockPuzzle;
+    Option LogicForestMQHallwaySwitchJS;
+    Option LogicForestMQHallwaySwitchHookshot;
+    Option LogicForestMQHallwaySwitchBoomerang;
+    Option LogicFireBossDoorJump;
+    Option LogicFireSongOfTime;
+    Option LogicFireStrength;
+    Option LogicFireScarecrow;
+    Option LogicFireFlameMaze;
+    Option LogicFireMQNearBoss;
+    Option LogicFireMQBlockedChest;
+    Option LogicFireMQBKChest;
+    Option LogicFireMQClimb;
+    Option LogicFireMQMazeSideRoom;
+    Option LogicFireMQMazeHovers;
+    Option LogicFireMQMazeJump;
+    Option LogicFireMQAboveMazeGS;
+    Option LogicFireMQFlameMaze;
+    Option LogicWaterTempleTorchLongshot;
+    Option LogicWaterCrackedWallHovers;
+    Option LogicWaterCrackedWallNothing;
+    Option LogicWaterBossKeyRegion;
+    Option LogicWaterNorthBasementLedgeJump;
+    Option LogicWaterBKJumpDive;
+    Option LogicWaterCentralGSFW;
+    Option LogicWaterCentralGSIrons;
+    Option LogicWaterCentralBow;
+    Option LogicWaterFallingPlatformGSHookshot;
+    Option LogicWaterFallingPlatformGSBoomerang;
+    Option LogicWaterRiverGS;
+    Option LogicWaterDragonJumpDive;
+    Option LogicWaterDragonAdult;
+    Option LogicWaterDragonChild;
+    Option LogicWaterMQCentralPillar;
+    Option LogicWaterMQLockedGS;
+    Option LogicLensShadow;
+    Option LogicLensShadowPlatform;
+    Option LogicLensBongo;
+    Option LogicShadowUmbrella;
+    Option LogicShadowUmbrellaGS;
+    Option LogicShadowFreestandingKey;
+    Option LogicShadowStatue;
+    Option LogicShadowBongo;
+    Option LogicLensShadowMQ;
+    Option LogicLensShadowMQInvisibleBlades;
+    Option LogicLensShadowMQPlatform;
+    Option LogicLensShadowMQDeadHand;
+    Option LogicShadowMQGap;
+    Option LogicShadowMQInvisibleBlades;
+    Option LogicShadowMQHugePit;
+    Option LogicShadowMQWindyWalkway;
+    Option LogicLensSpirit;
+    Option LogicSpiritChildBombchu;
+    Option LogicSpiritLobbyGS;
+    Option LogicSpiritLowerAdultSwitch;
+    Option LogicSpiritLobbyJump;
+    Option LogicSpiritPlatformHookshot;
+    Option LogicSpiritMapChest;
+    Option LogicSpiritSunChest;
+    Option LogicSpiritWall;
+    Option LogicLensSpiritMQ;
+    Option LogicSpiritMQSunBlockSoT;
+    Option LogicSpiritMQSunBlockGS;
+    Option LogicSpiritMQLowerAdult;
+    Option LogicSpiritMQFrozenEye;
+    Option LogicIceBlockGS;
+    Option LogicIceMQRedIceGS;
+    Option LogicIceMQScarecrow;
+    Option LogicLensGtg;
+    Option LogicGtgWithoutHookshot;
+    Option LogicGtgFakeWall;
+    Option LogicLensGtgMQ;
+    Option LogicGtgMQWithHookshot;
+    Option LogicGtgMQWithoutHookshot;
+    Option LogicLensCastle;
+    Option LogicSpiritTrialHookshot;
+    Option LogicLensCastleMQ;
+    Option LogicFireTrialMQ;
+    Option LogicShadowTrialMQ;
+    Option LogicLightTrialMQ;
+
+    std::vector<Option *> trickOptions;
+    std::unordered_map<RandomizerTrick,Option *> trickOptionMap;
+
+    //TODO completely rewrite glitch section since oot3d glitches differ from oot
+
+    Option GlitchEquipSwapDins;
+    Option GlitchEquipSwap;
+
+    std::vector<Option*> glitchCategories;
+
+    std::vector<Option*> miscGlitches;
+
+    Menu glitchCategorySettings;
+    Menu miscGlitchSettings;
+    std::vector<Menu*> glitchOptions;
+
+    Menu loadSettingsPreset;
+    Menu saveSettingsPreset;
+    Menu deleteSettingsPreset;
+    Menu resetToDefaultSettings;
+
+    std::vector<Menu *> settingsPresetItems;
+
+    //Detailed Logic Options Submenu
+    Menu logicSettings;
+    Menu excludeLocations;
+    Menu tricks;
+    Menu glitchSettings;
+    std::vector<Menu *> detailedLogicOptions;
+
+    Menu open;
+    Menu worldSettings;
+    Menu shuffle;
+    Menu shuffleDungeonItems;
+    Menu detailedLogic;
+    Menu startingInventory;
+    Menu timesaverSettings;
+    Menu miscSettings;
+    Menu itemPoolSettings;
+    Menu itemUsabilitySettings;
+    Menu settingsPresets;
+    Menu generateRandomizer;
+
+    //adding a menu with no options crashes, might fix later
+    std::vector<Menu *> mainMenu;
+
+    //declared here, set in fill.cpp
+    uint32_t LinksPocketRewardBitMask = 0;
+    std::array<uint32_t, 9> rDungeonRewardOverrides = {};
+
+    //Options that should be saved, set to default, then restored after finishing when vanilla logic is enabled
+    std::vector<std::pair<Option*, uint8_t>> vanillaLogicOverrides;
+
+    void UpdateSettings(std::unordered_map<RandomizerSettingKey, uint8_t> cvarSettings, std::set<RandomizerCheck> excludedLocations, std::set<RandomizerTrick> enabledTricks);
+    SettingsContext FillContext();
+    void ResolveExcludedLocationConflicts();
+    void RandomizeAllSettings(const bool selectOptions = false);
+    void ForceChange(uint32_t kDown, Option* currentSetting);
+    const std::vector<Menu*> GetAllOptionMenus();
+
+  private:
+    uint8_t DungeonsOfType(uint8_t type);
+    bool IsMQOption(Option *option);
+  };
+} // namespace Settings
+
+extern thread_local constinit Settings::Vars* settings;
@@ -7,14 +7,12 @@
 
 #include <math.h>
 #include <map>
+#include <mutex>
 #include "z64item.h"
 
 using namespace Settings;
 
-std::vector<ItemAndPrice> NonShopItems = {};
-
 static std::array<std::vector<Text>, 0xE1> trickNameTable; // Table of trick names for ice traps
-bool initTrickNames = false; //Indicates if trick ice trap names have been initialized yet
 
 //Set vanilla shop item locations before potentially shuffling
 void PlaceVanillaShopItems() {
@@ -135,13 +133,13 @@ int GetPriceFromMax(int max) {
 // Get random price out of available "affordable prices", or just return 10 if Starter wallet is selected (no need to randomly select
 // from a single element)
 int GetPriceAffordable() {
-    if (Settings::ShopsanityPrices.Is(RO_SHOPSANITY_PRICE_STARTER)) {
+    if (settings->ShopsanityPrices.Is(RO_SHOPSANITY_PRICE_STARTER)) {
         return 10;
     }
 
     static const std::vector<int> affordablePrices = { 10, 105, 205, 505 };
     std::vector<int> priceList;
-    uint8_t maxElements = Settings::ShopsanityPrices.Value<uint8_t>();
+    uint8_t maxElements = settings->ShopsanityPrices.Value<uint8_t>();
     for (int i = 0; i < maxElements; i++) {
         priceList.push_back(affordablePrices.at(i));
     }
@@ -150,7 +148,7 @@ int GetPriceAffordable() {
 
 int GetRandomShopPrice() {
     // If Shopsanity prices aren't Balanced, but Affordable is on, don't GetPriceFromMax
-    if (Settings::ShopsanityPricesAffordable.Is(true) && Settings::ShopsanityPrices.IsNot(RO_SHOPSANITY_PRICE_BALANCED)) {
+    if (settings->ShopsanityPricesAffordable.Is(true) && settings->ShopsanityPrices.IsNot(RO_SHOPSANITY_PRICE_BALANCED)) {
         return GetPriceAffordable();
     }
 
@@ -158,16 +156,16 @@ int GetRandomShopPrice() {
     int max = 0;
 
     // check settings for a wallet tier selection and set max amount as method for setting true randomization
-    if(Settings::ShopsanityPrices.Is(RO_SHOPSANITY_PRICE_STARTER)) {
+    if(settings->ShopsanityPrices.Is(RO_SHOPSANITY_PRICE_STARTER)) {
         max = 19; // 95/5
     }
-    else if (Settings::ShopsanityPrices.Is(RO_SHOPSANITY_PRICE_ADULT)) {
+    else if (settings->ShopsanityPrices.Is(RO_SHOPSANITY_PRICE_ADULT)) {
         max = 40; // 200/5
     }
-    else if (Settings::ShopsanityPrices.Is(RO_SHOPSANITY_PRICE_GIANT)) {
+    else if (settings->ShopsanityPrices.Is(RO_SHOPSANITY_PRICE_GIANT)) {
         max = 100; // 500/5
     }
-    else if (Settings::ShopsanityPrices.Is(RO_SHOPSANITY_PRICE_TYCOON)) {
+    else if (settings->ShopsanityPrices.Is(RO_SHOPSANITY_PRICE_TYCOON)) {
         max = 199; // 995/5
     }
     if (max != 0) {
@@ -206,13 +204,13 @@ int16_t GetRandomScrubPrice() {
 
 //Get 1 to 4, or a random number from 1-4 depending on shopsanity setting
 int GetShopsanityReplaceAmount() {
-  if (Settings::Shopsanity.Is(SHOPSANITY_ONE)) {
+  if (settings->Shopsanity.Is(SHOPSANITY_ONE)) {
     return 1;
-  } else if (Settings::Shopsanity.Is(SHOPSANITY_TWO)) {
+  } else if (settings->Shopsanity.Is(SHOPSANITY_TWO)) {
     return 2;
-  } else if (Settings::Shopsanity.Is(SHOPSANITY_THREE)) {
+  } else if (settings->Shopsanity.Is(SHOPSANITY_THREE)) {
     return 3;
-  } else if (Settings::Shopsanity.Is(SHOPSANITY_FOUR)) {
+  } else if (settings->Shopsanity.Is(SHOPSANITY_FOUR)) {
     return 4;
   } else { //Random, get number in [1, 4]
     return Random(1, 5);
@@ -853,17 +851,15 @@ void InitTrickNames() {
 
 //Generate a fake name for the ice trap based on the item it's displayed as
 Text GetIceTrapName(uint8_t id) {
-  //If the trick names table has not been initialized, do so
-  if (!initTrickNames) {
-    InitTrickNames();
-    initTrickNames = true;
-  }
+  //If the trick names table has not been initialized, do so. It's shared by every generation.
+  static std::once_flag initTrickNames;
+  std::call_once(initTrickNames, InitTrickNames);
   //Randomly get the easy, medium, or hard name for the given item id
   return RandomElement(trickNameTable[id]);
 }
 
 //Get shop index based on a given location
-static std::map<std::string_view, int> ShopNameToNum = {{"KF Shop", 0},   {"Kak Potion Shop", 1}, {"MK Bombchu Shop", 2}, {"MK Potion Shop", 3},
+static const std::map<std::string_view, int> ShopNameToNum = {{"KF Shop", 0},   {"Kak Potion Shop", 1}, {"MK Bombchu Shop", 2}, {"MK Potion Shop", 3},
                                                         {"MK Bazaar", 4}, {"Kak Bazaar", 5},      {"ZD Shop", 6},         {"GC Shop", 7}};
 int GetShopIndex(uint32_t loc) {
   //Kind of hacky, but extract the shop and item position from the name
@@ -871,7 +867,7 @@ int GetShopIndex(uint32_t loc) {
   int split = name.find(" Item ");
   std::string_view shop(name.c_str(), split);
   int pos = std::stoi(name.substr(split+6, 1)) - 1;
-  int shopnum = ShopNameToNum[shop];
+  int shopnum = ShopNameToNum.at(shop);
   return shopnum*8 + pos;
 }
 
@@ -19,5 +19,3 @@ extern int GetShopsanityReplaceAmount();
 extern Text GetIceTrapName(uint8_t id);
 extern int GetShopIndex(uint32_t loc);
 extern int TransformShopIndex(int index);
-
-extern std::vector<ItemAndPrice> NonShopItems;
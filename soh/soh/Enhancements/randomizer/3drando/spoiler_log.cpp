@@ -4,6 +4,7 @@
 #include "item_list.hpp"
 #include "item_location.hpp"
 #include "entrance.hpp"
+#include "fill_profiler.hpp"
 #include "random.hpp"
 #include "settings.hpp"
 #include "trial.hpp"
@@ -14,6 +15,8 @@
 #include "../randomizer_tricks.h"
 #include "pool_functions.hpp"
 #include "soh/Enhancements/randomizer/randomizer_check_objects.h"
+#include "soh/Enhancements/randomizer/randomizer_seed_file.h"
+#include "world.hpp"
 #include <nlohmann/json.hpp>
 
 #include <cstdio>
@@ -28,34 +31,184 @@
 #include <iostream>
 #include <fstream>
 #include <filesystem>
-#include <variables.h>
 
+#ifndef RANDOMIZER_HEADLESS
+#include <variables.h>
 #include <libultraship/libultraship.h>
+#else
+// The headless generator is built without the game headers, so it declares the little it uses from them itself
+extern "C" const char gBuildVersion[];
+extern "C" const char gGitBranch[];
+extern "C" const char gGitCommitHash[];
+enum { LANGUAGE_ENG, LANGUAGE_GER, LANGUAGE_FRA };
+#endif
 
 using json = nlohmann::ordered_json;
 
-json jsonData;
-std::map<HintKey, ItemLocation*> hintedLocations;
-
 extern std::unordered_map<HintType, std::string> hintTypeNames;
 extern std::array<std::string, 17> hintCategoryNames;
 extern Area* GetHintRegion(uint32_t);
 
-namespace {
-std::string placementtxt;
-} // namespace
-
-static SpoilerData spoilerData;
+static bool sWriteSpoilerFiles = true;
+
+std::unordered_map<std::string, RandomizerSettingKey> SpoilerfileSettingNameToEnum = {
+    { "Logic Options:Logic", RSK_LOGIC_RULES },
+    { "Logic Options:Night GSs Expect Sun's", RSK_SKULLS_SUNS_SONG },
+    { "Logic Options:All Locations Reachable", RSK_ALL_LOCATIONS_REACHABLE },
+    { "Item Pool Settings:Item Pool", RSK_ITEM_POOL },
+    { "Item Pool Settings:Ice Traps", RSK_ICE_TRAPS },
+    { "Open Settings:Forest", RSK_FOREST },
+    { "Open Settings:Kakariko Gate", RSK_KAK_GATE },
+    { "Open Settings:Door of Time", RSK_DOOR_OF_TIME },
+    { "Open Settings:Zora's Fountain", RSK_ZORAS_FOUNTAIN },
+    { "Open Settings:Gerudo Fortress", RSK_GERUDO_FORTRESS },
+    { "Open Settings:Rainbow Bridge", RSK_RAINBOW_BRIDGE },
+    { "Open Settings:Trial Count", RSK_TRIAL_COUNT },
+    { "Open Settings:Stone Count", RSK_RAINBOW_BRIDGE_STONE_COUNT },
+    { "Open Settings:Medallion Count", RSK_RAINBOW_BRIDGE_MEDALLION_COUNT },
+    { "Open Settings:Reward Count", RSK_RAINBOW_BRIDGE_REWARD_COUNT },
+    { "Open Settings:Dungeon Count", RSK_RAINBOW_BRIDGE_DUNGEON_COUNT },
+    { "Open Settings:Token Count", RSK_RAINBOW_BRIDGE_TOKEN_COUNT },
+    { "Open Settings:Bridge Reward Options", RSK_BRIDGE_OPTIONS },
+    { "Shuffle Settings:Shuffle Dungeon Rewards", RSK_SHUFFLE_DUNGEON_REWARDS },
+    { "Shuffle Settings:Link's Pocket", RSK_LINKS_POCKET},
+    { "Shuffle Settings:Shuffle Songs", RSK_SHUFFLE_SONGS },
+    { "Shuffle Settings:Shuffle Gerudo Card", RSK_SHUFFLE_GERUDO_MEMBERSHIP_CARD },
+    { "Shuffle Settings:Shopsanity", RSK_SHOPSANITY },
+    { "Shuffle Settings:Shopsanity Prices", RSK_SHOPSANITY_PRICES },
+    { "Shuffle Settings:Affordable Prices", RSK_SHOPSANITY_PRICES_AFFORDABLE },
+    { "Shuffle Settings:Scrub Shuffle", RSK_SHUFFLE_SCRUBS },
+    { "Shuffle Settings:Shuffle Cows", RSK_SHUFFLE_COWS },
+    { "Shuffle Settings:Tokensanity", RSK_SHUFFLE_TOKENS },
+    { "Shuffle Settings:Shuffle Ocarinas", RSK_SHUFFLE_OCARINA },
+    { "Shuffle Settings:Shuffle Adult Trade", RSK_SHUFFLE_ADULT_TRADE },
+    { "Shuffle Settings:Shuffle Magic Beans", RSK_SHUFFLE_MAGIC_BEANS },
+    { "Shuffle Settings:Shuffle Kokiri Sword", RSK_SHUFFLE_KOKIRI_SWORD },
+    { "Shuffle Settings:Shuffle Master Sword", RSK_SHUFFLE_MASTER_SWORD },
+    { "Shuffle Settings:Shuffle Weird Egg", RSK_SHUFFLE_WEIRD_EGG },
+    { "Shuffle Settings:Shuffle Frog Song Rupees", RSK_SHUFFLE_FROG_SONG_RUPEES },
+    { "Shuffle Settings:Shuffle Merchants", RSK_SHUFFLE_MERCHANTS },
+    { "Shuffle Settings:Shuffle 100 GS Reward", RSK_SHUFFLE_100_GS_REWARD },
+    { "Start with Deku Shield", RSK_STARTING_DEKU_SHIELD },
+    { "Start with Kokiri Sword", RSK_STARTING_KOKIRI_SWORD },
+    { "Start with Fairy Ocarina", RSK_STARTING_OCARINA },
+    { "Start with Zelda's Lullaby", RSK_STARTING_ZELDAS_LULLABY },
+    { "Start with Epona's Song", RSK_STARTING_EPONAS_SONG },
+    { "Start with Saria's Song", RSK_STARTING_SARIAS_SONG },
+    { "Start with Sun's Song", RSK_STARTING_SUNS_SONG },
+    { "Start with Song of Time", RSK_STARTING_SONG_OF_TIME },
+    { "Start with Song of Storms", RSK_STARTING_SONG_OF_STORMS },
+    { "Start with Minuet of Forest", RSK_STARTING_MINUET_OF_FOREST },
+    { "Start with Bolero of Fire", RSK_STARTING_BOLERO_OF_FIRE },
+    { "Start with Serenade of Water", RSK_STARTING_SERENADE_OF_WATER },
+    { "Start with Requiem of Spirit", RSK_STARTING_REQUIEM_OF_SPIRIT },
+    { "Start with Nocturne of Shadow", RSK_STARTING_NOCTURNE_OF_SHADOW },
+    { "Start with Prelude of Light", RSK_STARTING_PRELUDE_OF_LIGHT },
+    { "Shuffle Dungeon Items:Maps/Compasses", RSK_STARTING_MAPS_COMPASSES },
+    { "Shuffle Dungeon Items:Small Keys", RSK_KEYSANITY },
+    { "Shuffle Dungeon Items:Gerudo Fortress Keys", RSK_GERUDO_KEYS },
+    { "Shuffle Dungeon Items:Boss Keys", RSK_BOSS_KEYSANITY },
+    { "Shuffle Dungeon Items:Ganon's Boss Key", RSK_GANONS_BOSS_KEY },
+    { "Shuffle Dungeon Items:Stone Count", RSK_LACS_STONE_COUNT },
+    { "Shuffle Dungeon Items:Medallion Count", RSK_LACS_MEDALLION_COUNT },
+    { "Shuffle Dungeon Items:Reward Count", RSK_LACS_REWARD_COUNT },
+    { "Shuffle Dungeon Items:Dungeon Count", RSK_LACS_DUNGEON_COUNT },
+    { "Shuffle Dungeon Items:Token Count", RSK_LACS_TOKEN_COUNT },
+    { "Shuffle Dungeon Items:LACS Reward Options", RSK_LACS_OPTIONS },
+    { "Shuffle Dungeon Items:Key Rings", RSK_KEYRINGS },
+    { "Shuffle Dungeon Items:Keyring Dungeon Count", RSK_KEYRINGS_RANDOM_COUNT },
+    { "Shuffle Dungeon Items:Gerudo Fortress", RSK_KEYRINGS_GERUDO_FORTRESS },
+    { "Shuffle Dungeon Items:Forest Temple", RSK_KEYRINGS_FOREST_TEMPLE },
+    { "Shuffle Dungeon Items:Fire Temple", RSK_KEYRINGS_FIRE_TEMPLE },
+    { "Shuffle Dungeon Items:Water Temple", RSK_KEYRINGS_WATER_TEMPLE },
+    { "Shuffle Dungeon Items:Spirit Temple", RSK_KEYRINGS_SPIRIT_TEMPLE },
+    { "Shuffle Dungeon Items:Shadow Temple", RSK_KEYRINGS_SHADOW_TEMPLE },
+    { "Shuffle Dungeon Items:Bottom of the Well", RSK_KEYRINGS_BOTTOM_OF_THE_WELL },
+    { "Shuffle Dungeon Items:GTG", RSK_KEYRINGS_GTG },
+    { "Shuffle Dungeon Items:Ganon's Castle", RSK_KEYRINGS_GANONS_CASTLE },
+    { "World Settings:Starting Age", RSK_STARTING_AGE },
+    { "World Settings:Ammo Drops", RSK_ENABLE_BOMBCHU_DROPS },
+    { "World Settings:Bombchus in Logic", RSK_BOMBCHUS_IN_LOGIC },
+    { "World Settings:Shuffle Entrances", RSK_SHUFFLE_ENTRANCES },
+    { "World Settings:Dungeon Entrances", RSK_SHUFFLE_DUNGEON_ENTRANCES },
+    { "World Settings:Boss Entrances", RSK_SHUFFLE_BOSS_ENTRANCES },
+    { "World Settings:Overworld Entrances", RSK_SHUFFLE_OVERWORLD_ENTRANCES },
+    { "World Settings:Interior Entrances", RSK_SHUFFLE_INTERIOR_ENTRANCES },
+    { "World Settings:Grottos Entrances", RSK_SHUFFLE_GROTTO_ENTRANCES },
+    { "World Settings:Owl Drops", RSK_SHUFFLE_OWL_DROPS },
+    { "World Settings:Warp Songs", RSK_SHUFFLE_WARP_SONGS },
+    { "World Settings:Overworld Spawns", RSK_SHUFFLE_OVERWORLD_SPAWNS },
+    { "World Settings:Mixed Entrance Pools", RSK_MIXED_ENTRANCE_POOLS },
+    { "World Settings:Mix Dungeons", RSK_MIX_DUNGEON_ENTRANCES },
+    { "World Settings:Mix Bosses", RSK_MIX_BOSS_ENTRANCES },
+    { "World Settings:Mix Overworld", RSK_MIX_OVERWORLD_ENTRANCES },
+    { "World Settings:Mix Interiors", RSK_MIX_INTERIOR_ENTRANCES },
+    { "World Settings:Mix Grottos", RSK_MIX_GROTTO_ENTRANCES },
+    { "World Settings:Decouple Entrances", RSK_DECOUPLED_ENTRANCES },
+    { "World Settings:Triforce Hunt", RSK_TRIFORCE_HUNT },
+    { "World Settings:Triforce Hunt Total Pieces", RSK_TRIFORCE_HUNT_PIECES_TOTAL },
+    { "World Settings:Triforce Hunt Required Pieces", RSK_TRIFORCE_HUNT_PIECES_REQUIRED },
+    { "Misc Settings:Gossip Stone Hints", RSK_GOSSIP_STONE_HINTS },
+    { "Misc Settings:Hint Clarity", RSK_HINT_CLARITY },
+    { "Misc Settings:ToT Altar Hint", RSK_TOT_ALTAR_HINT },
+    { "Misc Settings:Light Arrow Hint", RSK_LIGHT_ARROWS_HINT },
+    { "Misc Settings:Dampe's Diary Hint", RSK_DAMPES_DIARY_HINT },
+    { "Misc Settings:Greg the Rupee Hint", RSK_GREG_HINT },
+    { "Misc Settings:Saria's Hint", RSK_SARIA_HINT },
+    { "Misc Settings:Frog Ocarina Game Hint", RSK_FROGS_HINT },
+    { "Misc Settings:10 GS Hint", RSK_KAK_10_SKULLS_HINT },
+    { "Misc Settings:20 GS Hint", RSK_KAK_20_SKULLS_HINT },
+    { "Misc Settings:30 GS Hint", RSK_KAK_30_SKULLS_HINT },
+    { "Misc Settings:40 GS Hint", RSK_KAK_40_SKULLS_HINT },
+    { "Misc Settings:50 GS Hint", RSK_KAK_50_SKULLS_HINT },
+    { "Misc Settings:Warp Song Hints", RSK_WARP_SONG_HINTS },
+    { "Misc Settings:Scrub Hint Text", RSK_SCRUB_TEXT_HINT },
+    { "Misc Settings:Hint Distribution", RSK_HINT_DISTRIBUTION },
+    { "Misc Settings:Blue Fire Arrows", RSK_BLUE_FIRE_ARROWS },
+    { "Misc Settings:Sunlight Arrows", RSK_SUNLIGHT_ARROWS },
+    { "Skip Child Zelda", RSK_SKIP_CHILD_ZELDA },
+    { "Start with Consumables", RSK_STARTING_CONSUMABLES },
+    { "Start with Max Rupees", RSK_FULL_WALLETS },
+    { "Gold Skulltula Tokens", RSK_STARTING_SKULLTULA_TOKEN },
+    { "Timesaver Settings:Cuccos to return", RSK_CUCCO_COUNT },
+    { "Timesaver Settings:Big Poe Target Count", RSK_BIG_POE_COUNT },
+    { "Timesaver Settings:Skip Child Stealth", RSK_SKIP_CHILD_STEALTH },
+    { "Timesaver Settings:Skip Epona Race", RSK_SKIP_EPONA_RACE },
+    { "Timesaver Settings:Skip Tower Escape", RSK_SKIP_TOWER_ESCAPE },
+    { "Timesaver Settings:Complete Mask Quest", RSK_COMPLETE_MASK_QUEST },
+    { "Timesaver Settings:Skip Scarecrow's Song", RSK_SKIP_SCARECROWS_SONG },
+    { "Timesaver Settings:Enable Glitch-Useful Cutscenes", RSK_ENABLE_GLITCH_CUTSCENES },
+    { "World Settings:MQ Dungeons", RSK_RANDOM_MQ_DUNGEONS },
+    { "World Settings:MQ Dungeon Count", RSK_MQ_DUNGEON_COUNT },
+    { "Shuffle Dungeon Quest:Forest Temple", RSK_MQ_FOREST_TEMPLE },
+    { "Shuffle Dungeon Quest:Fire Temple", RSK_MQ_FIRE_TEMPLE },
+    { "Shuffle Dungeon Quest:Water Temple", RSK_MQ_WATER_TEMPLE },
+    { "Shuffle Dungeon Quest:Spirit Temple", RSK_MQ_SPIRIT_TEMPLE },
+    { "Shuffle Dungeon Quest:Shadow Temple", RSK_MQ_SHADOW_TEMPLE },
+    { "Shuffle Dungeon Quest:Bottom of the Well", RSK_MQ_BOTTOM_OF_THE_WELL },
+    { "Shuffle Dungeon Quest:Ice Cavern", RSK_MQ_ICE_CAVERN },
+    { "Shuffle Dungeon Quest:GTG", RSK_MQ_GTG },
+    { "Shuffle Dungeon Quest:Ganon's Castle", RSK_MQ_GANONS_CASTLE },
+};
+
+// Where a spoiler file goes. The headless generator has no app directory and writes them under the working directory.
+static std::string GetSpoilerFilePath(const std::string& path) {
+#ifndef RANDOMIZER_HEADLESS
+    return Ship::Context::GetPathRelativeToAppDirectory(path.c_str());
+#else
+    return path;
+#endif
+}
 
 void GenerateHash() {
-    std::string hash = Settings::hash;
+    std::string hash = settings->hash;
     // adds leading 0s to the hash string if it has less than 10 digits.
     while (hash.length() < 10) {
         hash = "0" + hash;
     }
-    for (size_t i = 0, j = 0; i < Settings::hashIconIndexes.size(); i++, j += 2) {
+    for (size_t i = 0, j = 0; i < settings->hashIconIndexes.size(); i++, j += 2) {
         int number = std::stoi(hash.substr(j, 2));
-        Settings::hashIconIndexes[i] = number;
+        settings->hashIconIndexes[i] = number;
     }
 
     // Clear out spoiler log data here, in case we aren't going to re-generate it
@@ -63,7 +216,7 @@ void GenerateHash() {
 }
 
 const SpoilerData& GetSpoilerData() {
-  return spoilerData;
+  return world->spoilerData;
 }
 
 static auto GetGeneralPath() {
@@ -91,20 +244,20 @@ void WriteIngameSpoilerLog() {
     // Some item names, like gold skulltula tokens, can appear many times in a playthrough
     std::unordered_map<uint32_t, uint16_t>
         itemLocationsMap; // Map of LocationKey to an index into spoiler data item locations
-    itemLocationsMap.reserve(allLocations.size());
+    itemLocationsMap.reserve(world->allLocations.size());
     std::unordered_map<std::string, uint16_t>
         stringOffsetMap; // Map of strings to their offset into spoiler string data array
-    stringOffsetMap.reserve(allLocations.size() * 2);
+    stringOffsetMap.reserve(world->allLocations.size() * 2);
 
     // Sort all locations by their group, so the in-game log can show a group of items by simply starting/ending at
     // certain indices
-    std::stable_sort(allLocations.begin(), allLocations.end(), [](const uint32_t& a, const uint32_t& b) {
+    std::stable_sort(world->allLocations.begin(), world->allLocations.end(), [](const uint32_t& a, const uint32_t& b) {
         auto groupA = Location(a)->GetCollectionCheckGroup();
         auto groupB = Location(b)->GetCollectionCheckGroup();
         return groupA < groupB;
     });
 
-    for (const uint32_t key : allLocations) {
+    for (const uint32_t key : world->allLocations) {
         auto loc = Location(key);
 
         // Hide excluded locations from ingame tracker
@@ -112,26 +265,26 @@ void WriteIngameSpoilerLog() {
             continue;
         }
         // Cows
-        else if (!Settings::ShuffleCows && loc->IsCategory(Category::cCow)) {
+        else if (!settings->ShuffleCows && loc->IsCategory(Category::cCow)) {
             continue;
         }
         // Merchants
-        else if (Settings::ShuffleMerchants.Is(SHUFFLEMERCHANTS_OFF) && loc->IsCategory(Category::cMerchant)) {
+        else if (settings->ShuffleMerchants.Is(SHUFFLEMERCHANTS_OFF) && loc->IsCategory(Category::cMerchant)) {
             continue;
         }
         // Adult Trade
-        else if (!Settings::ShuffleAdultTradeQuest && loc->IsCategory(Category::cAdultTrade)) {
+        else if (!settings->ShuffleAdultTradeQuest && loc->IsCategory(Category::cAdultTrade)) {
             continue;
         }
         // Chest Minigame
-        else if (Settings::ShuffleChestMinigame.Is(SHUFFLECHESTMINIGAME_OFF) &&
+        else if (settings->ShuffleChestMinigame.Is(SHUFFLECHESTMINIGAME_OFF) &&
                  loc->IsCategory(Category::cChestMinigame)) {
             continue;
         }
         // Gerudo Fortress
-        else if ((Settings::GerudoFortress.Is(GERUDOFORTRESS_OPEN) &&
+        else if ((settings->GerudoFortress.Is(GERUDOFORTRESS_OPEN) &&
                   (loc->IsCategory(Category::cVanillaGFSmallKey) || loc->GetHintKey() == GF_GERUDO_MEMBERSHIP_CARD)) ||
-                 (Settings::GerudoFortress.Is(GERUDOFORTRESS_FAST) && loc->IsCategory(Category::cVanillaGFSmallKey) &&
+                 (settings->GerudoFortress.Is(GERUDOFORTRESS_FAST) && loc->IsCategory(Category::cVanillaGFSmallKey) &&
                   loc->GetHintKey() != GF_NORTH_F1_CARPENTER)) {
             continue;
         }
@@ -147,13 +300,13 @@ void WriteIngameSpoilerLog() {
             } else {
                 stringOffsetMap[locName] = spoilerStringOffset;
                 spoilerStringOffset +=
-                    sprintf(&spoilerData.StringData[spoilerStringOffset], nameFormatStr, locName.c_str()) + 1;
+                    sprintf(&world->spoilerData.StringData[spoilerStringOffset], nameFormatStr, locName.c_str()) + 1;
             }
         }
         // PURPLE TODO: LOCALIZATION
         auto locItem = loc->GetPlacedItemName().GetEnglish();
         if (loc->GetPlacedItemKey() == ICE_TRAP && loc->IsCategory(Category::cShop)) {
-            locItem = NonShopItems[TransformShopIndex(GetShopIndex(key))].Name.GetEnglish();
+            locItem = world->NonShopItems[TransformShopIndex(GetShopIndex(key))].Name.GetEnglish();
         }
         if (stringOffsetMap.find(locItem) == stringOffsetMap.end()) {
             if (spoilerStringOffset + locItem.size() + 1 >= SPOILER_STRING_DATA_SIZE) {
@@ -162,93 +315,93 @@ void WriteIngameSpoilerLog() {
             } else {
                 stringOffsetMap[locItem] = spoilerStringOffset;
                 spoilerStringOffset +=
-                    sprintf(&spoilerData.StringData[spoilerStringOffset], nameFormatStr, locItem.c_str()) + 1;
+                    sprintf(&world->spoilerData.StringData[spoilerStringOffset], nameFormatStr, locItem.c_str()) + 1;
             }
         }
 
-        spoilerData.ItemLocations[spoilerItemIndex].LocationStrOffset = stringOffsetMap[locName];
-        spoilerData.ItemLocations[spoilerItemIndex].ItemStrOffset = stringOffsetMap[locItem];
-        spoilerData.ItemLocations[spoilerItemIndex].LocationStr = locName;
-        spoilerData.ItemLocations[spoilerItemIndex].ItemStr = locItem;
-        spoilerData.ItemLocations[spoilerItemIndex].CollectionCheckType = loc->GetCollectionCheck().type;
-        spoilerData.ItemLocations[spoilerItemIndex].LocationScene = loc->GetCollectionCheck().scene;
-        spoilerData.ItemLocations[spoilerItemIndex].LocationFlag = loc->GetCollectionCheck().flag;
+        world->spoilerData.ItemLocations[spoilerItemIndex].LocationStrOffset = stringOffsetMap[locName];
+        world->spoilerData.ItemLocations[spoilerItemIndex].ItemStrOffset = stringOffsetMap[locItem];
+        world->spoilerData.ItemLocations[spoilerItemIndex].LocationStr = locName;
+        world->spoilerData.ItemLocations[spoilerItemIndex].ItemStr = locItem;
+        world->spoilerData.ItemLocations[spoilerItemIndex].CollectionCheckType = loc->GetCollectionCheck().type;
+        world->spoilerData.ItemLocations[spoilerItemIndex].LocationScene = loc->GetCollectionCheck().scene;
+        world->spoilerData.ItemLocations[spoilerItemIndex].LocationFlag = loc->GetCollectionCheck().flag;
 
         // Collect Type and Reveal Type
         if (key == GANON) {
-            spoilerData.ItemLocations[spoilerItemIndex].CollectType = COLLECTTYPE_NEVER;
-            spoilerData.ItemLocations[spoilerItemIndex].RevealType = REVEALTYPE_ALWAYS;
+            world->spoilerData.ItemLocations[spoilerItemIndex].CollectType = COLLECTTYPE_NEVER;
+            world->spoilerData.ItemLocations[spoilerItemIndex].RevealType = REVEALTYPE_ALWAYS;
         } else if (key == MARKET_BOMBCHU_BOWLING_BOMBCHUS) {
-            spoilerData.ItemLocations[spoilerItemIndex].CollectType = COLLECTTYPE_REPEATABLE;
-            spoilerData.ItemLocations[spoilerItemIndex].RevealType = REVEALTYPE_ALWAYS;
+            world->spoilerData.ItemLocations[spoilerItemIndex].CollectType = COLLECTTYPE_REPEATABLE;
+            world->spoilerData.ItemLocations[spoilerItemIndex].RevealType = REVEALTYPE_ALWAYS;
         }
         // Shops
         else if (loc->IsShop()) {
-            if (Settings::Shopsanity.Is(SHOPSANITY_OFF)) {
-                spoilerData.ItemLocations[spoilerItemIndex].RevealType = REVEALTYPE_ALWAYS;
+            if (settings->Shopsanity.Is(SHOPSANITY_OFF)) {
+                world->spoilerData.ItemLocations[spoilerItemIndex].RevealType = REVEALTYPE_ALWAYS;
             } else {
-                spoilerData.ItemLocations[spoilerItemIndex].RevealType = REVEALTYPE_SCENE;
+                world->spoilerData.ItemLocations[spoilerItemIndex].RevealType = REVEALTYPE_SCENE;
             }
             if (loc->GetPlacedItem().GetItemType() == ITEMTYPE_REFILL ||
                 loc->GetPlacedItem().GetItemType() == ITEMTYPE_SHOP ||
                 loc->GetPlacedItem().GetHintKey() == PROGRESSIVE_BOMBCHUS) {
-                spoilerData.ItemLocations[spoilerItemIndex].CollectType = COLLECTTYPE_REPEATABLE;
+                world->spoilerData.ItemLocations[spoilerItemIndex].CollectType = COLLECTTYPE_REPEATABLE;
             }
         }
         // Gold Skulltulas
         else if (loc->IsCategory(Category::cSkulltula) &&
-                 ((Settings::Tokensanity.Is(TOKENSANITY_OFF)) ||
-                  (Settings::Tokensanity.Is(TOKENSANITY_DUNGEONS) && !loc->IsDungeon()) ||
-                  (Settings::Tokensanity.Is(TOKENSANITY_OVERWORLD) && loc->IsDungeon()))) {
-            spoilerData.ItemLocations[spoilerItemIndex].RevealType = REVEALTYPE_ALWAYS;
+                 ((settings->Tokensanity.Is(TOKENSANITY_OFF)) ||
+                  (settings->Tokensanity.Is(TOKENSANITY_DUNGEONS) && !loc->IsDungeon()) ||
+                  (settings->Tokensanity.Is(TOKENSANITY_OVERWORLD) && loc->IsDungeon()))) {
+            world->spoilerData.ItemLocations[spoilerItemIndex].RevealType = REVEALTYPE_ALWAYS;
         }
         // Deku Scrubs
         else if (loc->IsCategory(Category::cDekuScrub) && !loc->IsCategory(Category::cDekuScrubUpgrades) &&
-                 Settings::Scrubsanity.Is(SCRUBSANITY_OFF)) {
-            spoilerData.ItemLocations[spoilerItemIndex].CollectType = COLLECTTYPE_REPEATABLE;
-            spoilerData.ItemLocations[spoilerItemIndex].RevealType = REVEALTYPE_ALWAYS;
+                 settings->Scrubsanity.Is(SCRUBSANITY_OFF)) {
+            world->spoilerData.ItemLocations[spoilerItemIndex].CollectType = COLLECTTYPE_REPEATABLE;
+            world->spoilerData.ItemLocations[spoilerItemIndex].RevealType = REVEALTYPE_ALWAYS;
         }
 
         auto checkGroup = loc->GetCollectionCheckGroup();
-        spoilerData.ItemLocations[spoilerItemIndex].Group = checkGroup;
+        world->spoilerData.ItemLocations[spoilerItemIndex].Group = checkGroup;
 
         // Group setup
         if (checkGroup != currentGroup) {
             currentGroup = checkGroup;
-            spoilerData.GroupOffsets[currentGroup] = spoilerGroupOffset;
+            world->spoilerData.GroupOffsets[currentGroup] = spoilerGroupOffset;
         }
-        ++spoilerData.GroupItemCounts[currentGroup];
+        ++world->spoilerData.GroupItemCounts[currentGroup];
         ++spoilerGroupOffset;
 
         itemLocationsMap[key] = spoilerItemIndex++;
     }
-    spoilerData.ItemLocationsCount = spoilerItemIndex;
+    world->spoilerData.ItemLocationsCount = spoilerItemIndex;
 
-    if (Settings::IngameSpoilers) {
+    if (settings->IngameSpoilers) {
         bool playthroughItemNotFound = false;
         // Write playthrough data to in-game spoiler log
         if (!spoilerOutOfSpace) {
-            for (uint32_t i = 0; i < playthroughLocations.size(); i++) {
+            for (uint32_t i = 0; i < world->playthroughLocations.size(); i++) {
                 if (i >= SPOILER_SPHERES_MAX) {
                     spoilerOutOfSpace = true;
                     break;
                 }
-                spoilerData.Spheres[i].ItemLocationsOffset = spoilerSphereItemoffset;
-                for (uint32_t loc = 0; loc < playthroughLocations[i].size(); ++loc) {
+                world->spoilerData.Spheres[i].ItemLocationsOffset = spoilerSphereItemoffset;
+                for (uint32_t loc = 0; loc < world->playthroughLocations[i].size(); ++loc) {
                     if (spoilerSphereItemoffset >= SPOILER_ITEMS_MAX) {
                         spoilerOutOfSpace = true;
                         break;
                     }
 
-                    const auto foundItemLoc = itemLocationsMap.find(playthroughLocations[i][loc]);
+                    const auto foundItemLoc = itemLocationsMap.find(world->playthroughLocations[i][loc]);
                     if (foundItemLoc != itemLocationsMap.end()) {
-                        spoilerData.SphereItemLocations[spoilerSphereItemoffset++] = foundItemLoc->second;
+                        world->spoilerData.SphereItemLocations[spoilerSphereItemoffset++] = foundItemLoc->second;
                     } else {
                         playthroughItemNotFound = true;
                     }
-                    ++spoilerData.Spheres[i].ItemCount;
+                    ++world->spoilerData.Spheres[i].ItemCount;
                 }
-                ++spoilerData.SphereCount;
+                ++world->spoilerData.SphereCount;
             }
         }
         if (spoilerOutOfSpace || playthroughItemNotFound) {
@@ -259,17 +412,17 @@ void WriteIngameSpoilerLog() {
 
 // Writes the location to the specified node.
 static void WriteLocation(
-    std::string sphere, const uint32_t locationKey, const bool withPadding = false) {
+    std::string sphere, const uint32_t locationKey, int language, const bool withPadding = false) {
   ItemLocation* location = Location(locationKey);
 
   // auto node = parentNode->InsertNewChildElement("location");
-  switch (gSaveContext.language) {
+  switch (language) {
         case LANGUAGE_ENG:
         default:
-            jsonData["playthrough"][sphere][location->GetName()] = location->GetPlacedItemName().GetEnglish();
+            world->jsonData["playthrough"][sphere][location->GetName()] = location->GetPlacedItemName().GetEnglish();
             break;
         case LANGUAGE_FRA:
-            jsonData["playthrough"][sphere][location->GetName()] = location->GetPlacedItemName().GetFrench();
+            world->jsonData["playthrough"][sphere][location->GetName()] = location->GetPlacedItemName().GetFrench();
             break;
     }
   // node->SetAttribute("name", location->GetName().c_str());
@@ -304,7 +457,7 @@ static void WriteLocation(
 }
 
 //Writes a shuffled entrance to the specified node
-static void WriteShuffledEntrance(std::string sphereString, Entrance* entrance) {
+static void WriteShuffledEntrance(std::string sphereString, Entrance* entrance, int language) {
   int16_t originalIndex = entrance->GetIndex();
   int16_t destinationIndex = -1;
   int16_t replacementIndex = entrance->GetReplacement()->GetIndex();
@@ -329,7 +482,7 @@ static void WriteShuffledEntrance(std::string sphereString, Entrance* entrance)
     {"overrideDestination", replacementDestinationIndex},
   });
 
-  jsonData["entrances"].push_back(entranceJson);
+  world->jsonData["entrances"].push_back(entranceJson);
 
   // When decoupled entrances is off, handle saving reverse entrances
   if (entrance->GetReverse() != nullptr && !entrance->IsDecoupled()) {
@@ -341,14 +494,14 @@ static void WriteShuffledEntrance(std::string sphereString, Entrance* entrance)
       {"overrideDestination", originalIndex},
     });
 
-    jsonData["entrances"].push_back(reverseEntranceJson);
+    world->jsonData["entrances"].push_back(reverseEntranceJson);
   }
 
-  switch (gSaveContext.language) {
+  switch (language) {
         case LANGUAGE_ENG:
         case LANGUAGE_FRA:
         default:
-            jsonData["entrancesMap"][sphereString][name] = text;
+            world->jsonData["entrancesMap"][sphereString][name] = text;
             break;
     }
 }
@@ -357,7 +510,7 @@ static void WriteShuffledEntrance(std::string sphereString, Entrance* entrance)
 static void WriteSettings(const bool printAll = false) {
   // auto parentNode = spoilerLog.NewElement("settings");
 
-  std::vector<Menu*> allMenus = Settings::GetAllOptionMenus();
+  std::vector<Menu*> allMenus = settings->GetAllOptionMenus();
 
   for (const Menu* menu : allMenus) {
     if (menu->name == "Item Usability Settings" ||
@@ -374,7 +527,7 @@ static void WriteSettings(const bool printAll = false) {
             setting->GetName() == "Skip Scarecrow's Song" ||
             setting->GetName() == "Enable Glitch-Useful Cutscenes") {
             std::string settingName = menu->name + ":" + setting->GetName();
-            jsonData["settings"][settingName] = setting->GetSelectedOptionText();
+            world->jsonData["settings"][settingName] = setting->GetSelectedOptionText();
         }
       }
       continue;
@@ -384,7 +537,7 @@ static void WriteSettings(const bool printAll = false) {
     if (menu->mode == OPTION_SUB_MENU && menu->printInSpoiler) {
       for (const Option* setting : *menu->settingsList) {
         std::string settingName = menu->name + ":" + setting->GetName();
-        jsonData["settings"][settingName] = setting->GetSelectedOptionText();
+        world->jsonData["settings"][settingName] = setting->GetSelectedOptionText();
       }
 
 
@@ -399,15 +552,15 @@ static void WriteSettings(const bool printAll = false) {
   }
 
   // 3drando doesn't have a "skip child zelda" setting, manually add it to the spoilerfile
-  jsonData["settings"]["Skip Child Zelda"] = Settings::skipChildZelda;
+  world->jsonData["settings"]["Skip Child Zelda"] = settings->skipChildZelda;
 
   // 3drando uses an MQ dungeon count of 13 to mean random, manually add that to the spoilerfile as a bool
-  if (Settings::MQDungeonCount.GetSelectedOptionIndex() == 0) {
-    jsonData["settings"]["World Settings:MQ Dungeons"] = "None";
-  } else if (Settings::MQDungeonCount.GetSelectedOptionIndex() == 13) {
-    jsonData["settings"]["World Settings:MQ Dungeons"] = "Random Number";
+  if (settings->MQDungeonCount.GetSelectedOptionIndex() == 0) {
+    world->jsonData["settings"]["World Settings:MQ Dungeons"] = "None";
+  } else if (settings->MQDungeonCount.GetSelectedOptionIndex() == 13) {
+    world->jsonData["settings"]["World Settings:MQ Dungeons"] = "Random Number";
   } else {
-    jsonData["settings"]["World Settings:MQ Dungeons"] = "Set Number";
+    world->jsonData["settings"]["World Settings:MQ Dungeons"] = "Set Number";
   }
 
   // spoilerLog.RootElement()->InsertEndChild(parentNode);
@@ -422,13 +575,13 @@ static void WriteSettings(const bool printAll = false) {
 static void WriteExcludedLocations() {
   // auto parentNode = spoilerLog.NewElement("excluded-locations");
 
-  for (size_t i = 1; i < Settings::excludeLocationsOptionsVector.size(); i++) {
-    for (const auto& location : Settings::excludeLocationsOptionsVector[i]) {
+  for (size_t i = 1; i < settings->excludeLocationsOptionsVector.size(); i++) {
+    for (const auto& location : settings->excludeLocationsOptionsVector[i]) {
       if (location->GetSelectedOptionIndex() == INCLUDE) {
         continue;
       }
 
-      jsonData["excludedLocations"].push_back(RemoveLineBreaks(location->GetName()));
+      world->jsonData["excludedLocations"].push_back(RemoveLineBreaks(location->GetName()));
 
       // tinyxml2::XMLElement* node = spoilerLog.NewElement("location");
       // node->SetAttribute("name", RemoveLineBreaks(location->GetName()).c_str());
@@ -444,11 +597,11 @@ static void WriteExcludedLocations() {
 // Writes the starting inventory to the spoiler log, if there is any.
 static void WriteStartingInventory() {
   std::vector<std::vector<Option *>*> startingInventoryOptions = {
-    &Settings::startingItemsOptions,
-    &Settings::startingSongsOptions,
-    &Settings::startingEquipmentOptions,
-    &Settings::startingStonesMedallionsOptions,
-    &Settings::startingOthersOptions
+    &settings->startingItemsOptions,
+    &settings->startingSongsOptions,
+    &settings->startingEquipmentOptions,
+    &settings->startingStonesMedallionsOptions,
+    &settings->startingOthersOptions
   };
 
   for (std::vector<Option*>* menu : startingInventoryOptions) {
@@ -467,7 +620,7 @@ static void WriteStartingInventory() {
               setting->GetName() == "Start with Requiem of Spirit" ||
               setting->GetName() == "Start with Nocturne of Shadow" || 
               setting->GetName() == "Start with Prelude of Light") {
-              jsonData["settings"][setting->GetName()] = setting->GetSelectedOptionText();
+              world->jsonData["settings"][setting->GetName()] = setting->GetSelectedOptionText();
           }
       }
   }
@@ -486,7 +639,7 @@ static void WriteStartingInventory() {
           setting->GetName() == "Start with Fairy Ocarina" ||
           setting->GetName() == "Start with Kokiri Sword" ||
           setting->GetName() == "Start with Deku Shield") {
-        jsonData["settings"][setting->GetName()] = setting->GetSelectedOptionText();
+        world->jsonData["settings"][setting->GetName()] = setting->GetSelectedOptionText();
       }
     }
   }
@@ -496,11 +649,11 @@ static void WriteStartingInventory() {
 static void WriteEnabledTricks(tinyxml2::XMLDocument& spoilerLog) {
   //auto parentNode = spoilerLog.NewElement("enabled-tricks");
 
-  for (const auto& setting : Settings::trickOptions) {
+  for (const auto& setting : settings->trickOptions) {
     if (setting->GetSelectedOptionIndex() != TRICK_ENABLED/* || !setting->IsCategory(OptionCategory::Setting)*/) {
       continue;
     }
-    jsonData["enabledTricks"].push_back(RemoveLineBreaks(RandomizerTricks::GetRTName((RandomizerTrick)std::stoi(setting->GetName()))).c_str());
+    world->jsonData["enabledTricks"].push_back(RemoveLineBreaks(RandomizerTricks::GetRTName((RandomizerTrick)std::stoi(setting->GetName()))).c_str());
     //auto node = parentNode->InsertNewChildElement("trick");
     //node->SetAttribute("name", RemoveLineBreaks(setting->GetName()).c_str());
   }
@@ -514,7 +667,7 @@ static void WriteEnabledTricks(tinyxml2::XMLDocument& spoilerLog) {
 static void WriteEnabledGlitches(tinyxml2::XMLDocument& spoilerLog) {
   auto parentNode = spoilerLog.NewElement("enabled-glitches");
 
-  for (const auto& setting : Settings::glitchCategories) {
+  for (const auto& setting : settings->glitchCategories) {
     if (setting->Value<uint8_t>() == 0) {
       continue;
     }
@@ -524,7 +677,7 @@ static void WriteEnabledGlitches(tinyxml2::XMLDocument& spoilerLog) {
     node->SetText(setting->GetSelectedOptionText().c_str());
   }
 
-  for (const auto& setting : Settings::miscGlitches) {
+  for (const auto& setting : settings->miscGlitches) {
     if (!setting->Value<bool>()) {
       continue;
     }
@@ -540,21 +693,21 @@ static void WriteEnabledGlitches(tinyxml2::XMLDocument& spoilerLog) {
 
 // Writes the Master Quest dungeons to the spoiler log, if there are any.
 static void WriteMasterQuestDungeons(tinyxml2::XMLDocument& spoilerLog) {
-    for (const auto* dungeon : Dungeon::dungeonList) {
+    for (const auto* dungeon : world->dungeons.dungeonList) {
         std::string dungeonName;
         if (dungeon->IsVanilla()) {
             continue;
         }
-        jsonData["masterQuestDungeons"].push_back(dungeon->GetName());
+        world->jsonData["masterQuestDungeons"].push_back(dungeon->GetName());
     }
 }
 
 // Writes the required trials to the spoiler log, if there are any.
-static void WriteRequiredTrials() {
-    for (const auto& trial : Trial::trialList) {
+static void WriteRequiredTrials(int language) {
+    for (const auto& trial : world->trials.trialList) {
         if (trial->IsRequired()) {
             std::string trialName;
-            switch (gSaveContext.language) {
+            switch (language) {
                 case LANGUAGE_FRA:
                     trialName = trial->GetName().GetFrench();
                     break;
@@ -563,22 +716,22 @@ static void WriteRequiredTrials() {
                     trialName = trial->GetName().GetEnglish();
                     break;
             }
-            jsonData["requiredTrials"].push_back(RemoveLineBreaks(trialName));
+            world->jsonData["requiredTrials"].push_back(RemoveLineBreaks(trialName));
         }
     }
 }
 
 // Writes the intended playthrough to the spoiler log, separated into spheres.
-static void WritePlaythrough() {
+static void WritePlaythrough(int language) {
   // auto playthroughNode = spoilerLog.NewElement("playthrough");
 
-  for (uint32_t i = 0; i < playthroughLocations.size(); ++i) {
+  for (uint32_t i = 0; i < world->playthroughLocations.size(); ++i) {
     auto sphereNum = std::to_string(i);
     std::string sphereString =  "sphere ";
     if (i < 10) sphereString += "0";
     sphereString += sphereNum;
-    for (const uint32_t key : playthroughLocations[i]) {
-      WriteLocation(sphereString, key, true);
+    for (const uint32_t key : world->playthroughLocations[i]) {
+      WriteLocation(sphereString, key, language, true);
     }
   }
 
@@ -586,14 +739,14 @@ static void WritePlaythrough() {
 }
 
 //Write the randomized entrance playthrough to the spoiler log, if applicable
-static void WriteShuffledEntrances() {
-  for (uint32_t i = 0; i < playthroughEntrances.size(); ++i) {
+static void WriteShuffledEntrances(int language) {
+  for (uint32_t i = 0; i < world->playthroughEntrances.size(); ++i) {
     auto sphereNum = std::to_string(i);
     std::string sphereString = "sphere ";
     if (i < 10) sphereString += "0";
     sphereString += sphereNum;
-    for (Entrance* entrance : playthroughEntrances[i]) {
-      WriteShuffledEntrance(sphereString, entrance);
+    for (Entrance* entrance : world->playthroughEntrances[i]) {
+      WriteShuffledEntrance(sphereString, entrance, language);
     }
   }
 }
@@ -602,7 +755,7 @@ static void WriteShuffledEntrances() {
 static void WriteWayOfTheHeroLocation(tinyxml2::XMLDocument& spoilerLog) {
     auto parentNode = spoilerLog.NewElement("way-of-the-hero-locations");
 
-    for (const uint32_t key : wothLocations) {
+    for (const uint32_t key : world->wothLocations) {
         // WriteLocation(parentNode, key, true);
     }
 
@@ -662,7 +815,7 @@ std::string AutoFormatHintTextString(std::string unformattedHintTextString) {
 }
 
 ItemLocation* GetItemLocation(uint32_t item) {
-    return Location(FilterFromPool(allLocations, [item](const uint32_t loc){return Location(loc)->GetPlaceduint32_t() == item;})[0]);
+    return Location(FilterFromPool(world->allLocations, [item](const uint32_t loc){return Location(loc)->GetPlaceduint32_t() == item;})[0]);
 }
 
 // Writes the hints to the spoiler log, if they are enabled.
@@ -683,14 +836,14 @@ static void WriteHints(int language) {
             unformattedGregText = GetGregHintText().GetEnglish();
             unformattedSheikText = GetSheikHintText().GetEnglish();
             unformattedSariaText = GetSariaHintText().GetEnglish();
-            jsonData["warpMinuetText"] = GetWarpMinuetText().GetEnglish();
-            jsonData["warpBoleroText"] = GetWarpBoleroText().GetEnglish();
-            jsonData["warpSerenadeText"] = GetWarpSerenadeText().GetEnglish();
-            jsonData["warpRequiemText"] = GetWarpRequiemText().GetEnglish();
-            jsonData["warpNocturneText"] = GetWarpNocturneText().GetEnglish();
-            jsonData["warpPreludeText"] = GetWarpPreludeText().GetEnglish();
-            jsonData["childAltar"]["hintText"] = GetChildAltarText().GetEnglish();
-            jsonData["adultAltar"]["hintText"] = GetAdultAltarText().GetEnglish();
+            world->jsonData["warpMinuetText"] = GetWarpMinuetText().GetEnglish();
+            world->jsonData["warpBoleroText"] = GetWarpBoleroText().GetEnglish();
+            world->jsonData["warpSerenadeText"] = GetWarpSerenadeText().GetEnglish();
+            world->jsonData["warpRequiemText"] = GetWarpRequiemText().GetEnglish();
+            world->jsonData["warpNocturneText"] = GetWarpNocturneText().GetEnglish();
+            world->jsonData["warpPreludeText"] = GetWarpPreludeText().GetEnglish();
+            world->jsonData["childAltar"]["hintText"] = GetChildAltarText().GetEnglish();
+            world->jsonData["adultAltar"]["hintText"] = GetAdultAltarText().GetEnglish();
             break;
         case 2:
             unformattedGanonText = GetGanonText().GetFrench();
@@ -699,14 +852,14 @@ static void WriteHints(int language) {
             unformattedGregText = GetGregHintText().GetFrench();
             unformattedSheikText = GetSheikHintText().GetFrench();
             unformattedSariaText = GetSariaHintText().GetFrench();
-            jsonData["warpMinuetText"] = GetWarpMinuetText().GetFrench();
-            jsonData["warpBoleroText"] = GetWarpBoleroText().GetFrench();
-            jsonData["warpSerenadeText"] = GetWarpSerenadeText().GetFrench();
-            jsonData["warpRequiemText"] = GetWarpRequiemText().GetFrench();
-            jsonData["warpNocturneText"] = GetWarpNocturneText().GetFrench();
-            jsonData["warpPreludeText"] = GetWarpPreludeText().GetFrench();
-            jsonData["childAltar"]["hintText"] = GetChildAltarText().GetFrench();
-            jsonData["adultAltar"]["hintText"] = GetAdultAltarText().GetFrench();
+            world->jsonData["warpMinuetText"] = GetWarpMinuetText().GetFrench();
+            world->jsonData["warpBoleroText"] = GetWarpBoleroText().GetFrench();
+            world->jsonData["warpSerenadeText"] = GetWarpSerenadeText().GetFrench();
+            world->jsonData["warpRequiemText"] = GetWarpRequiemText().GetFrench();
+            world->jsonData["warpNocturneText"] = GetWarpNocturneText().GetFrench();
+            world->jsonData["warpPreludeText"] = GetWarpPreludeText().GetFrench();
+            world->jsonData["childAltar"]["hintText"] = GetChildAltarText().GetFrench();
+            world->jsonData["adultAltar"]["hintText"] = GetAdultAltarText().GetFrench();
             break;
     }
 
@@ -717,9 +870,9 @@ static void WriteHints(int language) {
     std::string erubyArea;
     std::string sapphireArea;
 
-    jsonData["childAltar"]["rewards"]["emeraldLoc"] = emeraldLoc->GetName();
-    jsonData["childAltar"]["rewards"]["rubyLoc"] = rubyLoc->GetName();
-    jsonData["childAltar"]["rewards"]["sapphireLoc"] = sapphireLoc->GetName();
+    world->jsonData["childAltar"]["rewards"]["emeraldLoc"] = emeraldLoc->GetName();
+    world->jsonData["childAltar"]["rewards"]["rubyLoc"] = rubyLoc->GetName();
+    world->jsonData["childAltar"]["rewards"]["sapphireLoc"] = sapphireLoc->GetName();
 
     ItemLocation* forestMedallionLoc = GetItemLocation(FOREST_MEDALLION);
     ItemLocation* fireMedallionLoc = GetItemLocation(FIRE_MEDALLION);
@@ -728,12 +881,12 @@ static void WriteHints(int language) {
     ItemLocation* spiritMedallionLoc = GetItemLocation(SPIRIT_MEDALLION);
     ItemLocation* lightMedallionLoc = GetItemLocation(LIGHT_MEDALLION);
 
-    jsonData["adultAltar"]["rewards"]["forestMedallionLoc"] = forestMedallionLoc->GetName();
-    jsonData["adultAltar"]["rewards"]["fireMedallionLoc"] = fireMedallionLoc->GetName();
-    jsonData["adultAltar"]["rewards"]["waterMedallionLoc"] = waterMedallionLoc->GetName();
-    jsonData["adultAltar"]["rewards"]["shadowMedallionLoc"] = shadowMedallionLoc->GetName();
-    jsonData["adultAltar"]["rewards"]["spiritMedallionLoc"] = spiritMedallionLoc->GetName();
-    jsonData["adultAltar"]["rewards"]["lightMedallionLoc"] = lightMedallionLoc->GetName();
+    world->jsonData["adultAltar"]["rewards"]["forestMedallionLoc"] = forestMedallionLoc->GetName();
+    world->jsonData["adultAltar"]["rewards"]["fireMedallionLoc"] = fireMedallionLoc->GetName();
+    world->jsonData["adultAltar"]["rewards"]["waterMedallionLoc"] = waterMedallionLoc->GetName();
+    world->jsonData["adultAltar"]["rewards"]["shadowMedallionLoc"] = shadowMedallionLoc->GetName();
+    world->jsonData["adultAltar"]["rewards"]["spiritMedallionLoc"] = spiritMedallionLoc->GetName();
+    world->jsonData["adultAltar"]["rewards"]["lightMedallionLoc"] = lightMedallionLoc->GetName();
 
     std::string ganonText = AutoFormatHintTextString(unformattedGanonText);
     std::string ganonHintText = AutoFormatHintTextString(unformattedGanonHintText);
@@ -742,19 +895,19 @@ static void WriteHints(int language) {
     std::string sheikText = AutoFormatHintTextString(unformattedSheikText);
     std::string sariaText = AutoFormatHintTextString(unformattedSariaText);
 
-    jsonData["ganonText"] = ganonText;
-    jsonData["ganonHintText"] = ganonHintText;
-    jsonData["lightArrowHintLoc"] = GetLightArrowHintLoc();
-    jsonData["masterSwordHintLoc"] = GetMasterSwordHintLoc();
-    jsonData["dampeText"] = dampesText;
-    jsonData["dampeHintLoc"] = GetDampeHintLoc();
-    jsonData["gregText"] = gregText;
-    jsonData["gregLoc"] = GetItemLocation(GREG_RUPEE)->GetName();
-    jsonData["sheikText"] = sheikText;
-    jsonData["sariaText"] = sariaText;
-    jsonData["sariaHintLoc"] = GetSariaHintLoc();
-
-    if (Settings::GossipStoneHints.Is(HINTS_NO_HINTS)) {
+    world->jsonData["ganonText"] = ganonText;
+    world->jsonData["ganonHintText"] = ganonHintText;
+    world->jsonData["lightArrowHintLoc"] = GetLightArrowHintLoc();
+    world->jsonData["masterSwordHintLoc"] = GetMasterSwordHintLoc();
+    world->jsonData["dampeText"] = dampesText;
+    world->jsonData["dampeHintLoc"] = GetDampeHintLoc();
+    world->jsonData["gregText"] = gregText;
+    world->jsonData["gregLoc"] = GetItemLocation(GREG_RUPEE)->GetName();
+    world->jsonData["sheikText"] = sheikText;
+    world->jsonData["sariaText"] = sariaText;
+    world->jsonData["sariaHintLoc"] = GetSariaHintLoc();
+
+    if (settings->GossipStoneHints.Is(HINTS_NO_HINTS)) {
         return;
     }
 
@@ -775,22 +928,22 @@ static void WriteHints(int language) {
         HintType hintType = location->GetHintType();
 
         std::string textStr = AutoFormatHintTextString(unformattedHintTextString);
-        jsonData["hints"][location->GetName()]["hint"] = textStr;
-        jsonData["hints"][location->GetName()]["type"] = hintTypeNames.find(hintType)->second;
+        world->jsonData["hints"][location->GetName()]["hint"] = textStr;
+        world->jsonData["hints"][location->GetName()]["type"] = hintTypeNames.find(hintType)->second;
         if (hintType == HINT_TYPE_ITEM || hintType == HINT_TYPE_NAMED_ITEM || hintType == HINT_TYPE_WOTH) {
-            jsonData["hints"][location->GetName()]["item"] = hintedLocation->GetPlacedItemName().GetEnglish();
+            world->jsonData["hints"][location->GetName()]["item"] = hintedLocation->GetPlacedItemName().GetEnglish();
             if (hintType != HINT_TYPE_NAMED_ITEM || hintType == HINT_TYPE_WOTH) {
-                jsonData["hints"][location->GetName()]["location"] = hintedLocation->GetName();
+                world->jsonData["hints"][location->GetName()]["location"] = hintedLocation->GetName();
             }
         }
         if (hintType != HINT_TYPE_TRIAL && hintType != HINT_TYPE_JUNK) {
-            jsonData["hints"][location->GetName()]["area"] = location->GetHintedRegion();
+            world->jsonData["hints"][location->GetName()]["area"] = location->GetHintedRegion();
         }
     }
 }
 
 static void WriteAllLocations(int language) {
-    for (const uint32_t key : allLocations) {
+    for (const uint32_t key : world->allLocations) {
         ItemLocation* location = Location(key);
         std::string placedItemName;
 
@@ -810,34 +963,34 @@ static void WriteAllLocations(int language) {
             !location->HasShopsanityPrice() &&
             location->GetPlacedItemKey() != ICE_TRAP) {
             
-            jsonData["locations"][location->GetName()] = placedItemName;
+            world->jsonData["locations"][location->GetName()] = placedItemName;
             continue;
         }
 
         // We're dealing with a complex item, build out the json object for it
-        jsonData["locations"][location->GetName()]["item"] = placedItemName;
+        world->jsonData["locations"][location->GetName()]["item"] = placedItemName;
 
         if (location->HasScrubsanityPrice() || location->HasShopsanityPrice()) {
-          jsonData["locations"][location->GetName()]["price"] = location->GetPrice();
+          world->jsonData["locations"][location->GetName()]["price"] = location->GetPrice();
         }
         if (location->IsHintedAt()) {
-          hintedLocations.emplace(location->GetHintKey(), location);
+          world->hintedLocations.emplace(location->GetHintKey(), location);
         }
 
         if (location->GetPlacedItemKey() == ICE_TRAP) {
           switch (language) {
               case 0:
               default:
-                  jsonData["locations"][location->GetName()]["model"] =
-                      ItemFromGIID(iceTrapModels[location->GetRandomizerCheck()]).GetName().english;
-                  jsonData["locations"][location->GetName()]["trickName"] = 
-                      GetIceTrapName(iceTrapModels[location->GetRandomizerCheck()]).english;
+                  world->jsonData["locations"][location->GetName()]["model"] =
+                      ItemFromGIID(world->iceTrapModels[location->GetRandomizerCheck()]).GetName().english;
+                  world->jsonData["locations"][location->GetName()]["trickName"] = 
+                      GetIceTrapName(world->iceTrapModels[location->GetRandomizerCheck()]).english;
                   break;
               case 2:
-                  jsonData["locations"][location->GetName()]["model"] =
-                      ItemFromGIID(iceTrapModels[location->GetRandomizerCheck()]).GetName().french;
-                  jsonData["locations"][location->GetName()]["trickName"] =
-                      GetIceTrapName(iceTrapModels[location->GetRandomizerCheck()]).french;
+                  world->jsonData["locations"][location->GetName()]["model"] =
+                      ItemFromGIID(world->iceTrapModels[location->GetRandomizerCheck()]).GetName().french;
+                  world->jsonData["locations"][location->GetName()]["trickName"] =
+                      GetIceTrapName(world->iceTrapModels[location->GetRandomizerCheck()]).french;
                   break;
           }
       }
@@ -861,18 +1014,18 @@ const char* SpoilerLog_Write(int language) {
     auto rootNode = spoilerLog.NewElement("spoiler-log");
     spoilerLog.InsertEndChild(rootNode);
 
-    jsonData.clear();
+    world->jsonData.clear();
 
-    jsonData["version"] = (char*) gBuildVersion;
-    jsonData["git_branch"] = (char*) gGitBranch;
-    jsonData["git_commit"] = (char*) gGitCommitHash;
-    jsonData["seed"] = Settings::seedString;
-    jsonData["finalSeed"] = Settings::seed;
+    world->jsonData["version"] = (char*) gBuildVersion;
+    world->jsonData["git_branch"] = (char*) gGitBranch;
+    world->jsonData["git_commit"] = (char*) gGitCommitHash;
+    world->jsonData["seed"] = settings->seedString;
+    world->jsonData["finalSeed"] = settings->seed;
 
     // Write Hash
     int index = 0;
-    for (uint8_t seed_value : Settings::hashIconIndexes) {
-        jsonData["file_hash"][index] = seed_value;
+    for (uint8_t seed_value : settings->hashIconIndexes) {
+        world->jsonData["file_hash"][index] = seed_value;
         index++;
     }
 
@@ -884,49 +1037,66 @@ const char* SpoilerLog_Write(int language) {
     //    WriteEnabledGlitches(spoilerLog);
     //}
     WriteMasterQuestDungeons(spoilerLog);
-    WriteRequiredTrials();
-    WritePlaythrough();
+    WriteRequiredTrials(language);
+    WritePlaythrough(language);
     //WriteWayOfTheHeroLocation(spoilerLog);
 
-    playthroughLocations.clear();
-    playthroughBeatable = false;
-    wothLocations.clear();
+    world->playthroughLocations.clear();
+    logic->playthroughBeatable = false;
+    world->wothLocations.clear();
 
     WriteHints(language);
-    WriteShuffledEntrances();
+    WriteShuffledEntrances(language);
     WriteAllLocations(language);
     //WriteHintData(language);
 
-    if (!std::filesystem::exists(Ship::Context::GetPathRelativeToAppDirectory("Randomizer"))) {
-        std::filesystem::create_directory(Ship::Context::GetPathRelativeToAppDirectory("Randomizer"));
+    if (!std::filesystem::exists(GetSpoilerFilePath("Randomizer"))) {
+        std::filesystem::create_directory(GetSpoilerFilePath("Randomizer"));
     }
 
-    std::string jsonString = jsonData.dump(4);
     std::ostringstream fileNameStream;
-    for (int i = 0; i < Settings::hashIconIndexes.size(); i ++) {
+    for (int i = 0; i < settings->hashIconIndexes.size(); i ++) {
         if (i) {
             fileNameStream << '-';
         }
-        if (Settings::hashIconIndexes[i] < 10) {
+        if (settings->hashIconIndexes[i] < 10) {
             fileNameStream << '0';
         }
-        fileNameStream << std::to_string(Settings::hashIconIndexes[i]);
+        fileNameStream << std::to_string(settings->hashIconIndexes[i]);
     }
     std::string fileName = fileNameStream.str();
-    std::ofstream jsonFile(Ship::Context::GetPathRelativeToAppDirectory(
-        (std::string("Randomizer/") + fileName + std::string(".json")).c_str()));
-    jsonFile << std::setw(4) << jsonString << std::endl;
-    jsonFile.close();
+
+    if (sWriteSpoilerFiles) {
+        std::string jsonString = world->jsonData.dump(4);
+        std::ofstream jsonFile(GetSpoilerFilePath("Randomizer/" + fileName + ".json"));
+        jsonFile << std::setw(4) << jsonString << std::endl;
+        jsonFile.close();
+
+#ifndef RANDOMIZER_HEADLESS
+        // Written after the spoiler log so it's never older than it
+        SeedFile_WriteFromSpoilerLog(jsonString, GetSpoilerFilePath("Randomizer/" + fileName + SEED_FILE_EXTENSION));
+#endif
+    }
+
+    // Generation profile goes next to the spoiler log under the same name
+    if (FillProfiler::IsEnabled()) {
+        std::ofstream profileFile(GetSpoilerFilePath("Randomizer/" + fileName + ".profile.json"));
+        profileFile << FillProfiler::Dump() << std::endl;
+    }
 
     return fileName.c_str();
 }
 
+void SpoilerLog_SetWriteFiles(bool writeFiles) {
+    sWriteSpoilerFiles = writeFiles;
+}
+
 void PlacementLog_Msg(std::string_view msg) {
-    placementtxt += msg;
+    world->placementtxt += msg;
 }
 
 void PlacementLog_Clear() {
-    placementtxt = "";
+    world->placementtxt = "";
 }
 
 bool PlacementLog_Write() {
@@ -937,7 +1107,7 @@ bool PlacementLog_Write() {
     placementLog.InsertEndChild(rootNode);
 
     rootNode->SetAttribute("version", Settings::version.c_str());
-    rootNode->SetAttribute("seed", Settings::seed);
+    rootNode->SetAttribute("seed", settings->seed);
 
     // WriteSettings(placementLog, true); // Include hidden settings.
     // WriteExcludedLocations(placementLog);
@@ -947,10 +1117,10 @@ bool PlacementLog_Write() {
     WriteMasterQuestDungeons(placementLog);
     //WriteRequiredTrials(placementLog);
 
-    placementtxt = "\n" + placementtxt;
+    world->placementtxt = "\n" + world->placementtxt;
 
     auto node = rootNode->InsertNewChildElement("log");
-    auto contentNode = node->InsertNewText(placementtxt.c_str());
+    auto contentNode = node->InsertNewText(world->placementtxt.c_str());
     contentNode->SetCData(true);
 
     return true;
@@ -4,6 +4,9 @@
 #include <string>
 #include <string_view>
 #include <cstdint>
+#include <unordered_map>
+
+#include "../randomizerTypes.h"
 
 using RandomizerHash = std::array<std::string, 5>;
 
@@ -112,4 +115,10 @@ const RandomizerHash& GetRandomizerHash();
 void WriteIngameSpoilerLog();
 
 const char* SpoilerLog_Write(int language);
-const SpoilerData& GetSpoilerData();
\ No newline at end of file
+// Whether SpoilerLog_Write saves the spoiler log and seed file, on by default. The headless generator turns it off
+// instead of changing GenerateSpoilerLog, which is part of the settings the seed is hashed from.
+void SpoilerLog_SetWriteFiles(bool writeFiles);
+const SpoilerData& GetSpoilerData();
+
+// The settings by the names the spoiler log gives them, "<menu>:<setting>"
+extern std::unordered_map<std::string, RandomizerSettingKey> SpoilerfileSettingNameToEnum;
\ No newline at end of file
@@ -5,9 +5,6 @@
 #include <vector>
 #include <stdint.h>
 
-extern std::vector<uint32_t> StartingInventory;
-extern uint8_t AdditionalHeartContainers;
-
 void GenerateStartingInventory();
 bool StartingInventoryHasBottle();
 void ApplyStartingInventory();
@@ -38,14 +38,21 @@ private:
       bool skipped = true;
 };
 
-extern TrialInfo ForestTrial;
-extern TrialInfo FireTrial;
-extern TrialInfo WaterTrial;
-extern TrialInfo SpiritTrial;
-extern TrialInfo ShadowTrial;
-extern TrialInfo LightTrial;
-
 using TrialArray = std::array<TrialInfo*, 6>;
 
-extern const TrialArray trialList;
+//The trials of a world. trialList points into it, so it can't be copied.
+struct Trials {
+    Trials();
+    Trials(const Trials&) = delete;
+    Trials& operator=(const Trials&) = delete;
+
+    TrialInfo ForestTrial;
+    TrialInfo FireTrial;
+    TrialInfo WaterTrial;
+    TrialInfo SpiritTrial;
+    TrialInfo ShadowTrial;
+    TrialInfo LightTrial;
+
+    const TrialArray trialList;
+};
 } //namespace Trial
@@ -1,6 +1,15 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdio>
 #include <string>
 
 std::string RemoveLineBreaks(std::string s);
+
+// Generation progress, drawn with the cursor escapes of the 3DS console the generator was written for. Left out of the
+// headless generator, whose workers all generate at once.
+#ifndef RANDOMIZER_HEADLESS
+#define PrintProgress(...) printf(__VA_ARGS__)
+#else
+#define PrintProgress(...) ((void)0)
+#endif
@@ -0,0 +1,39 @@
+#include "world.hpp"
+
+static World mainWorld;
+
+thread_local constinit World* world = &mainWorld;
+
+WorldScope::WorldScope()
+  : ownLogic(std::make_unique<Logic::Vars>()),
+    ownSettings(std::make_unique<Settings::Vars>()),
+    ownWorld(std::make_unique<World>()),
+    previousLogic(logic),
+    previousSettings(settings),
+    previousWorld(world) {
+  logic = ownLogic.get();
+  settings = ownSettings.get();
+  world = ownWorld.get();
+}
+
+WorldScope::WorldScope(World& installWorld)
+  : previousLogic(logic),
+    previousSettings(settings),
+    previousWorld(world) {
+  world = &installWorld;
+}
+
+WorldScope::WorldScope(Logic::Vars& installLogic, Settings::Vars& installSettings, World& installWorld)
+  : previousLogic(logic),
+    previousSettings(settings),
+    previousWorld(world) {
+  logic = &installLogic;
+  settings = &installSettings;
+  world = &installWorld;
+}
+
+WorldScope::~WorldScope() {
+  logic = previousLogic;
+  settings = previousSettings;
+  world = previousWorld;
+}
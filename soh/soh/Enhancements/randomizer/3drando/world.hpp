@@ -0,0 +1,143 @@
+#pragma once
+
+#include "custom_messages.hpp"
+#include "dungeon.hpp"
+#include "entrance.hpp"
+#include "hints.hpp"
+#include "item.hpp"
+#include "item_location.hpp"
+#include "keys.hpp"
+#include "location_access.hpp"
+#include "logic.hpp"
+#include "settings.hpp"
+#include "shops.hpp"
+#include "spoiler_log.hpp"
+#include "text.hpp"
+#include "trial.hpp"
+
+#include <array>
+#include <list>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <boost/random/mersenne_twister.hpp>
+#include <nlohmann/json.hpp>
+
+//Everything a generation builds and changes besides its logic and settings: the item, location and area tables,
+//the dungeons and trials, the item pool and placements, the entrances, hints and spoiler log, and the random
+//number generator. Each generation has its own, installed in the world pointer below. Data that never changes
+//after it's first built, like the hint table or the shop location lists, is shared by all of them.
+struct World {
+    World() = default;
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    //item_list.cpp, item_location.cpp, location_access.cpp
+    std::array<Item, KEY_ENUM_MAX> itemTable;
+    std::array<ItemLocation, KEY_ENUM_MAX> locationTable;
+    std::array<Area, KEY_ENUM_MAX> areaTable;
+
+    Dungeon::Dungeons dungeons;
+    Trial::Trials trials;
+
+    //item_location.cpp
+    std::vector<uint32_t> allLocations;
+    std::vector<uint32_t> everyPossibleLocation;
+    //set of overrides to write to the patch
+    std::set<ItemOverride, ItemOverride_Compare> overrides;
+    std::unordered_map<RandomizerCheck, uint8_t> iceTrapModels;
+    std::vector<std::vector<uint32_t>> playthroughLocations;
+    std::vector<uint32_t> wothLocations;
+    bool allLocationsReachable = false;
+    bool showItemProgress = false;
+    uint16_t itemsPlaced = 0;
+
+    //item_pool.cpp
+    std::vector<uint32_t> ItemPool;
+    std::vector<uint32_t> PendingJunkPool;
+    std::vector<uint8_t> IceTrapModels;
+
+    //starting_inventory.cpp
+    std::vector<uint32_t> StartingInventory;
+    uint8_t AdditionalHeartContainers = 0;
+
+    //shops.cpp
+    std::vector<ItemAndPrice> NonShopItems;
+
+    //fill.cpp
+    bool placementFailure = false;
+
+    //entrance.cpp
+    std::list<EntranceOverride> entranceOverrides;
+    std::vector<std::list<Entrance*>> playthroughEntrances;
+    bool noRandomEntrances = false;
+    bool entranceShuffleFailure = false;
+    int totalRandomizableEntrances = 0;
+    int curNumRandomizedEntrances = 0;
+
+    //hints.cpp
+    //10 dungeons as GTG and GC are excluded
+    std::array<DungeonInfo, 10> dungeonInfoData = {};
+    Text childAltarText;
+    Text adultAltarText;
+    Text ganonText;
+    Text ganonHintText;
+    Text sheikText;
+    Text sariaText;
+    Text dampesText;
+    Text gregText;
+    Text warpMinuetText;
+    Text warpBoleroText;
+    Text warpSerenadeText;
+    Text warpRequiemText;
+    Text warpNocturneText;
+    Text warpPreludeText;
+    std::string lightArrowHintLoc;
+    std::string masterSwordHintLoc;
+    std::string sariaHintLoc;
+    std::string dampeHintLoc;
+
+    //custom_messages.cpp
+    std::set<CustomMessages::MessageEntry, CustomMessages::MessageEntryComp> messageEntries;
+    std::stringstream messageData;
+
+    //spoiler_log.cpp
+    nlohmann::ordered_json jsonData;
+    std::map<HintKey, ItemLocation*> hintedLocations;
+    std::string placementtxt;
+    SpoilerData spoilerData = {};
+
+    //random.cpp
+    bool randomInit = false;
+    boost::random::mt19937 generator;
+};
+
+extern thread_local constinit World* world;
+
+//Installs a new logic, settings and world on this thread for as long as it exists, and then puts back the ones
+//that were installed before. Threads start out with the ones the game uses, so a thread only needs this to
+//generate alongside another one. Given existing ones, it installs those instead without owning them, for a thread
+//to search another thread's world with a logic of its own. Given only a world, it keeps the thread's logic and
+//settings, which is how Fill and GetAccessibleLocations make sure everything they call sees the world they were
+//passed.
+class WorldScope {
+  public:
+    WorldScope();
+    explicit WorldScope(World& installWorld);
+    WorldScope(Logic::Vars& installLogic, Settings::Vars& installSettings, World& installWorld);
+    ~WorldScope();
+    WorldScope(const WorldScope&) = delete;
+    WorldScope& operator=(const WorldScope&) = delete;
+
+  private:
+    std::unique_ptr<Logic::Vars> ownLogic;
+    std::unique_ptr<Settings::Vars> ownSettings;
+    std::unique_ptr<World> ownWorld;
+    Logic::Vars* previousLogic;
+    Settings::Vars* previousSettings;
+    World* previousWorld;
+};
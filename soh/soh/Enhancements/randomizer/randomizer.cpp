@@ -1,6 +1,7 @@
 #include "randomizer.h"
 #include <nlohmann/json.hpp>
 #include "3drando/settings.hpp"
+#include "3drando/spoiler_log.hpp"
 #include <fstream>
 #include <variables.h>
 #include <macros.h>
@@ -35,6 +36,11 @@
 #include "randomizer_settings_window.h"
 #include "savefile.h"
 #include "soh/util.h"
+#include "randomizer_seed_file.h"
+#include <filesystem>
+#include <mutex>
+#include <algorithm>
+#include <cstring>
 
 extern "C" uint32_t ResourceMgr_IsGameMasterQuest();
 extern "C" uint32_t ResourceMgr_IsSceneMasterQuest(s16 sceneNum);
@@ -49,6 +55,8 @@ std::unordered_map<std::string, RandomizerCheck> SpoilerfileCheckNameToEnum;
 std::unordered_map<std::string, RandomizerGet> SpoilerfileGetNameToEnum;
 std::unordered_map<std::string, RandomizerCheckArea> SpoilerfileAreaNameToEnum;
 std::unordered_map<std::string, HintType> SpoilerfileHintTypeNameToEnum;
+static uint64_t sSeedFileTableHash;
+static void HashSeedFileTables();
 std::multimap<std::tuple<s16, s16, s32>, RandomizerCheckObject> checkFromActorMultimap;
 std::set<RandomizerCheck> excludedLocations;
 std::set<RandomizerTrick> enabledTricks;
@@ -142,6 +150,8 @@ Randomizer::Randomizer() {
             item.GetName().french,
         };
     }
+
+    HashSeedFileTables();
 }
 
 Sprite* Randomizer::GetSeedTexture(uint8_t index) {
@@ -226,146 +236,6 @@ std::unordered_map<s16, s16> getItemIdToItemId = {
     { GI_CLAIM_CHECK, ITEM_CLAIM_CHECK } 
 };
 
-std::unordered_map<std::string, RandomizerSettingKey> SpoilerfileSettingNameToEnum = {
-    { "Logic Options:Logic", RSK_LOGIC_RULES },
-    { "Logic Options:Night GSs Expect Sun's", RSK_SKULLS_SUNS_SONG },
-    { "Logic Options:All Locations Reachable", RSK_ALL_LOCATIONS_REACHABLE },
-    { "Item Pool Settings:Item Pool", RSK_ITEM_POOL },
-    { "Item Pool Settings:Ice Traps", RSK_ICE_TRAPS },
-    { "Open Settings:Forest", RSK_FOREST },
-    { "Open Settings:Kakariko Gate", RSK_KAK_GATE },
-    { "Open Settings:Door of Time", RSK_DOOR_OF_TIME },
-    { "Open Settings:Zora's Fountain", RSK_ZORAS_FOUNTAIN },
-    { "Open Settings:Gerudo Fortress", RSK_GERUDO_FORTRESS },
-    { "Open Settings:Rainbow Bridge", RSK_RAINBOW_BRIDGE },
-    { "Open Settings:Trial Count", RSK_TRIAL_COUNT },
-    { "Open Settings:Stone Count", RSK_RAINBOW_BRIDGE_STONE_COUNT },
-    { "Open Settings:Medallion Count", RSK_RAINBOW_BRIDGE_MEDALLION_COUNT },
-    { "Open Settings:Reward Count", RSK_RAINBOW_BRIDGE_REWARD_COUNT },
-    { "Open Settings:Dungeon Count", RSK_RAINBOW_BRIDGE_DUNGEON_COUNT },
-    { "Open Settings:Token Count", RSK_RAINBOW_BRIDGE_TOKEN_COUNT },
-    { "Open Settings:Bridge Reward Options", RSK_BRIDGE_OPTIONS },
-    { "Shuffle Settings:Shuffle Dungeon Rewards", RSK_SHUFFLE_DUNGEON_REWARDS },
-    { "Shuffle Settings:Link's Pocket", RSK_LINKS_POCKET},
-    { "Shuffle Settings:Shuffle Songs", RSK_SHUFFLE_SONGS },
-    { "Shuffle Settings:Shuffle Gerudo Card", RSK_SHUFFLE_GERUDO_MEMBERSHIP_CARD },
-    { "Shuffle Settings:Shopsanity", RSK_SHOPSANITY },
-    { "Shuffle Settings:Shopsanity Prices", RSK_SHOPSANITY_PRICES },
-    { "Shuffle Settings:Affordable Prices", RSK_SHOPSANITY_PRICES_AFFORDABLE },
-    { "Shuffle Settings:Scrub Shuffle", RSK_SHUFFLE_SCRUBS },
-    { "Shuffle Settings:Shuffle Cows", RSK_SHUFFLE_COWS },
-    { "Shuffle Settings:Tokensanity", RSK_SHUFFLE_TOKENS },
-    { "Shuffle Settings:Shuffle Ocarinas", RSK_SHUFFLE_OCARINA },
-    { "Shuffle Settings:Shuffle Adult Trade", RSK_SHUFFLE_ADULT_TRADE },
-    { "Shuffle Settings:Shuffle Magic Beans", RSK_SHUFFLE_MAGIC_BEANS },
-    { "Shuffle Settings:Shuffle Kokiri Sword", RSK_SHUFFLE_KOKIRI_SWORD },
-    { "Shuffle Settings:Shuffle Master Sword", RSK_SHUFFLE_MASTER_SWORD },
-    { "Shuffle Settings:Shuffle Weird Egg", RSK_SHUFFLE_WEIRD_EGG },
-    { "Shuffle Settings:Shuffle Frog Song Rupees", RSK_SHUFFLE_FROG_SONG_RUPEES },
-    { "Shuffle Settings:Shuffle Merchants", RSK_SHUFFLE_MERCHANTS },
-    { "Shuffle Settings:Shuffle 100 GS Reward", RSK_SHUFFLE_100_GS_REWARD },
-    { "Start with Deku Shield", RSK_STARTING_DEKU_SHIELD },
-    { "Start with Kokiri Sword", RSK_STARTING_KOKIRI_SWORD },
-    { "Start with Fairy Ocarina", RSK_STARTING_OCARINA },
-    { "Start with Zelda's Lullaby", RSK_STARTING_ZELDAS_LULLABY },
-    { "Start with Epona's Song", RSK_STARTING_EPONAS_SONG },
-    { "Start with Saria's Song", RSK_STARTING_SARIAS_SONG },
-    { "Start with Sun's Song", RSK_STARTING_SUNS_SONG },
-    { "Start with Song of Time", RSK_STARTING_SONG_OF_TIME },
-    { "Start with Song of Storms", RSK_STARTING_SONG_OF_STORMS },
-    { "Start with Minuet of Forest", RSK_STARTING_MINUET_OF_FOREST },
-    { "Start with Bolero of Fire", RSK_STARTING_BOLERO_OF_FIRE },
-    { "Start with Serenade of Water", RSK_STARTING_SERENADE_OF_WATER },
-    { "Start with Requiem of Spirit", RSK_STARTING_REQUIEM_OF_SPIRIT },
-    { "Start with Nocturne of Shadow", RSK_STARTING_NOCTURNE_OF_SHADOW },
-    { "Start with Prelude of Light", RSK_STARTING_PRELUDE_OF_LIGHT },
-    { "Shuffle Dungeon Items:Maps/Compasses", RSK_STARTING_MAPS_COMPASSES },
-    { "Shuffle Dungeon Items:Small Keys", RSK_KEYSANITY },
-    { "Shuffle Dungeon Items:Gerudo Fortress Keys", RSK_GERUDO_KEYS },
-    { "Shuffle Dungeon Items:Boss Keys", RSK_BOSS_KEYSANITY },
-    { "Shuffle Dungeon Items:Ganon's Boss Key", RSK_GANONS_BOSS_KEY },
-    { "Shuffle Dungeon Items:Stone Count", RSK_LACS_STONE_COUNT },
-    { "Shuffle Dungeon Items:Medallion Count", RSK_LACS_MEDALLION_COUNT },
-    { "Shuffle Dungeon Items:Reward Count", RSK_LACS_REWARD_COUNT },
-    { "Shuffle Dungeon Items:Dungeon Count", RSK_LACS_DUNGEON_COUNT },
-    { "Shuffle Dungeon Items:Token Count", RSK_LACS_TOKEN_COUNT },
-    { "Shuffle Dungeon Items:LACS Reward Options", RSK_LACS_OPTIONS },
-    { "Shuffle Dungeon Items:Key Rings", RSK_KEYRINGS },
-    { "Shuffle Dungeon Items:Keyring Dungeon Count", RSK_KEYRINGS_RANDOM_COUNT },
-    { "Shuffle Dungeon Items:Gerudo Fortress", RSK_KEYRINGS_GERUDO_FORTRESS },
-    { "Shuffle Dungeon Items:Forest Temple", RSK_KEYRINGS_FOREST_TEMPLE },
-    { "Shuffle Dungeon Items:Fire Temple", RSK_KEYRINGS_FIRE_TEMPLE },
-    { "Shuffle Dungeon Items:Water Temple", RSK_KEYRINGS_WATER_TEMPLE },
-    { "Shuffle Dungeon Items:Spirit Temple", RSK_KEYRINGS_SPIRIT_TEMPLE },
-    { "Shuffle Dungeon Items:Shadow Temple", RSK_KEYRINGS_SHADOW_TEMPLE },
-    { "Shuffle Dungeon Items:Bottom of the Well", RSK_KEYRINGS_BOTTOM_OF_THE_WELL },
-    { "Shuffle Dungeon Items:GTG", RSK_KEYRINGS_GTG },
-    { "Shuffle Dungeon Items:Ganon's Castle", RSK_KEYRINGS_GANONS_CASTLE },
-    { "World Settings:Starting Age", RSK_STARTING_AGE },
-    { "World Settings:Ammo Drops", RSK_ENABLE_BOMBCHU_DROPS },
-    { "World Settings:Bombchus in Logic", RSK_BOMBCHUS_IN_LOGIC },
-    { "World Settings:Shuffle Entrances", RSK_SHUFFLE_ENTRANCES },
-    { "World Settings:Dungeon Entrances", RSK_SHUFFLE_DUNGEON_ENTRANCES },
-    { "World Settings:Boss Entrances", RSK_SHUFFLE_BOSS_ENTRANCES },
-    { "World Settings:Overworld Entrances", RSK_SHUFFLE_OVERWORLD_ENTRANCES },
-    { "World Settings:Interior Entrances", RSK_SHUFFLE_INTERIOR_ENTRANCES },
-    { "World Settings:Grottos Entrances", RSK_SHUFFLE_GROTTO_ENTRANCES },
-    { "World Settings:Owl Drops", RSK_SHUFFLE_OWL_DROPS },
-    { "World Settings:Warp Songs", RSK_SHUFFLE_WARP_SONGS },
-    { "World Settings:Overworld Spawns", RSK_SHUFFLE_OVERWORLD_SPAWNS },
-    { "World Settings:Mixed Entrance Pools", RSK_MIXED_ENTRANCE_POOLS },
-    { "World Settings:Mix Dungeons", RSK_MIX_DUNGEON_ENTRANCES },
-    { "World Settings:Mix Bosses", RSK_MIX_BOSS_ENTRANCES },
-    { "World Settings:Mix Overworld", RSK_MIX_OVERWORLD_ENTRANCES },
-    { "World Settings:Mix Interiors", RSK_MIX_INTERIOR_ENTRANCES },
-    { "World Settings:Mix Grottos", RSK_MIX_GROTTO_ENTRANCES },
-    { "World Settings:Decouple Entrances", RSK_DECOUPLED_ENTRANCES },
-    { "World Settings:Triforce Hunt", RSK_TRIFORCE_HUNT },
-    { "World Settings:Triforce Hunt Total Pieces", RSK_TRIFORCE_HUNT_PIECES_TOTAL },
-    { "World Settings:Triforce Hunt Required Pieces", RSK_TRIFORCE_HUNT_PIECES_REQUIRED },
-    { "Misc Settings:Gossip Stone Hints", RSK_GOSSIP_STONE_HINTS },
-    { "Misc Settings:Hint Clarity", RSK_HINT_CLARITY },
-    { "Misc Settings:ToT Altar Hint", RSK_TOT_ALTAR_HINT },
-    { "Misc Settings:Light Arrow Hint", RSK_LIGHT_ARROWS_HINT },
-    { "Misc Settings:Dampe's Diary Hint", RSK_DAMPES_DIARY_HINT },
-    { "Misc Settings:Greg the Rupee Hint", RSK_GREG_HINT },
-    { "Misc Settings:Saria's Hint", RSK_SARIA_HINT },
-    { "Misc Settings:Frog Ocarina Game Hint", RSK_FROGS_HINT },
-    { "Misc Settings:10 GS Hint", RSK_KAK_10_SKULLS_HINT },
-    { "Misc Settings:20 GS Hint", RSK_KAK_20_SKULLS_HINT },
-    { "Misc Settings:30 GS Hint", RSK_KAK_30_SKULLS_HINT },
-    { "Misc Settings:40 GS Hint", RSK_KAK_40_SKULLS_HINT },
-    { "Misc Settings:50 GS Hint", RSK_KAK_50_SKULLS_HINT },
-    { "Misc Settings:Warp Song Hints", RSK_WARP_SONG_HINTS },
-    { "Misc Settings:Scrub Hint Text", RSK_SCRUB_TEXT_HINT },
-    { "Misc Settings:Hint Distribution", RSK_HINT_DISTRIBUTION },
-    { "Misc Settings:Blue Fire Arrows", RSK_BLUE_FIRE_ARROWS },
-    { "Misc Settings:Sunlight Arrows", RSK_SUNLIGHT_ARROWS },
-    { "Skip Child Zelda", RSK_SKIP_CHILD_ZELDA },
-    { "Start with Consumables", RSK_STARTING_CONSUMABLES },
-    { "Start with Max Rupees", RSK_FULL_WALLETS },
-    { "Gold Skulltula Tokens", RSK_STARTING_SKULLTULA_TOKEN },
-    { "Timesaver Settings:Cuccos to return", RSK_CUCCO_COUNT },
-    { "Timesaver Settings:Big Poe Target Count", RSK_BIG_POE_COUNT },
-    { "Timesaver Settings:Skip Child Stealth", RSK_SKIP_CHILD_STEALTH },
-    { "Timesaver Settings:Skip Epona Race", RSK_SKIP_EPONA_RACE },
-    { "Timesaver Settings:Skip Tower Escape", RSK_SKIP_TOWER_ESCAPE },
-    { "Timesaver Settings:Complete Mask Quest", RSK_COMPLETE_MASK_QUEST },
-    { "Timesaver Settings:Skip Scarecrow's Song", RSK_SKIP_SCARECROWS_SONG },
-    { "Timesaver Settings:Enable Glitch-Useful Cutscenes", RSK_ENABLE_GLITCH_CUTSCENES },
-    { "World Settings:MQ Dungeons", RSK_RANDOM_MQ_DUNGEONS },
-    { "World Settings:MQ Dungeon Count", RSK_MQ_DUNGEON_COUNT },
-    { "Shuffle Dungeon Quest:Forest Temple", RSK_MQ_FOREST_TEMPLE },
-    { "Shuffle Dungeon Quest:Fire Temple", RSK_MQ_FIRE_TEMPLE },
-    { "Shuffle Dungeon Quest:Water Temple", RSK_MQ_WATER_TEMPLE },
-    { "Shuffle Dungeon Quest:Spirit Temple", RSK_MQ_SPIRIT_TEMPLE },
-    { "Shuffle Dungeon Quest:Shadow Temple", RSK_MQ_SHADOW_TEMPLE },
-    { "Shuffle Dungeon Quest:Bottom of the Well", RSK_MQ_BOTTOM_OF_THE_WELL },
-    { "Shuffle Dungeon Quest:Ice Cavern", RSK_MQ_ICE_CAVERN },
-    { "Shuffle Dungeon Quest:GTG", RSK_MQ_GTG },
-    { "Shuffle Dungeon Quest:Ganon's Castle", RSK_MQ_GANONS_CASTLE },
-};
-
 #pragma optimize("", off)
 #pragma GCC push_options
 #pragma GCC optimize ("O0")
@@ -659,22 +529,8 @@ void Randomizer::LoadMasterQuestDungeons(const char* spoilerFileName) {
     gSaveContext.mqDungeonCount = this->masterQuestDungeons.size();
 }
 
-void Randomizer::ParseRandomizerSettingsFile(const char* spoilerFileName) {
-    std::ifstream spoilerFileStream(SohUtils::Sanitize(spoilerFileName));
-    if (!spoilerFileStream)
-        return;
-
-    bool success = false;
-
+static void ParseSettingsJson(json& spoilerFileJson, SeedFileData& data) {
     try {
-        // clear out existing settings
-        for(size_t i = 0; i < RSK_MAX; i++) {
-            gSaveContext.randoSettings[i].key = RSK_NONE;
-            gSaveContext.randoSettings[i].value = 0;
-        }
-
-        json spoilerFileJson;
-        spoilerFileStream >> spoilerFileJson;
         json settingsJson = spoilerFileJson["settings"];
 
         for (auto it = settingsJson.begin(); it != settingsJson.end(); ++it) {
@@ -683,105 +539,105 @@ void Randomizer::ParseRandomizerSettingsFile(const char* spoilerFileName) {
             std::string numericValueString;
             if(SpoilerfileSettingNameToEnum.count(it.key())) {
                 RandomizerSettingKey index = SpoilerfileSettingNameToEnum[it.key()];
-                gSaveContext.randoSettings[index].key = SpoilerfileSettingNameToEnum[it.key()];
+                SeedFileSetting& setting = data.settings.emplace_back(SeedFileSetting{ index, 0 });
                 // this is annoying but the same strings are used in different orders
                 // and i don't want the spoilerfile to just have numbers instead of
                 // human readable settings values so it'll have to do for now
-                switch(gSaveContext.randoSettings[index].key) {
+                switch(setting.key) {
                     case RSK_LOGIC_RULES:
                         if (it.value() == "Glitchless") {
-                            gSaveContext.randoSettings[index].value = RO_LOGIC_GLITCHLESS;
+                            setting.value = RO_LOGIC_GLITCHLESS;
                         } else if (it.value() == "No Logic") {
-                            gSaveContext.randoSettings[index].value = RO_LOGIC_NO_LOGIC;
+                            setting.value = RO_LOGIC_NO_LOGIC;
                         } else if (it.value() == "Vanilla") {
-                            gSaveContext.randoSettings[index].value = RO_LOGIC_VANILLA;
+                            setting.value = RO_LOGIC_VANILLA;
                         }
                         break;
                     case RSK_FOREST:
                         if(it.value() == "Closed") {
-                            gSaveContext.randoSettings[index].value = RO_FOREST_CLOSED;
+                            setting.value = RO_FOREST_CLOSED;
                         } else if(it.value() == "Open") {
-                            gSaveContext.randoSettings[index].value = RO_FOREST_OPEN;
+                            setting.value = RO_FOREST_OPEN;
                         } else if(it.value() == "Closed Deku") {
-                            gSaveContext.randoSettings[index].value = RO_FOREST_CLOSED_DEKU;
+                            setting.value = RO_FOREST_CLOSED_DEKU;
                         }
                         break;
                     case RSK_KAK_GATE:
                         if(it.value() == "Closed") {
-                            gSaveContext.randoSettings[index].value = RO_KAK_GATE_CLOSED;
+                            setting.value = RO_KAK_GATE_CLOSED;
                         } else if(it.value() == "Open") {
-                            gSaveContext.randoSettings[index].value = RO_KAK_GATE_OPEN;
+                            setting.value = RO_KAK_GATE_OPEN;
                         }
                         break;
                     case RSK_DOOR_OF_TIME:
                         if(it.value() == "Open") {
-                            gSaveContext.randoSettings[index].value = RO_DOOROFTIME_OPEN;
+                            setting.value = RO_DOOROFTIME_OPEN;
                         } else if(it.value() == "Song only") {
-                            gSaveContext.randoSettings[index].value = RO_DOOROFTIME_SONGONLY;
+                            setting.value = RO_DOOROFTIME_SONGONLY;
                         } else if(it.value() == "Closed") {
-                            gSaveContext.randoSettings[index].value = RO_DOOROFTIME_CLOSED;
+                            setting.value = RO_DOOROFTIME_CLOSED;
                         }
                         break;
                     case RSK_ZORAS_FOUNTAIN:
                         if(it.value() == "Closed") {
-                            gSaveContext.randoSettings[index].value = RO_ZF_CLOSED;
+                            setting.value = RO_ZF_CLOSED;
                         } else if(it.value() == "Closed as child") {
-                            gSaveContext.randoSettings[index].value = RO_ZF_CLOSED_CHILD;
+                            setting.value = RO_ZF_CLOSED_CHILD;
                         } else if(it.value() == "Open") {
-                            gSaveContext.randoSettings[index].value = RO_ZF_OPEN;
+                            setting.value = RO_ZF_OPEN;
                         }
                         break;
                     case RSK_STARTING_AGE:
                         if(it.value() == "Child") {
-                            gSaveContext.randoSettings[index].value = RO_AGE_CHILD;
+                            setting.value = RO_AGE_CHILD;
                         } else if (it.value() == "Adult") {
-                            gSaveContext.randoSettings[index].value = RO_AGE_ADULT;
+                            setting.value = RO_AGE_ADULT;
                         }
                         break;
                     case RSK_GERUDO_FORTRESS:
                         if(it.value() == "Normal") {
-                            gSaveContext.randoSettings[index].value = RO_GF_NORMAL;
+                            setting.value = RO_GF_NORMAL;
                         } else if(it.value() == "Fast") {
-                            gSaveContext.randoSettings[index].value = RO_GF_FAST;
+                            setting.value = RO_GF_FAST;
                         } else if(it.value() == "Open") {
-                            gSaveContext.randoSettings[index].value = RO_GF_OPEN;
+                            setting.value = RO_GF_OPEN;
                         }
                         break;
                     case RSK_RAINBOW_BRIDGE:
                         if(it.value() == "Vanilla") {
-                            gSaveContext.randoSettings[index].value = RO_BRIDGE_VANILLA;
+                            setting.value = RO_BRIDGE_VANILLA;
                         } else if(it.value() == "Always open") {
-                            gSaveContext.randoSettings[index].value = RO_BRIDGE_ALWAYS_OPEN;
+                            setting.value = RO_BRIDGE_ALWAYS_OPEN;
                         } else if(it.value() == "Stones") {
-                            gSaveContext.randoSettings[index].value = RO_BRIDGE_STONES;
+                            setting.value = RO_BRIDGE_STONES;
                         } else if(it.value() == "Medallions") {
-                            gSaveContext.randoSettings[index].value = RO_BRIDGE_MEDALLIONS;
+                            setting.value = RO_BRIDGE_MEDALLIONS;
                         } else if(it.value() == "Dungeon rewards") {
-                            gSaveContext.randoSettings[index].value = RO_BRIDGE_DUNGEON_REWARDS;
+                            setting.value = RO_BRIDGE_DUNGEON_REWARDS;
                         } else if(it.value() == "Dungeons") {
-                            gSaveContext.randoSettings[index].value = RO_BRIDGE_DUNGEONS;
+                            setting.value = RO_BRIDGE_DUNGEONS;
                         } else if(it.value() == "Tokens") {
-                            gSaveContext.randoSettings[index].value = RO_BRIDGE_TOKENS;
+                            setting.value = RO_BRIDGE_TOKENS;
                         } else if(it.value() == "Greg") {
-                            gSaveContext.randoSettings[index].value = RO_BRIDGE_GREG;
+                            setting.value = RO_BRIDGE_GREG;
                         }
                         break;
                     case RSK_BRIDGE_OPTIONS:
                         if (it.value() == "Standard Rewards") {
-                            gSaveContext.randoSettings[index].value = RO_BRIDGE_STANDARD_REWARD;
+                            setting.value = RO_BRIDGE_STANDARD_REWARD;
                         } else if (it.value() == "Greg as Reward") {
-                            gSaveContext.randoSettings[index].value = RO_BRIDGE_GREG_REWARD;
+                            setting.value = RO_BRIDGE_GREG_REWARD;
                         } else if (it.value() == "Greg as Wildcard") {
-                            gSaveContext.randoSettings[index].value = RO_BRIDGE_WILDCARD_REWARD;
+                            setting.value = RO_BRIDGE_WILDCARD_REWARD;
                         }
                         break;
                     case RSK_LACS_OPTIONS:
                         if (it.value() == "Standard Reward") {
-                            gSaveContext.randoSettings[index].value = RO_LACS_STANDARD_REWARD;
+                            setting.value = RO_LACS_STANDARD_REWARD;
                         } else if (it.value() == "Greg as Reward") {
-                            gSaveContext.randoSettings[index].value = RO_LACS_GREG_REWARD;
+                            setting.value = RO_LACS_GREG_REWARD;
                         } else if (it.value() == "Greg as Wildcard") {
-                            gSaveContext.randoSettings[index].value = RO_LACS_WILDCARD_REWARD;
+                            setting.value = RO_LACS_WILDCARD_REWARD;
                         }
                         break;
                     case RSK_RAINBOW_BRIDGE_STONE_COUNT:
@@ -802,46 +658,46 @@ void Randomizer::ParseRandomizerSettingsFile(const char* spoilerFileName) {
                     case RSK_TRIFORCE_HUNT_PIECES_TOTAL:
                     case RSK_TRIFORCE_HUNT_PIECES_REQUIRED:
                         numericValueString = it.value();
-                        gSaveContext.randoSettings[index].value = std::stoi(numericValueString);
+                        setting.value = std::stoi(numericValueString);
                         break;
                     case RSK_SHOPSANITY:
                         if(it.value() == "Off") {
-                            gSaveContext.randoSettings[index].value = RO_SHOPSANITY_OFF;
+                            setting.value = RO_SHOPSANITY_OFF;
                         } else if(it.value() == "0 Items") {
-                            gSaveContext.randoSettings[index].value = RO_SHOPSANITY_ZERO_ITEMS;
+                            setting.value = RO_SHOPSANITY_ZERO_ITEMS;
                         } else if(it.value() == "1 Item") {
-                            gSaveContext.randoSettings[index].value = RO_SHOPSANITY_ONE_ITEM;
+                            setting.value = RO_SHOPSANITY_ONE_ITEM;
                         } else if(it.value() == "2 Items") {
-                            gSaveContext.randoSettings[index].value = RO_SHOPSANITY_TWO_ITEMS;
+                            setting.value = RO_SHOPSANITY_TWO_ITEMS;
                         } else if(it.value() == "3 Items") {
-                            gSaveContext.randoSettings[index].value = RO_SHOPSANITY_THREE_ITEMS;
+                            setting.value = RO_SHOPSANITY_THREE_ITEMS;
                         } else if(it.value() == "4 Items") {
-                            gSaveContext.randoSettings[index].value = RO_SHOPSANITY_FOUR_ITEMS;
+                            setting.value = RO_SHOPSANITY_FOUR_ITEMS;
                         } else if(it.value() == "Random") {
-                            gSaveContext.randoSettings[index].value = RO_SHOPSANITY_RANDOM;
+                            setting.value = RO_SHOPSANITY_RANDOM;
                         }
                         break;
                     case RSK_SHOPSANITY_PRICES:
                         if (it.value() == "Random") {
-                            gSaveContext.randoSettings[index].value = RO_SHOPSANITY_PRICE_BALANCED;
+                            setting.value = RO_SHOPSANITY_PRICE_BALANCED;
                         } else if (it.value() == "Starter Wallet") {
-                            gSaveContext.randoSettings[index].value = RO_SHOPSANITY_PRICE_STARTER;
+                            setting.value = RO_SHOPSANITY_PRICE_STARTER;
                         } else if (it.value() == "Adult's Wallet") {
-                            gSaveContext.randoSettings[index].value = RO_SHOPSANITY_PRICE_ADULT;
+                            setting.value = RO_SHOPSANITY_PRICE_ADULT;
                         } else if (it.value() == "Giant's Wallet") {
-                            gSaveContext.randoSettings[index].value = RO_SHOPSANITY_PRICE_GIANT;
+                            setting.value = RO_SHOPSANITY_PRICE_GIANT;
                         } else if (it.value() == "Tycoon's Wallet") {
-                            gSaveContext.randoSettings[index].value = RO_SHOPSANITY_PRICE_TYCOON;
+                            setting.value = RO_SHOPSANITY_PRICE_TYCOON;
                         }
                     case RSK_SHUFFLE_SCRUBS:
                         if(it.value() == "Off") {
-                            gSaveContext.randoSettings[index].value = RO_SCRUBS_OFF;
+                            setting.value = RO_SCRUBS_OFF;
                         } else if(it.value() == "Affordable") {
-                            gSaveContext.randoSettings[index].value = RO_SCRUBS_AFFORDABLE;
+                            setting.value = RO_SCRUBS_AFFORDABLE;
                         } else if(it.value() == "Expensive") {
-                            gSaveContext.randoSettings[index].value = RO_SCRUBS_EXPENSIVE;
+                            setting.value = RO_SCRUBS_EXPENSIVE;
                         } else if(it.value() == "Random Prices") {
-                            gSaveContext.randoSettings[index].value = RO_SCRUBS_RANDOM;
+                            setting.value = RO_SCRUBS_RANDOM;
                         }
                         break;
                     case RSK_SHUFFLE_GERUDO_MEMBERSHIP_CARD:
@@ -914,282 +770,281 @@ void Randomizer::ParseRandomizerSettingsFile(const char* spoilerFileName) {
                     case RSK_ALL_LOCATIONS_REACHABLE:
                     case RSK_TRIFORCE_HUNT:
                         if(it.value() == "Off") {
-                            gSaveContext.randoSettings[index].value = RO_GENERIC_OFF;
+                            setting.value = RO_GENERIC_OFF;
                         } else if(it.value() == "On") {
-                            gSaveContext.randoSettings[index].value = RO_GENERIC_ON;
+                            setting.value = RO_GENERIC_ON;
                         }
                         break;
                     case RSK_KEYRINGS:
                         if (it.value() == "Off") {
-                            gSaveContext.randoSettings[index].value = RO_KEYRINGS_OFF;
+                            setting.value = RO_KEYRINGS_OFF;
                         } else if (it.value() == "Random") {
-                            gSaveContext.randoSettings[index].value = RO_KEYRINGS_RANDOM;
+                            setting.value = RO_KEYRINGS_RANDOM;
                         } else if (it.value() == "Count") {
-                            gSaveContext.randoSettings[index].value = RO_KEYRINGS_COUNT;
+                            setting.value = RO_KEYRINGS_COUNT;
                         } else if (it.value() == "Selection") {
-                            gSaveContext.randoSettings[index].value = RO_KEYRINGS_SELECTION;
+                            setting.value = RO_KEYRINGS_SELECTION;
                         }
                         break;
                     case RSK_SHUFFLE_MERCHANTS:
                         if(it.value() == "Off") {
-                            gSaveContext.randoSettings[index].value = RO_SHUFFLE_MERCHANTS_OFF;
+                            setting.value = RO_SHUFFLE_MERCHANTS_OFF;
                         } else if (it.value() == "On (No Hints)") {
-                            gSaveContext.randoSettings[index].value = RO_SHUFFLE_MERCHANTS_ON_NO_HINT;
+                            setting.value = RO_SHUFFLE_MERCHANTS_ON_NO_HINT;
                         } else if (it.value() == "On (With Hints)") {
-                            gSaveContext.randoSettings[index].value = RO_SHUFFLE_MERCHANTS_ON_HINT;
+                            setting.value = RO_SHUFFLE_MERCHANTS_ON_HINT;
                         }
                         break;
                     // Uses Ammo Drops option for now. "Off" not yet implemented
                     case RSK_ENABLE_BOMBCHU_DROPS:
                         if (it.value() == "On") {
-                            gSaveContext.randoSettings[index].value = RO_AMMO_DROPS_ON;
+                            setting.value = RO_AMMO_DROPS_ON;
                         } else if (it.value() == "On + Bombchu") {
-                            gSaveContext.randoSettings[index].value = RO_AMMO_DROPS_ON_PLUS_BOMBCHU;
+                            setting.value = RO_AMMO_DROPS_ON_PLUS_BOMBCHU;
                         } else if (it.value() == "Off") {
-                            gSaveContext.randoSettings[index].value = RO_AMMO_DROPS_OFF;
+                            setting.value = RO_AMMO_DROPS_OFF;
                         }
                         break;
                     case RSK_STARTING_OCARINA:
                         if(it.value() == "Off") {
-                            gSaveContext.randoSettings[index].value = RO_STARTING_OCARINA_OFF;
+                            setting.value = RO_STARTING_OCARINA_OFF;
                         } else if(it.value() == "Fairy Ocarina") {
-                            gSaveContext.randoSettings[index].value = RO_STARTING_OCARINA_FAIRY;
+                            setting.value = RO_STARTING_OCARINA_FAIRY;
                         }
                         break;
                     case RSK_ITEM_POOL:
                         if(it.value() == "Plentiful") {
-                            gSaveContext.randoSettings[index].value = RO_ITEM_POOL_PLENTIFUL;
+                            setting.value = RO_ITEM_POOL_PLENTIFUL;
                         } else if(it.value() == "Balanced") {
-                            gSaveContext.randoSettings[index].value = RO_ITEM_POOL_BALANCED;
+                            setting.value = RO_ITEM_POOL_BALANCED;
                         } else if(it.value() == "Scarce") {
-                            gSaveContext.randoSettings[index].value = RO_ITEM_POOL_SCARCE;
+                            setting.value = RO_ITEM_POOL_SCARCE;
                         } else if(it.value() == "Minimal") {
-                            gSaveContext.randoSettings[index].value = RO_ITEM_POOL_MINIMAL;
+                            setting.value = RO_ITEM_POOL_MINIMAL;
                         }
                         break;
                     case RSK_ICE_TRAPS:
                         if(it.value() == "Off") {
-                            gSaveContext.randoSettings[index].value = RO_ICE_TRAPS_OFF;
+                            setting.value = RO_ICE_TRAPS_OFF;
                         } else if(it.value() == "Normal") {
-                            gSaveContext.randoSettings[index].value = RO_ICE_TRAPS_NORMAL;
+                            setting.value = RO_ICE_TRAPS_NORMAL;
                         } else if(it.value() == "Extra") {
-                            gSaveContext.randoSettings[index].value = RO_ICE_TRAPS_EXTRA;
+                            setting.value = RO_ICE_TRAPS_EXTRA;
                         } else if(it.value() == "Mayhem") {
-                            gSaveContext.randoSettings[index].value = RO_ICE_TRAPS_MAYHEM;
+                            setting.value = RO_ICE_TRAPS_MAYHEM;
                         } else if(it.value() == "Onslaught") {
-                            gSaveContext.randoSettings[index].value = RO_ICE_TRAPS_ONSLAUGHT;
+                            setting.value = RO_ICE_TRAPS_ONSLAUGHT;
                         }
                         break;
                     case RSK_GOSSIP_STONE_HINTS:
                         if(it.value() == "No Hints") {
-                            gSaveContext.randoSettings[index].value = RO_GOSSIP_STONES_NONE;
+                            setting.value = RO_GOSSIP_STONES_NONE;
                         } else if(it.value() == "Need Nothing") {
-                            gSaveContext.randoSettings[index].value = RO_GOSSIP_STONES_NEED_NOTHING;
+                            setting.value = RO_GOSSIP_STONES_NEED_NOTHING;
                         } else if(it.value() == "Mask of Truth") {
-                            gSaveContext.randoSettings[index].value = RO_GOSSIP_STONES_NEED_TRUTH;
+                            setting.value = RO_GOSSIP_STONES_NEED_TRUTH;
                         } else if(it.value() == "Stone of Agony") {
-                            gSaveContext.randoSettings[index].value = RO_GOSSIP_STONES_NEED_STONE;
+                            setting.value = RO_GOSSIP_STONES_NEED_STONE;
                         }
                         break;
                     case RSK_HINT_CLARITY:
                         if(it.value() == "Obscure") {
-                            gSaveContext.randoSettings[index].value = RO_HINT_CLARITY_OBSCURE;
+                            setting.value = RO_HINT_CLARITY_OBSCURE;
                         } else if(it.value() == "Ambiguous") {
-                            gSaveContext.randoSettings[index].value = RO_HINT_CLARITY_AMBIGUOUS;
+                            setting.value = RO_HINT_CLARITY_AMBIGUOUS;
                         } else if(it.value() == "Clear") {
-                            gSaveContext.randoSettings[index].value = RO_HINT_CLARITY_CLEAR;
+                            setting.value = RO_HINT_CLARITY_CLEAR;
                         }
                         break;
                     case RSK_HINT_DISTRIBUTION:
                         if(it.value() == "Useless") {
-                            gSaveContext.randoSettings[index].value = RO_HINT_DIST_USELESS;
+                            setting.value = RO_HINT_DIST_USELESS;
                         } else if(it.value() == "Balanced") {
-                            gSaveContext.randoSettings[index].value = RO_HINT_DIST_BALANCED;
+                            setting.value = RO_HINT_DIST_BALANCED;
                         } else if(it.value() == "Strong") {
-                            gSaveContext.randoSettings[index].value = RO_HINT_DIST_STRONG;
+                            setting.value = RO_HINT_DIST_STRONG;
                         } else if(it.value() == "Very Strong") {
-                            gSaveContext.randoSettings[index].value = RO_HINT_DIST_VERY_STRONG;
+                            setting.value = RO_HINT_DIST_VERY_STRONG;
                         }
                         break;
                     case RSK_GERUDO_KEYS:
                         if (it.value() == "Vanilla") {
-                            gSaveContext.randoSettings[index].value = RO_GERUDO_KEYS_VANILLA;
+                            setting.value = RO_GERUDO_KEYS_VANILLA;
                         } else if (it.value() == "Any Dungeon") {
-                            gSaveContext.randoSettings[index].value = RO_GERUDO_KEYS_ANY_DUNGEON;
+                            setting.value = RO_GERUDO_KEYS_ANY_DUNGEON;
                         } else if (it.value() == "Overworld") {
-                            gSaveContext.randoSettings[index].value = RO_GERUDO_KEYS_OVERWORLD;
+                            setting.value = RO_GERUDO_KEYS_OVERWORLD;
                         } else if (it.value() == "Anywhere") {
-                            gSaveContext.randoSettings[index].value = RO_GERUDO_KEYS_ANYWHERE;
+                            setting.value = RO_GERUDO_KEYS_ANYWHERE;
                         }
                         break;
                     case RSK_KEYSANITY:
                     case RSK_BOSS_KEYSANITY:
                     case RSK_STARTING_MAPS_COMPASSES:
                         if(it.value() == "Start With") {
-                            gSaveContext.randoSettings[index].value = RO_DUNGEON_ITEM_LOC_STARTWITH;
+                            setting.value = RO_DUNGEON_ITEM_LOC_STARTWITH;
                         } else if(it.value() == "Vanilla") {
-                            gSaveContext.randoSettings[index].value = RO_DUNGEON_ITEM_LOC_VANILLA;
+                            setting.value = RO_DUNGEON_ITEM_LOC_VANILLA;
                         } else if(it.value() == "Own Dungeon") {
-                            gSaveContext.randoSettings[index].value = RO_DUNGEON_ITEM_LOC_OWN_DUNGEON;
+                            setting.value = RO_DUNGEON_ITEM_LOC_OWN_DUNGEON;
                         } else if(it.value() == "Any Dungeon") {
-                            gSaveContext.randoSettings[index].value = RO_DUNGEON_ITEM_LOC_ANY_DUNGEON;
+                            setting.value = RO_DUNGEON_ITEM_LOC_ANY_DUNGEON;
                         } else if(it.value() == "Overworld") {
-                            gSaveContext.randoSettings[index].value = RO_DUNGEON_ITEM_LOC_OVERWORLD;
+                            setting.value = RO_DUNGEON_ITEM_LOC_OVERWORLD;
                         } else if(it.value() == "Anywhere") {
-                            gSaveContext.randoSettings[index].value = RO_DUNGEON_ITEM_LOC_ANYWHERE;
+                            setting.value = RO_DUNGEON_ITEM_LOC_ANYWHERE;
                         }
                         break;
                     case RSK_GANONS_BOSS_KEY:
                         if(it.value() == "Vanilla") {
-                            gSaveContext.randoSettings[index].value = RO_GANON_BOSS_KEY_VANILLA;
+                            setting.value = RO_GANON_BOSS_KEY_VANILLA;
                         } else if(it.value() == "Own dungeon") {
-                            gSaveContext.randoSettings[index].value = RO_GANON_BOSS_KEY_OWN_DUNGEON;
+                            setting.value = RO_GANON_BOSS_KEY_OWN_DUNGEON;
                         } else if(it.value() == "Start with") {
-                            gSaveContext.randoSettings[index].value = RO_GANON_BOSS_KEY_STARTWITH;
+                            setting.value = RO_GANON_BOSS_KEY_STARTWITH;
                         } else if(it.value() == "Any Dungeon") {
-                            gSaveContext.randoSettings[index].value = RO_GANON_BOSS_KEY_ANY_DUNGEON;
+                            setting.value = RO_GANON_BOSS_KEY_ANY_DUNGEON;
                         } else if(it.value() == "Overworld") {
-                            gSaveContext.randoSettings[index].value = RO_GANON_BOSS_KEY_OVERWORLD;
+                            setting.value = RO_GANON_BOSS_KEY_OVERWORLD;
                         } else if(it.value() == "Anywhere") {                         
-                            gSaveContext.randoSettings[index].value = RO_GANON_BOSS_KEY_ANYWHERE;
+                            setting.value = RO_GANON_BOSS_KEY_ANYWHERE;
                         } else if(it.value() == "LACS-Vanilla") {
-                            gSaveContext.randoSettings[index].value = RO_GANON_BOSS_KEY_LACS_VANILLA;
+                            setting.value = RO_GANON_BOSS_KEY_LACS_VANILLA;
                         } else if(it.value() == "LACS-Stones") {
-                            gSaveContext.randoSettings[index].value = RO_GANON_BOSS_KEY_LACS_STONES;
+                            setting.value = RO_GANON_BOSS_KEY_LACS_STONES;
                         } else if(it.value() == "LACS-Medallions") {
-                            gSaveContext.randoSettings[index].value = RO_GANON_BOSS_KEY_LACS_MEDALLIONS;
+                            setting.value = RO_GANON_BOSS_KEY_LACS_MEDALLIONS;
                         } else if(it.value() == "LACS-Rewards") {
-                            gSaveContext.randoSettings[index].value = RO_GANON_BOSS_KEY_LACS_REWARDS;
+                            setting.value = RO_GANON_BOSS_KEY_LACS_REWARDS;
                         } else if(it.value() == "LACS-Dungeons") {
-                            gSaveContext.randoSettings[index].value = RO_GANON_BOSS_KEY_LACS_DUNGEONS;
+                            setting.value = RO_GANON_BOSS_KEY_LACS_DUNGEONS;
                         } else if(it.value() == "LACS-Tokens") {
-                            gSaveContext.randoSettings[index].value = RO_GANON_BOSS_KEY_LACS_TOKENS;
+                            setting.value = RO_GANON_BOSS_KEY_LACS_TOKENS;
                         } else if(it.value() == "100 GS Reward") {
-                            gSaveContext.randoSettings[index].value = RO_GANON_BOSS_KEY_KAK_TOKENS;
+                            setting.value = RO_GANON_BOSS_KEY_KAK_TOKENS;
                         } else if(it.value() == "Triforce Hunt") {
-                            gSaveContext.randoSettings[index].value = RO_GANON_BOSS_KEY_TRIFORCE_HUNT;
+                            setting.value = RO_GANON_BOSS_KEY_TRIFORCE_HUNT;
                         }
                         break;
                     case RSK_RANDOM_MQ_DUNGEONS:
                         if (it.value() == "None") {
-                            gSaveContext.randoSettings[index].value = RO_MQ_DUNGEONS_NONE;
+                            setting.value = RO_MQ_DUNGEONS_NONE;
                         } else if (it.value() == "Random Number") {
-                            gSaveContext.randoSettings[index].value = RO_MQ_DUNGEONS_RANDOM_NUMBER;
+                            setting.value = RO_MQ_DUNGEONS_RANDOM_NUMBER;
                         } else if (it.value() == "Set Number") {
-                            gSaveContext.randoSettings[index].value = RO_MQ_DUNGEONS_SET_NUMBER;
+                            setting.value = RO_MQ_DUNGEONS_SET_NUMBER;
                         }
                         break;
                     case RSK_SKIP_CHILD_ZELDA:
-                        gSaveContext.randoSettings[index].value = it.value();
+                        setting.value = it.value();
                         break;
                     case RSK_STARTING_CONSUMABLES:
                     case RSK_FULL_WALLETS:
                         if(it.value() == "No") {
-                            gSaveContext.randoSettings[index].value = RO_GENERIC_NO;
+                            setting.value = RO_GENERIC_NO;
                         } else if(it.value() == "Yes") {
-                            gSaveContext.randoSettings[index].value = RO_GENERIC_YES;
+                            setting.value = RO_GENERIC_YES;
                         }
                         break;
                     case RSK_SKIP_CHILD_STEALTH:
                     case RSK_SKIP_EPONA_RACE:
                     case RSK_SKIP_TOWER_ESCAPE:
                         if(it.value() == "Don't Skip") {
-                            gSaveContext.randoSettings[index].value = RO_GENERIC_DONT_SKIP;
+                            setting.value = RO_GENERIC_DONT_SKIP;
                         } else if (it.value() == "Skip") {
-                            gSaveContext.randoSettings[index].value = RO_GENERIC_SKIP;
+                            setting.value = RO_GENERIC_SKIP;
                         }
                         break;
                     case RSK_SHUFFLE_DUNGEON_REWARDS:
                         if (it.value() == "End of dungeons") {
-                            gSaveContext.randoSettings[index].value = RO_DUNGEON_REWARDS_END_OF_DUNGEON;
+                            setting.value = RO_DUNGEON_REWARDS_END_OF_DUNGEON;
                         } else if (it.value() == "Any dungeon") {
-                            gSaveContext.randoSettings[index].value = RO_DUNGEON_REWARDS_ANY_DUNGEON;
+                            setting.value = RO_DUNGEON_REWARDS_ANY_DUNGEON;
                         } else if (it.value() == "Overworld") {
-                            gSaveContext.randoSettings[index].value = RO_DUNGEON_REWARDS_OVERWORLD;
+                            setting.value = RO_DUNGEON_REWARDS_OVERWORLD;
                         } else if (it.value() == "Anywhere") {
-                            gSaveContext.randoSettings[index].value = RO_DUNGEON_REWARDS_ANYWHERE;
+                            setting.value = RO_DUNGEON_REWARDS_ANYWHERE;
                         }
                         break;
                     case RSK_SHUFFLE_SONGS:
                         if (it.value() == "Song locations") {
-                            gSaveContext.randoSettings[index].value = RO_SONG_SHUFFLE_SONG_LOCATIONS;
+                            setting.value = RO_SONG_SHUFFLE_SONG_LOCATIONS;
                         } else if (it.value() == "Dungeon rewards") {
-                            gSaveContext.randoSettings[index].value = RO_SONG_SHUFFLE_DUNGEON_REWARDS;
+                            setting.value = RO_SONG_SHUFFLE_DUNGEON_REWARDS;
                         } else if (it.value() == "Anywhere") {
-                            gSaveContext.randoSettings[index].value = RO_SONG_SHUFFLE_ANYWHERE;
+                            setting.value = RO_SONG_SHUFFLE_ANYWHERE;
                         }
                         break;
                     case RSK_SHUFFLE_TOKENS:
                         if (it.value() == "Off") {
-                            gSaveContext.randoSettings[index].value = RO_TOKENSANITY_OFF;
+                            setting.value = RO_TOKENSANITY_OFF;
                         } else if (it.value() == "Dungeons") {
-                            gSaveContext.randoSettings[index].value = RO_TOKENSANITY_DUNGEONS;
+                            setting.value = RO_TOKENSANITY_DUNGEONS;
                         } else if (it.value() == "Overworld") {
-                            gSaveContext.randoSettings[index].value = RO_TOKENSANITY_OVERWORLD;
+                            setting.value = RO_TOKENSANITY_OVERWORLD;
                         } else if (it.value() == "All Tokens") {
-                            gSaveContext.randoSettings[index].value = RO_TOKENSANITY_ALL;
+                            setting.value = RO_TOKENSANITY_ALL;
                         }
                         break;
                     case RSK_LINKS_POCKET:
                         if (it.value() == "Dungeon Reward") {
-                            gSaveContext.randoSettings[index].value = RO_LINKS_POCKET_DUNGEON_REWARD;
+                            setting.value = RO_LINKS_POCKET_DUNGEON_REWARD;
                         } else if (it.value() == "Advancement") {
-                            gSaveContext.randoSettings[index].value = RO_LINKS_POCKET_ADVANCEMENT;
+                            setting.value = RO_LINKS_POCKET_ADVANCEMENT;
                         } else if (it.value() == "Anything") {
-                            gSaveContext.randoSettings[index].value = RO_LINKS_POCKET_ANYTHING;
+                            setting.value = RO_LINKS_POCKET_ANYTHING;
                         } else if (it.value() == "Nothing") {
-                            gSaveContext.randoSettings[index].value = RO_LINKS_POCKET_NOTHING;
+                            setting.value = RO_LINKS_POCKET_NOTHING;
                         }
                         break;
                     case RSK_MQ_DUNGEON_COUNT:
                         if (it.value() == "Count") {
                             numericValueString = it.value();
-                            gSaveContext.randoSettings[index].value = std::stoi(numericValueString);
+                            setting.value = std::stoi(numericValueString);
                         }
 
                         else if (it.value() == "Random") {
-                            gSaveContext.randoSettings[index].value = 13;
+                            setting.value = 13;
                         }
 
                         else if (it.value() == "Selection") {
-                            gSaveContext.randoSettings[index].value = RO_MQ_DUNGEONS_SELECTION;
+                            setting.value = RO_MQ_DUNGEONS_SELECTION;
                         }
 
                         break;
                     case RSK_SHUFFLE_DUNGEON_ENTRANCES:
                         if (it.value() == "Off") {
-                            gSaveContext.randoSettings[index].value = RO_DUNGEON_ENTRANCE_SHUFFLE_OFF;
+                            setting.value = RO_DUNGEON_ENTRANCE_SHUFFLE_OFF;
                         } else if (it.value() == "On") {
-                            gSaveContext.randoSettings[index].value = RO_DUNGEON_ENTRANCE_SHUFFLE_ON;
+                            setting.value = RO_DUNGEON_ENTRANCE_SHUFFLE_ON;
                         } else if (it.value() == "On + Ganon") {
-                            gSaveContext.randoSettings[index].value = RO_DUNGEON_ENTRANCE_SHUFFLE_ON_PLUS_GANON;
+                            setting.value = RO_DUNGEON_ENTRANCE_SHUFFLE_ON_PLUS_GANON;
                         }
                         break;
                     case RSK_SHUFFLE_BOSS_ENTRANCES:
                         if (it.value() == "Off") {
-                            gSaveContext.randoSettings[index].value = RO_BOSS_ROOM_ENTRANCE_SHUFFLE_OFF;
+                            setting.value = RO_BOSS_ROOM_ENTRANCE_SHUFFLE_OFF;
                         } else if (it.value() == "Age Restricted") {
-                            gSaveContext.randoSettings[index].value = RO_BOSS_ROOM_ENTRANCE_SHUFFLE_AGE_RESTRICTED;
+                            setting.value = RO_BOSS_ROOM_ENTRANCE_SHUFFLE_AGE_RESTRICTED;
                         } else if (it.value() == "Full") {
-                            gSaveContext.randoSettings[index].value = RO_BOSS_ROOM_ENTRANCE_SHUFFLE_FULL;
+                            setting.value = RO_BOSS_ROOM_ENTRANCE_SHUFFLE_FULL;
                         }
                         break;
                     case RSK_SHUFFLE_INTERIOR_ENTRANCES:
                         if (it.value() == "Off") {
-                            gSaveContext.randoSettings[index].value = RO_INTERIOR_ENTRANCE_SHUFFLE_OFF;
+                            setting.value = RO_INTERIOR_ENTRANCE_SHUFFLE_OFF;
                         } else if (it.value() == "Simple") {
-                            gSaveContext.randoSettings[index].value = RO_INTERIOR_ENTRANCE_SHUFFLE_SIMPLE;
+                            setting.value = RO_INTERIOR_ENTRANCE_SHUFFLE_SIMPLE;
                         } else if (it.value() == "All") {
-                            gSaveContext.randoSettings[index].value = RO_INTERIOR_ENTRANCE_SHUFFLE_ALL;
+                            setting.value = RO_INTERIOR_ENTRANCE_SHUFFLE_ALL;
                         }
                         break;
                 }
             }
         }
 
-        success = true;
     } catch (const std::exception& e) {
-        return;
+        data.settings.clear();
     }
 }
 
@@ -1296,146 +1151,101 @@ std::string FormatJsonHintText(std::string jsonHint) {
     return formattedHintMessage;
 }
 
-void Randomizer::ParseHintLocationsFile(const char* spoilerFileName) {
-    std::ifstream spoilerFileStream(SohUtils::Sanitize(spoilerFileName));
-    if (!spoilerFileStream)
-        return;
+static void ParseHintsJson(json& spoilerFileJson, SeedFileData& data) {
+    try {
+        data.childAltarText = FormatJsonHintText(spoilerFileJson["childAltar"]["hintText"]);
+        data.rewardCheck[0] = SpoilerfileCheckNameToEnum[spoilerFileJson["childAltar"]["rewards"]["emeraldLoc"]];
+        data.rewardCheck[1] = SpoilerfileCheckNameToEnum[spoilerFileJson["childAltar"]["rewards"]["rubyLoc"]];
+        data.rewardCheck[2] = SpoilerfileCheckNameToEnum[spoilerFileJson["childAltar"]["rewards"]["sapphireLoc"]];
 
-    bool success = false;
+        data.adultAltarText = FormatJsonHintText(spoilerFileJson["adultAltar"]["hintText"]);
+        data.rewardCheck[3] = SpoilerfileCheckNameToEnum[spoilerFileJson["adultAltar"]["rewards"]["forestMedallionLoc"]];
+        data.rewardCheck[4] = SpoilerfileCheckNameToEnum[spoilerFileJson["adultAltar"]["rewards"]["fireMedallionLoc"]];
+        data.rewardCheck[5] = SpoilerfileCheckNameToEnum[spoilerFileJson["adultAltar"]["rewards"]["waterMedallionLoc"]];
+        data.rewardCheck[6] = SpoilerfileCheckNameToEnum[spoilerFileJson["adultAltar"]["rewards"]["shadowMedallionLoc"]];
+        data.rewardCheck[7] = SpoilerfileCheckNameToEnum[spoilerFileJson["adultAltar"]["rewards"]["spiritMedallionLoc"]];
+        data.rewardCheck[8] = SpoilerfileCheckNameToEnum[spoilerFileJson["adultAltar"]["rewards"]["lightMedallionLoc"]];
 
-    try {
-        json spoilerFileJson;
-        spoilerFileStream >> spoilerFileJson;
+        data.ganonHintText = spoilerFileJson["ganonHintText"].get<std::string>();
+
+        data.masterSwordHintCheck = SpoilerfileCheckNameToEnum[spoilerFileJson["masterSwordHintLoc"]];
+
+        data.ganonText = spoilerFileJson["ganonText"].get<std::string>();
+
+        data.dampeText = spoilerFileJson["dampeText"].get<std::string>();
+        data.dampeCheck = SpoilerfileCheckNameToEnum[spoilerFileJson["dampeHintLoc"]];
+
+        data.gregHintText = spoilerFileJson["gregText"].get<std::string>();
+        data.gregCheck = SpoilerfileCheckNameToEnum[spoilerFileJson["gregLoc"]];
+
+        data.sheikText = spoilerFileJson["sheikText"].get<std::string>();
+        data.lightArrowHintCheck = SpoilerfileCheckNameToEnum[spoilerFileJson["lightArrowHintLoc"]];
+
+        data.sariaText = spoilerFileJson["sariaText"].get<std::string>();
+        data.sariaCheck = SpoilerfileCheckNameToEnum[spoilerFileJson["sariaHintLoc"]];
 
-        SohUtils::CopyStringToCharArray(gSaveContext.childAltarText,
-                                        FormatJsonHintText(spoilerFileJson["childAltar"]["hintText"]),
-                                        ARRAY_COUNT(gSaveContext.childAltarText));
-        gSaveContext.rewardCheck[0] = SpoilerfileCheckNameToEnum[spoilerFileJson["childAltar"]["rewards"]["emeraldLoc"]];
-        gSaveContext.rewardCheck[1] = SpoilerfileCheckNameToEnum[spoilerFileJson["childAltar"]["rewards"]["rubyLoc"]];
-        gSaveContext.rewardCheck[2] = SpoilerfileCheckNameToEnum[spoilerFileJson["childAltar"]["rewards"]["sapphireLoc"]];
-
-        SohUtils::CopyStringToCharArray(gSaveContext.adultAltarText,
-                                        FormatJsonHintText(spoilerFileJson["adultAltar"]["hintText"]),
-                                        ARRAY_COUNT(gSaveContext.adultAltarText));
-        gSaveContext.rewardCheck[3] = SpoilerfileCheckNameToEnum[spoilerFileJson["adultAltar"]["rewards"]["forestMedallionLoc"]];
-        gSaveContext.rewardCheck[4] = SpoilerfileCheckNameToEnum[spoilerFileJson["adultAltar"]["rewards"]["fireMedallionLoc"]];
-        gSaveContext.rewardCheck[5] = SpoilerfileCheckNameToEnum[spoilerFileJson["adultAltar"]["rewards"]["waterMedallionLoc"]];
-        gSaveContext.rewardCheck[6] = SpoilerfileCheckNameToEnum[spoilerFileJson["adultAltar"]["rewards"]["shadowMedallionLoc"]];
-        gSaveContext.rewardCheck[7] = SpoilerfileCheckNameToEnum[spoilerFileJson["adultAltar"]["rewards"]["spiritMedallionLoc"]];
-        gSaveContext.rewardCheck[8] = SpoilerfileCheckNameToEnum[spoilerFileJson["adultAltar"]["rewards"]["lightMedallionLoc"]];
-
-        SohUtils::CopyStringToCharArray(gSaveContext.ganonHintText, spoilerFileJson["ganonHintText"],
-                                        ARRAY_COUNT(gSaveContext.ganonHintText));
-
-        gSaveContext.masterSwordHintCheck = SpoilerfileCheckNameToEnum[spoilerFileJson["masterSwordHintLoc"]];
-
-        SohUtils::CopyStringToCharArray(gSaveContext.ganonText, spoilerFileJson["ganonText"],
-                                        ARRAY_COUNT(gSaveContext.ganonText));
-
-        SohUtils::CopyStringToCharArray(gSaveContext.dampeText, spoilerFileJson["dampeText"],
-                                        ARRAY_COUNT(gSaveContext.dampeText));
-        gSaveContext.dampeCheck = SpoilerfileCheckNameToEnum[spoilerFileJson["dampeHintLoc"]];
-
-        SohUtils::CopyStringToCharArray(gSaveContext.gregHintText, spoilerFileJson["gregText"],
-                                        ARRAY_COUNT(gSaveContext.gregHintText));
-        gSaveContext.gregCheck = SpoilerfileCheckNameToEnum[spoilerFileJson["gregLoc"]];
-
-        SohUtils::CopyStringToCharArray(gSaveContext.sheikText, spoilerFileJson["sheikText"],
-                                        ARRAY_COUNT(gSaveContext.sheikText));
-        gSaveContext.lightArrowHintCheck = SpoilerfileCheckNameToEnum[spoilerFileJson["lightArrowHintLoc"]];
-
-        SohUtils::CopyStringToCharArray(gSaveContext.sariaText, spoilerFileJson["sariaText"],
-                                        ARRAY_COUNT(gSaveContext.sariaText));
-        gSaveContext.sariaCheck = SpoilerfileCheckNameToEnum[spoilerFileJson["sariaHintLoc"]];
-
-        SohUtils::CopyStringToCharArray(gSaveContext.warpMinuetText, spoilerFileJson["warpMinuetText"],
-                                        ARRAY_COUNT(gSaveContext.warpMinuetText));
-        SohUtils::CopyStringToCharArray(gSaveContext.warpBoleroText, spoilerFileJson["warpBoleroText"],
-                                        ARRAY_COUNT(gSaveContext.warpBoleroText));
-        SohUtils::CopyStringToCharArray(gSaveContext.warpSerenadeText, spoilerFileJson["warpSerenadeText"],
-                                        ARRAY_COUNT(gSaveContext.warpSerenadeText));
-        SohUtils::CopyStringToCharArray(gSaveContext.warpRequiemText, spoilerFileJson["warpRequiemText"],
-                                        ARRAY_COUNT(gSaveContext.warpRequiemText));
-        SohUtils::CopyStringToCharArray(gSaveContext.warpNocturneText, spoilerFileJson["warpNocturneText"],
-                                        ARRAY_COUNT(gSaveContext.warpNocturneText));
-        SohUtils::CopyStringToCharArray(gSaveContext.warpPreludeText, spoilerFileJson["warpPreludeText"],
-                                        ARRAY_COUNT(gSaveContext.warpPreludeText));
+        data.warpMinuetText = spoilerFileJson["warpMinuetText"].get<std::string>();
+        data.warpBoleroText = spoilerFileJson["warpBoleroText"].get<std::string>();
+        data.warpSerenadeText = spoilerFileJson["warpSerenadeText"].get<std::string>();
+        data.warpRequiemText = spoilerFileJson["warpRequiemText"].get<std::string>();
+        data.warpNocturneText = spoilerFileJson["warpNocturneText"].get<std::string>();
+        data.warpPreludeText = spoilerFileJson["warpPreludeText"].get<std::string>();
 
         json hintsJson = spoilerFileJson["hints"];
-        int index = 0;
         for (auto it = hintsJson.begin(); it != hintsJson.end(); ++it) {
-            gSaveContext.hintLocations[index].check = SpoilerfileCheckNameToEnum[it.key()];
+            SeedFileHint& hint = data.hints.emplace_back();
+            hint.check = SpoilerfileCheckNameToEnum[it.key()];
             auto hintInfo = it.value();
             if (hintInfo["location"].is_null()) {
-                gSaveContext.hintLocations[index].hintedCheck = RC_UNKNOWN_CHECK;
+                hint.hintedCheck = RC_UNKNOWN_CHECK;
             } else {
-                gSaveContext.hintLocations[index].hintedCheck = SpoilerfileCheckNameToEnum[hintInfo["location"]];
+                hint.hintedCheck = SpoilerfileCheckNameToEnum[hintInfo["location"]];
             }
             if (hintInfo["item"].is_null()) {
-                gSaveContext.hintLocations[index].rGet = RG_NONE;
+                hint.rGet = RG_NONE;
             } else {
-                gSaveContext.hintLocations[index].rGet = SpoilerfileGetNameToEnum[hintInfo["item"]];
+                hint.rGet = SpoilerfileGetNameToEnum[hintInfo["item"]];
             }
-            gSaveContext.hintLocations[index].type = SpoilerfileHintTypeNameToEnum[hintInfo["type"]];
+            hint.type = SpoilerfileHintTypeNameToEnum[hintInfo["type"]];
 
-            if (gSaveContext.hintLocations[index].type == HINT_TYPE_TRIAL) {
-                gSaveContext.hintLocations[index].area = RCAREA_GANONS_CASTLE;
-            } else if (gSaveContext.hintLocations[index].type == HINT_TYPE_JUNK) {
-                gSaveContext.hintLocations[index].area = RCAREA_INVALID;
+            if (hint.type == HINT_TYPE_TRIAL) {
+                hint.area = RCAREA_GANONS_CASTLE;
+            } else if (hint.type == HINT_TYPE_JUNK) {
+                hint.area = RCAREA_INVALID;
             } else {
-                gSaveContext.hintLocations[index].area = SpoilerfileAreaNameToEnum[hintInfo["area"]];
+                hint.area = SpoilerfileAreaNameToEnum[hintInfo["area"]];
             }
 
-            SohUtils::CopyStringToCharArray(gSaveContext.hintLocations[index].hintText, hintInfo["hint"], ARRAY_COUNT(gSaveContext.hintLocations[index].hintText));
-
-            index++;
+            hint.hintText = hintInfo["hint"].get<std::string>();
         }
 
-        success = true;
+        data.hintsParsed = true;
     } catch (const std::exception& e) {
         return;
     }
 }
 
-void Randomizer::ParseRequiredTrialsFile(const char* spoilerFileName) {
-    std::ifstream spoilerFileStream(SohUtils::Sanitize(spoilerFileName));
-    if (!spoilerFileStream) {
-        return;
-    }
-
-    this->trialsRequired.clear();
-
+static void ParseRequiredTrialsJson(json& spoilerFileJson, SeedFileData& data) {
     try {
-        json spoilerFileJson;
-        spoilerFileStream >> spoilerFileJson;
         json trialsJson = spoilerFileJson["requiredTrials"];
 
         for (auto it = trialsJson.begin(); it != trialsJson.end(); it++) {
-            this->trialsRequired[spoilerFileTrialToEnum[it.value()]] = true;
+            data.requiredTrials.push_back(spoilerFileTrialToEnum[it.value()]);
         }
     } catch (const std::exception& e) {
-        return;
+        data.requiredTrials.clear();
     }
 }
 
-void Randomizer::ParseMasterQuestDungeonsFile(const char* spoilerFileName) {
-    std::ifstream spoilerFileStream(SohUtils::Sanitize(spoilerFileName));
-    if (!spoilerFileStream) {
-        return;
-    }
-
-    this->masterQuestDungeons.clear();
-
+static void ParseMasterQuestDungeonsJson(json& spoilerFileJson, SeedFileData& data) {
     try {
-        json spoilerFileJson;
-        spoilerFileStream >> spoilerFileJson;
         json mqDungeonsJson = spoilerFileJson["masterQuestDungeons"];
 
         for (auto it = mqDungeonsJson.begin(); it != mqDungeonsJson.end(); it++) {
-            this->masterQuestDungeons.emplace(spoilerFileDungeonToScene[it.value()]);
+            data.masterQuestDungeons.push_back(spoilerFileDungeonToScene[it.value()]);
         }
     } catch (const std::exception& e) {
-        return;
+        data.masterQuestDungeons.clear();
     }
 }
 
@@ -1498,110 +1308,369 @@ int16_t Randomizer::GetVanillaMerchantPrice(RandomizerCheck check) {
     }
 }
 
-void Randomizer::ParseItemLocationsFile(const char* spoilerFileName, bool silent) {
-    std::ifstream spoilerFileStream(SohUtils::Sanitize(spoilerFileName));
-    if (!spoilerFileStream)
-        return;
-
-    bool success = false;
-
+static void ParseItemLocationsJson(json& spoilerFileJson, SeedFileData& data) {
     try {
-        json spoilerFileJson;
-        spoilerFileStream >> spoilerFileJson;
         json locationsJson = spoilerFileJson["locations"];
         json hashJson = spoilerFileJson["file_hash"];
 
-        int index = 0;
         for (auto it = hashJson.begin(); it != hashJson.end(); ++it) {
-            gSaveContext.seedIcons[index] = gSeedTextures[it.value()].id;
-            index++;
+            data.seedIcons.push_back(gSeedTextures[it.value()].id);
         }
 
-        SohUtils::CopyStringToCharArray(gSaveContext.inputSeed, spoilerFileJson["seed"],
-                                        ARRAY_COUNT(gSaveContext.inputSeed));
+        data.inputSeed = spoilerFileJson["seed"].get<std::string>();
 
-        gSaveContext.finalSeed = spoilerFileJson["finalSeed"].get<uint32_t>();
+        data.finalSeed = spoilerFileJson["finalSeed"].get<uint32_t>();
 
         for (auto it = locationsJson.begin(); it != locationsJson.end(); ++it) {
-            RandomizerCheck randomizerCheck = SpoilerfileCheckNameToEnum[it.key()];
+            SeedFileItemLocation& location = data.itemLocations.emplace_back();
+            location.check = SpoilerfileCheckNameToEnum[it.key()];
             if (it->is_structured()) {
                 json itemJson = *it;
                 for (auto itemit = itemJson.begin(); itemit != itemJson.end(); ++itemit) {
                     if (itemit.key() == "item") {
-                        gSaveContext.itemLocations[randomizerCheck].check = randomizerCheck;
-                        gSaveContext.itemLocations[randomizerCheck].get.rgID = SpoilerfileGetNameToEnum[itemit.value()];
+                        location.hasItem = true;
+                        location.rgID = SpoilerfileGetNameToEnum[itemit.value()];
                     } else if (itemit.key() == "price") {
-                        merchantPrices[gSaveContext.itemLocations[randomizerCheck].check] = itemit.value();
+                        location.hasPrice = true;
+                        location.price = itemit.value().get<uint16_t>();
                     } else if (itemit.key() == "model") {
-                        gSaveContext.itemLocations[randomizerCheck].get.fakeRgID =
-                            SpoilerfileGetNameToEnum[itemit.value()];
+                        location.hasModel = true;
+                        location.fakeRgID = SpoilerfileGetNameToEnum[itemit.value()];
                     } else if (itemit.key() == "trickName") {
-                        SohUtils::CopyStringToCharArray(gSaveContext.itemLocations[randomizerCheck].get.trickName,
-                                                        itemit.value(), MAX_TRICK_NAME_SIZE);
+                        location.hasTrickName = true;
+                        location.trickName = itemit.value().get<std::string>();
                     }
                 }
             } else {
-                gSaveContext.itemLocations[randomizerCheck].check = SpoilerfileCheckNameToEnum[it.key()];
-                gSaveContext.itemLocations[randomizerCheck].get.rgID = SpoilerfileGetNameToEnum[it.value()];
-                gSaveContext.itemLocations[randomizerCheck].get.fakeRgID = RG_NONE;
-                int16_t price = GetVanillaMerchantPrice(randomizerCheck);
+                location.hasItem = true;
+                location.rgID = SpoilerfileGetNameToEnum[it.value()];
+                location.hasModel = true;
+                location.fakeRgID = RG_NONE;
+                int16_t price = Randomizer::GetVanillaMerchantPrice(location.check);
                 if (price != -1) {
-                    merchantPrices[gSaveContext.itemLocations[randomizerCheck].check] = price;
+                    location.hasPrice = true;
+                    location.price = price;
                 }
             }
         }
 
-        if(!silent) {
-            Audio_PlaySoundGeneral(NA_SE_SY_CORRECT_CHIME, &D_801333D4, 4, &D_801333E0, &D_801333E0, &D_801333E8);
-        }
-        success = true;
+        data.itemLocationsParsed = true;
     } catch (const std::exception& e) {
-        Audio_PlaySoundGeneral(NA_SE_SY_ERROR, &D_801333D4, 4, &D_801333E0, &D_801333E0, &D_801333E8);
         return;
     }
 }
 
-void Randomizer::ParseEntranceDataFile(const char* spoilerFileName, bool silent) {
-    std::ifstream spoilerFileStream(SohUtils::Sanitize(spoilerFileName));
-    if (!spoilerFileStream) {
-        return;
-    }
-
-    // set all the entrances to be 0 to indicate an unshuffled entrance
-    for (auto &entranceOveride : gSaveContext.entranceOverrides) {
-        entranceOveride.type = 0;
-        entranceOveride.index = 0;
-        entranceOveride.destination = 0;
-        entranceOveride.override = 0;
-        entranceOveride.overrideDestination = 0;
-    }
-
+static void ParseEntrancesJson(json& spoilerFileJson, SeedFileData& data) {
     try {
-        json spoilerFileJson;
-        spoilerFileStream >> spoilerFileJson;
         json EntrancesJson = spoilerFileJson["entrances"];
 
-        size_t i = 0;
-        for (auto it = EntrancesJson.begin(); it != EntrancesJson.end(); ++it, i++) {
+        for (auto it = EntrancesJson.begin(); it != EntrancesJson.end(); ++it) {
             json entranceJson = *it;
+            EntranceOverride& entrance = data.entranceOverrides.emplace_back();
 
             for (auto entranceIt = entranceJson.begin(); entranceIt != entranceJson.end(); ++entranceIt) {
                 if (entranceIt.key() == "type") {
-                    gSaveContext.entranceOverrides[i].type = entranceIt.value();
+                    entrance.type = entranceIt.value();
                 } else if (entranceIt.key() == "index") {
-                    gSaveContext.entranceOverrides[i].index = entranceIt.value();
+                    entrance.index = entranceIt.value();
                 } else if (entranceIt.key() == "destination") {
-                    gSaveContext.entranceOverrides[i].destination = entranceIt.value();
+                    entrance.destination = entranceIt.value();
                 } else if (entranceIt.key() == "override") {
-                    gSaveContext.entranceOverrides[i].override = entranceIt.value();
+                    entrance.override = entranceIt.value();
                 } else if (entranceIt.key() == "overrideDestination") {
-                    gSaveContext.entranceOverrides[i].overrideDestination = entranceIt.value();
+                    entrance.overrideDestination = entranceIt.value();
                 }
             }
         }
+    } catch (const std::exception& e) {
+        data.entranceOverrides.clear();
+    }
+}
+
+static void ParseSpoilerFileJson(std::istream& spoilerFileStream, SeedFileData& data) {
+    json spoilerFileJson;
+    try {
+        spoilerFileStream >> spoilerFileJson;
     } catch (const std::exception& e) {
         return;
     }
+
+    ParseSettingsJson(spoilerFileJson, data);
+    ParseHintsJson(spoilerFileJson, data);
+    ParseRequiredTrialsJson(spoilerFileJson, data);
+    ParseMasterQuestDungeonsJson(spoilerFileJson, data);
+    ParseItemLocationsJson(spoilerFileJson, data);
+    ParseEntrancesJson(spoilerFileJson, data);
+}
+
+template <typename Enum>
+static void AddNameTableToHash(std::vector<std::pair<std::string, int32_t>>& entries, char table,
+                               const std::unordered_map<std::string, Enum>& nameToEnum) {
+    for (auto& [name, value] : nameToEnum) {
+        entries.emplace_back(table + name, value);
+    }
+}
+
+// Seed files store the enums the spoiler log's names map to, so a seed file is only good for builds that map every
+// name the same way. This runs once the tables are filled, lookups of unknown names add them later on.
+static void HashSeedFileTables() {
+    std::vector<std::pair<std::string, int32_t>> entries;
+    AddNameTableToHash(entries, 'c', SpoilerfileCheckNameToEnum);
+    AddNameTableToHash(entries, 'g', SpoilerfileGetNameToEnum);
+    AddNameTableToHash(entries, 's', SpoilerfileSettingNameToEnum);
+    AddNameTableToHash(entries, 't', spoilerFileTrialToEnum);
+    std::sort(entries.begin(), entries.end());
+
+    // 64 bit FNV-1a
+    uint64_t hash = 0xCBF29CE484222325;
+    auto addBytes = [&hash](const void* data, size_t size) {
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ static_cast<const uint8_t*>(data)[i]) * 0x100000001B3;
+        }
+    };
+
+    // The build stands in for what no table covers: scene numbers, entrance indices and seed icons
+    addBytes(gGitCommitHash, strlen((const char*)gGitCommitHash));
+    int32_t maxValues[] = { RC_MAX, RG_MAX, RSK_MAX, HINT_TYPE_MAX, RAND_INF_MAX, RCAREA_INVALID };
+    addBytes(maxValues, sizeof(maxValues));
+    for (auto& [name, value] : entries) {
+        uint32_t size = name.size();
+        addBytes(&size, sizeof(size));
+        addBytes(name.data(), name.size());
+        addBytes(&value, sizeof(value));
+    }
+
+    sSeedFileTableHash = hash;
+}
+
+uint64_t SeedFile_GetTableHash() {
+    return sSeedFileTableHash;
+}
+
+void SeedFile_WriteFromSpoilerLog(const std::string& spoilerJson, const std::string& fileName) {
+    std::istringstream spoilerFileStream(spoilerJson);
+    SeedFileData data;
+    ParseSpoilerFileJson(spoilerFileStream, data);
+    SeedFile_Write(fileName, data);
+}
+
+// Reads the seed file next to the spoiler log when it's at least as new as the log, or parses the log otherwise
+static void ReadSpoilerFile(const std::string& fileName, std::istream& spoilerFileStream, SeedFileData& data) {
+    std::string seedFileName = SeedFile_GetPath(fileName);
+    std::error_code error;
+    auto spoilerFileTime = std::filesystem::last_write_time(fileName, error);
+    if (!error) {
+        auto seedFileTime = std::filesystem::last_write_time(seedFileName, error);
+        if (!error && seedFileTime >= spoilerFileTime && SeedFile_Read(seedFileName, data)) {
+            return;
+        }
+    }
+
+    data = {};
+    ParseSpoilerFileJson(spoilerFileStream, data);
+}
+
+// Loading a seed calls every Load* function with the same spoiler file, so the last one read is kept until the file
+// changes on disk
+static struct {
+    std::mutex mutex;
+    std::string fileName;
+    std::filesystem::file_time_type writeTime;
+    uintmax_t size = 0;
+    std::shared_ptr<const SeedFileData> data;
+} sSpoilerFileCache;
+
+// Returns nullptr when there's no spoiler log to read
+static std::shared_ptr<const SeedFileData> GetSpoilerFileData(const char* spoilerFileName) {
+    std::string fileName = SohUtils::Sanitize(spoilerFileName);
+    std::ifstream spoilerFileStream(fileName);
+    if (!spoilerFileStream) {
+        return nullptr;
+    }
+
+    // The size is checked too since some filesystems only keep the write time to the second
+    std::error_code timeError;
+    std::error_code sizeError;
+    auto writeTime = std::filesystem::last_write_time(fileName, timeError);
+    auto size = std::filesystem::file_size(fileName, sizeError);
+    bool cacheable = !timeError && !sizeError;
+
+    std::lock_guard<std::mutex> lock(sSpoilerFileCache.mutex);
+    if (cacheable && sSpoilerFileCache.data != nullptr && sSpoilerFileCache.fileName == fileName &&
+        sSpoilerFileCache.writeTime == writeTime && sSpoilerFileCache.size == size) {
+        return sSpoilerFileCache.data;
+    }
+
+    auto data = std::make_shared<SeedFileData>();
+    ReadSpoilerFile(fileName, spoilerFileStream, *data);
+    sSpoilerFileCache.fileName = fileName;
+    sSpoilerFileCache.writeTime = writeTime;
+    sSpoilerFileCache.size = size;
+    sSpoilerFileCache.data = cacheable ? data : nullptr;
+    return data;
+}
+
+void Randomizer::ParseRandomizerSettingsFile(const char* spoilerFileName) {
+    std::shared_ptr<const SeedFileData> data = GetSpoilerFileData(spoilerFileName);
+    if (data == nullptr) {
+        return;
+    }
+
+    // clear out existing settings
+    for(size_t i = 0; i < RSK_MAX; i++) {
+        gSaveContext.randoSettings[i].key = RSK_NONE;
+        gSaveContext.randoSettings[i].value = 0;
+    }
+
+    for (const SeedFileSetting& setting : data->settings) {
+        if (setting.key < 0 || setting.key >= RSK_MAX ||
+            (size_t)setting.key >= ARRAY_COUNT(gSaveContext.randoSettings)) {
+            continue;
+        }
+        gSaveContext.randoSettings[setting.key].key = setting.key;
+        gSaveContext.randoSettings[setting.key].value = setting.value;
+    }
+}
+
+void Randomizer::ParseHintLocationsFile(const char* spoilerFileName) {
+    std::shared_ptr<const SeedFileData> data = GetSpoilerFileData(spoilerFileName);
+    if (data == nullptr || !data->hintsParsed) {
+        return;
+    }
+
+    SohUtils::CopyStringToCharArray(gSaveContext.childAltarText, data->childAltarText,
+                                    ARRAY_COUNT(gSaveContext.childAltarText));
+    SohUtils::CopyStringToCharArray(gSaveContext.adultAltarText, data->adultAltarText,
+                                    ARRAY_COUNT(gSaveContext.adultAltarText));
+    for (size_t i = 0; i < ARRAY_COUNT(gSaveContext.rewardCheck); i++) {
+        gSaveContext.rewardCheck[i] = data->rewardCheck[i];
+    }
+
+    SohUtils::CopyStringToCharArray(gSaveContext.ganonHintText, data->ganonHintText,
+                                    ARRAY_COUNT(gSaveContext.ganonHintText));
+    gSaveContext.masterSwordHintCheck = data->masterSwordHintCheck;
+    SohUtils::CopyStringToCharArray(gSaveContext.ganonText, data->ganonText, ARRAY_COUNT(gSaveContext.ganonText));
+    SohUtils::CopyStringToCharArray(gSaveContext.dampeText, data->dampeText, ARRAY_COUNT(gSaveContext.dampeText));
+    gSaveContext.dampeCheck = data->dampeCheck;
+    SohUtils::CopyStringToCharArray(gSaveContext.gregHintText, data->gregHintText,
+                                    ARRAY_COUNT(gSaveContext.gregHintText));
+    gSaveContext.gregCheck = data->gregCheck;
+    SohUtils::CopyStringToCharArray(gSaveContext.sheikText, data->sheikText, ARRAY_COUNT(gSaveContext.sheikText));
+    gSaveContext.lightArrowHintCheck = data->lightArrowHintCheck;
+    SohUtils::CopyStringToCharArray(gSaveContext.sariaText, data->sariaText, ARRAY_COUNT(gSaveContext.sariaText));
+    gSaveContext.sariaCheck = data->sariaCheck;
+
+    SohUtils::CopyStringToCharArray(gSaveContext.warpMinuetText, data->warpMinuetText,
+                                    ARRAY_COUNT(gSaveContext.warpMinuetText));
+    SohUtils::CopyStringToCharArray(gSaveContext.warpBoleroText, data->warpBoleroText,
+                                    ARRAY_COUNT(gSaveContext.warpBoleroText));
+    SohUtils::CopyStringToCharArray(gSaveContext.warpSerenadeText, data->warpSerenadeText,
+                                    ARRAY_COUNT(gSaveContext.warpSerenadeText));
+    SohUtils::CopyStringToCharArray(gSaveContext.warpRequiemText, data->warpRequiemText,
+                                    ARRAY_COUNT(gSaveContext.warpRequiemText));
+    SohUtils::CopyStringToCharArray(gSaveContext.warpNocturneText, data->warpNocturneText,
+                                    ARRAY_COUNT(gSaveContext.warpNocturneText));
+    SohUtils::CopyStringToCharArray(gSaveContext.warpPreludeText, data->warpPreludeText,
+                                    ARRAY_COUNT(gSaveContext.warpPreludeText));
+
+    for (size_t index = 0; index < data->hints.size() && index < ARRAY_COUNT(gSaveContext.hintLocations); index++) {
+        const SeedFileHint& hint = data->hints[index];
+        gSaveContext.hintLocations[index].check = hint.check;
+        gSaveContext.hintLocations[index].hintedCheck = hint.hintedCheck;
+        gSaveContext.hintLocations[index].rGet = hint.rGet;
+        gSaveContext.hintLocations[index].type = hint.type;
+        gSaveContext.hintLocations[index].area = hint.area;
+        SohUtils::CopyStringToCharArray(gSaveContext.hintLocations[index].hintText, hint.hintText,
+                                        ARRAY_COUNT(gSaveContext.hintLocations[index].hintText));
+    }
+}
+
+void Randomizer::ParseRequiredTrialsFile(const char* spoilerFileName) {
+    std::shared_ptr<const SeedFileData> data = GetSpoilerFileData(spoilerFileName);
+    if (data == nullptr) {
+        return;
+    }
+
+    this->trialsRequired.clear();
+    for (RandomizerInf trial : data->requiredTrials) {
+        this->trialsRequired[trial] = true;
+    }
+}
+
+void Randomizer::ParseMasterQuestDungeonsFile(const char* spoilerFileName) {
+    std::shared_ptr<const SeedFileData> data = GetSpoilerFileData(spoilerFileName);
+    if (data == nullptr) {
+        return;
+    }
+
+    this->masterQuestDungeons.clear();
+    for (uint16_t scene : data->masterQuestDungeons) {
+        this->masterQuestDungeons.emplace(scene);
+    }
+}
+
+void Randomizer::ParseItemLocationsFile(const char* spoilerFileName, bool silent) {
+    std::shared_ptr<const SeedFileData> data = GetSpoilerFileData(spoilerFileName);
+    if (data == nullptr) {
+        return;
+    }
+
+    if (!data->itemLocationsParsed) {
+        Audio_PlaySoundGeneral(NA_SE_SY_ERROR, &D_801333D4, 4, &D_801333E0, &D_801333E0, &D_801333E8);
+        return;
+    }
+
+    for (size_t index = 0; index < data->seedIcons.size() && index < ARRAY_COUNT(gSaveContext.seedIcons); index++) {
+        gSaveContext.seedIcons[index] = data->seedIcons[index];
+    }
+
+    SohUtils::CopyStringToCharArray(gSaveContext.inputSeed, data->inputSeed, ARRAY_COUNT(gSaveContext.inputSeed));
+
+    gSaveContext.finalSeed = data->finalSeed;
+
+    for (const SeedFileItemLocation& location : data->itemLocations) {
+        if (location.check < 0 || (size_t)location.check >= ARRAY_COUNT(gSaveContext.itemLocations)) {
+            continue;
+        }
+        ItemLocationRando& itemLocation = gSaveContext.itemLocations[location.check];
+        if (location.hasItem) {
+            itemLocation.check = location.check;
+            itemLocation.get.rgID = location.rgID;
+        }
+        if (location.hasModel) {
+            itemLocation.get.fakeRgID = location.fakeRgID;
+        }
+        if (location.hasPrice) {
+            merchantPrices[itemLocation.check] = location.price;
+        }
+        if (location.hasTrickName) {
+            SohUtils::CopyStringToCharArray(itemLocation.get.trickName, location.trickName, MAX_TRICK_NAME_SIZE);
+        }
+    }
+
+    if(!silent) {
+        Audio_PlaySoundGeneral(NA_SE_SY_CORRECT_CHIME, &D_801333D4, 4, &D_801333E0, &D_801333E0, &D_801333E8);
+    }
+}
+
+void Randomizer::ParseEntranceDataFile(const char* spoilerFileName, bool silent) {
+    std::shared_ptr<const SeedFileData> data = GetSpoilerFileData(spoilerFileName);
+    if (data == nullptr) {
+        return;
+    }
+
+    // set all the entrances to be 0 to indicate an unshuffled entrance
+    for (auto &entranceOveride : gSaveContext.entranceOverrides) {
+        entranceOveride.type = 0;
+        entranceOveride.index = 0;
+        entranceOveride.destination = 0;
+        entranceOveride.override = 0;
+        entranceOveride.overrideDestination = 0;
+    }
+
+    for (size_t i = 0; i < data->entranceOverrides.size() && i < ARRAY_COUNT(gSaveContext.entranceOverrides); i++) {
+        gSaveContext.entranceOverrides[i] = data->entranceOverrides[i];
+    }
 }
 
 bool Randomizer::IsTrialRequired(RandomizerInf trial) {
@@ -3217,7 +3286,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 ImGui::PushItemWidth(-FLT_MIN);
 
                 // Forest
-                ImGui::Text("%s", Settings::OpenForest.GetName().c_str());
+                ImGui::Text("%s", settings->OpenForest.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Closed - Kokiri sword & shield are required to access "
                     "the Deku Tree, and completing the Deku Tree is required to "
@@ -3235,7 +3304,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Kakariko Gate
-                ImGui::Text("%s", Settings::OpenKakariko.GetName().c_str());
+                ImGui::Text("%s", settings->OpenKakariko.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Closed - The gate will remain closed until Zelda's letter "
                     "is shown to the guard.\n"
@@ -3248,7 +3317,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Door of Time
-                ImGui::Text("%s", Settings::OpenDoorOfTime.GetName().c_str());
+                ImGui::Text("%s", settings->OpenDoorOfTime.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Closed - The Ocarina of Time, the Song of Time and all "
                     "three spiritual stones are required to open the Door of Time.\n"
@@ -3263,7 +3332,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Zora's Fountain
-                ImGui::Text("%s", Settings::ZorasFountain.GetName().c_str());
+                ImGui::Text("%s", settings->ZorasFountain.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Closed - King Zora obstructs the way to Zora's Fountain. "
                     "Ruto's letter must be shown as child Link in order to move "
@@ -3294,7 +3363,7 @@ void RandomizerSettingsWindow::DrawElement() {
                     (CVarGetInteger(CVAR_RANDOMIZER_SETTING("ShuffleOcarinas"), RO_GENERIC_OFF) == RO_GENERIC_OFF)); // closed door of time with ocarina shuffle off
 
                 static const char* disableRandoStartingAgeText = "This option is disabled due to other options making the game unbeatable.";
-                ImGui::Text("%s", Settings::StartingAge.GetName().c_str());
+                ImGui::Text("%s", settings->StartingAge.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Choose which age Link will start as.\n\n"
                     "Starting as adult means you start with the Master Sword in your inventory.\n"
@@ -3783,7 +3852,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 ImGui::PushItemWidth(-FLT_MIN);
 
                 // Shuffle Songs
-                ImGui::Text("%s", Settings::ShuffleSongs.GetName().c_str());
+                ImGui::Text("%s", settings->ShuffleSongs.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Song locations - Songs will only appear at locations that normally teach songs.\n"
                     "\n"
@@ -3801,7 +3870,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Shuffle Tokens
-                ImGui::Text("%s", Settings::Tokensanity.GetName().c_str());
+                ImGui::Text("%s", settings->Tokensanity.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Shuffles Golden Skulltula Tokens into the item pool. This means "
                     "Golden Skulltulas can contain other items as well.\n"
@@ -3828,7 +3897,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 // Disabled when Start with Kokiri Sword is active
                 bool disableShuffleKokiriSword = CVarGetInteger(CVAR_RANDOMIZER_SETTING("StartingKokiriSword"), 0);
                 static const char* disableShuffleKokiriSwordText = "This option is disabled because \"Start with Kokiri Sword\" is enabled.";
-                UIWidgets::EnhancementCheckbox(Settings::ShuffleKokiriSword.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleKokiriSword"),
+                UIWidgets::EnhancementCheckbox(settings->ShuffleKokiriSword.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleKokiriSword"),
                                                 disableShuffleKokiriSword, disableShuffleKokiriSwordText);
                 UIWidgets::InsertHelpHoverText(
                     "Shuffles the Kokiri Sword into the item pool.\n"
@@ -3842,7 +3911,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 //RANDOTODO: Disable when Start with Master Sword is active
                 // bool disableShuffleMasterSword = CvarGetInteger(CVAR_RANDOMIZER_SETTING("StartingMasterSword"), 0);
                 // static const char* disableShuffleMasterSwordText = "This option is disabled because \"Start with Master Sword\" is enabled.";
-                UIWidgets::EnhancementCheckbox(Settings::ShuffleMasterSword.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleMasterSword"));
+                UIWidgets::EnhancementCheckbox(settings->ShuffleMasterSword.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleMasterSword"));
                 UIWidgets::InsertHelpHoverText(
                     "Shuffles the Master Sword into the item pool.\n"
                     "\n"
@@ -3856,7 +3925,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 // Disabled when Start with Ocarina is active
                 bool disableShuffleOcarinas = CVarGetInteger(CVAR_RANDOMIZER_SETTING("StartingOcarina"), 0);
                 static const char* disableShuffleOcarinasText = "This option is disabled because \"Start with Fairy Ocarina\" is enabled.";
-                UIWidgets::EnhancementCheckbox(Settings::ShuffleOcarinas.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleOcarinas"),
+                UIWidgets::EnhancementCheckbox(settings->ShuffleOcarinas.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleOcarinas"),
                                               disableShuffleOcarinas, disableShuffleOcarinasText);
                 UIWidgets::InsertHelpHoverText(
                     "Enabling this shuffles the Fairy Ocarina and the Ocarina of Time into the item pool.\n"
@@ -3870,7 +3939,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 // Disabled when Skip Child Zelda is active
                 bool disableShuffleWeirdEgg = CVarGetInteger(CVAR_RANDOMIZER_SETTING("SkipChildZelda"), 0);
                 static const char* disableShuffleWeirdEggText = "This option is disabled because \"Skip Child Zelda\" is enabled.";
-                UIWidgets::EnhancementCheckbox(Settings::ShuffleWeirdEgg.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleWeirdEgg"),
+                UIWidgets::EnhancementCheckbox(settings->ShuffleWeirdEgg.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleWeirdEgg"),
                                               disableShuffleWeirdEgg, disableShuffleWeirdEggText);
                 UIWidgets::InsertHelpHoverText(
                     "Shuffles the Weird Egg from Malon in to the item pool. Enabling "
@@ -3887,7 +3956,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Shuffle Gerudo Membership Card
-                UIWidgets::EnhancementCheckbox(Settings::ShuffleGerudoToken.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleGerudoToken"));
+                UIWidgets::EnhancementCheckbox(settings->ShuffleGerudoToken.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleGerudoToken"));
                 UIWidgets::InsertHelpHoverText(
                     "Shuffles the Gerudo Membership Card into the item pool.\n"
                     "\n"
@@ -3907,7 +3976,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 ImGui::PushItemWidth(-FLT_MIN);
 
                 // Shopsanity
-                ImGui::Text("%s", Settings::Shopsanity.GetName().c_str());
+                ImGui::Text("%s", settings->Shopsanity.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Off - All shop items will be the same as vanilla.\n"
                     "\n"
@@ -3925,7 +3994,7 @@ void RandomizerSettingsWindow::DrawElement() {
                     case RO_SHOPSANITY_ZERO_ITEMS: // no need to show it if there aren't shop slots in the pool
                         break;
                     default:
-                        ImGui::Text("%s", Settings::ShopsanityPrices.GetName().c_str());
+                        ImGui::Text("%s", settings->ShopsanityPrices.GetName().c_str());
                         UIWidgets::InsertHelpHoverText(
                             "Balanced - The default randomization. Shop prices for shopsanity items will range between 0 to 300 rupees, "
                             "with a bias towards values slightly below the middle of the range, in multiples of 5.\n "
@@ -3933,7 +4002,7 @@ void RandomizerSettingsWindow::DrawElement() {
                             "X Wallet - Randomized between 5 and the wallet's max size, in multiples of 5"
                         );
                         UIWidgets::EnhancementCombobox(CVAR_RANDOMIZER_SETTING("ShopsanityPrices"), randoShopsanityPrices, RO_SHOPSANITY_PRICE_BALANCED);
-                        UIWidgets::EnhancementCheckbox(Settings::ShopsanityPricesAffordable.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShopsanityPricesAffordable"),
+                        UIWidgets::EnhancementCheckbox(settings->ShopsanityPricesAffordable.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShopsanityPricesAffordable"),
                             CVarGetInteger(CVAR_RANDOMIZER_SETTING("ShopsanityPrices"), RO_SHOPSANITY_PRICE_BALANCED) == RO_SHOPSANITY_PRICE_BALANCED,
                             "This can only apply to a wallet range.");
                         UIWidgets::InsertHelpHoverText("Random selection between the selected wallet tier's affordable price and the affordable prices of the preceding wallet tiers.\n\n"
@@ -3944,7 +4013,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Shuffle Scrubs
-                ImGui::Text("%s", Settings::Scrubsanity.GetName().c_str());
+                ImGui::Text("%s", settings->Scrubsanity.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Off - Scrubs will not be shuffled. The 3 Scrubs that give one-time items in the vanilla game "
                     "(PoH, Deku Nut capacity, and Deku Stick capacity) will have random items.\n"
@@ -3959,12 +4028,12 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Shuffle Cows
-                UIWidgets::EnhancementCheckbox(Settings::ShuffleCows.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleCows"));
+                UIWidgets::EnhancementCheckbox(settings->ShuffleCows.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleCows"));
                 UIWidgets::InsertHelpHoverText("Cows give a randomized item from the pool upon performing Epona's Song in front of them.");
 
                 UIWidgets::PaddedSeparator();
 
-                UIWidgets::EnhancementCheckbox(Settings::ShuffleMagicBeans.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleBeans"));
+                UIWidgets::EnhancementCheckbox(settings->ShuffleMagicBeans.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleBeans"));
                 UIWidgets::InsertHelpHoverText(
                     "Enabling this adds a pack of 10 beans to the item pool and changes the Magic Bean "
                     "Salesman to sell a random item at a price of 60 rupees."
@@ -3973,7 +4042,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Shuffle Merchants
-                ImGui::Text("%s", Settings::ShuffleMerchants.GetName().c_str());
+                ImGui::Text("%s", settings->ShuffleMerchants.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Enabling this changes Medigoron, Granny and the Carpet Salesman to sell a random item "
                     "once at a high price (100 for Granny, 200 for the others).\n"
@@ -3990,7 +4059,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Shuffle Frog Song Rupees
-                UIWidgets::EnhancementCheckbox(Settings::ShuffleFrogSongRupees.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleFrogSongRupees"));
+                UIWidgets::EnhancementCheckbox(settings->ShuffleFrogSongRupees.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleFrogSongRupees"));
                 UIWidgets::InsertHelpHoverText(
                     "Shuffles 5 Purple Rupees into to the item pool, and allows\n"
                     "you to earn items by playing songs at the Frog Choir.\n"
@@ -4002,7 +4071,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Shuffle Adult Trade Quest
-                UIWidgets::EnhancementCheckbox(Settings::ShuffleAdultTradeQuest.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleAdultTrade"));
+                UIWidgets::EnhancementCheckbox(settings->ShuffleAdultTradeQuest.GetName().c_str(), CVAR_RANDOMIZER_SETTING("ShuffleAdultTrade"));
                 UIWidgets::InsertHelpHoverText(
                     "Adds all of the adult trade quest items into the pool, each of which "
                     "can be traded for a unique reward.\n"
@@ -4021,7 +4090,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 bool forceEnable100GSShuffle =
                     (CVarGetInteger(CVAR_RANDOMIZER_SETTING("ShuffleGanonBossKey"), RO_GANON_BOSS_KEY_VANILLA) == RO_GANON_BOSS_KEY_KAK_TOKENS);
                 static const char* disable100GSRewardText = "This option is forcefully enabled because \"Ganon's Boss Key\" is set to \"100 GS Reward.\"";
-                UIWidgets::EnhancementCheckbox(Settings::Shuffle100GSReward.GetName().c_str(), CVAR_RANDOMIZER_SETTING("Shuffle100GSReward"),
+                UIWidgets::EnhancementCheckbox(settings->Shuffle100GSReward.GetName().c_str(), CVAR_RANDOMIZER_SETTING("Shuffle100GSReward"),
                     forceEnable100GSShuffle, disable100GSRewardText, UIWidgets::CheckboxGraphics::Checkmark);
                 UIWidgets::InsertHelpHoverText(
                     "Shuffle the item the cursed rich man in the House of Skulltula gives when you "
@@ -4042,7 +4111,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 ImGui::PushItemWidth(-FLT_MIN);
 
                 // Shuffle Dungeon Rewards
-                ImGui::Text("%s", Settings::ShuffleRewards.GetName().c_str());
+                ImGui::Text("%s", settings->ShuffleRewards.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Shuffles the location of spiritual stones and medallions.\n"
                     "\n"
@@ -4060,7 +4129,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Maps & Compasses
-                ImGui::Text("%s", Settings::MapsAndCompasses.GetName().c_str());
+                ImGui::Text("%s", settings->MapsAndCompasses.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Start with - You will start with Maps & Compasses from all dungeons.\n"
                     "\n"
@@ -4079,7 +4148,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Keysanity
-                ImGui::Text("%s", Settings::Keysanity.GetName().c_str());
+                ImGui::Text("%s", settings->Keysanity.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Start with - You will start with all Small Keys from all dungeons.\n"
                     "\n"
@@ -4100,7 +4169,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                  // Key Rings
-                ImGui::Text("%s", Settings::KeyRings.GetName().c_str());
+                ImGui::Text("%s", settings->KeyRings.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Keyrings will replace all small keys from a particular dungeon with a single keyring that awards all keys for it's associated dungeon\n"
                     "\n"
@@ -4151,7 +4220,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Gerudo Keys
-                ImGui::Text("%s", Settings::GerudoKeys.GetName().c_str());
+                ImGui::Text("%s", settings->GerudoKeys.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Vanilla - Thieve's Hideout Keys will appear in their vanilla locations.\n"
                     "\n"
@@ -4166,7 +4235,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Boss Keysanity
-                ImGui::Text("%s", Settings::BossKeysanity.GetName().c_str());
+                ImGui::Text("%s", settings->BossKeysanity.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Start with - You will start with Boss keys from all dungeons.\n"
                     "\n"
@@ -4185,7 +4254,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Ganon's Boss Key
-                ImGui::Text("%s", Settings::GanonsBossKey.GetName().c_str());
+                ImGui::Text("%s", settings->GanonsBossKey.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Vanilla - Ganon's Boss Key will appear in the vanilla location.\n"
                     "\n"
@@ -4389,7 +4458,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 // Disabled when Skip Child Zelda is active
                 bool disableChildStealth = CVarGetInteger(CVAR_RANDOMIZER_SETTING("SkipChildZelda"), 0);
                 static const char* disableChildStealthText = "This option is disabled because \"Skip Child Zelda\" is enabled";
-                UIWidgets::EnhancementCheckbox(Settings::SkipChildStealth.GetName().c_str(), CVAR_RANDOMIZER_SETTING("SkipChildStealth"), disableChildStealth, disableChildStealthText);
+                UIWidgets::EnhancementCheckbox(settings->SkipChildStealth.GetName().c_str(), CVAR_RANDOMIZER_SETTING("SkipChildStealth"), disableChildStealth, disableChildStealthText);
                 UIWidgets::InsertHelpHoverText("The crawlspace into Hyrule Castle goes straight to Zelda, skipping the guards.");
 
                 UIWidgets::PaddedSeparator();
@@ -4402,25 +4471,25 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Skip Epona race
-                UIWidgets::EnhancementCheckbox(Settings::SkipEponaRace.GetName().c_str(), CVAR_RANDOMIZER_SETTING("SkipEponaRace"));
+                UIWidgets::EnhancementCheckbox(settings->SkipEponaRace.GetName().c_str(), CVAR_RANDOMIZER_SETTING("SkipEponaRace"));
                 UIWidgets::InsertHelpHoverText("Epona can be summoned with Epona's Song without needing to race Ingo.");
 
                 UIWidgets::PaddedSeparator();
 
                 // Skip tower escape
-                UIWidgets::EnhancementCheckbox(Settings::SkipTowerEscape.GetName().c_str(), CVAR_RANDOMIZER_SETTING("SkipTowerEscape"));
+                UIWidgets::EnhancementCheckbox(settings->SkipTowerEscape.GetName().c_str(), CVAR_RANDOMIZER_SETTING("SkipTowerEscape"));
                 UIWidgets::InsertHelpHoverText("The tower escape sequence between Ganondorf and Ganon will be skipped.");
 
                 UIWidgets::PaddedSeparator();
 
                 // Complete mask quest
-                UIWidgets::EnhancementCheckbox(Settings::CompleteMaskQuest.GetName().c_str(), CVAR_RANDOMIZER_SETTING("CompleteMaskQuest"));
+                UIWidgets::EnhancementCheckbox(settings->CompleteMaskQuest.GetName().c_str(), CVAR_RANDOMIZER_SETTING("CompleteMaskQuest"));
                 UIWidgets::InsertHelpHoverText("Once the happy mask shop is opened, all masks will be available to be borrowed.");
 
                 UIWidgets::PaddedSeparator();
 
                 // Skip Scarecrow Song
-                UIWidgets::EnhancementCheckbox(Settings::FreeScarecrow.GetName().c_str(), CVAR_RANDOMIZER_SETTING("SkipScarecrowsSong"));
+                UIWidgets::EnhancementCheckbox(settings->FreeScarecrow.GetName().c_str(), CVAR_RANDOMIZER_SETTING("SkipScarecrowsSong"));
                 UIWidgets::InsertHelpHoverText(
                     "Start with the ability to summon Pierre the scarecrow. Pulling out an ocarina in the usual locations will automatically summon him."
                 );
@@ -4436,7 +4505,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 ImGui::PushItemWidth(-FLT_MIN);
 
                 // Item Pool Settings
-                ImGui::Text("%s", Settings::ItemPoolValue.GetName().c_str());
+                ImGui::Text("%s", settings->ItemPoolValue.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Sets how many major items appear in the item pool.\n"
                     "\n"
@@ -4452,7 +4521,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Ice Traps
-                ImGui::Text("%s", Settings::IceTrapValue.GetName().c_str());
+                ImGui::Text("%s", settings->IceTrapValue.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Sets how many items are replaced by ice traps.\n"
                     "\n"
@@ -4472,7 +4541,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Gossip Stone Hints
-                ImGui::Text("%s", Settings::GossipStoneHints.GetName().c_str());
+                ImGui::Text("%s", settings->GossipStoneHints.GetName().c_str());
                 UIWidgets::InsertHelpHoverText(
                     "Allows Gossip Stones to provide hints on item locations. Hints mentioning "
                     "\"Way of the Hero\" indicate a location that holds an item required to beat "
@@ -4490,7 +4559,7 @@ void RandomizerSettingsWindow::DrawElement() {
                     // Hint Clarity
                     UIWidgets::Spacer(0);
                     ImGui::Indent();
-                    ImGui::Text("%s", Settings::ClearerHints.GetName().c_str());
+                    ImGui::Text("%s", settings->ClearerHints.GetName().c_str());
                     UIWidgets::InsertHelpHoverText(
                         "Sets the difficulty of hints.\n"
                         "\n"
@@ -4507,7 +4576,7 @@ void RandomizerSettingsWindow::DrawElement() {
 
                     // Hint Distribution
                     UIWidgets::Spacer(0);
-                    ImGui::Text("%s", Settings::HintDistribution.GetName().c_str());
+                    ImGui::Text("%s", settings->HintDistribution.GetName().c_str());
                     UIWidgets::InsertHelpHoverText(
                         "Sets how many hints will be useful.\n"
                         "\n"
@@ -4578,7 +4647,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Bombchus in Logic
-                UIWidgets::EnhancementCheckbox(Settings::BombchusInLogic.GetName().c_str(), CVAR_RANDOMIZER_SETTING("BombchusInLogic"));
+                UIWidgets::EnhancementCheckbox(settings->BombchusInLogic.GetName().c_str(), CVAR_RANDOMIZER_SETTING("BombchusInLogic"));
                 UIWidgets::InsertHelpHoverText(
                     "Bombchus are properly considered in logic.\n"
                     "\n"
@@ -4788,7 +4857,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::EnhancementCombobox(CVAR_RANDOMIZER_SETTING("LogicRules"), randoLogicRules, RO_LOGIC_GLITCHLESS);
                 if (CVarGetInteger(CVAR_RANDOMIZER_SETTING("LogicRules"), RO_LOGIC_GLITCHLESS) == RO_LOGIC_GLITCHLESS) {
                     ImGui::SameLine();
-                    UIWidgets::EnhancementCheckbox(Settings::LocationsReachable.GetName().c_str(), CVAR_RANDOMIZER_SETTING("AllLocationsReachable"), false, "", UIWidgets::CheckboxGraphics::Cross, RO_GENERIC_ON);
+                    UIWidgets::EnhancementCheckbox(settings->LocationsReachable.GetName().c_str(), CVAR_RANDOMIZER_SETTING("AllLocationsReachable"), false, "", UIWidgets::CheckboxGraphics::Cross, RO_GENERIC_ON);
                     UIWidgets::InsertHelpHoverText(
                         "When this options is enabled, the randomizer will "
                         "guarantee that every item is obtainable and every "
@@ -4805,7 +4874,7 @@ void RandomizerSettingsWindow::DrawElement() {
                 UIWidgets::PaddedSeparator();
 
                 // Enable Glitch-Useful Cutscenes
-                UIWidgets::EnhancementCheckbox(Settings::EnableGlitchCutscenes.GetName().c_str(), CVAR_RANDOMIZER_SETTING("EnableGlitchCutscenes"));
+                UIWidgets::EnhancementCheckbox(settings->EnableGlitchCutscenes.GetName().c_str(), CVAR_RANDOMIZER_SETTING("EnableGlitchCutscenes"));
                 UIWidgets::InsertHelpHoverText(
                     "The cutscenes of the Poes in Forest Temple and Darunia in Fire Temple will not be skipped. "
                     "These cutscenes are only useful for glitched gameplay and can be safely skipped otherwise.");
@@ -5218,14 +5287,14 @@ void RandomizerSettingsWindow::DrawElement() {
                     CVarGetInteger(CVAR_RANDOMIZER_SETTING("ShuffleDungeonReward"), RO_DUNGEON_REWARDS_END_OF_DUNGEON) == RO_DUNGEON_REWARDS_END_OF_DUNGEON ||
                     CVarGetInteger(CVAR_RANDOMIZER_SETTING("LogicRules"), RO_LOGIC_GLITCHLESS) == RO_LOGIC_VANILLA
                 );
-                ImGui::Text("%s", Settings::LinksPocketItem.GetName().c_str());
+                ImGui::Text("%s", settings->LinksPocketItem.GetName().c_str());
                 UIWidgets::EnhancementCombobox(CVAR_RANDOMIZER_SETTING("LinksPocket"), randoLinksPocket, RO_LINKS_POCKET_DUNGEON_REWARD);
                 UIWidgets::PaddedSeparator();
                 ImGui::EndDisabled();
 
-                UIWidgets::EnhancementCheckbox(Settings::StartingKokiriSword.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingKokiriSword"));
+                UIWidgets::EnhancementCheckbox(settings->StartingKokiriSword.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingKokiriSword"));
                 UIWidgets::PaddedSeparator();
-                UIWidgets::EnhancementCheckbox(Settings::StartingDekuShield.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingDekuShield"));
+                UIWidgets::EnhancementCheckbox(settings->StartingDekuShield.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingDekuShield"));
 
                 UIWidgets::PaddedSeparator();
 
@@ -5237,10 +5306,10 @@ void RandomizerSettingsWindow::DrawElement() {
                 ImGui::BeginChild("ChildStartingItems", ImVec2(0, -8));
 
                 ImGui::BeginDisabled(CVarGetInteger(CVAR_RANDOMIZER_SETTING("LogicRules"), RO_LOGIC_GLITCHLESS) == RO_LOGIC_VANILLA);
-                UIWidgets::EnhancementCheckbox(Settings::StartingOcarina.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingOcarina"));
+                UIWidgets::EnhancementCheckbox(settings->StartingOcarina.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingOcarina"));
                 UIWidgets::PaddedSeparator();
                 ImGui::EndDisabled();
-                UIWidgets::EnhancementCheckbox(Settings::StartingConsumables.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingConsumables"));
+                UIWidgets::EnhancementCheckbox(settings->StartingConsumables.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingConsumables"));
                 UIWidgets::PaddedSeparator();
                 UIWidgets::EnhancementSliderInt("Gold Skulltula Tokens: %d", "##RandoStartingSkulltulaToken", CVAR_RANDOMIZER_SETTING("StartingSkulltulaToken"), 0, 100, "", 0);
                 UIWidgets::PaddedSeparator();
@@ -5251,22 +5320,22 @@ void RandomizerSettingsWindow::DrawElement() {
                 ImGui::TableNextColumn();
                 window->DC.CurrLineTextBaseOffset = 0.0f;
                 ImGui::BeginChild("ChildStartingSongs", ImVec2(0, -8));
-                UIWidgets::EnhancementCheckbox(Settings::StartingZeldasLullaby.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingZeldasLullaby"));
-                UIWidgets::EnhancementCheckbox(Settings::StartingEponasSong.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingEponasSong"));
-                UIWidgets::EnhancementCheckbox(Settings::StartingSariasSong.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingSariasSong"));
-                UIWidgets::EnhancementCheckbox(Settings::StartingSunsSong.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingSunsSong"));
-                UIWidgets::EnhancementCheckbox(Settings::StartingSongOfTime.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingSongOfTime"));
-                UIWidgets::EnhancementCheckbox(Settings::StartingSongOfStorms.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingSongOfStorms"));
+                UIWidgets::EnhancementCheckbox(settings->StartingZeldasLullaby.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingZeldasLullaby"));
+                UIWidgets::EnhancementCheckbox(settings->StartingEponasSong.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingEponasSong"));
+                UIWidgets::EnhancementCheckbox(settings->StartingSariasSong.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingSariasSong"));
+                UIWidgets::EnhancementCheckbox(settings->StartingSunsSong.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingSunsSong"));
+                UIWidgets::EnhancementCheckbox(settings->StartingSongOfTime.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingSongOfTime"));
+                UIWidgets::EnhancementCheckbox(settings->StartingSongOfStorms.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingSongOfStorms"));
                 UIWidgets::PaddedSeparator();
 
                 ImGui::Text("Warp Songs");
                 UIWidgets::PaddedSeparator();
-                UIWidgets::EnhancementCheckbox(Settings::StartingMinuetOfForest.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingMinuetOfForest"));
-                UIWidgets::EnhancementCheckbox(Settings::StartingBoleroOfFire.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingBoleroOfFire"));
-                UIWidgets::EnhancementCheckbox(Settings::StartingSerenadeOfWater.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingSerenadeOfWater"));
-                UIWidgets::EnhancementCheckbox(Settings::StartingRequiemOfSpirit.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingRequiemOfSpirit"));
-                UIWidgets::EnhancementCheckbox(Settings::StartingNocturneOfShadow.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingNocturneOfShadow"));
-                UIWidgets::EnhancementCheckbox(Settings::StartingPreludeOfLight.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingPreludeOfLight"));
+                UIWidgets::EnhancementCheckbox(settings->StartingMinuetOfForest.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingMinuetOfForest"));
+                UIWidgets::EnhancementCheckbox(settings->StartingBoleroOfFire.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingBoleroOfFire"));
+                UIWidgets::EnhancementCheckbox(settings->StartingSerenadeOfWater.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingSerenadeOfWater"));
+                UIWidgets::EnhancementCheckbox(settings->StartingRequiemOfSpirit.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingRequiemOfSpirit"));
+                UIWidgets::EnhancementCheckbox(settings->StartingNocturneOfShadow.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingNocturneOfShadow"));
+                UIWidgets::EnhancementCheckbox(settings->StartingPreludeOfLight.GetName().c_str(), CVAR_RANDOMIZER_SETTING("StartingPreludeOfLight"));
                 UIWidgets::PaddedSeparator();
 
                 ImGui::EndChild();
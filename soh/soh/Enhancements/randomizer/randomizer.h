@@ -39,7 +39,6 @@ class Randomizer {
     void ParseItemLocationsFile(const char* spoilerFileName, bool silent);
     void ParseEntranceDataFile(const char* spoilerFileName, bool silent);
     bool IsItemVanilla(RandomizerGet randoGet);
-    int16_t GetVanillaMerchantPrice(RandomizerCheck check);
 
   public:
     Randomizer();
@@ -61,6 +60,7 @@ class Randomizer {
     std::unordered_map<RandomizerGet, std::array<std::string, 3>> EnumToSpoilerfileGetName;
 
     static Sprite* GetSeedTexture(uint8_t index);
+    static int16_t GetVanillaMerchantPrice(RandomizerCheck check);
     s16 GetItemModelFromId(s16 itemId);
     s32 GetItemIDFromGetItemID(s32 getItemId);
     bool SpoilerFileExists(const char* spoilerFileName);
@@ -8,6 +8,7 @@
 #include <string>
 #include <vector>
 #include <set>
+#include <unordered_map>
 #include <libultraship/libultraship.h>
 #include "3drando/item_location.hpp"
 #include "soh/Enhancements/game-interactor/GameInteractor.h"
@@ -121,6 +122,8 @@ std::vector<uint32_t> spoilingEntrances = {
 };
 
 std::map<RandomizerCheckArea, std::vector<RandomizerCheckObject>> checksByArea;
+// Checks keyed by the flag that collects them, in RandomizerCheck order, so the flag hooks don't scan every check
+std::unordered_map<uint64_t, std::vector<RandomizerCheckObject>> checksByFlag;
 bool areasFullyChecked[RCAREA_INVALID];
 u32 areasSpoiled = 0;
 bool showVOrMQ;
@@ -666,6 +669,53 @@ void CheckTrackerItemReceive(GetItemEntry giEntry) {
     }
 }
 
+uint64_t FlagCheckKey(SpoilerCollectionCheckType type, int16_t sceneNum, int32_t flag) {
+    return (static_cast<uint64_t>(type) << 48) | (static_cast<uint64_t>(static_cast<uint16_t>(sceneNum)) << 32) |
+           static_cast<uint32_t>(flag);
+}
+
+void TrySetChecksByFlag() {
+    if (!checksByFlag.empty()) {
+        return;
+    }
+    for (auto& [rc, rcObj] : RandomizerCheckObjects::GetAllRCObjects()) {
+        SpoilerCollectionCheck scCheck = Location(rc)->GetCollectionCheck();
+        uint64_t key;
+        switch (scCheck.type) {
+            case SpoilerCollectionCheckType::SPOILER_CHK_CHEST:
+            case SpoilerCollectionCheckType::SPOILER_CHK_COLLECTABLE:
+                key = FlagCheckKey(scCheck.type, scCheck.scene, scCheck.flag);
+                break;
+            case SpoilerCollectionCheckType::SPOILER_CHK_GOLD_SKULLTULA:
+                // Compared as the 16 bit flag the token sets
+                key = FlagCheckKey(scCheck.type, 0, static_cast<int16_t>(rcObj.actorParams));
+                break;
+            case SpoilerCollectionCheckType::SPOILER_CHK_EVENT_CHK_INF:
+            case SpoilerCollectionCheckType::SPOILER_CHK_ITEM_GET_INF:
+                key = FlagCheckKey(scCheck.type, 0, scCheck.flag);
+                break;
+            case SpoilerCollectionCheckType::SPOILER_CHK_MERCHANT:
+            case SpoilerCollectionCheckType::SPOILER_CHK_SHOP_ITEM:
+            case SpoilerCollectionCheckType::SPOILER_CHK_COW:
+            case SpoilerCollectionCheckType::SPOILER_CHK_SCRUB:
+            case SpoilerCollectionCheckType::SPOILER_CHK_MASTER_SWORD:
+            case SpoilerCollectionCheckType::SPOILER_CHK_RANDOMIZER_INF:
+                key = FlagCheckKey(SpoilerCollectionCheckType::SPOILER_CHK_RANDOMIZER_INF, 0,
+                                   OTRGlobals::Instance->gRandomizer->GetRandomizerInfFromCheck(rc));
+                break;
+            default:
+                continue;
+        }
+        checksByFlag[key].push_back(rcObj);
+    }
+}
+
+const std::vector<RandomizerCheckObject>* GetChecksByFlag(SpoilerCollectionCheckType type, int16_t sceneNum, int32_t flag) {
+    TrySetChecksByFlag();
+    auto it = checksByFlag.find(FlagCheckKey(type, sceneNum, flag));
+    return it != checksByFlag.end() ? &it->second : nullptr;
+}
+
 void CheckTrackerSceneFlagSet(int16_t sceneNum, int16_t flagType, int32_t flag) {
     if (flagType != FLAG_SCENE_TREASURE && flagType != FLAG_SCENE_COLLECTIBLE) {
         return;
@@ -674,16 +724,17 @@ void CheckTrackerSceneFlagSet(int16_t sceneNum, int16_t flagType, int32_t flag)
         SetCheckCollected(RC_GRAVEYARD_DAMPE_GRAVEDIGGING_TOUR);
         return;
     }
-    for (auto [rc, rcObj] : RandomizerCheckObjects::GetAllRCObjects()) {
+    SpoilerCollectionCheckType checkMatchType = flagType == FLAG_SCENE_TREASURE ? SpoilerCollectionCheckType::SPOILER_CHK_CHEST : SpoilerCollectionCheckType::SPOILER_CHK_COLLECTABLE;
+    auto checks = GetChecksByFlag(checkMatchType, sceneNum, flag);
+    if (checks == nullptr) {
+        return;
+    }
+    for (auto& rcObj : *checks) {
         if (!IsVisibleInCheckTracker(rcObj)) {
             continue;
         }
-        SpoilerCollectionCheckType checkMatchType = flagType == FLAG_SCENE_TREASURE ? SpoilerCollectionCheckType::SPOILER_CHK_CHEST : SpoilerCollectionCheckType::SPOILER_CHK_COLLECTABLE;
-        SpoilerCollectionCheck scCheck = Location(rc)->GetCollectionCheck();
-        if (scCheck.scene == sceneNum && scCheck.flag == flag && scCheck.type == checkMatchType) {
-            SetCheckCollected(rc);
-            return;
-        }
+        SetCheckCollected(rcObj.rc);
+        return;
     }
 }
 
@@ -751,7 +802,11 @@ void CheckTrackerFlagSet(int16_t flagType, int32_t flag) {
     if (checkMatchType == SpoilerCollectionCheckType::SPOILER_CHK_NONE) {
         return;
     }
-    for (auto [rc, rcObj] : RandomizerCheckObjects::GetAllRCObjects()) {
+    auto checks = GetChecksByFlag(checkMatchType, 0, flag);
+    if (checks == nullptr) {
+        return;
+    }
+    for (auto& rcObj : *checks) {
         if ((!IS_RANDO && ((rcObj.vOrMQ == RCVORMQ_MQ && !IS_MASTER_QUEST) ||
                            (rcObj.vOrMQ == RCVORMQ_VANILLA && IS_MASTER_QUEST))) ||
             (IS_RANDO && ((OTRGlobals::Instance->gRandomizer->masterQuestDungeons.contains(rcObj.sceneId) &&
@@ -760,29 +815,8 @@ void CheckTrackerFlagSet(int16_t flagType, int32_t flag) {
                                 rcObj.vOrMQ == RCVORMQ_MQ))) {
             continue;
         }
-        SpoilerCollectionCheck scCheck = Location(rc)->GetCollectionCheck();
-        SpoilerCollectionCheckType scCheckType = scCheck.type;
-        if (checkMatchType == SpoilerCollectionCheckType::SPOILER_CHK_RANDOMIZER_INF &&
-              (scCheckType == SpoilerCollectionCheckType::SPOILER_CHK_MERCHANT ||
-               scCheckType == SpoilerCollectionCheckType::SPOILER_CHK_SHOP_ITEM ||
-               scCheckType == SpoilerCollectionCheckType::SPOILER_CHK_COW ||
-               scCheckType == SpoilerCollectionCheckType::SPOILER_CHK_SCRUB ||
-               scCheckType == SpoilerCollectionCheckType::SPOILER_CHK_MASTER_SWORD ||
-               scCheckType == SpoilerCollectionCheckType::SPOILER_CHK_RANDOMIZER_INF)) {
-            if (flag == OTRGlobals::Instance->gRandomizer->GetRandomizerInfFromCheck(rc)) {
-                SetCheckCollected(rc);
-                return;
-            }
-            continue;
-        }
-        int16_t checkFlag = scCheck.flag;
-        if (checkMatchType == SpoilerCollectionCheckType::SPOILER_CHK_GOLD_SKULLTULA) {
-            checkFlag = rcObj.actorParams;
-        }
-        if (checkFlag == flag && scCheck.type == checkMatchType) {
-            SetCheckCollected(rc);
-            return;
-        }
+        SetCheckCollected(rcObj.rc);
+        return;
     }
 }
 
@@ -0,0 +1,286 @@
+#include "randomizer_seed_file.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <cstring>
+#include <type_traits>
+
+// Bump when the layout changes, older seed files are then ignored in favour of their spoiler logs
+#define SEED_FILE_MAGIC 0x44534853 // "SHSD"
+#define SEED_FILE_VERSION 2
+
+std::string SeedFile_GetPath(const std::string& spoilerFileName) {
+    return std::filesystem::path(spoilerFileName).replace_extension(SEED_FILE_EXTENSION).string();
+}
+
+namespace {
+
+// Values are written in the byte order of the machine that generated the seed, the magic number catches files
+// copied to a machine with the other byte order
+class SeedFileWriter {
+  public:
+    template <typename T> void Write(T value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+    }
+
+    void Write(const std::string& value) {
+        Write<uint32_t>(value.size());
+        buffer.insert(buffer.end(), value.begin(), value.end());
+    }
+
+    std::vector<char> buffer;
+};
+
+class SeedFileReader {
+  public:
+    SeedFileReader(const std::vector<char>& buffer) : data(buffer.data()), remaining(buffer.size()) {
+    }
+
+    template <typename T> T Read() {
+        T value{};
+        if (remaining < sizeof(T)) {
+            failed = true;
+            return value;
+        }
+        memcpy(&value, data, sizeof(T));
+        data += sizeof(T);
+        remaining -= sizeof(T);
+        return value;
+    }
+
+    std::string ReadString() {
+        uint32_t size = Read<uint32_t>();
+        if (remaining < size) {
+            failed = true;
+            return "";
+        }
+        std::string value(data, size);
+        data += size;
+        remaining -= size;
+        return value;
+    }
+
+    // Enums are written as 32 bit values, anything outside [0, max) fails the read
+    template <typename Enum> Enum ReadEnum(int32_t max) {
+        int32_t value = Read<int32_t>();
+        if (value < 0 || value >= max) {
+            failed = true;
+            return static_cast<Enum>(0);
+        }
+        return static_cast<Enum>(value);
+    }
+
+    // Element counts are checked against what's left so a corrupt count can't make us allocate gigabytes
+    uint32_t ReadCount(size_t minElementSize) {
+        uint32_t count = Read<uint32_t>();
+        if (count > remaining / minElementSize) {
+            failed = true;
+            return 0;
+        }
+        return count;
+    }
+
+    const char* data;
+    size_t remaining;
+    bool failed = false;
+};
+
+} // namespace
+
+bool SeedFile_Write(const std::string& fileName, const SeedFileData& data) {
+    SeedFileWriter writer;
+    writer.Write<uint32_t>(SEED_FILE_MAGIC);
+    writer.Write<uint32_t>(SEED_FILE_VERSION);
+    writer.Write<uint64_t>(SeedFile_GetTableHash());
+
+    writer.Write<uint8_t>(data.hintsParsed);
+    writer.Write<uint8_t>(data.itemLocationsParsed);
+
+    writer.Write<uint32_t>(data.settings.size());
+    for (const SeedFileSetting& setting : data.settings) {
+        writer.Write<int32_t>(setting.key);
+        writer.Write<uint8_t>(setting.value);
+    }
+
+    writer.Write(data.childAltarText);
+    writer.Write(data.adultAltarText);
+    writer.Write(data.ganonHintText);
+    writer.Write(data.ganonText);
+    writer.Write(data.dampeText);
+    writer.Write(data.gregHintText);
+    writer.Write(data.sheikText);
+    writer.Write(data.sariaText);
+    writer.Write(data.warpMinuetText);
+    writer.Write(data.warpBoleroText);
+    writer.Write(data.warpSerenadeText);
+    writer.Write(data.warpRequiemText);
+    writer.Write(data.warpNocturneText);
+    writer.Write(data.warpPreludeText);
+    for (RandomizerCheck check : data.rewardCheck) {
+        writer.Write<int32_t>(check);
+    }
+    writer.Write<int32_t>(data.masterSwordHintCheck);
+    writer.Write<int32_t>(data.dampeCheck);
+    writer.Write<int32_t>(data.gregCheck);
+    writer.Write<int32_t>(data.lightArrowHintCheck);
+    writer.Write<int32_t>(data.sariaCheck);
+    writer.Write<uint32_t>(data.hints.size());
+    for (const SeedFileHint& hint : data.hints) {
+        writer.Write<int32_t>(hint.check);
+        writer.Write<int32_t>(hint.hintedCheck);
+        writer.Write<int32_t>(hint.rGet);
+        writer.Write<int32_t>(hint.area);
+        writer.Write<int32_t>(hint.type);
+        writer.Write(hint.hintText);
+    }
+
+    writer.Write<uint32_t>(data.requiredTrials.size());
+    for (RandomizerInf trial : data.requiredTrials) {
+        writer.Write<int32_t>(trial);
+    }
+    writer.Write<uint32_t>(data.masterQuestDungeons.size());
+    for (uint16_t scene : data.masterQuestDungeons) {
+        writer.Write<uint16_t>(scene);
+    }
+
+    writer.Write<uint32_t>(data.seedIcons.size());
+    for (uint8_t icon : data.seedIcons) {
+        writer.Write<uint8_t>(icon);
+    }
+    writer.Write(data.inputSeed);
+    writer.Write<uint32_t>(data.finalSeed);
+    writer.Write<uint32_t>(data.itemLocations.size());
+    for (const SeedFileItemLocation& location : data.itemLocations) {
+        writer.Write<int32_t>(location.check);
+        writer.Write<uint8_t>(location.hasItem | (location.hasModel << 1) | (location.hasPrice << 2) |
+                              (location.hasTrickName << 3));
+        writer.Write<int32_t>(location.rgID);
+        writer.Write<int32_t>(location.fakeRgID);
+        writer.Write<uint16_t>(location.price);
+        writer.Write(location.trickName);
+    }
+
+    writer.Write<uint32_t>(data.entranceOverrides.size());
+    for (const EntranceOverride& entrance : data.entranceOverrides) {
+        writer.Write<uint16_t>(entrance.type);
+        writer.Write<int16_t>(entrance.index);
+        writer.Write<int16_t>(entrance.destination);
+        writer.Write<int16_t>(entrance.override);
+        writer.Write<int16_t>(entrance.overrideDestination);
+    }
+
+    // Written under a temporary name first so a seed file is never seen half written
+    std::string tempFileName = fileName + ".tmp";
+    {
+        std::ofstream file(tempFileName, std::ios::binary | std::ios::trunc);
+        if (!file || !file.write(writer.buffer.data(), writer.buffer.size())) {
+            return false;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(tempFileName, fileName, error);
+    if (error) {
+        std::filesystem::remove(tempFileName, error);
+        return false;
+    }
+    return true;
+}
+
+bool SeedFile_Read(const std::string& fileName, SeedFileData& data) {
+    std::ifstream file(fileName, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::vector<char> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    SeedFileReader reader(buffer);
+    if (reader.Read<uint32_t>() != SEED_FILE_MAGIC || reader.Read<uint32_t>() != SEED_FILE_VERSION ||
+        reader.Read<uint64_t>() != SeedFile_GetTableHash()) {
+        return false;
+    }
+
+    data = {};
+    data.hintsParsed = reader.Read<uint8_t>();
+    data.itemLocationsParsed = reader.Read<uint8_t>();
+
+    data.settings.resize(reader.ReadCount(5));
+    for (SeedFileSetting& setting : data.settings) {
+        setting.key = reader.ReadEnum<RandomizerSettingKey>(RSK_MAX);
+        setting.value = reader.Read<uint8_t>();
+    }
+
+    data.childAltarText = reader.ReadString();
+    data.adultAltarText = reader.ReadString();
+    data.ganonHintText = reader.ReadString();
+    data.ganonText = reader.ReadString();
+    data.dampeText = reader.ReadString();
+    data.gregHintText = reader.ReadString();
+    data.sheikText = reader.ReadString();
+    data.sariaText = reader.ReadString();
+    data.warpMinuetText = reader.ReadString();
+    data.warpBoleroText = reader.ReadString();
+    data.warpSerenadeText = reader.ReadString();
+    data.warpRequiemText = reader.ReadString();
+    data.warpNocturneText = reader.ReadString();
+    data.warpPreludeText = reader.ReadString();
+    for (RandomizerCheck& check : data.rewardCheck) {
+        check = reader.ReadEnum<RandomizerCheck>(RC_MAX);
+    }
+    data.masterSwordHintCheck = reader.ReadEnum<RandomizerCheck>(RC_MAX);
+    data.dampeCheck = reader.ReadEnum<RandomizerCheck>(RC_MAX);
+    data.gregCheck = reader.ReadEnum<RandomizerCheck>(RC_MAX);
+    data.lightArrowHintCheck = reader.ReadEnum<RandomizerCheck>(RC_MAX);
+    data.sariaCheck = reader.ReadEnum<RandomizerCheck>(RC_MAX);
+    data.hints.resize(reader.ReadCount(24));
+    for (SeedFileHint& hint : data.hints) {
+        hint.check = reader.ReadEnum<RandomizerCheck>(RC_MAX);
+        hint.hintedCheck = reader.ReadEnum<RandomizerCheck>(RC_MAX);
+        hint.rGet = reader.ReadEnum<RandomizerGet>(RG_MAX);
+        hint.area = reader.ReadEnum<RandomizerCheckArea>(RCAREA_INVALID + 1);
+        hint.type = reader.ReadEnum<HintType>(HINT_TYPE_MAX);
+        hint.hintText = reader.ReadString();
+    }
+
+    data.requiredTrials.resize(reader.ReadCount(4));
+    for (RandomizerInf& trial : data.requiredTrials) {
+        trial = reader.ReadEnum<RandomizerInf>(RAND_INF_MAX);
+    }
+    data.masterQuestDungeons.resize(reader.ReadCount(2));
+    for (uint16_t& scene : data.masterQuestDungeons) {
+        scene = reader.Read<uint16_t>();
+    }
+
+    data.seedIcons.resize(reader.ReadCount(1));
+    for (uint8_t& icon : data.seedIcons) {
+        icon = reader.Read<uint8_t>();
+    }
+    data.inputSeed = reader.ReadString();
+    data.finalSeed = reader.Read<uint32_t>();
+    data.itemLocations.resize(reader.ReadCount(19));
+    for (SeedFileItemLocation& location : data.itemLocations) {
+        location.check = reader.ReadEnum<RandomizerCheck>(RC_MAX);
+        uint8_t fields = reader.Read<uint8_t>();
+        location.hasItem = fields & 1;
+        location.hasModel = fields & 2;
+        location.hasPrice = fields & 4;
+        location.hasTrickName = fields & 8;
+        location.rgID = reader.ReadEnum<RandomizerGet>(RG_MAX);
+        location.fakeRgID = reader.ReadEnum<RandomizerGet>(RG_MAX);
+        location.price = reader.Read<uint16_t>();
+        location.trickName = reader.ReadString();
+    }
+
+    data.entranceOverrides.resize(reader.ReadCount(10));
+    for (EntranceOverride& entrance : data.entranceOverrides) {
+        entrance.type = reader.Read<uint16_t>();
+        entrance.index = reader.Read<int16_t>();
+        entrance.destination = reader.Read<int16_t>();
+        entrance.override = reader.Read<int16_t>();
+        entrance.overrideDestination = reader.Read<int16_t>();
+    }
+
+    return !reader.failed && reader.remaining == 0;
+}
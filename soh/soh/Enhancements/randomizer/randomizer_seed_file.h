@@ -0,0 +1,94 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "randomizerTypes.h"
+#include "randomizer_entrance.h"
+
+// A seed file is a binary copy of everything the game reads out of a spoiler log, with the check, item, hint and
+// setting names already mapped to their enums. It's written next to the spoiler log when a seed is generated so
+// loading the seed doesn't have to parse the JSON, the spoiler log itself stays the human readable copy.
+
+#define SEED_FILE_EXTENSION ".seed"
+
+typedef struct {
+    RandomizerSettingKey key;
+    uint8_t value;
+} SeedFileSetting;
+
+typedef struct {
+    RandomizerCheck check;
+    RandomizerCheck hintedCheck;
+    RandomizerGet rGet;
+    RandomizerCheckArea area;
+    HintType type;
+    std::string hintText;
+} SeedFileHint;
+
+// The spoiler log lists a location either as a plain item name or as an object with only some of the fields set
+typedef struct {
+    RandomizerCheck check;
+    bool hasItem;
+    bool hasModel;
+    bool hasPrice;
+    bool hasTrickName;
+    RandomizerGet rgID;
+    RandomizerGet fakeRgID;
+    uint16_t price;
+    std::string trickName;
+} SeedFileItemLocation;
+
+struct SeedFileData {
+    // Hints and item locations are only loaded when they were read without errors. The other parts are left empty
+    // on errors, which clears them when loaded.
+    bool hintsParsed = false;
+    bool itemLocationsParsed = false;
+
+    std::vector<SeedFileSetting> settings;
+
+    std::string childAltarText;
+    std::string adultAltarText;
+    std::string ganonHintText;
+    std::string ganonText;
+    std::string dampeText;
+    std::string gregHintText;
+    std::string sheikText;
+    std::string sariaText;
+    std::string warpMinuetText;
+    std::string warpBoleroText;
+    std::string warpSerenadeText;
+    std::string warpRequiemText;
+    std::string warpNocturneText;
+    std::string warpPreludeText;
+    RandomizerCheck rewardCheck[9] = {};
+    RandomizerCheck masterSwordHintCheck = RC_UNKNOWN_CHECK;
+    RandomizerCheck dampeCheck = RC_UNKNOWN_CHECK;
+    RandomizerCheck gregCheck = RC_UNKNOWN_CHECK;
+    RandomizerCheck lightArrowHintCheck = RC_UNKNOWN_CHECK;
+    RandomizerCheck sariaCheck = RC_UNKNOWN_CHECK;
+    std::vector<SeedFileHint> hints;
+
+    std::vector<RandomizerInf> requiredTrials;
+    std::vector<uint16_t> masterQuestDungeons;
+
+    std::vector<uint8_t> seedIcons;
+    std::string inputSeed;
+    uint32_t finalSeed = 0;
+    std::vector<SeedFileItemLocation> itemLocations;
+
+    std::vector<EntranceOverride> entranceOverrides;
+};
+
+// Returns the seed file path that goes with a spoiler log path
+std::string SeedFile_GetPath(const std::string& spoilerFileName);
+bool SeedFile_Write(const std::string& fileName, const SeedFileData& data);
+// Fails on files written by another version, by a build with other enum values or on another byte order, and on
+// enum values out of range. Callers fall back to the spoiler log.
+bool SeedFile_Read(const std::string& fileName, SeedFileData& data);
+
+// Hash of the name to enum tables the spoiler log parser uses and of the build, implemented next to the parser
+uint64_t SeedFile_GetTableHash();
+
+// Parses a spoiler log that was just generated and writes its seed file, implemented next to the spoiler log parser
+void SeedFile_WriteFromSpoilerLog(const std::string& spoilerJson, const std::string& fileName);
@@ -1,8 +1,10 @@
 #include "randomizer_tricks.h"
 #include <map>
 #include <string>
+#ifndef RANDOMIZER_HEADLESS
 #include <libultraship/bridge.h>
 #include "z64.h"
+#endif
 
 //Difficulty base tag vectors:
 std::vector<RandomizerTrickTag> noviceBase{RTTAG_NOVICE};
@@ -287,6 +289,8 @@ std::string RandomizerTricks::GetRTName(RandomizerTrick trick) {
     return rtObjects[trick].rtShortName;
 }
 
+#ifndef RANDOMIZER_HEADLESS
+// The tracker colours are only used by the menus, which the headless generator doesn't have
 ImVec4 RandomizerTricks::GetRTAreaColor(RandomizerTrickArea area) {
     switch (area) {
         case RTAREA_GENERAL:
@@ -382,6 +386,7 @@ ImVec4 RandomizerTricks::GetRTTagColor(RandomizerTrickTag tag) {
             return ImVec4(.f,.f,.f,1.0f);*/
     }
 }
+#endif
 
 bool RandomizerTricks::CheckRTTags(std::unordered_map<RandomizerTrickTag, bool> &showTag, const std::vector<RandomizerTrickTag> &rtTags) {
     for (auto rtTag : rtTags) {
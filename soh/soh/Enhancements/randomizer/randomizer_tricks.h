@@ -3,7 +3,9 @@
 #include <string>
 #include <unordered_map>
 #include <vector>
+#ifndef RANDOMIZER_HEADLESS
 #include <libultraship/libultraship.h>
+#endif
 
 typedef enum {
     RTAREA_GENERAL,
@@ -81,7 +83,9 @@ namespace RandomizerTricks {
     std::string GetRTAreaName(RandomizerTrickArea area);
     std::string GetRTTagName(RandomizerTrickTag tag);
     std::string GetRTName(RandomizerTrick trick);
+#ifndef RANDOMIZER_HEADLESS
     ImVec4 GetRTAreaColor(RandomizerTrickArea area);
     ImVec4 GetRTTagColor(RandomizerTrickTag tag);
+#endif
     bool CheckRTTags(std::unordered_map<RandomizerTrickTag, bool> &showTag, const std::vector<RandomizerTrickTag> &rtTags);
 }
@@ -8,6 +8,7 @@
 
 #include <soh/OTRGlobals.h>
 #include <soh/OTRAudio.h>
+#include <soh/thread_local.h>
 
 #include "z64.h"
 #include "z64save.h"
@@ -37,8 +38,8 @@ typedef struct {
 #include "savestates_extern.inc"
 
 typedef struct SaveStateInfo {
-    unsigned char sysHeapCopy[SYSTEM_HEAP_SIZE];
-    unsigned char audioHeapCopy[AUDIO_HEAP_SIZE];
+    HeapDelta sysHeap;
+    HeapDelta audioHeap;
 
     SaveContext saveContextCopy;
     GameInfo gameInfoCopy;
@@ -887,8 +888,10 @@ SaveStateReturn SaveStateMgr::AddRequest(const SaveStateRequest request) {
 
 void SaveState::Save(void) {
     std::unique_lock<std::mutex> Lock(audio.mutex);
-    memcpy(&info->sysHeapCopy, gSystemHeap, SYSTEM_HEAP_SIZE /* sizeof(gSystemHeap) */);
-    memcpy(&info->audioHeapCopy, gAudioHeap, AUDIO_HEAP_SIZE /* sizeof(gAudioContext) */);
+    info->sysHeap.Save(gSystemHeap, SYSTEM_HEAP_SIZE, saveStateMgr->sysHeapBase.lock());
+    info->audioHeap.Save(gAudioHeap, AUDIO_HEAP_SIZE, saveStateMgr->audioHeapBase.lock());
+    saveStateMgr->sysHeapBase = info->sysHeap.GetBase();
+    saveStateMgr->audioHeapBase = info->audioHeap.GetBase();
 
     memcpy(&info->audioContextCopy, &gAudioContext, sizeof(AudioContext));
     memcpy(&info->gActiveSeqsCopy, gActiveSeqs, sizeof(info->gActiveSeqsCopy));
@@ -926,8 +929,8 @@ void SaveState::Save(void) {
 
 void SaveState::Load(void) {
     std::unique_lock<std::mutex> Lock(audio.mutex);
-    memcpy(gSystemHeap, &info->sysHeapCopy, SYSTEM_HEAP_SIZE);
-    memcpy(gAudioHeap, &info->audioHeapCopy, AUDIO_HEAP_SIZE);
+    info->sysHeap.Load(gSystemHeap);
+    info->audioHeap.Load(gAudioHeap);
 
     memcpy(&gAudioContext, &info->audioContextCopy, sizeof(AudioContext));
     memcpy(gActiveSeqs, &info->gActiveSeqsCopy, sizeof(info->gActiveSeqsCopy));
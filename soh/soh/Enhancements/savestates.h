@@ -6,6 +6,7 @@
 #include <unordered_map>
 #include <memory>
 #include <mutex>
+#include "savestates_delta.h"
 
 enum class SaveStateReturn {
     SUCCESS,
@@ -41,6 +42,10 @@ class SaveStateMgr {
     std::unordered_map<unsigned int, std::shared_ptr<SaveState>> states;
     std::queue <SaveStateRequest> requests;
     std::mutex mutex;
+    // Heap copies that states are saved against, shared by every slot saved since they were taken. Only the slots
+    // keep them alive, so they are freed once no slot uses them.
+    std::weak_ptr<const HeapBase> sysHeapBase;
+    std::weak_ptr<const HeapBase> audioHeapBase;
     
   public:
 
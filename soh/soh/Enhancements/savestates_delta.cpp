@@ -0,0 +1,183 @@
+#include "savestates_delta.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+// A changed page is stored as runs of 64-bit words, each behind a 16-bit token: the top two bits say what the run is
+// and the rest how many words it covers. A page which doesn't get smaller that way is copied raw, and marked so in
+// its index.
+enum RunKind : uint16_t {
+    RUN_SAME = 0,    // Same as the base
+    RUN_ZERO = 1,    // Zeroes
+    RUN_LITERAL = 2, // The words follow the token
+};
+
+constexpr uint16_t RUN_KIND_SHIFT = 14;
+constexpr uint16_t RUN_COUNT_MASK = (1 << RUN_KIND_SHIFT) - 1;
+constexpr uint32_t PAGE_RAW = 1u << 31;
+constexpr size_t SAME_BLOCK_SIZE = 4 * sizeof(uint64_t);
+static_assert(HEAP_DELTA_PAGE_SIZE / sizeof(uint64_t) <= RUN_COUNT_MASK, "A page's runs must fit in a token");
+
+uint64_t LoadWord(const uint8_t* src) {
+    uint64_t word;
+    memcpy(&word, src, sizeof(word));
+    return word;
+}
+
+void PutToken(uint8_t*& dst, RunKind kind, size_t count) {
+    uint16_t token = (uint16_t)((kind << RUN_KIND_SHIFT) | count);
+    memcpy(dst, &token, sizeof(token));
+    dst += sizeof(token);
+}
+
+// Encodes a changed page into dst, which must hold the page and a token, and returns the bytes written, or 0 when the
+// page is better copied raw
+size_t EncodePage(const uint8_t* page, const uint8_t* base, size_t length, uint8_t* dst) {
+    uint8_t* start = dst;
+    size_t words = length / sizeof(uint64_t);
+
+    if (length % sizeof(uint64_t) == 0) {
+        size_t word = 0;
+
+        while (word < words && (size_t)(dst - start) < length) {
+            uint64_t value = LoadWord(page + word * sizeof(uint64_t));
+            size_t end = word + 1;
+
+            if (value == LoadWord(base + word * sizeof(uint64_t))) {
+                while (end * sizeof(uint64_t) + SAME_BLOCK_SIZE <= length &&
+                       memcmp(page + end * sizeof(uint64_t), base + end * sizeof(uint64_t), SAME_BLOCK_SIZE) == 0) {
+                    end += SAME_BLOCK_SIZE / sizeof(uint64_t);
+                }
+                while (end < words &&
+                       LoadWord(page + end * sizeof(uint64_t)) == LoadWord(base + end * sizeof(uint64_t))) {
+                    end++;
+                }
+                PutToken(dst, RUN_SAME, end - word);
+            } else if (value == 0) {
+                while (end < words && LoadWord(page + end * sizeof(uint64_t)) == 0) {
+                    end++;
+                }
+                PutToken(dst, RUN_ZERO, end - word);
+            } else {
+                while (end < words) {
+                    uint64_t next = LoadWord(page + end * sizeof(uint64_t));
+                    if (next == 0 || next == LoadWord(base + end * sizeof(uint64_t))) {
+                        break;
+                    }
+                    end++;
+                }
+                if ((size_t)(dst - start) + sizeof(uint16_t) + (end - word) * sizeof(uint64_t) >= length) {
+                    return 0;
+                }
+                PutToken(dst, RUN_LITERAL, end - word);
+                memcpy(dst, page + word * sizeof(uint64_t), (end - word) * sizeof(uint64_t));
+                dst += (end - word) * sizeof(uint64_t);
+            }
+            word = end;
+        }
+
+        if (word == words && (size_t)(dst - start) < length) {
+            return dst - start;
+        }
+    }
+    return 0;
+}
+
+const uint8_t* DecodePage(const uint8_t* src, uint8_t* page, size_t length) {
+    size_t offset = 0;
+
+    while (offset < length) {
+        uint16_t token;
+        memcpy(&token, src, sizeof(token));
+        src += sizeof(token);
+
+        size_t bytes = (size_t)(token & RUN_COUNT_MASK) * sizeof(uint64_t);
+        switch (token >> RUN_KIND_SHIFT) {
+            case RUN_SAME:
+                break;
+            case RUN_ZERO:
+                memset(page + offset, 0, bytes);
+                break;
+            case RUN_LITERAL:
+                memcpy(page + offset, src, bytes);
+                src += bytes;
+                break;
+        }
+        offset += bytes;
+    }
+    return src;
+}
+} // namespace
+
+void HeapDelta::Save(const uint8_t* heap, size_t size, const std::shared_ptr<const HeapBase>& base) {
+    mPages.clear();
+    mData.clear();
+
+    if (base != nullptr && base->size() == size) {
+        uint8_t encoded[HEAP_DELTA_PAGE_SIZE + sizeof(uint16_t)];
+        bool tooLarge = false;
+
+        mBase = base;
+
+        for (size_t offset = 0; offset < size; offset += HEAP_DELTA_PAGE_SIZE) {
+            size_t length = std::min<size_t>(HEAP_DELTA_PAGE_SIZE, size - offset);
+
+            if (memcmp(heap + offset, mBase->data() + offset, length) == 0) {
+                continue;
+            }
+
+            uint32_t page = offset / HEAP_DELTA_PAGE_SIZE;
+            const uint8_t* data = encoded;
+            size_t dataSize = EncodePage(heap + offset, mBase->data() + offset, length, encoded);
+            if (dataSize == 0) {
+                page |= PAGE_RAW;
+                data = heap + offset;
+                dataSize = length;
+            }
+            if (mData.size() + dataSize > size / 2) {
+                tooLarge = true;
+                break;
+            }
+
+            mPages.push_back(page);
+            mData.insert(mData.end(), data, data + dataSize);
+        }
+
+        if (!tooLarge) {
+            return;
+        }
+    }
+
+    mPages.clear();
+    mData.clear();
+    mData.shrink_to_fit();
+    mBase = std::make_shared<const HeapBase>(heap, heap + size);
+}
+
+void HeapDelta::Load(uint8_t* heap) const {
+    size_t size = mBase->size();
+    const uint8_t* src = mData.data();
+
+    memcpy(heap, mBase->data(), size);
+
+    for (uint32_t page : mPages) {
+        size_t offset = (size_t)(page & ~PAGE_RAW) * HEAP_DELTA_PAGE_SIZE;
+        size_t length = std::min<size_t>(HEAP_DELTA_PAGE_SIZE, size - offset);
+
+        if (page & PAGE_RAW) {
+            memcpy(heap + offset, src, length);
+            src += length;
+        } else {
+            src = DecodePage(src, heap + offset, length);
+        }
+    }
+}
+
+const std::shared_ptr<const HeapBase>& HeapDelta::GetBase() const {
+    return mBase;
+}
+
+size_t HeapDelta::GetDeltaSize() const {
+    return mData.size() + mPages.size() * sizeof(uint32_t);
+}
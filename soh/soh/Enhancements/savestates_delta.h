@@ -0,0 +1,35 @@
+#ifndef SAVE_STATES_DELTA_H
+#define SAVE_STATES_DELTA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#define HEAP_DELTA_PAGE_SIZE 0x1000
+
+typedef std::vector<uint8_t> HeapBase;
+
+// A copy of a heap, stored as the pages that differ from a base copy of the same heap. States saved close together
+// share the base and only pay for what changed in between. Unchanged pages are found with one memcmp each. A changed
+// page is run-length coded against its base page, as runs of words which are unchanged, zero or new, and copied whole
+// when that doesn't make it smaller, like a page the game rewrote with fresh data.
+class HeapDelta {
+  public:
+    // Stores the heap's current contents against base. Starts a new base from the heap when there's none yet, or
+    // when the heap has drifted so far from it that the delta would cost more than half a full copy.
+    void Save(const uint8_t* heap, size_t size, const std::shared_ptr<const HeapBase>& base);
+    void Load(uint8_t* heap) const;
+
+    const std::shared_ptr<const HeapBase>& GetBase() const;
+    // Bytes kept for this state on top of the base
+    size_t GetDeltaSize() const;
+
+  private:
+    std::shared_ptr<const HeapBase> mBase;
+    // Changed pages, with the top bit set for the ones copied whole, and their contents one after the other in mData
+    std::vector<uint32_t> mPages;
+    std::vector<uint8_t> mData;
+};
+
+#endif
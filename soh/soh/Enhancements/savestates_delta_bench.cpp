@@ -0,0 +1,146 @@
+// HeapDelta benchmark.
+//
+// Saves heaps the size of the system and audio heaps against a base copy after
+// dirtying 1%, 10% and 50% of their pages, then restores them, and reports the
+// bytes stored on top of the base and the median save and load time, next to a
+// plain copy of the heap. Dirty pages are either rewritten whole, the way the game's heap
+// changes as it allocates and frees, or get a few scattered words changed.
+// Exits with 1 if a restored heap doesn't match what was saved. Built as the
+// soh-savestate-delta-bench target, it only depends on HeapDelta.
+
+#include "savestates_delta.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+struct HeapCase {
+    const char* name;
+    size_t size;
+};
+
+// Same as SYSTEM_HEAP_SIZE and AUDIO_HEAP_SIZE in z64.h, which needs the game's headers
+constexpr HeapCase kHeapCases[] = {
+    { "system", 1024 * 1024 * 4 },
+    { "audio", 0x380000 },
+};
+constexpr int kRuns = 15;
+constexpr int kWordsPerDirtyPage = 64;
+
+struct DirtyCase {
+    double fraction;
+    bool wholePages;
+};
+
+constexpr DirtyCase kDirtyCases[] = {
+    { 0.01, true }, { 0.10, true }, { 0.50, true }, { 0.01, false }, { 0.10, false }, { 0.50, false },
+};
+
+using Clock = std::chrono::steady_clock;
+
+double Milliseconds(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+double Median(std::vector<double> times) {
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+// Mostly zeroes with some random data in between, roughly what a heap looks like
+std::vector<uint8_t> MakeBaseHeap(size_t size, std::mt19937& rng) {
+    std::vector<uint8_t> heap(size);
+    for (size_t i = 0; i < size; i += 4) {
+        uint32_t value = (i % 64 < 16) ? rng() : 0;
+        memcpy(&heap[i], &value, sizeof(value));
+    }
+    return heap;
+}
+
+std::vector<uint8_t> DirtyHeap(const std::vector<uint8_t>& base, double dirtyFraction, bool wholePages,
+                               std::mt19937& rng) {
+    std::vector<uint8_t> heap = base;
+    size_t pages = heap.size() / HEAP_DELTA_PAGE_SIZE;
+    size_t dirtyPages = (size_t)(pages * dirtyFraction);
+
+    std::vector<size_t> order(pages);
+    for (size_t i = 0; i < pages; i++) {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), rng);
+
+    for (size_t i = 0; i < dirtyPages; i++) {
+        if (wholePages) {
+            for (size_t offset = 0; offset < HEAP_DELTA_PAGE_SIZE; offset += 4) {
+                uint32_t value = rng();
+                memcpy(&heap[order[i] * HEAP_DELTA_PAGE_SIZE + offset], &value, sizeof(value));
+            }
+            continue;
+        }
+        for (int word = 0; word < kWordsPerDirtyPage; word++) {
+            size_t offset = order[i] * HEAP_DELTA_PAGE_SIZE + (rng() % (HEAP_DELTA_PAGE_SIZE / 4)) * 4;
+            uint32_t value = rng();
+            memcpy(&heap[offset], &value, sizeof(value));
+        }
+    }
+    return heap;
+}
+
+bool RunHeapCase(const HeapCase& heapCase, std::mt19937& rng) {
+    std::vector<uint8_t> baseHeap = MakeBaseHeap(heapCase.size, rng);
+    std::vector<uint8_t> restored(heapCase.size);
+
+    HeapDelta baseState;
+    baseState.Save(baseHeap.data(), heapCase.size, nullptr);
+
+    std::vector<double> copyTimes;
+    for (int run = 0; run < kRuns; run++) {
+        Clock::time_point start = Clock::now();
+        memcpy(restored.data(), baseHeap.data(), heapCase.size);
+        copyTimes.push_back(Milliseconds(start, Clock::now()));
+    }
+    printf("%s heap, full copy: %8zu bytes, copy %.3f ms\n", heapCase.name, heapCase.size, Median(copyTimes));
+
+    bool allRestored = true;
+    for (const DirtyCase& dirty : kDirtyCases) {
+        std::vector<uint8_t> heap = DirtyHeap(baseHeap, dirty.fraction, dirty.wholePages, rng);
+        std::vector<double> saveTimes;
+        std::vector<double> loadTimes;
+        HeapDelta delta;
+
+        for (int run = 0; run < kRuns; run++) {
+            Clock::time_point start = Clock::now();
+            delta.Save(heap.data(), heapCase.size, baseState.GetBase());
+            Clock::time_point saved = Clock::now();
+            delta.Load(restored.data());
+            Clock::time_point loaded = Clock::now();
+
+            saveTimes.push_back(Milliseconds(start, saved));
+            loadTimes.push_back(Milliseconds(saved, loaded));
+        }
+
+        bool matches = memcmp(restored.data(), heap.data(), heapCase.size) == 0;
+        allRestored = allRestored && matches;
+        printf("  %3.0f%% dirty, %-8s %8zu bytes (%s base), save %.3f ms, load %.3f ms%s\n", dirty.fraction * 100,
+               dirty.wholePages ? "pages:" : "words:", delta.GetDeltaSize(),
+               delta.GetBase() == baseState.GetBase() ? "shared" : "new", Median(saveTimes), Median(loadTimes),
+               matches ? "" : ", MISMATCH");
+    }
+    return allRestored;
+}
+} // namespace
+
+int main() {
+    std::mt19937 rng(1);
+    bool allRestored = true;
+
+    for (const HeapCase& heapCase : kHeapCases) {
+        allRestored = RunHeapCase(heapCase, rng) && allRestored;
+    }
+
+    return allRestored ? 0 : 1;
+}
@@ -1,11 +1,16 @@
 #pragma once
 #include <thread>
 #include <condition_variable>
+#include <mutex>
 
-static struct {
+// The audio thread holds mutex while it runs the audio engine, anything else touching the engine's state while the
+// audio thread might be running takes it too.
+struct OTRAudioState {
     std::thread thread;
     std::condition_variable cv_to_thread, cv_from_thread;
     std::mutex mutex;
     bool running;
     bool processing;
-} audio;
+};
+
+extern OTRAudioState audio;
@@ -5,6 +5,8 @@
 #include <filesystem>
 #include <fstream>
 #include <chrono>
+#include <atomic>
+#include <BS_thread_pool.hpp>
 
 #include <ResourceManager.h>
 #include "graphic/Fast3D/Fast3dWindow.h"
@@ -34,10 +36,15 @@
 #include "Enhancements/randomizer/randomizer_entrance_tracker.h"
 #include "Enhancements/randomizer/randomizer_item_tracker.h"
 #include "Enhancements/randomizer/randomizer_check_tracker.h"
+#include "Enhancements/randomizer/randomizer_seed_file.h"
 #include "Enhancements/randomizer/3drando/random.hpp"
 #include "Enhancements/gameplaystats.h"
 #include "Enhancements/n64_weird_frame_data.inc"
 #include "frame_interpolation.h"
+#include "mtxf_simd.h"
+#include "thread_local.h"
+#include "ResourcePreloader.h"
+#include "ScenePrefetcher.h"
 #include "variables.h"
 #include "z64.h"
 #include "macros.h"
@@ -488,6 +495,7 @@ struct ExtensionEntry {
 };
 
 extern "C" void OTRMessage_Init();
+extern "C" void Mixer_Init(void);
 extern "C" void AudioMgr_CreateNextAudioBuffer(s16* samples, u32 num_samples);
 extern "C" void AudioPlayer_Play(const uint8_t* buf, uint32_t len);
 extern "C" int AudioPlayer_Buffered(void);
@@ -496,6 +504,8 @@ extern "C" void ResourceMgr_LoadDirectory(const char* resName);
 extern "C" SequenceData ResourceMgr_LoadSeqByName(const char* path);
 std::unordered_map<std::string, ExtensionEntry> ExtensionCache;
 
+OTRAudioState audio;
+
 void OTRAudio_Thread() {
     while (audio.running) {
         {
@@ -544,15 +554,49 @@ void OTRAudio_Thread() {
 // C->C++ Bridge
 extern "C" void OTRAudio_Init()
 {
-    // Precache all our samples, sequences, etc...
-    ResourceMgr_LoadDirectory("audio");
+    // Precache all our samples, sequences, etc... The audio engine waits on the ones it needs as it loads them.
+    ResourcePreloader::Instance->Queue("audio/*", BS::pr::high);
 
     if (!audio.running) {
+        Mixer_Init();
         audio.running = true;
         audio.thread = std::thread(OTRAudio_Thread);
     }
 }
 
+#if SOH_HAS_THREAD_LOCAL
+static BS::thread_pool& OTRAudio_GetSynthesisPool() {
+    // At most half the cores, the game and render threads keep running while the audio thread waits on these
+    static BS::thread_pool pool(std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u));
+    return pool;
+}
+#endif
+
+// Calls func for every index below count on the synthesis workers and the calling thread. Indices are handed out one
+// at a time, so any thread may get any index, and it returns once every call has. Without a DMEM per thread they're
+// all called on this one.
+extern "C" void OTRAudio_ParallelFor(int32_t count, void (*func)(int32_t index)) {
+#if !SOH_HAS_THREAD_LOCAL
+    for (int32_t i = 0; i < count; i++) {
+        func(i);
+    }
+#else
+    BS::thread_pool& pool = OTRAudio_GetSynthesisPool();
+    std::atomic<int32_t> next = 0;
+    auto work = [&next, count, func] {
+        for (int32_t i = next++; i < count; i = next++) {
+            func(i);
+        }
+    };
+
+    for (uint32_t i = 0; i < pool.get_thread_count(); i++) {
+        pool.detach_task(work);
+    }
+    work();
+    pool.wait();
+#endif
+}
+
 extern "C" void OTRAudio_Exit() {
     // Tell the audio thread to stop
     {
@@ -1146,7 +1190,17 @@ extern "C" void InitOTR() {
 #endif
 
     OTRMessage_Init();
+    MtxFSimd_Init();
+    ResourcePreloader::Instance = new ResourcePreloader();
     OTRAudio_Init();
+    // Objects and scenes that are worth having loaded before the game first uses them, see OTRPlay_SpawnScene
+    ResourcePreloader::Instance->QueueList(
+        CVarGetString(CVAR_SETTING("PreloadResources"),
+                      "objects/gameplay_keep/*;objects/gameplay_field_keep/*;objects/gameplay_dangeon_keep/*"),
+        BS::pr::low);
+#if SOH_HAS_THREAD_LOCAL
+    ScenePrefetcher::Instance = new ScenePrefetcher();
+#endif
     OTRExtScanner();
     VanillaItemTable_Init();
     DebugConsole_Init();
@@ -1367,7 +1421,8 @@ extern "C" void Graph_ProcessGfxCommands(Gfx* commands) {
     }
 
     audio.cv_to_thread.notify_one();
-    std::vector<std::unordered_map<Mtx*, MtxF>> mtx_replacements;
+    static std::vector<std::unordered_map<Mtx*, MtxF>> mtx_replacements;
+    static std::vector<float> interpolation_steps;
     int target_fps = OTRGlobals::Instance->GetInterpolationFPS();
     static int last_fps;
     static int last_update_rate;
@@ -1387,15 +1442,22 @@ extern "C" void Graph_ProcessGfxCommands(Gfx* commands) {
     // time_base = fps * original_fps (one second)
     int next_original_frame = fps;
 
+    interpolation_steps.clear();
+    bool reaches_original_frame = false;
     while (time + original_fps <= next_original_frame) {
         time += original_fps;
         if (time != next_original_frame) {
-            mtx_replacements.push_back(FrameInterpolation_Interpolate((float)time / next_original_frame));
+            interpolation_steps.push_back((float)time / next_original_frame);
         } else {
-            mtx_replacements.emplace_back();
+            reaches_original_frame = true;
         }
     }
 
+    FrameInterpolation_InterpolateFrames(interpolation_steps, mtx_replacements);
+    if (reaches_original_frame) {
+        mtx_replacements.emplace_back();
+    }
+
     time -= fps;
 
     if (wnd != nullptr) {
@@ -1559,6 +1621,11 @@ extern "C" void ResourceMgr_DirtyDirectory(const char* resName) {
     Ship::Context::GetInstance()->GetResourceManager()->DirtyDirectory(resName);
 }
 
+// For game states that draw preloaded resources straight from their paths before any bridge has loaded from them
+extern "C" void ResourceMgr_WaitForPreloadedDirectory(const char* directory) {
+    ResourcePreloader::Instance->WaitForDirectory(directory);
+}
+
 extern "C" void ResourceMgr_UnloadResource(const char* resName) {
     std::string path = resName;
     if (path.substr(0, 7) == "__OTR__") {
@@ -1618,15 +1685,40 @@ extern "C" void ResourceMgr_UnloadOriginalWhenAltExists(const char* resName) {
     }
 }
 
-std::shared_ptr<Ship::IResource> GetResourceByNameHandlingMQ(const char* path) {
+static std::string GetPathHandlingMQ(const char* path, bool isMQ) {
     std::string Path = path;
-    if (ResourceMgr_IsGameMasterQuest()) {
+    if (isMQ) {
         size_t pos = 0;
         if ((pos = Path.find("/nonmq/", 0)) != std::string::npos) {
             Path.replace(pos, 7, "/mq/");
         }
     }
-    return Ship::Context::GetInstance()->GetResourceManager()->LoadResource(Path.c_str());
+    return Path;
+}
+
+std::string GetPathHandlingMQ(const char* path) {
+    return GetPathHandlingMQ(path, ResourceMgr_IsGameMasterQuest() != 0);
+}
+
+// For paths of a scene other than the current one
+std::string GetPathHandlingMQ(const char* path, int16_t sceneNum) {
+    return GetPathHandlingMQ(path, IsSceneMasterQuest(sceneNum) != 0);
+}
+
+// The bridges below load through these, so they never load a second copy of something the preloader or the scene
+// prefetcher is still decoding. Anything else that's preloaded can be loaded through them too.
+std::shared_ptr<Ship::IResource> LoadResourceAfterPreload(const std::string& path) {
+    ResourcePreloader::Instance->WaitForLoad(path);
+    return Ship::Context::GetInstance()->GetResourceManager()->LoadResource(path);
+}
+
+static void* ResourceGetDataAfterPreload(const char* path) {
+    ResourcePreloader::Instance->WaitForLoad(path);
+    return ResourceGetDataByName(path);
+}
+
+std::shared_ptr<Ship::IResource> GetResourceByNameHandlingMQ(const char* path) {
+    return LoadResourceAfterPreload(GetPathHandlingMQ(path));
 }
 
 extern "C" char* GetResourceDataByNameHandlingMQ(const char* path) {
@@ -1753,8 +1845,7 @@ std::unordered_map<std::string, std::unordered_map<std::string, GfxPatch>> origi
 // Attention! This is primarily for cosmetics & bug fixes. For things like mods and model replacement you should be using OTRs
 // instead (When that is available). Index can be found using the commented out section below.
 extern "C" void ResourceMgr_PatchGfxByName(const char* path, const char* patchName, int index, Gfx instruction) {
-    auto res = std::static_pointer_cast<LUS::DisplayList>(
-        Ship::Context::GetInstance()->GetResourceManager()->LoadResource(path));
+    auto res = std::static_pointer_cast<LUS::DisplayList>(LoadResourceAfterPreload(path));
 
     // Leaving this here for people attempting to find the correct Dlist index to patch
     /*if (strcmp("__OTR__objects/object_gi_longsword/gGiBiggoronSwordDL", path) == 0) {
@@ -1792,8 +1883,7 @@ extern "C" void ResourceMgr_PatchGfxByName(const char* path, const char* patchNa
 }
 
 extern "C" void ResourceMgr_PatchGfxCopyCommandByName(const char* path, const char* patchName, int destinationIndex, int sourceIndex) {
-    auto res = std::static_pointer_cast<LUS::DisplayList>(
-        Ship::Context::GetInstance()->GetResourceManager()->LoadResource(path));
+    auto res = std::static_pointer_cast<LUS::DisplayList>(LoadResourceAfterPreload(path));
 
     // Do not patch custom assets as they most likely do not have the same instructions as authentic assets
     if (res->GetInitData()->IsCustom) {
@@ -1815,8 +1905,7 @@ extern "C" void ResourceMgr_PatchGfxCopyCommandByName(const char* path, const ch
 
 extern "C" void ResourceMgr_UnpatchGfxByName(const char* path, const char* patchName) {
     if (originalGfx.contains(path) && originalGfx[path].contains(patchName)) {
-        auto res = std::static_pointer_cast<LUS::DisplayList>(
-            Ship::Context::GetInstance()->GetResourceManager()->LoadResource(path));
+        auto res = std::static_pointer_cast<LUS::DisplayList>(LoadResourceAfterPreload(path));
 
         Gfx* gfx = (Gfx*)&res->Instructions[originalGfx[path][patchName].index];
         *gfx = originalGfx[path][patchName].instruction;
@@ -1855,15 +1944,15 @@ extern "C" char* ResourceMgr_LoadArrayByNameAsVec3s(const char* path) {
 }
 
 extern "C" CollisionHeader* ResourceMgr_LoadColByName(const char* path) {
-    return (CollisionHeader*) ResourceGetDataByName(path);
+    return (CollisionHeader*) ResourceGetDataAfterPreload(path);
 }
 
 extern "C" Vtx* ResourceMgr_LoadVtxByName(char* path) {
-    return (Vtx*) ResourceGetDataByName(path);
+    return (Vtx*) ResourceGetDataAfterPreload(path);
 }
 
 extern "C" SequenceData ResourceMgr_LoadSeqByName(const char* path) {
-    SequenceData* sequence = (SequenceData*) ResourceGetDataByName(path);
+    SequenceData* sequence = (SequenceData*) ResourceGetDataAfterPreload(path);
     return *sequence;
 }
 
@@ -1928,11 +2017,11 @@ extern "C" SoundFontSample* ReadCustomSample(const char* path) {
 }
 
 extern "C" SoundFontSample* ResourceMgr_LoadAudioSample(const char* path) {
-    return (SoundFontSample*) ResourceGetDataByName(path);
+    return (SoundFontSample*) ResourceGetDataAfterPreload(path);
 }
 
 extern "C" SoundFont* ResourceMgr_LoadAudioSoundFont(const char* path) {
-    return (SoundFont*) ResourceGetDataByName(path);
+    return (SoundFont*) ResourceGetDataAfterPreload(path);
 }
 
 extern "C" int ResourceMgr_OTRSigCheck(char* imgData)
@@ -1954,7 +2043,7 @@ extern "C" int ResourceMgr_OTRSigCheck(char* imgData)
 }
 
 extern "C" AnimationHeaderCommon* ResourceMgr_LoadAnimByName(const char* path) {
-    return (AnimationHeaderCommon*) ResourceGetDataByName(path);
+    return (AnimationHeaderCommon*) ResourceGetDataAfterPreload(path);
 }
 
 extern "C" SkeletonHeader* ResourceMgr_LoadSkeletonByName(const char* path, SkelAnime* skelAnime) {
@@ -1971,11 +2060,11 @@ extern "C" SkeletonHeader* ResourceMgr_LoadSkeletonByName(const char* path, Skel
         pathStr = Ship::IResource::gAltAssetPrefix + pathStr;
     }
 
-    SkeletonHeader* skelHeader = (SkeletonHeader*) ResourceGetDataByName(pathStr.c_str());
+    SkeletonHeader* skelHeader = (SkeletonHeader*) ResourceGetDataAfterPreload(pathStr.c_str());
 
     // If there isn't an alternate model, load the regular one
     if (isAlt && skelHeader == NULL) {
-        skelHeader = (SkeletonHeader*) ResourceGetDataByName(path);
+        skelHeader = (SkeletonHeader*) ResourceGetDataAfterPreload(path);
     }
 
     // This function is only called when a skeleton is initialized.
@@ -2399,6 +2488,11 @@ extern "C" u32 SpoilerFileExists(const char* spoilerFileName) {
     return OTRGlobals::Instance->gRandomizer->SpoilerFileExists(spoilerFileName);
 }
 
+extern "C" void Randomizer_RemoveSpoilerFile(const char* spoilerFileName) {
+    remove(SeedFile_GetPath(spoilerFileName).c_str());
+    remove(spoilerFileName);
+}
+
 extern "C" u8 Randomizer_GetSettingValue(RandomizerSettingKey randoSettingKey) {
     return OTRGlobals::Instance->gRandomizer->GetRandoSettingValue(randoSettingKey);
 }
@@ -62,6 +62,7 @@ private:
     ImFont* CreateDefaultFontWithSize(float size);
 };
 
+uint32_t IsSceneMasterQuest(s16 sceneNum);
 uint32_t IsGameMasterQuest();
 #endif
 
@@ -86,6 +87,7 @@ uint32_t IsGameMasterQuest();
 void DeinitOTR(void);
 void VanillaItemTable_Init();
 void OTRAudio_Init();
+void OTRAudio_ParallelFor(int32_t count, void (*func)(int32_t index));
 void OTRMessage_Init();
 void InitAudio();
 void Graph_StartFrame();
@@ -105,6 +107,7 @@ uint32_t ResourceMgr_GetGameVersion(int index);
 uint32_t ResourceMgr_GetGamePlatform(int index);
 uint32_t ResourceMgr_GetGameRegion(int index);
 void ResourceMgr_LoadDirectory(const char* resName);
+void ResourceMgr_WaitForPreloadedDirectory(const char* directory);
 void ResourceMgr_UnloadResource(const char* resName);
 char** ResourceMgr_ListFiles(const char* searchMask, int* resultSize);
 uint8_t ResourceMgr_FileExists(const char* resName);
@@ -162,6 +165,7 @@ void Controller_UnblockGameInput();
 void* getN64WeirdFrame(s32 i);
 int GetEquipNowMessage(char* buffer, char* src, const int maxBufferSize);
 u32 SpoilerFileExists(const char* spoilerFileName);
+void Randomizer_RemoveSpoilerFile(const char* spoilerFileName);
 Sprite* GetSeedTexture(uint8_t index);
 void Randomizer_LoadSettings(const char* spoilerFileName);
 u8 Randomizer_GetSettingValue(RandomizerSettingKey randoSettingKey);
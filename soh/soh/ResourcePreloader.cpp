@@ -0,0 +1,153 @@
+#include "ResourcePreloader.h"
+
+#include <vector>
+#include <libultraship/libultraship.h>
+#include <utils/StringHelper.h>
+
+ResourcePreloader* ResourcePreloader::Instance;
+
+void ResourcePreloader::Queue(const std::string& searchMask, BS::priority_t priority) {
+    auto resourceManager = Ship::Context::GetInstance()->GetResourceManager();
+    auto files = resourceManager->GetArchiveManager()->ListFiles(searchMask);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (const std::string& file : *files) {
+        if (!mQueued.contains(file)) {
+            mQueued[file] = resourceManager->LoadResourceAsync(file, false, priority);
+        }
+    }
+    UpdatePending();
+}
+
+void ResourcePreloader::QueueList(const std::string& searchMasks, BS::priority_t priority) {
+    for (const std::string& searchMask : StringHelper::Split(searchMasks, ";")) {
+        if (!searchMask.empty()) {
+            Queue(searchMask, priority);
+        }
+    }
+}
+
+void ResourcePreloader::QueueInBackground(const std::string& searchMask, BS::priority_t priority) {
+    // Searches are kept by the directory part of their mask, so waiting on a directory only waits on the searches
+    // that can find files in it
+    std::string directory = searchMask.substr(0, searchMask.find_last_of('/') + 1);
+    auto search = std::make_shared<Search>();
+    search->mask = searchMask;
+    search->priority = priority;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mSearches.emplace(directory, search);
+        UpdatePending();
+    }
+
+    mSearchPool.detach_task([this, directory, search]() {
+        RunSearch(*search);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto [first, last] = mSearches.equal_range(directory);
+        for (auto it = first; it != last; it++) {
+            if (it->second == search) {
+                mSearches.erase(it);
+                break;
+            }
+        }
+        UpdatePending();
+    });
+}
+
+void ResourcePreloader::RunSearch(Search& search) {
+    // Whichever of the search thread and a waiting thread gets here first runs the search, the other one returns
+    // once it's done
+    std::call_once(search.once, [this, &search]() { Queue(search.mask, search.priority); });
+}
+
+void ResourcePreloader::QueueFile(const std::string& path, BS::priority_t priority) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!mQueued.contains(path)) {
+        mQueued[path] =
+            Ship::Context::GetInstance()->GetResourceManager()->LoadResourceAsync(path, false, priority);
+        UpdatePending();
+    }
+}
+
+bool ResourcePreloader::IsReady(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mQueued.find(path);
+    return it == mQueued.end() || it->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+void ResourcePreloader::WaitForLoad(const std::string& path) {
+    if (mPending == 0) {
+        return;
+    }
+
+    std::string file = path;
+    if (file.substr(0, 7) == "__OTR__") {
+        file = file.substr(7);
+    }
+    if (file.starts_with("objects/") || file.starts_with("scenes/")) {
+        WaitForDirectory(file.substr(0, file.find_last_of('/') + 1));
+    } else {
+        WaitForRange(file, file);
+    }
+}
+
+void ResourcePreloader::WaitForDirectory(const std::string& directory) {
+    if (mPending == 0) {
+        return;
+    }
+
+    std::vector<std::shared_ptr<Search>> searches;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (auto it = mSearches.begin(); it != mSearches.end();) {
+            // Either directory contains what the search looks through, or the search looks through directory
+            if (it->first.starts_with(directory) || directory.starts_with(it->first)) {
+                searches.push_back(it->second);
+                it = mSearches.erase(it);
+            } else {
+                it++;
+            }
+        }
+        UpdatePending();
+    }
+    // Searches still waiting behind others on the search thread are run right here instead
+    for (auto& search : searches) {
+        RunSearch(*search);
+    }
+
+    // Every path starting with directory sorts between directory itself and directory followed by the last character
+    WaitForRange(directory, directory + '\xFF');
+}
+
+void ResourcePreloader::WaitForRange(const std::string& first, const std::string& last) {
+    std::vector<std::shared_future<std::shared_ptr<Ship::IResource>>> loads;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (auto it = mQueued.lower_bound(first); it != mQueued.end() && it->first <= last; it++) {
+            loads.push_back(it->second);
+        }
+    }
+    if (loads.empty()) {
+        return;
+    }
+
+    for (auto& load : loads) {
+        load.wait();
+    }
+
+    // Done loads are left to the resource cache, so unloading them from there frees them
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (auto it = mQueued.lower_bound(first); it != mQueued.end() && it->first <= last;) {
+        if (it->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            it = mQueued.erase(it);
+        } else {
+            it++;
+        }
+    }
+    UpdatePending();
+}
+
+void ResourcePreloader::UpdatePending() {
+    mPending = mQueued.size() + mSearches.size();
+}
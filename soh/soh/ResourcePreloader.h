@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <BS_thread_pool.hpp>
+#include "Resource.h"
+
+// Loads resources on the resource manager's workers ahead of when the game asks for them, so startup doesn't wait on
+// them. Anything loading a queued resource has to wait on it first, or it could load a second copy while the first is
+// still being decoded. The ResourceMgr_ bridges all do so through WaitForLoad.
+class ResourcePreloader {
+  public:
+    static ResourcePreloader* Instance;
+
+    // Queues every file matching searchMask, higher priorities are loaded first
+    void Queue(const std::string& searchMask, BS::priority_t priority);
+    // Same for a list of search masks separated by ;
+    void QueueList(const std::string& searchMasks, BS::priority_t priority);
+    // Same as Queue, but searches the archives on a worker instead of the calling thread. Only WaitForDirectory
+    // waits for such a search to finish, Wait doesn't see the files until it has
+    void QueueInBackground(const std::string& searchMask, BS::priority_t priority);
+    // Queues a single file by its exact path, skipping the archive search
+    void QueueFile(const std::string& path, BS::priority_t priority);
+
+    // True once path is loaded, or if it isn't queued at all, without waiting
+    bool IsReady(const std::string& path);
+
+    // Returns once path is loaded if it's queued, right away otherwise. For a path in an object or a scene it waits
+    // on all of that object or scene, since their display lists, textures and vertices are drawn straight from their
+    // paths without going through the bridges.
+    void WaitForLoad(const std::string& path);
+    // Returns once every queued file starting with directory is loaded, including what's still being searched for
+    // by QueueInBackground in that directory
+    void WaitForDirectory(const std::string& directory);
+
+  private:
+    struct Search {
+        std::once_flag once;
+        std::string mask;
+        BS::priority_t priority;
+    };
+
+    void RunSearch(Search& search);
+    void WaitForRange(const std::string& first, const std::string& last);
+    // Called with mMutex held after changing mQueued or mSearches
+    void UpdatePending();
+
+    BS::thread_pool mSearchPool{ 1 };
+    std::mutex mMutex;
+    std::multimap<std::string, std::shared_ptr<Search>> mSearches;
+    std::map<std::string, std::shared_future<std::shared_ptr<Ship::IResource>>> mQueued;
+    // Searches and loads left, so the bridges can skip the lock once everything is loaded
+    std::atomic<size_t> mPending = 0;
+};
@@ -17,6 +17,7 @@
 #include <fstream>
 #include <filesystem>
 #include <array>
+#include <future>
 
 extern "C" SaveContext gSaveContext;
 using namespace std::string_literals;
@@ -367,6 +368,207 @@ void SaveManager::SaveRandomizer(SaveContext* saveContext, int sectionID, bool f
     });
 }
 
+// Compact saves are a MessagePack map, which can't be mistaken for the '{' that starts a JSON save
+static bool IsCompactSave(const std::vector<uint8_t>& contents) {
+    return !contents.empty() && ((contents[0] & 0xF0) == 0x80 || contents[0] == 0xDE || contents[0] == 0xDF);
+}
+
+static nlohmann::json ParseSaveFile(std::istream& input) {
+    std::vector<uint8_t> contents((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    return IsCompactSave(contents) ? nlohmann::json::from_msgpack(contents) : nlohmann::json::parse(contents);
+}
+
+static void FillMetaInfo(const SaveContext& saveContext, SaveFileMetaInfo& info) {
+    info.valid = true;
+    info.deaths = saveContext.deaths;
+    for (int i = 0; i < ARRAY_COUNT(info.playerName); i++) {
+        info.playerName[i] = saveContext.playerName[i];
+    }
+    info.healthCapacity = saveContext.healthCapacity;
+    info.questItems = saveContext.inventory.questItems;
+    for (int i = 0; i < ARRAY_COUNT(info.inventoryItems); i++) {
+        info.inventoryItems[i] = saveContext.inventory.items[i];
+    }
+    info.equipment = saveContext.inventory.equipment;
+    info.upgrades = saveContext.inventory.upgrades;
+    info.isMagicAcquired = saveContext.isMagicAcquired;
+    info.isDoubleMagicAcquired = saveContext.isDoubleMagicAcquired;
+    info.rupees = saveContext.rupees;
+    info.gsTokens = saveContext.inventory.gsTokens;
+    info.isDoubleDefenseAcquired = saveContext.isDoubleDefenseAcquired;
+    // Same as Flags_GetRandomizerInf, which only looks at gSaveContext
+    info.gregFound = (saveContext.randomizerInf[RAND_INF_GREG_FOUND >> 4] & (1 << (RAND_INF_GREG_FOUND & 0xF))) != 0;
+    info.defense = saveContext.inventory.defenseHearts;
+    info.health = saveContext.health;
+
+    for (int i = 0; i < ARRAY_COUNT(info.seedHash); i++) {
+        info.seedHash[i] = saveContext.seedIcons[i];
+    }
+
+    bool isRando = saveContext.questId == QUEST_RANDOMIZER;
+    bool isMasterQuest = saveContext.questId == QUEST_MASTER;
+    info.randoSave = isRando;
+    // If the file is marked as a Master Quest file or if we're randomized and have at least one master quest dungeon, we need the mq otr.
+    info.requiresMasterQuest = isMasterQuest || (isRando && saveContext.mqDungeonCount > 0);
+    // If the file is not marked as Master Quest, it could still theoretically be a rando save with all 12 MQ dungeons, in which case
+    // we don't actually require a vanilla OTR.
+    info.requiresOriginal = !isMasterQuest && (!isRando || saveContext.mqDungeonCount < 12);
+
+    info.buildVersionMajor = saveContext.sohStats.buildVersionMajor;
+    info.buildVersionMinor = saveContext.sohStats.buildVersionMinor;
+    info.buildVersionPatch = saveContext.sohStats.buildVersionPatch;
+    SohUtils::CopyStringToCharArray(info.buildVersion, saveContext.sohStats.buildVersion,
+                                    ARRAY_COUNT(info.buildVersion));
+}
+
+// LoadData and LoadArray for a json block other than currentJsonContext, so they can be used off the main thread
+template <typename T> static void LoadMetaData(const nlohmann::json& block, const char* name, T& data) {
+    auto it = block.find(name);
+    if (it == block.end()) {
+        data = T{};
+    } else {
+        it->get_to(data);
+    }
+}
+
+template <typename T, size_t N> static void LoadMetaArray(const nlohmann::json& block, const char* name, T (&data)[N]) {
+    auto it = block.find(name);
+    size_t i = 0;
+    if (it != block.end()) {
+        for (; i < N && i < it->size(); i++) {
+            (*it)[i].get_to(data[i]);
+        }
+    }
+    for (; i < N; i++) {
+        data[i] = T{};
+    }
+}
+
+// Loads only the fields FillMetaInfo looks at, the same way the base, randomizer and stats section loaders would.
+// Returns false on anything it doesn't know how to read, those saves get a full load instead.
+static bool LoadMetaSaveContext(const nlohmann::json& saveBlock, SaveContext& saveContext) {
+    static const nlohmann::json emptyBlock = nlohmann::json::object();
+
+    if (saveBlock.at("version").get<int>() != 1) {
+        return false;
+    }
+    const nlohmann::json& sections = saveBlock.at("sections");
+
+    auto base = sections.find("base");
+    if (base == sections.end()) {
+        return false;
+    }
+    int baseVersion = base->at("version").get<int>();
+    if (baseVersion < 1 || baseVersion > 4) {
+        return false;
+    }
+    const nlohmann::json& baseData = base->at("data");
+    LoadMetaData(baseData, "deaths", saveContext.deaths);
+    LoadMetaArray(baseData, "playerName", saveContext.playerName);
+    int isRando = 0;
+    LoadMetaData(baseData, "n64ddFlag", isRando);
+    if (isRando) {
+        saveContext.questId = QUEST_RANDOMIZER;
+    }
+    LoadMetaData(baseData, "healthCapacity", saveContext.healthCapacity);
+    LoadMetaData(baseData, "health", saveContext.health);
+    LoadMetaData(baseData, "rupees", saveContext.rupees);
+    if (baseVersion <= 2) {
+        LoadMetaData(baseData, "magicAcquired", saveContext.isMagicAcquired);
+        LoadMetaData(baseData, "doubleMagic", saveContext.isDoubleMagicAcquired);
+        LoadMetaData(baseData, "doubleDefense", saveContext.isDoubleDefenseAcquired);
+    } else {
+        LoadMetaData(baseData, "isMagicAcquired", saveContext.isMagicAcquired);
+        LoadMetaData(baseData, "isDoubleMagicAcquired", saveContext.isDoubleMagicAcquired);
+        LoadMetaData(baseData, "isDoubleDefenseAcquired", saveContext.isDoubleDefenseAcquired);
+    }
+    auto inventory = baseData.find("inventory");
+    const nlohmann::json& inventoryData = inventory != baseData.end() ? *inventory : emptyBlock;
+    LoadMetaArray(inventoryData, "items", saveContext.inventory.items);
+    LoadMetaData(inventoryData, "equipment", saveContext.inventory.equipment);
+    LoadMetaData(inventoryData, "upgrades", saveContext.inventory.upgrades);
+    LoadMetaData(inventoryData, "questItems", saveContext.inventory.questItems);
+    LoadMetaData(inventoryData, "defenseHearts", saveContext.inventory.defenseHearts);
+    LoadMetaData(inventoryData, "gsTokens", saveContext.inventory.gsTokens);
+    LoadMetaArray(baseData, "randomizerInf", saveContext.randomizerInf);
+    if (baseVersion >= 2) {
+        int isMQ = 0;
+        LoadMetaData(baseData, "isMasterQuest", isMQ);
+        if (isMQ) {
+            saveContext.questId = QUEST_MASTER;
+        }
+    }
+    // Workaround for breaking save compatibility from 5.0.2 -> 5.1.0, see LoadBaseVersion2
+    if (baseVersion == 2) {
+        if (!saveContext.isMagicAcquired) {
+            LoadMetaData(baseData, "isMagicAcquired", saveContext.isMagicAcquired);
+        }
+        if (!saveContext.isDoubleMagicAcquired) {
+            LoadMetaData(baseData, "isDoubleMagicAcquired", saveContext.isDoubleMagicAcquired);
+        }
+        if (!saveContext.isDoubleDefenseAcquired) {
+            LoadMetaData(baseData, "isDoubleDefenseAcquired", saveContext.isDoubleDefenseAcquired);
+        }
+    }
+
+    auto randomizer = sections.find("randomizer");
+    if (randomizer != sections.end()) {
+        int randomizerVersion = randomizer->at("version").get<int>();
+        const nlohmann::json& randomizerData = randomizer->at("data");
+        if (randomizerVersion == 1) {
+            for (int i = 0; i < ARRAY_COUNT(saveContext.seedIcons); i++) {
+                LoadMetaData(randomizerData, ("seed" + std::to_string(i)).c_str(), saveContext.seedIcons[i]);
+            }
+        } else if (randomizerVersion == 2) {
+            LoadMetaArray(randomizerData, "seed", saveContext.seedIcons);
+            LoadMetaData(randomizerData, "masterQuestDungeonCount", saveContext.mqDungeonCount);
+        } else {
+            return false;
+        }
+    }
+
+    auto stats = sections.find("sohStats");
+    if (stats != sections.end()) {
+        if (stats->at("version").get<int>() != 1) {
+            return false;
+        }
+        const nlohmann::json& statsData = stats->at("data");
+        std::string buildVersion;
+        LoadMetaData(statsData, "buildVersion", buildVersion);
+        SohUtils::CopyStringToCharArray(saveContext.sohStats.buildVersion, buildVersion,
+                                        ARRAY_COUNT(saveContext.sohStats.buildVersion));
+        LoadMetaData(statsData, "buildVersionMajor", saveContext.sohStats.buildVersionMajor);
+        LoadMetaData(statsData, "buildVersionMinor", saveContext.sohStats.buildVersionMinor);
+        LoadMetaData(statsData, "buildVersionPatch", saveContext.sohStats.buildVersionPatch);
+    } else {
+        // Saves from before the stats were tracked get the current build from InitStats
+        SohUtils::CopyStringToCharArray(saveContext.sohStats.buildVersion, std::string((char*)gBuildVersion),
+                                        ARRAY_COUNT(saveContext.sohStats.buildVersion));
+        saveContext.sohStats.buildVersionMajor = gBuildVersionMajor;
+        saveContext.sohStats.buildVersionMinor = gBuildVersionMinor;
+        saveContext.sohStats.buildVersionPatch = gBuildVersionPatch;
+    }
+
+    return true;
+}
+
+static bool ReadMetaInfo(const std::filesystem::path& fileName, uint8_t defaultQuestId, SaveFileMetaInfo& info) {
+    try {
+        std::ifstream input(fileName, std::ios::binary);
+        nlohmann::json saveBlock = ParseSaveFile(input);
+        // Everything InitFile doesn't set is left zeroed, unlike LoadFile which keeps whatever the last file had
+        auto saveContext = std::make_unique<SaveContext>();
+        saveContext->questId = defaultQuestId;
+        if (!LoadMetaSaveContext(saveBlock, *saveContext)) {
+            return false;
+        }
+        FillMetaInfo(*saveContext, info);
+        return true;
+    } catch (const std::exception& e) {
+        return false;
+    }
+}
+
 // Init() here is an extension of InitSram, and thus not truly an initializer for SaveManager itself. don't put any class initialization stuff here
 void SaveManager::Init() {
     // Wait on saves that snuck through the Wait in OnExitGame
@@ -416,54 +618,32 @@ void SaveManager::Init() {
         CreateDefaultGlobal();
     }
 
-    // Load files to initialize metadata
+    // Only read what the file select screen shows for now, a file is fully loaded once it's opened. The slots are
+    // read at the same time, slots that can't be read that way are fully loaded to get their metadata.
+    uint8_t defaultQuestId = OTRGlobals::Instance->HasOriginal() ? QUEST_NORMAL : QUEST_MASTER;
+    std::array<std::future<bool>, MaxFiles> metaInfoRead;
+    BS::thread_pool metaThreadPool(MaxFiles);
     for (int fileNum = 0; fileNum < MaxFiles; fileNum++) {
-        if (std::filesystem::exists(GetFileName(fileNum))) {
-            LoadFile(fileNum);
-            saveBlock = nlohmann::json::object();
+        std::filesystem::path fileName = GetFileName(fileNum);
+        if (std::filesystem::exists(fileName)) {
+            metaInfoRead[fileNum] = metaThreadPool.submit_task([this, fileName, defaultQuestId, fileNum]() {
+                return ReadMetaInfo(fileName, defaultQuestId, fileMetaInfo[fileNum]);
+            });
         }
-
+    }
+    for (int fileNum = 0; fileNum < MaxFiles; fileNum++) {
+        if (!metaInfoRead[fileNum].valid() || metaInfoRead[fileNum].get()) {
+            continue;
+        }
+        SPDLOG_WARN("Couldn't read the metadata of save file {}, loading it fully", fileNum + 1);
+        LoadFile(fileNum);
+        saveBlock = nlohmann::json::object();
+        encodedSections.clear();
     }
 }
 
 void SaveManager::InitMeta(int fileNum) {
-    fileMetaInfo[fileNum].valid = true;
-    fileMetaInfo[fileNum].deaths = gSaveContext.deaths;
-    for (int i = 0; i < ARRAY_COUNT(fileMetaInfo[fileNum].playerName); i++) {
-        fileMetaInfo[fileNum].playerName[i] = gSaveContext.playerName[i];
-    }
-    fileMetaInfo[fileNum].healthCapacity = gSaveContext.healthCapacity;
-    fileMetaInfo[fileNum].questItems = gSaveContext.inventory.questItems;
-    for (int i = 0; i < ARRAY_COUNT(fileMetaInfo[fileNum].inventoryItems); i++) {
-        fileMetaInfo[fileNum].inventoryItems[i] = gSaveContext.inventory.items[i];
-    }
-    fileMetaInfo[fileNum].equipment = gSaveContext.inventory.equipment;
-    fileMetaInfo[fileNum].upgrades = gSaveContext.inventory.upgrades;
-    fileMetaInfo[fileNum].isMagicAcquired = gSaveContext.isMagicAcquired;
-    fileMetaInfo[fileNum].isDoubleMagicAcquired = gSaveContext.isDoubleMagicAcquired;
-    fileMetaInfo[fileNum].rupees = gSaveContext.rupees;
-    fileMetaInfo[fileNum].gsTokens = gSaveContext.inventory.gsTokens;
-    fileMetaInfo[fileNum].isDoubleDefenseAcquired = gSaveContext.isDoubleDefenseAcquired;
-    fileMetaInfo[fileNum].gregFound = Flags_GetRandomizerInf(RAND_INF_GREG_FOUND);
-    fileMetaInfo[fileNum].defense = gSaveContext.inventory.defenseHearts;
-    fileMetaInfo[fileNum].health = gSaveContext.health;
-
-    for (int i = 0; i < ARRAY_COUNT(fileMetaInfo[fileNum].seedHash); i++) {
-        fileMetaInfo[fileNum].seedHash[i] = gSaveContext.seedIcons[i];
-    }
-
-    fileMetaInfo[fileNum].randoSave = IS_RANDO;
-    // If the file is marked as a Master Quest file or if we're randomized and have at least one master quest dungeon, we need the mq otr.
-    fileMetaInfo[fileNum].requiresMasterQuest = IS_MASTER_QUEST || (IS_RANDO && gSaveContext.mqDungeonCount > 0);
-    // If the file is not marked as Master Quest, it could still theoretically be a rando save with all 12 MQ dungeons, in which case
-    // we don't actually require a vanilla OTR.
-    fileMetaInfo[fileNum].requiresOriginal = !IS_MASTER_QUEST && (!IS_RANDO || gSaveContext.mqDungeonCount < 12);
-
-    fileMetaInfo[fileNum].buildVersionMajor = gSaveContext.sohStats.buildVersionMajor;
-    fileMetaInfo[fileNum].buildVersionMinor = gSaveContext.sohStats.buildVersionMinor;
-    fileMetaInfo[fileNum].buildVersionPatch = gSaveContext.sohStats.buildVersionPatch;
-    SohUtils::CopyStringToCharArray(fileMetaInfo[fileNum].buildVersion, gSaveContext.sohStats.buildVersion,
-                                    ARRAY_COUNT(fileMetaInfo[fileNum].buildVersion));
+    FillMetaInfo(gSaveContext, fileMetaInfo[fileNum]);
 }
 
 void SaveManager::InitFile(bool isDebug) {
@@ -906,12 +1086,80 @@ int copy_file(const char* src, const char* dst) {
 }
 #endif
 
-// Threaded SaveFile takes copy of gSaveContext for local unmodified storage
+// Freshly saved top level values replace the ones in saveBlock the same way saving straight into it would. The
+// section is only marked as changed when one of them is actually different.
+void SaveManager::MergeSection(const std::string& name, int version, nlohmann::json& data, bool replace) {
+    nlohmann::json& sectionBlock = saveBlock["sections"][name];
+    nlohmann::json& sectionData = sectionBlock["data"];
 
-void SaveManager::SaveFileThreaded(int fileNum, SaveContext* saveContext, int sectionID) {
-    SPDLOG_INFO("Save File - fileNum: {}", fileNum);
-    // Needed for first time save, hasn't changed in forever anyway
-    saveBlock["version"] = 1;
+    bool changed = !sectionBlock.contains("version") || sectionBlock["version"] != version;
+    if (replace || !sectionData.is_object()) {
+        changed = changed || sectionData != data;
+    } else {
+        for (auto& item : data.items()) {
+            auto it = sectionData.find(item.key());
+            if (it == sectionData.end() || *it != item.value()) {
+                changed = true;
+                break;
+            }
+        }
+    }
+    if (!changed) {
+        return;
+    }
+
+    sectionBlock["version"] = version;
+    if (replace || !sectionData.is_object()) {
+        sectionData = std::move(data);
+    } else {
+        for (auto& item : data.items()) {
+            sectionData[item.key()] = std::move(item.value());
+        }
+    }
+    encodedSections.erase(name);
+}
+
+static void AppendMsgPackMapHeader(std::vector<uint8_t>& buffer, size_t size) {
+    if (size <= 0xF) {
+        buffer.push_back(0x80 | size);
+    } else if (size <= 0xFFFF) {
+        buffer.push_back(0xDE);
+        buffer.push_back(size >> 8);
+        buffer.push_back(size);
+    } else {
+        buffer.push_back(0xDF);
+        buffer.push_back(size >> 24);
+        buffer.push_back(size >> 16);
+        buffer.push_back(size >> 8);
+        buffer.push_back(size);
+    }
+}
+
+// Builds the same bytes as nlohmann::json::to_msgpack(saveBlock), reusing the encoding of unchanged sections
+std::vector<uint8_t> SaveManager::EncodeCompactSaveBlock() {
+    std::vector<uint8_t> buffer;
+    AppendMsgPackMapHeader(buffer, saveBlock.size());
+    for (auto& item : saveBlock.items()) {
+        nlohmann::json::to_msgpack(item.key(), buffer);
+        if (item.key() != "sections") {
+            nlohmann::json::to_msgpack(item.value(), buffer);
+            continue;
+        }
+
+        AppendMsgPackMapHeader(buffer, item.value().size());
+        for (auto& section : item.value().items()) {
+            nlohmann::json::to_msgpack(section.key(), buffer);
+            auto encoded = encodedSections.find(section.key());
+            if (encoded == encodedSections.end()) {
+                encoded = encodedSections.emplace(section.key(), nlohmann::json::to_msgpack(section.value())).first;
+            }
+            buffer.insert(buffer.end(), encoded->second.begin(), encoded->second.end());
+        }
+    }
+    return buffer;
+}
+
+void SaveManager::SaveSectionToBlock(SaveContext* saveContext, int sectionID) {
     if (sectionID == SECTION_ID_BASE) {
         for (auto& sectionHandlerPair : sectionSaveHandlers) {
             auto& saveFuncInfo = sectionHandlerPair.second;
@@ -919,17 +1167,17 @@ void SaveManager::SaveFileThreaded(int fileNum, SaveContext* saveContext, int se
             if (!saveFuncInfo.saveWithBase) {
                 continue;
             }
-            nlohmann::json& sectionBlock = saveBlock["sections"][saveFuncInfo.name];
-            sectionBlock["version"] = sectionHandlerPair.second.version;
+            nlohmann::json sectionData = nlohmann::json::object();
             // If any save file is loaded for medatata, or a spoiler log is loaded (not sure which at this point), there is still data in the "randomizer" section
             // This clears the randomizer data block if and only if the section being called is "randomizer" and the current save file is not a randomizer save file.
             if (sectionHandlerPair.second.name == "randomizer" && !IS_RANDO) {
-                sectionBlock["data"] = nlohmann::json::object();
+                MergeSection(saveFuncInfo.name, saveFuncInfo.version, sectionData, true);
                 continue;
             }
 
-            currentJsonContext = &sectionBlock["data"];
+            currentJsonContext = &sectionData;
             sectionHandlerPair.second.func(saveContext, sectionID, true);
+            MergeSection(saveFuncInfo.name, saveFuncInfo.version, sectionData, false);
         }
     } else {
         SaveFuncInfo svi = sectionSaveHandlers.find(sectionID)->second;
@@ -945,47 +1193,105 @@ void SaveManager::SaveFileThreaded(int fileNum, SaveContext* saveContext, int se
         sectionBlock["version"] = sectionVersion;
         currentJsonContext = &sectionBlock["data"];
         svi.func(saveContext, sectionID, false);
+        encodedSections.erase(sectionName);
     }
+}
+
+// Threaded SaveFile takes copy of gSaveContext for local unmodified storage
+
+void SaveManager::SaveFileThreaded(int fileNum, SaveContext* saveContext, int sectionID, bool compact) {
+    SPDLOG_INFO("Save File - fileNum: {}", fileNum);
+    // Needed for first time save, hasn't changed in forever anyway
+    saveBlock["version"] = 1;
+    SaveSectionToBlock(saveContext, sectionID);
 
     std::filesystem::path fileName = GetFileName(fileNum);
     std::filesystem::path tempFile = GetFileTempName(fileNum);
 
+    std::vector<uint8_t> compactBlock;
+    std::string jsonBlock;
+    if (compact) {
+        compactBlock = EncodeCompactSaveBlock();
+    } else {
+        jsonBlock = saveBlock.dump(4) + "\n";
+    }
+    const char* contents = compact ? (const char*)compactBlock.data() : jsonBlock.data();
+    size_t contentsSize = compact ? compactBlock.size() : jsonBlock.size();
+
     if (std::filesystem::exists(tempFile)) {
         std::filesystem::remove(tempFile);
     }
 
 #if defined(__SWITCH__) || defined(__WIIU__)
-    FILE* w = fopen(tempFile.c_str(), "w");
-    std::string json_string = saveBlock.dump(4);
-    fwrite(json_string.c_str(), sizeof(char), json_string.length(), w);
+    FILE* w = fopen(tempFile.c_str(), "wb");
+    fwrite(contents, sizeof(char), contentsSize, w);
     fclose(w);
-#else
-    std::ofstream output(tempFile);
-    output << std::setw(4) << saveBlock << std::endl;
-    output.close();
-#endif
 
     if (std::filesystem::exists(fileName)) {
         std::filesystem::remove(fileName);
     }
-    
-#if defined(__SWITCH__) || defined(__WIIU__)
+
     copy_file(tempFile.c_str(), fileName.c_str());
-#else
-    std::filesystem::copy_file(tempFile, fileName);
-#endif
-    
+
     if (std::filesystem::exists(tempFile)) {
         std::filesystem::remove(tempFile);
     }
+#else
+    std::ofstream output(tempFile, compact ? std::ios::binary : std::ios::out);
+    output.write(contents, contentsSize);
+    output.close();
+
+    // Renaming over the old save replaces it in one step, so there's never a moment without a save file on disk
+    std::error_code error;
+    std::filesystem::rename(tempFile, fileName, error);
+    if (error) {
+        SPDLOG_WARN("Save File - couldn't replace {}: {}", fileName.string(), error.message());
+        if (std::filesystem::exists(fileName)) {
+            std::filesystem::remove(fileName);
+        }
+        std::filesystem::copy_file(tempFile, fileName);
+        std::filesystem::remove(tempFile);
+    }
+#endif
 
-    delete saveContext;
     InitMeta(fileNum);
     GameInteractor::Instance->ExecuteHooks<GameInteractor::OnSaveFile>(fileNum);
     SPDLOG_INFO("Save File Finish - fileNum: {}", fileNum);
 }
 
-// SaveSection creates a copy of gSaveContext to prevent mid-save data modification, and passes its reference to SaveFileThreaded
+// Whether a full save already saves this section, subsections are saved with their parent
+bool SaveManager::IsSavedWithBase(int sectionID) {
+    const SaveFuncInfo& svi = sectionSaveHandlers.find(sectionID)->second;
+    if (svi.parentSection != -1 && svi.parentSection < sectionIndex) {
+        return sectionSaveHandlers.find(svi.parentSection)->second.saveWithBase;
+    }
+    return svi.saveWithBase;
+}
+
+void SaveManager::WritePendingSave(int fileNum) {
+    SaveQueue<SaveContext>::Write write;
+    {
+        std::lock_guard<std::mutex> lock(saveQueueMutex);
+        write = saveQueue.Pop(fileNum);
+    }
+
+    SaveFileThreaded(fileNum, write.snapshot.get(), write.sectionID, write.compact);
+
+    double latencyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() -
+                                                                 write.firstRequestTime).count();
+    SPDLOG_INFO("Save File - fileNum: {} wrote {} requests in {:.1f} ms", fileNum, write.requests, latencyMs);
+
+    std::lock_guard<std::mutex> lock(saveQueueMutex);
+    saveQueue.ReleaseSnapshot(std::move(write.snapshot));
+    saveQueueStats.writes++;
+    saveQueueStats.lastLatencyMs = latencyMs;
+    saveQueueStats.averageLatencyMs += (latencyMs - saveQueueStats.averageLatencyMs) / saveQueueStats.writes;
+    saveQueueStats.maxLatencyMs = std::max(saveQueueStats.maxLatencyMs, latencyMs);
+}
+
+// SaveSection takes a copy of gSaveContext to prevent mid-save data modification. Threaded saves are queued, and a
+// request that saves what the file's last waiting write does replaces that write's copy instead of writing again, see
+// SaveQueue.
 // This should never be called with threaded == false except during file creation
 void SaveManager::SaveSection(int fileNum, int sectionID, bool threaded) {
     // Don't save in Boss rush.
@@ -997,13 +1303,35 @@ void SaveManager::SaveSection(int fileNum, int sectionID, bool threaded) {
         SPDLOG_ERROR("SaveSection: Section ID not registered.");
         return;
     }
-    auto saveContext = new SaveContext;
-    memcpy(saveContext, &gSaveContext, sizeof(gSaveContext));
-    if (threaded) {
-        smThreadPool->detach_task(std::bind(&SaveManager::SaveFileThreaded, this, fileNum, saveContext, sectionID));
-    } else {
-        SaveFileThreaded(fileNum, saveContext, sectionID);
+    bool compact = CVarGetInteger(CVAR_ENHANCEMENT("CompactSaves"), 0);
+    if (!threaded) {
+        // Queued saves would overwrite this one if they were written after it
+        ThreadPoolWait();
+        std::unique_ptr<SaveContext> saveContext;
+        {
+            std::lock_guard<std::mutex> lock(saveQueueMutex);
+            saveContext = saveQueue.AcquireSnapshot();
+        }
+        memcpy(saveContext.get(), &gSaveContext, sizeof(gSaveContext));
+        SaveFileThreaded(fileNum, saveContext.get(), sectionID, compact);
+        std::lock_guard<std::mutex> lock(saveQueueMutex);
+        saveQueue.ReleaseSnapshot(std::move(saveContext));
+        return;
     }
+
+    std::lock_guard<std::mutex> lock(saveQueueMutex);
+    // The writer thread takes the file's writes in the order they were queued
+    if (saveQueue.Push(fileNum, sectionID, gSaveContext, compact)) {
+        smThreadPool->detach_task(std::bind(&SaveManager::WritePendingSave, this, fileNum));
+    }
+    saveQueueStats.requests++;
+}
+
+SaveManager::SaveQueueStats SaveManager::GetSaveQueueStats() {
+    std::lock_guard<std::mutex> lock(saveQueueMutex);
+    SaveQueueStats stats = saveQueueStats;
+    stats.queueDepth = saveQueue.GetDepth();
+    return stats;
 }
 
 void SaveManager::SaveFile(int fileNum) {
@@ -1030,11 +1358,12 @@ void SaveManager::LoadFile(int fileNum) {
     assert(std::filesystem::exists(fileName));
     InitFile(false);
 
-    std::ifstream input(fileName);
+    std::ifstream input(fileName, std::ios::binary);
     
     try {
         saveBlock = nlohmann::json::object();
-        input >> saveBlock;
+        encodedSections.clear();
+        saveBlock = ParseSaveFile(input);
         if (!saveBlock.contains("version")) {
             SPDLOG_ERROR("Save at " + fileName.string() + " contains no version");
             assert(false);
@@ -38,6 +38,7 @@ typedef struct {
 #include <tuple>
 #include <functional>
 #include <vector>
+#include <mutex>
 #include <filesystem>
 
 #define BS_THREAD_POOL_ENABLE_PRIORITY
@@ -45,6 +46,7 @@ typedef struct {
 #include <BS_thread_pool.hpp>
 
 #include "z64save.h"
+#include "SaveQueue.h"
 
 #include <nlohmann/json.hpp>
 
@@ -68,6 +70,18 @@ class SaveManager {
         int parentSection;
     } SaveFuncInfo;
 
+    typedef struct {
+        // SaveSection calls that were queued, and how many writes they turned into
+        size_t requests;
+        size_t writes;
+        // Writes waiting, for every file
+        size_t queueDepth;
+        // Time from the first queued request of a write to the write finishing
+        double lastLatencyMs;
+        double averageLatencyMs;
+        double maxLatencyMs;
+    } SaveQueueStats;
+
     SaveManager();
 
     void Init();
@@ -79,6 +93,7 @@ class SaveManager {
     void LoadFile(int fileNum);
     bool SaveFile_Exist(int fileNum);
     void ThreadPoolWait();
+    SaveQueueStats GetSaveQueueStats();
 
     // Adds a function that is called when we are intializing a save, including when we are loading a save.
     void AddInitFunction(InitFunc func);
@@ -151,7 +166,12 @@ class SaveManager {
     void ConvertFromUnversioned();
     void CreateDefaultGlobal();
 
-    void SaveFileThreaded(int fileNum, SaveContext* saveContext, int sectionID);
+    void SaveFileThreaded(int fileNum, SaveContext* saveContext, int sectionID, bool compact);
+    void SaveSectionToBlock(SaveContext* saveContext, int sectionID);
+    bool IsSavedWithBase(int sectionID);
+    void WritePendingSave(int fileNum);
+    void MergeSection(const std::string& name, int version, nlohmann::json& data, bool replace);
+    std::vector<uint8_t> EncodeCompactSaveBlock();
 
     void InitMeta(int slotNum);
     static void InitFileImpl(bool isDebug);
@@ -181,6 +201,15 @@ class SaveManager {
 
     std::map<std::string, PostFunc> postHandlers;
 
+    // MessagePack encoding of each section in saveBlock, kept until the section changes so compact saves only
+    // re-encode what changed. Must be cleared whenever saveBlock is replaced.
+    std::map<std::string, std::vector<uint8_t>> encodedSections;
+
+    // Saves queued by SaveSection, see SaveQueue
+    std::mutex saveQueueMutex;
+    SaveQueue<SaveContext> saveQueue{ SECTION_ID_BASE, [this](int sectionID) { return IsSavedWithBase(sectionID); } };
+    SaveQueueStats saveQueueStats = {};
+
     nlohmann::json* currentJsonContext = nullptr;
     nlohmann::json::iterator currentJsonArrayContext;
     std::shared_ptr<BS::thread_pool> smThreadPool;
@@ -0,0 +1,99 @@
+#ifndef SAVE_QUEUE_H
+#define SAVE_QUEUE_H
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Section saves waiting to be written, per file in the order they were requested, each with its own snapshot of the
+// save context. A request is merged into its file's last waiting write when it saves the section that write does,
+// and that write takes the request's snapshot, so a burst of the same save is written once with the latest state.
+// Any other request is queued as a write of its own: refreshing the snapshot of a write it doesn't cover would save
+// that write's section as it is now instead of as it was when it was asked for, like an autosave picking up
+// the temporary B button item Play_PerformSave puts back after saving. Not thread safe, SaveManager locks around it.
+template <typename Snapshot> class SaveQueue {
+  public:
+    struct Write {
+        std::unique_ptr<Snapshot> snapshot;
+        int sectionID = 0;
+        bool compact = false;
+        // SaveSection calls merged into this write
+        size_t requests = 0;
+        std::chrono::steady_clock::time_point firstRequestTime;
+    };
+
+    // A save of baseSectionID is a full save, which also saves every section isSavedWithBase is true for
+    SaveQueue(int baseSectionID, std::function<bool(int)> isSavedWithBase)
+        : mBaseSectionID(baseSectionID), mIsSavedWithBase(std::move(isSavedWithBase)) {
+    }
+
+    // Returns true when the request was queued as a new write, which the caller then has to get written with Pop
+    bool Push(int fileNum, int sectionID, const Snapshot& current, bool compact) {
+        std::deque<Write>& writes = mWrites[fileNum];
+        bool newWrite = writes.empty() || !Covers(sectionID, writes.back().sectionID);
+        if (newWrite) {
+            Write& write = writes.emplace_back();
+            write.snapshot = AcquireSnapshot();
+            write.firstRequestTime = std::chrono::steady_clock::now();
+        }
+
+        Write& write = writes.back();
+        *write.snapshot = current;
+        write.sectionID = sectionID;
+        write.compact = compact;
+        write.requests++;
+        return newWrite;
+    }
+
+    // Takes the file's oldest waiting write, there must be one
+    Write Pop(int fileNum) {
+        auto it = mWrites.find(fileNum);
+        Write write = std::move(it->second.front());
+        it->second.pop_front();
+        if (it->second.empty()) {
+            mWrites.erase(it);
+        }
+        return write;
+    }
+
+    // Snapshots are reused once their write is done, so they only take memory for the writes waiting
+    std::unique_ptr<Snapshot> AcquireSnapshot() {
+        if (mFreeSnapshots.empty()) {
+            return std::make_unique<Snapshot>();
+        }
+        std::unique_ptr<Snapshot> snapshot = std::move(mFreeSnapshots.back());
+        mFreeSnapshots.pop_back();
+        return snapshot;
+    }
+
+    void ReleaseSnapshot(std::unique_ptr<Snapshot> snapshot) {
+        mFreeSnapshots.push_back(std::move(snapshot));
+    }
+
+    // Writes waiting, for every file
+    size_t GetDepth() const {
+        size_t depth = 0;
+        for (const auto& [fileNum, writes] : mWrites) {
+            depth += writes.size();
+        }
+        return depth;
+    }
+
+  private:
+    // Whether saving sectionID also saves pendingID
+    bool Covers(int sectionID, int pendingID) const {
+        return pendingID == sectionID || (sectionID == mBaseSectionID && mIsSavedWithBase(pendingID));
+    }
+
+    int mBaseSectionID;
+    std::function<bool(int)> mIsSavedWithBase;
+    std::map<int, std::deque<Write>> mWrites;
+    std::vector<std::unique_ptr<Snapshot>> mFreeSnapshots;
+};
+
+#endif
@@ -0,0 +1,215 @@
+#include "ScenePrefetcher.h"
+#include "ResourcePreloader.h"
+
+#include <libultraship/libultraship.h>
+#include <utils/StringHelper.h>
+#include "soh/Enhancements/game-interactor/GameInteractor.h"
+#include "soh/resource/type/Scene.h"
+#include "soh/resource/type/scenecommand/SetEntranceList.h"
+#include "soh/resource/type/scenecommand/SetObjectList.h"
+#include "soh/resource/type/scenecommand/SetRoomList.h"
+#include "soh/resource/type/scenecommand/SetSpecialObjects.h"
+
+extern "C" {
+#include <z64.h>
+#include "macros.h"
+#include "functions.h"
+#include "variables.h"
+#include "soh/Enhancements/randomizer/randomizer_entrance.h"
+extern PlayState* gPlayState;
+}
+
+std::string OTRPlay_GetSceneDirectory(s32 sceneNum);
+std::string GetPathHandlingMQ(const char* path);
+std::string GetPathHandlingMQ(const char* path, int16_t sceneNum);
+
+// How close the player has to get to an exit or a door before what's behind it starts loading
+#define PREFETCH_DISTANCE 800.0f
+
+ScenePrefetcher* ScenePrefetcher::Instance;
+
+ScenePrefetcher::ScenePrefetcher() {
+    GameInteractor::Instance->RegisterGameHook<GameInteractor::OnSceneInit>([](int16_t sceneNum) {
+        ScenePrefetcher::Instance->OnSceneInit();
+    });
+    GameInteractor::Instance->RegisterGameHook<GameInteractor::OnPlayerUpdate>([]() {
+        ScenePrefetcher::Instance->OnPlayerUpdate();
+    });
+}
+
+void ScenePrefetcher::OnSceneInit() {
+    // Whatever is still loading for the previous scene keeps loading, it's just not followed up on anymore
+    mExitPointsFound = false;
+    mExitPoints.clear();
+    mPrefetchedEntrances.clear();
+    mPrefetchedRooms.clear();
+    mPrefetchedObjects.clear();
+    mSteps.clear();
+}
+
+static bool IsNear(Player* player, float x, float y, float z) {
+    float dx = player->actor.world.pos.x - x;
+    float dy = player->actor.world.pos.y - y;
+    float dz = player->actor.world.pos.z - z;
+
+    return dx * dx + dy * dy + dz * dz < PREFETCH_DISTANCE * PREFETCH_DISTANCE;
+}
+
+void ScenePrefetcher::OnPlayerUpdate() {
+    if (!CVarGetInteger(CVAR_SETTING("PrefetchScenes"), 0)) {
+        return;
+    }
+
+    // The scene's collision isn't set up yet when OnSceneInit runs
+    if (!mExitPointsFound) {
+        FindExitPoints();
+        mExitPointsFound = true;
+    }
+
+    Player* player = GET_PLAYER(gPlayState);
+
+    for (const ExitPoint& exit : mExitPoints) {
+        if (IsNear(player, exit.x, exit.y, exit.z)) {
+            PrefetchEntrance(gPlayState->setupExitList[exit.exitIndex - 1]);
+        }
+    }
+
+    // Doors and the like lead to other rooms of this scene
+    for (s32 i = 0; i < gPlayState->transiActorCtx.numActors; i++) {
+        TransitionActorEntry* entry = &gPlayState->transiActorCtx.list[i];
+
+        if (!IsNear(player, entry->pos.x, entry->pos.y, entry->pos.z)) {
+            continue;
+        }
+        for (s32 side = 0; side < 2; side++) {
+            s8 room = entry->sides[side].room;
+
+            if (room >= 0 && room < gPlayState->numRooms && room != gPlayState->roomCtx.curRoom.num) {
+                PrefetchRoom(GetPathHandlingMQ(gPlayState->roomList[room].fileName), gPlayState->sceneNum);
+            }
+        }
+    }
+
+    ContinueSteps();
+}
+
+void ScenePrefetcher::FindExitPoints() {
+    CollisionHeader* colHeader = gPlayState->colCtx.colHeader;
+
+    if (colHeader == nullptr || gPlayState->setupExitList == nullptr) {
+        return;
+    }
+
+    // One point in the middle of every polygon that takes the player to another scene
+    for (s32 i = 0; i < colHeader->numPolygons; i++) {
+        CollisionPoly* poly = &colHeader->polyList[i];
+        u32 exitIndex = SurfaceType_GetSceneExitIndex(&gPlayState->colCtx, poly, BGCHECK_SCENE);
+
+        if (exitIndex == 0) {
+            continue;
+        }
+
+        Vec3s* a = &colHeader->vtxList[COLPOLY_VTX_INDEX(poly->flags_vIA)];
+        Vec3s* b = &colHeader->vtxList[COLPOLY_VTX_INDEX(poly->flags_vIB)];
+        Vec3s* c = &colHeader->vtxList[poly->vIC];
+        mExitPoints.push_back({ (a->x + b->x + c->x) / 3.0f, (a->y + b->y + c->y) / 3.0f, (a->z + b->z + c->z) / 3.0f,
+                                exitIndex });
+    }
+}
+
+void ScenePrefetcher::PrefetchEntrance(int16_t entranceIndex) {
+    // Only looks the override up, Entrance_OverrideNextIndex would also mark the entrance as discovered
+    if (IS_RANDO) {
+        entranceIndex = Entrance_GetOverride(entranceIndex);
+    }
+
+    // Grottos and fairy fountains only pick where they lead once the transition starts
+    if (entranceIndex < 0 || entranceIndex >= ENTR_MAX || !mPrefetchedEntrances.insert(entranceIndex).second) {
+        return;
+    }
+
+    EntranceInfo* entrance = &gEntranceTable[entranceIndex];
+    std::string path = OTRPlay_GetSceneDirectory(entrance->scene) + gSceneTable[entrance->scene].sceneFile.fileName;
+
+    ResourcePreloader::Instance->QueueFile(path, BS::pr::low);
+    mSteps.push_back({ StepType::Scene, path, entrance->scene, entrance->spawn });
+}
+
+void ScenePrefetcher::PrefetchRoom(const std::string& path, int16_t sceneNum) {
+    if (!mPrefetchedRooms.insert(path).second) {
+        return;
+    }
+
+    ResourcePreloader::Instance->QueueFile(path, BS::pr::low);
+    mSteps.push_back({ StepType::Room, path, sceneNum, 0 });
+}
+
+void ScenePrefetcher::PrefetchObject(int16_t objectId) {
+    // Objects already in the bank can be loading on this thread as they're drawn, loading them a second time on a
+    // worker would replace them in the resource cache while they're in use
+    if (objectId <= 0 || objectId >= OBJECT_ID_MAX || gObjectTable[objectId].fileName[0] == '\0' ||
+        Object_GetIndex(&gPlayState->objectCtx, objectId) >= 0 || !mPrefetchedObjects.insert(objectId).second) {
+        return;
+    }
+
+    ResourcePreloader::Instance->QueueInBackground(
+        StringHelper::Sprintf("objects/%s/*", gObjectTable[objectId].fileName), BS::pr::low);
+}
+
+void ScenePrefetcher::ContinueSteps() {
+    for (size_t i = 0; i < mSteps.size();) {
+        if (!ResourcePreloader::Instance->IsReady(mSteps[i].path)) {
+            i++;
+            continue;
+        }
+
+        Step step = mSteps[i];
+        mSteps.erase(mSteps.begin() + i);
+
+        // Already loaded, so this comes straight out of the resource cache
+        auto scene = std::static_pointer_cast<SOH::Scene>(
+            Ship::Context::GetInstance()->GetResourceManager()->LoadResource(step.path));
+        if (scene == nullptr) {
+            continue;
+        }
+
+        SOH::SetEntranceList* entranceList = nullptr;
+        SOH::SetRoomList* roomList = nullptr;
+
+        for (auto& cmd : scene->commands) {
+            if (cmd == nullptr) {
+                continue;
+            }
+
+            switch (cmd->cmdId) {
+                case SOH::SceneCommandID::SetObjectList:
+                    for (int16_t objectId : std::static_pointer_cast<SOH::SetObjectList>(cmd)->objects) {
+                        PrefetchObject(objectId);
+                    }
+                    break;
+                case SOH::SceneCommandID::SetSpecialObjects:
+                    PrefetchObject(std::static_pointer_cast<SOH::SetSpecialObjects>(cmd)->specialObjects.globalObject);
+                    break;
+                case SOH::SceneCommandID::SetEntranceList:
+                    entranceList = (SOH::SetEntranceList*)cmd.get();
+                    break;
+                case SOH::SceneCommandID::SetRoomList:
+                    roomList = (SOH::SetRoomList*)cmd.get();
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        // Scenes lead on to the room the entrance spawns the player in
+        if (step.type == StepType::Scene && entranceList != nullptr && roomList != nullptr &&
+            (size_t)step.spawn < entranceList->entrances.size()) {
+            u8 room = entranceList->entrances[step.spawn].room;
+
+            // The destination can be MQ when the current scene isn't, or the other way around
+            if (room < roomList->fileNames.size()) {
+                PrefetchRoom(GetPathHandlingMQ(roomList->fileNames[room].c_str(), step.sceneNum), step.sceneNum);
+            }
+        }
+    }
+}
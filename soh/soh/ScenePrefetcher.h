@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+// Watches how close the player is to the current scene's exits and doors, and loads whatever is behind them in the
+// background before the player walks through: the next scene, the room the player spawns in there and the objects
+// both of them use. Loading goes through ResourcePreloader, so scene, room and object loads wait on it when the
+// transition actually happens.
+class ScenePrefetcher {
+  public:
+    static ScenePrefetcher* Instance;
+
+    ScenePrefetcher();
+
+  private:
+    struct ExitPoint {
+        float x, y, z;
+        uint32_t exitIndex;
+    };
+
+    enum class StepType { Scene, Room };
+
+    // A queued scene or room whose contents decide what to prefetch next, continued once it's loaded
+    struct Step {
+        StepType type;
+        std::string path;
+        int16_t sceneNum;
+        int32_t spawn;
+    };
+
+    void OnSceneInit();
+    void OnPlayerUpdate();
+    void FindExitPoints();
+    void PrefetchEntrance(int16_t entranceIndex);
+    void PrefetchRoom(const std::string& path, int16_t sceneNum);
+    void PrefetchObject(int16_t objectId);
+    void ContinueSteps();
+
+    bool mExitPointsFound = false;
+    std::vector<ExitPoint> mExitPoints;
+    std::set<int16_t> mPrefetchedEntrances;
+    std::set<std::string> mPrefetchedRooms;
+    std::set<int16_t> mPrefetchedObjects;
+    std::vector<Step> mSteps;
+};
@@ -10,6 +10,7 @@
 #include "include/z64audio.h"
 #include "graphic/Fast3D/gfx_rendering_api.h"
 #include "OTRGlobals.h"
+#include "thread_local.h"
 #include "z64.h"
 #include "Enhancements/game-interactor/GameInteractor.h"
 #include "soh/Enhancements/presets.h"
@@ -244,6 +245,13 @@ void DrawSettingsMenu() {
                 UIWidgets::ReEnableComponent("");
             }
 
+#if SOH_HAS_THREAD_LOCAL
+            UIWidgets::PaddedEnhancementCheckbox("Multithreaded Audio Synthesis", CVAR_SETTING("MultithreadedAudioSynthesis"), true, false);
+            UIWidgets::Tooltip("Synthesizes the notes that are playing on several threads at once. Helps with sequences "
+                               "and soundfonts that play many notes at the same time. The mix can differ from the "
+                               "default very slightly, by the odd sample at the ends of some notes.");
+#endif
+
             ImGui::EndMenu();
         }
 
@@ -444,6 +452,12 @@ void DrawSettingsMenu() {
             }
             UIWidgets::Tooltip("Matches interpolation value to the game window's current refresh rate.");
 
+#if SOH_HAS_THREAD_LOCAL
+            UIWidgets::PaddedEnhancementCheckbox("Multithreaded Interpolation", CVAR_SETTING("ParallelInterpolation"), true, false);
+            UIWidgets::Tooltip("Interpolates the matrices of actors and effects on several threads at once. Helps when high "
+                               "frame rates are limited by the CPU in scenes with a lot going on.");
+#endif
+
             if (Ship::Context::GetInstance()->GetWindow()->GetWindowBackend() == Ship::WindowBackend::FAST3D_DXGI_DX11) {
                 UIWidgets::PaddedEnhancementSliderInt(CVarGetInteger(CVAR_SETTING("ExtraLatencyThreshold"), 80) == 0 ? "Jitter fix: Off" : "Jitter fix: >= %d FPS",
                     "##ExtraLatencyThreshold", CVAR_SETTING("ExtraLatencyThreshold"), 0, 360, "", 80, true, true, false);
@@ -1429,6 +1443,14 @@ void DrawEnhancementsMenu() {
         UIWidgets::EnhancementCombobox(CVAR_ENHANCEMENT("Autosave"), autosaveLabels, AUTOSAVE_OFF);
         UIWidgets::Tooltip("Automatically save the game when changing locations and/or obtaining items\n"
             "Major items exclude rupees and health/magic/ammo refills (but include bombchus unless bombchu drops are enabled)");
+        UIWidgets::PaddedEnhancementCheckbox("Compact Save Files", CVAR_ENHANCEMENT("CompactSaves"), true, false);
+        UIWidgets::Tooltip("Writes save files in a binary format instead of JSON. Saving is faster and the files are "
+                           "smaller, but they can't be edited by hand. Both formats can always be loaded.");
+#if SOH_HAS_THREAD_LOCAL
+        UIWidgets::PaddedEnhancementCheckbox("Prefetch Scenes", CVAR_SETTING("PrefetchScenes"), true, false);
+        UIWidgets::Tooltip("Loads the scene, room and objects behind an exit or door in the background when Link gets "
+                           "close to it, so going through takes less time.");
+#endif
 
         UIWidgets::PaddedSeparator(true, true, 2.0f, 2.0f);
 
@@ -0,0 +1,432 @@
+// Multithreaded audio synthesis test.
+//
+// Runs AudioSynth_DoOneAudioUpdate over random notes and reverbs. The notes
+// mix synthetic waves, ADPCM, S8 and S16 samples in RAM and through the sample
+// DMA path, with and without headset pan effects, filters and two parts. Half
+// the runs keep every volume low enough that the mix never clips, the other
+// half are loud enough that it often does.
+//
+// With MultithreadedAudioSynthesis off, everything the runs leave behind has to
+// hash to what audio_synthesis.c from before the threads were added left, so
+// the default path mixes exactly what it always did. With it on, the notes have
+// to come out the same whichever order OTRAudio_ParallelFor gets to them in,
+// and a note on its own, without reverbs, has to come out exactly like it does
+// serially. Notes read a few samples past what they loaded, which serially is
+// whatever the reverbs or the note before left in DMEM, so otherwise the two
+// only sound the same. Exits with 1 on the first mismatch. Built as the
+// soh-audio-synthesis-test target, it includes audio_synthesis.c to get at
+// AudioSynth_DoOneAudioUpdate.
+
+#include "../src/code/audio_synthesis.c"
+
+#include <stdio.h>
+
+#define TEST_RUNS 4000
+// What the serial runs hash to, see HashResult
+#define TEST_SERIAL_HASH 0xD8A5BDF6u
+#define TEST_MAX_NOTES 24
+#define TEST_MAX_REVERBS 2
+// In ADPCM frames of 16 samples
+#define TEST_SAMPLE_FRAMES 64
+#define TEST_SAMPLE_BYTES 0x1000
+#define TEST_RING_BUF_SIZE 0x400
+#define TEST_WAVE_SAMPLES 0x4000
+// Where DMEM starts and how much of it the mixer has
+#define TEST_DMEM_START 0x3C0
+#define TEST_DMEM_SIZE (0x1000 - 0x3C0 - 0x40)
+
+AudioContext gAudioContext;
+s16* gWaveSamples[9];
+s16 D_8012FBA8[0x80];
+
+static bool sMultithreaded;
+static bool sReverseOrder;
+
+static Note sNotes[TEST_MAX_NOTES];
+static NoteSubEu sNoteSubs[TEST_MAX_NOTES];
+static NoteSynthesisBuffers sSynthesisBuffers[TEST_MAX_NOTES];
+static SoundFontSound sSounds[TEST_MAX_NOTES];
+static SoundFontSample sSamples[TEST_MAX_NOTES];
+static AdpcmLoop sLoops[TEST_MAX_NOTES];
+static AdpcmBook sBooks[TEST_MAX_NOTES];
+static s16 sBookData[TEST_MAX_NOTES][32];
+static s16 sFilters[TEST_MAX_NOTES][8];
+static s16 sWaves[TEST_MAX_NOTES][64];
+static u8 sSampleData[TEST_MAX_NOTES][TEST_SAMPLE_BYTES];
+static s16 sWaveSamples8[TEST_WAVE_SAMPLES];
+static s16 sRingBufs[TEST_MAX_REVERBS][2][TEST_RING_BUF_SIZE];
+static s16 sAiBuf[DEFAULT_LEN_2CH];
+// The mixer runs the commands right away, they're only counted in here
+static Acmd sCmds[0x4000];
+
+// What a run leaves behind
+typedef struct {
+    s16 aiBuf[DEFAULT_LEN_2CH];
+    s16 ringBufs[TEST_MAX_REVERBS][2][TEST_RING_BUF_SIZE];
+    NoteSynthesisState synthesisStates[TEST_MAX_NOTES];
+    NoteSynthesisBuffers synthesisBuffers[TEST_MAX_NOTES];
+    NoteSubEu noteSubs[TEST_MAX_NOTES];
+    bool finished[TEST_MAX_NOTES];
+} SynthesisTestResult;
+
+static SynthesisTestResult sSerial;
+static SynthesisTestResult sForward;
+static SynthesisTestResult sReverse;
+
+uintptr_t AudioLoad_DmaSampleData(uintptr_t devAddr, size_t size, s32 arg2, u8* dmaIndexRef, s32 medium) {
+    // The test's samples are all in RAM, the DMA path just hands them back like a buffer it filled
+    return devAddr;
+}
+
+void Audio_InvalDCache(void* buf, size_t size) {
+}
+
+void AudioSeq_ProcessSequences(s32 arg0) {
+}
+
+int32_t CVarGetInteger(const char* name, int32_t defaultValue) {
+    if (strcmp(name, CVAR_SETTING("MultithreadedAudioSynthesis")) == 0) {
+        return sMultithreaded;
+    }
+    return defaultValue;
+}
+
+// Runs the notes on this thread, first to last or last to first
+void OTRAudio_ParallelFor(int32_t count, void (*func)(int32_t index)) {
+    for (int32_t i = 0; i < count; i++) {
+        func(sReverseOrder ? count - 1 - i : i);
+    }
+}
+
+static uint32_t sRandomState = 1;
+
+static uint32_t Random(void) {
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+    return sRandomState;
+}
+
+static void FillRandom(s16* samples, int count, int amplitude) {
+    for (int i = 0; i < count; i++) {
+        samples[i] = (s16)((int)(Random() % (2 * amplitude + 1)) - amplitude);
+    }
+}
+
+static void SetUpNote(s32 i, s32 numReverbs, bool loud) {
+    Note* note = &sNotes[i];
+    NoteSubEu* sub = &sNoteSubs[i];
+    NoteSynthesisState* synthState = &note->synthesisState;
+    SoundFontSample* sample = &sSamples[i];
+    // A note adds at most its samples times its volume / 0x1000 to each channel, twice with headset panning, so quiet
+    // notes can't add up to more than a quarter of the range, even all at once
+    u16 maxVolume = loud ? 0xFFFF : 0x1000 / TEST_MAX_NOTES / 8;
+    s32 loopEnd = TEST_SAMPLE_FRAMES * 16;
+    s32 samplePos = Random() % (loopEnd / 2);
+
+    memset(sub, 0, sizeof(*sub));
+    sub->bitField0.enabled = Random() % 8 != 0;
+    sub->bitField0.needsInit = Random() % 4 == 0;
+    if (sub->bitField0.needsInit) {
+        // Notes start at the top of their sample, unk_BC stays 0 from Audio_NoteInitAll on
+        samplePos = 0;
+    }
+    sub->bitField0.stereoStrongRight = Random() % 4 == 0;
+    sub->bitField0.stereoStrongLeft = Random() % 4 == 0;
+    sub->bitField0.stereoHeadsetEffects = Random() % 4 == 0;
+    sub->bitField0.usesHeadsetPanEffects = Random() % 4 == 0;
+    sub->bitField1.reverbIndex = Random() % (numReverbs + 1);
+    sub->bitField1.hasTwoParts = Random() % 8 == 0;
+    if (Random() % 3 == 0) {
+        // Panned to one side, like AudioPlayback_InitNoteSub does in headset mode
+        sub->bitField1.usesHeadsetPanEffects2 = true;
+        if (Random() % 2) {
+            sub->headsetPanLeft = 2 * (Random() % 31);
+        } else {
+            sub->headsetPanRight = 2 * (Random() % 31);
+        }
+    }
+    sub->unk_2 = Random() % 4 == 0 ? Random() % 0x80 : 0;
+    sub->reverbVol = Random();
+    if (Random() % 4 == 0) {
+        // The delayed samples are kept from panSamplesBuffer[0x18] to the end of the note's buffers
+        sub->unk_07 = 2 * (1 + Random() % 0x18);
+        sub->unk_0E = Random();
+    }
+    sub->targetVolLeft = Random() % (maxVolume + 1);
+    sub->targetVolRight = Random() % (maxVolume + 1);
+    sub->resamplingRateFixedPoint = 0x1000 + Random() % 0xF000;
+    if (Random() % 4 == 0) {
+        FillRandom(sFilters[i], 8, 0x800);
+        sub->filter = sFilters[i];
+    }
+
+    switch (Random() % 6) {
+        case 0:
+            sub->bitField1.isSyntheticWave = true;
+            // Fast enough waves copy themselves over the start of the mix as they are, see AudioSynth_LoadWaveSamples
+            FillRandom(sWaves[i], 64, loud ? 0x7FFF : 0x4000);
+            sub->sound.samples = sWaves[i];
+            break;
+        case 1:
+            // Reads gWaveSamples[8], which the notes share
+            sub->bitField1.isSyntheticWave = true;
+            sub->bitField1.bookOffset = 1 + Random() % 3;
+            sub->sound.samples = sWaves[i];
+            // They're resampled from as far into DMEM as they've played, only at the start that's what was loaded
+            samplePos = 0;
+            break;
+        default:
+            memset(sample, 0, sizeof(*sample));
+            switch (Random() % 4) {
+                case 0:
+                    sample->codec = CODEC_S8;
+                    break;
+                case 1:
+                    sample->codec = CODEC_S16;
+                    break;
+                case 2:
+                    sample->codec = CODEC_SMALL_ADPCM;
+                    break;
+                default:
+                    sample->codec = CODEC_ADPCM;
+                    break;
+            }
+            // Samples outside of RAM go through the DMA buffers, which the notes share
+            sample->medium = Random() % 4 == 0 ? MEDIUM_CART : MEDIUM_RAM;
+            sample->sampleAddr = sSampleData[i];
+            for (int j = 0; j < TEST_SAMPLE_BYTES; j++) {
+                sSampleData[i][j] = Random();
+            }
+            if (sample->codec == CODEC_ADPCM || sample->codec == CODEC_SMALL_ADPCM) {
+                // Every frame starts with its scale and one of the book's two predictors, like the game's samples
+                s32 frameSize = sample->codec == CODEC_ADPCM ? 9 : 5;
+                for (int j = 0; j < TEST_SAMPLE_BYTES; j += frameSize) {
+                    sSampleData[i][j] = (Random() % 13) << 4 | Random() % 2;
+                }
+            }
+            sLoops[i].start = 16 * (Random() % (TEST_SAMPLE_FRAMES / 2));
+            sLoops[i].end = loopEnd;
+            sLoops[i].count = Random() % 4 == 0 ? 0 : 0xFFFFFFFF;
+            FillRandom(sLoops[i].state, 16, 0x7FFF);
+            sample->loop = &sLoops[i];
+            sBooks[i].order = 2;
+            sBooks[i].npredictors = 2;
+            FillRandom(sBookData[i], 32, 0x800);
+            sBooks[i].book = sBookData[i];
+            sample->book = &sBooks[i];
+            sSounds[i].sample = sample;
+            sub->sound.soundFontSound = &sSounds[i];
+            sub->bitField1.bookOffset = Random() % 4 == 0 ? 2 + Random() % 2 : 0;
+            break;
+    }
+
+    memset(note, 0, sizeof(*note));
+    note->unk_BC = samplePos;
+    FillRandom((s16*)&sSynthesisBuffers[i], sizeof(sSynthesisBuffers[i]) / sizeof(s16), loud ? 0x7FFF : 0x100);
+    synthState->synthesisBuffers = &sSynthesisBuffers[i];
+    synthState->samplePosInt = samplePos;
+    synthState->samplePosFrac = Random();
+    synthState->numParts = 1 + sub->bitField1.hasTwoParts;
+    synthState->reverbVol = sub->reverbVol;
+    synthState->curVolLeft = Random() % (maxVolume / 2 + 1);
+    synthState->curVolRight = Random() % (maxVolume / 2 + 1);
+    synthState->prevHeadsetPanLeft = sub->headsetPanLeft;
+    synthState->prevHeadsetPanRight = sub->headsetPanRight;
+    synthState->unk_1A = Random() % 2;
+    note->noteSubEu = *sub;
+}
+
+static void SetUpReverb(s32 index, s32 aiBufLen, bool loud) {
+    SynthesisReverb* reverb = &gAudioContext.synthesisReverbs[index];
+
+    memset(reverb, 0, sizeof(*reverb));
+    reverb->useReverb = Random() % 4 != 0;
+    reverb->downsampleRate = 1;
+    reverb->unk_05 = -1;
+    reverb->unk_0A = Random() % 0x4000;
+    reverb->unk_0C = Random() % 0x4000;
+    if (Random() % 2) {
+        reverb->leakRtl = Random() % 0x2000;
+        reverb->leakLtr = Random() % 0x2000;
+    }
+    reverb->bufSizePerChan = TEST_RING_BUF_SIZE - DEFAULT_LEN_1CH;
+    reverb->nextRingBufPos = Random() % reverb->bufSizePerChan;
+    FillRandom(&sRingBufs[index][0][0], 2 * TEST_RING_BUF_SIZE, loud ? 0x7FFF : 0x200);
+    reverb->leftRingBuf = sRingBufs[index][0];
+    reverb->rightRingBuf = sRingBufs[index][1];
+    if (reverb->useReverb) {
+        AudioSynth_InitNextRingBuf(aiBufLen, 0, index);
+    }
+}
+
+// Sets up the same notes and reverbs for every run with the same seed
+static s32 SetUp(uint32_t seed, bool loud, s32 maxNotes) {
+    s32 aiBufLen = 16 * (9 + seed % 5);
+
+    sRandomState = seed * 2654435761u + 1;
+    memset(&gAudioContext, 0, sizeof(gAudioContext));
+    gAudioContext.numNotes = 1 + Random() % maxNotes;
+    gAudioContext.notes = sNotes;
+    gAudioContext.noteSubsEu = sNoteSubs;
+    // Reverbs load their ring buffers into DMEM before the notes, which a note on its own would read serially
+    gAudioContext.numSynthesisReverbs = maxNotes == 1 ? 0 : Random() % (TEST_MAX_REVERBS + 1);
+    for (s32 i = 0; i < gAudioContext.numSynthesisReverbs; i++) {
+        SetUpReverb(i, aiBufLen, loud);
+    }
+    for (s32 i = 0; i < gAudioContext.numNotes; i++) {
+        SetUpNote(i, gAudioContext.numSynthesisReverbs, loud);
+    }
+    FillRandom(sWaveSamples8, TEST_WAVE_SAMPLES, loud ? 0x7FFF : 0x100);
+    gWaveSamples[8] = sWaveSamples8;
+    return aiBufLen;
+}
+
+static void Run(uint32_t seed, bool loud, s32 maxNotes, bool multithreaded, bool reverseOrder,
+                SynthesisTestResult* result) {
+    s32 aiBufLen = SetUp(seed, loud, maxNotes);
+
+    sMultithreaded = multithreaded;
+    sReverseOrder = reverseOrder;
+    sCurLoadedBook = NULL;
+    aClearBuffer(sCmds, TEST_DMEM_START, TEST_DMEM_SIZE);
+    memset(sAiBuf, 0, sizeof(sAiBuf));
+    AudioSynth_DoOneAudioUpdate(sAiBuf, aiBufLen, sCmds, 0);
+
+    memcpy(result->aiBuf, sAiBuf, sizeof(sAiBuf));
+    memcpy(result->ringBufs, sRingBufs, sizeof(sRingBufs));
+    for (s32 i = 0; i < TEST_MAX_NOTES; i++) {
+        result->synthesisStates[i] = sNotes[i].synthesisState;
+        result->finished[i] = sNotes[i].noteSubEu.bitField0.finished;
+    }
+    memcpy(result->synthesisBuffers, sSynthesisBuffers, sizeof(sSynthesisBuffers));
+    memcpy(result->noteSubs, sNoteSubs, sizeof(sNoteSubs));
+}
+
+static bool CheckSame(const char* what, uint32_t run, const void* expected, const void* actual, size_t size) {
+    const u8* expectedBytes = expected;
+    const u8* actualBytes = actual;
+
+    for (size_t i = 0; i < size; i++) {
+        if (expectedBytes[i] != actualBytes[i]) {
+            printf("%s differs on run %u at byte %zu: %d instead of %d\n", what, run, i, actualBytes[i],
+                   expectedBytes[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint32_t Hash(uint32_t hash, uint32_t value, int bytes) {
+    // FNV-1a, a byte at a time from the lowest so it hashes the same on any host
+    for (int i = 0; i < bytes; i++) {
+        hash = (hash ^ ((value >> (8 * i)) & 0xFF)) * 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t HashSamples(uint32_t hash, const s16* samples, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        hash = Hash(hash, (u16)samples[i], 2);
+    }
+    return hash;
+}
+
+// Hashes the samples and what synthesis changes in the notes, leaving out the pointers and padding, which differ
+// between builds
+static uint32_t HashResult(uint32_t hash, const SynthesisTestResult* result) {
+    hash = HashSamples(hash, result->aiBuf, DEFAULT_LEN_2CH);
+    hash = HashSamples(hash, &result->ringBufs[0][0][0], sizeof(result->ringBufs) / sizeof(s16));
+    hash = HashSamples(hash, (const s16*)result->synthesisBuffers, sizeof(result->synthesisBuffers) / sizeof(s16));
+    for (s32 i = 0; i < TEST_MAX_NOTES; i++) {
+        const NoteSynthesisState* synthState = &result->synthesisStates[i];
+
+        hash = Hash(hash, synthState->restart, 1);
+        hash = Hash(hash, synthState->sampleDmaIndex, 1);
+        hash = Hash(hash, synthState->prevHeadsetPanRight, 1);
+        hash = Hash(hash, synthState->prevHeadsetPanLeft, 1);
+        hash = Hash(hash, synthState->reverbVol, 1);
+        hash = Hash(hash, synthState->numParts, 1);
+        hash = Hash(hash, synthState->samplePosFrac, 2);
+        hash = Hash(hash, synthState->samplePosInt, 4);
+        hash = Hash(hash, (u16)synthState->curVolLeft, 2);
+        hash = Hash(hash, (u16)synthState->curVolRight, 2);
+        hash = Hash(hash, synthState->unk_14, 2);
+        hash = Hash(hash, synthState->unk_16, 2);
+        hash = Hash(hash, synthState->unk_18, 2);
+        hash = Hash(hash, synthState->unk_1A, 1);
+        hash = Hash(hash, synthState->unk_1C, 2);
+        hash = Hash(hash, synthState->unk_1E, 2);
+        hash = Hash(hash, result->noteSubs[i].bitField0.needsInit, 1);
+        hash = Hash(hash, result->finished[i], 1);
+    }
+    return hash;
+}
+
+// Compares everything but the padding in the note states and subs
+static bool CheckSameResult(const char* what, uint32_t run, const SynthesisTestResult* expected,
+                            const SynthesisTestResult* actual) {
+    char name[64];
+
+    snprintf(name, sizeof(name), "%s audio buffer", what);
+    if (!CheckSame(name, run, expected->aiBuf, actual->aiBuf, sizeof(expected->aiBuf))) {
+        return false;
+    }
+    snprintf(name, sizeof(name), "%s reverb ring buffers", what);
+    if (!CheckSame(name, run, expected->ringBufs, actual->ringBufs, sizeof(expected->ringBufs))) {
+        return false;
+    }
+    snprintf(name, sizeof(name), "%s note buffers", what);
+    if (!CheckSame(name, run, expected->synthesisBuffers, actual->synthesisBuffers,
+                   sizeof(expected->synthesisBuffers))) {
+        return false;
+    }
+    snprintf(name, sizeof(name), "%s notes", what);
+    if (HashResult(0, expected) != HashResult(0, actual)) {
+        printf("%s differ on run %u\n", name, run);
+        return false;
+    }
+    return true;
+}
+
+// Every fourth pair of runs has a single note, which the threads have to synthesize exactly like the serial path does
+static s32 MaxNotes(uint32_t run) {
+    return run % 8 < 2 ? 1 : TEST_MAX_NOTES;
+}
+
+int main(void) {
+    uint32_t serialHash = 2166136261u;
+
+    Mixer_Init();
+
+    // The mixer keeps some state from one run to the next, like it does between updates in the game, so the serial
+    // runs go through on their own first to leave the same state behind as before
+    for (uint32_t run = 0; run < TEST_RUNS; run++) {
+        Run(run, run % 2 != 0, MaxNotes(run), false, false, &sSerial);
+        serialHash = HashResult(serialHash, &sSerial);
+    }
+    if (serialHash != TEST_SERIAL_HASH) {
+        printf("the serial runs hash to %08X instead of %08X\n", serialHash, TEST_SERIAL_HASH);
+        return 1;
+    }
+
+    for (uint32_t run = 0; run < TEST_RUNS; run++) {
+        bool loud = run % 2 != 0;
+        s32 maxNotes = MaxNotes(run);
+
+        Run(run, loud, maxNotes, true, false, &sForward);
+        Run(run, loud, maxNotes, true, true, &sReverse);
+        if (!CheckSameResult("reverse order", run, &sForward, &sReverse)) {
+            return 1;
+        }
+        if (maxNotes == 1) {
+            Run(run, loud, maxNotes, false, false, &sSerial);
+            if (!CheckSameResult(loud ? "loud single note" : "quiet single note", run, &sSerial, &sForward)) {
+                return 1;
+            }
+        }
+    }
+
+    printf("%d runs synthesize serially like they always did, and the same with threads in either order\n", TEST_RUNS);
+    return 0;
+}
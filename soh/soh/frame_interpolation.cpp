@@ -1,12 +1,22 @@
 #include <libultraship/bridge.h>
 
+#include <algorithm>
+#include <array>
 #include <vector>
-#include <map>
 #include <unordered_map>
 #include <math.h>
 
 #include "frame_interpolation.h"
 #include "soh/OTRGlobals.h"
+#include "mtxf_simd.h"
+
+// Worker threads replay on their own matrix stacks, so without those everything is replayed on this thread
+#if SOH_HAS_THREAD_LOCAL
+#define PARALLEL_INTERPOLATION
+#include <future>
+#include <thread>
+#include <BS_thread_pool.hpp>
+#endif
 
 /*
 Frame interpolation.
@@ -35,6 +45,12 @@ inserted FrameInterpolation_OpenChild/FrameInterpolation_Close child calls.
 These nodes contain information that should suffice to identify the matrix,
 so we can find it in an adjacent frame.
 
+The tree is recorded into flat arrays that keep their memory between frames,
+so recording doesn't allocate once the arrays have grown to the size of a
+frame. Ops are appended in the order they are recorded, and when recording
+stops every node gets its items, children and ops of each kind as contiguous
+ranges, which is what matching against the previous frame looks up.
+
 We can interpolate an arbitrary amount of frames between two original frames,
 given a specific interpolation factor (0=old frame, 0.5=average of frames,
 1.0=new frame).
@@ -75,6 +91,9 @@ void Matrix_SetTranslateScaleMtx2(Mtx* mtx, f32 scaleX, f32 scaleY, f32 scaleZ,
 
 MtxF* Matrix_GetCurrent(void);
 
+extern SOH_THREAD_LOCAL MtxF* sMatrixStack;
+extern SOH_THREAD_LOCAL MtxF* sCurrentMatrix;
+
 void SkinMatrix_MtxFMtxFMult(MtxF* mfA, MtxF* mfB, MtxF* dest);
 
 }
@@ -169,25 +188,134 @@ namespace {
             Vec3f axis;
             u8 mode;
         } matrix_rotate_axis;
+    };
 
-        struct {
-            label key;
-            size_t idx;
-        } open_child;
+    constexpr size_t OpCount = (size_t)Op::SkinMatrixMtxFToMtx + 1;
+
+    struct Item {
+        Op op;
+        uint32_t node;
+        // For OpenChild the node that was opened, otherwise the index of the op's data
+        uint32_t index;
+        // How many ops of the same kind the node recorded before this one
+        uint32_t ordinal;
     };
 
-    struct Path {
-        map<label, vector<Path>> children;
-        map<Op, vector<Data>> ops;
-        vector<pair<Op, size_t>> items;
+    struct Node {
+        label key;
+        // How many children with the same key the parent opened before this one
+        uint32_t ordinal;
+        uint32_t item_count;
+        uint32_t child_count;
+        array<uint32_t, OpCount> op_counts;
+
+        // Ranges into Recording::node_items, Recording::node_children and Recording::node_ops,
+        // set up when the recording is finished
+        uint32_t items_begin;
+        uint32_t children_begin;
+        array<uint32_t, OpCount> ops_begin;
     };
 
     struct Recording {
-        Path root_path;
+        vector<Node> nodes;
+        vector<Item> items;
+        vector<Data> data;
+
+        // Items of each node in recording order
+        vector<uint32_t> node_items;
+        // Children of each node sorted by key, then in recording order
+        vector<uint32_t> node_children;
+        // Data of each node grouped by op, in recording order
+        vector<uint32_t> node_ops;
+        bool finished;
+
+        void clear() {
+            nodes.clear();
+            items.clear();
+            data.clear();
+            finished = false;
+            nodes.push_back({});
+        }
+
+        void finish() {
+            if (finished) {
+                return;
+            }
+            finished = true;
+
+            uint32_t items_end = 0;
+            uint32_t children_end = 0;
+            uint32_t ops_end = 0;
+            for (Node& node : nodes) {
+                node.items_begin = items_end;
+                items_end += node.item_count;
+                node.children_begin = children_end;
+                children_end += node.child_count;
+                for (size_t op = 0; op < OpCount; op++) {
+                    node.ops_begin[op] = ops_end;
+                    ops_end += node.op_counts[op];
+                }
+            }
+
+            node_items.resize(items_end);
+            node_children.resize(children_end);
+            node_ops.resize(ops_end);
+
+            // Nodes are created in recording order, so filling the ranges in recording
+            // order keeps each range in recording order too
+            for (Node& node : nodes) {
+                node.item_count = 0;
+                node.child_count = 0;
+            }
+            for (uint32_t i = 0; i < items.size(); i++) {
+                const Item& item = items[i];
+                Node& node = nodes[item.node];
+                node_items[node.items_begin + node.item_count++] = i;
+                if (item.op == Op::OpenChild) {
+                    node_children[node.children_begin + node.child_count++] = item.index;
+                } else {
+                    node_ops[node.ops_begin[(size_t)item.op] + item.ordinal] = item.index;
+                }
+            }
+
+            for (Node& node : nodes) {
+                auto begin = node_children.begin() + node.children_begin;
+                auto end = begin + node.child_count;
+                sort(begin, end, [this](uint32_t a, uint32_t b) {
+                    return nodes[a].key < nodes[b].key || (nodes[a].key == nodes[b].key && a < b);
+                });
+                for (auto it = begin; it != end; ++it) {
+                    nodes[*it].ordinal = it != begin && nodes[*(it - 1)].key == nodes[*it].key
+                                             ? nodes[*(it - 1)].ordinal + 1
+                                             : 0;
+                }
+            }
+        }
+
+        // Finds the ordinal-th child that node opened with key
+        const Node* find_child(const Node& node, label key, uint32_t ordinal) const {
+            auto begin = node_children.begin() + node.children_begin;
+            auto end = begin + node.child_count;
+            auto it = lower_bound(begin, end, key, [this](uint32_t child, const label& k) {
+                return nodes[child].key < k;
+            });
+            if ((uint32_t)(end - it) <= ordinal || nodes[*(it + ordinal)].key != key) {
+                return nullptr;
+            }
+            return &nodes[*(it + ordinal)];
+        }
+
+        // Finds the data of the ordinal-th op of a kind that node recorded
+        const Data* find_op(const Node& node, Op op, uint32_t ordinal) const {
+            if (ordinal >= node.op_counts[(size_t)op]) {
+                return nullptr;
+            }
+            return &data[node_ops[node.ops_begin[(size_t)op] + ordinal]];
+        }
     };
 
     bool is_recording;
-    vector<Path*> current_path;
+    vector<uint32_t> current_path;
     uint32_t camera_epoch;
     uint32_t previous_camera_epoch;
     Recording current_recording;
@@ -199,37 +327,131 @@ namespace {
     size_t inv_actor_mtx_path_index;
 
     Data& append(Op op) {
-        auto& m = current_path.back()->ops[op];
-        current_path.back()->items.emplace_back(op, m.size());
-        return m.emplace_back();
+        const uint32_t node_index = current_path.back();
+        Node& node = current_recording.nodes[node_index];
+        node.item_count++;
+        current_recording.items.push_back({ op, node_index, (uint32_t)current_recording.data.size(),
+                                            node.op_counts[(size_t)op]++ });
+        return current_recording.data.emplace_back();
+    }
+
+    struct Match {
+        Op op;
+        const Data* old_op;
+        const Data* new_op;
+    };
+
+    // Which old op every new op is interpolated with, in replay order. This only depends on the two
+    // recordings, so it is worked out once per recorded frame and replayed for every interpolated one.
+    vector<Match> matches;
+    size_t match_replacement_count;
+    bool has_matches;
+
+    // A run of matches replayed as a unit, either a top-level branch or the root ops between two of them
+    struct Segment {
+        uint32_t begin;
+        uint32_t end;
+        // Reads the matrix on top of the stack or below it before overwriting it, or leaves the stack deeper or
+        // shallower than it found it
+        bool reads_top;
+        bool reads_actor_mtx;
+        bool sets_top;
+        bool sets_actor_mtx;
+        // Consecutive independent branches grouped to be replayed on a worker thread
+        bool parallel;
+    };
+
+    vector<Segment> segments;
+
+    void start_segment() {
+        if (segments.empty() || segments.back().begin != matches.size()) {
+            segments.push_back({ (uint32_t)matches.size() });
+        }
+    }
+
+    void match_branch(const Recording& old_rec, const Node& old_path, const Recording& new_rec, const Node& new_path,
+                      bool root) {
+        for (uint32_t i = 0; i < new_path.item_count; i++) {
+            const Item& item = new_rec.items[new_rec.node_items[new_path.items_begin + i]];
+
+            if (item.op == Op::OpenChild) {
+                const Node& new_child = new_rec.nodes[item.index];
+                if (root) {
+                    start_segment();
+                }
+                if (const Node* old_child = old_rec.find_child(old_path, new_child.key, new_child.ordinal)) {
+                    match_branch(old_rec, *old_child, new_rec, new_child, false);
+                } else {
+                    match_branch(new_rec, new_child, new_rec, new_child, false);
+                }
+                if (root) {
+                    start_segment();
+                }
+                continue;
+            }
+
+            const Data* old_op = old_rec.find_op(old_path, item.op, item.ordinal);
+            if (old_op == nullptr) {
+                continue;
+            }
+            if (item.op == Op::MatrixMtxFToMtx || item.op == Op::MatrixToMtx) {
+                match_replacement_count++;
+            }
+            matches.push_back({ item.op, old_op, &new_rec.data[item.index] });
+        }
+    }
+
+    void update_matches() {
+        if (has_matches) {
+            return;
+        }
+        has_matches = true;
+        matches.clear();
+        segments.clear();
+        match_replacement_count = 0;
+        if (current_recording.nodes.empty()) {
+            return;
+        }
+        if (previous_recording.nodes.empty()) {
+            previous_recording.clear();
+        }
+        previous_recording.finish();
+        current_recording.finish();
+        start_segment();
+        match_branch(previous_recording, previous_recording.nodes[0], current_recording, current_recording.nodes[0],
+                     true);
+        for (size_t i = 0; i < segments.size(); i++) {
+            segments[i].end = i + 1 < segments.size() ? segments[i + 1].begin : (uint32_t)matches.size();
+        }
     }
 
     struct InterpolateCtx {
         float step;
         float w;
-        unordered_map<Mtx*, MtxF> mtx_replacements;
+        unordered_map<Mtx*, MtxF>* mtx_replacements;
+        // Replacements of a segment replayed out of order, merged into mtx_replacements afterwards
+        vector<pair<Mtx*, MtxF>>* segment_replacements = nullptr;
         MtxF tmp_mtxf, tmp_mtxf2;
         Vec3f tmp_vec3f;
         Vec3s tmp_vec3s;
         MtxF actor_mtx;
 
         MtxF* new_replacement(Mtx* addr) {
-            return &mtx_replacements[addr];
+            if (segment_replacements != nullptr) {
+                return &segment_replacements->emplace_back(addr, MtxF()).second;
+            }
+            return &(*mtx_replacements)[addr];
         }
 
-        void interpolate_mtxf(MtxF* res, MtxF* o, MtxF* n) {
-            for (size_t i = 0; i < 4; i++) {
-                for (size_t j = 0; j < 4; j++) {
-                    res->mf[i][j] = w * o->mf[i][j] + step * n->mf[i][j];
-                }
-            }
+        void interpolate_mtxf(MtxF* res, const MtxF* o, const MtxF* n) {
+            MtxFSimd_Lerp(res, o, n, w, step);
         }
 
         float lerp(f32 o, f32 n) {
             return w * o + step * n;
         }
 
-        void lerp_vec3f(Vec3f* res, Vec3f* o, Vec3f* n) {
+        void lerp_vec3f(Vec3f* res, const Vec3f* o, const Vec3f* n) {
             res->x = lerp(o->x, n->x);
             res->y = lerp(o->y, n->y);
             res->z = lerp(o->z, n->z);
@@ -289,169 +511,395 @@ namespace {
             return res;
         }
 
-        void interpolate_angles(Vec3s* res, Vec3s* o, Vec3s* n) {
+        void interpolate_angles(Vec3s* res, const Vec3s* o, const Vec3s* n) {
             res->x = interpolate_angle(o->x, n->x);
             res->y = interpolate_angle(o->y, n->y);
             res->z = interpolate_angle(o->z, n->z);
         }
 
-        void interpolate_branch(Path* old_path, Path *new_path) {
-            for (auto& item : new_path->items) {
-                Data& new_op = new_path->ops[item.first][item.second];
-
-                if (item.first == Op::OpenChild) {
-                    if (auto it = old_path->children.find(new_op.open_child.key);
-                        it != old_path->children.end() && new_op.open_child.idx < it->second.size()) {
-                        interpolate_branch(&it->second[new_op.open_child.idx],
-                                            &new_path->children.find(new_op.open_child.key)->second[new_op.open_child.idx]);
-                    } else {
-                        interpolate_branch(
-                            &new_path->children.find(new_op.open_child.key)->second[new_op.open_child.idx],
-                            &new_path->children.find(new_op.open_child.key)->second[new_op.open_child.idx]);
-                    }
-                    continue;
-                }
-
-                if (auto it = old_path->ops.find(item.first); it != old_path->ops.end()) {
-                    if (item.second < it->second.size()) {
-                        Data& old_op = it->second[item.second];
-                        switch (item.first) {
-                            case Op::OpenChild:
-                                break;
-                            case Op::CloseChild:
+        void replay(const Match* begin, const Match* end) {
+            for (const Match* it = begin; it != end; ++it) {
+                const Match& match = *it;
+                const Data* old_op = match.old_op;
+                const Data& new_op = *match.new_op;
+
+                switch (match.op) {
+                    case Op::OpenChild:
+                        break;
+                    case Op::CloseChild:
+                        break;
+
+                    case Op::MatrixPush:
+                        Matrix_Push();
+                        break;
+
+                    case Op::MatrixPop:
+                        Matrix_Pop();
+                        break;
+
+                    case Op::MatrixPut:
+                        interpolate_mtxf(&tmp_mtxf, &old_op->matrix_put.src, &new_op.matrix_put.src);
+                        Matrix_Put(&tmp_mtxf);
+                        break;
+
+                    case Op::MatrixMult:
+                        interpolate_mtxf(&tmp_mtxf, &old_op->matrix_mult.mf, &new_op.matrix_mult.mf);
+                        Matrix_Mult(&tmp_mtxf, new_op.matrix_mult.mode);
+                        break;
+
+                    case Op::MatrixTranslate:
+                        Matrix_Translate(lerp(old_op->matrix_translate.x, new_op.matrix_translate.x),
+                                         lerp(old_op->matrix_translate.y, new_op.matrix_translate.y),
+                                         lerp(old_op->matrix_translate.z, new_op.matrix_translate.z),
+                                         new_op.matrix_translate.mode);
+                        break;
+
+                    case Op::MatrixScale:
+                        Matrix_Scale(lerp(old_op->matrix_scale.x, new_op.matrix_scale.x),
+                                     lerp(old_op->matrix_scale.y, new_op.matrix_scale.y),
+                                     lerp(old_op->matrix_scale.z, new_op.matrix_scale.z),
+                                     new_op.matrix_scale.mode);
+                        break;
+
+                    case Op::MatrixRotate1Coord: {
+                        float v = interpolate_angle(old_op->matrix_rotate_1_coord.value, new_op.matrix_rotate_1_coord.value);
+                        u8 mode = new_op.matrix_rotate_1_coord.mode;
+                        switch (new_op.matrix_rotate_1_coord.coord) {
+                            case 0:
+                                Matrix_RotateX(v, mode);
                                 break;
 
-                            case Op::MatrixPush:
-                                Matrix_Push();
+                            case 1:
+                                Matrix_RotateY(v, mode);
                                 break;
 
-                            case Op::MatrixPop:
-                                Matrix_Pop();
+                            case 2:
+                                Matrix_RotateZ(v, mode);
                                 break;
+                        }
+                        break;
+                    }
 
-                            case Op::MatrixPut:
-                                interpolate_mtxf(&tmp_mtxf, &old_op.matrix_put.src, &new_op.matrix_put.src);
-                                Matrix_Put(&tmp_mtxf);
-                                break;
+                    case Op::MatrixRotateZYX:
+                        Matrix_RotateZYX(interpolate_angle(old_op->matrix_rotate_zyx.x, new_op.matrix_rotate_zyx.x),
+                                         interpolate_angle(old_op->matrix_rotate_zyx.y, new_op.matrix_rotate_zyx.y),
+                                         interpolate_angle(old_op->matrix_rotate_zyx.z, new_op.matrix_rotate_zyx.z),
+                                         new_op.matrix_rotate_zyx.mode);
+                        break;
+
+                    case Op::MatrixTranslateRotateZYX:
+                        lerp_vec3f(&tmp_vec3f, &old_op->matrix_translate_rotate_zyx.translation, &new_op.matrix_translate_rotate_zyx.translation);
+                        interpolate_angles(&tmp_vec3s, &old_op->matrix_translate_rotate_zyx.rotation, &new_op.matrix_translate_rotate_zyx.rotation);
+                        Matrix_TranslateRotateZYX(&tmp_vec3f, &tmp_vec3s);
+                        break;
+
+                    case Op::MatrixSetTranslateRotateYXZ:
+                        interpolate_angles(&tmp_vec3s, &old_op->matrix_set_translate_rotate_yxz.rot,
+                                                       &new_op.matrix_set_translate_rotate_yxz.rot);
+                        Matrix_SetTranslateRotateYXZ(lerp(old_op->matrix_set_translate_rotate_yxz.translateX,
+                                                          new_op.matrix_set_translate_rotate_yxz.translateX),
+                                                     lerp(old_op->matrix_set_translate_rotate_yxz.translateY,
+                                                          new_op.matrix_set_translate_rotate_yxz.translateY),
+                                                     lerp(old_op->matrix_set_translate_rotate_yxz.translateZ,
+                                                          new_op.matrix_set_translate_rotate_yxz.translateZ),
+                                                     &tmp_vec3s);
+                        if (new_op.matrix_set_translate_rotate_yxz.has_mtx && old_op->matrix_set_translate_rotate_yxz.has_mtx) {
+                            actor_mtx = *Matrix_GetCurrent();
+                        }
+                        break;
+
+                    case Op::MatrixMtxFToMtx:
+                        interpolate_mtxf(new_replacement(new_op.matrix_mtxf_to_mtx.dest),
+                                         &old_op->matrix_mtxf_to_mtx.src, &new_op.matrix_mtxf_to_mtx.src);
+                        break;
+
+                    case Op::MatrixToMtx: {
+                        //*new_replacement(new_op.matrix_to_mtx.dest) = *Matrix_GetCurrent();
+                        if (old_op->matrix_to_mtx.has_adjusted && new_op.matrix_to_mtx.has_adjusted) {
+                            interpolate_mtxf(&tmp_mtxf, &old_op->matrix_to_mtx.src, &new_op.matrix_to_mtx.src);
+                            SkinMatrix_MtxFMtxFMult(&actor_mtx, &tmp_mtxf, new_replacement(new_op.matrix_to_mtx.dest));
+                        } else {
+                            interpolate_mtxf(new_replacement(new_op.matrix_to_mtx.dest),
+                                             &old_op->matrix_to_mtx.src, &new_op.matrix_to_mtx.src);
+                        }
+                        break;
+                    }
 
-                            case Op::MatrixMult:
-                                interpolate_mtxf(&tmp_mtxf, &old_op.matrix_mult.mf, &new_op.matrix_mult.mf);
-                                Matrix_Mult(&tmp_mtxf, new_op.matrix_mult.mode);
-                                break;
+                    case Op::MatrixReplaceRotation:
+                        interpolate_mtxf(&tmp_mtxf, &old_op->matrix_replace_rotation.mf, &new_op.matrix_replace_rotation.mf);
+                        Matrix_ReplaceRotation(&tmp_mtxf);
+                        break;
 
-                            case Op::MatrixTranslate:
-                                Matrix_Translate(lerp(old_op.matrix_translate.x, new_op.matrix_translate.x),
-                                                 lerp(old_op.matrix_translate.y, new_op.matrix_translate.y),
-                                                 lerp(old_op.matrix_translate.z, new_op.matrix_translate.z),
-                                                 new_op.matrix_translate.mode);
-                                break;
+                    case Op::MatrixRotateAxis:
+                        lerp_vec3f(&tmp_vec3f, &old_op->matrix_rotate_axis.axis, &new_op.matrix_rotate_axis.axis);
+                        Matrix_RotateAxis(interpolate_angle(old_op->matrix_rotate_axis.angle, new_op.matrix_rotate_axis.angle),
+                                          &tmp_vec3f, new_op.matrix_rotate_axis.mode);
+                        break;
 
-                            case Op::MatrixScale:
-                                Matrix_Scale(lerp(old_op.matrix_scale.x, new_op.matrix_scale.x),
-                                             lerp(old_op.matrix_scale.y, new_op.matrix_scale.y),
-                                             lerp(old_op.matrix_scale.z, new_op.matrix_scale.z),
-                                             new_op.matrix_scale.mode);
-                                break;
+                    case Op::SkinMatrixMtxFToMtx:
+                        break;
+                }
+            }
+        }
+    };
 
-                            case Op::MatrixRotate1Coord: {
-                                float v = interpolate_angle(old_op.matrix_rotate_1_coord.value, new_op.matrix_rotate_1_coord.value);
-                                u8 mode = new_op.matrix_rotate_1_coord.mode;
-                                switch (new_op.matrix_rotate_1_coord.coord) {
-                                    case 0:
-                                        Matrix_RotateX(v, mode);
-                                        break;
-
-                                    case 1:
-                                        Matrix_RotateY(v, mode);
-                                        break;
-
-                                    case 2:
-                                        Matrix_RotateZ(v, mode);
-                                        break;
-                                }
-                                break;
-                            }
+#ifdef PARALLEL_INTERPOLATION
+    // Fewest matches worth handing to a worker thread
+    constexpr size_t MinParallelMatches = 64;
+
+    // Whether an op uses the matrix on top of the stack. Ops with a mode only do when applied to it.
+    bool op_reads_top(const Match& match) {
+        const u8 apply = 1; // MTXMODE_APPLY
+
+        switch (match.op) {
+            case Op::OpenChild:
+            case Op::CloseChild:
+            case Op::MatrixPop:
+            case Op::MatrixPut:
+            case Op::MatrixSetTranslateRotateYXZ:
+            case Op::MatrixMtxFToMtx:
+            case Op::SkinMatrixMtxFToMtx:
+                return false;
+            case Op::MatrixMult:
+                return match.new_op->matrix_mult.mode == apply;
+            case Op::MatrixTranslate:
+                return match.new_op->matrix_translate.mode == apply;
+            case Op::MatrixScale:
+                return match.new_op->matrix_scale.mode == apply;
+            case Op::MatrixRotate1Coord:
+                return match.new_op->matrix_rotate_1_coord.mode == apply;
+            case Op::MatrixRotateZYX:
+                return match.new_op->matrix_rotate_zyx.mode == apply;
+            case Op::MatrixRotateAxis:
+                return match.new_op->matrix_rotate_axis.mode == apply;
+            default:
+                return true;
+        }
+    }
 
-                            case Op::MatrixRotateZYX:
-                                Matrix_RotateZYX(interpolate_angle(old_op.matrix_rotate_zyx.x, new_op.matrix_rotate_zyx.x),
-                                                 interpolate_angle(old_op.matrix_rotate_zyx.y, new_op.matrix_rotate_zyx.y),
-                                                 interpolate_angle(old_op.matrix_rotate_zyx.z, new_op.matrix_rotate_zyx.z),
-                                                 new_op.matrix_rotate_zyx.mode);
-                                break;
+    bool op_writes_top(Op op) {
+        switch (op) {
+            case Op::OpenChild:
+            case Op::CloseChild:
+            case Op::MatrixPush:
+            case Op::MatrixPop:
+            case Op::MatrixMtxFToMtx:
+            case Op::MatrixToMtx:
+            case Op::SkinMatrixMtxFToMtx:
+                return false;
+            default:
+                return true;
+        }
+    }
 
-                            case Op::MatrixTranslateRotateZYX:
-                                lerp_vec3f(&tmp_vec3f, &old_op.matrix_translate_rotate_zyx.translation, &new_op.matrix_translate_rotate_zyx.translation);
-                                interpolate_angles(&tmp_vec3s, &old_op.matrix_translate_rotate_zyx.rotation, &new_op.matrix_translate_rotate_zyx.rotation);
-                                Matrix_TranslateRotateZYX(&tmp_vec3f, &tmp_vec3s);
-                                break;
+    void analyze_segment(Segment& segment) {
+        int depth = 0;
 
-                            case Op::MatrixSetTranslateRotateYXZ:
-                                interpolate_angles(&tmp_vec3s, &old_op.matrix_set_translate_rotate_yxz.rot,
-                                                               &new_op.matrix_set_translate_rotate_yxz.rot);
-                                Matrix_SetTranslateRotateYXZ(lerp(old_op.matrix_set_translate_rotate_yxz.translateX,
-                                                                  new_op.matrix_set_translate_rotate_yxz.translateX),
-                                                             lerp(old_op.matrix_set_translate_rotate_yxz.translateY,
-                                                                  new_op.matrix_set_translate_rotate_yxz.translateY),
-                                                             lerp(old_op.matrix_set_translate_rotate_yxz.translateZ,
-                                                                  new_op.matrix_set_translate_rotate_yxz.translateZ),
-                                                             &tmp_vec3s);
-                                if (new_op.matrix_set_translate_rotate_yxz.has_mtx && old_op.matrix_set_translate_rotate_yxz.has_mtx) {
-                                    actor_mtx = *Matrix_GetCurrent();
-                                }
-                                break;
+        for (uint32_t i = segment.begin; i < segment.end; i++) {
+            const Match& match = matches[i];
 
-                            case Op::MatrixMtxFToMtx:
-                                interpolate_mtxf(new_replacement(new_op.matrix_mtxf_to_mtx.dest),
-                                                 &old_op.matrix_mtxf_to_mtx.src, &new_op.matrix_mtxf_to_mtx.src);
-                                break;
+            if (match.op == Op::MatrixSetTranslateRotateYXZ && match.new_op->matrix_set_translate_rotate_yxz.has_mtx &&
+                match.old_op->matrix_set_translate_rotate_yxz.has_mtx) {
+                segment.sets_actor_mtx = true;
+            }
+            if (match.op == Op::MatrixToMtx && match.new_op->matrix_to_mtx.has_adjusted &&
+                match.old_op->matrix_to_mtx.has_adjusted && !segment.sets_actor_mtx) {
+                segment.reads_actor_mtx = true;
+            }
 
-                            case Op::MatrixToMtx: {
-                                //*new_replacement(new_op.matrix_to_mtx.dest) = *Matrix_GetCurrent();
-                                if (old_op.matrix_to_mtx.has_adjusted && new_op.matrix_to_mtx.has_adjusted) {
-                                    interpolate_mtxf(&tmp_mtxf, &old_op.matrix_to_mtx.src, &new_op.matrix_to_mtx.src);
-                                    SkinMatrix_MtxFMtxFMult(&actor_mtx, &tmp_mtxf, new_replacement(new_op.matrix_to_mtx.dest));
-                                } else {
-                                    interpolate_mtxf(new_replacement(new_op.matrix_to_mtx.dest),
-                                                     &old_op.matrix_to_mtx.src, &new_op.matrix_to_mtx.src);
-                                }
-                                break;
-                            }
+            if (depth == 0 && !segment.sets_top && op_reads_top(match)) {
+                segment.reads_top = true;
+            }
+            if (match.op == Op::MatrixPush) {
+                depth++;
+            } else if (match.op == Op::MatrixPop) {
+                if (depth == 0) {
+                    // Pops into whatever was below the segment
+                    segment.reads_top = true;
+                } else {
+                    depth--;
+                }
+            } else if (depth == 0 && op_writes_top(match.op)) {
+                segment.sets_top = true;
+            }
+        }
+        if (depth != 0) {
+            segment.reads_top = true;
+        }
+    }
 
-                            case Op::MatrixReplaceRotation:
-                                interpolate_mtxf(&tmp_mtxf, &old_op.matrix_replace_rotation.mf, &new_op.matrix_replace_rotation.mf);
-                                Matrix_ReplaceRotation(&tmp_mtxf);
-                                break;
+    struct SegmentResult {
+        vector<pair<Mtx*, MtxF>> replacements;
+        // The top of the stack and actor matrix the group left behind, if it set them
+        MtxF top;
+        MtxF actor_mtx;
+        future<void> done;
+    };
 
-                            case Op::MatrixRotateAxis:
-                                lerp_vec3f(&tmp_vec3f, &old_op.matrix_rotate_axis.axis, &new_op.matrix_rotate_axis.axis);
-                                Matrix_RotateAxis(interpolate_angle(old_op.matrix_rotate_axis.angle, new_op.matrix_rotate_axis.angle),
-                                                  &tmp_vec3f, new_op.matrix_rotate_axis.mode);
-                                break;
+    vector<Segment> segment_groups;
+    vector<SegmentResult> segment_results;
+    bool has_segment_groups;
 
-                            case Op::SkinMatrixMtxFToMtx:
-                                break;
-                        }
-                    }
+    BS::thread_pool& get_interpolation_pool() {
+        static BS::thread_pool pool(max(2u, thread::hardware_concurrency()) - 1);
+        return pool;
+    }
+
+    // Top-level branches that start by replacing the top of the stack and put the stack back the way they found
+    // it, like every actor's draw, don't depend on anything replayed before them. Runs of those are grouped into
+    // chunks for the workers, everything else is replayed on the calling thread in between.
+    void update_segment_groups() {
+        if (has_segment_groups) {
+            return;
+        }
+        has_segment_groups = true;
+        segment_groups.clear();
+
+        size_t independent_matches = 0;
+        for (Segment& segment : segments) {
+            analyze_segment(segment);
+            if (!segment.reads_top && !segment.reads_actor_mtx) {
+                independent_matches += segment.end - segment.begin;
+            }
+        }
+        const size_t chunk_size =
+            max(MinParallelMatches, independent_matches / (get_interpolation_pool().get_thread_count() * 4));
+
+        for (const Segment& segment : segments) {
+            const bool independent = !segment.reads_top && !segment.reads_actor_mtx;
+            if (independent && !segment_groups.empty() && segment_groups.back().parallel &&
+                segment_groups.back().end - segment_groups.back().begin < chunk_size) {
+                Segment& group = segment_groups.back();
+                group.end = segment.end;
+                group.sets_top |= segment.sets_top;
+                group.sets_actor_mtx |= segment.sets_actor_mtx;
+            } else {
+                segment_groups.push_back(segment);
+                segment_groups.back().parallel = independent;
+            }
+        }
+        for (Segment& group : segment_groups) {
+            if (group.end - group.begin < MinParallelMatches) {
+                group.parallel = false;
+            }
+        }
+    }
+
+    void replay_parallel(InterpolateCtx& ctx) {
+        BS::thread_pool& pool = get_interpolation_pool();
+        // The last group sent to a worker whose top of the stack or actor matrix is the current one
+        int32_t pending_top = -1;
+        int32_t pending_actor_mtx = -1;
+
+        segment_results.resize(segment_groups.size());
+        for (size_t i = 0; i < segment_groups.size(); i++) {
+            const Segment& group = segment_groups[i];
+            SegmentResult& result = segment_results[i];
+            result.replacements.clear();
+
+            if (group.parallel) {
+                const float step = ctx.step;
+                result.done = pool.submit_task([&group, &result, step] {
+                    thread_local MtxF matrix_stack[20];
+                    sMatrixStack = matrix_stack;
+                    sCurrentMatrix = matrix_stack;
+
+                    InterpolateCtx worker_ctx;
+                    worker_ctx.step = step;
+                    worker_ctx.w = 1.0f - step;
+                    worker_ctx.segment_replacements = &result.replacements;
+                    worker_ctx.replay(matches.data() + group.begin, matches.data() + group.end);
+                    result.top = *Matrix_GetCurrent();
+                    result.actor_mtx = worker_ctx.actor_mtx;
+                });
+                if (group.sets_top) {
+                    pending_top = (int32_t)i;
                 }
+                if (group.sets_actor_mtx) {
+                    pending_actor_mtx = (int32_t)i;
+                }
+                continue;
+            }
+
+            result.done = {};
+            if (group.reads_top && pending_top >= 0) {
+                segment_results[pending_top].done.wait();
+                *Matrix_GetCurrent() = segment_results[pending_top].top;
+                pending_top = -1;
+            }
+            if (group.reads_actor_mtx && pending_actor_mtx >= 0) {
+                segment_results[pending_actor_mtx].done.wait();
+                ctx.actor_mtx = segment_results[pending_actor_mtx].actor_mtx;
+                pending_actor_mtx = -1;
+            }
+            if (group.sets_top) {
+                pending_top = -1;
+            }
+            if (group.sets_actor_mtx) {
+                pending_actor_mtx = -1;
             }
+            ctx.segment_replacements = &result.replacements;
+            ctx.replay(matches.data() + group.begin, matches.data() + group.end);
         }
-    };
+
+        if (pending_top >= 0) {
+            segment_results[pending_top].done.wait();
+            *Matrix_GetCurrent() = segment_results[pending_top].top;
+        }
+        for (SegmentResult& result : segment_results) {
+            if (result.done.valid()) {
+                result.done.get();
+            }
+            for (const auto& [addr, mtx] : result.replacements) {
+                (*ctx.mtx_replacements)[addr] = mtx;
+            }
+        }
+    }
+#endif
 
 } // anonymous namespace
 
+void FrameInterpolation_InterpolateFrames(const vector<float>& steps, vector<unordered_map<Mtx*, MtxF>>& mtx_replacements) {
+    update_matches();
+#ifdef PARALLEL_INTERPOLATION
+    const bool parallel = CVarGetInteger(CVAR_SETTING("ParallelInterpolation"), 0) && !steps.empty();
+    if (parallel) {
+        update_segment_groups();
+    }
+#endif
+    mtx_replacements.resize(steps.size());
+    for (size_t i = 0; i < steps.size(); i++) {
+        InterpolateCtx ctx;
+        ctx.step = steps[i];
+        ctx.w = 1.0f - steps[i];
+        ctx.mtx_replacements = &mtx_replacements[i];
+        ctx.mtx_replacements->clear();
+        ctx.mtx_replacements->reserve(match_replacement_count);
+#ifdef PARALLEL_INTERPOLATION
+        if (parallel) {
+            replay_parallel(ctx);
+            continue;
+        }
+#endif
+        ctx.replay(matches.data(), matches.data() + matches.size());
+    }
+}
+
 unordered_map<Mtx*, MtxF> FrameInterpolation_Interpolate(float step) {
-    InterpolateCtx ctx;
-    ctx.step = step;
-    ctx.w = 1.0f - step;
-    ctx.interpolate_branch(&previous_recording.root_path, &current_recording.root_path);
-    return ctx.mtx_replacements;
+    vector<unordered_map<Mtx*, MtxF>> mtx_replacements;
+    FrameInterpolation_InterpolateFrames({ step }, mtx_replacements);
+    return std::move(mtx_replacements[0]);
 }
 
 void FrameInterpolation_StartRecord(void) {
-    previous_recording = move(current_recording);
-    current_recording = {};
+    swap(previous_recording, current_recording);
+    current_recording.clear();
     current_path.clear();
-    current_path.push_back(&current_recording.root_path);
+    current_path.push_back(0);
+    has_matches = false;
+#ifdef PARALLEL_INTERPOLATION
+    has_segment_groups = false;
+#endif
     if (OTRGlobals::Instance->GetInterpolationFPS() != 20) {
         is_recording = true;
     }
@@ -460,15 +908,22 @@ void FrameInterpolation_StartRecord(void) {
 void FrameInterpolation_StopRecord(void) {
     previous_camera_epoch = camera_epoch;
     is_recording = false;
+    current_recording.finish();
 }
 
 void FrameInterpolation_RecordOpenChild(const void* a, int b) {
     if (!is_recording)
         return;
-    label key = { a, b };
-    auto& m = current_path.back()->children[key];
-    append(Op::OpenChild).open_child = { key, m.size() };
-    current_path.push_back(&m.emplace_back());
+    const uint32_t parent_index = current_path.back();
+    const uint32_t child_index = (uint32_t)current_recording.nodes.size();
+    Node& parent = current_recording.nodes[parent_index];
+    parent.item_count++;
+    parent.child_count++;
+    current_recording.items.push_back({ Op::OpenChild, parent_index, child_index, 0 });
+
+    Node& child = current_recording.nodes.emplace_back();
+    child.key = { a, b };
+    current_path.push_back(child_index);
 }
 
 void FrameInterpolation_RecordCloseChild(void) {
@@ -1,13 +1,21 @@
 #pragma once
 
 #include "include/z64math.h"
+#include "thread_local.h"
 
 #ifdef __cplusplus
 
 #include <unordered_map>
+#include <vector>
 
 std::unordered_map<Mtx*, MtxF> FrameInterpolation_Interpolate(float step);
 
+// Interpolates the last two recorded frames once for each step, matching them only once. mtx_replacements is
+// resized to the number of steps and its maps are cleared and refilled, so passing the same vector every frame
+// reuses their memory.
+void FrameInterpolation_InterpolateFrames(const std::vector<float>& steps,
+                                          std::vector<std::unordered_map<Mtx*, MtxF>>& mtx_replacements);
+
 extern "C" {
 
 #endif
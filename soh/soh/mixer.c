@@ -14,11 +14,37 @@
 #define ROUND_UP_8(v) (((v) + 7) & ~7)
 #define ROUND_DOWN_16(v) ((v) & ~0xf)
 
+// SSE2 is part of every x86_64 target and NEON of every arm64 one, so those are picked at compile time. AVX2 is
+// checked for once by Mixer_Init and only used by aMix and aAddMixer, which work through 16 samples at a time. The
+// vector paths compute the same integers as the scalar code, with saturating adds and packs standing in for clamp16.
+// MIXER_NO_SIMD leaves only the scalar code, which the golden test in mixer_test.c checks the others against.
+#if defined(MIXER_NO_SIMD)
+#elif defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MIXER_SSE2
+#include <immintrin.h>
+#ifdef _WIN32
+#include <intrin.h>
+#endif
+#if defined(_MSC_VER) || defined(__GNUC__)
+#define MIXER_AVX2
+#endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define MIXER_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(MIXER_AVX2) && defined(__GNUC__)
+#define MIXER_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MIXER_TARGET_AVX2
+#endif
+
 #define DMEM_BUF_SIZE (0x1000 - 0x3C0 - 0x40)
 #define BUF_U8(a) (rspa.buf.as_u8 + ((a) - 0x3C0))
 #define BUF_S16(a) (rspa.buf.as_s16 + ((a) - 0x3C0) / sizeof(int16_t))
 
-static struct {
+// Every thread that runs audio commands has its own DMEM, so notes can be synthesized on several threads at once
+static SOH_THREAD_LOCAL struct {
     uint16_t in;
     uint16_t out;
     uint16_t nbytes;
@@ -39,6 +65,14 @@ static struct {
         int16_t as_s16[DMEM_BUF_SIZE / sizeof(int16_t)];
         uint8_t as_u8[DMEM_BUF_SIZE];
     } buf;
+
+#ifdef MIXER_SSE2
+    // adpcm_table rearranged for _mm_madd_epi16, see aADPCMdecBuildCoefs. Kept after everything else so out of range
+    // table indices read the same fields they always have.
+    int16_t adpcm_coefs[8][2][5][8];
+    // Bit t is set once adpcm_coefs[t] matches adpcm_table[t]
+    uint8_t adpcm_coefs_built;
+#endif
 } rspa;
 
 static int16_t resample_table[64][4] = {
@@ -94,6 +128,32 @@ static inline int32_t clamp32(int64_t v) {
     return (int32_t)v;
 }
 
+#ifdef MIXER_SSE2
+// Lane i of the result is the sum of the four lanes of v[i]
+static inline __m128i HorizontalSum4x4Sse2(const __m128i v[4]) {
+    __m128i a = _mm_add_epi32(_mm_unpacklo_epi32(v[0], v[1]), _mm_unpackhi_epi32(v[0], v[1]));
+    __m128i b = _mm_add_epi32(_mm_unpacklo_epi32(v[2], v[3]), _mm_unpackhi_epi32(v[2], v[3]));
+    return _mm_add_epi32(_mm_unpacklo_epi64(a, b), _mm_unpackhi_epi64(a, b));
+}
+
+// (s * vol) >> 16 with s signed and vol unsigned. _mm_mulhi_epi16 reads a vol with the top bit set as vol - 0x10000,
+// which takes s off the high half of the product.
+static inline __m128i MulHiU16Sse2(__m128i s, uint16_t vol) {
+    __m128i hi = _mm_mulhi_epi16(s, _mm_set1_epi16((int16_t)vol));
+    return (vol & 0x8000) ? _mm_add_epi16(hi, s) : hi;
+}
+#endif
+
+#ifdef MIXER_NEON
+// (s * vol) >> 16 with s signed and vol unsigned
+static inline int16x8_t MulHiU16Neon(int16x8_t s, uint16_t vol) {
+    int32x4_t v = vdupq_n_s32(vol);
+    int32x4_t lo = vmulq_s32(vmovl_s16(vget_low_s16(s)), v);
+    int32x4_t hi = vmulq_s32(vmovl_s16(vget_high_s16(s)), v);
+    return vcombine_s16(vshrn_n_s32(lo, 16), vshrn_n_s32(hi, 16));
+}
+#endif
+
 void aClearBufferImpl(uint16_t addr, int nbytes) {
     nbytes = ROUND_UP_16(nbytes);
     memset(BUF_U8(addr), 0, nbytes);
@@ -113,8 +173,40 @@ void aSaveBufferImpl(uint16_t source_addr, int16_t *dest_addr, uint16_t nbytes)
     memcpy(dest_addr, BUF_S16(source_addr), ROUND_DOWN_16(nbytes));
 }
 
+#ifdef MIXER_SSE2
+// Each decoded sample is a sum over the two previous outputs and the eight inputs of the frame, written out as the
+// coefficient of each of those ten values for each of the eight outputs. Coefficients come in pairs of neighbouring
+// values per output, the layout _mm_madd_epi16 multiplies and adds. Built the first time a table is used after
+// being loaded, since most notes only use a few of them.
+static void aADPCMdecBuildCoefs(int t) {
+    int16_t(*tbl)[8] = rspa.adpcm_table[t];
+
+    for (int j = 0; j < 8; j++) {
+        for (int m = 0; m < 10; m++) {
+            int16_t coef;
+
+            if (m < 2) {
+                coef = tbl[m][j];
+            } else if (m - 2 == j) {
+                coef = 1 << 11;
+            } else if (m - 2 < j) {
+                coef = tbl[1][j - (m - 2) - 1];
+            } else {
+                coef = 0;
+            }
+            rspa.adpcm_coefs[t][j / 4][m / 2][(j % 4) * 2 + m % 2] = coef;
+        }
+    }
+    rspa.adpcm_coefs_built |= 1 << t;
+}
+#endif
+
 void aLoadADPCMImpl(int num_entries_times_16, const int16_t *book_source_addr) {
     memcpy(rspa.adpcm_table, book_source_addr, num_entries_times_16);
+#ifdef MIXER_SSE2
+    int tables = (num_entries_times_16 + sizeof(rspa.adpcm_table[0]) - 1) / sizeof(rspa.adpcm_table[0]);
+    rspa.adpcm_coefs_built &= ~((1 << (tables < 8 ? tables : 8)) - 1);
+#endif
 }
 
 void aSetBufferImpl(uint8_t flags, uint16_t in, uint16_t out, uint16_t nbytes) {
@@ -129,6 +221,20 @@ void aInterleaveImpl(uint16_t dest, uint16_t left, uint16_t right, uint16_t c) {
     int16_t *r = BUF_S16(right);
     int16_t *d = BUF_S16(dest);
     while (count > 0) {
+#if defined(MIXER_SSE2)
+        __m128i lv = _mm_loadl_epi64((const __m128i*)l);
+        __m128i rv = _mm_loadl_epi64((const __m128i*)r);
+        _mm_storeu_si128((__m128i*)d, _mm_unpacklo_epi16(lv, rv));
+        l += 4;
+        r += 4;
+        d += 8;
+#elif defined(MIXER_NEON)
+        int16x4x2_t lr = { { vld1_s16(l), vld1_s16(r) } };
+        vst2_s16(d, lr);
+        l += 4;
+        r += 4;
+        d += 8;
+#else
         int16_t l0 = *l++;
         int16_t l1 = *l++;
         int16_t l2 = *l++;
@@ -145,6 +251,7 @@ void aInterleaveImpl(uint16_t dest, uint16_t left, uint16_t right, uint16_t c) {
         *d++ = r2;
         *d++ = l3;
         *d++ = r3;
+#endif
         --count;
     }
 }
@@ -158,6 +265,33 @@ void aSetLoopImpl(ADPCM_STATE *adpcm_loop_state) {
     rspa.adpcm_loop_state = adpcm_loop_state;
 }
 
+#ifdef MIXER_SSE2
+// Decodes the eight samples of one frame. The previous two outputs sit right before out, in the order their
+// coefficients are paired in.
+static void aADPCMdecFrameSse2(int16_t (*coefs)[5][8], const int16_t* ins, int16_t* out) {
+    __m128i insv = _mm_loadu_si128((const __m128i*)ins);
+    __m128i values[5];
+    int32_t prev;
+
+    memcpy(&prev, out - 2, sizeof(prev));
+    values[0] = _mm_set1_epi32(prev);
+    values[1] = _mm_shuffle_epi32(insv, _MM_SHUFFLE(0, 0, 0, 0));
+    values[2] = _mm_shuffle_epi32(insv, _MM_SHUFFLE(1, 1, 1, 1));
+    values[3] = _mm_shuffle_epi32(insv, _MM_SHUFFLE(2, 2, 2, 2));
+    values[4] = _mm_shuffle_epi32(insv, _MM_SHUFFLE(3, 3, 3, 3));
+
+    __m128i acc[2];
+    for (int h = 0; h < 2; h++) {
+        acc[h] = _mm_setzero_si128();
+        for (int p = 0; p < 5; p++) {
+            acc[h] = _mm_add_epi32(acc[h], _mm_madd_epi16(values[p], _mm_loadu_si128((const __m128i*)coefs[h][p])));
+        }
+        acc[h] = _mm_srai_epi32(acc[h], 11);
+    }
+    _mm_storeu_si128((__m128i*)out, _mm_packs_epi32(acc[0], acc[1]));
+}
+#endif
+
 void aADPCMdecImpl(uint8_t flags, ADPCM_STATE state) {
     uint8_t *in = BUF_U8(rspa.in);
     int16_t *out = BUF_S16(rspa.out);
@@ -195,6 +329,16 @@ void aADPCMdecImpl(uint8_t flags, ADPCM_STATE state) {
 					ins[j * 2 + 1] = (((*in++ & 0xf) << 28) >> 28) << shift;
 				}
 			}
+#ifdef MIXER_SSE2
+            if (table_index < 8) {
+                if (!(rspa.adpcm_coefs_built & (1 << table_index))) {
+                    aADPCMdecBuildCoefs(table_index);
+                }
+                aADPCMdecFrameSse2(rspa.adpcm_coefs[table_index], ins, out);
+                out += 8;
+                continue;
+            }
+#endif
             for (j = 0; j < 8; j++) {
                 int32_t acc = tbl[0][j] * prev2 + tbl[1][j] * prev1 + (ins[j] << 11);
                 for (k = 0; k < j; k++) {
@@ -217,8 +361,6 @@ void aResampleImpl(uint8_t flags, uint16_t pitch, RESAMPLE_STATE state) {
     int nbytes = ROUND_UP_16(rspa.nbytes);
     uint32_t pitch_accumulator;
     int i;
-    int16_t *tbl;
-    int32_t sample;
 
     if (flags & A_INIT) {
         memset(tmp, 0, 5 * sizeof(int16_t));
@@ -234,18 +376,50 @@ void aResampleImpl(uint8_t flags, uint16_t pitch, RESAMPLE_STATE state) {
     memcpy(in, tmp, 4 * sizeof(int16_t));
 
     do {
+        const int16_t* ins[8];
+        const int16_t* tbls[8];
+
         for (i = 0; i < 8; i++) {
-            tbl = resample_table[pitch_accumulator * 64 >> 16];
-            sample = ((in[0] * tbl[0] + 0x4000) >> 15) +
-                     ((in[1] * tbl[1] + 0x4000) >> 15) +
-                     ((in[2] * tbl[2] + 0x4000) >> 15) +
-                     ((in[3] * tbl[3] + 0x4000) >> 15);
-            *out++ = clamp16(sample);
+            ins[i] = in;
+            tbls[i] = resample_table[pitch_accumulator * 64 >> 16];
 
             pitch_accumulator += (pitch << 1);
             in += pitch_accumulator >> 16;
             pitch_accumulator %= 0x10000;
         }
+#ifdef MIXER_SSE2
+        // All eight samples are read before any is written, so this is skipped when out has caught up with in
+        if (out + 8 <= ins[0] || out >= ins[7] + 4) {
+            __m128i sums[8];
+
+            // Two outputs at a time, each product is rounded on its own before the four are added up
+            for (i = 0; i < 8; i += 2) {
+                __m128i samples = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)ins[i]),
+                                                     _mm_loadl_epi64((const __m128i*)ins[i + 1]));
+                __m128i coefs = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)tbls[i]),
+                                                   _mm_loadl_epi64((const __m128i*)tbls[i + 1]));
+                __m128i lo = _mm_mullo_epi16(samples, coefs);
+                __m128i hi = _mm_mulhi_epi16(samples, coefs);
+                __m128i round = _mm_set1_epi32(0x4000);
+
+                sums[i] = _mm_srai_epi32(_mm_add_epi32(_mm_unpacklo_epi16(lo, hi), round), 15);
+                sums[i + 1] = _mm_srai_epi32(_mm_add_epi32(_mm_unpackhi_epi16(lo, hi), round), 15);
+            }
+            _mm_storeu_si128((__m128i*)out,
+                             _mm_packs_epi32(HorizontalSum4x4Sse2(sums), HorizontalSum4x4Sse2(sums + 4)));
+            out += 8;
+            nbytes -= 8 * sizeof(int16_t);
+            continue;
+        }
+#endif
+        for (i = 0; i < 8; i++) {
+            const int16_t *tbl = tbls[i];
+            int32_t sample = ((ins[i][0] * tbl[0] + 0x4000) >> 15) +
+                             ((ins[i][1] * tbl[1] + 0x4000) >> 15) +
+                             ((ins[i][2] * tbl[2] + 0x4000) >> 15) +
+                             ((ins[i][3] * tbl[3] + 0x4000) >> 15);
+            *out++ = clamp16(sample);
+        }
         nbytes -= 8 * sizeof(int16_t);
     } while (nbytes > 0);
 
@@ -272,6 +446,41 @@ void aEnvSetup2Impl(uint16_t initial_vol_left, uint16_t initial_vol_right) {
     rspa.vol[1] = initial_vol_right;
 }
 
+#if defined(MIXER_SSE2)
+// One step of aEnvMixer, the 8 samples that share the same volumes
+static void aEnvMixerStepSse2(const int16_t* in, int16_t* dry[2], int16_t* wet[2], const uint16_t vols[2],
+                              uint16_t vol_wet, const int16_t negs[4], const int swapped[2]) {
+    __m128i in_samples = _mm_loadu_si128((const __m128i*)in);
+    __m128i samples[2];
+
+    for (int j = 0; j < 2; j++) {
+        samples[j] = _mm_xor_si128(MulHiU16Sse2(in_samples, vols[j]), _mm_set1_epi16(negs[j]));
+    }
+    for (int j = 0; j < 2; j++) {
+        __m128i wet_samples = _mm_xor_si128(MulHiU16Sse2(samples[swapped[j]], vol_wet), _mm_set1_epi16(negs[2 + j]));
+
+        _mm_storeu_si128((__m128i*)dry[j], _mm_adds_epi16(_mm_loadu_si128((const __m128i*)dry[j]), samples[j]));
+        _mm_storeu_si128((__m128i*)wet[j], _mm_adds_epi16(_mm_loadu_si128((const __m128i*)wet[j]), wet_samples));
+    }
+}
+#elif defined(MIXER_NEON)
+static void aEnvMixerStepNeon(const int16_t* in, int16_t* dry[2], int16_t* wet[2], const uint16_t vols[2],
+                              uint16_t vol_wet, const int16_t negs[4], const int swapped[2]) {
+    int16x8_t in_samples = vld1q_s16(in);
+    int16x8_t samples[2];
+
+    for (int j = 0; j < 2; j++) {
+        samples[j] = veorq_s16(MulHiU16Neon(in_samples, vols[j]), vdupq_n_s16(negs[j]));
+    }
+    for (int j = 0; j < 2; j++) {
+        int16x8_t wet_samples = veorq_s16(MulHiU16Neon(samples[swapped[j]], vol_wet), vdupq_n_s16(negs[2 + j]));
+
+        vst1q_s16(dry[j], vqaddq_s16(vld1q_s16(dry[j]), samples[j]));
+        vst1q_s16(wet[j], vqaddq_s16(vld1q_s16(wet[j]), wet_samples));
+    }
+}
+#endif
+
 void aEnvMixerImpl(uint16_t in_addr, uint16_t n_samples, bool swap_reverb,
 				   bool neg_3, bool neg_2,
                    bool neg_left, bool neg_right,
@@ -289,6 +498,35 @@ void aEnvMixerImpl(uint16_t in_addr, uint16_t n_samples, bool swap_reverb,
     uint16_t vol_wet = rspa.vol_wet;
     uint16_t rate_wet = rspa.rate_wet;
 
+#if defined(MIXER_SSE2) || defined(MIXER_NEON)
+    // Each step loads 8 samples of in before mixing any of them, which only changes the results when an output starts
+    // less than 8 samples after in
+    bool in_overlaps = false;
+    for (int j = 0; j < 2; j++) {
+        in_overlaps |= (dry[j] > in && dry[j] < in + 8) || (wet[j] > in && wet[j] < in + 8);
+    }
+    if (!in_overlaps) {
+        do {
+#if defined(MIXER_SSE2)
+            aEnvMixerStepSse2(in, dry, wet, vols, vol_wet, negs, swapped);
+#else
+            aEnvMixerStepNeon(in, dry, wet, vols, vol_wet, negs, swapped);
+#endif
+            in += 8;
+            for (int j = 0; j < 2; j++) {
+                dry[j] += 8;
+                wet[j] += 8;
+            }
+            vols[0] += rates[0];
+            vols[1] += rates[1];
+            vol_wet += rate_wet;
+
+            n -= 8;
+        } while (n > 0);
+        return;
+    }
+#endif
+
     do {
         for (int i = 0; i < 8; i++) {
             int16_t samples[2] = {*in, *in}; in++;
@@ -308,10 +546,7 @@ void aEnvMixerImpl(uint16_t in_addr, uint16_t n_samples, bool swap_reverb,
     } while (n > 0);
 }
 
-void aMixImpl(uint16_t count, int16_t gain, uint16_t in_addr, uint16_t out_addr) {
-    int nbytes = ROUND_UP_32(ROUND_DOWN_16(count << 4));
-    int16_t *in = BUF_S16(in_addr);
-    int16_t *out = BUF_S16(out_addr);
+static void aMixScalar(int nbytes, int16_t gain, const int16_t* in, int16_t* out) {
     int i;
     int32_t sample;
 
@@ -335,6 +570,217 @@ void aMixImpl(uint16_t count, int16_t gain, uint16_t in_addr, uint16_t out_addr)
     }
 }
 
+static void aAddMixerScalar(int nbytes, const int16_t* in, int16_t* out) {
+    do {
+        *out = clamp16(*out + *in++); out++;
+        *out = clamp16(*out + *in++); out++;
+        *out = clamp16(*out + *in++); out++;
+        *out = clamp16(*out + *in++); out++;
+        *out = clamp16(*out + *in++); out++;
+        *out = clamp16(*out + *in++); out++;
+        *out = clamp16(*out + *in++); out++;
+        *out = clamp16(*out + *in++); out++;
+        *out = clamp16(*out + *in++); out++;
+        *out = clamp16(*out + *in++); out++;
+        *out = clamp16(*out + *in++); out++;
+        *out = clamp16(*out + *in++); out++;
+        *out = clamp16(*out + *in++); out++;
+        *out = clamp16(*out + *in++); out++;
+        *out = clamp16(*out + *in++); out++;
+        *out = clamp16(*out + *in++); out++;
+
+        nbytes -= 16 * sizeof(int16_t);
+    } while (nbytes > 0);
+}
+
+#ifdef MIXER_SSE2
+// Pairs each out sample with its in sample so _mm_madd_epi16 does out * 0x7fff + in * gain in one go
+static void aMixSse2(int nbytes, int16_t gain, const int16_t* in, int16_t* out) {
+    __m128i gains = _mm_set_epi16(gain, 0x7fff, gain, 0x7fff, gain, 0x7fff, gain, 0x7fff);
+    __m128i round = _mm_set1_epi32(0x4000);
+
+    if (gain == -0x8000) {
+        while (nbytes > 0) {
+            for (int i = 0; i < 16; i += 8) {
+                __m128i o = _mm_loadu_si128((const __m128i*)(out + i));
+                _mm_storeu_si128((__m128i*)(out + i), _mm_subs_epi16(o, _mm_loadu_si128((const __m128i*)(in + i))));
+            }
+            in += 16;
+            out += 16;
+            nbytes -= 16 * sizeof(int16_t);
+        }
+    }
+
+    while (nbytes > 0) {
+        for (int i = 0; i < 16; i += 8) {
+            __m128i o = _mm_loadu_si128((const __m128i*)(out + i));
+            __m128i s = _mm_loadu_si128((const __m128i*)(in + i));
+            __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi16(o, s), gains);
+            __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi16(o, s), gains);
+
+            lo = _mm_srai_epi32(_mm_add_epi32(lo, round), 15);
+            hi = _mm_srai_epi32(_mm_add_epi32(hi, round), 15);
+            _mm_storeu_si128((__m128i*)(out + i), _mm_packs_epi32(lo, hi));
+        }
+        in += 16;
+        out += 16;
+        nbytes -= 16 * sizeof(int16_t);
+    }
+}
+
+static void aAddMixerSse2(int nbytes, const int16_t* in, int16_t* out) {
+    do {
+        for (int i = 0; i < 16; i += 8) {
+            __m128i o = _mm_loadu_si128((const __m128i*)(out + i));
+            _mm_storeu_si128((__m128i*)(out + i), _mm_adds_epi16(o, _mm_loadu_si128((const __m128i*)(in + i))));
+        }
+        in += 16;
+        out += 16;
+        nbytes -= 16 * sizeof(int16_t);
+    } while (nbytes > 0);
+}
+#endif
+
+#ifdef MIXER_AVX2
+// Same as the SSE2 versions with all 16 samples of a step in one register. The unpacks and packs work within each
+// 128 bit half, so the samples come back out in the order they went in.
+MIXER_TARGET_AVX2 static void aMixAvx2(int nbytes, int16_t gain, const int16_t* in, int16_t* out) {
+    __m256i gains = _mm256_set_epi16(gain, 0x7fff, gain, 0x7fff, gain, 0x7fff, gain, 0x7fff, gain, 0x7fff, gain,
+                                     0x7fff, gain, 0x7fff, gain, 0x7fff);
+    __m256i round = _mm256_set1_epi32(0x4000);
+
+    if (gain == -0x8000) {
+        while (nbytes > 0) {
+            __m256i o = _mm256_loadu_si256((const __m256i*)out);
+            _mm256_storeu_si256((__m256i*)out, _mm256_subs_epi16(o, _mm256_loadu_si256((const __m256i*)in)));
+            in += 16;
+            out += 16;
+            nbytes -= 16 * sizeof(int16_t);
+        }
+    }
+
+    while (nbytes > 0) {
+        __m256i o = _mm256_loadu_si256((const __m256i*)out);
+        __m256i s = _mm256_loadu_si256((const __m256i*)in);
+        __m256i lo = _mm256_madd_epi16(_mm256_unpacklo_epi16(o, s), gains);
+        __m256i hi = _mm256_madd_epi16(_mm256_unpackhi_epi16(o, s), gains);
+
+        lo = _mm256_srai_epi32(_mm256_add_epi32(lo, round), 15);
+        hi = _mm256_srai_epi32(_mm256_add_epi32(hi, round), 15);
+        _mm256_storeu_si256((__m256i*)out, _mm256_packs_epi32(lo, hi));
+        in += 16;
+        out += 16;
+        nbytes -= 16 * sizeof(int16_t);
+    }
+}
+
+MIXER_TARGET_AVX2 static void aAddMixerAvx2(int nbytes, const int16_t* in, int16_t* out) {
+    do {
+        __m256i o = _mm256_loadu_si256((const __m256i*)out);
+        _mm256_storeu_si256((__m256i*)out, _mm256_adds_epi16(o, _mm256_loadu_si256((const __m256i*)in)));
+        in += 16;
+        out += 16;
+        nbytes -= 16 * sizeof(int16_t);
+    } while (nbytes > 0);
+}
+
+static bool Mixer_HasAvx2(void) {
+#ifdef _MSC_VER
+    int cpuidData[4];
+
+    __cpuid(cpuidData, 1);
+    // AVX and OSXSAVE, then check the OS saves the ymm registers
+    if ((cpuidData[2] & (1 << 28)) == 0 || (cpuidData[2] & (1 << 27)) == 0 || (_xgetbv(0) & 6) != 6) {
+        return false;
+    }
+    __cpuidex(cpuidData, 7, 0);
+    return (cpuidData[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+typedef void (*MixerMixFunc)(int nbytes, int16_t gain, const int16_t* in, int16_t* out);
+typedef void (*MixerAddMixerFunc)(int nbytes, const int16_t* in, int16_t* out);
+
+// Switched to the AVX2 versions by Mixer_Init when the CPU has it
+static MixerMixFunc sMixerMix = aMixSse2;
+static MixerAddMixerFunc sMixerAddMixer = aAddMixerSse2;
+#endif
+
+#ifdef MIXER_NEON
+static void aMixNeon(int nbytes, int16_t gain, const int16_t* in, int16_t* out) {
+    if (gain == -0x8000) {
+        while (nbytes > 0) {
+            for (int i = 0; i < 16; i += 8) {
+                vst1q_s16(out + i, vqsubq_s16(vld1q_s16(out + i), vld1q_s16(in + i)));
+            }
+            in += 16;
+            out += 16;
+            nbytes -= 16 * sizeof(int16_t);
+        }
+    }
+
+    while (nbytes > 0) {
+        for (int i = 0; i < 16; i += 8) {
+            int16x8_t o = vld1q_s16(out + i);
+            int16x8_t s = vld1q_s16(in + i);
+            int32x4_t lo = vmlal_n_s16(vmull_n_s16(vget_low_s16(o), 0x7fff), vget_low_s16(s), gain);
+            int32x4_t hi = vmlal_n_s16(vmull_n_s16(vget_high_s16(o), 0x7fff), vget_high_s16(s), gain);
+
+            // Adds 0x4000 before shifting and saturates to 16 bits, the same as clamp16((x + 0x4000) >> 15)
+            vst1q_s16(out + i, vcombine_s16(vqrshrn_n_s32(lo, 15), vqrshrn_n_s32(hi, 15)));
+        }
+        in += 16;
+        out += 16;
+        nbytes -= 16 * sizeof(int16_t);
+    }
+}
+
+static void aAddMixerNeon(int nbytes, const int16_t* in, int16_t* out) {
+    do {
+        for (int i = 0; i < 16; i += 8) {
+            vst1q_s16(out + i, vqaddq_s16(vld1q_s16(out + i), vld1q_s16(in + i)));
+        }
+        in += 16;
+        out += 16;
+        nbytes -= 16 * sizeof(int16_t);
+    } while (nbytes > 0);
+}
+#endif
+
+void Mixer_Init(void) {
+#ifdef MIXER_AVX2
+    if (Mixer_HasAvx2()) {
+        sMixerMix = aMixAvx2;
+        sMixerAddMixer = aAddMixerAvx2;
+    }
+#endif
+}
+
+void aMixImpl(uint16_t count, int16_t gain, uint16_t in_addr, uint16_t out_addr) {
+    int nbytes = ROUND_UP_32(ROUND_DOWN_16(count << 4));
+    int16_t *in = BUF_S16(in_addr);
+    int16_t *out = BUF_S16(out_addr);
+
+#if defined(MIXER_SSE2) || defined(MIXER_NEON)
+    // The vector versions load up to 16 samples before storing any, which only changes the results when out starts
+    // less than 16 samples after in
+    if (out <= in || out >= in + 16) {
+#if defined(MIXER_AVX2)
+        sMixerMix(nbytes, gain, in, out);
+#elif defined(MIXER_SSE2)
+        aMixSse2(nbytes, gain, in, out);
+#else
+        aMixNeon(nbytes, gain, in, out);
+#endif
+        return;
+    }
+#endif
+
+    aMixScalar(nbytes, gain, in, out);
+}
+
 void aS8DecImpl(uint8_t flags, ADPCM_STATE state) {
     uint8_t *in = BUF_U8(rspa.in);
     int16_t *out = BUF_S16(rspa.out);
@@ -377,26 +823,21 @@ void aAddMixerImpl(uint16_t count, uint16_t in_addr, uint16_t out_addr) {
     int16_t *out = BUF_S16(out_addr);
     int nbytes = ROUND_UP_64(ROUND_DOWN_16(count));
 
-    do {
-        *out = clamp16(*out + *in++); out++;
-        *out = clamp16(*out + *in++); out++;
-        *out = clamp16(*out + *in++); out++;
-        *out = clamp16(*out + *in++); out++;
-        *out = clamp16(*out + *in++); out++;
-        *out = clamp16(*out + *in++); out++;
-        *out = clamp16(*out + *in++); out++;
-        *out = clamp16(*out + *in++); out++;
-        *out = clamp16(*out + *in++); out++;
-        *out = clamp16(*out + *in++); out++;
-        *out = clamp16(*out + *in++); out++;
-        *out = clamp16(*out + *in++); out++;
-        *out = clamp16(*out + *in++); out++;
-        *out = clamp16(*out + *in++); out++;
-        *out = clamp16(*out + *in++); out++;
-        *out = clamp16(*out + *in++); out++;
+#if defined(MIXER_SSE2) || defined(MIXER_NEON)
+    // Same overlap check as in aMixImpl
+    if (out <= in || out >= in + 16) {
+#if defined(MIXER_AVX2)
+        sMixerAddMixer(nbytes, in, out);
+#elif defined(MIXER_SSE2)
+        aAddMixerSse2(nbytes, in, out);
+#else
+        aAddMixerNeon(nbytes, in, out);
+#endif
+        return;
+    }
+#endif
 
-        nbytes -= 16 * sizeof(int16_t);
-    } while (nbytes > 0);
+    aAddMixerScalar(nbytes, in, out);
 }
 
 void aDuplicateImpl(uint16_t count, uint16_t in_addr, uint16_t out_addr) {
@@ -475,8 +916,38 @@ void aFilterImpl(uint8_t flags, uint16_t count_or_buf, int16_t *state_or_filter)
             rspa.filter[i] = (tmp2[i] + rspa.filter[i]) / 2;
         }
 
+#ifdef MIXER_SSE2
+        // The scalar code sums in 64 bits. With the taps adding up to less than 2.0 in magnitude the sums can't leave
+        // 32 bits, so _mm_madd_epi16 gives the same results, which is the case for any filter that doesn't amplify.
+        int taps_magnitude = 0;
+        for (int i = 0; i < 8; i++) {
+            taps_magnitude += rspa.filter[i] < 0 ? -rspa.filter[i] : rspa.filter[i];
+        }
+        bool use_sse2 = taps_magnitude < 0x10000;
+        __m128i taps = _mm_set_epi16(rspa.filter[0], rspa.filter[1], rspa.filter[2], rspa.filter[3], rspa.filter[4],
+                                     rspa.filter[5], rspa.filter[6], rspa.filter[7]);
+#endif
+
         do {
             memcpy(tmp + 8, buf, 8 * sizeof(int16_t));
+#ifdef MIXER_SSE2
+            if (use_sse2) {
+                __m128i sums[8];
+                __m128i round = _mm_set1_epi32(0x4000);
+
+                for (int i = 0; i < 8; i++) {
+                    sums[i] = _mm_madd_epi16(_mm_loadu_si128((const __m128i*)(tmp + i)), taps);
+                }
+                __m128i lo = _mm_srai_epi32(_mm_add_epi32(HorizontalSum4x4Sse2(sums), round), 15);
+                __m128i hi = _mm_srai_epi32(_mm_add_epi32(HorizontalSum4x4Sse2(sums + 4), round), 15);
+                _mm_storeu_si128((__m128i*)buf, _mm_packs_epi32(lo, hi));
+
+                memcpy(tmp, tmp + 8, 8 * sizeof(int16_t));
+                buf += 8;
+                count -= 8 * sizeof(int16_t);
+                continue;
+            }
+#endif
             for (int i = 0; i < 8; i++) {
                 int64_t sample = 0x4000; // round term
                 for (int j = 0; j < 8; j++) {
@@ -522,6 +993,13 @@ void aUnkCmd19Impl(uint8_t f, uint16_t count, uint16_t out_addr, uint16_t in_add
     int16_t *out = BUF_S16(out_addr);
     int16_t tbl[32];
 
+    // AudioSynth_ProcessNote points this below the audio buffers, at RSP DMEM this mixer doesn't have. Going through
+    // with it would scale whatever lies next to rspa in memory.
+    if (out_addr < 0x3C0 || out_addr + nbytes > 0x3C0 + DMEM_BUF_SIZE || in_addr + f < 0x3C0 ||
+        in_addr + f + sizeof(tbl) > 0x3C0 + DMEM_BUF_SIZE) {
+        return;
+    }
+
     memcpy(tbl, in, 32 * sizeof(int16_t));
     do {
         for (int i = 0; i < 32; i++) {
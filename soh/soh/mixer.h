@@ -3,6 +3,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "libultraship/libultra/abi.h"
+#include "thread_local.h"
 
 #undef aSegment
 #undef aClearBuffer
@@ -32,6 +33,9 @@
 #undef aUnkCmd3
 #undef aUnkCmd19
 
+// Picks the vector versions the CPU supports. Called once from OTRAudio_Init, before any thread runs audio commands.
+void Mixer_Init(void);
+
 void aClearBufferImpl(uint16_t addr, int nbytes);
 void aLoadBufferImpl(const void* source_addr, uint16_t dest_addr, uint16_t nbytes);
 void aSaveBufferImpl(uint16_t source_addr, int16_t* dest_addr, uint16_t nbytes);
@@ -0,0 +1,432 @@
+// Mixer golden test.
+//
+// Checks the vector versions of the audio commands against the scalar code,
+// which mixer_test_scalar.c builds on its own. aMix and aAddMixer are run
+// directly with the SSE2, AVX2 and NEON versions, whichever this build and CPU
+// have. Then random aInterleave, aADPCMdec, aResample, aEnvMixer, aFilter, aMix
+// and aAddMixer commands run through both builds from the same DMEM and states,
+// and everything they leave behind has to be the same. A quarter of the runs
+// of aResample, aEnvMixer, aMix and aAddMixer have buffers overlapping closer
+// than a vector step, and a quarter of aFilter's have taps too large for 32
+// bit sums, which is when they take their scalar fallbacks.
+// The buffers lean on the values where clamping and rounding kick in. Exits
+// with 1 on the first mismatch. Built as the soh-mixer-test target, it
+// includes mixer.c to get at the versions it picks between.
+
+#include "mixer.c"
+
+#include <stdio.h>
+
+#define TEST_RUNS 20000
+// In samples, more than fits in DMEM
+#define TEST_MAX_SAMPLES 0x800
+#define TEST_COMMAND_RUNS 100000
+// Where DMEM starts and how much of it the commands use
+#define TEST_DMEM_START 0x3C0
+#define TEST_DMEM_SIZE DMEM_BUF_SIZE
+
+typedef void (*MixerTestMixFunc)(int nbytes, int16_t gain, const int16_t* in, int16_t* out);
+typedef void (*MixerTestAddMixerFunc)(int nbytes, const int16_t* in, int16_t* out);
+
+typedef struct {
+    const char* name;
+    MixerTestMixFunc mix;
+    MixerTestAddMixerFunc addMixer;
+} MixerTestImpl;
+
+static uint32_t sRandomState = 1;
+
+static uint32_t Random(void) {
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+    return sRandomState;
+}
+
+static int16_t RandomSample(void) {
+    switch (Random() % 8) {
+        case 0:
+            return -0x8000;
+        case 1:
+            return 0x7fff;
+        case 2:
+        case 3:
+            return (int16_t)(Random() % 512) - 256;
+        default:
+            return (int16_t)Random();
+    }
+}
+
+static void FillRandom(int16_t* samples, int count) {
+    for (int i = 0; i < count; i++) {
+        samples[i] = RandomSample();
+    }
+}
+
+static bool CheckSame(const char* name, const char* func, int run, const int16_t* expected, const int16_t* actual,
+                      int count) {
+    for (int i = 0; i < count; i++) {
+        if (expected[i] != actual[i]) {
+            printf("%s %s differs on run %d at sample %d: %d instead of %d\n", name, func, run, i, actual[i],
+                   expected[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool TestMixImpl(const MixerTestImpl* impl) {
+    static int16_t in[TEST_MAX_SAMPLES];
+    static int16_t out[TEST_MAX_SAMPLES];
+    static int16_t expected[TEST_MAX_SAMPLES];
+    static int16_t actual[TEST_MAX_SAMPLES];
+
+    sRandomState = 1;
+    for (int run = 0; run < TEST_RUNS; run++) {
+        // Both only ever get whole steps of 16 samples
+        int count = 16 * (1 + Random() % (TEST_MAX_SAMPLES / 16));
+        int16_t gain = (Random() % 4 == 0) ? -0x8000 : RandomSample();
+
+        FillRandom(in, count);
+        FillRandom(out, count);
+
+        memcpy(expected, out, count * sizeof(int16_t));
+        memcpy(actual, out, count * sizeof(int16_t));
+        aMixScalar(count * sizeof(int16_t), gain, in, expected);
+        impl->mix(count * sizeof(int16_t), gain, in, actual);
+        if (!CheckSame(impl->name, "aMix", run, expected, actual, count)) {
+            return false;
+        }
+
+        memcpy(expected, out, count * sizeof(int16_t));
+        memcpy(actual, out, count * sizeof(int16_t));
+        aAddMixerScalar(count * sizeof(int16_t), in, expected);
+        impl->addMixer(count * sizeof(int16_t), in, actual);
+        if (!CheckSame(impl->name, "aAddMixer", run, expected, actual, count)) {
+            return false;
+        }
+
+        // Mixing a buffer into itself, which the overlap check still sends to the vector versions
+        memcpy(expected, out, count * sizeof(int16_t));
+        memcpy(actual, out, count * sizeof(int16_t));
+        aMixScalar(count * sizeof(int16_t), gain, expected, expected);
+        impl->mix(count * sizeof(int16_t), gain, actual, actual);
+        if (!CheckSame(impl->name, "aMix in place", run, expected, actual, count)) {
+            return false;
+        }
+    }
+
+    printf("%s: %d runs match the scalar versions\n", impl->name, TEST_RUNS);
+    return true;
+}
+
+// The commands of one build of mixer.c
+typedef struct {
+    void (*loadBuffer)(const void* source_addr, uint16_t dest_addr, uint16_t nbytes);
+    void (*saveBuffer)(uint16_t source_addr, int16_t* dest_addr, uint16_t nbytes);
+    void (*loadADPCM)(int num_entries_times_16, const int16_t* book_source_addr);
+    void (*setBuffer)(uint8_t flags, uint16_t in, uint16_t out, uint16_t nbytes);
+    void (*interleave)(uint16_t dest, uint16_t left, uint16_t right, uint16_t c);
+    void (*setLoop)(ADPCM_STATE* adpcm_loop_state);
+    void (*adpcmDec)(uint8_t flags, ADPCM_STATE state);
+    void (*resample)(uint8_t flags, uint16_t pitch, RESAMPLE_STATE state);
+    void (*envSetup1)(uint8_t initial_vol_wet, uint16_t rate_wet, uint16_t rate_left, uint16_t rate_right);
+    void (*envSetup2)(uint16_t initial_vol_left, uint16_t initial_vol_right);
+    void (*envMixer)(uint16_t in_addr, uint16_t n_samples, bool swap_reverb, bool neg_3, bool neg_2, bool neg_left,
+                     bool neg_right, int32_t wet_dry_addr, u32 unk);
+    void (*mix)(uint16_t count, int16_t gain, uint16_t in_addr, uint16_t out_addr);
+    void (*addMixer)(uint16_t count, uint16_t in_addr, uint16_t out_addr);
+    void (*filter)(uint8_t flags, uint16_t count_or_buf, int16_t* state_or_filter);
+} MixerTestCommands;
+
+void MixerScalar_aLoadBufferImpl(const void* source_addr, uint16_t dest_addr, uint16_t nbytes);
+void MixerScalar_aSaveBufferImpl(uint16_t source_addr, int16_t* dest_addr, uint16_t nbytes);
+void MixerScalar_aLoadADPCMImpl(int num_entries_times_16, const int16_t* book_source_addr);
+void MixerScalar_aSetBufferImpl(uint8_t flags, uint16_t in, uint16_t out, uint16_t nbytes);
+void MixerScalar_aInterleaveImpl(uint16_t dest, uint16_t left, uint16_t right, uint16_t c);
+void MixerScalar_aSetLoopImpl(ADPCM_STATE* adpcm_loop_state);
+void MixerScalar_aADPCMdecImpl(uint8_t flags, ADPCM_STATE state);
+void MixerScalar_aResampleImpl(uint8_t flags, uint16_t pitch, RESAMPLE_STATE state);
+void MixerScalar_aEnvSetup1Impl(uint8_t initial_vol_wet, uint16_t rate_wet, uint16_t rate_left, uint16_t rate_right);
+void MixerScalar_aEnvSetup2Impl(uint16_t initial_vol_left, uint16_t initial_vol_right);
+void MixerScalar_aEnvMixerImpl(uint16_t in_addr, uint16_t n_samples, bool swap_reverb, bool neg_3, bool neg_2,
+                               bool neg_left, bool neg_right, int32_t wet_dry_addr, u32 unk);
+void MixerScalar_aMixImpl(uint16_t count, int16_t gain, uint16_t in_addr, uint16_t out_addr);
+void MixerScalar_aAddMixerImpl(uint16_t count, uint16_t in_addr, uint16_t out_addr);
+void MixerScalar_aFilterImpl(uint8_t flags, uint16_t count_or_buf, int16_t* state_or_filter);
+
+static const MixerTestCommands sScalarCommands = {
+    MixerScalar_aLoadBufferImpl, MixerScalar_aSaveBufferImpl, MixerScalar_aLoadADPCMImpl, MixerScalar_aSetBufferImpl,
+    MixerScalar_aInterleaveImpl, MixerScalar_aSetLoopImpl,    MixerScalar_aADPCMdecImpl,  MixerScalar_aResampleImpl,
+    MixerScalar_aEnvSetup1Impl,  MixerScalar_aEnvSetup2Impl,  MixerScalar_aEnvMixerImpl,  MixerScalar_aMixImpl,
+    MixerScalar_aAddMixerImpl,   MixerScalar_aFilterImpl,
+};
+
+static const MixerTestCommands sVectorCommands = {
+    aLoadBufferImpl, aSaveBufferImpl, aLoadADPCMImpl, aSetBufferImpl, aInterleaveImpl, aSetLoopImpl, aADPCMdecImpl,
+    aResampleImpl,   aEnvSetup1Impl,  aEnvSetup2Impl, aEnvMixerImpl,  aMixImpl,        aAddMixerImpl, aFilterImpl,
+};
+
+typedef enum {
+    TEST_INTERLEAVE,
+    TEST_ADPCM_DEC,
+    TEST_RESAMPLE,
+    TEST_ENV_MIXER,
+    TEST_FILTER,
+    TEST_MIX,
+    TEST_ADD_MIXER,
+    TEST_MAX,
+} MixerTestCommand;
+
+static const char* sCommandNames[TEST_MAX] = {
+    "aInterleave", "aADPCMdec", "aResample", "aEnvMixer", "aFilter", "aMix", "aAddMixer",
+};
+
+// Everything a command gets, picked at random
+typedef struct {
+    MixerTestCommand command;
+    bool fallback;
+    int16_t dmem[TEST_DMEM_SIZE / sizeof(int16_t)];
+    int16_t book[128];
+    int bookSize;
+    ADPCM_STATE loopState;
+    int16_t state[16];
+    int16_t filter[16];
+    uint16_t addrs[3];
+    uint16_t count;
+    uint8_t flags;
+    uint16_t pitch;
+    int16_t gain;
+    uint16_t envVols[2];
+    uint16_t envRates[2];
+    uint8_t envVolWet;
+    uint16_t envRateWet;
+    bool envFlags[5];
+    int32_t wetDryAddr;
+} MixerTestCase;
+
+// What a command leaves behind
+typedef struct {
+    int16_t dmem[TEST_DMEM_SIZE / sizeof(int16_t)];
+    int16_t state[16];
+    int16_t filter[16];
+} MixerTestResult;
+
+// A 16 byte aligned address with room for size bytes after it and 0x20 before it, sometimes moved off by a few
+// samples
+static uint16_t RandomAddr(int size) {
+    uint16_t addr = TEST_DMEM_START + 0x20 + (Random() % ((TEST_DMEM_SIZE - size - 0x40) / 16)) * 16;
+
+    return (Random() % 4 == 0) ? addr + (Random() % 8) * 2 : addr;
+}
+
+static void MakeCase(MixerTestCase* test, MixerTestCommand command) {
+    test->command = command;
+    // aInterleave has no scalar fallback, and aADPCMdec falls back for every frame whose table index is past the
+    // tables, which the random input hits all the time
+    test->fallback = command != TEST_INTERLEAVE && command != TEST_ADPCM_DEC && Random() % 4 == 0;
+    FillRandom(test->dmem, TEST_DMEM_SIZE / sizeof(int16_t));
+    FillRandom(test->book, 128);
+    test->bookSize = (Random() % 2) ? 256 : 16 * (1 + Random() % 16);
+    FillRandom(test->loopState, 16);
+    FillRandom(test->state, 16);
+    FillRandom(test->filter, 16);
+
+    switch (command) {
+        case TEST_INTERLEAVE:
+            test->count = Random() % 0x1A0;
+            test->addrs[0] = RandomAddr(0x340);
+            test->addrs[1] = RandomAddr(0x1A0);
+            test->addrs[2] = RandomAddr(0x1A0);
+            break;
+        case TEST_ADPCM_DEC:
+            test->count = Random() % 0x200;
+            test->addrs[0] = RandomAddr(0x140);
+            test->addrs[1] = RandomAddr(0x240);
+            // A_INIT, A_LOOP or neither, and 2 bit samples
+            test->flags = (Random() % 3) | ((Random() & 1) << 2);
+            break;
+        case TEST_RESAMPLE:
+            test->count = Random() % 0x180;
+            test->addrs[0] = RandomAddr(0x400) + 0x40;
+            // Writing over the samples still to be read
+            test->addrs[1] = test->fallback ? test->addrs[0] : RandomAddr(0x180);
+            test->flags = Random() % 3;
+            test->pitch = Random() % 0x8000;
+            // How far back the samples kept from the last update start
+            test->state[5] = (Random() & 1) ? 0 : (-8 - (int)(Random() % 8)) * 2;
+            break;
+        case TEST_ENV_MIXER:
+            test->count = Random() % 0x170;
+            test->addrs[0] = RandomAddr(0x2E0);
+            test->wetDryAddr = 0;
+            for (int i = 0; i < 4; i++) {
+                test->wetDryAddr |= ((RandomAddr(0x2E0) >> 4) & 0xFF) << (8 * i);
+            }
+            if (Random() & 1) {
+                // Dry and wet right the same
+                test->wetDryAddr = (test->wetDryAddr & 0xFFFF0000) | ((test->wetDryAddr >> 16) & 0xFFFF);
+            }
+            if (test->fallback) {
+                // Dry left starting a few samples after in
+                test->addrs[0] = (((test->wetDryAddr >> 24) & 0xFF) << 4) - 2 * (1 + Random() % 7);
+            }
+            test->envVolWet = Random() & 0xFF;
+            test->envRateWet = Random();
+            test->envRates[0] = Random();
+            test->envRates[1] = Random();
+            test->envVols[0] = Random();
+            test->envVols[1] = Random();
+            for (int i = 0; i < 5; i++) {
+                test->envFlags[i] = Random() & 1;
+            }
+            break;
+        case TEST_FILTER:
+            test->count = 1 + Random() % 0x170;
+            test->addrs[0] = RandomAddr(0x180);
+            test->flags = Random() % 2;
+            // Taps that don't amplify, unless the full range ones are kept
+            if (!test->fallback) {
+                for (int i = 0; i < 16; i++) {
+                    test->filter[i] = (int16_t)(Random() % 0x2000) - 0x1000;
+                }
+            }
+            break;
+        case TEST_MIX:
+            test->count = Random() % 0x1B;
+            test->addrs[0] = RandomAddr(0x1C0);
+            test->addrs[1] = (Random() % 4 == 0) ? test->addrs[0] : RandomAddr(0x1C0);
+            if (test->fallback) {
+                test->addrs[1] = test->addrs[0] + 2 * (1 + Random() % 15);
+            }
+            test->gain = (Random() % 4 == 0) ? -0x8000 : RandomSample();
+            break;
+        case TEST_ADD_MIXER:
+            test->count = Random() % 0x200;
+            test->addrs[0] = RandomAddr(0x240);
+            test->addrs[1] = test->fallback ? test->addrs[0] + 2 * (1 + Random() % 15) : RandomAddr(0x240);
+            break;
+        default:
+            break;
+    }
+}
+
+static void RunCase(const MixerTestCommands* commands, const MixerTestCase* test, MixerTestResult* result) {
+    ADPCM_STATE loopState;
+    const uint16_t* addrs = test->addrs;
+
+    memcpy(loopState, test->loopState, sizeof(loopState));
+    memcpy(result->state, test->state, sizeof(result->state));
+    memcpy(result->filter, test->filter, sizeof(result->filter));
+    commands->loadBuffer(test->dmem, TEST_DMEM_START, TEST_DMEM_SIZE);
+    commands->loadADPCM(test->bookSize, test->book);
+    commands->setLoop(&loopState);
+
+    switch (test->command) {
+        case TEST_INTERLEAVE:
+            commands->interleave(addrs[0], addrs[1], addrs[2], test->count);
+            break;
+        case TEST_ADPCM_DEC:
+            commands->setBuffer(0, addrs[0], addrs[1], test->count);
+            commands->adpcmDec(test->flags, result->state);
+            break;
+        case TEST_RESAMPLE:
+            commands->setBuffer(0, addrs[0], addrs[1], test->count);
+            commands->resample(test->flags, test->pitch, result->state);
+            break;
+        case TEST_ENV_MIXER:
+            commands->envSetup1(test->envVolWet, test->envRateWet, test->envRates[0], test->envRates[1]);
+            commands->envSetup2(test->envVols[0], test->envVols[1]);
+            commands->envMixer(addrs[0], test->count, test->envFlags[0], test->envFlags[1], test->envFlags[2],
+                               test->envFlags[3], test->envFlags[4], test->wetDryAddr, 0);
+            break;
+        case TEST_FILTER:
+            commands->filter(2, test->count, result->filter);
+            commands->filter(test->flags, addrs[0], result->state);
+            break;
+        case TEST_MIX:
+            commands->mix(test->count, test->gain, addrs[0], addrs[1]);
+            break;
+        case TEST_ADD_MIXER:
+            commands->addMixer(test->count, addrs[0], addrs[1]);
+            break;
+        default:
+            break;
+    }
+
+    commands->saveBuffer(TEST_DMEM_START, result->dmem, TEST_DMEM_SIZE);
+}
+
+static bool TestCommands(const char* name) {
+    static MixerTestCase test;
+    static MixerTestResult expected;
+    static MixerTestResult actual;
+    int runs[TEST_MAX][2] = { 0 };
+
+    sRandomState = 1;
+    for (int run = 0; run < TEST_COMMAND_RUNS; run++) {
+        MakeCase(&test, (MixerTestCommand)(run % TEST_MAX));
+        RunCase(&sScalarCommands, &test, &expected);
+        RunCase(&sVectorCommands, &test, &actual);
+
+        if (!CheckSame(name, sCommandNames[test.command], run, expected.dmem, actual.dmem,
+                       TEST_DMEM_SIZE / sizeof(int16_t)) ||
+            !CheckSame(name, sCommandNames[test.command], run, expected.state, actual.state, 16) ||
+            !CheckSame(name, sCommandNames[test.command], run, expected.filter, actual.filter, 16)) {
+            return false;
+        }
+        runs[test.command][test.fallback]++;
+    }
+
+    for (int i = 0; i < TEST_MAX; i++) {
+        printf("%s: %s matches the scalar version in %d runs", name, sCommandNames[i], runs[i][0] + runs[i][1]);
+        if (runs[i][1] > 0) {
+            printf(", %d of them set up for the fallback", runs[i][1]);
+        }
+        printf("\n");
+    }
+    return true;
+}
+
+int main(void) {
+    MixerTestImpl impls[3];
+    int numImpls = 0;
+
+#ifdef MIXER_SSE2
+    impls[numImpls++] = (MixerTestImpl){ "SSE2", aMixSse2, aAddMixerSse2 };
+#endif
+#ifdef MIXER_AVX2
+    if (Mixer_HasAvx2()) {
+        impls[numImpls++] = (MixerTestImpl){ "AVX2", aMixAvx2, aAddMixerAvx2 };
+    } else {
+        printf("AVX2: not supported by this CPU, skipped\n");
+    }
+#endif
+#ifdef MIXER_NEON
+    impls[numImpls++] = (MixerTestImpl){ "NEON", aMixNeon, aAddMixerNeon };
+#endif
+
+    if (numImpls == 0) {
+        printf("no vector versions in this build\n");
+    }
+
+    for (int i = 0; i < numImpls; i++) {
+        if (!TestMixImpl(&impls[i])) {
+            return 1;
+        }
+    }
+
+    // The commands as the game runs them, before and after Mixer_Init picks AVX2 for aMix and aAddMixer
+    if (!TestCommands("commands")) {
+        return 1;
+    }
+#ifdef MIXER_AVX2
+    if (Mixer_HasAvx2()) {
+        Mixer_Init();
+        if (!TestCommands("commands with AVX2")) {
+            return 1;
+        }
+    }
+#endif
+    return 0;
+}
@@ -0,0 +1,32 @@
+// mixer.c with only its scalar code, for mixer_test.c to check the vector
+// versions against. Every function gets a MixerScalar_ prefix so it links next
+// to the real mixer.c.
+
+#define MIXER_NO_SIMD
+
+#define Mixer_Init MixerScalar_Init
+#define aClearBufferImpl MixerScalar_aClearBufferImpl
+#define aLoadBufferImpl MixerScalar_aLoadBufferImpl
+#define aSaveBufferImpl MixerScalar_aSaveBufferImpl
+#define aLoadADPCMImpl MixerScalar_aLoadADPCMImpl
+#define aSetBufferImpl MixerScalar_aSetBufferImpl
+#define aInterleaveImpl MixerScalar_aInterleaveImpl
+#define aDMEMMoveImpl MixerScalar_aDMEMMoveImpl
+#define aSetLoopImpl MixerScalar_aSetLoopImpl
+#define aADPCMdecImpl MixerScalar_aADPCMdecImpl
+#define aResampleImpl MixerScalar_aResampleImpl
+#define aEnvSetup1Impl MixerScalar_aEnvSetup1Impl
+#define aEnvSetup2Impl MixerScalar_aEnvSetup2Impl
+#define aEnvMixerImpl MixerScalar_aEnvMixerImpl
+#define aMixImpl MixerScalar_aMixImpl
+#define aS8DecImpl MixerScalar_aS8DecImpl
+#define aAddMixerImpl MixerScalar_aAddMixerImpl
+#define aDuplicateImpl MixerScalar_aDuplicateImpl
+#define aResampleZohImpl MixerScalar_aResampleZohImpl
+#define aInterlImpl MixerScalar_aInterlImpl
+#define aFilterImpl MixerScalar_aFilterImpl
+#define aHiLoGainImpl MixerScalar_aHiLoGainImpl
+#define aUnkCmd3Impl MixerScalar_aUnkCmd3Impl
+#define aUnkCmd19Impl MixerScalar_aUnkCmd19Impl
+
+#include "mixer.c"
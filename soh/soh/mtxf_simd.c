@@ -0,0 +1,245 @@
+#include "mtxf_simd.h"
+
+// SSE is part of every x86_64 target and NEON of every arm64 one, so those are picked at compile time. AVX is
+// checked for at runtime and only used for the two operations that touch the whole matrix. None of the paths
+// use fused multiply-add, since rounding once instead of twice would change the results.
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define MTXF_SSE
+#include <immintrin.h>
+#ifdef _WIN32
+#include <intrin.h>
+#endif
+#if defined(_MSC_VER) || defined(__GNUC__)
+#define MTXF_AVX
+#endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define MTXF_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(MTXF_AVX) && defined(__GNUC__)
+#define MTXF_TARGET_AVX __attribute__((target("avx")))
+#else
+#define MTXF_TARGET_AVX
+#endif
+
+// The rows of mf[][] are the columns of the matrix, so dest column j is the sum of the columns of mfA scaled by
+// the elements of column j of mfB, added up in the same order as SkinMatrix_MtxFMtxFMult.
+
+static void MtxFSimd_MultScalar(const MtxF* mfA, const MtxF* mfB, MtxF* dest) {
+    MtxF res;
+
+    for (s32 j = 0; j < 4; j++) {
+        for (s32 i = 0; i < 4; i++) {
+            res.mf[j][i] = (mfA->mf[0][i] * mfB->mf[j][0]) + (mfA->mf[1][i] * mfB->mf[j][1]) +
+                           (mfA->mf[2][i] * mfB->mf[j][2]) + (mfA->mf[3][i] * mfB->mf[j][3]);
+        }
+    }
+    *dest = res;
+}
+
+static void MtxFSimd_LerpScalar(MtxF* dest, const MtxF* o, const MtxF* n, f32 w, f32 step) {
+    for (s32 i = 0; i < 4; i++) {
+        for (s32 j = 0; j < 4; j++) {
+            dest->mf[i][j] = w * o->mf[i][j] + step * n->mf[i][j];
+        }
+    }
+}
+
+#ifdef MTXF_SSE
+
+#define MTXF_SPLAT(v, i) _mm_shuffle_ps(v, v, _MM_SHUFFLE(i, i, i, i))
+
+static void MtxFSimd_MultSse(const MtxF* mfA, const MtxF* mfB, MtxF* dest) {
+    __m128 a0 = _mm_loadu_ps(mfA->mf[0]);
+    __m128 a1 = _mm_loadu_ps(mfA->mf[1]);
+    __m128 a2 = _mm_loadu_ps(mfA->mf[2]);
+    __m128 a3 = _mm_loadu_ps(mfA->mf[3]);
+    __m128 b[4];
+    s32 j;
+
+    for (j = 0; j < 4; j++) {
+        b[j] = _mm_loadu_ps(mfB->mf[j]);
+    }
+    for (j = 0; j < 4; j++) {
+        __m128 sum = _mm_add_ps(_mm_mul_ps(a0, MTXF_SPLAT(b[j], 0)), _mm_mul_ps(a1, MTXF_SPLAT(b[j], 1)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(a2, MTXF_SPLAT(b[j], 2)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(a3, MTXF_SPLAT(b[j], 3)));
+        _mm_storeu_ps(dest->mf[j], sum);
+    }
+}
+
+static void MtxFSimd_LerpSse(MtxF* dest, const MtxF* o, const MtxF* n, f32 w, f32 step) {
+    __m128 vw = _mm_set1_ps(w);
+    __m128 vstep = _mm_set1_ps(step);
+
+    for (s32 i = 0; i < 4; i++) {
+        __m128 res = _mm_add_ps(_mm_mul_ps(vw, _mm_loadu_ps(o->mf[i])), _mm_mul_ps(vstep, _mm_loadu_ps(n->mf[i])));
+        _mm_storeu_ps(dest->mf[i], res);
+    }
+}
+
+#endif
+
+#ifdef MTXF_AVX
+
+// Two columns of dest at a time, the columns of mfA are duplicated into both halves and each half splats from a
+// different column of mfB
+MTXF_TARGET_AVX static void MtxFSimd_MultAvx(const MtxF* mfA, const MtxF* mfB, MtxF* dest) {
+    __m256 a[4];
+    __m256 b01 = _mm256_loadu_ps(mfB->mf[0]);
+    __m256 b23 = _mm256_loadu_ps(mfB->mf[2]);
+    __m256 res[2];
+    s32 k;
+
+    for (k = 0; k < 4; k++) {
+        __m128 col = _mm_loadu_ps(mfA->mf[k]);
+        a[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(col), col, 1);
+    }
+    for (k = 0; k < 2; k++) {
+        __m256 b = k == 0 ? b01 : b23;
+        __m256 sum = _mm256_add_ps(_mm256_mul_ps(a[0], _mm256_permute_ps(b, _MM_SHUFFLE(0, 0, 0, 0))),
+                                   _mm256_mul_ps(a[1], _mm256_permute_ps(b, _MM_SHUFFLE(1, 1, 1, 1))));
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(a[2], _mm256_permute_ps(b, _MM_SHUFFLE(2, 2, 2, 2))));
+        res[k] = _mm256_add_ps(sum, _mm256_mul_ps(a[3], _mm256_permute_ps(b, _MM_SHUFFLE(3, 3, 3, 3))));
+    }
+    _mm256_storeu_ps(dest->mf[0], res[0]);
+    _mm256_storeu_ps(dest->mf[2], res[1]);
+}
+
+MTXF_TARGET_AVX static void MtxFSimd_LerpAvx(MtxF* dest, const MtxF* o, const MtxF* n, f32 w, f32 step) {
+    __m256 vw = _mm256_set1_ps(w);
+    __m256 vstep = _mm256_set1_ps(step);
+    __m256 lo = _mm256_add_ps(_mm256_mul_ps(vw, _mm256_loadu_ps(o->mf[0])),
+                              _mm256_mul_ps(vstep, _mm256_loadu_ps(n->mf[0])));
+    __m256 hi = _mm256_add_ps(_mm256_mul_ps(vw, _mm256_loadu_ps(o->mf[2])),
+                              _mm256_mul_ps(vstep, _mm256_loadu_ps(n->mf[2])));
+
+    _mm256_storeu_ps(dest->mf[0], lo);
+    _mm256_storeu_ps(dest->mf[2], hi);
+}
+
+static s32 MtxFSimd_HasAvx(void) {
+#ifdef _MSC_VER
+    int cpuidData[4];
+
+    __cpuid(cpuidData, 1);
+    // AVX and OSXSAVE, then check the OS saves the ymm registers
+    if ((cpuidData[2] & (1 << 28)) == 0 || (cpuidData[2] & (1 << 27)) == 0) {
+        return 0;
+    }
+    return (_xgetbv(0) & 6) == 6;
+#else
+    return __builtin_cpu_supports("avx");
+#endif
+}
+
+#endif
+
+#ifdef MTXF_NEON
+
+static void MtxFSimd_MultNeon(const MtxF* mfA, const MtxF* mfB, MtxF* dest) {
+    float32x4_t a0 = vld1q_f32(mfA->mf[0]);
+    float32x4_t a1 = vld1q_f32(mfA->mf[1]);
+    float32x4_t a2 = vld1q_f32(mfA->mf[2]);
+    float32x4_t a3 = vld1q_f32(mfA->mf[3]);
+    float32x4_t b[4];
+    s32 j;
+
+    for (j = 0; j < 4; j++) {
+        b[j] = vld1q_f32(mfB->mf[j]);
+    }
+    for (j = 0; j < 4; j++) {
+        float32x4_t sum = vaddq_f32(vmulq_n_f32(a0, vgetq_lane_f32(b[j], 0)), vmulq_n_f32(a1, vgetq_lane_f32(b[j], 1)));
+        sum = vaddq_f32(sum, vmulq_n_f32(a2, vgetq_lane_f32(b[j], 2)));
+        sum = vaddq_f32(sum, vmulq_n_f32(a3, vgetq_lane_f32(b[j], 3)));
+        vst1q_f32(dest->mf[j], sum);
+    }
+}
+
+static void MtxFSimd_LerpNeon(MtxF* dest, const MtxF* o, const MtxF* n, f32 w, f32 step) {
+    for (s32 i = 0; i < 4; i++) {
+        float32x4_t res = vaddq_f32(vmulq_n_f32(vld1q_f32(o->mf[i]), w), vmulq_n_f32(vld1q_f32(n->mf[i]), step));
+        vst1q_f32(dest->mf[i], res);
+    }
+}
+
+#endif
+
+typedef void (*MtxFMultFunc)(const MtxF* mfA, const MtxF* mfB, MtxF* dest);
+typedef void (*MtxFLerpFunc)(MtxF* dest, const MtxF* o, const MtxF* n, f32 w, f32 step);
+
+// The versions every CPU of this target has, switched to the AVX ones by MtxFSimd_Init when the CPU has it
+#if defined(MTXF_SSE)
+static MtxFMultFunc sMtxFMult = MtxFSimd_MultSse;
+static MtxFLerpFunc sMtxFLerp = MtxFSimd_LerpSse;
+#elif defined(MTXF_NEON)
+static MtxFMultFunc sMtxFMult = MtxFSimd_MultNeon;
+static MtxFLerpFunc sMtxFLerp = MtxFSimd_LerpNeon;
+#else
+static MtxFMultFunc sMtxFMult = MtxFSimd_MultScalar;
+static MtxFLerpFunc sMtxFLerp = MtxFSimd_LerpScalar;
+#endif
+
+void MtxFSimd_Init(void) {
+#ifdef MTXF_AVX
+    if (MtxFSimd_HasAvx()) {
+        sMtxFMult = MtxFSimd_MultAvx;
+        sMtxFLerp = MtxFSimd_LerpAvx;
+    }
+#endif
+}
+
+void MtxFSimd_Mult(const MtxF* mfA, const MtxF* mfB, MtxF* dest) {
+    sMtxFMult(mfA, mfB, dest);
+}
+
+void MtxFSimd_Lerp(MtxF* dest, const MtxF* o, const MtxF* n, f32 w, f32 step) {
+    sMtxFLerp(dest, o, n, w, step);
+}
+
+void MtxFSimd_Translate(MtxF* mf, f32 x, f32 y, f32 z) {
+#if defined(MTXF_SSE)
+    __m128 sum = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(mf->mf[0]), _mm_set1_ps(x)),
+                            _mm_mul_ps(_mm_loadu_ps(mf->mf[1]), _mm_set1_ps(y)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(mf->mf[2]), _mm_set1_ps(z)));
+    _mm_storeu_ps(mf->mf[3], _mm_add_ps(_mm_loadu_ps(mf->mf[3]), sum));
+#elif defined(MTXF_NEON)
+    float32x4_t sum = vaddq_f32(vmulq_n_f32(vld1q_f32(mf->mf[0]), x), vmulq_n_f32(vld1q_f32(mf->mf[1]), y));
+    sum = vaddq_f32(sum, vmulq_n_f32(vld1q_f32(mf->mf[2]), z));
+    vst1q_f32(mf->mf[3], vaddq_f32(vld1q_f32(mf->mf[3]), sum));
+#else
+    for (s32 i = 0; i < 4; i++) {
+        mf->mf[3][i] += mf->mf[0][i] * x + mf->mf[1][i] * y + mf->mf[2][i] * z;
+    }
+#endif
+}
+
+void MtxFSimd_MultVec3f(const MtxF* mf, const Vec3f* src, Vec3f* dest) {
+#if defined(MTXF_SSE)
+    __m128 sum = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(mf->mf[0]), _mm_set1_ps(src->x)),
+                            _mm_mul_ps(_mm_loadu_ps(mf->mf[1]), _mm_set1_ps(src->y)));
+    float res[4];
+
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(mf->mf[2]), _mm_set1_ps(src->z)));
+    _mm_storeu_ps(res, _mm_add_ps(_mm_loadu_ps(mf->mf[3]), sum));
+    dest->x = res[0];
+    dest->y = res[1];
+    dest->z = res[2];
+#elif defined(MTXF_NEON)
+    float32x4_t sum = vaddq_f32(vmulq_n_f32(vld1q_f32(mf->mf[0]), src->x), vmulq_n_f32(vld1q_f32(mf->mf[1]), src->y));
+
+    sum = vaddq_f32(vld1q_f32(mf->mf[3]), vaddq_f32(sum, vmulq_n_f32(vld1q_f32(mf->mf[2]), src->z)));
+    dest->x = vgetq_lane_f32(sum, 0);
+    dest->y = vgetq_lane_f32(sum, 1);
+    dest->z = vgetq_lane_f32(sum, 2);
+#else
+    f32 x = src->x;
+    f32 y = src->y;
+    f32 z = src->z;
+
+    dest->x = mf->xw + (mf->xx * x + mf->xy * y + mf->xz * z);
+    dest->y = mf->yw + (mf->yx * x + mf->yy * y + mf->yz * z);
+    dest->z = mf->zw + (mf->zx * x + mf->zy * y + mf->zz * z);
+#endif
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "include/z64math.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Vectorized versions of the MtxF operations the matrix stack and frame interpolation spend their time in.
+// They do the same multiplications and additions in the same order as the scalar code they replace, so the
+// results are bit for bit the same on every path. Unlike the scalar code, every input is read before dest is
+// written, so dest may alias any of the inputs.
+
+// Picks the versions the CPU supports. Called once from InitOTR, before the game thread starts.
+void MtxFSimd_Init(void);
+
+// dest = mfA * mfB, same as SkinMatrix_MtxFMtxFMult
+void MtxFSimd_Mult(const MtxF* mfA, const MtxF* mfB, MtxF* dest);
+
+// dest = o * w + n * step, per element
+void MtxFSimd_Lerp(MtxF* dest, const MtxF* o, const MtxF* n, f32 w, f32 step);
+
+// The MTXMODE_APPLY case of Matrix_Translate
+void MtxFSimd_Translate(MtxF* mf, f32 x, f32 y, f32 z);
+
+// dest = mf * [ src, 1 ], xyz components only, same as Matrix_MultVec3fExt
+void MtxFSimd_MultVec3f(const MtxF* mf, const Vec3f* src, Vec3f* dest);
+
+#ifdef __cplusplus
+}
+#endif
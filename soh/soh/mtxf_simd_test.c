@@ -0,0 +1,304 @@
+// MtxF accuracy test and benchmark.
+//
+// Checks every version of the MtxFSimd operations this build and CPU have
+// against the scalar code they replaced: SkinMatrix_MtxFMtxFMult, the
+// interpolate_mtxf lerp, Matrix_Translate and Matrix_MultVec3fExt. Inputs are
+// random matrices and vectors with mixed signs and exponents, and the multiply
+// is also run with dest aliasing each input. Any result further than
+// MTXF_TEST_MAX_ULPS from the scalar one fails the test. Then it reports the
+// median time per call of each version. Exits with 1 if any result was out of
+// bounds. Built as the soh-mtxf-simd-test target, it includes mtxf_simd.c to
+// get at the versions it picks between.
+
+#include "mtxf_simd.c"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// The vector versions do the same float operations in the same order as the scalar code, so they have to match it
+// exactly. The target is built without contracting multiplies and adds into FMAs, which would round differently.
+#define MTXF_TEST_MAX_ULPS 0
+
+#define TEST_RUNS 200000
+#define BENCH_MATRICES 1024
+#define BENCH_PASSES 200
+#define BENCH_RUNS 15
+
+typedef void (*MtxFTestMultFunc)(const MtxF* mfA, const MtxF* mfB, MtxF* dest);
+typedef void (*MtxFTestLerpFunc)(MtxF* dest, const MtxF* o, const MtxF* n, f32 w, f32 step);
+
+typedef struct {
+    const char* name;
+    MtxFTestMultFunc mult;
+    MtxFTestLerpFunc lerp;
+} MtxFTestImpl;
+
+static uint32_t sRandomState = 1;
+static uint32_t sMaxUlps;
+static bool sFailed;
+
+static uint32_t Random(void) {
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+    return sRandomState;
+}
+
+// Between 1/256 and 512 either way, with the odd exact zero and one
+static f32 RandomFloat(void) {
+    uint32_t bits;
+    f32 f;
+
+    switch (Random() % 16) {
+        case 0:
+            return 0.0f;
+        case 1:
+            return 1.0f;
+        default:
+            // Sign, exponent and mantissa
+            bits = ((Random() & 1) << 31) | ((uint32_t)(127 - 8 + Random() % 17) << 23) | (Random() & 0x7FFFFF);
+            memcpy(&f, &bits, sizeof(f));
+            return f;
+    }
+}
+
+static void RandomMtxF(MtxF* mf) {
+    for (s32 i = 0; i < 4; i++) {
+        for (s32 j = 0; j < 4; j++) {
+            mf->mf[i][j] = RandomFloat();
+        }
+    }
+}
+
+// Distance between two floats in units in the last place, counting across zero
+static uint32_t UlpDistance(f32 a, f32 b) {
+    int32_t ia;
+    int32_t ib;
+
+    memcpy(&ia, &a, sizeof(ia));
+    memcpy(&ib, &b, sizeof(ib));
+    if (ia < 0) {
+        ia = INT32_MIN - ia;
+    }
+    if (ib < 0) {
+        ib = INT32_MIN - ib;
+    }
+    return ia > ib ? (uint32_t)ia - (uint32_t)ib : (uint32_t)ib - (uint32_t)ia;
+}
+
+static void CheckFloats(const char* name, const char* func, s32 run, const f32* expected, const f32* actual,
+                        s32 count) {
+    for (s32 i = 0; i < count; i++) {
+        uint32_t ulps = UlpDistance(expected[i], actual[i]);
+
+        if (ulps > sMaxUlps) {
+            sMaxUlps = ulps;
+        }
+        if (ulps > MTXF_TEST_MAX_ULPS && !sFailed) {
+            printf("%s %s is %u ulps off on run %d at element %d: %.9g instead of %.9g\n", name, func, ulps, run, i,
+                   actual[i], expected[i]);
+            sFailed = true;
+        }
+    }
+}
+
+// SkinMatrix_MtxFMtxFMult as it was, one element of dest at a time
+static void ReferenceMult(const MtxF* mfA, const MtxF* mfB, MtxF* dest) {
+    MtxF res;
+
+    for (s32 row = 0; row < 4; row++) {
+        f32 rx = mfA->mf[0][row];
+        f32 ry = mfA->mf[1][row];
+        f32 rz = mfA->mf[2][row];
+        f32 rw = mfA->mf[3][row];
+
+        for (s32 col = 0; col < 4; col++) {
+            res.mf[col][row] = (rx * mfB->mf[col][0]) + (ry * mfB->mf[col][1]) + (rz * mfB->mf[col][2]) +
+                               (rw * mfB->mf[col][3]);
+        }
+    }
+    *dest = res;
+}
+
+// interpolate_mtxf as it was
+static void ReferenceLerp(MtxF* dest, const MtxF* o, const MtxF* n, f32 w, f32 step) {
+    for (s32 i = 0; i < 4; i++) {
+        for (s32 j = 0; j < 4; j++) {
+            dest->mf[i][j] = w * o->mf[i][j] + step * n->mf[i][j];
+        }
+    }
+}
+
+// The MTXMODE_APPLY case of Matrix_Translate as it was
+static void ReferenceTranslate(MtxF* mf, f32 x, f32 y, f32 z) {
+    mf->xw += mf->xx * x + mf->xy * y + mf->xz * z;
+    mf->yw += mf->yx * x + mf->yy * y + mf->yz * z;
+    mf->zw += mf->zx * x + mf->zy * y + mf->zz * z;
+    mf->ww += mf->wx * x + mf->wy * y + mf->wz * z;
+}
+
+// Matrix_MultVec3fExt as it was
+static void ReferenceMultVec3f(const MtxF* mf, const Vec3f* src, Vec3f* dest) {
+    dest->x = mf->xw + (mf->xx * src->x + mf->xy * src->y + mf->xz * src->z);
+    dest->y = mf->yw + (mf->yx * src->x + mf->yy * src->y + mf->yz * src->z);
+    dest->z = mf->zw + (mf->zx * src->x + mf->zy * src->y + mf->zz * src->z);
+}
+
+static void TestImpl(const MtxFTestImpl* impl) {
+    sRandomState = 1;
+    sMaxUlps = 0;
+
+    for (s32 run = 0; run < TEST_RUNS; run++) {
+        MtxF a;
+        MtxF b;
+        MtxF expected;
+        MtxF actual;
+        f32 w = (Random() & 0xFFFF) / 65536.0f;
+
+        RandomMtxF(&a);
+        RandomMtxF(&b);
+
+        ReferenceMult(&a, &b, &expected);
+        impl->mult(&a, &b, &actual);
+        CheckFloats(impl->name, "mult", run, &expected.xx, &actual.xx, 16);
+
+        actual = a;
+        impl->mult(&actual, &b, &actual);
+        CheckFloats(impl->name, "mult into mfA", run, &expected.xx, &actual.xx, 16);
+
+        actual = b;
+        impl->mult(&a, &actual, &actual);
+        CheckFloats(impl->name, "mult into mfB", run, &expected.xx, &actual.xx, 16);
+
+        ReferenceLerp(&expected, &a, &b, 1.0f - w, w);
+        impl->lerp(&actual, &a, &b, 1.0f - w, w);
+        CheckFloats(impl->name, "lerp", run, &expected.xx, &actual.xx, 16);
+    }
+
+    printf("%s: mult and lerp at most %u ulps off in %d runs\n", impl->name, sMaxUlps, TEST_RUNS);
+}
+
+// Translate and MultVec3f only have the version picked at compile time
+static void TestTransforms(void) {
+    sRandomState = 1;
+    sMaxUlps = 0;
+
+    for (s32 run = 0; run < TEST_RUNS; run++) {
+        MtxF expected;
+        MtxF actual;
+        Vec3f src = { RandomFloat(), RandomFloat(), RandomFloat() };
+        Vec3f expectedVec;
+        Vec3f actualVec;
+
+        RandomMtxF(&expected);
+        actual = expected;
+
+        ReferenceMultVec3f(&expected, &src, &expectedVec);
+        MtxFSimd_MultVec3f(&actual, &src, &actualVec);
+        CheckFloats("compiled in", "MultVec3f", run, &expectedVec.x, &actualVec.x, 3);
+
+        ReferenceTranslate(&expected, src.x, src.y, src.z);
+        MtxFSimd_Translate(&actual, src.x, src.y, src.z);
+        CheckFloats("compiled in", "Translate", run, &expected.xx, &actual.xx, 16);
+    }
+
+    printf("compiled in: Translate and MultVec3f at most %u ulps off in %d runs\n", sMaxUlps, TEST_RUNS);
+}
+
+static double Seconds(void) {
+    struct timespec ts;
+
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int CompareDoubles(const void* a, const void* b) {
+    double da = *(const double*)a;
+    double db = *(const double*)b;
+
+    return (da > db) - (da < db);
+}
+
+static double Median(double* times, s32 count) {
+    qsort(times, count, sizeof(double), CompareDoubles);
+    return times[count / 2];
+}
+
+static void Bench(const char* name, MtxFTestMultFunc mult, MtxFTestLerpFunc lerp) {
+    static MtxF in[BENCH_MATRICES];
+    static MtxF out[BENCH_MATRICES];
+    double multTimes[BENCH_RUNS];
+    double lerpTimes[BENCH_RUNS];
+    f32 sink = 0.0f;
+
+    sRandomState = 1;
+    for (s32 i = 0; i < BENCH_MATRICES; i++) {
+        RandomMtxF(&in[i]);
+    }
+
+    for (s32 run = 0; run < BENCH_RUNS; run++) {
+        double start = Seconds();
+        for (s32 pass = 0; pass < BENCH_PASSES; pass++) {
+            for (s32 i = 0; i < BENCH_MATRICES; i++) {
+                mult(&in[i], &in[(i + 1) % BENCH_MATRICES], &out[i]);
+            }
+            sink += out[pass % BENCH_MATRICES].xx;
+        }
+        double multiplied = Seconds();
+        for (s32 pass = 0; pass < BENCH_PASSES; pass++) {
+            for (s32 i = 0; i < BENCH_MATRICES; i++) {
+                lerp(&out[i], &in[i], &in[(i + 1) % BENCH_MATRICES], 0.25f, 0.75f);
+            }
+            sink += out[pass % BENCH_MATRICES].xx;
+        }
+        double lerped = Seconds();
+
+        multTimes[run] = (multiplied - start) * 1e9 / (BENCH_PASSES * BENCH_MATRICES);
+        lerpTimes[run] = (lerped - multiplied) * 1e9 / (BENCH_PASSES * BENCH_MATRICES);
+    }
+
+    // Keeps the calls from being optimized out
+    if (sink == 12345.0f) {
+        printf(" ");
+    }
+    printf("%-6s mult %6.2f ns, lerp %6.2f ns\n", name, Median(multTimes, BENCH_RUNS), Median(lerpTimes, BENCH_RUNS));
+}
+
+int main(void) {
+    MtxFTestImpl impls[5];
+    s32 numImpls = 0;
+
+    // The game calls this at startup, MtxFSimd_Mult and MtxFSimd_Lerp then use whatever it picked
+    MtxFSimd_Init();
+
+    impls[numImpls++] = (MtxFTestImpl){ "scalar", MtxFSimd_MultScalar, MtxFSimd_LerpScalar };
+#ifdef MTXF_SSE
+    impls[numImpls++] = (MtxFTestImpl){ "SSE", MtxFSimd_MultSse, MtxFSimd_LerpSse };
+#endif
+#ifdef MTXF_AVX
+    if (MtxFSimd_HasAvx()) {
+        impls[numImpls++] = (MtxFTestImpl){ "AVX", MtxFSimd_MultAvx, MtxFSimd_LerpAvx };
+    } else {
+        printf("AVX: not supported by this CPU, skipped\n");
+    }
+#endif
+#ifdef MTXF_NEON
+    impls[numImpls++] = (MtxFTestImpl){ "NEON", MtxFSimd_MultNeon, MtxFSimd_LerpNeon };
+#endif
+    impls[numImpls++] = (MtxFTestImpl){ "picked", MtxFSimd_Mult, MtxFSimd_Lerp };
+
+    for (s32 i = 0; i < numImpls; i++) {
+        TestImpl(&impls[i]);
+    }
+    TestTransforms();
+
+    Bench("ref", ReferenceMult, ReferenceLerp);
+    for (s32 i = 0; i < numImpls; i++) {
+        Bench(impls[i].name, impls[i].mult, impls[i].lerp);
+    }
+
+    return sFailed ? 1 : 0;
+}
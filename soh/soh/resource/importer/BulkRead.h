@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "ResourceFactoryBinary.h"
+
+namespace SOH {
+// Plain shifts on unsigned values, compilers turn these loops into vector shuffles
+inline void ByteSwapValues(uint16_t* values, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        values[i] = (uint16_t)((values[i] >> 8) | (values[i] << 8));
+    }
+}
+
+inline void ByteSwapValues(uint32_t* values, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint32_t v = values[i];
+        values[i] = (v >> 24) | ((v >> 8) & 0xFF00) | ((v << 8) & 0xFF0000) | (v << 24);
+    }
+}
+
+// Reads count integers with a single Read instead of one call per value, then swaps their bytes in one pass when the
+// file's endianness isn't the native one
+template <typename T> void ReadBulk(const std::shared_ptr<Ship::BinaryReader>& reader, T* values, size_t count) {
+    static_assert(std::is_integral_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4));
+
+    reader->Read(reinterpret_cast<char*>(values), (int32_t)(count * sizeof(T)));
+    if constexpr (sizeof(T) > 1) {
+        if (reader->GetEndianness() != Ship::Endianness::Native) {
+            using Unsigned = std::make_unsigned_t<T>;
+            ByteSwapValues(reinterpret_cast<Unsigned*>(values), count);
+        }
+    }
+}
+
+template <typename T>
+void ReadBulk(const std::shared_ptr<Ship::BinaryReader>& reader, std::vector<T>& values, size_t count) {
+    values.resize(count);
+    ReadBulk(reader, values.data(), count);
+}
+} // namespace SOH
@@ -1,6 +1,8 @@
 #include "soh/resource/importer/CollisionHeaderFactory.h"
 #include "soh/resource/type/CollisionHeader.h"
+#include "soh/resource/importer/BulkRead.h"
 #include "spdlog/spdlog.h"
+#include <algorithm>
 
 namespace SOH {
 std::shared_ptr<Ship::IResource> ResourceFactoryBinaryCollisionHeaderV0::ReadResource(std::shared_ptr<Ship::File> file) {
@@ -19,37 +21,18 @@ std::shared_ptr<Ship::IResource> ResourceFactoryBinaryCollisionHeaderV0::ReadRes
     collisionHeader->collisionHeaderData.maxBounds.y = reader->ReadInt16();
     collisionHeader->collisionHeaderData.maxBounds.z = reader->ReadInt16();
 
+    // Vertices and polygons are stored as the same run of 16 bit values as the structs in memory
+    static_assert(sizeof(Vec3s) == 3 * sizeof(int16_t));
+    static_assert(sizeof(CollisionPoly) == 8 * sizeof(uint16_t));
+
     collisionHeader->collisionHeaderData.numVertices = reader->ReadInt32();
-    collisionHeader->vertices.reserve(collisionHeader->collisionHeaderData.numVertices);
-    for (int32_t i = 0; i < collisionHeader->collisionHeaderData.numVertices; i++) {
-        Vec3s vtx;
-        vtx.x = reader->ReadInt16();
-        vtx.y = reader->ReadInt16();
-        vtx.z = reader->ReadInt16();
-        collisionHeader->vertices.push_back(vtx);
-    }
+    collisionHeader->vertices.resize(collisionHeader->collisionHeaderData.numVertices);
+    ReadBulk(reader, (int16_t*)collisionHeader->vertices.data(), collisionHeader->vertices.size() * 3);
     collisionHeader->collisionHeaderData.vtxList = collisionHeader->vertices.data();
 
     collisionHeader->collisionHeaderData.numPolygons = reader->ReadUInt32();
-    collisionHeader->polygons.reserve(collisionHeader->collisionHeaderData.numPolygons);
-    for (uint32_t i = 0; i < collisionHeader->collisionHeaderData.numPolygons; i++) {
-        CollisionPoly polygon;
-
-        polygon.type = reader->ReadUInt16();
-        
-        polygon.flags_vIA = reader->ReadUInt16();
-        polygon.flags_vIB = reader->ReadUInt16();
-        polygon.vIC = reader->ReadUInt16();
-
-        polygon.normal.x = reader->ReadUInt16();
-        polygon.normal.y = reader->ReadUInt16();
-        polygon.normal.z = reader->ReadUInt16();
-
-        polygon.dist = reader->ReadUInt16();
-
-        collisionHeader->polygons.push_back(polygon);
-        
-    }
+    collisionHeader->polygons.resize(collisionHeader->collisionHeaderData.numPolygons);
+    ReadBulk(reader, (uint16_t*)collisionHeader->polygons.data(), collisionHeader->polygons.size() * 8);
     collisionHeader->collisionHeaderData.polyList = collisionHeader->polygons.data();
 
     collisionHeader->surfaceTypesCount = reader->ReadUInt32();
@@ -78,14 +61,8 @@ std::shared_ptr<Ship::IResource> ResourceFactoryBinaryCollisionHeaderV0::ReadRes
     }
 
     collisionHeader->camPosCount = reader->ReadInt32();
-    collisionHeader->camPosData.reserve(collisionHeader->camPosCount);
-    for (int32_t i = 0; i < collisionHeader->camPosCount; i++) {
-        Vec3s pos;
-        pos.x = reader->ReadInt16();
-        pos.y = reader->ReadInt16();
-        pos.z = reader->ReadInt16();
-        collisionHeader->camPosData.push_back(pos);
-    }
+    collisionHeader->camPosData.resize(std::max(collisionHeader->camPosCount, 0));
+    ReadBulk(reader, (int16_t*)collisionHeader->camPosData.data(), collisionHeader->camPosData.size() * 3);
 
     Vec3s zero;
     zero.x = 0;
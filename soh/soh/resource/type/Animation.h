@@ -14,6 +14,7 @@ enum class AnimationType {
 struct RotationIndex {
     uint16_t x, y, z;
 
+    RotationIndex() = default;
     RotationIndex(uint16_t nX, uint16_t nY, uint16_t nZ) : x(nX), y(nY), z(nZ) {
     }
 };
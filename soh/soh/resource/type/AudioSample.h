@@ -49,6 +49,8 @@ namespace SOH {
             size_t GetPointerSize();
 
             Sample sample;
+            // sample.sampleAddr points into fileBuffer, or into audioSampleData when the bytes had to be copied
+            std::shared_ptr<std::vector<char>> fileBuffer;
             std::vector<uint8_t> audioSampleData;
 
             AdpcmLoop loop;
@@ -0,0 +1,148 @@
+// SaveQueue test.
+//
+// Queues section saves the way SaveSection does, with snapshots of a small
+// stand-in for the save context, and checks which writes come out of the queue
+// and with what in them: an autosave followed by a section save before the
+// autosave is written has to keep the autosave's snapshot, a burst of the same
+// save has to merge into one write of the latest state, and a full save merges
+// with a waiting section save only when it saves that section too. Exits with
+// 1 on the first mismatch. Built as the soh-save-queue-test target, it only
+// depends on SaveQueue.
+
+#include "SaveQueue.h"
+
+#include <cstdio>
+
+namespace {
+enum {
+    kSectionBase,
+    // Saved with base, like the randomizer section
+    kSectionRandomizer,
+    // Not saved with base, like a mod's own section
+    kSectionMod,
+};
+
+struct TestSaveContext {
+    int bButtonItem;
+    int rupees;
+};
+
+SaveQueue<TestSaveContext> MakeQueue() {
+    return SaveQueue<TestSaveContext>(kSectionBase, [](int sectionID) { return sectionID != kSectionMod; });
+}
+
+bool Check(bool condition, const char* test, const char* what) {
+    if (!condition) {
+        printf("%s: %s\n", test, what);
+    }
+    return condition;
+}
+
+bool CheckWrite(const SaveQueue<TestSaveContext>::Write& write, const char* test, int sectionID, int bButtonItem,
+                int rupees, size_t requests) {
+    if (write.sectionID != sectionID || write.snapshot->bButtonItem != bButtonItem ||
+        write.snapshot->rupees != rupees || write.requests != requests) {
+        printf("%s: wrote section %d with B item %d and %d rupees for %zu requests instead of section %d with B item %d "
+               "and %d rupees for %zu requests\n",
+               test, write.sectionID, write.snapshot->bButtonItem, write.snapshot->rupees, write.requests, sectionID,
+               bButtonItem, rupees, requests);
+        return false;
+    }
+    return true;
+}
+
+// Play_PerformSave saves with the sword on B and puts the temporary item back right after, then picking something up
+// saves the randomizer section for the check tracker. The autosave still has to be written with the sword on B.
+bool TestAutosaveThenSectionSave() {
+    const char* test = "autosave then section save";
+    SaveQueue<TestSaveContext> queue = MakeQueue();
+    TestSaveContext saveContext = { 1, 50 };
+
+    bool newWrite = queue.Push(0, kSectionBase, saveContext, false);
+    saveContext = { 2, 55 };
+    bool sectionNewWrite = queue.Push(0, kSectionRandomizer, saveContext, false);
+    if (!Check(newWrite && sectionNewWrite, test, "the section save didn't get a write of its own") ||
+        !Check(queue.GetDepth() == 2, test, "there aren't two writes waiting")) {
+        return false;
+    }
+    SaveQueue<TestSaveContext>::Write autosave = queue.Pop(0);
+    SaveQueue<TestSaveContext>::Write sectionSave = queue.Pop(0);
+    return CheckWrite(autosave, test, kSectionBase, 1, 50, 1) &&
+           CheckWrite(sectionSave, test, kSectionRandomizer, 2, 55, 1) &&
+           Check(queue.GetDepth() == 0, test, "writes are left waiting");
+}
+
+bool TestBurstMerges() {
+    const char* test = "burst of section saves";
+    SaveQueue<TestSaveContext> queue = MakeQueue();
+
+    if (!Check(queue.Push(0, kSectionRandomizer, { 1, 10 }, false), test, "the first save wasn't queued") ||
+        !Check(!queue.Push(0, kSectionRandomizer, { 1, 20 }, false), test, "the second save wasn't merged") ||
+        !Check(!queue.Push(0, kSectionRandomizer, { 1, 30 }, true), test, "the third save wasn't merged")) {
+        return false;
+    }
+    SaveQueue<TestSaveContext>::Write write = queue.Pop(0);
+    return CheckWrite(write, test, kSectionRandomizer, 1, 30, 3) && Check(write.compact, test, "isn't compact");
+}
+
+bool TestFullSaveMergesSavedWithBase() {
+    const char* test = "full save after a section save";
+    SaveQueue<TestSaveContext> queue = MakeQueue();
+
+    queue.Push(0, kSectionRandomizer, { 1, 10 }, false);
+    if (!Check(!queue.Push(0, kSectionBase, { 1, 20 }, false), test, "the full save wasn't merged")) {
+        return false;
+    }
+    return CheckWrite(queue.Pop(0), test, kSectionBase, 1, 20, 2);
+}
+
+bool TestFullSaveKeepsOtherSections() {
+    const char* test = "full save after a section not saved with base";
+    SaveQueue<TestSaveContext> queue = MakeQueue();
+
+    queue.Push(0, kSectionMod, { 1, 10 }, false);
+    if (!Check(queue.Push(0, kSectionBase, { 1, 20 }, false), test, "the full save was merged")) {
+        return false;
+    }
+    SaveQueue<TestSaveContext>::Write sectionSave = queue.Pop(0);
+    SaveQueue<TestSaveContext>::Write fullSave = queue.Pop(0);
+    return CheckWrite(sectionSave, test, kSectionMod, 1, 10, 1) && CheckWrite(fullSave, test, kSectionBase, 1, 20, 1);
+}
+
+bool TestFilesAreSeparate() {
+    const char* test = "saves to different files";
+    SaveQueue<TestSaveContext> queue = MakeQueue();
+
+    queue.Push(0, kSectionBase, { 1, 10 }, false);
+    if (!Check(queue.Push(1, kSectionBase, { 2, 20 }, false), test, "the second file's save was merged")) {
+        return false;
+    }
+    SaveQueue<TestSaveContext>::Write second = queue.Pop(1);
+    SaveQueue<TestSaveContext>::Write first = queue.Pop(0);
+    return CheckWrite(first, test, kSectionBase, 1, 10, 1) && CheckWrite(second, test, kSectionBase, 2, 20, 1);
+}
+
+bool TestSnapshotsAreReused() {
+    const char* test = "snapshot reuse";
+    SaveQueue<TestSaveContext> queue = MakeQueue();
+
+    queue.Push(0, kSectionBase, { 1, 10 }, false);
+    SaveQueue<TestSaveContext>::Write write = queue.Pop(0);
+    TestSaveContext* snapshot = write.snapshot.get();
+    queue.ReleaseSnapshot(std::move(write.snapshot));
+    queue.Push(0, kSectionBase, { 2, 20 }, false);
+    write = queue.Pop(0);
+    return CheckWrite(write, test, kSectionBase, 2, 20, 1) &&
+           Check(write.snapshot.get() == snapshot, test, "the released snapshot wasn't reused");
+}
+} // namespace
+
+int main() {
+    if (!TestAutosaveThenSectionSave() || !TestBurstMerges() || !TestFullSaveMergesSavedWithBase() ||
+        !TestFullSaveKeepsOtherSections() || !TestFilesAreSeparate() || !TestSnapshotsAreReused()) {
+        return 1;
+    }
+
+    printf("Queued saves keep their snapshots until they're written\n");
+    return 0;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+// For globals that worker threads each need their own copy of, like the matrix stack frame interpolation replays on
+// and the DMEM audio commands run in. The consoles run that work on a single thread and keep them plain globals, with
+// SOH_HAS_THREAD_LOCAL set to 0 so the code that would spread it over threads doesn't.
+#if defined(__WIIU__) || defined(__SWITCH__)
+#define SOH_THREAD_LOCAL
+#define SOH_HAS_THREAD_LOCAL 0
+#elif defined(__cplusplus)
+#define SOH_THREAD_LOCAL thread_local
+#define SOH_HAS_THREAD_LOCAL 1
+#elif defined(_MSC_VER)
+#define SOH_THREAD_LOCAL __declspec(thread)
+#define SOH_HAS_THREAD_LOCAL 1
+#else
+#define SOH_THREAD_LOCAL _Thread_local
+#define SOH_HAS_THREAD_LOCAL 1
+#endif
@@ -6,6 +6,7 @@
 #include "vt.h"
 #include "soh/resource/type/Text.h"
 #include <message_data_static.h>
+#include <unordered_map>
 #include "Enhancements/custom-message/CustomMessageManager.h"
 #include "Enhancements/custom-message/CustomMessageTypes.h"
 
@@ -22,21 +23,66 @@ static void SetMessageEntry(MessageTableEntry& entry, const SOH::MessageEntry& m
     entry.msgSize = msgEntry.msg.size();
 }
 
+// Where each text ID sits in a message table, so finding a message doesn't walk the whole table
+struct MessageTableIndex {
+    std::unordered_map<u16, size_t> entries;
+    // Searches stop at the first 0xFFFF entry, anything past it is only there to be overridden
+    size_t end;
+};
+
+static std::unordered_map<const MessageTableEntry*, MessageTableIndex> sMessageTableIndices;
+
+static MessageTableIndex& OTRMessage_IndexTable(const MessageTableEntry* table, size_t tableSize) {
+    MessageTableIndex& index = sMessageTableIndices[table];
+
+    index.entries.clear();
+    index.entries.reserve(tableSize);
+    index.end = tableSize;
+    for (size_t i = 0; i < tableSize; i++) {
+        // Keeps the first entry for an ID, the same one a search from the start of the table finds
+        index.entries.emplace(table[i].textId, i);
+
+        if (table[i].textId == 0xFFFF && index.end == tableSize) {
+            index.end = i;
+        }
+    }
+    return index;
+}
+
+extern "C" MessageTableEntry* OTRMessage_FindEntry(MessageTableEntry* table, u16 textId) {
+    auto index = sMessageTableIndices.find(table);
+
+    if (index == sMessageTableIndices.end()) {
+        for (MessageTableEntry* entry = table; entry->textId != 0xFFFF; entry++) {
+            if (entry->textId == textId) {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    auto entry = index->second.entries.find(textId);
+    if (entry == index->second.entries.end() || entry->second >= index->second.end) {
+        return nullptr;
+    }
+    return &table[entry->second];
+}
+
 static void OTRMessage_LoadCustom(const std::string& folderPath, MessageTableEntry*& table, size_t tableSize) {
     auto lst = *Ship::Context::GetInstance()->GetResourceManager()->GetArchiveManager()->ListFiles(folderPath).get();
+    // Overrides only replace messages, so the text IDs stay where they are while they're loaded
+    MessageTableIndex& index = OTRMessage_IndexTable(table, tableSize);
 
     for (auto& tPath : lst) {
         auto file = std::static_pointer_cast<SOH::Text>(Ship::Context::GetInstance()->GetResourceManager()->LoadResource(tPath));
 
         for (size_t j = 0; j < file->messages.size(); ++j) {
             // Check if same text ID exists already
-            auto existingEntry = std::find_if(table, table + tableSize, [id = file->messages[j].id](const auto& entry) {
-                return entry.textId == id;
-            });
+            auto existingEntry = index.entries.find(file->messages[j].id);
 
-            if (existingEntry != table + tableSize) {
+            if (existingEntry != index.entries.end()) {
                 // Replace existing message
-                SetMessageEntry(*existingEntry, file->messages[j]);
+                SetMessageEntry(table[existingEntry->second], file->messages[j]);
             }
         }
     }
@@ -11,14 +11,30 @@ extern "C" void Play_InitScene(PlayState * play, s32 spawn);
 extern "C" void Play_InitEnvironment(PlayState * play, s16 skyboxId);
 void OTRPlay_InitScene(PlayState* play, s32 spawn);
 s32 OTRScene_ExecuteCommands(PlayState* play, SOH::Scene* scene);
+std::shared_ptr<Ship::IResource> LoadResourceAfterPreload(const std::string& path);
 
 //LUS::OTRResource* OTRPlay_LoadFile(PlayState* play, RomFile* file) {
 Ship::IResource* OTRPlay_LoadFile(PlayState* play, const char* fileName)
 {
-    auto res = Ship::Context::GetInstance()->GetResourceManager()->LoadResource(fileName);
+    auto res = LoadResourceAfterPreload(fileName);
     return res.get();
 }
 
+// Directory holding the scene file and its rooms, the scene file itself is named after the directory
+std::string OTRPlay_GetSceneDirectory(s32 sceneNum) {
+    SceneTableEntry* scene = &gSceneTable[sceneNum];
+
+    // Scenes considered "dungeon" with a MQ variant
+    int16_t inNonSharedScene = (sceneNum >= SCENE_DEKU_TREE && sceneNum <= SCENE_ICE_CAVERN) ||
+                               sceneNum == SCENE_GERUDO_TRAINING_GROUND || sceneNum == SCENE_INSIDE_GANONS_CASTLE;
+
+    std::string sceneVersion = "shared";
+    if (inNonSharedScene) {
+        sceneVersion = IsSceneMasterQuest(sceneNum) ? "mq" : "nonmq";
+    }
+    return StringHelper::Sprintf("scenes/%s/%s/", sceneVersion.c_str(), scene->sceneFile.fileName);
+}
+
 extern "C" void OTRPlay_SpawnScene(PlayState* play, s32 sceneNum, s32 spawn) {
     SceneTableEntry* scene = &gSceneTable[sceneNum];
 
@@ -29,15 +45,8 @@ extern "C" void OTRPlay_SpawnScene(PlayState* play, s32 sceneNum, s32 spawn) {
 
     //osSyncPrintf("\nSCENE SIZE %fK\n", (scene->sceneFile.vromEnd - scene->sceneFile.vromStart) / 1024.0f);
 
-    // Scenes considered "dungeon" with a MQ variant
-    int16_t inNonSharedScene = (sceneNum >= SCENE_DEKU_TREE && sceneNum <= SCENE_ICE_CAVERN) ||
-                               sceneNum == SCENE_GERUDO_TRAINING_GROUND || sceneNum == SCENE_INSIDE_GANONS_CASTLE;
-
-    std::string sceneVersion = "shared";
-    if (inNonSharedScene) {
-        sceneVersion = IsGameMasterQuest() ? "mq" : "nonmq";
-    }
-    std::string scenePath = StringHelper::Sprintf("scenes/%s/%s/%s", sceneVersion.c_str(), scene->sceneFile.fileName, scene->sceneFile.fileName);
+    std::string sceneDirectory = OTRPlay_GetSceneDirectory(sceneNum);
+    std::string scenePath = sceneDirectory + scene->sceneFile.fileName;
 
     play->sceneSegment = OTRPlay_LoadFile(play, scenePath.c_str());
 
@@ -33,6 +33,7 @@
 #include "soh/resource/type/scenecommand/SetSoundSettings.h"
 #include "soh/resource/type/scenecommand/SetEchoSettings.h"
 #include "soh/resource/type/scenecommand/SetAlternateHeaders.h"
+#include "soh/ResourcePreloader.h"
 
 extern Ship::IResource* OTRPlay_LoadFile(PlayState* play, const char* fileName);
 extern "C" s32 Object_Spawn(ObjectContext* objectCtx, s16 objectId);
@@ -41,6 +42,7 @@ s32 OTRScene_ExecuteCommands(PlayState* play, SOH::Scene* scene);
 
 // Forward Declaration of function declared in OTRGlobals.cpp
 std::shared_ptr<Ship::IResource> GetResourceByNameHandlingMQ(const char* path);
+std::string GetPathHandlingMQ(const char* path);
 
 bool Scene_CommandSpawnList(PlayState* play, SOH::ISceneCommand* cmd) {
     // SOH::SetStartPositionList* cmdStartPos = std::static_pointer_cast<SOH::SetStartPositionList>(cmd);
@@ -138,8 +140,16 @@ bool Scene_CommandMeshHeader(PlayState* play, SOH::ISceneCommand* cmd) {
 
 extern "C" void* func_800982FC(ObjectContext* objectCtx, s32 bankIndex, s16 objectId);
 
+// The scene prefetcher may be loading the object's files in the background. Loads through the bridges wait on them
+// by themselves, but actors also draw an object's display lists straight from their paths, so an object entering the
+// bank waits for all of it.
+extern "C" void OTRScene_WaitForObject(s16 objectId) {
+    ResourcePreloader::Instance->WaitForDirectory(StringHelper::Sprintf("objects/%s/", gObjectTable[objectId].fileName));
+}
+
 bool OTRfunc_800982FC(ObjectContext* objectCtx, s32 bankIndex, s16 objectId) {
 
+    OTRScene_WaitForObject(objectId);
     objectCtx->status[bankIndex].id = -objectId;
 
     return false;
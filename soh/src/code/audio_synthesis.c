@@ -16,6 +16,8 @@
 #define DMEM_WET_SCRATCH 0x720 // = DMEM_WET_TEMP + DEFAULT_LEN_2CH
 #define DMEM_WET_LEFT_CH 0xC80
 #define DMEM_WET_RIGHT_CH 0xE20 // = DMEM_WET_LEFT_CH + DEFAULT_LEN_1CH
+// Everything a note adds to the mix, from DMEM_LEFT_CH through the end of DMEM_WET_RIGHT_CH
+#define NOTE_OUTPUT_SIZE (DMEM_WET_RIGHT_CH + DEFAULT_LEN_1CH - DMEM_LEFT_CH)
 
 Acmd* AudioSynth_LoadRingBufferPart(Acmd* cmd, u16 dmem, u16 startPos, s32 length, SynthesisReverb* reverb);
 Acmd* AudioSynth_SaveBufferOffset(Acmd* cmd, u16 dmem, u16 offset, s32 length, s16* buf);
@@ -42,6 +44,36 @@ u16 D_801304B0[] = {
 
 u8 D_801304C0[] = { 0x40, 0x20, 0x10, 0x8 };
 
+// The ADPCM book in this thread's DMEM. Notes can be synthesized on several threads, each with its own DMEM, so this
+// takes the place of gAudioContext.curLoadedBook.
+static SOH_THREAD_LOCAL s16* sCurLoadedBook;
+
+// What a note synthesized on its own adds to the mix, see AudioSynth_MixNoteOutput
+typedef struct {
+    s16 samples[NOTE_OUTPUT_SIZE / sizeof(s16)];
+    // The headset pan effect, added to panDest after the rest, see AudioSynth_NoteApplyHeadsetPanEffects
+    s16 panSamples[ALIGN64(DEFAULT_LEN_1CH) / sizeof(s16)];
+    u16 panDest;
+    u16 panSize;
+    // How much of the start of DMEM_LEFT_CH the note wrote over, see AudioSynth_LoadWaveSamples
+    u16 mixOverwriteSize;
+} NoteOutput;
+
+// Where the note this thread is synthesizing on its own keeps what it can't leave in DMEM, NULL while notes are
+// processed straight into the mix
+static SOH_THREAD_LOCAL NoteOutput* sNoteOutput;
+
+// Notes of the current update for multithreaded synthesis, see AudioSynth_SynthesizeNotes
+static struct {
+    u8 noteIndices[0x5C];
+    u8 parallelJobs[0x5C];
+    s16* aiBuf;
+    s32 aiBufLen;
+    Acmd* cmd;
+    s32 updateIndex;
+    NoteOutput outputs[0x5C];
+} sNoteSynthesis;
+
 void AudioSynth_InitNextRingBuf(s32 chunkLen, s32 bufIndex, s32 reverbIndex) {
     ReverbRingBufferItem* bufItem;
     s32 pad[3];
@@ -146,7 +178,7 @@ Acmd* AudioSynth_Update(Acmd* cmdStart, s32* cmdCnt, s16* aiStart, s32 aiBufLen)
     }
 
     aiBufP = aiStart;
-    gAudioContext.curLoadedBook = NULL;
+    sCurLoadedBook = NULL;
     for (i = gAudioContext.audioBufferParameters.updatesPerFrame; i > 0; i--) {
         if (i == 1) {
             chunkLen = aiBufLen;
@@ -549,8 +581,90 @@ Acmd* AudioSynth_SaveRingBuffer2(Acmd* cmd, SynthesisReverb* reverb, s16 bufInde
     return cmd;
 }
 
+// Synthetic waves with a book offset advance gWaveSamples[8] and samples outside of RAM go through the sample DMA
+// buffers, both shared between all notes
+s32 AudioSynth_NoteUsesSharedState(NoteSubEu* noteSubEu) {
+    s32 medium;
+
+    if (noteSubEu->bitField1.isSyntheticWave) {
+        return noteSubEu->bitField1.bookOffset != 0;
+    }
+    medium = noteSubEu->sound.soundFontSound->sample->medium;
+    return medium != MEDIUM_RAM && medium != MEDIUM_UNK;
+}
+
+void AudioSynth_SynthesizeNote(s32 index) {
+    s32 noteIndex = sNoteSynthesis.noteIndices[index];
+    s32 t = gAudioContext.numNotes * sNoteSynthesis.updateIndex;
+
+    // Notes read a few samples past what they loaded at the ends of their buffers. Clearing what the worker's last note
+    // left there, along with the output, keeps a note's output the same whichever notes the worker synthesized before.
+    aClearBuffer(sNoteSynthesis.cmd, DMEM_TEMP, DMEM_LEFT_CH + NOTE_OUTPUT_SIZE - DMEM_TEMP);
+    sCurLoadedBook = NULL;
+    sNoteOutput = &sNoteSynthesis.outputs[index];
+    sNoteOutput->panSize = 0;
+    sNoteOutput->mixOverwriteSize = 0;
+    AudioSynth_ProcessNote(noteIndex, &gAudioContext.noteSubsEu[t + noteIndex],
+                           &gAudioContext.notes[noteIndex].synthesisState, sNoteSynthesis.aiBuf,
+                           sNoteSynthesis.aiBufLen, sNoteSynthesis.cmd, sNoteSynthesis.updateIndex);
+    aSaveBuffer(sNoteSynthesis.cmd, DMEM_LEFT_CH, sNoteOutput->samples, NOTE_OUTPUT_SIZE);
+    sNoteOutput = NULL;
+}
+
+void AudioSynth_SynthesizeParallelNote(s32 job) {
+    AudioSynth_SynthesizeNote(sNoteSynthesis.parallelJobs[job]);
+}
+
+// Synthesizes every note of the update on its own into sNoteSynthesis.outputs, spread over the synthesis workers.
+// AudioSynth_MixNoteOutput then adds them into the mix in the order AudioSynth_ProcessNote would have, so the result
+// doesn't depend on which thread synthesized what. A note adds to every sample of its output once, its headset pan
+// effect is kept separate for that, so adding the output clamps the mix just like processing the note into it does.
+void AudioSynth_SynthesizeNotes(u8* noteIndices, s32 count, s16* aiBuf, s32 aiBufLen, Acmd* cmd, s32 updateIndex) {
+    s32 numParallelJobs = 0;
+    s32 i;
+
+    memcpy(sNoteSynthesis.noteIndices, noteIndices, count);
+    sNoteSynthesis.aiBuf = aiBuf;
+    sNoteSynthesis.aiBufLen = aiBufLen;
+    sNoteSynthesis.cmd = cmd;
+    sNoteSynthesis.updateIndex = updateIndex;
+
+    // Notes using shared state are synthesized here first, in the same order as always
+    for (i = 0; i < count; i++) {
+        if (AudioSynth_NoteUsesSharedState(&gAudioContext.noteSubsEu[gAudioContext.numNotes * updateIndex +
+                                                                     noteIndices[i]])) {
+            AudioSynth_SynthesizeNote(i);
+        } else {
+            sNoteSynthesis.parallelJobs[numParallelJobs++] = i;
+        }
+    }
+    OTRAudio_ParallelFor(numParallelJobs, AudioSynth_SynthesizeParallelNote);
+
+    // Whichever notes this thread got left their outputs behind, parts of the wet channels aren't always overwritten
+    aClearBuffer(cmd, DMEM_LEFT_CH, NOTE_OUTPUT_SIZE);
+}
+
+Acmd* AudioSynth_MixNoteOutput(Acmd* cmd, s32 index) {
+    NoteOutput* output = &sNoteSynthesis.outputs[index];
+
+    aLoadBuffer(cmd++, output->samples, DMEM_TEMP, DEFAULT_LEN_2CH);
+    aAddMixer(cmd++, DEFAULT_LEN_2CH, DMEM_TEMP, DMEM_LEFT_CH);
+    if (output->mixOverwriteSize != 0) {
+        // The note's samples replaced the start of the mix, notes before it included, before the note was added
+        aLoadBuffer(cmd++, output->samples, DMEM_LEFT_CH, output->mixOverwriteSize);
+    }
+    aLoadBuffer(cmd++, output->samples + DEFAULT_LEN_2CH / sizeof(s16), DMEM_TEMP, DEFAULT_LEN_2CH);
+    aAddMixer(cmd++, DEFAULT_LEN_2CH, DMEM_TEMP, DMEM_WET_LEFT_CH);
+    if (output->panSize != 0) {
+        aLoadBuffer(cmd++, output->panSamples, DMEM_TEMP, output->panSize);
+        aAddMixer(cmd++, output->panSize, DMEM_TEMP, output->panDest);
+    }
+    return cmd;
+}
+
 Acmd* AudioSynth_DoOneAudioUpdate(s16* aiBuf, s32 aiBufLen, Acmd* cmd, s32 updateIndex) {
     u8 noteIndices[0x5C];
+    s32 notesSynthesized = false;
     s16 count;
     s16 reverbIndex;
     SynthesisReverb* reverb;
@@ -590,6 +704,11 @@ Acmd* AudioSynth_DoOneAudioUpdate(s16* aiBuf, s32 aiBufLen, Acmd* cmd, s32 updat
         }
     }
 
+    if (CVarGetInteger(CVAR_SETTING("MultithreadedAudioSynthesis"), 0)) {
+        AudioSynth_SynthesizeNotes(noteIndices, count, aiBuf, aiBufLen, cmd, updateIndex);
+        notesSynthesized = true;
+    }
+
     aClearBuffer(cmd++, DMEM_LEFT_CH, DEFAULT_LEN_2CH);
     i = 0;
     for (reverbIndex = 0; reverbIndex < gAudioContext.numSynthesisReverbs; reverbIndex++) {
@@ -621,9 +740,13 @@ Acmd* AudioSynth_DoOneAudioUpdate(s16* aiBuf, s32 aiBufLen, Acmd* cmd, s32 updat
         while (i < count) {
             noteSubEu2 = &gAudioContext.noteSubsEu[noteIndices[i] + t];
             if (noteSubEu2->bitField1.reverbIndex == reverbIndex) {
-                cmd = AudioSynth_ProcessNote(noteIndices[i], noteSubEu2,
-                                             &gAudioContext.notes[noteIndices[i]].synthesisState, aiBuf, aiBufLen, cmd,
-                                             updateIndex);
+                if (notesSynthesized) {
+                    cmd = AudioSynth_MixNoteOutput(cmd, i);
+                } else {
+                    cmd = AudioSynth_ProcessNote(noteIndices[i], noteSubEu2,
+                                                 &gAudioContext.notes[noteIndices[i]].synthesisState, aiBuf, aiBufLen,
+                                                 cmd, updateIndex);
+                }
             } else {
                 break;
             }
@@ -646,9 +769,13 @@ Acmd* AudioSynth_DoOneAudioUpdate(s16* aiBuf, s32 aiBufLen, Acmd* cmd, s32 updat
     }
 
     while (i < count) {
-        cmd = AudioSynth_ProcessNote(noteIndices[i], &gAudioContext.noteSubsEu[t + noteIndices[i]],
-                                     &gAudioContext.notes[noteIndices[i]].synthesisState, aiBuf, aiBufLen, cmd,
-                                     updateIndex);
+        if (notesSynthesized) {
+            cmd = AudioSynth_MixNoteOutput(cmd, i);
+        } else {
+            cmd = AudioSynth_ProcessNote(noteIndices[i], &gAudioContext.noteSubsEu[t + noteIndices[i]],
+                                         &gAudioContext.notes[noteIndices[i]].synthesisState, aiBuf, aiBufLen, cmd,
+                                         updateIndex);
+        }
         i++;
     }
 
@@ -778,20 +905,20 @@ Acmd* AudioSynth_ProcessNote(s32 noteIndex, NoteSubEu* noteSubEu, NoteSynthesisS
             }
 
             if (audioFontSample->codec == CODEC_ADPCM || audioFontSample->codec == CODEC_SMALL_ADPCM) {
-                if (gAudioContext.curLoadedBook != audioFontSample->book->book) {
+                if (sCurLoadedBook != audioFontSample->book->book) {
                     u32 nEntries;
                     switch (bookOffset) {
                         case 1:
-                            gAudioContext.curLoadedBook = &D_8012FBA8[1];
+                            sCurLoadedBook = &D_8012FBA8[1];
                             break;
                         case 2:
                         case 3:
                         default:
-                            gAudioContext.curLoadedBook = audioFontSample->book->book;
+                            sCurLoadedBook = audioFontSample->book->book;
                             break;
                     }
                     nEntries = 16 * audioFontSample->book->order * audioFontSample->book->npredictors;
-                    aLoadADPCM(cmd++, nEntries, gAudioContext.curLoadedBook);
+                    aLoadADPCM(cmd++, nEntries, sCurLoadedBook);
                 }
             }
 
@@ -1174,6 +1301,11 @@ Acmd* AudioSynth_LoadWaveSamples(Acmd* cmd, NoteSubEu* noteSubEu, NoteSynthesisS
             repeats = ((nSamplesToLoad - temp_v0 + 0x3F) / 0x40);
             if (repeats != 0) {
                 aDuplicate(cmd++, repeats, DMEM_UNCOMPRESSED_NOTE, DMEM_UNCOMPRESSED_NOTE + 0x80);
+                // aDuplicate writes repeats + 1 copies, high enough pitches run past the note's buffers into the mix
+                temp_v0 = DMEM_UNCOMPRESSED_NOTE + 0x80 * (repeats + 2) - DMEM_LEFT_CH;
+                if (sNoteOutput != NULL && temp_v0 > sNoteOutput->mixOverwriteSize) {
+                    sNoteOutput->mixOverwriteSize = temp_v0;
+                }
             }
         }
         synthState->samplePosInt = samplePosInt;
@@ -1236,6 +1368,13 @@ Acmd* AudioSynth_NoteApplyHeadsetPanEffects(Acmd* cmd, NoteSubEu* noteSubEu, Not
         aSaveBuffer(cmd++, DMEM_NOTE_PAN_TEMP + bufLen, &synthState->synthesisBuffers->panResampleState[0x8],
                     ALIGN16(panShift));
     }
+    if (sNoteOutput != NULL) {
+        // Added once the rest of the note is in the mix, so it clamps against the mix like it does here
+        aSaveBuffer(cmd++, DMEM_NOTE_PAN_TEMP, sNoteOutput->panSamples, ALIGN64(bufLen));
+        sNoteOutput->panDest = dest;
+        sNoteOutput->panSize = ALIGN64(bufLen);
+        return cmd;
+    }
     aAddMixer(cmd++, ALIGN64(bufLen), DMEM_NOTE_PAN_TEMP, dest);
     return cmd;
 }
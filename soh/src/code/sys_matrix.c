@@ -1,6 +1,7 @@
 #include "global.h"
 
 #include "soh/frame_interpolation.h"
+#include "soh/mtxf_simd.h"
 #include <assert.h>
 
 // clang-format off
@@ -19,8 +20,9 @@ MtxF gMtxFClear = {
 };
 // clang-format on
 
-MtxF* sMatrixStack;   // "Matrix_stack"
-MtxF* sCurrentMatrix; // "Matrix_now"
+// Per thread so frame interpolation can replay independent branches of a recording on worker threads
+SOH_THREAD_LOCAL MtxF* sMatrixStack;   // "Matrix_stack"
+SOH_THREAD_LOCAL MtxF* sCurrentMatrix; // "Matrix_now"
 
 void Matrix_Init(GameState* gameState) {
     sCurrentMatrix = GAMESTATE_ALLOC_MC(gameState, 20 * sizeof(MtxF));
@@ -66,22 +68,9 @@ void Matrix_Mult(MtxF* mf, u8 mode) {
 void Matrix_Translate(f32 x, f32 y, f32 z, u8 mode) {
     FrameInterpolation_RecordMatrixTranslate(x, y, z, mode);
     MtxF* cmf = sCurrentMatrix;
-    f32 tx;
-    f32 ty;
 
     if (mode == MTXMODE_APPLY) {
-        tx = cmf->xx;
-        ty = cmf->xy;
-        cmf->xw += tx * x + ty * y + cmf->xz * z;
-        tx = cmf->yx;
-        ty = cmf->yy;
-        cmf->yw += tx * x + ty * y + cmf->yz * z;
-        tx = cmf->zx;
-        ty = cmf->zy;
-        cmf->zw += tx * x + ty * y + cmf->zz * z;
-        tx = cmf->wx;
-        ty = cmf->wy;
-        cmf->ww += tx * x + ty * y + cmf->wz * z;
+        MtxFSimd_Translate(cmf, x, y, z);
     } else {
         SkinMatrix_SetTranslate(cmf, x, y, z);
     }
@@ -569,11 +558,7 @@ Mtx* Matrix_MtxFToNewMtx(MtxF* src, GraphicsContext* gfxCtx) {
 }
 
 void Matrix_MultVec3f(Vec3f* src, Vec3f* dest) {
-    MtxF* cmf = sCurrentMatrix;
-
-    dest->x = cmf->xw + (cmf->xx * src->x + cmf->xy * src->y + cmf->xz * src->z);
-    dest->y = cmf->yw + (cmf->yx * src->x + cmf->yy * src->y + cmf->yz * src->z);
-    dest->z = cmf->zw + (cmf->zx * src->x + cmf->zy * src->y + cmf->zz * src->z);
+    MtxFSimd_MultVec3f(sCurrentMatrix, src, dest);
 }
 
 void Matrix_MtxFCopy(MtxF* dest, MtxF* src) {
@@ -616,9 +601,7 @@ void Matrix_MtxToMtxF(Mtx* src, MtxF* dest) {
 }
 
 void Matrix_MultVec3fExt(Vec3f* src, Vec3f* dest, MtxF* mf) {
-    dest->x = mf->xw + (mf->xx * src->x + mf->xy * src->y + mf->xz * src->z);
-    dest->y = mf->yw + (mf->yx * src->x + mf->yy * src->y + mf->yz * src->z);
-    dest->z = mf->zw + (mf->zx * src->x + mf->zy * src->y + mf->zz * src->z);
+    MtxFSimd_MultVec3f(mf, src, dest);
 }
 
 void Matrix_Transpose(MtxF* mf) {
@@ -43,6 +43,8 @@ MessageTableEntry* sStaffMessageEntryTablePtr = NULL;
 
 char* _message_0xFFFC_nes;
 
+MessageTableEntry* OTRMessage_FindEntry(MessageTableEntry* table, u16 textId);
+
 s16 sTextboxBackgroundForePrimColors[][3] = {
     { 255, 255, 255 }, { 50, 20, 0 },     { 255, 60, 0 },    { 255, 255, 255 },
     { 255, 255, 255 }, { 255, 255, 255 }, { 255, 255, 255 }, { 255, 255, 255 },
@@ -308,24 +310,22 @@ void Message_FindMessage(PlayState* play, u16 textId) {
 
     seg = messageTableEntry->segment;
 
-    while (messageTableEntry->textId != 0xFFFF) {
-        font = &play->msgCtx.font;
+    font = &play->msgCtx.font;
+    messageTableEntry = OTRMessage_FindEntry(messageTableEntry, bufferId);
 
-        if (messageTableEntry->textId == bufferId) {
-            foundSeg = messageTableEntry->segment;
-            font->charTexBuf[0] = messageTableEntry->typePos;
+    if (messageTableEntry != NULL) {
+        foundSeg = messageTableEntry->segment;
+        font->charTexBuf[0] = messageTableEntry->typePos;
 
-            nextSeg = messageTableEntry->segment;
-            font->msgOffset = messageTableEntry->segment;
-            font->msgLength = messageTableEntry->msgSize;
+        nextSeg = messageTableEntry->segment;
+        font->msgOffset = messageTableEntry->segment;
+        font->msgLength = messageTableEntry->msgSize;
 
-            // "Message found!!!"
-            osSyncPrintf(" メッセージが,見つかった！！！ = %x  "
-                         "(data=%x) (data0=%x) (data1=%x) (data2=%x) (data3=%x)\n",
-                         bufferId, font->msgOffset, font->msgLength, foundSeg, seg, nextSeg);
-            return;
-        }
-        messageTableEntry++;
+        // "Message found!!!"
+        osSyncPrintf(" メッセージが,見つかった！！！ = %x  "
+                     "(data=%x) (data0=%x) (data1=%x) (data2=%x) (data3=%x)\n",
+                     bufferId, font->msgOffset, font->msgLength, foundSeg, seg, nextSeg);
+        return;
     }
 
     // "Message not found!!!"
@@ -349,21 +349,19 @@ void Message_FindCreditsMessage(PlayState* play, u16 textId) {
     Font* font;
 
     seg = messageTableEntry->segment;
-    while (messageTableEntry->textId != 0xFFFF) {
-        font = &play->msgCtx.font;
-
-        if (messageTableEntry->textId == textId) {
-            foundSeg = messageTableEntry->segment;
-            font->charTexBuf[0] = messageTableEntry->typePos;
-            nextSeg = messageTableEntry->segment;
-            font->msgOffset = messageTableEntry->segment;
-            font->msgLength = messageTableEntry->msgSize;
-            // "Message found!!!"
-            osSyncPrintf(" メッセージが,見つかった！！！ = %x  (data=%x) (data0=%x) (data1=%x) (data2=%x) (data3=%x)\n",
-                         textId, font->msgOffset, font->msgLength, foundSeg, seg, nextSeg);
-            return;
-        }
-        messageTableEntry++;
+    font = &play->msgCtx.font;
+    messageTableEntry = OTRMessage_FindEntry(messageTableEntry, textId);
+
+    if (messageTableEntry != NULL) {
+        foundSeg = messageTableEntry->segment;
+        font->charTexBuf[0] = messageTableEntry->typePos;
+        nextSeg = messageTableEntry->segment;
+        font->msgOffset = messageTableEntry->segment;
+        font->msgLength = messageTableEntry->msgSize;
+        // "Message found!!!"
+        osSyncPrintf(" メッセージが,見つかった！！！ = %x  (data=%x) (data0=%x) (data1=%x) (data2=%x) (data3=%x)\n",
+                     textId, font->msgOffset, font->msgLength, foundSeg, seg, nextSeg);
+        return;
     }
 }
 
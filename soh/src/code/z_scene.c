@@ -5,9 +5,12 @@
 
 RomFile sNaviMsgFiles[];
 
+void OTRScene_WaitForObject(s16 objectId);
+
 s32 Object_Spawn(ObjectContext* objectCtx, s16 objectId) {
     size_t size;
 
+    OTRScene_WaitForObject(objectId);
     objectCtx->status[objectCtx->num].id = objectId;
     size = gObjectTable[objectId].vromEnd - gObjectTable[objectId].vromStart;
 
@@ -2,6 +2,7 @@
 #include "vt.h"
 
 #include "soh/frame_interpolation.h"
+#include "soh/mtxf_simd.h"
 
 // clang-format off
 MtxF sMtxFClear = {
@@ -60,130 +61,7 @@ void SkinMatrix_Vec3fMtxFMultXYZ(MtxF* mf, Vec3f* src, Vec3f* dest) {
  * mfB and dest should not be the same matrix.
  */
 void SkinMatrix_MtxFMtxFMult(MtxF* mfA, MtxF* mfB, MtxF* dest) {
-    f32 cx;
-    f32 cy;
-    f32 cz;
-    f32 cw;
-    //---ROW1---
-    f32 rx = mfA->xx;
-    f32 ry = mfA->xy;
-    f32 rz = mfA->xz;
-    f32 rw = mfA->xw;
-    //--------
-
-    cx = mfB->xx;
-    cy = mfB->yx;
-    cz = mfB->zx;
-    cw = mfB->wx;
-    dest->xx = (rx * cx) + (ry * cy) + (rz * cz) + (rw * cw);
-
-    cx = mfB->xy;
-    cy = mfB->yy;
-    cz = mfB->zy;
-    cw = mfB->wy;
-    dest->xy = (rx * cx) + (ry * cy) + (rz * cz) + (rw * cw);
-
-    cx = mfB->xz;
-    cy = mfB->yz;
-    cz = mfB->zz;
-    cw = mfB->wz;
-    dest->xz = (rx * cx) + (ry * cy) + (rz * cz) + (rw * cw);
-
-    cx = mfB->xw;
-    cy = mfB->yw;
-    cz = mfB->zw;
-    cw = mfB->ww;
-    dest->xw = (rx * cx) + (ry * cy) + (rz * cz) + (rw * cw);
-
-    //---ROW2---
-    rx = mfA->yx;
-    ry = mfA->yy;
-    rz = mfA->yz;
-    rw = mfA->yw;
-    //--------
-    cx = mfB->xx;
-    cy = mfB->yx;
-    cz = mfB->zx;
-    cw = mfB->wx;
-    dest->yx = (rx * cx) + (ry * cy) + (rz * cz) + (rw * cw);
-
-    cx = mfB->xy;
-    cy = mfB->yy;
-    cz = mfB->zy;
-    cw = mfB->wy;
-    dest->yy = (rx * cx) + (ry * cy) + (rz * cz) + (rw * cw);
-
-    cx = mfB->xz;
-    cy = mfB->yz;
-    cz = mfB->zz;
-    cw = mfB->wz;
-    dest->yz = (rx * cx) + (ry * cy) + (rz * cz) + (rw * cw);
-
-    cx = mfB->xw;
-    cy = mfB->yw;
-    cz = mfB->zw;
-    cw = mfB->ww;
-    dest->yw = (rx * cx) + (ry * cy) + (rz * cz) + (rw * cw);
-
-    //---ROW3---
-    rx = mfA->zx;
-    ry = mfA->zy;
-    rz = mfA->zz;
-    rw = mfA->zw;
-    //--------
-    cx = mfB->xx;
-    cy = mfB->yx;
-    cz = mfB->zx;
-    cw = mfB->wx;
-    dest->zx = (rx * cx) + (ry * cy) + (rz * cz) + (rw * cw);
-
-    cx = mfB->xy;
-    cy = mfB->yy;
-    cz = mfB->zy;
-    cw = mfB->wy;
-    dest->zy = (rx * cx) + (ry * cy) + (rz * cz) + (rw * cw);
-
-    cx = mfB->xz;
-    cy = mfB->yz;
-    cz = mfB->zz;
-    cw = mfB->wz;
-    dest->zz = (rx * cx) + (ry * cy) + (rz * cz) + (rw * cw);
-
-    cx = mfB->xw;
-    cy = mfB->yw;
-    cz = mfB->zw;
-    cw = mfB->ww;
-    dest->zw = (rx * cx) + (ry * cy) + (rz * cz) + (rw * cw);
-
-    //---ROW4---
-    rx = mfA->wx;
-    ry = mfA->wy;
-    rz = mfA->wz;
-    rw = mfA->ww;
-    //--------
-    cx = mfB->xx;
-    cy = mfB->yx;
-    cz = mfB->zx;
-    cw = mfB->wx;
-    dest->wx = (rx * cx) + (ry * cy) + (rz * cz) + (rw * cw);
-
-    cx = mfB->xy;
-    cy = mfB->yy;
-    cz = mfB->zy;
-    cw = mfB->wy;
-    dest->wy = (rx * cx) + (ry * cy) + (rz * cz) + (rw * cw);
-
-    cx = mfB->xz;
-    cy = mfB->yz;
-    cz = mfB->zz;
-    cw = mfB->wz;
-    dest->wz = (rx * cx) + (ry * cy) + (rz * cz) + (rw * cw);
-
-    cx = mfB->xw;
-    cy = mfB->yw;
-    cz = mfB->zw;
-    cw = mfB->ww;
-    dest->ww = (rx * cx) + (ry * cy) + (rz * cz) + (rw * cw);
+    MtxFSimd_Mult(mfA, mfB, dest);
 }
 
 /**
@@ -1054,7 +1054,7 @@ void FileChoose_UpdateRandomizer() {
             fileSelectSpoilerFileLoaded = true;
 
             if (SpoilerFileExists(CVarGetString(CVAR_GENERAL("SpoilerLog"), "")) && CVarGetInteger(CVAR_RANDOMIZER_SETTING("DontGenerateSpoiler"), 0)) {
-                remove(fileLoc);
+                Randomizer_RemoveSpoilerFile(fileLoc);
             }
     }
 }
@@ -293,6 +293,10 @@ void Title_Init(GameState* thisx) {
 
     //ResourceMgr_LoadDirectory("nintendo_rogo_static*");
 
+    // The logo's shine is drawn from gameplay_keep, which may still be preloading. The file select that follows uses
+    // the same object.
+    ResourceMgr_WaitForPreloadedDirectory("objects/gameplay_keep/");
+
     // Disable vismono
     D_801614B0.a = 0;
     R_UPDATE_RATE = 1;